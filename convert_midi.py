@@ -1,36 +1,37 @@
 """
 convert_midi.py
 
-Convert standard MIDI files to Virtual Boy 4-channel music data.
+Convert standard MIDI files to Virtual Boy 3-channel music data.
+
+The MIDI is first merged onto a shared lock-step timeline (one value per
+channel per step plus a shared step duration in milliseconds), then each
+tonal channel is written as its own event stream.
 
 Output per song (C header):
-  - int   prefix_melody[N]  : (vel << 12) | (midi_note << 4)  for ch0
-  - int   prefix_bass[N]    : (vel << 12) | (midi_note << 4)  for ch1
-  - int   prefix_chords[N]  : (vel << 12) | (midi_note << 4)  for ch3
-  - int   prefix_drums[N]   : SFX ID (doom_sfx.h) for PCM drum samples (0=silence)
-  - u16   prefix_timing[N]  : shared duration in milliseconds per step
-  - u8    prefix_arp[N]     : arpeggio offsets (optional, 0=none)
-  - #define PREFIX_NOTE_COUNT N
-
-All four channels share a single timing array (lock-step).
-Timing values are in milliseconds for rate-independent playback.
-
-Tonal channels (melody/bass/chords) encode MIDI note number:
-  bits 15-12 = velocity (0-15, where 0 means silence/rest)
-  bits 10-4  = MIDI note number (0-127)
-  bits 11, 3-0 = unused (0)
-  The VB player uses a lookup table to convert MIDI note -> VB freq register.
-
-Arpeggio array (tracker-style 0xy effect):
-  bits 7-4 = semitone offset for 2nd note (0-15)
-  bits 3-0 = semitone offset for 3rd note (0-15)
-  0x00 = no arpeggio (hold base note)
-  Player cycles: base, base+hi_nib, base+lo_nib at ~50Hz frame rate.
-
-Drums are encoded differently in bits 14-12 and 11-0:
-  bits 14-12 = noise tap register (0-7, controls timbre)
-  bits 11-0  = noise frequency register
-  Value 0 = silence (rest)
+  - u8    prefix_melody[]   : event stream for ch0
+  - u8    prefix_bass[]     : event stream for ch1
+  - u8    prefix_chords[]   : event stream for ch3
+  - #define PREFIX_LENGTH_MS : song length (every stream sums to it)
+
+Event stream (player: updateMusic in src/vbdoom/functions/sndplay.c).
+A stream is a list of commands; a note command ends an event and is
+followed by its duration:
+  0x00          rest (channel silent)
+  0x01-0x7F     MIDI note at the running velocity and arpeggio
+  0x80-0x8F     set running velocity (low nibble), a note follows
+  0x90 a        set running arpeggio (tracker-style 0xy: 2nd note +x,
+                3rd note +y semitones, 0x00 = none)
+  0xA0 lo hi n  pattern: play the n events at byte offset lo|hi<<8 of
+                this stream, then continue after the command. Patterns
+                never contain pattern commands.
+  0xFF          end: loop to the start, running status reset
+Duration: milliseconds, 0x00-0x7F in one byte, else two bytes big-endian
+with the top bit set (up to 32767). Running status starts at velocity 0,
+arpeggio 0. Only changes are stored: a held note is one event however
+many steps it spans, except arpeggiated notes, which restart their cycle
+every step. Drums are not written (the player has no drum channel).
+write_header() decodes every stream again and checks it renders the
+same note events as the lock-step arrays.
 """
 
 import os
@@ -599,80 +600,211 @@ def merge_channels(span_lists, tpb, tempo_map, vel_scales=None,
             merged_packed[3], merged_timing, merged_arp)
 
 
+# ----------------------------------------------------------------
+# Event streams
+# ----------------------------------------------------------------
+
+MUS_CMD_VEL = 0x80
+MUS_CMD_ARP = 0x90
+MUS_CMD_PATTERN = 0xA0
+MUS_CMD_END = 0xFF
+MUS_MAX_DUR = 0x7FFF
+PATTERN_MAX_EVENTS = 255
+PATTERN_CALL_BYTES = 4
+
+
+def step_state(value, arp):
+    """(vel, note, arp) sounding for one lock-step value. Rests are
+    (0, 0, 0); arp only applies to sounding notes."""
+    vel = (value >> 12) & 0x0F
+    note = (value >> 4) & 0x7F
+    if vel == 0 or note == 0:
+        return (0, 0, 0)
+    return (vel, note, arp)
+
+
+def render_steps(values, timing, arp):
+    """Note events of a lock-step channel: (start_ms, vel, note, arp) at
+    every change, and at every step of an arpeggiated note."""
+    events = []
+    t = 0
+    prev = None
+    for i, dur in enumerate(timing):
+        st = step_state(values[i], arp[i] if arp else 0)
+        if st != prev or st[2]:
+            events.append((t,) + st)
+        prev = st
+        t += dur
+    return events, t
+
+
+def channel_events(values, timing, arp):
+    """Lock-step channel -> [(vel, note, arp, dur_ms)], held notes merged."""
+    events = []
+    for i, dur in enumerate(timing):
+        st = step_state(values[i], arp[i] if arp else 0)
+        if (events and events[-1][:3] == st and not st[2]
+                and events[-1][3] + dur <= MUS_MAX_DUR):
+            events[-1] = st + (events[-1][3] + dur,)
+            continue
+        while dur > MUS_MAX_DUR:
+            events.append(st + (MUS_MAX_DUR,))
+            dur -= MUS_MAX_DUR
+        events.append(st + (dur,))
+    return events
+
+
+def encode_duration(ms):
+    if ms < 0x80:
+        return [ms]
+    return [0x80 | (ms >> 8), ms & 0xFF]
+
+
+def encode_event(event, state):
+    """Bytes of one literal event from running state (vel, arp).
+    Returns (bytes, new_state)."""
+    vel, note, arp, dur = event
+    rvel, rarp = state
+    out = []
+    if note:
+        if arp != rarp:
+            out += [MUS_CMD_ARP, arp]
+            rarp = arp
+        if vel != rvel:
+            out.append(MUS_CMD_VEL | vel)
+            rvel = vel
+    out.append(note)
+    out += encode_duration(dur)
+    return out, (rvel, rarp)
+
+
+def encode_stream(events):
+    """Encode events, replacing repeats of earlier literal runs with
+    pattern commands where that saves bytes."""
+    out = []
+    lits = []     # (offset, state_before, state_after, event, size, segment)
+    by_key = {}   # (state_before, event) -> [lit index]
+    state = (0, 0)
+    segment = 0
+    i = 0
+    while i < len(events):
+        best_len, best_save, best_j = 0, 0, -1
+        for j in by_key.get((state, events[i]), ()):
+            n, size = 0, 0
+            while (i + n < len(events) and j + n < len(lits)
+                   and n < PATTERN_MAX_EVENTS
+                   and lits[j + n][5] == lits[j][5]
+                   and lits[j + n][3] == events[i + n]):
+                size += lits[j + n][4]
+                n += 1
+            if size - PATTERN_CALL_BYTES > best_save:
+                best_len, best_save, best_j = n, size - PATTERN_CALL_BYTES, j
+        if best_len:
+            off = lits[best_j][0]
+            out += [MUS_CMD_PATTERN, off & 0xFF, off >> 8, best_len]
+            state = lits[best_j + best_len - 1][2]
+            segment += 1
+            i += best_len
+            continue
+        b, after = encode_event(events[i], state)
+        by_key.setdefault((state, events[i]), []).append(len(lits))
+        lits.append((len(out), state, after, events[i], len(b), segment))
+        out += b
+        state = after
+        i += 1
+    out.append(MUS_CMD_END)
+    assert len(out) <= 0x10000
+    return out
+
+
+def decode_stream(data):
+    """Events of one pass through a stream: [(vel, note, arp, dur_ms)].
+    Mirrors the player in sndplay.c."""
+    events = []
+    pos, ret, left = 0, None, 0
+    vel, arp = 0, 0
+    while True:
+        if ret is not None and left == 0:
+            pos, ret = ret, None
+        b = data[pos]
+        pos += 1
+        if b == MUS_CMD_END:
+            return events
+        if b == MUS_CMD_PATTERN:
+            ret = pos + 3
+            left = data[pos + 2]
+            pos = data[pos] | (data[pos + 1] << 8)
+        elif b == MUS_CMD_ARP:
+            arp = data[pos]
+            pos += 1
+        elif b & 0x80:
+            vel = b & 0x0F
+        else:
+            dur = data[pos]
+            pos += 1
+            if dur & 0x80:
+                dur = ((dur & 0x7F) << 8) | data[pos]
+                pos += 1
+            if ret is not None:
+                left -= 1
+            events.append((vel, b, arp, dur) if b else (0, 0, 0, dur))
+
+
+def render_stream(data):
+    """Note events of a stream, in the form of render_steps()."""
+    events = []
+    t = 0
+    prev = None
+    for vel, note, arp, dur in decode_stream(data):
+        st = (vel, note, arp)
+        if st != prev or arp:
+            events.append((t,) + st)
+        prev = st
+        t += dur
+    return events, t
+
+
 # ----------------------------------------------------------------
 # Write C header
 # ----------------------------------------------------------------
 
-def write_header(prefix, melody, bass, chords, drums, timing, arp, output_path):
-    """Write a C header file with 4-channel music data + optional arp array."""
+def write_header(prefix, melody, bass, chords, timing, arp, arp_ch, output_path):
+    """Write a C header with one event stream per tonal channel.
+    arp applies to channel arp_ch (0-2) only."""
     n = len(timing)
-    assert len(melody) == n and len(bass) == n and len(chords) == n and len(drums) == n
+    assert len(melody) == n and len(bass) == n and len(chords) == n
     assert arp is None or len(arp) == n
 
-    has_arp = arp is not None and any(a != 0 for a in arp)
+    length_ms = sum(timing)
+    streams = []
+    for ch, values in enumerate((melody, bass, chords)):
+        ch_arp = arp if ch == arp_ch else None
+        data = encode_stream(channel_events(values, timing, ch_arp))
+        # Host-side check: the stream must render the lock-step notes
+        assert render_stream(data) == render_steps(values, timing, ch_arp), \
+            f"{prefix}: channel {ch} stream does not match the steps"
+        streams.append(data)
 
     with open(output_path, 'w') as f:
         f.write(f"/* {os.path.basename(output_path)} -- auto-generated by convert_midi.py */\n")
         f.write(f"#ifndef __{prefix.upper()}_H__\n")
         f.write(f"#define __{prefix.upper()}_H__\n\n")
-        f.write(f"#define {prefix.upper()}_NOTE_COUNT  {n}\n")
-        f.write(f"#define {prefix.upper()}_HAS_ARP     {1 if has_arp else 0}\n\n")
-
-        # Melody (ch0) - (vel << 12) | (midi_note << 4)
-        f.write(f"static const int {prefix}_melody[{n}] = {{\n")
-        for i in range(0, n, 12):
-            chunk = melody[i:i+12]
-            f.write("\t" + ",".join(f"0x{v:04X}" for v in chunk))
-            f.write(",\n" if i + 12 < n else "\n")
-        f.write("};\n\n")
-
-        # Bass (ch1) - (vel << 12) | (midi_note << 4)
-        f.write(f"static const int {prefix}_bass[{n}] = {{\n")
-        for i in range(0, n, 12):
-            chunk = bass[i:i+12]
-            f.write("\t" + ",".join(f"0x{v:04X}" for v in chunk))
-            f.write(",\n" if i + 12 < n else "\n")
-        f.write("};\n\n")
-
-        # Chords (ch3) - (vel << 12) | (midi_note << 4)
-        f.write(f"static const int {prefix}_chords[{n}] = {{\n")
-        for i in range(0, n, 12):
-            chunk = chords[i:i+12]
-            f.write("\t" + ",".join(f"0x{v:04X}" for v in chunk))
-            f.write(",\n" if i + 12 < n else "\n")
-        f.write("};\n\n")
-
-        # Drums - PCM SFX IDs (0 = silence)
-        f.write(f"static const int {prefix}_drums[{n}] = {{\n")
-        for i in range(0, n, 12):
-            chunk = drums[i:i+12]
-            f.write("\t" + ",".join(f"0x{v:04X}" for v in chunk))
-            f.write(",\n" if i + 12 < n else "\n")
-        f.write("};\n\n")
-
-        # Shared timing (ms)
-        f.write(f"static const unsigned short {prefix}_timing[{n}] = {{\n")
-        for i in range(0, n, 12):
-            chunk = timing[i:i+12]
-            f.write("\t" + ",".join(f"{v:5d}" for v in chunk))
-            f.write(",\n" if i + 12 < n else "\n")
-        f.write("};\n\n")
-
-        # Arpeggio offsets (u8 per step, tracker-style 0xy)
-        if has_arp:
-            f.write(f"static const unsigned char {prefix}_arp[{n}] = {{\n")
-            for i in range(0, n, 16):
-                chunk = arp[i:i+16]
+        f.write(f"#define {prefix.upper()}_LENGTH_MS  {length_ms}\n\n")
+
+        for role, data in zip(('melody', 'bass', 'chords'), streams):
+            f.write(f"static const unsigned char {prefix}_{role}[{len(data)}] = {{\n")
+            for i in range(0, len(data), 16):
+                chunk = data[i:i+16]
                 f.write("\t" + ",".join(f"0x{v:02X}" for v in chunk))
-                f.write(",\n" if i + 16 < n else "\n")
+                f.write(",\n" if i + 16 < len(data) else "\n")
             f.write("};\n\n")
 
         f.write("#endif\n")
 
-    data_bytes = n * 4 * 4 + n * 2 + (n if has_arp else 0)
-    arp_info = f", arp={sum(1 for a in arp if a != 0)} active" if has_arp else ""
-    print(f"  Written: {output_path}  ({n} steps, "
-          f"{data_bytes} bytes data{arp_info})")
+    step_bytes = n * 4 * 4 + n * 2 + (n if arp else 0)
+    data_bytes = sum(len(d) for d in streams)
+    print(f"  Written: {output_path}  ({n} steps, {data_bytes} bytes data, "
+          f"lock-step was {step_bytes}; streams verified)")
 
 
 # ----------------------------------------------------------------
@@ -891,7 +1023,8 @@ def convert_song(song_cfg):
         return
 
     output_path = os.path.join(OUTPUT_DIR, song_cfg['header'])
-    write_header(song_cfg['prefix'], melody, bass, chords, drums, timing, arp, output_path)
+    write_header(song_cfg['prefix'], melody, bass, chords, timing, arp,
+                 arp_ch if arp_ch is not None else -1, output_path)
 
 
 def main():
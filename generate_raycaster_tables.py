@@ -0,0 +1,260 @@
+"""
+generate_raycaster_tables.py
+
+Generate src/vbdoom/functions/RayCasterTables.h from the parameters in
+src/vbdoom/functions/RayCaster.h (SCREEN_WIDTH, SCREEN_HEIGHT, FOV,
+INV_FACTOR_INT, MIN_DIST, HORIZON_HEIGHT), so the viewport size and field
+of view can be changed without hand-editing the lookup tables.
+
+Every table is computed twice: the integer value that goes into the ROM
+and a float reference. The script fails (exit 1, nothing written) if an
+entry is further from its reference than the truncation allows, if a
+value does not fit its C type, or if the parameters produce walls taller
+than the viewport at MIN_DIST.
+
+The makefile runs this before compiling (see makefile-game); it can also
+be run by hand:
+
+    python generate_raycaster_tables.py            regenerate
+    python generate_raycaster_tables.py --check    verify only, exit 1 if stale
+
+RAYCAST_STEP needs no tables of its own: g_deltaAngle is per pixel and
+the renderer samples it every RAYCAST_STEP columns.
+"""
+
+import math
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+FUNCTIONS_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "functions")
+INPUT_H = os.path.join(FUNCTIONS_DIR, "RayCaster.h")
+OUTPUT_H = os.path.join(FUNCTIONS_DIR, "RayCasterTables.h")
+
+ANGLE_STEPS = 256        # entries per quarter turn in the trig tables
+RECIP_VIEWZ_SIZE = 2048  # g_recipViewZ covers viewZ >> 2 up to this
+RECIP_VIEWZ_MIN = 10     # below this the sprite is on top of the camera: clamp
+
+# Sprite scale steps picked by hand in getObjectScreenPosAndScale (not derived)
+FIXED_SCALES = [5140, 2048, 1024, 682, 512, 409, 341, 292,
+                256, 227, 227, 204, 186, 170, 146, 128]
+
+C_TYPES = {"u8": 0xFF, "u16": 0xFFFF, "int16_t": 0x7FFF}
+
+
+# ---------------------------------------------------------------------------
+# RayCaster.h parameters
+# ---------------------------------------------------------------------------
+
+def read_defines(path):
+    """Integer value of the #defines we need, casts stripped, C integer division."""
+    raw = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"\s*#define\s+(\w+)\s+(.*)", line)
+            if m:
+                raw[m.group(1)] = re.sub(r"//.*|/\*.*?\*/", "", m.group(2)).strip()
+
+    def value(name, depth=0):
+        if depth > 16:
+            raise ValueError("recursive #define " + name)
+        expr = raw[name]
+        expr = re.sub(r"\((?:u8|u16|u32|s16|s32|int|fix7_9|fix23_9)\)", "", expr)
+        expr = re.sub(r"\b([A-Z_][A-Z0-9_]*)\b",
+                      lambda m: str(value(m.group(1), depth + 1)), expr)
+        return int(eval(expr.replace("/", "//"), {"__builtins__": {}}))
+
+    p = {}
+    for name in ("SCREEN_WIDTH", "SCREEN_HEIGHT", "FOV", "INV_FACTOR_INT",
+                 "MIN_DIST", "HORIZON_HEIGHT"):
+        p[name] = value(name)
+    return p
+
+
+# ---------------------------------------------------------------------------
+# Tables: (name, C type, C size, values, float reference, indices not checked)
+# ---------------------------------------------------------------------------
+
+def build_tables(p):
+    W = p["SCREEN_WIDTH"]
+    inv = p["INV_FACTOR_INT"]
+    min_dist = p["MIN_DIST"]
+    horizon = p["HORIZON_HEIGHT"]
+
+    # FOV is 7.9 fixed radians; snap it to the engine's 1024-per-turn angle
+    fov_units = int(round(p["FOV"] / 512.0 * 512.0 / math.pi))
+    half_fov = fov_units * math.pi / 1024.0
+
+    tables = []
+
+    def add(name, ctype, size, count, ref, value=None, skip=()):
+        refs = [ref(i) for i in range(count)]
+        vals = [value(i, r) if value else int(r) for i, r in enumerate(refs)]
+        tables.append((name, ctype, size, vals, refs, set(skip)))
+
+    def quarter(i):
+        return i * (math.pi / 2) / ANGLE_STEPS
+
+    # 1.8 trig over one quadrant. cotan(0) and cos(0)=256 do not fit: the
+    # fixed-point code relies on them being 0 (INVERT(0) wraps to index 0).
+    def zero_at_0(i, r):
+        return 0 if i == 0 else int(r)
+
+    add("g_tan", "u16", ANGLE_STEPS, ANGLE_STEPS,
+        lambda i: 256.0 * math.tan(quarter(i)))
+    add("g_cotan", "u16", ANGLE_STEPS, ANGLE_STEPS,
+        lambda i: 256.0 / math.tan(quarter(i)) if i else 0.0, zero_at_0)
+    add("g_sin", "u8", ANGLE_STEPS, ANGLE_STEPS,
+        lambda i: 256.0 * math.sin(quarter(i)))
+    add("g_cos", "u8", ANGLE_STEPS, ANGLE_STEPS,
+        lambda i: 256.0 * math.cos(quarter(i)), zero_at_0, skip=(0,))
+
+    # Wall half-height and texture step by distance past MIN_DIST: 4 units
+    # per entry near, 32 per entry far (see LookupHeight). Values use the
+    # integer arithmetic of the original tables, references the exact distance.
+    # The first 32 far entries overlap the near table and are never read.
+    def near_d(i):
+        return (i << 2) + min_dist
+
+    def far_d(i):
+        return (i << 5) + min_dist
+
+    add("g_nearHeight", "u8", 256, 256,
+        lambda i: inv / float(near_d(i)),
+        lambda i, r: (inv // (near_d(i) >> 2)) >> 2)
+    add("g_farHeight", "u8", 256, 256,
+        lambda i: inv / float(far_d(i)),
+        lambda i, r: (inv // (far_d(i) >> 5)) >> 5, skip=range(32))
+    add("g_nearStep", "u16", 256, 256,
+        lambda i: near_d(i) * 32768.0 / inv,
+        lambda i, r: (near_d(i) << 15) // inv)
+    add("g_farStep", "u16", 256, 256,
+        lambda i: far_d(i) * 32768.0 / inv,
+        lambda i, r: (far_d(i) << 15) // inv)
+
+    # Closer than MIN_DIST the wall overflows the viewport: start the texture
+    # part way in. Entry 0 is never used (distance 0 is inside the wall).
+    add("g_overflowOffset", "u16", 256, 256,
+        lambda i: 32768.0 * (1.0 - i * horizon / float(inv)),
+        lambda i, r: 0 if i == 0 else 32768 - ((i << 15) * horizon + inv - 1) // inv,
+        skip=(0,))
+    add("g_overflowStep", "u16", 256, 256,
+        lambda i: i * 32768.0 / inv,
+        lambda i, r: (i << 15) // inv)
+
+    # Ray angle offset of each screen column, 1024 per turn, wrapped
+    add("g_deltaAngle", "u16", "SCREEN_WIDTH", W,
+        lambda i: math.atan((i - W / 2.0) / (W / 2.0) * half_fov) * 512.0 / math.pi,
+        lambda i, r: int(r) & 1023)
+
+    add("g_sqrtLookupTable", "u16", "MIN_DIST", min_dist,
+        lambda i: math.sqrt(i), lambda i, r: math.isqrt(i))
+
+    tables.append(("g_fixedscales", "int16_t", 16, FIXED_SCALES, None, ()))
+
+    add("g_recipViewZ", "u16", RECIP_VIEWZ_SIZE, RECIP_VIEWZ_SIZE,
+        lambda i: 65536.0 / i if i else 65535.0,
+        lambda i, r: 65535 if i < RECIP_VIEWZ_MIN else 65536 // i,
+        skip=range(RECIP_VIEWZ_MIN))
+    return tables
+
+
+# ---------------------------------------------------------------------------
+# Verification
+# ---------------------------------------------------------------------------
+
+def verify(p, tables):
+    """Every entry must be the truncated float reference (error below 1)."""
+    errors = []
+    for name, ctype, size, vals, refs, skip in tables:
+        top = C_TYPES[ctype]
+        for i, v in enumerate(vals):
+            if v < 0 or v > top:
+                errors.append("%s[%d] = %d does not fit %s" % (name, i, v, ctype))
+        if refs is None:
+            continue
+        worst = 0.0
+        for i, (v, r) in enumerate(zip(vals, refs)):
+            if i in skip:
+                continue
+            err = v - r
+            if name == "g_deltaAngle":
+                err = (err + 512) % 1024 - 512
+            worst = max(worst, abs(err))
+        if worst >= 1.0:
+            errors.append("%s: max error %.3f vs float reference" % (name, worst))
+
+    # At MIN_DIST the wall must just fit: the overflow tables take over below it
+    near0 = tables_by_name(tables)["g_nearHeight"][0]
+    if near0 > p["HORIZON_HEIGHT"]:
+        errors.append("g_nearHeight[0] = %d is taller than HORIZON_HEIGHT %d: "
+                      "raise MIN_DIST or lower INV_FACTOR_INT"
+                      % (near0, p["HORIZON_HEIGHT"]))
+    return errors
+
+
+def tables_by_name(tables):
+    return dict((t[0], t[3]) for t in tables)
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def render(p, tables):
+    out = []
+    out.append("/* Generated by generate_raycaster_tables.py from RayCaster.h -- do not edit.")
+    out.append(" * SCREEN_WIDTH %d, SCREEN_HEIGHT %d, FOV %d, INV_FACTOR_INT %d, MIN_DIST %d */"
+               % (p["SCREEN_WIDTH"], p["SCREEN_HEIGHT"], p["FOV"],
+                  p["INV_FACTOR_INT"], p["MIN_DIST"]))
+    out.append("#ifndef _FUNCTIONS_RAYCASTERTABLES_H")
+    out.append("#define _FUNCTIONS_RAYCASTERTABLES_H")
+    out.append("")
+    out.append('#include "RayCaster.h"')
+    out.append("#include <types.h>")
+    out.append("")
+    out.append("#define HAS_TABLES")
+    out.append("")
+    for name, ctype, size, vals, refs, skip in tables:
+        if name == "g_recipViewZ":
+            out.append("/* Reciprocal LUT: g_recipViewZ[i] = (1<<16)/i for i>=%d, 0xFFFF for i<%d."
+                       % (RECIP_VIEWZ_MIN, RECIP_VIEWZ_MIN))
+            out.append(" * Used to replace expensive /viewZ divisions in sprite projection. %dKB ROM. */"
+                       % (RECIP_VIEWZ_SIZE * 2 // 1024))
+        out.append("const %s LOOKUP_TBL %s[%s] = {%s};"
+                   % (ctype, name, size, ",".join(str(v) for v in vals)))
+        out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    check_only = "--check" in sys.argv[1:]
+    p = read_defines(INPUT_H)
+    tables = build_tables(p)
+    errors = verify(p, tables)
+    if errors:
+        for e in errors:
+            print("generate_raycaster_tables: " + e, file=sys.stderr)
+        return 1
+
+    text = render(p, tables)
+    old = None
+    if os.path.exists(OUTPUT_H):
+        with open(OUTPUT_H) as f:
+            old = f.read()
+    if old == text:
+        return 0
+    if check_only:
+        print("generate_raycaster_tables: %s is stale" % OUTPUT_H, file=sys.stderr)
+        return 1
+    with open(OUTPUT_H, "w", newline="\n") as f:
+        f.write(text)
+    print("Wrote %s (%dx%d, MIN_DIST %d)"
+          % (OUTPUT_H, p["SCREEN_WIDTH"], p["SCREEN_HEIGHT"], p["MIN_DIST"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,5 +1,6 @@
 #include "types.h"
 #include "affine.h"
+#include "vramstats.h"
 
 
 // clear a world's affine param table based on world height
@@ -9,6 +10,7 @@ void affine_clr_param(u8 world) {
 
 	tmp = (world<<4);
 	param = (s16*)((WAM[tmp+9]<<1)+0x00020000);
+	VRAM_COUNT(param, WAM[tmp+8]<<4);
 	for (i = 0; i < (WAM[tmp+8]<<3); i++) param[i]=0;
 }
 
@@ -16,13 +18,12 @@ void affine_clr_param(u8 world) {
 // world: number of the world to apply scaling to, must be using affine BGM
 // centerX/centerY: center point (relative to the world) to scale around.
 // imageW/imageH: original image width and height
-// scaleX/scaleY: scale factor per axis.
-//   lowest positive:  0.0156254
-//   highest positive: 512
-//   lowest negative:  -512
-//   highest negative: -0.015625
-// '1' is 100% scale, '2' is 200%, '0.05' is 5%, etc
-void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, float scaleX, float scaleY) {
+// scaleX/scaleY: scale factor per axis, 7.9 fixed (fix7_9).
+//   ITOFIX7_9(1) (512) is 100%, ITOFIX7_9(2) is 200%, FTOFIX7_9(0.05f) (26) is 5%, etc
+//   lowest positive:  9      (~0.0176, inverse must fit 7.9)
+//   highest positive: 32767  (~63.99)
+//   negative values mirror
+void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, fix7_9 scaleX, fix7_9 scaleY) {
 	int i,tmp;
 	s16 *param;
 	f16 XSrc,XScl,YScl;
@@ -31,12 +32,15 @@ void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, fl
 	tmp = (world<<4);
 	param = (s16*)((WAM[tmp+9]<<1)+0x00020000);
 
-	XScl = inverse_fixed(scaleX);
-	YScl = inverse_fixed(scaleY);
+	XScl = inverse_fixed7_9(scaleX);
+	YScl = inverse_fixed7_9(scaleY);
 
-	XSrc = -fixed_13_3((centerX-((imageW*scaleX)/2))/scaleX); //keep image centered
-	YSrc = -fixed_7_9((centerY-((imageH*scaleY)/2))/scaleY);
+	//keep image centered: (center - image*scale/2) / scale, numerator in 23.9,
+	//shifted to 13.3 before the divide so the quotient lands in 13.3 directly
+	XSrc = -(f16)(((((s32)centerX<<9) - (((s32)imageW*scaleX)>>1))<<3) / scaleX);
+	YSrc = -((f32)(((((s32)centerY<<9) - (((s32)imageH*scaleY)>>1))<<3) / scaleY) << 6);
 
+	VRAM_COUNT(param, (int)WAM[tmp+8] * 6);
 	i=0;
 	while (i < (int)(WAM[tmp+8]<<3)) {
 		param[i++] = XSrc;		//XSrc
@@ -51,13 +55,9 @@ void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, fl
 
 // scale an affine background
 // world: number of the world to apply scaling to, must be using affine BGM
-// scale: scale factor.
-//   lowest positive:  0.0156254
-//   highest positive: 512
-//   lowest negative:  -512
-//   highest negative: -0.015625
-// '1' is 100% scale, '2' is 200%, '0.05' is 5%, etc
-void affine_fast_scale(u8 world, float scale) {
+// scale: scale factor, 7.9 fixed (fix7_9), same range as affine_scale.
+//   ITOFIX7_9(1) (512) is 100%, ITOFIX7_9(2) is 200%, FTOFIX7_9(0.05f) (26) is 5%, etc
+void affine_fast_scale(u8 world, fix7_9 scale) {
 	int i,tmp;
 	s16 *param;
 	f16 XScl,YScl;
@@ -66,9 +66,10 @@ void affine_fast_scale(u8 world, float scale) {
 	tmp = (world<<4);
 	param = (s16*)((WAM[tmp+9]<<1)+0x00020000);
 
-	XScl = YScl = inverse_fixed(scale);
+	XScl = YScl = inverse_fixed7_9(scale);
 	YSrc = 0;
 
+	VRAM_COUNT(param, (int)WAM[tmp+8] * 6);
 	i=0;
 	while (i < (int)(WAM[tmp+8]<<3)) {
 		param[i++] = 0;			//XSrc
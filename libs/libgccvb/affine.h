@@ -10,16 +10,18 @@
 
 #include "types.h"
 #include "video.h"
+#include "math.h"
 
 
 #define fixed_7_9(n)		(f32)(n * (1<<9))			//convert from float\int\etc to 7.9 fixed
 #define fixed_13_3(n)		(f16)(n * (1<<3))			//convert from float\int\etc to 13.3 fixed
 #define inverse_fixed(n)	(f16)((1<<18)/fixed_7_9(n))	//convert from float\int\etc to 7.9 fixed (with inversion)
+#define inverse_fixed7_9(n)	(f16)((1L<<18)/(s32)(n))	//invert a value that is already 7.9 fixed (integer divide only)
 
 
 void affine_clr_param(u8 world);
-void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, float scaleX, float scaleY);
-void affine_fast_scale(u8 world, float scale);
+void affine_scale(u8 world, s16 centerX, s16 centerY, u16 imageW, u16 imageH, fix7_9 scaleX, fix7_9 scaleY);
+void affine_fast_scale(u8 world, fix7_9 scale);
 
 
 #endif
\ No newline at end of file
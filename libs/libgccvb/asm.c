@@ -14,7 +14,7 @@
     asm("__dojump:");
     asm("jmp	[r6];");
 
-void inline set_intlevel(u8 level) 
+WRAM_CODE void set_intlevel(u8 level)
 {
 	asm(
 	    "stsr	sr5,r5;"
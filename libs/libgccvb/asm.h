@@ -2,11 +2,16 @@
 #define _LIBGCCVB_ASM_H
 
 
+#include "types.h"
+#include "wram.h"
+
+
 #define INT_ENABLE		asm("CLI;")
 #define INT_DISABLE		asm("SEI;")
+#define CPU_HALT		asm volatile("HALT;")	// sleep until the next interrupt
 
 u32 jump_addr(void *addr);
-extern void set_intlevel(u8 level);
+extern void set_intlevel(u8 level) WRAM_CODE;
 extern int get_intlevel();
 
 
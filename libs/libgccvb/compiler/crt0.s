@@ -64,6 +64,22 @@ end_init_data:
 	cmp	    r8,    r7
 	blt	    top_init_data
 
+/* initiallize .wram_text section (hot code run from WRAM) */
+	movhi	hi(__wram_text_start), r0, r7
+	movea	lo(__wram_text_start), r7, r7
+	movhi	hi(__wram_text_end),   r0, r8
+	movea	lo(__wram_text_end),   r8, r8
+	jr	    end_init_wram_text
+
+top_init_wram_text:
+	ld.b	0[r6], r9
+	st.b	r9,    0[r7]
+	add	    1,     r6
+	add	    1,     r7
+end_init_wram_text:
+	cmp	    r8,    r7
+	blt	    top_init_wram_text
+
 /* initiallize .dram_data section */
 	movhi	hi(__dram_data_start), r0, r7
 	movea	lo(__dram_data_start), r7, r7
@@ -9,7 +9,7 @@ extern u32 keyVector;
 extern u32 timVector;
 extern u32 croVector;
 extern u32 comVector;
-extern u32 vpuVector;
+extern u32 vipVector;
 
 
 #endif
\ No newline at end of file
@@ -18,6 +18,8 @@
 #include "vip.h"
 #include "world.h"
 #include "timer.h"
+#include "wram.h"
+#include "vramstats.h"
 
 
 #endif
\ No newline at end of file
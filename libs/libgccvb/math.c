@@ -1,5 +1,7 @@
 #include "math.h"
 
+#ifndef FIXED_ONLY
+
 float squareRootFloat(float number) 
 {
     long i;
@@ -14,4 +16,86 @@ float squareRootFloat(float number)
     y  = y * ( f - ( x * y * y ) );
     y  = y * ( f - ( x * y * y ) );
     return number * y;
-}
\ No newline at end of file
+}
+#endif
+
+
+const u16 RECIP8LUT[256] = {
+	    0,32768,16384,10922, 8192, 6553, 5461, 4681, 4096, 3640, 3276, 2978, 2730, 2520, 2340, 2184,
+	 2048, 1927, 1820, 1724, 1638, 1560, 1489, 1424, 1365, 1310, 1260, 1213, 1170, 1129, 1092, 1057,
+	 1024,  992,  963,  936,  910,  885,  862,  840,  819,  799,  780,  762,  744,  728,  712,  697,
+	  682,  668,  655,  642,  630,  618,  606,  595,  585,  574,  564,  555,  546,  537,  528,  520,
+	  512,  504,  496,  489,  481,  474,  468,  461,  455,  448,  442,  436,  431,  425,  420,  414,
+	  409,  404,  399,  394,  390,  385,  381,  376,  372,  368,  364,  360,  356,  352,  348,  344,
+	  341,  337,  334,  330,  327,  324,  321,  318,  315,  312,  309,  306,  303,  300,  297,  295,
+	  292,  289,  287,  284,  282,  280,  277,  275,  273,  270,  268,  266,  264,  262,  260,  258,
+	  256,  254,  252,  250,  248,  246,  244,  242,  240,  239,  237,  235,  234,  232,  230,  229,
+	  227,  225,  224,  222,  221,  219,  218,  217,  215,  214,  212,  211,  210,  208,  207,  206,
+	  204,  203,  202,  201,  199,  198,  197,  196,  195,  193,  192,  191,  190,  189,  188,  187,
+	  186,  185,  184,  183,  182,  181,  180,  179,  178,  177,  176,  175,  174,  173,  172,  171,
+	  170,  169,  168,  168,  167,  166,  165,  164,  163,  163,  162,  161,  160,  159,  159,  158,
+	  157,  156,  156,  155,  154,  153,  153,  152,  151,  151,  150,  149,  148,  148,  147,  146,
+	  146,  145,  144,  144,  143,  143,  142,  141,  141,  140,  140,  139,  138,  138,  137,  137,
+	  136,  135,  135,  134,  134,  133,  133,  132,  132,  131,  131,  130,  130,  129,  129,  128
+};
+
+//ATANLUT[i] = atan(i/128) in 1024-per-turn units, one octant (0..128)
+static const u8 ATANLUT[129] = {
+	  0,  1,  3,  4,  5,  6,  8,  9, 10, 11, 13, 14, 15, 16, 18, 19,
+	 20, 22, 23, 24, 25, 27, 28, 29, 30, 31, 33, 34, 35, 36, 38, 39,
+	 40, 41, 42, 44, 45, 46, 47, 48, 49, 51, 52, 53, 54, 55, 56, 57,
+	 58, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 74, 75,
+	 76, 77, 78, 79, 80, 81, 82, 83, 84, 84, 85, 86, 87, 88, 89, 90,
+	 91, 92, 93, 94, 95, 96, 96, 97, 98, 99,100,101,102,102,103,104,
+	105,106,106,107,108,109,110,110,111,112,113,113,114,115,116,116,
+	117,118,119,119,120,121,121,122,123,123,124,125,125,126,127,127,
+	128
+};
+
+s16 fix_atan2(s16 dy, s16 dx)
+{
+	s16 angle;
+	u16 adx = (u16)(dx < 0 ? -dx : dx);
+	u16 ady = (u16)(dy < 0 ? -dy : dy);
+	u16 major, minor;
+
+	if (adx == 0 && ady == 0) return 0;
+
+	if (adx >= ady) { major = adx; minor = ady; }
+	else            { major = ady; minor = adx; }
+
+	//shift both down until major fits the reciprocal table, ratio is kept
+	while (major > 255) { major >>= 1; minor >>= 1; }
+
+	//minor/major as 0..128, then its arctangent within the octant
+	angle = ATANLUT[((u32)minor * RECIP8LUT[major]) >> 8];
+	if (adx < ady) angle = 256 - angle;
+
+	//quadrant
+	if (dx >= 0 && dy < 0)
+		angle = 1024 - angle;
+	else if (dx < 0 && dy < 0)
+		angle = 512 + angle;
+	else if (dx < 0)
+		angle = 512 - angle;
+
+	return angle & 1023;
+}
+
+u16 fix_dist(s16 dx, s16 dy)
+{
+	u16 adx = (u16)(dx < 0 ? -dx : dx);
+	u16 ady = (u16)(dy < 0 ? -dy : dy);
+
+	if (adx > ady) return adx + (ady >> 1);
+	return ady + (adx >> 1);
+}
+
+u16 fix_dist_oct(s16 dx, s16 dy)
+{
+	u32 adx = (u32)(dx < 0 ? -dx : dx);
+	u32 ady = (u32)(dy < 0 ? -dy : dy);
+
+	if (adx > ady) return (u16)((adx * 123 + ady * 51 + 64) >> 7);
+	return (u16)((ady * 123 + adx * 51 + 64) >> 7);
+}
@@ -10,19 +10,23 @@
 // round functions
 #define FIX23_9_ROUNDTOI(n)	((FIX23_9TOI(n)) + (((n) & 0x000001FF) >> 8))
 
+//convert a float to fixed point
+//only use these on constants: the compiler folds them, no float code is emitted
+#define FTOFIX7_9(n)		(fix7_9) ((n) * 512.0f+0.5f)
+#define FTOFIX13_3(n)		(fix13_3)((n) *   8.0f+0.5f)
+#define FTOFIX23_9(n)		(fix23_9)((n) * 512.0f+0.5f)
+
+//runtime float helpers, not available in the fixed-point-only build (FIXED_ONLY)
+#ifndef FIXED_ONLY
 #define F_ROUND(n)		(int)((n) + 0.5f)
 //floor and ceil
 #define F_FLOOR(n)		(int) ((n)-0.5f)
 #define F_CEIL(n)			(int)((n)+0.5f)
 
-//convert a float to fixed point and back
-#define FTOFIX7_9(n)		(fix7_9) ((n) * 512.0f+0.5f)
-#define FTOFIX13_3(n)		(fix13_3)((n) *   8.0f+0.5f)
-#define FTOFIX23_9(n)		(fix23_9)((n) * 512.0f+0.5f)
-
 #define FIX7_9TOF(n)		(float)  ((n) / 512.0f)
 #define FIX13_3TOF(n)		(float)  ((n) /   8.0f)
 #define FIX23_9TOF(n)		(float)  ((n) / 512.0f)
+#endif
 
 //convert an int to fixed point and back
 #define ITOFIX7_9(n)		(fix7_9) ((n)<<9)
@@ -124,10 +128,34 @@ static const s16 SINLUT[] = {
 #define COS(x) SINLUT[((x)+128)&0x1FF]
 #define SIN(x) SINLUT[(x)&0x1FF]
 
+#ifndef FIXED_ONLY
 #define COSF(x) FIX7_9TOF(SINLUT[((x)+128)&0x1FF])
 #define SINF(x) FIX7_9TOF(SINLUT[(x)&0x1FF])
 
 float squareRootFloat(float number);
+#endif
+
+//Integer-only helpers (math.c). No division, no float: safe for FIXED_ONLY
+//and for per-frame code. Angles use the engine convention: 0..1023 for a
+//full turn, 0 = +x, 256 = +y.
+
+//RECIP8LUT[i] = 32768/i (i = 1..255, [0] = 0): (n<<7)/d ~= (n*RECIP8LUT[d])>>8
+extern const u16 RECIP8LUT[256];
+
+//octant atan2 through RECIP8LUT + a 129 entry arctangent table,
+//within 2.8 units of the true angle; fix_atan2(0,0) == 0
+s16 fix_atan2(s16 dy, s16 dx);
+
+//distance estimates, worst error against the true length (the
+//integer rounding makes it worse for short vectors):
+//fix_dist     max + min/2, exact on the axes, cheapest, AI ranges
+//             0% .. +11.8% once max >= 64, -29.3% .. +11.8% below
+//             (1,1) gives 1
+//fix_dist_oct (123max + 51min + 64)/128, fireball aim
+//             -4.6% .. +4.7% once max >= 64, -29.3% .. +11.8% below
+//tools/math_check measures these (run_math_check.py)
+u16 fix_dist(s16 dx, s16 dy);
+u16 fix_dist_oct(s16 dx, s16 dy);
 
 
-#endif
\ No newline at end of file
+#endif
@@ -1,5 +1,6 @@
 #include "types.h"
 #include "mem.h"
+#include "vramstats.h"
 
 
 u8* const	EXPANSION =	(u8*)0x04000000;	// Expansion bus area
@@ -13,6 +14,9 @@ u16* const	SAVERAM =	(u16*)0x06000000;	// Cartridge's Battery-backed SRAM
 void copymem (u8* dest, const u8* src, u16 num)
 {
 	u16 i;
+#ifdef VRAM_STATS
+	if ((u32)dest < VRAM_END) VRAM_COUNT(dest, num);
+#endif
 	for (i = 0; i < num; i++) {
 		*dest++ = *src++;
 	}
@@ -22,6 +26,9 @@ void copymem (u8* dest, const u8* src, u16 num)
 void setmem (u8* dest, u8 src, u16 num)
 {
 	u16 i;
+#ifdef VRAM_STATS
+	if ((u32)dest < VRAM_END) VRAM_COUNT(dest, num);
+#endif
 	for (i = 0; i < num; i++) {
 		*dest++ = src;
 	}
@@ -31,6 +38,9 @@ void setmem (u8* dest, u8 src, u16 num)
 void addmem (u8* dest, const u8* src, u16 num, u8 offset) 
 {
 	u16 i;
+#ifdef VRAM_STATS
+	if ((u32)dest < VRAM_END) VRAM_COUNT(dest, num);
+#endif
 	for (i = 0; i < num; i++) {
 		*dest++ = (*src++ + offset);
 	}
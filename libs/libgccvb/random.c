@@ -31,4 +31,20 @@ long randseed()
 int randnum(long seed, int randnums)
 {
 	return (seed%randnums);
-}
\ No newline at end of file
+}
+
+
+u16 g_rndState = 12345;
+
+// Restart the stream; the same seed gives the same sequence
+void rndSeed(u16 seed)
+{
+	g_rndState = seed;
+}
+
+// Next byte of the stream (high byte of the LCG, the low bits are poor)
+u8 rnd8()
+{
+	g_rndState = g_rndState * 25173 + 13849;
+	return (u8)(g_rndState >> 8);
+}
@@ -2,8 +2,18 @@
 #define _LIBGCCVB_RANDOM_H
 
 
+#include "types.h"
+
+
 long randseed();
 int randnum(long seed, int randnums);
 
+// Seeded random stream. Everything that needs gameplay randomness draws from
+// this one 16-bit LCG, so a run is reproduced exactly by its seed (demos).
+extern u16 g_rndState;
+
+void rndSeed(u16 seed);
+u8 rnd8();
+
 
 #endif
\ No newline at end of file
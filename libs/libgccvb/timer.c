@@ -5,7 +5,7 @@
 
 u8 tcr_val = 0;
 
-void timer_enable(int enb) 
+WRAM_CODE void timer_enable(int enb)
 {
 	if (enb) tcr_val |= TIMER_ENB;
 	else tcr_val &= ~TIMER_ENB;
@@ -17,7 +17,7 @@ u16 timer_get()
 	return (HW_REGS[TLR] | (HW_REGS[THR] << 8));
 }
 
-void timer_set(u16 time) 
+WRAM_CODE void timer_set(u16 time)
 {
 	HW_REGS[TLR] = (time & 0xFF);
 	HW_REGS[THR] = (time >> 8);
@@ -30,7 +30,7 @@ void timer_freq(int freq)
 	HW_REGS[TCR] = tcr_val;
 }
 
-void timer_int(int enb) 
+WRAM_CODE void timer_int(int enb)
 {
 	if (enb) tcr_val |= TIMER_INT;
 	else tcr_val &= ~TIMER_INT;
@@ -42,7 +42,7 @@ int timer_getstat()
 	return (!!(HW_REGS[TCR] & TIMER_ZSTAT));
 }
 
-void timer_clearstat() 
+WRAM_CODE void timer_clearstat()
 {
 	HW_REGS[TCR] = (tcr_val|TIMER_ZCLR);
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "types.h"
 #include "hw.h"
+#include "wram.h"
 
 
 //use with 20us timer (range = 0 to 1300)
@@ -22,13 +23,13 @@
 #define TIMER_100US		0x00
 
 
-void timer_enable(int enb);
+void timer_enable(int enb) WRAM_CODE;
 u16 timer_get();
-void timer_set(u16 time);
+void timer_set(u16 time) WRAM_CODE;
 void timer_freq(int freq);
-void timer_int(int enb);
+void timer_int(int enb) WRAM_CODE;
 int timer_getstat();
-void timer_clearstat();
+void timer_clearstat() WRAM_CODE;
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "types.h"
+#include "vramstats.h"
+
+#ifdef VRAM_STATS
+
+u8 g_vramSys = 0;
+u32 g_vramBySys[VRAM_SYSTEMS];
+u32 g_vramByRegion[VRAM_REGIONS];
+u32 g_vramLastBySys[VRAM_SYSTEMS];
+u32 g_vramLastByRegion[VRAM_REGIONS];
+u32 g_vramLastTotal = 0;
+u16 g_vramOverFrames = 0;
+bool g_vramOverBudget = false;
+
+void vramStatsFrame(void)
+{
+	u32 total = 0;
+	u8 i;
+
+	for (i = 0; i < VRAM_SYSTEMS; i++) {
+		total += g_vramBySys[i];
+		g_vramLastBySys[i] = g_vramBySys[i];
+		g_vramBySys[i] = 0;
+	}
+	for (i = 0; i < VRAM_REGIONS; i++) {
+		g_vramLastByRegion[i] = g_vramByRegion[i];
+		g_vramByRegion[i] = 0;
+	}
+	g_vramLastTotal = total;
+
+	g_vramOverBudget = (total > VRAM_BUDGET);
+	if (g_vramOverBudget && g_vramOverFrames < 0xFFFF) g_vramOverFrames++;
+}
+
+#endif
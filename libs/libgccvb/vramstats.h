@@ -0,0 +1,80 @@
+#ifndef _LIBGCCVB_VRAMSTATS_H_
+#define _LIBGCCVB_VRAMSTATS_H_
+
+
+#include "types.h"
+
+
+/*
+ * VRAM write accounting, debug builds only (VRAM_STATS, set by the debug
+ * build type in makefile-game). In release every macro below is empty.
+ *
+ * copymem/setmem/addmem count themselves when the destination is VRAM;
+ * direct stores (BGMap entries, affine params) are counted by the code
+ * doing them with VRAM_COUNT. Bytes are tallied twice: per subsystem, the
+ * id last set with VRAM_SYS (the game uses its profiler zones), and per
+ * destination region from the address (VRAM_REGION). Affine param tables
+ * share BGMap memory: writes to the upper 4 KB of a BGMap listed in
+ * VRAM_PARAM_MAPS count as params, the game keeps its tables there.
+ *
+ * vramStatsFrame() closes a frame: the tallies move to g_vramLast*, frames
+ * above VRAM_BUDGET bytes raise g_vramOverBudget and bump g_vramOverFrames.
+ * The game shows them on the profiler overlay's VRAM page (profiler.h).
+ */
+
+#define VRAM_SYSTEMS		8
+
+#define VRAM_REGION_CHR		0	// character memory (0x00078000 and its segments)
+#define VRAM_REGION_BGMAP	1	// BGMaps
+#define VRAM_REGION_PARAM	2	// affine and H-bias param tables
+#define VRAM_REGION_WORLD	3	// world attributes, CLUT, OAM
+#define VRAM_REGION_FB		4	// frame buffers
+#define VRAM_REGIONS		5
+
+#define VRAM_END			0x00080000
+
+// bit n set: the upper half of BGMap(n) holds param tables, override with
+// -DVRAM_PARAM_MAPS=mask (default: BGMaps 3-9, the game's affine worlds)
+#ifndef VRAM_PARAM_MAPS
+#define VRAM_PARAM_MAPS		0x03F8
+#endif
+
+#define VRAM_REGION(a)	((a) >= 0x00078000 ? VRAM_REGION_CHR :		\
+						 (a) >= 0x0003D800 ? VRAM_REGION_WORLD :	\
+						 (a) >= 0x00020000 ?						\
+						 (((a) & 0x1000) && ((VRAM_PARAM_MAPS >> (((a) - 0x00020000) >> 13)) & 1) ? \
+						  VRAM_REGION_PARAM : VRAM_REGION_BGMAP) :	\
+						 ((a) & 0x6000) == 0x6000 ? VRAM_REGION_CHR : VRAM_REGION_FB)
+
+// bytes per frame before a frame is flagged, override with -DVRAM_BUDGET=n
+#ifndef VRAM_BUDGET
+#define VRAM_BUDGET			8192
+#endif
+
+#ifdef VRAM_STATS
+
+extern u8 g_vramSys;
+extern u32 g_vramBySys[VRAM_SYSTEMS];
+extern u32 g_vramByRegion[VRAM_REGIONS];
+extern u32 g_vramLastBySys[VRAM_SYSTEMS];
+extern u32 g_vramLastByRegion[VRAM_REGIONS];
+extern u32 g_vramLastTotal;
+extern u16 g_vramOverFrames;
+extern bool g_vramOverBudget;
+
+#define VRAM_SYS(s)			(g_vramSys = (s))
+#define VRAM_COUNT(addr, n)	(g_vramBySys[g_vramSys] += (n), \
+							 g_vramByRegion[VRAM_REGION((u32)(addr))] += (n))
+
+void vramStatsFrame(void);
+
+#else
+
+#define VRAM_SYS(s)			((void)0)
+#define VRAM_COUNT(addr, n)	((void)0)
+#define vramStatsFrame()	((void)0)
+
+#endif
+
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef _LIBGCCVB_WRAM_H_
+#define _LIBGCCVB_WRAM_H_
+
+
+/*
+ * Hot code in WRAM.
+ *
+ * Functions tagged WRAM_CODE are linked into the .wram_text section:
+ * stored in ROM right after .data, copied to WRAM by crt0 at boot and
+ * executed from there (no cartridge wait states on instruction fetch).
+ *
+ * WRAM (0x05000000) and ROM (0x07000000) are 32MB apart, which is just
+ * out of reach of jal's 26-bit displacement, so every call that crosses
+ * the two must be a register jump: long_call makes callers emit
+ * movhi/movea/jmp. The tag must be on the prototype callers see, and a
+ * WRAM function should only call other WRAM functions.
+ * noinline keeps the body in WRAM instead of being copied into a ROM caller.
+ *
+ * The makefile prints the size of the relocated set after linking --
+ * keep an eye on it, it shares WRAM with .data, .bss and the stack.
+ */
+#define WRAM_CODE	__attribute__((section(".wram_text"), long_call, noinline))
+
+
+#endif
@@ -1,28 +1,62 @@
 """
 prepare_doom_sfx.py
 
-Convert original Doom WAV files (11025 Hz, 8-bit, mono) to packed 4-bit
-nibble arrays for PCM playback on the Virtual Boy.
+Convert original Doom WAV files (11025 Hz, 8-bit, mono) to 2-bit ADPCM
+arrays for PCM playback on the Virtual Boy. Sounds that 2 bits leave
+below SNR_FLOOR_DB get 3-bit ADPCM, and those still below it stay plain
+4-bit PCM.
 
 Playback method (from DogP's wavonvb):
   - Fill waveform RAM with DC constant (0x3F)
   - Modulate the SxLRV (volume) register per sample as a 4-bit DAC
-  - Each sample is 0-15, packed two per byte (high nibble first)
+  - Each sample is 0-15, decoded by the timer ISR from 2- or 3-bit ADPCM
+    codes, or read as a 4-bit nibble
+
+ADPCM format (decoder: timerHandle in src/vbdoom/functions/timer.c):
+  - State: pred 0-255 (starts at 128), step index (starts at 0)
+  - Code: bit 1 = sign, bit 0 = magnitude
+      step = ADPCM_STEPS[index]
+      diff = step/2 + (magnitude ? step : 0)
+      pred = clamp(pred -/+ diff, 0, 255)
+      index += magnitude ? +1 : -1   (clamped to the table)
+  - Output sample = pred >> 4
+  - Four codes per byte, first sample in the top two bits
+  The encoder picks each code by searching ADPCM_LOOKAHEAD samples ahead
+  against the 8-bit source. Half the size of packed 4-bit nibbles.
+
+3-bit ADPCM: bit 2 = sign, bits 0-1 = magnitude m
+      step = ADPCM3_STEPS[index]
+      diff = step/4 + (m & 1 ? step/2 : 0) + (m & 2 ? step : 0)
+      index += -1, -1, +1, +2 for m = 0..3   (clamped to the table)
+  - Codes as one bit stream, first sample in the top bits of the first
+    byte, plus a zero byte so the decoder may always read two bytes
+  Three quarters the size of 4-bit nibbles.
+
+4-bit PCM: two samples per byte, first sample in the top nibble (the
+format before ADPCM).
+
+Quality: each sound's decoded output is compared with the plain 4-bit
+PCM of the same source (what the game played before ADPCM). The first
+depth of 2, 3 and 4 bits that reaches SNR_FLOOR_DB is kept, so no sound
+ships below the floor. The SNR is printed per sound, with the median
+and the worst, and written next to each array in doom_sfx.c.
 
 Pipeline:
   1. Read each WAV (expected: 11025 Hz, 8-bit unsigned, mono)
   2. Downsample to ~5000 Hz with proper anti-aliasing (scipy resample_poly)
-  3. Convert to 4-bit unsigned (0-15) with rounding
-  4. Trim trailing silence
-  5. Pad to even sample count (2 samples per byte)
-  6. Pack as nibble pairs: high nibble = even sample, low nibble = odd sample
-  7. Save downsampled WAV to doom_sfx_downsampled/ for auditing
-  8. Output C arrays in src/vbdoom/assets/audio/doom_sfx.c and doom_sfx.h
+  3. Find the length: 4-bit (0-15) with rounding, trailing silence trimmed
+  4. ADPCM-encode the 8-bit samples up to that length, at the first
+     depth that reaches SNR_FLOOR_DB
+  5. Save the decoded WAV to doom_sfx_downsampled/ for auditing
+  6. Output C arrays in src/vbdoom/assets/audio/doom_sfx.c and doom_sfx.h
 """
 
 import os
 import wave
 import struct
+import itertools
+import math
+import statistics
 from math import gcd
 
 import numpy as np
@@ -37,6 +71,16 @@ TARGET_RATE = 5000       # 5 kHz: correct pitch on real hardware (timer often ~5
 SILENCE_THRESHOLD = 1    # 4-bit values 7-8 are center; threshold from center
 CENTER_4BIT = 8          # center of 4-bit range (0-15)
 
+# ADPCM step sizes (8-bit units). Written into doom_sfx.h as
+# SFX_ADPCM_STEP_TABLE so the ISR decoder always matches.
+ADPCM_STEPS = [6, 8, 11, 16, 22, 32, 45, 64, 90]
+ADPCM3_STEPS = [8, 10, 13, 16, 20, 25, 32, 40, 50, 64, 80, 100, 128]
+ADPCM_LOOKAHEAD = 3      # samples searched per code (4^n, 8^n candidates)
+
+# Least SNR against 4-bit PCM a sound may ship with. 2-bit ADPCM leaves
+# voices, pain and the short drum hits near 5-7 dB; they move up a depth.
+SNR_FLOOR_DB = 10.0
+
 # Sound definitions: (filename, C identifier suffix)
 PLAYER_SOUNDS = [
     ("punch.wav",         "punch"),
@@ -180,23 +224,116 @@ def trim_trailing_silence(samples_4bit):
     return samples_4bit[:end]
 
 
-def pad_to_even(samples):
-    """Pad to even count (2 samples per packed byte)."""
-    if len(samples) & 1:
-        samples = samples + [CENTER_4BIT]  # pad with silence (center)
-    return samples
+def adpcm_decode_step(pred, index, code, bits=2):
+    """One ADPCM decoder step. Returns the new (pred, index)."""
+    if bits == 3:
+        step = ADPCM3_STEPS[index]
+        mag = code & 3
+        diff = (step >> 2) + ((step >> 1) if mag & 1 else 0) + (step if mag & 2 else 0)
+        pred = pred - diff if code & 4 else pred + diff
+        index = index - 1 if mag < 2 else index + mag - 1
+        index = max(0, min(len(ADPCM3_STEPS) - 1, index))
+        return max(0, min(255, pred)), index
+    step = ADPCM_STEPS[index]
+    diff = (step >> 1) + (step if code & 1 else 0)
+    pred = pred - diff if code & 2 else pred + diff
+    pred = max(0, min(255, pred))
+    index = min(len(ADPCM_STEPS) - 1, index + 1) if code & 1 else max(0, index - 1)
+    return pred, index
+
+
+def adpcm_encode(samples_8bit, bits=2):
+    """Encode 8-bit unsigned samples to bits-bit ADPCM codes.
+    Each code is the first of the code sequence over the next
+    ADPCM_LOOKAHEAD samples with the least squared error."""
+    pred, index = 128, 0
+    codes = []
+    n = len(samples_8bit)
+    for i in range(n):
+        depth = min(ADPCM_LOOKAHEAD, n - i)
+        best_err, best_code = None, 0
+        for seq in itertools.product(range(1 << bits), repeat=depth):
+            p, x, err = pred, index, 0
+            for k, c in enumerate(seq):
+                p, x = adpcm_decode_step(p, x, c, bits)
+                err += (p - samples_8bit[i + k]) ** 2
+                if best_err is not None and err >= best_err:
+                    break
+            else:
+                best_err, best_code = err, seq[0]
+        pred, index = adpcm_decode_step(pred, index, best_code, bits)
+        codes.append(best_code)
+    return codes
+
+
+def adpcm_decode(codes, bits=2):
+    """Decode ADPCM codes to the 4-bit samples the ISR outputs."""
+    pred, index = 128, 0
+    out = []
+    for c in codes:
+        pred, index = adpcm_decode_step(pred, index, c, bits)
+        out.append(pred >> 4)
+    return out
+
+
+def pack_codes(codes, bits=2):
+    """Pack 2-bit codes four per byte, first code in the top bits; 3-bit
+    codes as a bit stream, top bits first, and a zero byte after it."""
+    packed = []
+    if bits == 3:
+        acc, nbits = 0, 0
+        for c in codes:
+            acc = (acc << 3) | c
+            nbits += 3
+            while nbits >= 8:
+                nbits -= 8
+                packed.append((acc >> nbits) & 0xFF)
+        if nbits:
+            packed.append((acc << (8 - nbits)) & 0xFF)
+        packed.append(0)
+        return packed
+    for i in range(0, len(codes), 4):
+        b = 0
+        for k in range(4):
+            c = codes[i + k] if i + k < len(codes) else 0
+            b |= c << (6 - 2 * k)
+        packed.append(b)
+    return packed
 
 
 def pack_nibbles(samples_4bit):
-    """Pack pairs of 4-bit samples into bytes (high nibble first)."""
+    """Pack 4-bit samples two per byte, first sample in the top nibble."""
     packed = []
     for i in range(0, len(samples_4bit), 2):
-        hi = samples_4bit[i] & 0x0F
-        lo = samples_4bit[i + 1] & 0x0F
-        packed.append((hi << 4) | lo)
+        lo = samples_4bit[i + 1] if i + 1 < len(samples_4bit) else 0
+        packed.append((samples_4bit[i] << 4) | lo)
     return packed
 
 
+def encode_sound(samples_8bit, reference_4bit):
+    """Encode at the first depth whose SNR reaches SNR_FLOOR_DB: 2- or
+    3-bit ADPCM, else the 4-bit reference itself.
+    Returns (bits, packed, decoded, snr)."""
+    for bits in (2, 3):
+        codes = adpcm_encode(samples_8bit, bits)
+        decoded = adpcm_decode(codes, bits)
+        snr = snr_db(reference_4bit, decoded)
+        if snr >= SNR_FLOOR_DB:
+            return bits, pack_codes(codes, bits), decoded, snr
+    return 4, pack_nibbles(reference_4bit), list(reference_4bit), snr_db(reference_4bit, reference_4bit)
+
+
+def snr_db(reference_4bit, decoded_4bit):
+    """SNR of decoded against the reference, both 4-bit (centre 8), in dB"""
+    signal = sum((r - CENTER_4BIT) ** 2 for r in reference_4bit)
+    noise = sum((r - d) ** 2 for r, d in zip(reference_4bit, decoded_4bit))
+    if noise == 0:
+        return 99.0
+    if signal == 0:
+        return 0.0
+    return 10 * math.log10(signal / noise)
+
+
 def save_converted_wav(filepath, rate, samples_4bit):
     """Save 4-bit samples back as 8-bit WAV for auditing."""
     with wave.open(filepath, 'w') as w:
@@ -208,7 +345,7 @@ def save_converted_wav(filepath, rate, samples_4bit):
 
 
 def generate_c_array(name, packed_bytes):
-    """Generate a C const u8 array string from packed nibble data."""
+    """Generate a C const u8 array string from packed ADPCM data."""
     lines = []
     lines.append(f"const u8 sfx_{name}[] __attribute__((aligned(4))) = {{")
     for i in range(0, len(packed_bytes), 16):
@@ -220,53 +357,11 @@ def generate_c_array(name, packed_bytes):
     return "\n".join(lines)
 
 
-def main():
-    os.makedirs(SFX_OUTPUT_DIR, exist_ok=True)
+def write_c_files(sound_data):
+    """Write doom_sfx.c and doom_sfx.h.
+    sound_data: list of (name, packed_bytes, num_samples, bits, snr)."""
     os.makedirs(C_OUTPUT_DIR, exist_ok=True)
 
-    sound_data = []  # (name, packed_bytes, num_samples, duration)
-
-    print("=== Doom SFX Converter for Virtual Boy (4-bit SxLRV method) ===\n")
-
-    for filename, cname in ALL_SOUNDS:
-        filepath = os.path.join(SFX_INPUT_DIR, filename)
-        if not os.path.exists(filepath):
-            print(f"WARNING: {filename} not found, skipping")
-            continue
-
-        rate, raw_samples = read_wav(filepath)
-        original_len = len(raw_samples)
-
-        # Downsample to target rate
-        downsampled = downsample(raw_samples, rate, TARGET_RATE)
-
-        # Convert to 4-bit
-        samples_4bit = to_4bit(downsampled)
-
-        # Trim trailing silence
-        trimmed = trim_trailing_silence(samples_4bit)
-
-        # Pad to even
-        padded = pad_to_even(trimmed)
-
-        num_samples = len(padded)
-        packed = pack_nibbles(padded)
-        duration = num_samples / TARGET_RATE
-
-        print(f"{filename}:")
-        print(f"  Original: {original_len} samples @ {rate}Hz ({original_len/rate:.2f}s)")
-        print(f"  Downsampled: {len(downsampled)} samples @ {TARGET_RATE}Hz")
-        print(f"  Trimmed+padded: {num_samples} samples ({duration:.2f}s)")
-        print(f"  Packed: {len(packed)} bytes")
-        print()
-
-        # Save converted WAV for auditing
-        out_wav = os.path.join(SFX_OUTPUT_DIR, filename)
-        save_converted_wav(out_wav, TARGET_RATE, padded)
-
-        sound_data.append((cname, packed, num_samples, duration))
-
-    # Generate C source file
     total_bytes = 0
     c_lines = []
     c_lines.append("/*")
@@ -274,14 +369,22 @@ def main():
     c_lines.append(" *")
     c_lines.append(" * Auto-generated by prepare_doom_sfx.py. Do not edit.")
     c_lines.append(" *")
-    c_lines.append(" * Each array contains packed 4-bit unsigned samples (0-15)")
-    c_lines.append(" * in nibble pairs (high nibble first) for SxLRV volume playback.")
+    c_lines.append(" * Each array contains 2-bit ADPCM codes, four per byte (first")
+    c_lines.append(" * sample in the top bits), 3-bit codes as a bit stream or 4-bit")
+    c_lines.append(" * samples two per byte, decoded to 4-bit samples (0-15) by the timer")
+    c_lines.append(" * ISR for SxLRV volume playback. The SNR is against plain 4-bit PCM")
+    c_lines.append(f" * of the same source, none below {SNR_FLOOR_DB:.0f} dB.")
+    c_lines.append(" * See prepare_doom_sfx.py.")
     c_lines.append(" */")
     c_lines.append("")
     c_lines.append('#include "doom_sfx.h"')
     c_lines.append("")
 
-    for cname, packed, num_samples, duration in sound_data:
+    for cname, packed, num_samples, bits, snr in sound_data:
+        if bits == 4:
+            c_lines.append("/* 4-bit PCM, exact */")
+        else:
+            c_lines.append(f"/* {bits}-bit ADPCM, SNR {snr:.1f} dB */")
         c_lines.append(generate_c_array(cname, packed))
         c_lines.append("")
         total_bytes += len(packed)
@@ -289,8 +392,8 @@ def main():
     # Generate sound table
     c_lines.append("/* Sound lookup table */")
     c_lines.append("const SFXEntry sfx_table[] = {")
-    for cname, packed, num_samples, duration in sound_data:
-        c_lines.append(f"\t{{ sfx_{cname}, {num_samples} }},  /* SFX_{cname.upper()} */")
+    for cname, packed, num_samples, bits, snr in sound_data:
+        c_lines.append(f"\t{{ sfx_{cname}, {num_samples}, {bits} }},  /* SFX_{cname.upper()} */")
     c_lines.append("};")
     c_lines.append("")
 
@@ -308,15 +411,22 @@ def main():
     h_lines.append("")
     h_lines.append("/* Sound effect IDs */")
     h_lines.append("enum {")
-    for i, (cname, packed, num_samples, duration) in enumerate(sound_data):
+    for i, (cname, packed, num_samples, bits, snr) in enumerate(sound_data):
         h_lines.append(f"\tSFX_{cname.upper()} = {i},")
     h_lines.append(f"\tSFX_COUNT = {len(sound_data)}")
     h_lines.append("};")
     h_lines.append("")
-    h_lines.append("/* Sound entry: pointer to packed 4-bit data + sample count */")
+    h_lines.append("/* ADPCM decoder step sizes, must match the encoder */")
+    h_lines.append(f"#define SFX_ADPCM_STEPS {len(ADPCM_STEPS)}")
+    h_lines.append("#define SFX_ADPCM_STEP_TABLE { " + ", ".join(str(v) for v in ADPCM_STEPS) + " }")
+    h_lines.append(f"#define SFX_ADPCM3_STEPS {len(ADPCM3_STEPS)}")
+    h_lines.append("#define SFX_ADPCM3_STEP_TABLE { " + ", ".join(str(v) for v in ADPCM3_STEPS) + " }")
+    h_lines.append("")
+    h_lines.append("/* Sound entry: pointer to sample data + sample count + code size */")
     h_lines.append("typedef struct {")
-    h_lines.append("\tconst u8 *data;    /* packed nibble pairs */")
+    h_lines.append("\tconst u8 *data;    /* 2-bit codes, a 3-bit stream or 4-bit nibbles */")
     h_lines.append("\tu16 length;        /* total samples (not bytes) */")
+    h_lines.append("\tu8 bits;           /* 2 or 3 (ADPCM), 4 (PCM) */")
     h_lines.append("} SFXEntry;")
     h_lines.append("")
     h_lines.append("/* Lookup table */")
@@ -325,7 +435,7 @@ def main():
 
     # Extern declarations for individual arrays
     h_lines.append("/* Individual sample arrays */")
-    for cname, packed, num_samples, duration in sound_data:
+    for cname, packed, num_samples, bits, snr in sound_data:
         h_lines.append(f"extern const u8 sfx_{cname}[];")
     h_lines.append("")
     h_lines.append("#endif")
@@ -336,7 +446,56 @@ def main():
         f.write("\n".join(h_lines))
     print(f"Written: {h_path}")
 
-    print(f"\nTotal packed data: {total_bytes} bytes ({total_bytes/1024:.1f} KB)")
+    return total_bytes
+
+
+def main():
+    os.makedirs(SFX_OUTPUT_DIR, exist_ok=True)
+
+    sound_data = []  # (name, packed_bytes, num_samples, bits, snr)
+
+    print("=== Doom SFX Converter for Virtual Boy (2/3-bit ADPCM, 4-bit PCM, SxLRV method) ===\n")
+
+    for filename, cname in ALL_SOUNDS:
+        filepath = os.path.join(SFX_INPUT_DIR, filename)
+        if not os.path.exists(filepath):
+            print(f"WARNING: {filename} not found, skipping")
+            continue
+
+        rate, raw_samples = read_wav(filepath)
+        original_len = len(raw_samples)
+
+        # Downsample to target rate
+        downsampled = downsample(raw_samples, rate, TARGET_RATE)
+
+        # Length from the 4-bit signal, trailing silence trimmed
+        reference = trim_trailing_silence(to_4bit(downsampled))
+        num_samples = len(reference)
+
+        # Encode the 8-bit samples at the first depth above the floor
+        bits, packed, decoded, snr = encode_sound(downsampled[:num_samples], reference)
+        duration = num_samples / TARGET_RATE
+
+        print(f"{filename}:")
+        print(f"  Original: {original_len} samples @ {rate}Hz ({original_len/rate:.2f}s)")
+        print(f"  Downsampled: {len(downsampled)} samples @ {TARGET_RATE}Hz")
+        print(f"  Trimmed: {num_samples} samples ({duration:.2f}s)")
+        print(f"  Encoded: {len(packed)} bytes, {bits}-bit, SNR {snr:.1f} dB")
+        print()
+
+        # Save decoded WAV for auditing
+        out_wav = os.path.join(SFX_OUTPUT_DIR, filename)
+        save_converted_wav(out_wav, TARGET_RATE, decoded)
+
+        sound_data.append((cname, packed, num_samples, bits, snr))
+
+    total_bytes = write_c_files(sound_data)
+
+    print(f"\nTotal sample data: {total_bytes} bytes ({total_bytes/1024:.1f} KB)")
+    if sound_data:
+        snrs = sorted((snr, cname) for cname, _, _, _, snr in sound_data)
+        print(f"SNR against 4-bit PCM: median {statistics.median(v for v, _ in snrs):.1f} dB, "
+              f"worst " + ", ".join(f"{n} {v:.1f}" for v, n in snrs[:4]) + " dB")
     print(f"Sounds converted: {len(sound_data)}/{len(ALL_SOUNDS)}")
 
 
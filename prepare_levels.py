@@ -0,0 +1,379 @@
+"""
+prepare_levels.py
+
+Level compiler: the web editor's level JSON (levels/<id>.json, "Save
+JSON" in web-editor/index.html) to the packed level blobs the game loads
+with loadLevelBlob() (src/vbdoom/functions/level.c).
+
+Each level is checked against the game's limits, read from the headers
+so they can't drift: map size (RayCaster.h), enemies and their types
+(enemy.h), pickups and their types (pickup.h), doors and switches
+(door.h), spawns and secrets (level.h). Things standing in walls or off
+the map and switches linked to missing doors are errors too. All
+problems of a level are listed and nothing is written for it.
+
+The compiler also bakes the level's sight table, so enemies skip the
+Bresenham line-of-sight walk between parts of the map that can never
+see each other (see below).
+
+Blob layout (bytes, no padding, u16 little-endian; level.h has the same
+table):
+  header    'V' 'B' 'L' version, width, height,
+            spawns, enemies, pickups, switches, secrets (counts),
+            sight shift
+  spawns    tx, ty, angle u16         0 = player 1, 1 = player 2
+  enemies   type, tx, ty, angle u16
+  pickups   type, tx, ty
+  switches  type, door                every switch tile (5), row by row
+  secrets   tx, ty
+  sight     block visibility bits, one row of bytes per block
+  map       packed width*height tiles, row by row, to the end
+
+Map code, one token at a time:
+  0nnnnnnn t      tile t, n+1 times
+  10nnnnnn        n+1 tiles copied from the row above
+  11nnnnnn t...   n+1 tiles as they are
+
+Doors are the door tiles (4, 6-11) and switches the switch tiles, both
+numbered row by row as the editor lists them; a switch's door is that
+number. The editor's "Export C" writes the same header from the same
+JSON, byte for byte.
+
+Sight table: the map is cut into square blocks of 1 << shift tiles, the
+smallest shift (at least 2) that gives at most SIGHT_BLOCKS blocks. Bit
+b of block a's row (byte b >> 3, bit b & 7) is set if some tile of a
+sees some tile of b by hasLineOfSight()'s tile walk (RayCasterFixed.c),
+in either direction, with every door open. The tiles are the open ones
+(empty or door) and the player and enemy starts, which may be stuck in
+a wall: everywhere a line of sight can start or end. Walls other than
+doors never change during a level, so a clear bit means no line of
+sight between the blocks, ever.
+
+Output: src/vbdoom/assets/doom/<id>_level.h, const u8 <id>_level[]
+
+    python prepare_levels.py            every levels/*.json
+    python prepare_levels.py e1m4 ...   only these
+    python prepare_levels.py --check    verify only, exit 1 if a level
+                                        breaks a limit or a header is stale
+"""
+
+import glob
+import json
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+LEVEL_DIR = os.path.join(SCRIPT_DIR, "levels")
+OUTPUT_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "assets", "doom")
+FUNCTIONS_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "functions")
+
+BLOB_VERSION = 3
+
+MAP_MAX = 64                     # MAP_X, MAP_Y in RayCaster.h
+SIGHT_BLOCKS = 64                # at most; a table of 64 rows of 8 bytes
+DOOR_TILES = (4, 6, 7, 8, 9, 10, 11)
+SWITCH_TILE = 5
+SW_DOOR = 0                      # door.h
+SW_EXIT = 1
+
+
+def u16(v):
+    v &= 0xFFFF
+    return [v & 0xFF, v >> 8]
+
+
+def pack_map(tiles, w):
+    """Map code tokens as (first tile index, bytes). Greedy: a copy from the
+    row above when it covers at least as much as a run, a run of three or
+    more, else literals."""
+    n = len(tiles)
+    tokens = []
+    lit_start = 0
+    lit = []
+
+    def flush():
+        for k in range(0, len(lit), 64):
+            chunk = lit[k:k + 64]
+            tokens.append((lit_start + k, [0xC0 | (len(chunk) - 1)] + chunk))
+        del lit[:]
+
+    i = 0
+    while i < n:
+        up = 0
+        if i >= w:
+            while i + up < n and up < 64 and tiles[i + up] == tiles[i + up - w]:
+                up += 1
+        run = 1
+        while i + run < n and run < 128 and tiles[i + run] == tiles[i]:
+            run += 1
+        if up and up >= run:
+            flush()
+            tokens.append((i, [0x80 | (up - 1)]))
+            i += up
+        elif run >= 3:
+            flush()
+            tokens.append((i, [run - 1, tiles[i]]))
+            i += run
+        else:
+            if not lit:
+                lit_start = i
+            lit.append(tiles[i])
+            i += 1
+    flush()
+    return tokens
+
+
+def sight_los(tiles, w, x0, y0, x1, y1):
+    """hasLineOfSight() (RayCasterFixed.c) from tile to tile, every door open."""
+    dx, dy = abs(x1 - x0), abs(y1 - y0)
+    sx = 1 if x1 > x0 else -1
+    sy = 1 if y1 > y0 else -1
+    err = dx - dy
+    while x0 != x1 or y0 != y1:
+        e2 = err * 2
+        step_x, step_y = e2 > -dy, e2 < dx
+        if step_x:
+            err -= dy
+            x0 += sx
+        if step_y:
+            err += dx
+            y0 += sy
+        if x0 == x1 and y0 == y1:
+            break
+        if step_x and step_y:
+            if not open_tile(tiles[(y0 - sy) * w + x0]) or not open_tile(tiles[y0 * w + x0 - sx]):
+                return False
+        if not open_tile(tiles[y0 * w + x0]):
+            return False
+    return True
+
+
+def open_tile(t):
+    return t == 0 or t in DOOR_TILES
+
+
+def sight_table(tiles, w, h, starts):
+    """(shift, rows of bytes): the level's block visibility, see above;
+    starts are the (x, y) of the player and enemy starts."""
+    shift = 2
+    while ((w + (1 << shift) - 1) >> shift) * ((h + (1 << shift) - 1) >> shift) > SIGHT_BLOCKS:
+        shift += 1
+    bw = (w + (1 << shift) - 1) >> shift
+    n = bw * ((h + (1 << shift) - 1) >> shift)
+    if n > SIGHT_BLOCKS or (n + 7) >> 3 > 255:  # level.c keeps the row stride in a u8
+        raise ValueError("sight table: %d blocks, at most %d" % (n, SIGHT_BLOCKS))
+    cells = [[] for _ in range(n)]
+    ends = set((i % w, i // w) for i, t in enumerate(tiles) if open_tile(t))
+    ends |= set((x, y) for x, y in starts if 0 <= x < w and 0 <= y < h)
+    for x, y in ends:
+        cells[(y >> shift) * bw + (x >> shift)].append((x, y))
+    rows = [[0] * ((n + 7) >> 3) for _ in range(n)]
+    for a in range(n):
+        for b in range(a, n):
+            if any(sight_los(tiles, w, x0, y0, x1, y1) or sight_los(tiles, w, x1, y1, x0, y0)
+                   for x0, y0 in cells[a] for x1, y1 in cells[b]):
+                rows[a][b >> 3] |= 1 << (b & 7)
+                rows[b][a >> 3] |= 1 << (a & 7)
+    return shift, rows
+
+
+def level_sections(level):
+    """The blob as (label, rows of bytes) sections, in file order."""
+    w, h = level["mapW"], level["mapH"]
+    tiles = level["map"]
+    if not (0 < w <= MAP_MAX and 0 < h <= MAP_MAX) or len(tiles) != w * h:
+        raise ValueError("bad map size %sx%s (%d tiles)" % (w, h, len(tiles)))
+
+    spawns = [s for s in (level.get("spawn1"), level.get("spawn2")) if s]
+    if not spawns or not level.get("spawn1"):
+        raise ValueError("no Spawn 1 (player start)")
+    if any(not 0 <= t <= 255 for t in tiles):
+        raise ValueError("map: tile out of range")
+    switches = [i for i, t in enumerate(tiles) if t == SWITCH_TILE]
+    links = level.get("switchLinks") or []
+    enemies = level.get("enemies") or []
+    pickups = level.get("pickups") or []
+    secrets = level.get("secrets") or []
+
+    sections = [("Header", [[ord("V"), ord("B"), ord("L"), BLOB_VERSION, w, h,
+                             len(spawns), len(enemies), len(pickups),
+                             len(switches), len(secrets), 0]])]
+    sections.append(("Spawns", [[s["x"], s["y"]] + u16(s.get("angle", 512)) for s in spawns]))
+    sections.append(("Enemies", [[e["type"], e["tileX"], e["tileY"]] + u16(e.get("angle", 0))
+                                 for e in enemies]))
+    sections.append(("Pickups", [[p["type"], p["tileX"], p["tileY"]] for p in pickups]))
+    rows = []
+    for i in range(len(switches)):
+        link = links[i] if i < len(links) else 0
+        rows.append([SW_EXIT, 0] if link == -1 else [SW_DOOR, link])
+    sections.append(("Switches", rows))
+    sections.append(("Secrets", [[s["tileX"], s["tileY"]] for s in secrets]))
+    shift, rows = sight_table(tiles, w, h, [(s["x"], s["y"]) for s in spawns] +
+                              [(e["tileX"], e["tileY"]) for e in enemies])
+    sections[0][1][0][11] = shift
+    sections += [("Sight %d" % a, [row]) for a, row in enumerate(rows)]
+    tokens = pack_map(tiles, w)
+    for y in range(h):
+        sections.append(("Map row %d" % y, [b for i, b in tokens if i // w == y]))
+
+    for label, rows in sections:
+        for row in rows:
+            if any(not 0 <= b <= 255 for b in row):
+                raise ValueError("%s: value out of range in %s" % (label, row))
+    return sections
+
+
+def header_defines(name):
+    """Plain integer #defines of functions/<name>, in file order."""
+    with open(os.path.join(FUNCTIONS_DIR, name)) as f:
+        return [(m.group(1), int(m.group(2))) for m in
+                re.finditer(r"^\s*#define\s+(\w+)\s+(?:\(u8\))?(\d+)\b", f.read(), re.M)]
+
+
+def read_limits():
+    """The game's limits. A kind of thing's types are its first PREFIX_ defines, numbered 0, 1, 2..."""
+    defs = {}
+    types = {}
+    for name, prefix in (("RayCaster.h", None), ("enemy.h", "ETYPE_"), ("pickup.h", "PICKUP_"),
+                         ("door.h", None), ("level.h", None)):
+        n = 0
+        counting = True
+        for key, value in header_defines(name):
+            defs[key] = value
+            if prefix and counting and key.startswith(prefix):
+                if value == n:
+                    n += 1
+                else:
+                    counting = False
+        if prefix:
+            types[prefix] = n
+    limits = {key: defs[key] for key in ("MAP_X", "MAP_Y", "MAX_ENEMIES", "MAX_PICKUPS",
+                                         "MAX_DOORS", "MAX_SWITCHES", "MAX_LEVEL_SPAWNS",
+                                         "MAX_SECRETS")}
+    limits["ENEMY_TYPES"] = types["ETYPE_"]
+    limits["PICKUP_TYPES"] = types["PICKUP_"]
+    return limits
+
+
+def check_level(level, limits):
+    """(errors, warnings): every way the level breaks the game's limits, and
+    things that will not work well in the game (stuck in a wall or door)."""
+    w, h = level["mapW"], level["mapH"]
+    tiles = level["map"]
+    if not (0 < w <= limits["MAP_X"] and 0 < h <= limits["MAP_Y"]) or len(tiles) != w * h:
+        return ["map is %sx%s (%d tiles), at most %dx%d" % (w, h, len(tiles), limits["MAP_X"],
+                                                            limits["MAP_Y"])], []
+    errors = []
+    warnings = []
+
+    def over(what, count, limit, where):
+        if count > limit:
+            errors.append("%d %s, at most %d (%s)" % (count, what, limit, where))
+
+    def place(what, x, y):
+        if not (0 <= x < w and 0 <= y < h):
+            errors.append("%s at (%d,%d) is off the map" % (what, x, y))
+        elif tiles[y * w + x] != 0:
+            tile = tiles[y * w + x]
+            warnings.append("%s at (%d,%d) is in a %s (tile %d)"
+                            % (what, x, y, "door" if tile in DOOR_TILES else "wall", tile))
+
+    spawns = [(n, level.get(n)) for n in ("spawn1", "spawn2") if level.get(n)]
+    if not level.get("spawn1"):
+        errors.append("no Spawn 1 (player start)")
+    over("spawns", len(spawns), limits["MAX_LEVEL_SPAWNS"], "MAX_LEVEL_SPAWNS, level.h")
+    for name, s in spawns:
+        place(name, s["x"], s["y"])
+
+    enemies = level.get("enemies") or []
+    over("enemies", len(enemies), limits["MAX_ENEMIES"], "MAX_ENEMIES, enemy.h")
+    for i, e in enumerate(enemies):
+        if not 0 <= e["type"] < limits["ENEMY_TYPES"]:
+            errors.append("enemy %d has unknown type %d (ETYPE_*, enemy.h)" % (i, e["type"]))
+        place("enemy %d" % i, e["tileX"], e["tileY"])
+
+    pickups = level.get("pickups") or []
+    over("pickups", len(pickups), limits["MAX_PICKUPS"], "MAX_PICKUPS, pickup.h")
+    for i, p in enumerate(pickups):
+        if not 0 <= p["type"] < limits["PICKUP_TYPES"]:
+            errors.append("pickup %d has unknown type %d (PICKUP_*, pickup.h)" % (i, p["type"]))
+        place("pickup %d" % i, p["tileX"], p["tileY"])
+
+    doors = sum(1 for t in tiles if t in DOOR_TILES)
+    switches = sum(1 for t in tiles if t == SWITCH_TILE)
+    over("doors", doors, limits["MAX_DOORS"], "MAX_DOORS, door.h")
+    over("switches", switches, limits["MAX_SWITCHES"], "MAX_SWITCHES, door.h")
+    for i, link in enumerate((level.get("switchLinks") or [])[:switches]):
+        if link != -1 and not 0 <= link < doors:
+            errors.append("switch %d opens door %d, the level has %d" % (i, link, doors))
+
+    secrets = level.get("secrets") or []
+    over("secrets", len(secrets), limits["MAX_SECRETS"], "MAX_SECRETS, level.h")
+    for i, s in enumerate(secrets):
+        place("secret %d" % i, s["tileX"], s["tileY"])
+    return errors, warnings
+
+
+def level_header(level_id, level):
+    """C header text for one level; web-editor/editor.js buildLevelHeader() is the same."""
+    sections = level_sections(level)
+    size = sum(len(row) for _, rows in sections for row in rows)
+    out = "/* %s_level.h -- level %s, see functions/level.h for the format.\n" % (level_id, level_id)
+    out += " * Generated from levels/%s.json; edit that and run prepare_levels.py. */\n" % level_id
+    notes = level.get("notes") or []
+    if notes:
+        out += "/*\n"
+        for line in notes:
+            out += (" * " + line.replace("*/", "* /")).rstrip() + "\n"
+        out += " */\n"
+    out += "const u8 %s_level[%d] = {\n" % (level_id, size)
+    for label, rows in sections:
+        if rows:
+            out += "/* %s */ %s,\n" % (label, ", ".join(",".join(str(b) for b in row) for row in rows))
+    out += "};\n"
+    return out
+
+
+def main():
+    args = sys.argv[1:]
+    check = "--check" in args
+    ids = [a for a in args if a != "--check"] or sorted(
+        os.path.splitext(os.path.basename(p))[0]
+        for p in glob.glob(os.path.join(LEVEL_DIR, "*.json")))
+    limits = read_limits()
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+    failed = 0
+    for level_id in ids:
+        with open(os.path.join(LEVEL_DIR, level_id + ".json")) as f:
+            level = json.load(f)
+        errors, warnings = check_level(level, limits)
+        for warning in warnings:
+            print("%s: warning: %s" % (level_id, warning), file=sys.stderr)
+        if not errors:
+            try:
+                text = level_header(level_id, level)
+            except ValueError as err:
+                errors = [str(err)]
+        if errors:
+            for err in errors:
+                print("%s: %s" % (level_id, err), file=sys.stderr)
+            failed += 1
+            continue
+        path = os.path.join(OUTPUT_DIR, level_id + "_level.h")
+        if check:
+            current = open(path).read() if os.path.exists(path) else None
+            if current != text:
+                print("%s is stale, run prepare_levels.py %s" % (path, level_id), file=sys.stderr)
+                failed += 1
+            continue
+        with open(path, "w", newline="\n") as f:
+            f.write(text)
+        print("Wrote %s" % path)
+    if check and not failed:
+        print("%d levels up to date" % len(ids))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
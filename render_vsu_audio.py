@@ -0,0 +1,139 @@
+"""
+render_vsu_audio.py
+
+Render every song and sound effect through the game's own sequencer and
+PCM mixer on the host: builds tools/vsu_render (sndplay.c, timer.c and
+doom_sfx.c linked against an emulated VSU and timer, see vsu_render.c),
+runs it once per song and SFX and writes the WAVs to vsu_render_out/.
+Each run prints its ISR work (calls, voices and notes per call, music
+jitter), an ISR cycle estimate and the digest of its samples. The cycle
+figures are computed from the call counts with the per-call costs quoted
+in timer.c's header; they are not measured and are no evidence for those
+costs (use the profiler overlay on hardware for that).
+
+The output does not depend on the host, so the report doubles as a
+regression check for the sequencer, the mixer and the audio data:
+
+    python render_vsu_audio.py             render, print the report
+    python render_vsu_audio.py --check     also compare the report with
+                                           tools/vsu_render/reference.txt,
+                                           exit 1 on any difference
+    python render_vsu_audio.py --update    rewrite the reference
+    python render_vsu_audio.py --ticks     also write a CSV per render, one
+                                           row per ISR call
+
+Songs run for one loop (MUSIC_*_LENGTH_MS). Needs a C compiler on the
+PATH (cc, or $CC).
+"""
+
+import os
+import re
+import subprocess
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TOOL_DIR = os.path.join(SCRIPT_DIR, "tools", "vsu_render")
+LIB_DIR = os.path.join(SCRIPT_DIR, "libs", "libgccvb")
+FUNCTIONS_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "functions")
+AUDIO_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "assets", "audio")
+OUT_DIR = os.path.join(SCRIPT_DIR, "vsu_render_out")
+BUILD_DIR = os.path.join(OUT_DIR, "build")
+REFERENCE = os.path.join(TOOL_DIR, "reference.txt")
+
+GAME_SOURCES = [
+    os.path.join(FUNCTIONS_DIR, "sndplay.c"),
+    os.path.join(FUNCTIONS_DIR, "timer.c"),
+    os.path.join(AUDIO_DIR, "doom_sfx.c"),
+]
+
+# libgccvb after the system headers (it has its own stdarg.h); V810 is
+# ILP32: long is 32 bits there (vsu_render/libgccvb.h)
+CFLAGS = ["-std=gnu99", "-O2", "-Wall", "-Wno-pointer-to-int-cast",
+          "-DMUSIC_JITTER", "-I", TOOL_DIR, "-idirafter", LIB_DIR]
+GAME_CFLAGS = ["-Dlong=int", "-include", os.path.join(TOOL_DIR, "libgccvb.h")]
+
+
+def read_file(path):
+    with open(path) as f:
+        return f.read()
+
+
+def songs():
+    """(name, id, ticks) of every SONG_* in sndplay.h, one loop long."""
+    ticks_per_ms = int(re.search(r"#define\s+MUS_TICKS_PER_MS\s+(\d+)",
+                                 read_file(os.path.join(FUNCTIONS_DIR, "sndplay.c"))).group(1))
+    out = []
+    for m in re.finditer(r"#define\s+SONG_(\w+)\s+(\d+)",
+                         read_file(os.path.join(FUNCTIONS_DIR, "sndplay.h"))):
+        name = m.group(1).lower()
+        header = read_file(os.path.join(AUDIO_DIR, "music_%s.h" % name))
+        ms = int(re.search(r"#define\s+MUSIC_\w+_LENGTH_MS\s+(\d+)", header).group(1))
+        out.append((name, int(m.group(2)), ms * ticks_per_ms))
+    return out
+
+
+def sfx():
+    """(name, id) of every SFX_* in doom_sfx.h."""
+    text = read_file(os.path.join(AUDIO_DIR, "doom_sfx.h"))
+    return [(m.group(1).lower(), int(m.group(2)))
+            for m in re.finditer(r"\bSFX_(\w+)\s*=\s*(\d+)", text)
+            if m.group(1) != "COUNT"]
+
+
+def build():
+    cc = os.environ.get("CC", "cc")
+    os.makedirs(BUILD_DIR, exist_ok=True)
+    objs = []
+    for src in GAME_SOURCES + [os.path.join(TOOL_DIR, "vsu_render.c")]:
+        obj = os.path.join(BUILD_DIR, os.path.splitext(os.path.basename(src))[0] + ".o")
+        flags = CFLAGS + (GAME_CFLAGS if src in GAME_SOURCES else [])
+        subprocess.run([cc] + flags + ["-c", src, "-o", obj], check=True)
+        objs.append(obj)
+    exe = os.path.join(BUILD_DIR, "vsu_render")
+    subprocess.run([cc] + objs + ["-o", exe], check=True)
+    return exe
+
+
+def main():
+    args = sys.argv[1:]
+    check = "--check" in args
+    update = "--update" in args
+    ticks = "--ticks" in args
+
+    exe = build()
+    jobs = [("song_" + name, ["song", str(i), str(t)]) for name, i, t in songs()]
+    jobs += [("sfx_" + name, ["sfx", str(i)]) for name, i in sfx()]
+
+    report = []
+    for name, job in jobs:
+        wav = os.path.join(OUT_DIR, name + ".wav")
+        cmd = [exe]
+        if ticks:
+            cmd += ["-t", os.path.join(OUT_DIR, name + ".csv")]
+        result = subprocess.run(cmd + job + [wav], capture_output=True, text=True)
+        if result.returncode:
+            print("render_vsu_audio: %s failed: %s" % (name, result.stderr.strip()),
+                  file=sys.stderr)
+            return 1
+        line = "%s: %s" % (name, result.stdout.strip())
+        print(line)
+        report.append(line)
+
+    if update:
+        with open(REFERENCE, "w", newline="\n") as f:
+            f.write("\n".join(report) + "\n")
+        print("Wrote %s" % REFERENCE)
+    elif check:
+        expected = read_file(REFERENCE).splitlines()
+        if report != expected:
+            for line in sorted(set(expected) - set(report)):
+                print("render_vsu_audio: expected " + line, file=sys.stderr)
+            for line in sorted(set(report) - set(expected)):
+                print("render_vsu_audio: got      " + line, file=sys.stderr)
+            return 1
+        print("Matches %s (%d renders)" % (REFERENCE, len(report)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,144 @@
+"""
+run_link_loop.py
+
+Run the link protocol on the host, two consoles in one process: builds
+tools/link_loop (two copies of link.c, lockstep.c, snapshot.c and
+menu_multiplayer.c, each with its own globals, against a model of the
+link cable, see link_loop.c) and runs every scenario in SCENARIOS: the
+menu handshake in each mode, the co-op state exchange and lockstep, each
+with and without a noisy cable. Each prints one line of figures:
+handshake time, per-frame latency, desyncs, time spent waiting.
+
+The model and the scripts are fixed, so the report does not depend on
+the host and doubles as a regression check for the link protocol:
+
+    python run_link_loop.py             run, print the report
+    python run_link_loop.py --check     also compare the report with
+                                        tools/link_loop/reference.txt,
+                                        exit 1 on any difference
+    python run_link_loop.py --update    rewrite the reference
+
+Needs a C compiler and binutils (objcopy, nm) on the PATH (cc, or $CC),
+and a libc with ucontext.
+"""
+
+import os
+import subprocess
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TOOL_DIR = os.path.join(SCRIPT_DIR, "tools", "link_loop")
+LIB_DIR = os.path.join(SCRIPT_DIR, "libs", "libgccvb")
+FUNCTIONS_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "functions")
+COMPONENTS_DIR = os.path.join(SCRIPT_DIR, "src", "vbdoom", "components")
+OUT_DIR = os.path.join(SCRIPT_DIR, "link_loop_out")
+BUILD_DIR = os.path.join(OUT_DIR, "build")
+REFERENCE = os.path.join(TOOL_DIR, "reference.txt")
+
+# One console: these, linked into one object, then copied with its
+# symbols prefixed for each console (a_, b_)
+INSTANCE_SOURCES = [
+    os.path.join(FUNCTIONS_DIR, "link.c"),
+    os.path.join(FUNCTIONS_DIR, "lockstep.c"),
+    os.path.join(FUNCTIONS_DIR, "snapshot.c"),
+    os.path.join(COMPONENTS_DIR, "menu_multiplayer.c"),
+    os.path.join(LIB_DIR, "math.c"),            # RECIP8LUT (snapshot.c)
+    os.path.join(TOOL_DIR, "instance.c"),
+]
+CONSOLES = ["a_", "b_"]
+
+# libgccvb after the system headers (it has its own stdarg.h)
+CFLAGS = ["-std=gnu99", "-O2", "-Wall", "-Wno-pointer-to-int-cast",
+          "-Wno-unused-function", "-Wno-unused-label", "-Wno-unused-variable",
+          "-I", TOOL_DIR, "-I", FUNCTIONS_DIR, "-idirafter", LIB_DIR]
+GAME_CFLAGS = ["-DFIXED_ONLY", "-include", os.path.join(TOOL_DIR, "libgccvb.h")]
+
+SCENARIOS = [
+    ("handshake_coop", ["handshake", "coop"]),
+    ("handshake_dm", ["handshake", "dm"]),
+    ("handshake_lockstep", ["handshake", "lockstep"]),
+    ("handshake_coop_w", ["-w", "handshake", "coop"]),
+    ("handshake_dm_w", ["-w", "handshake", "dm"]),
+    ("handshake_lockstep_w", ["-w", "handshake", "lockstep"]),
+    ("coop", ["coop", "2000"]),
+    ("coop_noise", ["coop", "2000", "20000"]),
+    ("lockstep", ["lockstep", "2000"]),
+    ("lockstep_desync", ["lockstep", "2000", "0", "1000"]),
+    ("lockstep_noise", ["lockstep", "2000", "20000"]),
+]
+
+
+def read_file(path):
+    with open(path) as f:
+        return f.read()
+
+
+def build():
+    cc = os.environ.get("CC", "cc")
+    os.makedirs(BUILD_DIR, exist_ok=True)
+    objs = []
+    for src in INSTANCE_SOURCES:
+        obj = os.path.join(BUILD_DIR, os.path.splitext(os.path.basename(src))[0] + ".o")
+        subprocess.run([cc] + CFLAGS + GAME_CFLAGS + ["-c", src, "-o", obj], check=True)
+        objs.append(obj)
+    console = os.path.join(BUILD_DIR, "console.o")
+    subprocess.run([cc, "-r", "-nostdlib", "-o", console] + objs, check=True)
+
+    # What the console takes from the C library keeps its name
+    undefined = subprocess.run(["nm", "-u", console], capture_output=True, text=True,
+                               check=True).stdout.split()
+    undefined = [s for s in undefined if s != "U"]
+    consoles = []
+    for prefix in CONSOLES:
+        obj = os.path.join(BUILD_DIR, "console_%s.o" % prefix.rstrip("_"))
+        subprocess.run(["objcopy", "--prefix-symbols=" + prefix, console, obj], check=True)
+        cmd = ["objcopy"]
+        for sym in undefined:
+            cmd += ["--redefine-sym", "%s%s=%s" % (prefix, sym, sym)]
+        subprocess.run(cmd + [obj], check=True)
+        consoles.append(obj)
+
+    main = os.path.join(BUILD_DIR, "link_loop.o")
+    subprocess.run([cc] + CFLAGS + ["-c", os.path.join(TOOL_DIR, "link_loop.c"), "-o", main],
+                   check=True)
+    exe = os.path.join(BUILD_DIR, "link_loop")
+    subprocess.run([cc, main] + consoles + ["-o", exe], check=True)
+    return exe
+
+
+def main():
+    args = sys.argv[1:]
+    check = "--check" in args
+    update = "--update" in args
+
+    exe = build()
+    report = []
+    failed = False
+    for name, job in SCENARIOS:
+        result = subprocess.run([exe] + job, capture_output=True, text=True)
+        if result.returncode:
+            print("run_link_loop: %s failed %s" % (name, result.stderr.strip()),
+                  file=sys.stderr)
+            failed = True
+        line = "%s: %s" % (name, result.stdout.strip())
+        print(line)
+        report.append(line)
+
+    if update:
+        with open(REFERENCE, "w", newline="\n") as f:
+            f.write("\n".join(report) + "\n")
+        print("Wrote %s" % REFERENCE)
+    elif check:
+        expected = read_file(REFERENCE).splitlines()
+        if report != expected:
+            for line in sorted(set(expected) - set(report)):
+                print("run_link_loop: expected " + line, file=sys.stderr)
+            for line in sorted(set(report) - set(expected)):
+                print("run_link_loop: got      " + line, file=sys.stderr)
+            return 1
+        print("Matches %s (%d scenarios)" % (REFERENCE, len(report)))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
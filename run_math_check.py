@@ -0,0 +1,82 @@
+"""
+run_math_check.py
+
+Check the integer helpers of libgccvb/math (RECIP8LUT, fix_atan2,
+fix_dist, fix_dist_oct) against double precision on the host: builds
+tools/math_check (libgccvb/math.c, FIXED_ONLY as in the game, see
+math_check.c) and runs it. It prints one line per helper and input
+range with the worst error found, which is what the bounds in math.h
+state.
+
+The inputs are fixed, so the report does not depend on the host and
+doubles as a regression check for math.c:
+
+    python run_math_check.py            run, print the report
+    python run_math_check.py --check    also compare the report with
+                                        tools/math_check/reference.txt,
+                                        exit 1 on any difference
+    python run_math_check.py --update   rewrite the reference
+
+Needs a C compiler on the PATH (cc, or $CC) and its libm.
+"""
+
+import os
+import subprocess
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TOOL_DIR = os.path.join(SCRIPT_DIR, "tools", "math_check")
+LIB_DIR = os.path.join(SCRIPT_DIR, "libs", "libgccvb")
+OUT_DIR = os.path.join(SCRIPT_DIR, "math_check_out")
+REFERENCE = os.path.join(TOOL_DIR, "reference.txt")
+
+SOURCES = [
+    os.path.join(LIB_DIR, "math.c"),
+    os.path.join(TOOL_DIR, "math_check.c"),
+]
+CFLAGS = ["-std=gnu99", "-O2", "-Wall", "-DFIXED_ONLY", "-I", TOOL_DIR,
+          "-include", os.path.join(TOOL_DIR, "libgccvb.h")]
+
+
+def read_file(path):
+    with open(path) as f:
+        return f.read()
+
+
+def build():
+    cc = os.environ.get("CC", "cc")
+    os.makedirs(OUT_DIR, exist_ok=True)
+    exe = os.path.join(OUT_DIR, "math_check")
+    subprocess.run([cc] + CFLAGS + SOURCES + ["-lm", "-o", exe], check=True)
+    return exe
+
+
+def main():
+    args = sys.argv[1:]
+    check = "--check" in args
+    update = "--update" in args
+
+    exe = build()
+    report = subprocess.run([exe], capture_output=True, text=True,
+                            check=True).stdout.splitlines()
+    for line in report:
+        print(line)
+
+    if update:
+        with open(REFERENCE, "w", newline="\n") as f:
+            f.write("\n".join(report) + "\n")
+        print("Wrote %s" % REFERENCE)
+    elif check:
+        expected = read_file(REFERENCE).splitlines()
+        if report != expected:
+            for line in sorted(set(expected) - set(report)):
+                print("run_math_check: expected " + line, file=sys.stderr)
+            for line in sorted(set(report) - set(expected)):
+                print("run_math_check: got      " + line, file=sys.stderr)
+            return 1
+        print("Matches %s (%d lines)" % (REFERENCE, len(report)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
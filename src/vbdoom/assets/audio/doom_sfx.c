@@ -3,581 +3,393 @@
  *
  * Auto-generated by prepare_doom_sfx.py. Do not edit.
  *
- * Each array contains packed 4-bit unsigned samples (0-15)
- * in nibble pairs (high nibble first) for SxLRV volume playback.
+ * Each array contains 2-bit ADPCM codes, four per byte (first
+ * sample in the top bits), 3-bit codes as a bit stream or 4-bit
+ * samples two per byte, decoded to 4-bit samples (0-15) by the timer
+ * ISR for SxLRV volume playback. The SNR is against plain 4-bit PCM
+ * of the same source, none below 10 dB.
+ * See prepare_doom_sfx.py.
  */
 
 #include "doom_sfx.h"
 
+/* 2-bit ADPCM, SNR 15.3 dB */
 const u8 sfx_punch[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x99, 0x87, 0x78,
-	0xBA, 0x97, 0x57, 0x88, 0x75, 0x68, 0xAC, 0x87, 0x77, 0x68, 0xAA, 0x9A, 0x9A, 0x88, 0x65, 0x67,
-	0x77, 0x78, 0x9A, 0xBC, 0xBB, 0x99, 0x89, 0xD7, 0x53, 0x36, 0x54, 0x79, 0x9B, 0xEE, 0xEE, 0xB8,
-	0x64, 0x53, 0x23, 0x45, 0x66, 0x76, 0x55, 0x67, 0x67, 0x66, 0x67, 0x77, 0x9B, 0xCC, 0xCB, 0xBA,
-	0xAA, 0x9A, 0x98, 0x77, 0x66, 0x67, 0x77, 0x88, 0x89, 0xAB, 0xCC, 0xDD, 0xEE, 0xEE, 0xED, 0xCA,
-	0xA9, 0x88, 0x76, 0x54, 0x22, 0x21, 0x10, 0x12, 0x24, 0x55, 0x67, 0x79, 0xBB, 0xBC, 0xCC, 0xCD,
-	0xDC, 0xDC, 0xBB, 0xBA, 0xB9, 0x98, 0x87, 0x66, 0x54, 0x54, 0x44, 0x44, 0x56, 0x67, 0x77, 0x87,
-	0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x77, 0x98, 0x78, 0x56, 0x86, 0x65, 0x55,
-	0x56, 0x56, 0x65, 0x56, 0x66, 0x67, 0x68, 0x89, 0x99, 0xAA, 0xAA, 0xAB, 0xBC, 0xCC, 0xCD, 0xED,
-	0xED, 0xCE, 0xDD, 0xDC, 0xA9, 0x9A, 0xA9, 0x77, 0x68, 0x67, 0x56, 0x66, 0x76, 0x66, 0x66, 0x66,
-	0x67, 0x67, 0x77, 0x88, 0x89, 0x99, 0x99, 0xA9, 0x99, 0x9A, 0xB9, 0x99, 0x9A, 0x88, 0x89, 0x88,
-	0x87, 0x88, 0x88, 0x78, 0x77, 0x77, 0x77, 0x67, 0x67, 0x77, 0x77, 0x76, 0x77, 0x67, 0x77, 0x77,
-	0x77, 0x66, 0x77, 0x77, 0x78, 0x78, 0x77, 0x87, 0x88, 0x88, 0x88, 0x78, 0x98, 0x88, 0x87, 0x89,
-	0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0x99, 0x89, 0x9A, 0x9A, 0xA9, 0xA9,
-	0x99, 0x99, 0x89, 0x99, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x89, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x88, 0x78, 0x78, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x77, 0x77, 0x77,
-	0x78, 0x87, 0x78, 0x87, 0x77, 0x87, 0x87, 0x88, 0x78, 0x78, 0x77, 0x88, 0x78, 0x88, 0x77, 0x77,
-	0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x28
+	0xD0, 0xA2, 0x22, 0x22, 0xD8, 0x22, 0x06, 0xFD, 0x4E, 0xC0, 0xF1, 0x5E, 0x29, 0x4C, 0x8F, 0xB1,
+	0x81, 0x50, 0xBE, 0xD7, 0xE1, 0xA5, 0x90, 0x3F, 0xB2, 0xC4, 0x26, 0xE5, 0x8E, 0x11, 0x56, 0x33,
+	0x2C, 0xBE, 0xC9, 0x04, 0x15, 0x64, 0x22, 0xBF, 0xEC, 0xEE, 0xE3, 0xB4, 0x14, 0x11, 0x40, 0x01,
+	0xB7, 0xAB, 0x7B, 0xBA, 0xF3, 0x29, 0x59, 0x03, 0x41, 0x3C, 0x88, 0x4E, 0xAC, 0x6F, 0xD3, 0xA2,
+	0x1D, 0xB1, 0x81, 0x15, 0x84, 0x81, 0x10, 0x16, 0x79, 0xA7, 0xF0, 0xBE, 0x9C, 0xC2, 0x72, 0x22,
+	0x1D, 0x24, 0x12, 0x87, 0x25, 0x7A, 0x1E, 0x0E, 0xB4, 0xAD, 0xCA, 0x2D, 0xC0, 0x8B, 0x6D, 0x82,
+	0x2E, 0x42, 0x1D, 0xA7, 0x62, 0x2D, 0x72, 0x34, 0xCB, 0x36, 0x02, 0x22, 0x35, 0x8D, 0x99, 0xB2,
+	0x8A, 0xD2, 0xDC, 0x9C, 0xA2, 0xE1, 0x22, 0x22, 0x1D, 0xA4, 0x88, 0x8B, 0x90, 0x88, 0xAE, 0xE4,
+	0x22, 0x22, 0x10, 0xB7, 0x82, 0x2A, 0xD2, 0x2D, 0x82, 0x22, 0x07, 0x8A, 0xD2, 0xAD, 0x2D, 0xC2,
+	0xD2, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xE0, 0x88, 0x1B, 0x1B, 0x97, 0x26, 0xD8, 0xC6, 0xD8, 0xE2,
+	0xB7, 0x62, 0x22, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x2E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x81, 0x2B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x8A, 0xE2, 0x22, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xD0
 };
 
+/* 3-bit ADPCM, SNR 14.1 dB */
 const u8 sfx_pistol[] __attribute__((aligned(4))) = {
-	0x69, 0x40, 0x00, 0xAF, 0xDC, 0xAB, 0x76, 0x7A, 0xA8, 0x63, 0x65, 0x56, 0x66, 0x77, 0x77, 0x79,
-	0xFD, 0xCB, 0xBA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x88, 0x68, 0x50, 0x33, 0x54, 0x55, 0x56,
-	0x66, 0x7C, 0xB9, 0xC8, 0x56, 0x78, 0x67, 0x87, 0x97, 0x78, 0x88, 0x8C, 0xE7, 0x88, 0xBE, 0xDA,
-	0x7C, 0x8A, 0xDB, 0xA6, 0x6A, 0xCB, 0xB9, 0xE9, 0x8B, 0x9A, 0x41, 0x33, 0x44, 0x34, 0x57, 0x87,
-	0xB9, 0x9B, 0xCA, 0x86, 0x68, 0x65, 0x55, 0x77, 0x9F, 0xC7, 0xA7, 0x78, 0x69, 0x87, 0x45, 0x96,
-	0x1A, 0x44, 0xB8, 0x53, 0x8B, 0xED, 0xB7, 0x65, 0x76, 0x99, 0x88, 0x96, 0xAB, 0xD7, 0x97, 0x37,
-	0x68, 0x8A, 0x99, 0xCB, 0xB8, 0x32, 0x57, 0x96, 0xA6, 0x6C, 0x77, 0xB5, 0x56, 0xBC, 0xB8, 0xBC,
-	0x63, 0x89, 0x88, 0x79, 0x89, 0x97, 0x65, 0x66, 0x68, 0x95, 0x7D, 0x88, 0xBB, 0x9A, 0x9B, 0x65,
-	0x76, 0x66, 0xC8, 0x68, 0x46, 0x54, 0x66, 0x7B, 0xBA, 0x99, 0x89, 0x99, 0x98, 0x34, 0x54, 0x66,
-	0x66, 0x67, 0xCB, 0xBC, 0xAA, 0x88, 0x66, 0x59, 0xA7, 0x97, 0x89, 0x9B, 0x68, 0x87, 0x75, 0x56,
-	0x9A, 0x99, 0xBB, 0x98, 0xB9, 0x79, 0x99, 0x8B, 0x44, 0x63, 0x35, 0x68, 0x85, 0x54, 0x59, 0x6A,
-	0xC9, 0xB9, 0xAA, 0x9B, 0x9A, 0x99, 0x9A, 0xBB, 0xA9, 0x34, 0x65, 0xBA, 0x99, 0x68, 0x86, 0x98,
-	0x75, 0x55, 0x68, 0x88, 0x75, 0x77, 0x86, 0x97, 0x88, 0x99, 0x9B, 0xBD, 0xB8, 0xA8, 0x78, 0x87,
-	0x88, 0x9A, 0x87, 0x76, 0x55, 0x67, 0x89, 0x98, 0x98, 0x66, 0x88, 0x7B, 0xB9, 0xA7, 0x77, 0x77,
-	0x7A, 0xA9, 0xA8, 0x98, 0x89, 0x98, 0x37, 0x74, 0x79, 0x89, 0x88, 0x74, 0x66, 0x66, 0x87, 0x77,
-	0x66, 0x57, 0x9B, 0xCB, 0xBB, 0x98, 0x77, 0x67, 0x77, 0x88, 0x66, 0x66, 0x66, 0x88, 0xAB, 0xBC,
-	0xA9, 0x98, 0x99, 0x87, 0x77, 0x77, 0x77, 0x77, 0x68, 0x87, 0x79, 0x75, 0x77, 0x98, 0x9B, 0x87,
-	0x96, 0x59, 0x68, 0xA9, 0xBB, 0xA7, 0x77, 0x45, 0x65, 0x6A, 0xA9, 0x98, 0x98, 0x97, 0x79, 0x86,
-	0x87, 0x77, 0x77, 0x78, 0x98, 0x88, 0x88, 0x78, 0x76, 0x67, 0x89, 0xA8, 0x99, 0x7A, 0xAA, 0xB9,
-	0xC9, 0xA8, 0x87, 0x66, 0x68, 0x67, 0x88, 0x89, 0x97, 0x67, 0x78, 0x89, 0x86, 0x7A, 0xAA, 0xCC,
-	0xB8, 0x64, 0x45, 0x66, 0x77, 0x68, 0x99, 0xCB, 0xAB, 0xA9, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x67, 0x9A, 0xA9, 0x99, 0xBB, 0x99, 0x86, 0x66, 0x55, 0x77, 0x79, 0x9A, 0xA9, 0x99, 0x98, 0x88,
-	0x88, 0x99, 0x97, 0x68, 0x86, 0x67, 0x67, 0x78, 0xAA, 0xAA, 0x98, 0x76, 0x77, 0x88, 0x77, 0x66,
-	0x87, 0x89, 0x99, 0x99, 0x98, 0x89, 0x98, 0x77, 0x65, 0x65, 0x78, 0x9A, 0x9A, 0xBA, 0x99, 0x99,
-	0x89, 0xA8, 0x87, 0x66, 0x67, 0x57, 0x77, 0x89, 0x97, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x8A, 0x9A, 0xA9, 0x97, 0x87, 0x78, 0x98, 0x87, 0x66, 0x57, 0x77, 0x77, 0x98, 0x89, 0x99, 0x98,
-	0x88, 0xA8, 0x79, 0x68, 0x66, 0x76, 0x78, 0x87, 0x87, 0x88, 0x8A, 0x99, 0x99, 0x88, 0x98, 0x79,
-	0x86, 0x66, 0x68, 0x87, 0x99, 0x79, 0xA9, 0x78, 0x87, 0xAA, 0x98, 0x78, 0x78, 0x78, 0x97, 0x67,
-	0x98, 0x99, 0x88, 0x98, 0x87, 0x88, 0x76, 0x76, 0x68, 0x76, 0x76, 0x79, 0x79, 0x99, 0x89, 0x88,
-	0x99, 0x99, 0xAA, 0x88, 0xA9, 0x78, 0x9A, 0x98, 0x77, 0x67, 0x85, 0x67, 0x66, 0x76, 0x88, 0x88,
-	0x99, 0x89, 0x97, 0x69, 0xBB, 0xBA, 0xA8, 0x75, 0x44, 0x55, 0x7A, 0x98, 0x67, 0x87, 0x68, 0xBB,
-	0xBB, 0xAA, 0x98, 0x99, 0x77, 0x65, 0x56, 0x66, 0x77, 0x78, 0x98, 0x9A, 0xAA, 0x98, 0x88, 0x77,
-	0x68, 0x98, 0x9A, 0xA9, 0x78, 0x77, 0x78, 0x77, 0x88, 0x67, 0x77, 0x88, 0x99, 0x97, 0x77, 0x66,
-	0x78, 0x87, 0x89, 0x9A, 0xA9, 0x98, 0x89, 0x98, 0x86, 0x76, 0x65, 0x78, 0x67, 0x98, 0x89, 0x99,
-	0x89, 0x98, 0x89, 0x98, 0x89, 0x77, 0x88, 0x88, 0x89, 0x88, 0x78, 0x98, 0x78, 0x88, 0x77, 0x88,
-	0x87, 0x88, 0x9A, 0x98, 0x88, 0x78, 0x87, 0x77, 0x77, 0x87, 0x66, 0x88, 0x99, 0x9A, 0xA9, 0x99,
-	0x98, 0x99, 0x99, 0x99, 0x87, 0x76, 0x54, 0x45, 0x55, 0x78, 0x88, 0x99, 0xAB, 0xBB, 0xBA, 0x99,
-	0x88, 0x76, 0x67, 0x77, 0x78, 0x99, 0x99, 0x99, 0x99, 0x99, 0x87, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x66, 0x67, 0x87, 0x77, 0x88, 0x99, 0x98, 0x89, 0x99, 0x99, 0x88, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77,
-	0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x99, 0x99, 0xAA, 0xA9, 0x88, 0x88, 0x77,
-	0x65, 0x67, 0x87, 0x77, 0x88, 0x99, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x89, 0x98, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x87,
-	0x78, 0x89, 0x98, 0x89, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x99, 0x89, 0x99, 0x98, 0x88,
-	0x88, 0x89, 0x98, 0x88, 0x87, 0x67, 0x77, 0x77, 0x88, 0x99, 0x98, 0x88, 0x88, 0x87, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x87, 0x77, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x77, 0x77, 0x65, 0x56, 0x66, 0x67, 0x88, 0x89, 0x99, 0x99,
-	0x99, 0x98, 0x88, 0x89, 0x98, 0x88, 0x99, 0x89, 0x98, 0x88, 0x88, 0x89, 0x88, 0x87, 0x77, 0x76,
-	0x66, 0x66, 0x68, 0x88, 0x9A, 0xAB, 0xBB, 0xAA, 0xA9, 0x87, 0x65, 0x55, 0x55, 0x67, 0x88, 0x99,
-	0x99, 0x9A, 0xA9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77,
-	0x88, 0x88, 0x89, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78,
-	0x88, 0x88, 0x77, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x88, 0x76, 0x67, 0x77, 0x78, 0x88,
-	0x89, 0x99, 0x99, 0x98, 0x88, 0x77, 0x66, 0x77, 0x77, 0x78, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x95
+	0xEF, 0xFD, 0xDA, 0x92, 0x0D, 0x02, 0x97, 0x65, 0x21, 0x80, 0xC1, 0x5B, 0x66, 0x59, 0xA0, 0x13,
+	0xC1, 0x04, 0x13, 0x6E, 0xFF, 0x30, 0xC3, 0x01, 0x8D, 0xB9, 0x5F, 0xA0, 0x8C, 0x4E, 0x56, 0x11,
+	0x9B, 0x7E, 0x02, 0x66, 0xCA, 0x95, 0x6F, 0x08, 0xC1, 0xDE, 0x86, 0x4F, 0x80, 0x12, 0x14, 0x96,
+	0x72, 0x13, 0xB5, 0x07, 0x50, 0x1A, 0x4E, 0xF3, 0x80, 0xAA, 0x5E, 0x5E, 0xCE, 0x85, 0x2D, 0x64,
+	0xDB, 0xE5, 0x51, 0x0B, 0x17, 0x41, 0x71, 0x72, 0x80, 0x18, 0x1C, 0xBF, 0xD4, 0x4F, 0x58, 0x2B,
+	0x16, 0x85, 0x09, 0x94, 0xD5, 0x09, 0x22, 0x80, 0x7B, 0x4C, 0x4E, 0x76, 0xF0, 0x02, 0x8A, 0xFD,
+	0x32, 0xB7, 0x71, 0xC2, 0x45, 0x13, 0x92, 0x4A, 0xA0, 0xDF, 0x81, 0x10, 0x91, 0x37, 0x01, 0xF3,
+	0x0C, 0x33, 0x38, 0x40, 0x73, 0xE6, 0x49, 0xA2, 0x42, 0x46, 0x3C, 0x56, 0xA8, 0x7B, 0xF0, 0x58,
+	0x82, 0x9A, 0x44, 0xF2, 0x14, 0xD0, 0x2B, 0xC6, 0xC0, 0x88, 0xFF, 0xD7, 0x1C, 0x93, 0x11, 0xD4,
+	0x98, 0x42, 0x80, 0xF9, 0x43, 0x95, 0x30, 0x80, 0xCB, 0xDC, 0xE8, 0x05, 0x51, 0x1F, 0x65, 0xD1,
+	0x22, 0x46, 0x3F, 0x84, 0x7B, 0x14, 0x78, 0x05, 0x4C, 0x53, 0xC5, 0x09, 0xFE, 0x46, 0x26, 0x1B,
+	0x3F, 0x22, 0x07, 0x24, 0xC3, 0xB4, 0x85, 0x13, 0xDA, 0x31, 0x01, 0xDF, 0x20, 0xAD, 0x86, 0x62,
+	0xF2, 0x52, 0x3D, 0x82, 0x08, 0x20, 0xEC, 0x60, 0xF5, 0x51, 0x42, 0xFC, 0x3E, 0x3A, 0x4D, 0x43,
+	0x61, 0x38, 0x15, 0xB9, 0x05, 0x38, 0xF0, 0xAE, 0x54, 0x09, 0x03, 0x56, 0x09, 0x32, 0xD6, 0x32,
+	0x97, 0x33, 0xB8, 0x05, 0x78, 0x59, 0x70, 0x0F, 0x13, 0x03, 0xBE, 0x90, 0x82, 0xDC, 0xB0, 0x10,
+	0xDE, 0xE0, 0x08, 0x23, 0xB5, 0x1C, 0xA6, 0xDF, 0x44, 0x10, 0x41, 0x04, 0xE9, 0x91, 0xA1, 0x63,
+	0xCB, 0xE0, 0xC1, 0xC0, 0xC1, 0x98, 0x41, 0xE0, 0x81, 0x8D, 0xEB, 0x1C, 0x0A, 0xA2, 0x42, 0x0D,
+	0x7D, 0x51, 0x4B, 0x39, 0x75, 0x18, 0x20, 0x9E, 0x31, 0xE8, 0xD8, 0xD6, 0x89, 0xC5, 0x5C, 0x20,
+	0xE5, 0x79, 0x68, 0xAF, 0xA1, 0x11, 0x9C, 0x0C, 0x40, 0x82, 0x08, 0x27, 0x4E, 0xA9, 0x67, 0x14,
+	0x33, 0x86, 0xC3, 0x38, 0x21, 0x74, 0x28, 0x27, 0x89, 0xF8, 0xB9, 0xB0, 0xD4, 0x66, 0x54, 0xC4,
+	0xE8, 0x83, 0xC7, 0x73, 0xBC, 0x40, 0xC6, 0x43, 0x13, 0x79, 0x1D, 0x8B, 0x31, 0xAA, 0x95, 0xE9,
+	0x75, 0x4A, 0x0E, 0x99, 0x4D, 0x56, 0x0E, 0xD5, 0x52, 0xC4, 0x0C, 0x6C, 0x62, 0x47, 0x3C, 0x77,
+	0x92, 0x75, 0xD3, 0x17, 0xC1, 0xC0, 0xD6, 0x20, 0x72, 0xBB, 0xB3, 0x42, 0x59, 0xEE, 0xB1, 0x06,
+	0xE5, 0xC4, 0x4C, 0xD0, 0x82, 0xCD, 0x94, 0xE2, 0xD8, 0xA0, 0x70, 0x33, 0x52, 0x13, 0xD9, 0x38,
+	0xEC, 0xD2, 0x87, 0xC6, 0xC8, 0xEC, 0x73, 0x80, 0x10, 0x47, 0x79, 0x2C, 0x68, 0x62, 0x82, 0x98,
+	0x68, 0x87, 0x1C, 0x51, 0x99, 0xE5, 0x50, 0x44, 0xE4, 0x68, 0xE6, 0x0B, 0xC2, 0x20, 0x0F, 0x4C,
+	0x8E, 0xAA, 0x0C, 0x08, 0x9D, 0x04, 0x75, 0x93, 0xA9, 0x64, 0x01, 0x6E, 0x18, 0x30, 0x39, 0x84,
+	0x1D, 0x41, 0x04, 0xFA, 0x6B, 0xA2, 0x05, 0xA1, 0x14, 0x66, 0x09, 0xF4, 0xC3, 0x58, 0xE0, 0x0D,
+	0x40, 0x20, 0x82, 0x4F, 0x88, 0x10, 0x41, 0xE0, 0x82, 0x4E, 0x23, 0x56, 0x06, 0x10, 0x9E, 0x31,
+	0x20, 0xF1, 0xC0, 0x27, 0x82, 0x08, 0x27, 0x80, 0x41, 0x18, 0x81, 0x88, 0x27, 0x82, 0x08, 0x3C,
+	0x78, 0x40, 0xE0, 0x82, 0x0F, 0x04, 0x61, 0xC1, 0x18, 0x9F, 0x09, 0x3C, 0xF5, 0x15, 0x60, 0x61,
+	0x0E, 0x20, 0x70, 0x78, 0x04, 0x10, 0x49, 0xC4, 0x82, 0x08, 0x20, 0x62, 0x08, 0x23, 0x1C, 0x81,
+	0x04, 0x1E, 0x08, 0x27, 0x8C, 0x11, 0xE3, 0xB3, 0x88, 0x20, 0x82, 0x31, 0x18, 0xEA, 0x09, 0xC4,
+	0x10, 0x31, 0xE0, 0x9F, 0x10, 0x20, 0x61, 0x09, 0xE0, 0x12, 0x70, 0x84, 0x10, 0x41, 0x27, 0x12,
+	0x06, 0x27, 0x81, 0x88, 0xC4, 0xF0, 0x08, 0x20, 0x82, 0x31, 0x04, 0x12, 0x7C, 0x24, 0xF8, 0x10,
+	0x03, 0x50, 0x38, 0x04, 0x12, 0x71, 0x23, 0x1C, 0x47, 0x2A, 0x9A, 0x01, 0x03, 0xC2, 0x71, 0x27,
+	0x80, 0x56, 0xC4, 0x44, 0x38, 0x38, 0x9E, 0xED, 0x44, 0x81, 0xA5, 0x14, 0x10, 0x31, 0xEC, 0x82,
+	0x08, 0x20, 0x81, 0x8F, 0x04, 0xE2, 0x41, 0x04, 0x60, 0x40, 0xF4, 0x0E, 0x59, 0x04, 0x10, 0x41,
+	0x04, 0x1E, 0x08, 0xC4, 0x10, 0x41, 0x04, 0x10, 0x31, 0xE0, 0x10, 0x41, 0x04, 0x10, 0x49, 0xC2,
+	0x10, 0x4F, 0x03, 0x10, 0x31, 0x20, 0x83, 0xC1, 0x3E, 0x88, 0x40, 0xC4, 0x0C, 0x48, 0x27, 0x83,
+	0xCD, 0x1C, 0x02, 0x31, 0x18, 0x10, 0x49, 0xC4, 0x82, 0x08, 0x27, 0x81, 0x88, 0x20, 0x81, 0xE1,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x4F, 0x03, 0x10, 0x41, 0x03, 0xC2, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0xE0, 0x82, 0x06, 0x23, 0x10, 0x41, 0x27, 0x12, 0x78, 0x04, 0x10, 0x41, 0x18, 0x82,
+	0x08, 0x18, 0x82, 0x4E, 0x24, 0x10, 0x41, 0xE0, 0x82, 0x08, 0xC4, 0x10, 0x31, 0x04, 0xF0, 0x41,
+	0xE0, 0x8C, 0x4F, 0x18, 0x82, 0x08, 0x18, 0x90, 0x78, 0x24, 0xE2, 0x40, 0xC4, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xF0, 0x41, 0x18, 0x10, 0x31, 0x20, 0xF0, 0x49, 0xC4, 0x82,
+	0x08, 0x20, 0x62, 0x08, 0xC4, 0x10, 0x41, 0x3C, 0x02, 0x09, 0xE0, 0x62, 0x09, 0xD4, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x07, 0x8E, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x13, 0xC6, 0x24, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x3C, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x24, 0xCB, 0x40, 0xC4, 0x82, 0x00, 0xF4, 0x02, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x78, 0xC4, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x27, 0x8C, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x1D, 0xF0, 0x00
 };
 
+/* 2-bit ADPCM, SNR 11.8 dB */
 const u8 sfx_shotgun[] __attribute__((aligned(4))) = {
-	0x57, 0xBB, 0x75, 0x55, 0x8C, 0xCB, 0x98, 0x63, 0x56, 0x89, 0xCA, 0x8B, 0x98, 0x75, 0x44, 0x78,
-	0x8A, 0xAB, 0xDB, 0x98, 0x65, 0x44, 0x57, 0x78, 0x9A, 0xAA, 0xA9, 0x99, 0x67, 0x88, 0x87, 0x98,
-	0x77, 0x58, 0x8A, 0xB9, 0x88, 0xA8, 0x86, 0x57, 0x76, 0x98, 0x99, 0xA9, 0x7B, 0x45, 0xA2, 0x39,
-	0x45, 0x98, 0x8D, 0xAB, 0xF7, 0xE9, 0x8A, 0x76, 0x76, 0x57, 0x57, 0x87, 0x88, 0x88, 0x88, 0x89,
-	0x99, 0x98, 0x88, 0x77, 0x77, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x89, 0x99, 0x98, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x99, 0x88, 0x77, 0x78, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87, 0x69, 0xC8, 0x55, 0x56,
-	0xBC, 0xBA, 0x97, 0x34, 0x67, 0x9B, 0xC8, 0xBA, 0x98, 0x54, 0x46, 0x88, 0x9A, 0xAD, 0xCA, 0x97,
-	0x54, 0x45, 0x67, 0x89, 0x9A, 0xAA, 0xA9, 0x97, 0x68, 0x89, 0x78, 0x97, 0x85, 0x69, 0x9B, 0x99,
-	0x7A, 0x98, 0x75, 0x67, 0x58, 0x88, 0x99, 0xA7, 0xA8, 0x29, 0x50, 0x87, 0x38, 0x97, 0xBD, 0x8F,
-	0x9A, 0xD6, 0xA8, 0x67, 0x74, 0x66, 0x58, 0x68, 0x99, 0xAB, 0xA8, 0xB6, 0x77, 0x49, 0x67, 0xA9,
-	0x9A, 0x99, 0xA5, 0x97, 0x59, 0x6B, 0x7C, 0xC8, 0xA8, 0x85, 0x84, 0x7B, 0x69, 0x77, 0x76, 0x85,
-	0x7C, 0x94, 0xBB, 0x76, 0x4A, 0x94, 0x97, 0xB9, 0x75, 0x69, 0x3C, 0x7B, 0xC7, 0xB5, 0x73, 0x96,
-	0x5B, 0xDB, 0xA8, 0x77, 0x37, 0x46, 0x89, 0x9B, 0x6B, 0x99, 0xAA, 0xAA, 0xBA, 0x87, 0x65, 0x56,
-	0x44, 0x68, 0x89, 0x98, 0x99, 0xA9, 0x87, 0x76, 0x68, 0x88, 0x77, 0x67, 0x56, 0x9A, 0xBC, 0xDC,
-	0xDC, 0xBA, 0x98, 0x76, 0x66, 0x67, 0x77, 0x78, 0x88, 0x88, 0x87, 0x77, 0x75, 0x56, 0x79, 0xAB,
-	0xBB, 0xAA, 0x98, 0x76, 0x55, 0x44, 0x55, 0x65, 0x55, 0x35, 0x56, 0x89, 0x9A, 0xBA, 0xBB, 0xAC,
-	0xA9, 0xAA, 0xBC, 0xCB, 0xAA, 0xA9, 0x87, 0x66, 0x67, 0x88, 0x9A, 0x98, 0x98, 0x75, 0x32, 0x11,
-	0x12, 0x23, 0x55, 0x66, 0x78, 0xBC, 0xCD, 0xDD, 0xDE, 0xDE, 0xDB, 0xAB, 0x97, 0x76, 0x56, 0x54,
-	0x55, 0x88, 0x9A, 0x98, 0x77, 0x76, 0x67, 0x66, 0x66, 0x66, 0x79, 0x99, 0x99, 0x98, 0x89, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x98, 0x7A, 0xBA, 0x98, 0x55, 0x78, 0x8A, 0xB9, 0x86, 0x54,
-	0x58, 0x68, 0x9A, 0xBB, 0xA7, 0x66, 0x56, 0x65, 0x79, 0xBC, 0xCC, 0xA9, 0x76, 0x55, 0x56, 0x67,
-	0x89, 0x8A, 0xA8, 0x88, 0x97, 0x89, 0x9A, 0x86, 0x65, 0x88, 0x97, 0x99, 0xAB, 0x98, 0x96, 0x76,
-	0x76, 0x79, 0x6B, 0xA3, 0x34, 0x34, 0x45, 0x58, 0xA8, 0xC9, 0x99, 0x58, 0x7A, 0xAC, 0xCC, 0xD9,
-	0xB8, 0x66, 0x65, 0x85, 0x88, 0x88, 0x89, 0x8A, 0xCC, 0xCC, 0xA9, 0xA8, 0x65, 0x55, 0x56, 0x66,
-	0x68, 0x89, 0x89, 0x87, 0x67, 0x87, 0x88, 0x86, 0x44, 0x55, 0x67, 0x89, 0xBC, 0xDD, 0xDD, 0xCB,
-	0xA9, 0x98, 0x87, 0x87, 0x78, 0x88, 0x88, 0x89, 0x87, 0x64, 0x45, 0x56, 0x89, 0xAB, 0xBB, 0xBA,
-	0xA8, 0x77, 0x66, 0x55, 0x54, 0x54, 0x34, 0x44, 0x56, 0x67, 0x77, 0x99, 0x99, 0x89, 0x9A, 0xAA,
-	0xAB, 0xBB, 0xBA, 0xA9, 0x88, 0x88, 0x89, 0x89, 0x9A, 0xAA, 0x98, 0x76, 0x54, 0x33, 0x33, 0x34,
-	0x45, 0x55, 0x55, 0x56, 0x67, 0x78, 0x99, 0xAA, 0xBC, 0xDC, 0xDD, 0xBC, 0xBC, 0xCA, 0xAA, 0x98,
-	0x98, 0x77, 0x66, 0x67, 0x77, 0x88, 0x98, 0x99, 0xAA, 0xAA, 0x9A, 0xA9, 0x89, 0x88, 0x98, 0x88,
-	0x87, 0x67, 0x76, 0x55, 0x55, 0x55, 0x55, 0x67, 0x67, 0x78, 0x89, 0xAA, 0xAB, 0xBB, 0xBB, 0xBC,
-	0xCB, 0xBA, 0xA7, 0x77, 0x55, 0x54, 0x34, 0x33, 0x44, 0x57, 0x77, 0x89, 0x99, 0x8A, 0x88, 0x99,
-	0x88, 0x98, 0x89, 0x88, 0x78, 0x67, 0x75, 0x79, 0x88, 0x89, 0x87, 0x96, 0x77, 0x76, 0x97, 0x97,
-	0x8A, 0x8A, 0x99, 0xBA, 0xAA, 0xA9, 0x89, 0x88, 0x87, 0x76, 0x77, 0x68, 0x89, 0xAA, 0xAB, 0xBC,
-	0xBC, 0xBA, 0x99, 0x87, 0x88, 0x67, 0x78, 0x77, 0x77, 0x77, 0x88, 0x78, 0x98, 0x78, 0x87, 0x76,
-	0x77, 0x66, 0x66, 0x64, 0x65, 0x44, 0x45, 0x65, 0x67, 0x78, 0x89, 0x9A, 0x9B, 0xCB, 0xCB, 0xBA,
-	0x9A, 0xA9, 0x99, 0x9A, 0x88, 0x88, 0x98, 0x88, 0x77, 0x76, 0x54, 0x34, 0x34, 0x54, 0x66, 0x77,
-	0x98, 0xA9, 0xBC, 0xDC, 0xCD, 0xDD, 0xCB, 0xBB, 0x99, 0x76, 0x76, 0x78, 0x88, 0x88, 0x87, 0x78,
-	0x77, 0x77, 0x65, 0x56, 0x67, 0x76, 0x89, 0x88, 0x79, 0x98, 0x88, 0x89, 0x99, 0x89, 0x9B, 0xAB,
-	0xB9, 0xAB, 0x89, 0x86, 0x66, 0x55, 0x55, 0x56, 0x78, 0x68, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x9A, 0xAA, 0xA9, 0xA9, 0x99, 0x88, 0x76, 0x65, 0x56, 0x66, 0x67, 0x66, 0x66, 0x7A, 0xBA, 0xBA,
-	0x89, 0x89, 0x98, 0x65, 0x66, 0x77, 0x78, 0x76, 0x75, 0x56, 0x43, 0x45, 0x68, 0x7B, 0xBB, 0xAA,
-	0xB9, 0x98, 0x8A, 0xBC, 0xCA, 0xA9, 0x98, 0x66, 0x45, 0x56, 0x76, 0x77, 0x89, 0x88, 0xAB, 0xAA,
-	0x98, 0x88, 0x77, 0x66, 0x55, 0x44, 0x44, 0x53, 0x45, 0x56, 0x77, 0x89, 0x9A, 0xAB, 0xBB, 0xBB,
-	0xAB, 0xBB, 0xAB, 0xDA, 0x99, 0x77, 0x76, 0x65, 0x67, 0x68, 0x78, 0x88, 0x99, 0x9A, 0xA9, 0x99,
-	0x98, 0x89, 0x99, 0x99, 0x89, 0x87, 0x88, 0x88, 0x89, 0x98, 0x98, 0x88, 0x78, 0x78, 0x88, 0x79,
-	0x99, 0x9A, 0x98, 0x69, 0x87, 0x76, 0x87, 0x56, 0x55, 0x55, 0x46, 0x55, 0x67, 0x8A, 0xA9, 0xAC,
-	0xDB, 0xB8, 0x97, 0x77, 0x54, 0x55, 0x67, 0x77, 0x87, 0x77, 0x69, 0x76, 0x77, 0x8A, 0xAC, 0xAB,
-	0xCB, 0xAA, 0xBB, 0xBC, 0xCC, 0xBB, 0xBB, 0x87, 0x65, 0x47, 0x65, 0x64, 0x46, 0x68, 0x89, 0x99,
-	0xAB, 0xCC, 0xA8, 0x76, 0x55, 0x56, 0x57, 0x55, 0x76, 0x65, 0x55, 0x56, 0x89, 0x89, 0xAA, 0x89,
-	0xAD, 0xBD, 0xDB, 0xDB, 0xA9, 0x88, 0x65, 0x54, 0x46, 0x45, 0x55, 0x55, 0x88, 0x89, 0xA9, 0x99,
-	0x78, 0x88, 0x79, 0x88, 0x8A, 0x87, 0xA9, 0x8A, 0x98, 0xA9, 0xA9, 0xA8, 0x97, 0x66, 0x78, 0x7B,
-	0xBA, 0x88, 0x88, 0x96, 0x77, 0x89, 0x75, 0x54, 0x57, 0x86, 0x79, 0x76, 0x96, 0x79, 0x65, 0x67,
-	0x79, 0x9A, 0xCA, 0xBB, 0xBB, 0xBB, 0xAB, 0xBB, 0xBB, 0xB9, 0x56, 0x75, 0x76, 0x56, 0x55, 0x56,
-	0x66, 0x45, 0x77, 0x76, 0x97, 0x77, 0x67, 0x68, 0xA9, 0xBB, 0xBA, 0xAA, 0x77, 0x87, 0x77, 0x77,
-	0x89, 0x86, 0x67, 0x79, 0x66, 0x88, 0x89, 0xA9, 0xBA, 0x7B, 0x99, 0xB8, 0x88, 0xA9, 0x78, 0x75,
-	0x74, 0x04, 0x43, 0x65, 0x77, 0x99, 0xBA, 0xCE, 0xED, 0xDC, 0xCA, 0xAA, 0xAA, 0x98, 0x77, 0x76,
-	0x44, 0x44, 0x56, 0x78, 0x78, 0x79, 0xAA, 0xA9, 0x9A, 0x99, 0xA9, 0x99, 0x88, 0x87, 0x87, 0x77,
-	0x76, 0x68, 0x78, 0x78, 0x9A, 0xA9, 0xA9, 0x9A, 0x89, 0x87, 0x88, 0x77, 0x77, 0x76, 0x65, 0x65,
-	0x57, 0x68, 0x88, 0x89, 0x89, 0xA9, 0x88, 0x99, 0x9B, 0x99, 0x98, 0x77, 0x99, 0x88, 0x98, 0xAB,
-	0x89, 0xA8, 0x77, 0x36, 0x78, 0x99, 0x99, 0xAA, 0xA9, 0x99, 0x99, 0x77, 0x54, 0x53, 0x44, 0x57,
-	0x88, 0x78, 0x98, 0x87, 0x76, 0x56, 0x76, 0x68, 0x87, 0x68, 0x86, 0x76, 0x78, 0x89, 0xAB, 0xCC,
-	0xEF, 0xCC, 0xCB, 0xBB, 0xAA, 0xA9, 0x98, 0x88, 0x75, 0x66, 0x55, 0x55, 0x77, 0x77, 0x78, 0x78,
-	0x87, 0x96, 0x78, 0x87, 0x79, 0x78, 0x85, 0x57, 0x88, 0x88, 0x88, 0x88, 0x89, 0xA7, 0x77, 0x76,
-	0x55, 0x89, 0xAA, 0xA9, 0x98, 0x78, 0x75, 0x78, 0x77, 0x68, 0x99, 0x88, 0xA7, 0x68, 0x77, 0x99,
-	0x88, 0x99, 0x98, 0x99, 0xAB, 0xCC, 0xCC, 0xBB, 0xA9, 0x87, 0x67, 0x64, 0x66, 0x67, 0x77, 0x78,
-	0x88, 0x87, 0x79, 0x89, 0x99, 0x88, 0x89, 0x99, 0x99, 0x88, 0x87, 0x88, 0x88, 0x77, 0x87, 0x77,
-	0x76, 0x66, 0x66, 0x77, 0x77, 0x78, 0x97, 0x88, 0x88, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98,
-	0x88, 0x99, 0x89, 0x98, 0x88, 0x77, 0x77, 0x76, 0x76, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x87,
-	0x78, 0x89, 0x89, 0x99, 0x99, 0x99, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x89, 0x98,
-	0x88, 0x87, 0x78, 0x88, 0x78, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x9A, 0x99, 0x98, 0x86, 0x78,
-	0x77, 0x67, 0x88, 0x89, 0x88, 0x88, 0x87, 0x89, 0x89, 0xA9, 0x98, 0x87, 0x77, 0x88, 0x88, 0x99,
-	0x99, 0x98, 0x88, 0x88, 0x87, 0x76, 0x77, 0x76, 0x88, 0x78, 0x87, 0x89, 0x98, 0x88, 0x88, 0x89,
-	0x89, 0x99, 0x98, 0x99, 0x88, 0x88, 0x78, 0x76, 0x77, 0x77, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x88, 0x88, 0x79, 0x99, 0x99, 0x89, 0x98, 0x88, 0x89, 0x99, 0x98, 0x78, 0x88, 0x87, 0x77,
-	0x77, 0x67, 0x77, 0x87, 0x87, 0x77, 0x88, 0x99, 0xA9, 0x9A, 0x98, 0x88, 0x78, 0x89, 0x88, 0x89,
-	0x98, 0x99, 0x9A, 0x99, 0x99, 0x88, 0x87, 0x88, 0x77, 0x77, 0x76, 0x76, 0x77, 0x77, 0x77, 0x78,
-	0x78, 0x87, 0x87, 0x87, 0x88, 0x78, 0x89, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x88, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x78, 0x78, 0x97, 0x98, 0x88, 0x98, 0x89, 0x87, 0x76,
-	0x76, 0x87, 0x76, 0x78, 0x87, 0x77, 0x87, 0x67, 0x87, 0x78, 0x77, 0x88, 0x88, 0x89, 0x99, 0x89,
-	0x88, 0x88, 0x78, 0x88, 0x89, 0x9A, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x78, 0x88, 0x99, 0x99, 0x89,
-	0x99, 0x98, 0x88, 0x87, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x88, 0x99, 0x98, 0x99, 0x89,
-	0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x88, 0x89,
-	0x99, 0x99, 0x99, 0x99, 0x98, 0x78, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88,
-	0x98, 0x98, 0x99, 0x98, 0x88, 0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x99, 0x99, 0x88, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x76, 0x77, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x78, 0x89, 0x88, 0x88, 0x98,
-	0x88, 0x89, 0x78, 0x78, 0x77, 0x87, 0x88, 0x89, 0x87, 0x79, 0x69, 0x86, 0xB8, 0x99, 0x89, 0x98,
-	0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x88, 0x77, 0x78, 0x77, 0x87,
-	0x87, 0x78, 0x88, 0x89, 0x99, 0x89, 0x99, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77,
-	0x67, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
-	0x98, 0x98, 0x88, 0x87, 0x88, 0x78, 0x87, 0x88, 0x77, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x77,
-	0x78, 0x88, 0x88, 0x89, 0x98, 0x89, 0x89, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x88, 0x88, 0x98, 0x89, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x87, 0x77, 0x77,
-	0x87, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x99, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x99, 0x89, 0x88, 0x88, 0x88, 0x87, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x78, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x98, 0x97, 0x88, 0x89, 0x88, 0x87, 0x98, 0x87, 0x87,
-	0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x97, 0x77, 0x77, 0x89, 0x87, 0x98, 0x88, 0x87,
-	0x77, 0x78, 0x78, 0x98, 0x69, 0x88, 0x88, 0xA8, 0x98, 0x89, 0x99, 0x88, 0x88, 0x89, 0x98, 0x88,
-	0x89, 0x88, 0x78, 0x67, 0x77, 0x77, 0x78, 0x88, 0x89, 0x97, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88,
-	0x77, 0x88, 0x78, 0x77, 0x88, 0x78, 0x88, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x98,
-	0x89, 0x88, 0x88, 0x87, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x96
+	0xD5, 0xF2, 0x52, 0xEF, 0x05, 0x2C, 0xBB, 0xC4, 0x11, 0x7A, 0xEA, 0x50, 0x58, 0xB7, 0xC2, 0x76,
+	0xCD, 0x92, 0xC3, 0xB9, 0x34, 0x27, 0xDE, 0x71, 0xC0, 0x18, 0x77, 0x8B, 0x29, 0xD2, 0x02, 0x81,
+	0x2B, 0xAE, 0x04, 0x12, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xA0, 0x41, 0x2B, 0xAE, 0x04, 0x88,
+	0x84, 0x2F, 0xA1, 0x01, 0xB8, 0x8F, 0x57, 0xC9, 0x1A, 0xEE, 0x44, 0x72, 0xBE, 0x16, 0x41, 0xBE,
+	0xE9, 0x11, 0x98, 0xBB, 0xD9, 0xC3, 0x31, 0x1C, 0xDA, 0xE1, 0xD8, 0x27, 0x7D, 0xB6, 0x92, 0x4D,
+	0xC3, 0x2C, 0xB0, 0x1D, 0x24, 0xB7, 0xAD, 0x84, 0x99, 0xF2, 0xD9, 0x97, 0x2B, 0x71, 0xC8, 0xA7,
+	0x5B, 0x68, 0xDB, 0x66, 0xB1, 0xD8, 0xB7, 0x36, 0x92, 0xB3, 0xD8, 0x0D, 0xD8, 0x28, 0x7E, 0xE9,
+	0xE5, 0x0A, 0x47, 0xBB, 0x12, 0xBD, 0xC5, 0x06, 0x3B, 0xEE, 0x21, 0x21, 0x0A, 0xB9, 0xF9, 0x44,
+	0x2E, 0xFB, 0xCC, 0x27, 0x39, 0x14, 0x12, 0x4D, 0xE0, 0x53, 0xCB, 0xBC, 0x90, 0x5B, 0x3F, 0xAC,
+	0x91, 0x64, 0x15, 0x08, 0x1D, 0xF8, 0xF3, 0x8B, 0x44, 0x1B, 0xCB, 0x0E, 0x09, 0x50, 0x8B, 0x9C,
+	0x88, 0x88, 0x71, 0xBD, 0x6B, 0xE4, 0x13, 0xBB, 0x19, 0x42, 0xFC, 0xC3, 0x44, 0x2F, 0xEA, 0x11,
+	0x59, 0xB2, 0x70, 0x1F, 0xB4, 0x36, 0x4E, 0xB2, 0x35, 0xDB, 0x8C, 0x05, 0x66, 0xBD, 0x90, 0x8F,
+	0x3E, 0x36, 0x4A, 0x1D, 0x4A, 0xF3, 0xE2, 0x18, 0x54, 0xCB, 0xC6, 0x4F, 0xE6, 0x41, 0x42, 0x2F,
+	0xFA, 0xA7, 0x18, 0x81, 0xFF, 0x09, 0x50, 0x2B, 0xFE, 0xAC, 0xB7, 0x89, 0x50, 0x14, 0x2D, 0x12,
+	0x12, 0xBB, 0xE8, 0x1D, 0x92, 0xFE, 0xBC, 0xA1, 0x40, 0x81, 0x15, 0x04, 0x52, 0x6E, 0xDB, 0xAE,
+	0x7C, 0xC9, 0x84, 0x61, 0x4A, 0xDB, 0xC8, 0x78, 0xFD, 0xAE, 0x0A, 0x05, 0x91, 0x16, 0x10, 0xA1,
+	0x3F, 0xBB, 0xE3, 0x8C, 0x45, 0x05, 0x0D, 0xE6, 0x87, 0x0E, 0xDC, 0xB5, 0xA1, 0xB7, 0x23, 0x67,
+	0x18, 0x86, 0x2B, 0xCE, 0x3E, 0x4D, 0x10, 0x11, 0xDB, 0xCE, 0x2C, 0x1E, 0x20, 0x6D, 0x6C, 0x3B,
+	0x6C, 0x9F, 0x6A, 0x13, 0x59, 0x09, 0xD6, 0x2B, 0xC3, 0xA1, 0xF2, 0x72, 0xEB, 0xFC, 0x96, 0x61,
+	0x66, 0x52, 0x98, 0xF3, 0xEE, 0x34, 0x82, 0xB1, 0xE3, 0xF1, 0x93, 0x48, 0xD3, 0x81, 0x2D, 0x11,
+	0xE6, 0xEF, 0x8C, 0xA5, 0x4D, 0x82, 0xB6, 0x08, 0x50, 0xB7, 0x8E, 0xFB, 0x18, 0x1C, 0x95, 0x43,
+	0xCC, 0x3E, 0x24, 0x1F, 0x39, 0xE1, 0x59, 0x28, 0x7B, 0x14, 0xBB, 0xBE, 0xC1, 0x24, 0x5C, 0x4A,
+	0xF2, 0xEE, 0xEE, 0x27, 0x11, 0x44, 0x11, 0x22, 0xDA, 0x17, 0xEE, 0x3B, 0x49, 0x92, 0x41, 0xB8,
+	0xB9, 0x0A, 0xDE, 0x02, 0x13, 0x78, 0xC9, 0x0D, 0x01, 0xFD, 0xA3, 0x6C, 0xC8, 0xD8, 0x54, 0x35,
+	0x3B, 0x38, 0xE2, 0x52, 0x6B, 0x5E, 0x11, 0x5C, 0x2C, 0x09, 0x2E, 0xBF, 0xF9, 0x33, 0x19, 0x08,
+	0x56, 0xFA, 0xE1, 0x9C, 0x6B, 0x21, 0x51, 0x2D, 0x58, 0xB7, 0xAB, 0xEB, 0x1C, 0x2D, 0x41, 0x6C,
+	0xC9, 0xD8, 0x9B, 0x69, 0x36, 0x37, 0x3A, 0x59, 0x3A, 0x37, 0x24, 0xFA, 0x53, 0x1B, 0x70, 0xB0,
+	0x11, 0x62, 0x2A, 0xD2, 0x2F, 0xFB, 0x68, 0xC9, 0x3D, 0x07, 0x68, 0xCD, 0x64, 0xAB, 0xF2, 0x20,
+	0x5F, 0x91, 0xE6, 0x12, 0x7D, 0x83, 0x87, 0x8F, 0x7C, 0x24, 0x64, 0x05, 0x33, 0xB2, 0x3B, 0xEB,
+	0xE8, 0x55, 0x8D, 0x63, 0x0C, 0x32, 0xEB, 0x78, 0xB5, 0x8D, 0x4A, 0x79, 0xCB, 0x0E, 0x2B, 0xE7,
+	0x11, 0x21, 0xD3, 0xA4, 0x5E, 0x3C, 0x4C, 0x34, 0xE7, 0x3C, 0x10, 0x86, 0xB8, 0xBF, 0xE3, 0x35,
+	0x0C, 0x6B, 0xB9, 0x21, 0x79, 0x33, 0x11, 0x11, 0x5E, 0x28, 0xEB, 0xEB, 0xF2, 0xE1, 0x40, 0x1D,
+	0x37, 0x23, 0x1D, 0xB9, 0x0A, 0x22, 0x5B, 0xE3, 0xC5, 0x62, 0xBC, 0xF4, 0xAD, 0x0C, 0x7D, 0xA4,
+	0xC2, 0x36, 0x50, 0xAF, 0xEF, 0x9E, 0x60, 0x01, 0x2B, 0x58, 0x2E, 0x10, 0xAE, 0xB4, 0xAE, 0x72,
+	0xB8, 0x84, 0x25, 0x72, 0x24, 0xD2, 0x88, 0x8B, 0x86, 0xD3, 0xAE, 0x2B, 0x72, 0x88, 0x42, 0x07,
+	0x05, 0xD8, 0x88, 0x4E, 0x88, 0xAB, 0x4A, 0xD3, 0xAB, 0x13, 0xD2, 0xB8, 0x81, 0x95, 0xAB, 0xF1,
+	0xCC, 0x49, 0xC8, 0xB5, 0x87, 0x3B, 0x24, 0x94, 0xAB, 0x88, 0xBE, 0x67, 0x4C, 0x31, 0x38, 0x81,
+	0xD8, 0xB4, 0xE3, 0xDE, 0x62, 0x07, 0x60, 0x88, 0x4E, 0x8D, 0x62, 0xDB, 0x21, 0x2B, 0xC0, 0xBA,
+	0x2D, 0x87, 0x68, 0x45, 0x31, 0xF2, 0x85, 0xC9, 0xB4, 0x9C, 0xAE, 0xB6, 0xC8, 0xB7, 0x02, 0x21,
+	0xDA, 0x72, 0x69, 0x10, 0x87, 0x2B, 0xAE, 0x22, 0x22, 0x22, 0x20, 0x44, 0x22, 0x22, 0x2A, 0xE0,
+	0x81, 0xE1, 0xC9, 0xBD, 0x87, 0x68, 0x70, 0xFA, 0x76, 0x31, 0x38, 0x79, 0x30, 0xC4, 0x81, 0x3D,
+	0xA3, 0xD2, 0x11, 0xE3, 0xA2, 0xB8, 0x88, 0x84, 0xD8, 0x88, 0x88, 0x88, 0x81, 0xED, 0x84, 0x3D,
+	0x2B, 0xAB, 0x82, 0xAD, 0x22, 0x04, 0x4B, 0x69, 0xE2, 0x2D, 0xB4, 0xA2, 0xE1, 0xE2, 0x20, 0x41,
+	0x22, 0x22, 0xBC, 0xC8, 0x84, 0x21, 0x3A, 0x20, 0x72, 0x4B, 0xA2, 0xB4, 0xAD, 0x24, 0x2E, 0x2B,
+	0x88, 0x88, 0x88, 0x81, 0x22, 0x22, 0x06, 0xE2, 0x2B, 0x48, 0x88, 0x8B, 0x62, 0x22, 0x22, 0x22,
+	0x20, 0x48, 0x88, 0xBA, 0x22, 0x2B, 0x8B, 0x60, 0x42, 0x20, 0x78, 0x8B, 0x62, 0x07, 0x82, 0xB8,
+	0x88, 0x81, 0x21, 0x2B, 0x82, 0xAD, 0x1C, 0x87, 0x89, 0xCC, 0xC7, 0x61, 0xE1, 0xDB, 0x60, 0xC3,
+	0x02, 0xE8, 0x88, 0x1E, 0x0A, 0xB4, 0xE1, 0xC3, 0x70, 0x01, 0x2D, 0x8B, 0x9C, 0x88, 0x8B, 0xA2,
+	0xD8, 0x81, 0x22, 0x06, 0xCA, 0x22, 0x22, 0x07, 0x63, 0x8B, 0x6D, 0xA6, 0xC7, 0x00, 0x88, 0xAD,
+	0x28, 0x88, 0x8B, 0x60, 0x88, 0x8A, 0xB4, 0xBA, 0x10, 0x81, 0xB1, 0xDC, 0x32, 0x22, 0x22, 0xB8,
+	0x84, 0x07, 0x9A, 0x87, 0x22, 0x22, 0xE7, 0x20, 0x79, 0xC6, 0x08, 0x88, 0x88, 0x76, 0xA2, 0x22,
+	0x22, 0x2B, 0x13, 0xD2, 0x88, 0x81, 0xB4, 0xDB, 0x22, 0x8B, 0x62, 0xE1, 0x08, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x8A, 0xE0, 0x48, 0x88, 0x88, 0x88, 0x88, 0x4C, 0xE2, 0x2B, 0x1D, 0x82, 0x88,
+	0x88, 0x88, 0x88, 0x1E, 0x08, 0xAE, 0x21, 0xDA, 0x48, 0x88, 0x88, 0x72, 0x1E, 0x08, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAD, 0x28, 0x87, 0x72, 0x1A, 0x36, 0xB7,
+	0x02, 0xE1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x36, 0x28, 0x72, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB7, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0xD2, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x27, 0x22, 0x1C, 0xA2,
+	0x22, 0x22, 0x22, 0x21, 0xBE, 0x05, 0xB6, 0x2B, 0x81, 0xD3, 0xD8, 0x97, 0x29, 0x2E, 0x21, 0x3A,
+	0x1B, 0xDC, 0x88, 0x10, 0x1F, 0x09, 0x78, 0x22, 0xE4, 0xDE, 0x4C, 0x07, 0x1E, 0x08, 0x83, 0x67,
+	0x0C, 0xAB, 0x48, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x37
 };
 
+/* 3-bit ADPCM, SNR 11.8 dB */
 const u8 sfx_shotgun_cock[] __attribute__((aligned(4))) = {
-	0x69, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x79, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x88, 0x78, 0x89, 0x88, 0x88, 0x98, 0x87, 0x88, 0x78, 0x78, 0x88, 0x98, 0x88,
-	0x97, 0x99, 0x6A, 0x89, 0x88, 0x99, 0x78, 0x88, 0x98, 0x88, 0x88, 0x89, 0x88, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x79, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x88, 0x88, 0x89,
-	0x89, 0x87, 0x87, 0x98, 0x78, 0x79, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x87, 0x77, 0x77, 0x99, 0x78, 0x88, 0x88, 0x87, 0x87, 0x87, 0x89, 0x96, 0x89, 0x88, 0x89,
-	0x98, 0x98, 0x99, 0x99, 0x88, 0x88, 0x99, 0x88, 0x88, 0x98, 0x88, 0x87, 0x67, 0x77, 0x77, 0x78,
-	0x89, 0x8A
+	0xEE, 0x90, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x80, 0x77,
+	0x44, 0x02, 0x08, 0x20, 0xEE, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x47,
+	0x84, 0x9D, 0x08, 0x20, 0x82, 0x78, 0x18, 0xE4, 0x3C, 0x20, 0x78, 0x62, 0x31, 0xCA, 0x05, 0x84,
+	0x5D, 0x4C, 0xE8, 0x80, 0xDE, 0x60, 0x78, 0x41, 0x03, 0xC0, 0xE1, 0x20, 0x82, 0x08, 0x20, 0x83,
+	0xB9, 0x04, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x27, 0x50, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x93, 0xA1, 0x3B, 0x92, 0x01, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x00, 0xEE, 0x88, 0x02, 0xCB, 0x55, 0x5D, 0xAA, 0xBA, 0x20, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xA8, 0xAC, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x4E, 0xA0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x27, 0x42, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x63, 0xD8, 0x2B, 0x73,
+	0x98, 0x04, 0x9D, 0x63, 0x52, 0xBC, 0xAB, 0x02, 0x99, 0x52, 0x20, 0xF0, 0x46, 0x38, 0x81, 0xE8,
+	0x27, 0xC4, 0x08, 0x23, 0x0F, 0x30, 0x00
 };
 
+/* 2-bit ADPCM, SNR 14.6 dB */
 const u8 sfx_item_up[] __attribute__((aligned(4))) = {
-	0x69, 0x89, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x78, 0x88, 0x88, 0x88, 0x87, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x87, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x87, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x87,
-	0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x87, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x78, 0x58
+	0xD1, 0xCC, 0x20, 0x8A, 0xD6, 0xA2, 0x22, 0x2E, 0x12, 0x22, 0xB5, 0xA8, 0x88, 0x8B, 0x84, 0x88,
+	0xAD, 0x4E, 0x22, 0x22, 0xE1, 0x22, 0x2B, 0x5A, 0x88, 0x88, 0xB8, 0x48, 0x88, 0x84, 0xE8, 0x88,
+	0xAE, 0x10, 0x88, 0xB5, 0xA8, 0x88, 0xAB, 0x96, 0x22, 0x20, 0x6C, 0xA2, 0x22, 0xE1, 0x22, 0x2B,
+	0x53, 0x88, 0x88, 0xB8, 0x48, 0x8A, 0xD6, 0xA2, 0x22, 0x2E, 0x12, 0x22, 0x21, 0x3A, 0x22, 0x2B,
+	0x84, 0x22, 0x2D, 0x6A, 0x22, 0x2A, 0xE5, 0x88, 0x88, 0x1B, 0x28, 0x88, 0xB8, 0x48, 0x8A, 0xD4,
+	0xE2, 0x22, 0x2E, 0x12, 0x22, 0x21, 0x3A, 0x22, 0x2B, 0x84, 0x22, 0x20, 0x6E, 0x08, 0x8A, 0xE1,
+	0x08, 0x88, 0x1B, 0x88, 0x88, 0xB8, 0x48, 0x88, 0x84, 0xE8, 0x88, 0xAE, 0x10, 0x88, 0x81, 0xB2,
+	0x88, 0x8B, 0x84, 0x88, 0x88, 0x4E, 0x88, 0x8A, 0xE1, 0x08, 0x88, 0x1B, 0x28, 0x88, 0xB8, 0x48,
+	0x88, 0x84, 0xE8, 0x88, 0xAE, 0x10, 0x88, 0x81, 0xB2, 0x88, 0x8B, 0x84, 0x88, 0x88, 0x4E, 0x88,
+	0x8A, 0xE1, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x8A, 0xC4, 0x88, 0x88, 0xAB, 0x96, 0x22, 0x20, 0x6C, 0xA2, 0x22, 0xE1, 0x22, 0x22, 0x13, 0xA2,
+	0x22, 0xB8, 0x42, 0x22, 0x06, 0xCA, 0x22, 0x2E, 0x42, 0x22, 0x21, 0x3A, 0x22, 0x2B, 0x12, 0x22,
+	0xB4, 0x78, 0x22, 0x22, 0xE4, 0x22, 0x2D, 0x6A, 0x88, 0x88, 0xB9, 0xDD
 };
 
+/* 2-bit ADPCM, SNR 13.7 dB */
 const u8 sfx_player_umf[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x78, 0x98,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x89, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x79, 0x87, 0x88, 0x78, 0x98, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x98, 0x78, 0x87, 0x89, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x79, 0x97, 0x88, 0x78, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x77, 0x79, 0x87, 0x88, 0x88, 0x98, 0x88, 0x88, 0x87, 0x77, 0x78,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x87, 0x88, 0x88, 0x99, 0x88, 0x88, 0x77,
-	0x77, 0x78, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x87, 0x76, 0x78, 0x87, 0x89, 0x99, 0x99, 0x88,
-	0x88, 0x87, 0x77, 0x67, 0x88, 0x89, 0x99, 0xA9, 0x88, 0x88, 0x77, 0x77, 0x66, 0x88, 0x89, 0x89,
-	0x99, 0x98, 0x78, 0x87, 0x77, 0x76, 0x68, 0x88, 0x9A, 0xAA, 0xB8, 0x88, 0x87, 0x77, 0x75, 0x68,
-	0x88, 0x99, 0x89, 0x89, 0x98, 0x88, 0x77, 0x86, 0x66, 0x78, 0x88, 0x99, 0xAB, 0xB9, 0x88, 0x87,
-	0x77, 0x66, 0x57, 0x88, 0x99, 0x89, 0x99, 0x99, 0x88, 0x78, 0x77, 0x76, 0x57, 0x88, 0x88, 0x9A,
-	0x9A, 0xBA, 0x88, 0x88, 0x77, 0x76, 0x56, 0x77, 0x89, 0x9A, 0x99, 0xBA, 0x98, 0x88, 0x76, 0x66,
-	0x56, 0x87, 0x88, 0x9A, 0x99, 0xAB, 0x98, 0x98, 0x76, 0x66, 0x56, 0x77, 0x78, 0x9A, 0xAA, 0xAA,
-	0x99, 0x98, 0x76, 0x65, 0x56, 0x77, 0x78, 0x99, 0xA9, 0x9B, 0xAA, 0x98, 0x87, 0x66, 0x66, 0x67,
-	0x78, 0x88, 0x99, 0xAA, 0xAA, 0x99, 0x88, 0x76, 0x56, 0x66, 0x77, 0x88, 0x89, 0x99, 0xAA, 0xA9,
-	0x88, 0x86, 0x66, 0x66, 0x77, 0x78, 0x89, 0xA9, 0x9A, 0xA9, 0x98, 0x87, 0x66, 0x65, 0x66, 0x77,
-	0x78, 0x98, 0x9A, 0xAA, 0xA9, 0x99, 0x88, 0x76, 0x66, 0x67, 0x77, 0x88, 0x99, 0xAA, 0x9A, 0xA9,
-	0x98, 0x88, 0x66, 0x65, 0x56, 0x77, 0x78, 0x99, 0x99, 0x9A, 0xA9, 0x99, 0x88, 0x76, 0x66, 0x66,
-	0x77, 0x78, 0x89, 0x99, 0xAA, 0xAB, 0xA9, 0x98, 0x87, 0x66, 0x66, 0x67, 0x77, 0x88, 0x89, 0x99,
-	0x9A, 0xA9, 0x99, 0x88, 0x87, 0x76, 0x66, 0x67, 0x77, 0x88, 0x89, 0x89, 0x99, 0x99, 0x98, 0x88,
-	0x87, 0x77, 0x66, 0x67, 0x77, 0x88, 0x88, 0x99, 0x99, 0xAA, 0x99, 0x98, 0x88, 0x87, 0x67, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0xAA, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x66, 0x66, 0x77, 0x77, 0x88, 0x88, 0x99, 0x99,
-	0x99, 0xA9, 0x99, 0x98, 0x88, 0x76, 0x66, 0x76, 0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
-	0x98, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x77, 0x76, 0x66, 0x67, 0x77, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x95
+	0xD0, 0xA2, 0xB4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x22, 0x22, 0xB5, 0xA8, 0x88, 0x88, 0x88,
+	0x88, 0x81, 0xE2, 0x22, 0xB5, 0xB0, 0x88, 0x88, 0x8A, 0xD2, 0x22, 0x22, 0x22, 0xB5, 0xE6, 0x22,
+	0x22, 0x22, 0x22, 0x07, 0x82, 0x22, 0xB5, 0xA8, 0x88, 0x88, 0x8B, 0x62, 0x13, 0xA2, 0x22, 0xD7,
+	0x98, 0x88, 0x88, 0x88, 0x88, 0x4E, 0x88, 0x8B, 0x5C, 0xB6, 0x22, 0x22, 0xB4, 0x81, 0xE2, 0x22,
+	0xB5, 0xB2, 0xD6, 0xA2, 0x22, 0xD8, 0x07, 0x88, 0x8A, 0xD6, 0xCB, 0x4A, 0x08, 0xAE, 0x40, 0x1B,
+	0x88, 0x8B, 0x17, 0x2D, 0x9A, 0x28, 0xAD, 0x22, 0x1C, 0x88, 0xAF, 0x5B, 0x02, 0x72, 0x2B, 0x81,
+	0x20, 0x6E, 0x0A, 0xB9, 0x5E, 0x62, 0x4E, 0x3C, 0x81, 0x21, 0x0B, 0xA2, 0xBB, 0x5A, 0x58, 0x2E,
+	0x8B, 0xAD, 0x61, 0x07, 0xE2, 0xE2, 0xC5, 0x1D, 0x8B, 0xC3, 0x8B, 0x14, 0x53, 0x78, 0xB8, 0xF4,
+	0x06, 0xD9, 0xB2, 0xF7, 0x21, 0x01, 0x5B, 0xCB, 0x8E, 0xD4, 0x0C, 0x0A, 0xED, 0xE3, 0xD0, 0x05,
+	0xD3, 0xAA, 0xEB, 0xD0, 0x50, 0xC6, 0xF8, 0xF8, 0xD6, 0x64, 0xA5, 0xE3, 0xE8, 0xD0, 0x15, 0x0A,
+	0xEB, 0xFB, 0x04, 0x15, 0x31, 0xAF, 0x3C, 0x89, 0x40, 0x44, 0x2E, 0xFE, 0xC0, 0x44, 0x10, 0x4B,
+	0xEF, 0x88, 0x41, 0x53, 0x1B, 0x3B, 0xAB, 0x44, 0xD6, 0x12, 0xBA, 0xFE, 0x81, 0x04, 0x56, 0xDA,
+	0xB3, 0xEB, 0x16, 0x14, 0x81, 0xB3, 0xEF, 0x28, 0x41, 0x40, 0x41, 0xFA, 0xBE, 0x81, 0x94, 0x90,
+	0x1B, 0x3C, 0xBF, 0x21, 0x04, 0x1D, 0x28, 0xBA, 0xBA, 0xE1, 0x04, 0x04, 0x84, 0xEB, 0xAB, 0xC0,
+	0x88, 0x40, 0x48, 0x4F, 0xAA, 0xE2, 0x22, 0x10, 0x81, 0x22, 0x2E, 0xBA, 0xE8, 0x40, 0x48, 0x42,
+	0x07, 0x8B, 0xAF, 0x87, 0x60, 0x48, 0x42, 0x22, 0xB8, 0xBA, 0x22, 0x21, 0x01, 0x22, 0x22, 0xB8,
+	0xAE, 0xB8, 0x12, 0x10, 0x12, 0x22, 0x22, 0xB8, 0xBA, 0x22, 0x20, 0x48, 0x12, 0x22, 0x2B, 0x8B,
+	0xA2, 0x22, 0x21, 0x08, 0x12, 0x22, 0x22, 0xEA, 0xDC, 0xA2, 0x22, 0x04, 0x81, 0x22, 0x22, 0x2E,
+	0x8B, 0xA2, 0x22, 0x20, 0x48, 0x84, 0x22, 0x22, 0x2E, 0x8B, 0xA2, 0x22, 0x20, 0x48, 0x84, 0x22,
+	0x22, 0x22, 0xE8, 0xAE, 0x22, 0x22, 0x10, 0x88, 0x81, 0x22, 0xB4, 0xE8, 0x88, 0xAE, 0x22, 0x22,
+	0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xA2, 0x20, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0xAE, 0x20, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xD2,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xF0
 };
 
+/* 3-bit ADPCM, SNR 11.8 dB */
 const u8 sfx_player_pain[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x98, 0x88, 0x88, 0x88, 0x77, 0x79, 0x87, 0x98, 0x78, 0x87, 0x98, 0x78, 0x87, 0x98,
-	0x79, 0x87, 0x88, 0x79, 0x87, 0x88, 0x97, 0x89, 0x78, 0x88, 0x89, 0x78, 0x87, 0x98, 0x79, 0x87,
-	0x88, 0x79, 0x87, 0x87, 0x98, 0x89, 0x78, 0x88, 0x79, 0x87, 0x86, 0x9A, 0x6B, 0x87, 0x89, 0x68,
-	0x97, 0x88, 0x78, 0x88, 0x88, 0x87, 0x87, 0x77, 0x8B, 0x78, 0xA6, 0x79, 0x77, 0xB7, 0x89, 0x76,
-	0x86, 0xAA, 0x5B, 0x86, 0x89, 0x79, 0x96, 0x99, 0x68, 0x8A, 0x69, 0xA5, 0x99, 0x77, 0xA6, 0x88,
-	0x88, 0x98, 0x77, 0x7B, 0x69, 0xA7, 0x89, 0x87, 0x96, 0x87, 0x78, 0x97, 0x6B, 0x94, 0xD6, 0x78,
-	0xA5, 0xB8, 0x69, 0x76, 0x88, 0x6A, 0x86, 0x78, 0xC6, 0xE8, 0x68, 0x86, 0xAB, 0x69, 0x66, 0x69,
-	0x7A, 0x98, 0x79, 0x98, 0x99, 0x88, 0x87, 0x99, 0x87, 0x64, 0x75, 0x9B, 0x97, 0xAB, 0x4A, 0x77,
-	0x8A, 0x89, 0x87, 0x86, 0x78, 0x78, 0x98, 0x84, 0xAA, 0x6A, 0x96, 0x88, 0x6A, 0xA7, 0x87, 0x56,
-	0x79, 0x89, 0x79, 0xA6, 0xA8, 0x78, 0x88, 0x99, 0xA8, 0x76, 0x67, 0x68, 0x97, 0x89, 0xA8, 0x98,
-	0x87, 0x88, 0x99, 0x88, 0x77, 0x77, 0x78, 0x77, 0x5B, 0xA8, 0xB8, 0x78, 0x86, 0xA9, 0x6A, 0xA7,
-	0x99, 0x57, 0x65, 0xA9, 0x9A, 0x87, 0x77, 0x78, 0xA8, 0x97, 0x44, 0xA6, 0xBB, 0x89, 0x85, 0x89,
-	0x7A, 0x97, 0x97, 0x78, 0x89, 0x87, 0x77, 0x78, 0x87, 0x77, 0x8B, 0x99, 0x97, 0x88, 0x88, 0x99,
-	0x87, 0x87, 0x57, 0xA7, 0x79, 0x88, 0x98, 0x99, 0x88, 0x87, 0x88, 0x78, 0x87, 0x98, 0x68, 0x89,
-	0x87, 0x68, 0x67, 0xB9, 0xAA, 0x87, 0x97, 0x89, 0x89, 0xA5, 0x89, 0x38, 0x87, 0x89, 0x8A, 0x88,
-	0x87, 0x88, 0x99, 0x98, 0x87, 0x76, 0x77, 0x8A, 0x76, 0xA8, 0x59, 0x98, 0xA9, 0x88, 0x87, 0x88,
-	0x79, 0x87, 0x88, 0x87, 0x47, 0x94, 0x86, 0xCB, 0x8A, 0xA6, 0x99, 0x8A, 0x97, 0x97, 0x78, 0x68,
-	0x97, 0x97, 0x79, 0x85, 0x88, 0x79, 0x9A, 0x97, 0x87, 0x69, 0x98, 0xAA, 0x86, 0x53, 0x56, 0x79,
-	0x98, 0x89, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x89, 0x84, 0x56, 0x46, 0xA8, 0x9A, 0x87, 0x79, 0xB7,
-	0x88, 0x78, 0x99, 0x87, 0x78, 0x68, 0x88, 0xDA, 0x68, 0x35, 0x55, 0x78, 0x77, 0x98, 0xAA, 0xBA,
-	0xA9, 0x9A, 0x9A, 0x98, 0x9A, 0x66, 0x42, 0x45, 0x7A, 0x98, 0x97, 0xAB, 0x7C, 0x6A, 0x77, 0x77,
-	0x68, 0x77, 0x96, 0x88, 0xAA, 0xA8, 0x75, 0x56, 0x98, 0x76, 0x58, 0x88, 0xA7, 0x7A, 0x7A, 0xA7,
-	0xAA, 0x7A, 0x68, 0xB7, 0xCD, 0x78, 0x64, 0x65, 0x97, 0x77, 0x76, 0x57, 0x7A, 0x6B, 0x68, 0xAA,
-	0x79, 0xAA, 0x8B, 0x97, 0xBA, 0x99, 0x44, 0x35, 0x78, 0x86, 0xB8, 0x69, 0x9C, 0xD7, 0xA6, 0x5A,
-	0x55, 0x76, 0x88, 0x86, 0x67, 0x99, 0x9A, 0x8C, 0xD8, 0x96, 0x47, 0x47, 0x64, 0x87, 0x69, 0x69,
-	0x88, 0xAB, 0xB9, 0x9B, 0x7B, 0x97, 0xA8, 0x89, 0x98, 0x98, 0x78, 0x67, 0x76, 0x76, 0x96, 0x89,
-	0x59, 0x76, 0x87, 0xB6, 0x78, 0x87, 0x97, 0xA7, 0x8B, 0x78, 0x98, 0x9B, 0x8B, 0xB6, 0x96, 0x57,
-	0x66, 0x75, 0x88, 0x68, 0x69, 0x98, 0x88, 0x99, 0x9B, 0x98, 0xB9, 0x7A, 0x79, 0x96, 0x99, 0x6A,
-	0xA6, 0x97, 0x56, 0x66, 0x77, 0x86, 0x79, 0x58, 0x76, 0xA8, 0x88, 0x76, 0x8A, 0x99, 0x88, 0xA8,
-	0x9C, 0x78, 0xBA, 0xB9, 0x76, 0x55, 0x65, 0x66, 0x67, 0x77, 0x86, 0x97, 0x8A, 0x9A, 0x9A, 0x8B,
-	0xA9, 0x99, 0x98, 0x97, 0x98, 0x77, 0x64, 0x67, 0x8A, 0x76, 0x8A, 0xAB, 0x77, 0x66, 0x87, 0x78,
-	0x87, 0x89, 0x68, 0x87, 0xB8, 0x89, 0x78, 0xB8, 0x8A, 0x7C, 0xA8, 0xA6, 0x68, 0x66, 0x84, 0x67,
-	0x58, 0x86, 0x98, 0x9B, 0x79, 0xA8, 0xCB, 0x9C, 0xA8, 0xA8, 0x78, 0x8A, 0xA8, 0x75, 0x35, 0x45,
-	0x75, 0x76, 0x79, 0x89, 0x9A, 0xB5, 0xCC, 0x8A, 0x85, 0x87, 0x68, 0x88, 0x97, 0x88, 0x79, 0x88,
-	0x99, 0x89, 0xA9, 0x86, 0x56, 0x66, 0x86, 0x6A, 0x77, 0x86, 0x89, 0xB9, 0x8A, 0x48, 0xD4, 0x89,
-	0x7A, 0xBA, 0x98, 0x89, 0x79, 0x97, 0x8B, 0x89, 0x76, 0x76, 0x68, 0x77, 0x86, 0x77, 0x77, 0x76,
-	0x77, 0x99, 0x79, 0x87, 0xA7, 0x9C, 0xAA, 0xB9, 0x8A, 0x99, 0xA9, 0x98, 0x66, 0x64, 0x65, 0x57,
-	0x55, 0x7A, 0x69, 0x68, 0xC6, 0x7C, 0x8A, 0xB7, 0x88, 0x78, 0x79, 0xA9, 0x76, 0x89, 0x98, 0x88,
-	0x89, 0x98, 0x96, 0x67, 0x66, 0x96, 0x87, 0x77, 0x77, 0x78, 0x88, 0x98, 0x88, 0x88, 0x98, 0x89,
-	0x79, 0xB6, 0x78, 0x77, 0xAA, 0x99, 0x98, 0x88, 0x87, 0x99, 0x9A, 0x88, 0x76, 0x77, 0x77, 0x76,
-	0x77, 0x87, 0x77, 0x68, 0x87, 0x88, 0x78, 0x8B, 0x97, 0xB7, 0x8C, 0x88, 0xA8, 0x89, 0x89, 0x98,
-	0x9A, 0x9A, 0x97, 0x86, 0x77, 0x66, 0x76, 0x77, 0x67, 0x67, 0x87, 0x89, 0x79, 0x89, 0x98, 0x77,
-	0xA9, 0x77, 0xA7, 0x99, 0x7A, 0x77, 0xA8, 0x6A, 0x77, 0x88, 0x79, 0x89, 0x89, 0x77, 0x87, 0x78,
-	0x97, 0x78, 0x78, 0x87, 0x89, 0x6A, 0x77, 0xA7, 0x7A, 0x68, 0x98, 0x97, 0x9A, 0x8A, 0x97, 0x98,
-	0x9A, 0x88, 0x87, 0x67, 0x88, 0x77, 0x78, 0x87, 0x88, 0x88, 0x79, 0x97, 0x88, 0xA7, 0x88, 0x87,
-	0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x87, 0x98, 0x88, 0x9A, 0x79, 0x88, 0x97,
-	0x79, 0x88, 0x98, 0x88, 0x87, 0x78, 0x96, 0x88, 0x78, 0x77, 0x98, 0x88, 0x68, 0x98, 0x88, 0x88,
-	0x87, 0x87, 0x89, 0x88, 0x87, 0x88, 0x88, 0x78, 0x98, 0x98, 0x79, 0x88, 0x98, 0x78, 0x78, 0x97,
-	0x89, 0x88, 0x98, 0x98, 0x88, 0x88, 0x8A, 0x78, 0x86, 0xA7, 0x89, 0x78, 0x97, 0x88, 0x79, 0x78,
-	0x87, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
-	0x88, 0x88, 0x87, 0x99, 0x79, 0x87, 0x98, 0x8A, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x89, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x87, 0x87, 0x79, 0x88, 0x97, 0x79, 0x86, 0x99, 0x89, 0x87, 0x88, 0x89, 0x87, 0x97,
-	0x79, 0x87, 0x98, 0x88, 0x88, 0x97, 0x79, 0x88, 0x98, 0x78, 0x89, 0x89, 0x78, 0x88, 0x88, 0x89,
-	0x88, 0x96, 0x79, 0x88, 0x97, 0x88, 0x78, 0x98, 0x89, 0x78, 0x87, 0x99, 0x89, 0x86, 0x88, 0x78,
-	0x97, 0x99, 0x67, 0x98, 0x89, 0x88, 0x78, 0x88, 0x88, 0x78, 0x78, 0x88, 0x88, 0x88, 0x87, 0x89,
-	0x77, 0x96, 0x9A, 0x68, 0x79, 0x89, 0x88, 0x78, 0x97, 0xA7, 0x79, 0x79, 0x87, 0x97, 0x79, 0x88,
-	0x87, 0x78, 0x88, 0xA7, 0x77, 0x88, 0x89, 0x86, 0x89, 0x7A, 0x87, 0x89, 0x97, 0x88, 0x97, 0x77,
-	0x88, 0x98, 0x97, 0x87, 0x89, 0x99, 0x87, 0x78, 0x98, 0x97, 0x78, 0x78, 0x98, 0x79, 0x77, 0x88,
-	0x89, 0x87, 0x78, 0x98, 0x88, 0x87, 0x99, 0x77, 0x78, 0x8A, 0x98, 0x68, 0x98, 0x89, 0x78, 0xA6,
-	0x98, 0x68, 0x98, 0x87, 0x78, 0x97, 0x99, 0x78, 0x86, 0x9A, 0x78, 0x86, 0x98, 0x89, 0x87, 0x98,
-	0x69, 0x96, 0x89, 0x79, 0x75, 0xA8, 0x89, 0x86, 0x89, 0x88, 0x98, 0x77, 0x89, 0x78, 0x96, 0x79,
-	0x96, 0x98, 0x69, 0x78, 0x97, 0x98, 0x79, 0x77, 0x88, 0x8A, 0x77, 0x88, 0x99, 0x98, 0x76, 0x89,
-	0x78, 0x96, 0x88, 0x88, 0x79, 0x87, 0x78, 0x87, 0x98, 0x88, 0x86, 0x89, 0x89, 0x87, 0x68, 0x98,
-	0x97, 0x77, 0x89, 0x89, 0x87, 0x78, 0x88, 0x7A, 0x77, 0x78, 0x98, 0x89, 0x86, 0x98, 0x6A, 0x87,
-	0x97, 0x79, 0x78, 0x97, 0x79, 0x78, 0xA8, 0x79, 0x76, 0x78, 0xA9, 0x78, 0x68, 0x98, 0x87, 0x79,
-	0x79, 0x97, 0x78, 0x69, 0x97, 0x87, 0x79, 0x87, 0x98, 0x78, 0x89, 0x98, 0x78, 0x69, 0x97, 0x98,
-	0x79, 0x77, 0xA7, 0x79, 0x88, 0x87, 0x89, 0x77, 0x88, 0x98, 0x98, 0x77, 0x98, 0x88, 0x87, 0x89,
-	0x77, 0x97, 0x6A, 0x88, 0xA6, 0x78, 0x89, 0x98, 0x87, 0x79, 0x88, 0x98, 0x88, 0x78, 0x88, 0x88,
-	0x97, 0x89, 0x77, 0x99, 0x88, 0x88, 0x78, 0x87, 0x89, 0x89, 0x77, 0x87, 0x99, 0x78, 0x86, 0x79,
-	0x88, 0x97, 0x87, 0x79, 0x98, 0x87, 0x79, 0x88, 0x96, 0x88, 0x78, 0xA7, 0x89, 0x78, 0x77, 0x98,
-	0x89, 0x78, 0x87, 0x87, 0x9A
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x77, 0x24, 0x02,
+	0x4F, 0x13, 0xB9, 0xD8, 0x46, 0x76, 0xA9, 0x9C, 0xAE, 0xD5, 0x2B, 0x98, 0xC5, 0xC8, 0xC6, 0x08,
+	0xF9, 0x99, 0xCA, 0xAD, 0x43, 0x3B, 0x55, 0x74, 0x1E, 0x00, 0xCE, 0xD5, 0xD8, 0xEA, 0xC2, 0x39,
+	0x14, 0xCA, 0xA0, 0x82, 0x75, 0x84, 0x6F, 0x83, 0xC1, 0xC1, 0xE0, 0x74, 0x39, 0x8E, 0xAC, 0x22,
+	0x99, 0xD0, 0xE6, 0x2E, 0x47, 0x22, 0x85, 0xCC, 0x10, 0xDD, 0x1B, 0xE4, 0x60, 0x6D, 0x7C, 0xD0,
+	0x4F, 0x0F, 0x77, 0x40, 0x5D, 0x58, 0x65, 0x53, 0x39, 0x41, 0x7D, 0xDA, 0x46, 0x43, 0x9B, 0x03,
+	0xAA, 0x58, 0xA4, 0x33, 0x01, 0xDC, 0xB7, 0x77, 0x59, 0xB5, 0xCE, 0xA8, 0x07, 0x1B, 0x8E, 0x27,
+	0x15, 0x3F, 0x63, 0x29, 0x40, 0xAC, 0x61, 0x71, 0x2E, 0x9E, 0x87, 0x56, 0x18, 0x0C, 0x5E, 0xD8,
+	0xAB, 0x58, 0x13, 0xCD, 0x99, 0x45, 0x2C, 0xD0, 0x40, 0xF3, 0xEE, 0x43, 0xA0, 0x1D, 0xCC, 0x86,
+	0x33, 0x01, 0x98, 0x82, 0xD9, 0x03, 0x78, 0xFC, 0x1D, 0x63, 0x09, 0x50, 0xAA, 0x63, 0x62, 0x86,
+	0xE1, 0x23, 0x1C, 0x66, 0xE8, 0x9C, 0xC1, 0x10, 0xD8, 0xEC, 0x95, 0x8A, 0x43, 0x88, 0xC2, 0x72,
+	0x3A, 0x19, 0xDC, 0xA1, 0xB7, 0x2A, 0x9D, 0x33, 0xC3, 0x89, 0xAF, 0x75, 0x3A, 0x90, 0x88, 0x70,
+	0x98, 0x84, 0x27, 0x98, 0x62, 0x1B, 0xF1, 0xDC, 0x84, 0x36, 0x89, 0x94, 0xCE, 0x53, 0x17, 0xE5,
+	0x73, 0x1C, 0xAA, 0x72, 0x2A, 0x98, 0xD8, 0x7A, 0x19, 0x58, 0xEE, 0x52, 0x28, 0x6F, 0x03, 0x31,
+	0x50, 0xF6, 0x72, 0x4A, 0x16, 0x22, 0x04, 0xF0, 0x09, 0x33, 0xFC, 0x0C, 0x95, 0x23, 0x48, 0x9F,
+	0x02, 0x93, 0x35, 0x0B, 0xAA, 0x9D, 0xE7, 0x81, 0x09, 0xA1, 0xD6, 0x05, 0x1A, 0x2A, 0xB5, 0x73,
+	0xDD, 0x50, 0x4E, 0x53, 0x98, 0xEB, 0x1A, 0x20, 0xAA, 0x47, 0xC8, 0x30, 0x7B, 0xE2, 0x52, 0xCC,
+	0xC4, 0x58, 0x2C, 0x46, 0x23, 0xAC, 0x15, 0x43, 0x8B, 0x55, 0x72, 0x41, 0x6B, 0x0F, 0x3C, 0x0C,
+	0xC4, 0x0C, 0xAE, 0x72, 0x4F, 0x21, 0x44, 0x77, 0x6B, 0x88, 0x71, 0x82, 0xD0, 0xC2, 0x26, 0x85,
+	0x88, 0xFB, 0x1C, 0x5A, 0xA9, 0x99, 0xC8, 0xF1, 0x80, 0x99, 0xE3, 0xEA, 0xC3, 0x62, 0x95, 0x5C,
+	0x79, 0x95, 0xE7, 0x88, 0xEA, 0x55, 0x5E, 0x00, 0x55, 0x56, 0x0B, 0x01, 0x02, 0xCA, 0x73, 0x6A,
+	0xA0, 0xF7, 0x2A, 0xA8, 0x51, 0x0C, 0x4F, 0xC7, 0x6B, 0xC6, 0x65, 0x2B, 0x98, 0xDA, 0x60, 0x51,
+	0x70, 0xF9, 0x91, 0xC9, 0x26, 0x66, 0x4C, 0x1E, 0x2F, 0x83, 0x06, 0xD2, 0x43, 0x54, 0x08, 0x47,
+	0xDD, 0x2A, 0xAA, 0x7B, 0x94, 0x41, 0xCF, 0x52, 0xCD, 0x90, 0x2F, 0x54, 0x62, 0xF2, 0x45, 0x21,
+	0x95, 0x3E, 0x0F, 0x74, 0x0C, 0x5E, 0x8B, 0x29, 0x4E, 0x86, 0xC7, 0xC8, 0xC8, 0x65, 0x01, 0xE0,
+	0xE7, 0x2A, 0xB5, 0x5A, 0x43, 0x9A, 0xFA, 0xA9, 0x75, 0x52, 0xE9, 0x0F, 0x76, 0x28, 0xBD, 0x48,
+	0x60, 0x1C, 0x8C, 0xA4, 0x23, 0xA3, 0xAF, 0xA4, 0x07, 0xCB, 0xC0, 0x64, 0x15, 0xCB, 0x95, 0xC0,
+	0x84, 0x4B, 0x21, 0xE8, 0x72, 0xF0, 0xB0, 0x50, 0xE4, 0x5C, 0x01, 0x27, 0x71, 0x8E, 0x64, 0x7C,
+	0xBA, 0x06, 0xAA, 0x45, 0x47, 0xC2, 0x65, 0x42, 0xC1, 0x2C, 0x71, 0x7C, 0x1A, 0x47, 0x02, 0x9A,
+	0xCD, 0xF5, 0x19, 0x44, 0x0E, 0x75, 0xE0, 0xA9, 0xF3, 0x20, 0x82, 0x38, 0x1E, 0x10, 0x07, 0xA2,
+	0xE9, 0x78, 0x68, 0x62, 0x89, 0x60, 0x1D, 0x88, 0xBC, 0xB5, 0x09, 0x27, 0x40, 0xE8, 0x7B, 0x18,
+	0x8C, 0x83, 0xBD, 0xE0, 0xAC, 0x36, 0x1A, 0x86, 0x2A, 0xAD, 0xCE, 0x02, 0xC5, 0x48, 0xEB, 0x15,
+	0x4A, 0xEA, 0x01, 0xB1, 0x73, 0x85, 0x88, 0xCA, 0xC5, 0x73, 0xA0, 0x48, 0xE9, 0xA7, 0xC3, 0x82,
+	0x3E, 0x1C, 0xA5, 0x63, 0xBC, 0x16, 0x07, 0x91, 0x4E, 0x42, 0x9B, 0xD4, 0x07, 0x89, 0xAA, 0x33,
+	0x08, 0xC6, 0x22, 0x0E, 0xC7, 0x31, 0xF0, 0x25, 0x56, 0x04, 0x20, 0x82, 0x08, 0x20, 0xEE, 0x67,
+	0x44, 0x2F, 0x9B, 0x17, 0x0A, 0x83, 0x84, 0x1E, 0x25, 0xCC, 0xA7, 0x17, 0x45, 0xE8, 0xD1, 0x20,
+	0x9D, 0x62, 0xAC, 0x1D, 0x41, 0x3A, 0x38, 0xDC, 0xE4, 0x3A, 0xAC, 0x57, 0x22, 0x85, 0x4E, 0x80,
+	0x54, 0xF8, 0x1D, 0xD0, 0x79, 0x18, 0xCA, 0xF1, 0x95, 0x41, 0x07, 0x8E, 0x01, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x1E, 0x10, 0x41, 0xD8, 0xEA, 0xC5, 0x23, 0xC0, 0x51, 0x00, 0x82, 0x09, 0xD4,
+	0x10, 0x4E, 0xA0, 0x13, 0xC6, 0x24, 0xEA, 0x01, 0x04, 0x10, 0x4E, 0xA6, 0x50, 0x2C, 0x20, 0x93,
+	0xA1, 0x04, 0x10, 0x47, 0x84, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40, 0xF0, 0x9D, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xEA, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xC7, 0x48, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xEA, 0x01, 0x04, 0x13, 0xA8, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0xD1, 0xC2, 0x0E, 0xA0, 0x82, 0x08, 0x27, 0x50, 0x08, 0x20,
+	0x82, 0x3D, 0x56, 0x0E, 0x85, 0xE2, 0x99, 0x0A, 0x6D, 0x20, 0x3D, 0x5E, 0x0A, 0xD7, 0x20, 0x91,
+	0xF8, 0xE8, 0x3A, 0xA0, 0x7A, 0xE6, 0x08, 0x23, 0xD1, 0xF0, 0xA8, 0x3C, 0x0C, 0x55, 0x8B, 0x99,
+	0x98, 0xA7, 0x65, 0x20, 0x5D, 0x4C, 0x15, 0x06, 0xCA, 0x84, 0x93, 0x2C, 0xA0, 0x82, 0x09, 0xD1,
+	0xF1, 0xF4, 0x39, 0xA6, 0x1A, 0x31, 0x5D, 0xE0, 0x71, 0x95, 0x60, 0xA8, 0x94, 0x28, 0x9F, 0x90,
+	0x80, 0xB7, 0x43, 0x3B, 0x01, 0x9C, 0xC5, 0xA0, 0x21, 0x63, 0xCE, 0x2A, 0x0D, 0x81, 0x59, 0x68,
+	0x6A, 0x3A, 0xBC, 0x00, 0x07, 0x68, 0x95, 0x80, 0x76, 0x3C, 0x0A, 0x3B, 0x7A, 0x12, 0x2E, 0x1F,
+	0x32, 0x93, 0x46, 0x89, 0x75, 0x29, 0x9D, 0x8C, 0x06, 0x52, 0x19, 0x9D, 0xCE, 0x62, 0x2A, 0xBD,
+	0xC8, 0x6E, 0x42, 0x43, 0xA8, 0x4B, 0x85, 0xC1, 0x1C, 0xCC, 0xE8, 0x38, 0xCC, 0xAC, 0x20, 0x3F,
+	0x0C, 0x42, 0x7B, 0x99, 0xE4, 0x73, 0x00, 0xCE, 0xD0, 0xA6, 0x72, 0x49, 0xD1, 0xAA, 0xEC, 0xC5,
+	0x5A, 0x02, 0xA9, 0xD6, 0x38, 0xBB, 0xC2, 0x11, 0x42, 0xD9, 0xCC, 0xE5, 0x36, 0x3A, 0x0F, 0x0B,
+	0x07, 0x6A, 0xB4, 0xA5, 0x79, 0xC4, 0xD1, 0xC3, 0xCA, 0x58, 0x7B, 0x18, 0x40, 0xAD, 0x72, 0x98,
+	0xC6, 0xC7, 0xB1, 0x8C, 0xAB, 0x07, 0x81, 0xA2, 0x62, 0xB4, 0x20, 0xE5, 0xA8, 0x72, 0x09, 0xCB,
+	0xE1, 0x68, 0xE4, 0x5C, 0x00, 0x06, 0x18, 0x3A, 0x0E, 0x13, 0xA8, 0x20, 0x7C, 0x2E, 0x14, 0xA0,
+	0x4E, 0x47, 0x47, 0x1F, 0x15, 0x73, 0x19, 0xCA, 0xA0, 0xF3, 0x82, 0x16, 0x60, 0xE5, 0x7C, 0xCA,
+	0x97, 0x07, 0x09, 0x1C, 0x8B, 0x81, 0x56, 0x44, 0x00
 };
 
+/* 4-bit PCM, exact */
 const u8 sfx_player_death[] __attribute__((aligned(4))) = {
 	0x69, 0x88, 0x67, 0x89, 0x98, 0x88, 0x88, 0x88, 0x86, 0x79, 0x99, 0x87, 0x89, 0x98, 0x77, 0x76,
 	0x89, 0x98, 0x88, 0x88, 0x88, 0x86, 0x68, 0xAA, 0x87, 0x78, 0x99, 0x87, 0x86, 0x8A, 0x87, 0x88,
@@ -737,3096 +549,2020 @@ const u8 sfx_player_death[] __attribute__((aligned(4))) = {
 	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x38
 };
 
+/* 2-bit ADPCM, SNR 10.9 dB */
 const u8 sfx_possessed_sight1[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x99, 0x89, 0x88, 0x77, 0x77, 0x78, 0x88, 0x77, 0x67, 0x77, 0x78, 0x88,
-	0x89, 0x88, 0x89, 0x99, 0x99, 0x98, 0x77, 0x99, 0x99, 0x88, 0x88, 0x88, 0x97, 0x77, 0x88, 0x88,
-	0x78, 0x77, 0x88, 0x87, 0x89, 0x89, 0x99, 0x89, 0x88, 0x97, 0x88, 0x89, 0x77, 0x77, 0x77, 0x88,
-	0x87, 0x78, 0x88, 0x89, 0x88, 0x89, 0x86, 0x77, 0x98, 0x88, 0x9B, 0xA9, 0xA9, 0x88, 0x88, 0x88,
-	0x77, 0x55, 0x67, 0x77, 0x78, 0xA9, 0x99, 0x9A, 0x99, 0x99, 0x99, 0x88, 0x76, 0x77, 0x98, 0x88,
-	0x88, 0x99, 0x97, 0x78, 0x87, 0x66, 0x67, 0x75, 0x78, 0x78, 0x89, 0xA9, 0x87, 0x89, 0xAA, 0xA8,
-	0x89, 0xAB, 0x97, 0x77, 0x78, 0x98, 0x75, 0x57, 0x99, 0x87, 0x78, 0x89, 0x99, 0x88, 0x88, 0x99,
-	0xA9, 0x98, 0x88, 0x78, 0x88, 0x87, 0x77, 0x99, 0x88, 0x77, 0x65, 0x78, 0x75, 0x55, 0x7A, 0xB9,
-	0x99, 0xBB, 0xB9, 0x87, 0x77, 0x88, 0x76, 0x67, 0x89, 0x97, 0x78, 0x9A, 0x98, 0x89, 0xA9, 0x9A,
-	0x97, 0x87, 0x78, 0x77, 0x78, 0x87, 0x89, 0xAB, 0xA8, 0x87, 0x67, 0x87, 0x63, 0x46, 0x8A, 0x98,
-	0x78, 0xAB, 0xA8, 0x77, 0xAB, 0x98, 0x89, 0xB9, 0x98, 0x76, 0x57, 0x78, 0x65, 0x56, 0x99, 0xA8,
-	0x68, 0x9A, 0x98, 0x87, 0x88, 0x98, 0x99, 0x78, 0x78, 0x89, 0x76, 0x88, 0x88, 0x89, 0xAA, 0x88,
-	0x9A, 0xA9, 0x86, 0x79, 0xBB, 0x88, 0x89, 0xAA, 0x88, 0x76, 0x66, 0x77, 0x65, 0x67, 0x87, 0x77,
-	0x88, 0x88, 0x87, 0x77, 0x89, 0x98, 0x78, 0x9A, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98,
-	0x89, 0x88, 0x77, 0x89, 0x88, 0x88, 0x9A, 0xA9, 0x88, 0x89, 0x99, 0x87, 0x77, 0x78, 0x87, 0x76,
-	0x78, 0x76, 0x67, 0x77, 0x87, 0x77, 0x89, 0xAA, 0x97, 0x8A, 0xAA, 0x97, 0x65, 0x66, 0x79, 0x97,
-	0x65, 0x56, 0x8A, 0xAC, 0xDC, 0xBA, 0xBC, 0xEE, 0xB9, 0x99, 0x98, 0x65, 0x33, 0x35, 0x44, 0x56,
-	0x54, 0x47, 0xBE, 0xDC, 0x88, 0x88, 0x78, 0x88, 0xAA, 0x86, 0x67, 0x88, 0xA9, 0xA8, 0x64, 0x69,
-	0x99, 0x76, 0x34, 0x58, 0xDE, 0xEB, 0x97, 0x97, 0x9A, 0xB9, 0x85, 0x44, 0x68, 0xA9, 0x88, 0x98,
-	0x89, 0x87, 0x76, 0x99, 0x98, 0x76, 0x54, 0x56, 0x9C, 0xC9, 0x86, 0x66, 0x67, 0xBE, 0xEC, 0x96,
-	0x47, 0x7A, 0xCC, 0xA7, 0x53, 0x22, 0x44, 0x69, 0xBB, 0x97, 0x65, 0x67, 0x8C, 0xFF, 0xDA, 0x75,
-	0x57, 0xAB, 0xC9, 0x65, 0x53, 0x55, 0x8A, 0xBB, 0xA7, 0x53, 0x47, 0x96, 0x65, 0x67, 0xA9, 0x98,
-	0x77, 0x9C, 0xDD, 0xC9, 0x99, 0x89, 0x75, 0x55, 0x8A, 0xCB, 0x98, 0x75, 0x67, 0x89, 0x87, 0x56,
-	0x65, 0x46, 0x6A, 0xDE, 0xED, 0xA8, 0x66, 0x8A, 0xA7, 0x88, 0x65, 0x66, 0x7A, 0xBC, 0xCA, 0x85,
-	0x33, 0x46, 0xA9, 0x88, 0x57, 0x77, 0x9B, 0xDE, 0xDB, 0x98, 0x63, 0x46, 0x8A, 0xB9, 0x94, 0x34,
-	0x7A, 0xBA, 0x86, 0x34, 0x78, 0x97, 0x67, 0x9B, 0xAB, 0x97, 0x7A, 0xCB, 0x98, 0xA8, 0x88, 0x66,
-	0x65, 0x56, 0x8B, 0xCA, 0xA7, 0x54, 0x46, 0x88, 0x65, 0x89, 0x99, 0x86, 0x79, 0xDF, 0xED, 0x96,
-	0x67, 0x9A, 0x98, 0x65, 0x56, 0x88, 0x87, 0x87, 0x67, 0x78, 0xA7, 0x76, 0x66, 0x89, 0xBB, 0xAA,
-	0x89, 0x87, 0x8A, 0xCC, 0xA8, 0x54, 0x58, 0x9B, 0x97, 0x55, 0x77, 0x78, 0x86, 0x79, 0xBA, 0x53,
-	0x58, 0x9B, 0xDD, 0xD9, 0xAA, 0x98, 0x96, 0x68, 0x98, 0x64, 0x43, 0x34, 0x6A, 0xBC, 0xA9, 0x67,
-	0x67, 0xBC, 0xDD, 0xB9, 0x76, 0x55, 0x7B, 0xAB, 0xB8, 0x53, 0x5A, 0xA8, 0x54, 0x34, 0x7A, 0xBA,
-	0x74, 0x7D, 0xCC, 0xC9, 0xBA, 0x77, 0x65, 0x67, 0x89, 0x78, 0x77, 0x78, 0xBA, 0x76, 0x66, 0x78,
-	0x89, 0x84, 0x47, 0xBC, 0xEB, 0xCA, 0x88, 0x88, 0x87, 0x67, 0x88, 0x62, 0x36, 0x7A, 0x99, 0xBB,
-	0x75, 0x79, 0xCD, 0xCB, 0xC9, 0x45, 0x69, 0xA8, 0x78, 0x75, 0x33, 0x47, 0xBD, 0xCC, 0xA8, 0x54,
-	0x7A, 0xCA, 0x77, 0x53, 0x46, 0xAD, 0xCA, 0xA9, 0x89, 0x79, 0xA9, 0x97, 0x65, 0x34, 0x69, 0xCC,
-	0xBA, 0x99, 0x99, 0x98, 0x64, 0x56, 0x44, 0x45, 0x7B, 0xCC, 0xCC, 0xA8, 0x89, 0xAA, 0x89, 0x86,
-	0x56, 0x57, 0xA9, 0xA7, 0x65, 0x55, 0x56, 0x98, 0x67, 0x58, 0xAA, 0xDF, 0xEC, 0x97, 0xAA, 0x98,
-	0x76, 0x52, 0x24, 0x69, 0x9A, 0x8A, 0x98, 0x57, 0xBA, 0xA5, 0x79, 0x64, 0x6A, 0xDC, 0x88, 0x86,
-	0x86, 0x9B, 0xB8, 0x77, 0x64, 0x45, 0x7B, 0xDA, 0xAB, 0xAB, 0x88, 0xAA, 0x75, 0x56, 0x54, 0x45,
-	0x9A, 0x88, 0x9B, 0x98, 0x9C, 0xBC, 0xBB, 0xB8, 0x57, 0x46, 0x77, 0x87, 0x78, 0x75, 0x36, 0x87,
-	0x76, 0xAC, 0x76, 0xBD, 0xEC, 0x8A, 0xBA, 0x88, 0x88, 0x76, 0x36, 0x86, 0x44, 0x59, 0xA7, 0xBD,
-	0xC9, 0x44, 0xA7, 0x87, 0x9B, 0x73, 0x37, 0xBC, 0x9B, 0xCB, 0x97, 0x78, 0x96, 0x56, 0x85, 0x43,
-	0x46, 0x9B, 0xCE, 0xCC, 0x95, 0x6B, 0x87, 0x65, 0x74, 0x34, 0x6A, 0xCC, 0xBC, 0xCA, 0x89, 0xAA,
-	0x77, 0x55, 0x34, 0x46, 0x89, 0x88, 0xAB, 0xC8, 0x77, 0xA8, 0x65, 0x58, 0x86, 0x8C, 0xEC, 0xBB,
-	0xBC, 0xA8, 0x88, 0x64, 0x32, 0x33, 0x34, 0x48, 0x9A, 0xCD, 0xEC, 0xB7, 0xBC, 0x97, 0x66, 0x77,
-	0x66, 0x57, 0x8A, 0xAB, 0xBB, 0xA9, 0x75, 0x33, 0x55, 0x87, 0x79, 0x95, 0x8B, 0xAD, 0xED, 0xBA,
-	0x95, 0x44, 0x68, 0x65, 0x65, 0x66, 0x8B, 0xDC, 0xCB, 0xA8, 0x55, 0x89, 0x66, 0x44, 0x54, 0x46,
-	0xBE, 0xCB, 0x99, 0xBA, 0x98, 0x88, 0x75, 0x56, 0x69, 0x66, 0x89, 0x9C, 0xCC, 0xC8, 0x66, 0x88,
-	0x77, 0x75, 0x76, 0x68, 0x76, 0x78, 0xAC, 0xDB, 0x9B, 0xCA, 0x87, 0x79, 0x86, 0x54, 0x66, 0x66,
-	0x66, 0x89, 0x9B, 0xA9, 0xA9, 0xBA, 0x86, 0x67, 0x67, 0x99, 0x97, 0x55, 0x67, 0x9B, 0xA9, 0x88,
-	0x88, 0x9A, 0xA8, 0x99, 0xA9, 0xA9, 0x66, 0x68, 0x76, 0x66, 0x55, 0x68, 0xBA, 0xA8, 0x88, 0xAB,
-	0xBA, 0x87, 0x67, 0x77, 0x66, 0x79, 0x77, 0x78, 0x9A, 0xAA, 0xB9, 0x98, 0x76, 0x77, 0x78, 0x77,
-	0x77, 0x78, 0x88, 0x88, 0x78, 0x99, 0x88, 0x99, 0x87, 0x67, 0x99, 0xA9, 0x76, 0x78, 0xAB, 0xA9,
-	0x77, 0x78, 0x99, 0x98, 0x76, 0x77, 0x78, 0x78, 0x78, 0x9A, 0x99, 0x76, 0x66, 0x8A, 0xA9, 0x87,
-	0x77, 0x78, 0x99, 0x88, 0x87, 0x88, 0x98, 0x88, 0x88, 0xAA, 0xAA, 0x98, 0x88, 0x98, 0x88, 0x66,
-	0x75, 0x66, 0x68, 0x88, 0x88, 0x99, 0x9A, 0xBC, 0xBA, 0x98, 0x87, 0x77, 0x65, 0x56, 0x67, 0x99,
-	0x99, 0x88, 0x9A, 0xAA, 0xA9, 0x87, 0x66, 0x57, 0x77, 0x88, 0x77, 0x78, 0x89, 0xAA, 0x99, 0x99,
-	0x98, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x87, 0x77, 0x77, 0x99, 0x99, 0x98, 0x99,
-	0x9A, 0x98, 0x88, 0x77, 0x77, 0x78, 0x77, 0x88, 0x88, 0x99, 0x99, 0x98, 0x87, 0x77, 0x78, 0x89,
-	0x99, 0x88, 0x88, 0x89, 0x99, 0x98, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x98, 0x99, 0x89, 0x99, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x98, 0x88, 0x78, 0x77,
-	0x88, 0x87, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x76, 0x77, 0x77, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x93
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x76, 0x0B, 0xA2, 0x22, 0x22, 0x2B, 0x84, 0x22, 0x22, 0x22,
+	0x22, 0x10, 0xAD, 0xEA, 0x21, 0x2E, 0xD8, 0x10, 0x1E, 0x10, 0x8F, 0xC4, 0x2E, 0x88, 0x7C, 0x02,
+	0xDE, 0x4B, 0x49, 0x8D, 0xE7, 0x0D, 0xCA, 0x04, 0xB1, 0x21, 0xC9, 0xF9, 0x69, 0x1A, 0x7C, 0x8A,
+	0xFE, 0x58, 0xD6, 0x21, 0xE0, 0xAF, 0xB1, 0x62, 0x05, 0xF9, 0xAC, 0x9B, 0x58, 0x17, 0xA4, 0x4F,
+	0x05, 0xF2, 0x07, 0xB9, 0x4B, 0x09, 0x2E, 0x04, 0x7B, 0x2D, 0x8B, 0xD6, 0x8E, 0xF4, 0xE9, 0x52,
+	0x85, 0xBE, 0x86, 0xF9, 0x4B, 0x94, 0xE1, 0x31, 0xF2, 0x0E, 0x13, 0x51, 0xEB, 0x93, 0xF1, 0x1A,
+	0x94, 0xBC, 0x4E, 0x17, 0x3A, 0x91, 0xF9, 0x4B, 0x90, 0xBB, 0x66, 0x2E, 0xD9, 0xE4, 0x81, 0x6F,
+	0x43, 0xF1, 0x6C, 0x86, 0xCE, 0x86, 0xF4, 0x28, 0x42, 0xB8, 0x53, 0xC5, 0xB2, 0x82, 0x20, 0x4F,
+	0x1E, 0x85, 0xC8, 0x53, 0xC9, 0x3B, 0xA1, 0x3E, 0x5E, 0x18, 0x72, 0x56, 0xE4, 0x2F, 0xF0, 0x5B,
+	0xA1, 0x50, 0x6E, 0x16, 0xF8, 0x3F, 0xA1, 0x85, 0xE5, 0x5A, 0xE0, 0xC9, 0x6F, 0x01, 0x6B, 0xF1,
+	0x0F, 0xC4, 0x43, 0xE2, 0x47, 0xBC, 0x16, 0xA6, 0x9B, 0x34, 0xBB, 0xE5, 0x13, 0xB8, 0xD5, 0x3B,
+	0x99, 0x0E, 0xEA, 0x45, 0x6B, 0xA4, 0x55, 0xBA, 0x94, 0x3E, 0xB6, 0x46, 0xBE, 0x17, 0x20, 0x4B,
+	0xC5, 0x6B, 0x8D, 0xE2, 0x56, 0xBA, 0x11, 0xEC, 0x39, 0x54, 0x3E, 0xC1, 0xB0, 0xF0, 0x50, 0xBF,
+	0xE4, 0x6A, 0xD8, 0x54, 0xBE, 0xB9, 0x43, 0xBC, 0x46, 0xEC, 0x43, 0x85, 0x9E, 0x12, 0xE7, 0x2E,
+	0xA1, 0x54, 0xFB, 0x10, 0xF4, 0x2F, 0x15, 0xAE, 0x84, 0xBF, 0x04, 0xB2, 0xD9, 0x7A, 0x14, 0x4E,
+	0xCB, 0x50, 0xFE, 0x11, 0xBC, 0x09, 0xB5, 0x3E, 0x11, 0x6B, 0x2B, 0x3D, 0x3B, 0x89, 0x54, 0xBC,
+	0x94, 0x2F, 0xE9, 0x10, 0xFE, 0x5A, 0xB9, 0x43, 0xB5, 0x8B, 0x6E, 0x30, 0x4C, 0xA5, 0x6F, 0x84,
+	0x1F, 0x94, 0x72, 0xCA, 0x39, 0x3F, 0x11, 0x86, 0xF1, 0x4B, 0x7C, 0x92, 0xCB, 0xA5, 0x58, 0xEE,
+	0x46, 0xEB, 0x15, 0xA3, 0x8D, 0x2B, 0xF9, 0x14, 0xB8, 0x8F, 0xF0, 0xC9, 0x54, 0xAF, 0x02, 0xEF,
+	0xCD, 0x63, 0xA8, 0x56, 0xCD, 0x65, 0xAE, 0x6A, 0xBF, 0x94, 0x0D, 0xBD, 0x0F, 0x0E, 0x52, 0xE3,
+	0x05, 0xB8, 0xF9, 0x46, 0x8C, 0xE6, 0xF9, 0xAD, 0x4A, 0x4E, 0x59, 0x8F, 0xCC, 0x03, 0x1F, 0x96,
+	0x34, 0xE5, 0x38, 0x3A, 0x2F, 0xD3, 0xA5, 0x61, 0xBE, 0x62, 0x5F, 0x94, 0xC2, 0xE9, 0x3C, 0x3A,
+	0x54, 0x1C, 0xF1, 0xAB, 0x39, 0x46, 0x0E, 0xC3, 0xEE, 0xC4, 0x5A, 0x5B, 0x87, 0xB1, 0x34, 0x6A,
+	0x1F, 0x8F, 0xB0, 0x95, 0x11, 0x3E, 0x4E, 0xC2, 0xAD, 0x50, 0xAF, 0xFC, 0x04, 0x9B, 0x51, 0x3B,
+	0xBA, 0x5B, 0x21, 0x56, 0x3B, 0xC1, 0xE8, 0x35, 0x5A, 0xC2, 0xE3, 0xB9, 0x1E, 0x45, 0x2F, 0xC0,
+	0xCB, 0x25, 0xB1, 0x53, 0x93, 0xE1, 0xBA, 0x48, 0xD4, 0x1A, 0x76, 0xF9, 0x84, 0xEE, 0x45, 0xAC,
+	0x85, 0xB0, 0x77, 0xC9, 0xA8, 0xC5, 0x5B, 0x25, 0xAE, 0xC2, 0xF5, 0xA9, 0x43, 0x73, 0xA0, 0x1C,
+	0x81, 0x2A, 0xD4, 0xE4, 0xF9, 0x07, 0xB1, 0x4B, 0xE1, 0x23, 0xE0, 0x1D, 0x85, 0xBE, 0x95, 0x3A,
+	0x81, 0x4E, 0xB4, 0x72, 0xD4, 0xAF, 0x27, 0x3E, 0x70, 0x12, 0x96, 0x45, 0xBE, 0xAA, 0xF9, 0x44,
+	0x2C, 0x52, 0xBF, 0xCD, 0x86, 0xA1, 0x52, 0xC8, 0xBA, 0x22, 0xB8, 0x84, 0x2B, 0x8D, 0x42, 0xB4,
+	0x1F, 0x8E, 0x21, 0xC6, 0x04, 0x8B, 0xE8, 0x11, 0x2E, 0x21, 0x2B, 0xB8, 0x88, 0x81, 0xB4, 0x88,
+	0x88, 0x12, 0xB6, 0xD2, 0xE1, 0xB2, 0x88, 0xAE, 0x22, 0x22, 0x04, 0x42, 0x22, 0x2D, 0xB8, 0xDE,
+	0x4B, 0x60, 0x1B, 0x82, 0x2A, 0xCF, 0x4A, 0x10, 0x88, 0x88, 0x88, 0x81, 0x22, 0x2B, 0x88, 0x88,
+	0x88, 0x88, 0x8A, 0xE2, 0x20, 0x48, 0x88, 0x88, 0x87, 0x25, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0xAE, 0x40, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A,
+	0xE2, 0x21, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xBF
 };
 
+/* 3-bit ADPCM, SNR 15.3 dB */
 const u8 sfx_possessed_death1[] __attribute__((aligned(4))) = {
-	0x58, 0x78, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x87, 0x77, 0x89, 0x98, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x77, 0x78, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x98, 0x77, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89,
-	0x98, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x77, 0x78, 0x99, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x87, 0x77, 0x99, 0x98, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x87,
-	0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x88, 0x88,
-	0x88, 0x77, 0x88, 0x88, 0x88, 0x98, 0x87, 0x78, 0x99, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
-	0x99, 0x87, 0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x87, 0x77, 0x79, 0x98, 0x88, 0x88, 0x88, 0x77, 0x88,
-	0x88, 0x88, 0x98, 0x77, 0x78, 0x99, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89, 0x87, 0x77,
-	0x89, 0x98, 0x88, 0x89, 0x87, 0x78, 0x88, 0x88, 0x89, 0x98, 0x77, 0x77, 0x99, 0x88, 0x87, 0x88,
-	0x77, 0x88, 0x88, 0x78, 0x99, 0x98, 0x77, 0x77, 0x99, 0x99, 0x88, 0x88, 0x77, 0x88, 0x87, 0x78,
-	0x99, 0x98, 0x87, 0x67, 0x89, 0x99, 0x87, 0x88, 0x87, 0x88, 0x88, 0x78, 0x89, 0x99, 0x87, 0x77,
-	0x79, 0x99, 0x88, 0x88, 0x87, 0x77, 0x88, 0x77, 0x89, 0x99, 0x88, 0x77, 0x77, 0x99, 0x88, 0x88,
-	0x98, 0x77, 0x78, 0x88, 0x78, 0x89, 0x99, 0x97, 0x76, 0x69, 0x99, 0x98, 0x88, 0x87, 0x77, 0x87,
-	0x77, 0x89, 0x99, 0x88, 0x77, 0x66, 0x8A, 0x99, 0x88, 0x99, 0x76, 0x77, 0x88, 0x88, 0x99, 0x99,
-	0x87, 0x77, 0x79, 0x99, 0x98, 0x89, 0x87, 0x77, 0x88, 0x87, 0x89, 0x99, 0x98, 0x76, 0x67, 0x99,
-	0x99, 0x88, 0x98, 0x77, 0x78, 0x87, 0x78, 0x99, 0x98, 0x76, 0x67, 0x99, 0x88, 0x88, 0x99, 0x76,
-	0x78, 0x88, 0x78, 0x99, 0x99, 0x87, 0x66, 0x79, 0x99, 0x98, 0x99, 0x86, 0x67, 0x88, 0x87, 0x89,
-	0x9A, 0x98, 0x66, 0x68, 0x99, 0x98, 0x89, 0x97, 0x67, 0x88, 0x87, 0x89, 0x99, 0x98, 0x76, 0x67,
-	0x9A, 0x99, 0x88, 0x98, 0x77, 0x77, 0x77, 0x78, 0x99, 0x99, 0x87, 0x66, 0x8A, 0x99, 0x88, 0x99,
-	0x86, 0x77, 0x88, 0x77, 0x89, 0x99, 0x98, 0x76, 0x67, 0x99, 0x99, 0x99, 0x98, 0x76, 0x77, 0x77,
-	0x78, 0x9A, 0xA9, 0x87, 0x66, 0x8A, 0x99, 0x88, 0x99, 0x76, 0x77, 0x88, 0x77, 0x9A, 0xA9, 0x87,
-	0x66, 0x79, 0x99, 0x98, 0x99, 0x87, 0x67, 0x88, 0x77, 0x89, 0xA9, 0x98, 0x66, 0x67, 0xA9, 0x98,
-	0x89, 0x98, 0x66, 0x78, 0x87, 0x78, 0xAA, 0x98, 0x76, 0x66, 0x8A, 0x99, 0x89, 0xA9, 0x76, 0x77,
-	0x88, 0x77, 0x9A, 0xA9, 0x87, 0x66, 0x79, 0x99, 0x98, 0x99, 0x87, 0x67, 0x88, 0x77, 0x89, 0xA9,
-	0x98, 0x66, 0x67, 0x99, 0x99, 0x99, 0x98, 0x76, 0x77, 0x87, 0x78, 0x9A, 0xA9, 0x86, 0x66, 0x79,
-	0x99, 0x99, 0x99, 0x86, 0x57, 0x88, 0x77, 0x89, 0xA9, 0x98, 0x76, 0x66, 0x99, 0x99, 0x99, 0x98,
-	0x66, 0x78, 0x87, 0x78, 0xAA, 0x98, 0x76, 0x66, 0x99, 0x99, 0x88, 0xA9, 0x76, 0x78, 0x87, 0x68,
-	0x9A, 0x98, 0x77, 0x76, 0x69, 0x99, 0x99, 0x99, 0x86, 0x57, 0x88, 0x77, 0x8A, 0xA9, 0x88, 0x76,
-	0x67, 0x99, 0x99, 0x99, 0x97, 0x56, 0x78, 0x87, 0x78, 0xAA, 0x98, 0x77, 0x66, 0x7A, 0xA9, 0x99,
-	0x99, 0x86, 0x67, 0x88, 0x77, 0x9A, 0x98, 0x88, 0x76, 0x67, 0xA9, 0x99, 0x99, 0x97, 0x56, 0x88,
-	0x87, 0x79, 0xA9, 0x88, 0x87, 0x65, 0x58, 0xBA, 0xA9, 0x88, 0x86, 0x67, 0x77, 0x77, 0x9A, 0xA9,
-	0x99, 0x86, 0x55, 0x7B, 0xA9, 0x99, 0x88, 0x76, 0x77, 0x77, 0x78, 0x9A, 0x98, 0x98, 0x76, 0x55,
-	0x9B, 0xAA, 0x98, 0x88, 0x66, 0x67, 0x88, 0x78, 0x9A, 0xA9, 0x87, 0x66, 0x57, 0xBA, 0x99, 0x88,
-	0x97, 0x56, 0x78, 0x87, 0x89, 0xA9, 0x88, 0x87, 0x66, 0x58, 0xCA, 0x99, 0x88, 0x96, 0x57, 0x88,
-	0x87, 0x89, 0xA9, 0x88, 0x87, 0x65, 0x69, 0xC9, 0x99, 0x89, 0x96, 0x57, 0x87, 0x87, 0x89, 0xA9,
-	0x99, 0x87, 0x65, 0x69, 0xB9, 0x99, 0x88, 0x86, 0x67, 0x78, 0x77, 0x89, 0x99, 0x88, 0x87, 0x76,
-	0x69, 0xB9, 0x99, 0x89, 0x97, 0x67, 0x77, 0x77, 0x8A, 0xA9, 0x99, 0x97, 0x65, 0x57, 0xAA, 0x9A,
-	0xA8, 0x88, 0x67, 0x76, 0x78, 0x8A, 0xA9, 0x99, 0x98, 0x66, 0x55, 0x69, 0xBB, 0xB9, 0x88, 0x86,
-	0x55, 0x68, 0x98, 0x9A, 0xA9, 0x98, 0x76, 0x55, 0x57, 0xAC, 0xBA, 0x98, 0x87, 0x55, 0x67, 0x89,
-	0x89, 0xAA, 0x99, 0x87, 0x65, 0x56, 0x8B, 0xBA, 0xA8, 0x77, 0x76, 0x67, 0x78, 0x88, 0x9A, 0x99,
-	0x98, 0x76, 0x66, 0x79, 0xA9, 0xA9, 0x87, 0x87, 0x67, 0x67, 0x89, 0x89, 0x99, 0x99, 0x86, 0x66,
-	0x68, 0xB9, 0xAA, 0x88, 0x97, 0x66, 0x67, 0x88, 0x89, 0x99, 0x98, 0x87, 0x76, 0x57, 0xBA, 0x9A,
-	0x88, 0x98, 0x67, 0x77, 0x88, 0x89, 0x99, 0x99, 0x97, 0x66, 0x67, 0xAA, 0x9A, 0x98, 0x98, 0x66,
-	0x66, 0x88, 0x88, 0x9A, 0x99, 0x98, 0x65, 0x56, 0x8C, 0xA9, 0x99, 0x99, 0x64, 0x66, 0x78, 0x89,
-	0xAA, 0xA9, 0x98, 0x65, 0x55, 0x7A, 0xBA, 0xBA, 0x88, 0x85, 0x55, 0x68, 0x99, 0x99, 0xAA, 0x98,
-	0x86, 0x55, 0x58, 0xCB, 0xAA, 0x89, 0x96, 0x45, 0x57, 0x98, 0x99, 0xAA, 0xA9, 0x87, 0x55, 0x56,
-	0x9C, 0xBB, 0xA8, 0x88, 0x65, 0x55, 0x79, 0x89, 0x9A, 0xAA, 0x88, 0x65, 0x55, 0x6B, 0xCA, 0xA8,
-	0x89, 0x85, 0x55, 0x79, 0x88, 0x89, 0x99, 0x99, 0x86, 0x54, 0x59, 0xCA, 0x99, 0x89, 0x96, 0x56,
-	0x68, 0x98, 0x89, 0x9A, 0xA9, 0x87, 0x65, 0x56, 0x9B, 0xAA, 0x98, 0x89, 0x65, 0x66, 0x89, 0x88,
-	0x99, 0xAA, 0x98, 0x65, 0x56, 0x9B, 0x99, 0x98, 0x99, 0x65, 0x66, 0x89, 0x88, 0x89, 0xAA, 0xA8,
-	0x65, 0x56, 0xAB, 0x88, 0x99, 0x99, 0x55, 0x67, 0x88, 0x78, 0x9A, 0xAA, 0xA7, 0x55, 0x58, 0xC9,
-	0x88, 0x99, 0xA7, 0x45, 0x78, 0x87, 0x79, 0xAA, 0x99, 0x97, 0x64, 0x58, 0xCA, 0x89, 0x89, 0x97,
-	0x56, 0x77, 0x77, 0x8A, 0xA9, 0x89, 0x97, 0x64, 0x49, 0xCA, 0x98, 0x89, 0xA7, 0x56, 0x78, 0x77,
-	0x8A, 0xAA, 0x99, 0x87, 0x54, 0x5B, 0xB9, 0x88, 0x8A, 0x96, 0x56, 0x88, 0x77, 0x8A, 0xA9, 0x98,
-	0x76, 0x55, 0x9C, 0x98, 0x78, 0xAA, 0x64, 0x68, 0xA8, 0x67, 0x9B, 0xA9, 0x87, 0x76, 0x67, 0xBA,
-	0x88, 0x89, 0xA8, 0x45, 0x79, 0x96, 0x68, 0xAA, 0x98, 0x76, 0x66, 0x7C, 0xB8, 0x78, 0x9A, 0x84,
-	0x58, 0x99, 0x67, 0x9B, 0xA9, 0x88, 0x65, 0x56, 0xBC, 0x97, 0x89, 0xA8, 0x45, 0x79, 0x96, 0x69,
-	0xBB, 0x97, 0x76, 0x65, 0x7B, 0xA9, 0x88, 0x9A, 0x74, 0x57, 0x98, 0x67, 0x9B, 0xB9, 0x76, 0x66,
-	0x69, 0x99, 0x98, 0xAA, 0x85, 0x56, 0x89, 0x76, 0x7A, 0xBA, 0x86, 0x66, 0x69, 0xA8, 0x88, 0x9A,
-	0xA7, 0x56, 0x79, 0x87, 0x78, 0xAA, 0x96, 0x56, 0x8B, 0xA7, 0x77, 0x9A, 0x95, 0x57, 0x9A, 0x76,
-	0x79, 0xAA, 0x86, 0x66, 0x7A, 0xC9, 0x76, 0x8A, 0xA6, 0x45, 0x8B, 0x97, 0x78, 0xAA, 0x86, 0x56,
-	0x78, 0xCA, 0x88, 0x79, 0xA7, 0x44, 0x6A, 0xA7, 0x78, 0xAA, 0x96, 0x56, 0x67, 0x9B, 0x99, 0x99,
-	0x99, 0x54, 0x57, 0xA9, 0x78, 0xAB, 0xA8, 0x65, 0x66, 0x68, 0xBA, 0xAA, 0x89, 0x95, 0x46, 0x69,
-	0x97, 0x8A, 0xBA, 0x97, 0x55, 0x66, 0x8B, 0xAA, 0x98, 0x99, 0x64, 0x56, 0x99, 0x88, 0x9A, 0xB9,
-	0x75, 0x55, 0x69, 0xCA, 0x98, 0x89, 0xA6, 0x45, 0x69, 0x97, 0x79, 0xBB, 0x97, 0x55, 0x67, 0xBA,
-	0x98, 0x88, 0xA8, 0x65, 0x58, 0xA8, 0x78, 0x9A, 0xA8, 0x65, 0x57, 0xBB, 0x98, 0x78, 0xA9, 0x65,
-	0x58, 0xB8, 0x77, 0x8A, 0xA8, 0x65, 0x57, 0x9C, 0xA9, 0x87, 0x9A, 0x74, 0x46, 0xAB, 0x87, 0x8A,
-	0xB9, 0x65, 0x46, 0x7A, 0xCA, 0x98, 0x89, 0x95, 0x33, 0x7B, 0xA8, 0x79, 0xBB, 0x85, 0x34, 0x79,
-	0xCA, 0x99, 0x89, 0xA7, 0x43, 0x49, 0xB9, 0x88, 0xAC, 0xA7, 0x43, 0x58, 0xCB, 0x99, 0x8A, 0xB9,
-	0x53, 0x37, 0xA9, 0x88, 0x9B, 0xB9, 0x53, 0x45, 0x9C, 0xA9, 0x88, 0xAB, 0x73, 0x34, 0x9A, 0x87,
-	0x9B, 0xCB, 0x74, 0x35, 0x6A, 0xC9, 0x98, 0x9B, 0xA6, 0x33, 0x5A, 0x97, 0x79, 0xCC, 0xA6, 0x44,
-	0x58, 0xCB, 0x88, 0x89, 0xC9, 0x43, 0x48, 0xB8, 0x67, 0xAC, 0xB9, 0x54, 0x56, 0x9C, 0xA9, 0x87,
-	0xAB, 0x74, 0x34, 0x9B, 0x87, 0x7A, 0xCB, 0x74, 0x35, 0x8C, 0xC9, 0x98, 0x9B, 0x95, 0x44, 0x6A,
-	0x98, 0x89, 0xAB, 0xA6, 0x43, 0x57, 0xCC, 0x99, 0x99, 0xA9, 0x43, 0x46, 0xA9, 0x79, 0xAB, 0xB9,
-	0x64, 0x45, 0x6A, 0xCA, 0xA9, 0x9A, 0x95, 0x33, 0x59, 0x97, 0x8A, 0xCC, 0xA6, 0x44, 0x56, 0x9C,
-	0xAA, 0xA9, 0xA9, 0x63, 0x35, 0x89, 0x87, 0x9B, 0xBA, 0x85, 0x45, 0x46, 0xAD, 0xBB, 0x98, 0xA8,
-	0x43, 0x45, 0x99, 0x89, 0xAB, 0xA9, 0x75, 0x55, 0x46, 0xAC, 0xCC, 0xA8, 0x87, 0x44, 0x55, 0x89,
-	0x8A, 0xBA, 0x99, 0x87, 0x54, 0x35, 0x8D, 0xDC, 0xA8, 0x88, 0x64, 0x55, 0x69, 0x99, 0xAA, 0xA9,
-	0x98, 0x64, 0x35, 0x8A, 0xEB, 0xA9, 0x88, 0x85, 0x46, 0x58, 0x97, 0x9A, 0xBA, 0xA8, 0x65, 0x45,
-	0x7B, 0xC9, 0xA8, 0x8A, 0x95, 0x56, 0x68, 0x76, 0x8A, 0xBA, 0x96, 0x67, 0x66, 0x9B, 0x9A, 0x86,
-	0x99, 0x77, 0x76, 0x88, 0x67, 0x9A, 0xA9, 0x87, 0x77, 0x56, 0xAB, 0x9A, 0x76, 0x98, 0x68, 0x76,
-	0x87, 0x69, 0xBA, 0x99, 0x77, 0x85, 0x46, 0xAB, 0xAA, 0x77, 0x98, 0x67, 0x75, 0x77, 0x69, 0xBA,
-	0xA9, 0x98, 0x75, 0x35, 0x8C, 0xBB, 0x97, 0x99, 0x77, 0x64, 0x67, 0x69, 0xBA, 0xBA, 0x98, 0x75,
-	0x45, 0x6A, 0xBB, 0xA8, 0x89, 0x77, 0x74, 0x57, 0x68, 0xAA, 0xBA, 0x98, 0x75, 0x44, 0x6B, 0xBB,
-	0xA7, 0x99, 0x77, 0x74, 0x67, 0x68, 0xBB, 0xB9, 0x88, 0x76, 0x44, 0x59, 0xCB, 0xB8, 0x88, 0x76,
-	0x76, 0x57, 0x68, 0xBC, 0xCA, 0x87, 0x76, 0x44, 0x59, 0xCB, 0xC9, 0x89, 0x76, 0x75, 0x46, 0x68,
-	0xCC, 0xBA, 0x88, 0x86, 0x54, 0x58, 0xCC, 0xD9, 0x78, 0x76, 0x76, 0x46, 0x67, 0xBC, 0xBA, 0x88,
-	0x87, 0x64, 0x46, 0xBD, 0xDB, 0x77, 0x77, 0x77, 0x55, 0x66, 0xAC, 0xBA, 0x87, 0x87, 0x75, 0x46,
-	0xAC, 0xCB, 0x87, 0x77, 0x78, 0x65, 0x66, 0x8B, 0xBA, 0x97, 0x88, 0x76, 0x55, 0x8C, 0xBC, 0x86,
-	0x77, 0x79, 0x85, 0x66, 0x7B, 0xBA, 0x98, 0x88, 0x76, 0x55, 0x7B, 0xBC, 0x96, 0x67, 0x79, 0x85,
-	0x56, 0x7A, 0xB9, 0x98, 0x89, 0x87, 0x55, 0x7B, 0xBC, 0x95, 0x77, 0x89, 0x85, 0x66, 0x7B, 0xA9,
-	0x88, 0x89, 0x87, 0x55, 0x7B, 0xCC, 0x95, 0x68, 0x89, 0x85, 0x57, 0x7A, 0xA9, 0x88, 0x89, 0x87,
-	0x54, 0x6A, 0xCC, 0xA5, 0x68, 0x9A, 0x85, 0x56, 0x7A, 0xA9, 0x98, 0x89, 0x98, 0x54, 0x5A, 0xCC,
-	0xA6, 0x67, 0x8A, 0x95, 0x56, 0x7A, 0xB9, 0x98, 0x89, 0x98, 0x64, 0x59, 0xCC, 0xB7, 0x67, 0x89,
-	0x96, 0x45, 0x6A, 0xBA, 0x98, 0x89, 0x98, 0x64, 0x48, 0xCD, 0xC7, 0x57, 0x9A, 0xA6, 0x35, 0x6A,
-	0xBA, 0x98, 0x89, 0x98, 0x74, 0x46, 0xCD, 0xC8, 0x56, 0x9A, 0xA7, 0x34, 0x68, 0xBA, 0x98, 0x78,
-	0x99, 0x85, 0x35, 0xAD, 0xD9, 0x56, 0x8A, 0xA8, 0x44, 0x67, 0xBA, 0x98, 0x88, 0x99, 0x86, 0x34,
-	0x9D, 0xDB, 0x65, 0x89, 0xA9, 0x44, 0x67, 0xAA, 0x99, 0x88, 0x99, 0x97, 0x43, 0x6C, 0xDC, 0x84,
-	0x69, 0xAA, 0x64, 0x56, 0x8A, 0x99, 0x87, 0x8A, 0xA9, 0x53, 0x39, 0xEE, 0xB5, 0x47, 0xAA, 0x95,
-	0x35, 0x69, 0xA9, 0x98, 0x89, 0xBA, 0x73, 0x36, 0xCE, 0xC8, 0x45, 0x9B, 0xA8, 0x43, 0x57, 0xA9,
-	0x98, 0x88, 0xAA, 0x96, 0x33, 0x6D, 0xDB, 0x74, 0x69, 0xAA, 0x73, 0x45, 0x7A, 0xA9, 0x98, 0x8A,
-	0xB9, 0x52, 0x37, 0xEE, 0xC6, 0x47, 0xAB, 0xA6, 0x24, 0x59, 0xBA, 0xA8, 0x78, 0xAB, 0x93, 0x13,
-	0x9F, 0xEA, 0x54, 0x7A, 0xB9, 0x53, 0x46, 0x9B, 0xA9, 0x77, 0x9B, 0xA8, 0x32, 0x5B, 0xFD, 0x94,
-	0x48, 0xBA, 0x94, 0x35, 0x7A, 0xBA, 0x97, 0x69, 0xBB, 0x73, 0x36, 0xCE, 0xC8, 0x35, 0x9B, 0xA8,
-	0x34, 0x57, 0xBB, 0xA8, 0x67, 0xAB, 0xA6, 0x22, 0x6D, 0xEC, 0x74, 0x6A, 0xBA, 0x73, 0x45, 0x8B,
-	0xBA, 0x86, 0x7A, 0xCB, 0x61, 0x15, 0xCF, 0xC9, 0x45, 0x9B, 0xA8, 0x43, 0x47, 0xAB, 0xA8, 0x77,
-	0xAC, 0xB7, 0x10, 0x4A, 0xFD, 0xA5, 0x47, 0xAA, 0x95, 0x34, 0x69, 0xBA, 0x98, 0x79, 0xAA, 0x85,
-	0x23, 0x7C, 0xEC, 0x84, 0x59, 0xBA, 0x72, 0x24, 0x8C, 0xCA, 0x86, 0x7A, 0xCB, 0x72, 0x03, 0x9F,
-	0xFB, 0x63, 0x6A, 0xCA, 0x61, 0x26, 0xAD, 0xB9, 0x76, 0x9B, 0xCA, 0x51, 0x15, 0xAF, 0xE9, 0x64,
-	0x8B, 0xB8, 0x41, 0x47, 0xBC, 0xA8, 0x78, 0xAB, 0xA9, 0x43, 0x25, 0xAD, 0xEA, 0x85, 0x7A, 0xA8,
-	0x53, 0x47, 0x9B, 0xA9, 0x88, 0x99, 0xA9, 0x75, 0x44, 0x7A, 0xCC, 0x98, 0x58, 0xAA, 0x86, 0x35,
-	0x89, 0xA9, 0x88, 0x89, 0xAA, 0x97, 0x54, 0x48, 0x9C, 0xB9, 0x87, 0x9A, 0x97, 0x54, 0x67, 0x99,
-	0x88, 0x89, 0x9A, 0x99, 0x76, 0x44, 0x78, 0xBC, 0xA9, 0x68, 0x9A, 0x96, 0x35, 0x68, 0xA9, 0x98,
-	0x89, 0xAA, 0xA7, 0x53, 0x37, 0x9B, 0xC9, 0x98, 0x8A, 0xA8, 0x63, 0x46, 0x8A, 0x98, 0x99, 0xAB,
-	0xA9, 0x75, 0x54, 0x57, 0x9C, 0xCB, 0xA8, 0x88, 0x76, 0x53, 0x56, 0x8A, 0xBB, 0xA9, 0x99, 0x99,
-	0x64, 0x23, 0x79, 0xDE, 0xB9, 0x66, 0x99, 0x85, 0x24, 0x7A, 0xBA, 0x98, 0x89, 0xA9, 0x87, 0x55,
-	0x56, 0x89, 0xBB, 0xA9, 0x78, 0x88, 0x75, 0x46, 0x89, 0xA9, 0x99, 0x99, 0x99, 0x87, 0x65, 0x56,
-	0x79, 0xBC, 0xA9, 0x67, 0x88, 0x85, 0x35, 0x79, 0xA9, 0x98, 0x9A, 0xA9, 0x76, 0x65, 0x67, 0x78,
-	0x9C, 0xBB, 0x87, 0x77, 0x76, 0x45, 0x68, 0x9A, 0xAA, 0x99, 0x99, 0x88, 0x65, 0x44, 0x79, 0xBC,
-	0xBA, 0x97, 0x88, 0x75, 0x44, 0x68, 0xAA, 0x99, 0x99, 0xA9, 0x86, 0x67, 0x76, 0x77, 0x8A, 0xCC,
-	0xB8, 0x56, 0x78, 0x86, 0x55, 0x69, 0xAA, 0xA9, 0x99, 0x99, 0x87, 0x65, 0x56, 0x79, 0xAB, 0xBB,
-	0xA8, 0x77, 0x66, 0x44, 0x67, 0x9A, 0xAA, 0xBA, 0x98, 0x76, 0x66, 0x66, 0x67, 0x9A, 0xBC, 0xBA,
-	0x76, 0x76, 0x65, 0x45, 0x89, 0xAA, 0xAA, 0x99, 0x88, 0x76, 0x66, 0x66, 0x78, 0x9A, 0xCC, 0xB9,
-	0x66, 0x66, 0x76, 0x56, 0x79, 0xAA, 0xA9, 0x99, 0x88, 0x76, 0x66, 0x67, 0x79, 0x9A, 0xAB, 0xBB,
-	0x86, 0x55, 0x65, 0x56, 0x79, 0xAA, 0xBA, 0x99, 0x88, 0x77, 0x65, 0x57, 0x89, 0xAA, 0xAB, 0xAA,
-	0x86, 0x55, 0x66, 0x56, 0x79, 0xAB, 0xBA, 0xA9, 0x88, 0x76, 0x66, 0x67, 0x78, 0x89, 0xAB, 0xBA,
-	0xA7, 0x54, 0x56, 0x66, 0x68, 0x9B, 0xBB, 0xA9, 0x87, 0x66, 0x66, 0x67, 0x89, 0x99, 0x9A, 0xAB,
-	0xA9, 0x65, 0x56, 0x76, 0x66, 0x8A, 0xBB, 0xA9, 0x88, 0x77, 0x66, 0x56, 0x79, 0xAA, 0x87, 0x89,
-	0xBB, 0x97, 0x44, 0x68, 0x88, 0x67, 0x8A, 0xBA, 0x97, 0x78, 0x88, 0x76, 0x66, 0x89, 0xA9, 0x77,
-	0x89, 0xAA, 0x98, 0x65, 0x67, 0x87, 0x67, 0x89, 0xBA, 0xA9, 0x87, 0x77, 0x77, 0x66, 0x79, 0xAA,
-	0x97, 0x78, 0x9A, 0xA9, 0x75, 0x56, 0x89, 0x86, 0x78, 0xAB, 0xA9, 0x87, 0x77, 0x88, 0x77, 0x67,
-	0x9A, 0xA8, 0x77, 0x89, 0x99, 0x98, 0x65, 0x78, 0x98, 0x66, 0x89, 0xA9, 0x98, 0x88, 0x88, 0x87,
-	0x76, 0x79, 0x99, 0x87, 0x88, 0x99, 0x99, 0x97, 0x66, 0x78, 0x87, 0x78, 0x9A, 0x99, 0x98, 0x88,
-	0x77, 0x77, 0x77, 0x89, 0x99, 0x77, 0x88, 0x99, 0x99, 0x86, 0x66, 0x89, 0x87, 0x78, 0x9A, 0x99,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x9A, 0xA8, 0x77, 0x78, 0x88, 0x99, 0x97, 0x77, 0x88, 0x76, 0x68,
-	0x9A, 0x99, 0x99, 0x98, 0x87, 0x66, 0x67, 0x89, 0x99, 0x99, 0x88, 0x88, 0x99, 0x97, 0x67, 0x89,
-	0x87, 0x77, 0x89, 0x99, 0x98, 0x87, 0x88, 0x77, 0x66, 0x89, 0xA9, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x78, 0x98, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x76, 0x78, 0x89, 0x99, 0x98, 0x88,
-	0x88, 0x99, 0x87, 0x66, 0x89, 0x98, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x87, 0x78, 0x89, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x9A, 0xA8, 0x66, 0x78, 0x87, 0x77, 0x89, 0x99, 0x99, 0x88, 0x88, 0x77,
-	0x77, 0x78, 0x99, 0x89, 0x98, 0x87, 0x78, 0x89, 0x97, 0x66, 0x89, 0x98, 0x88, 0x99, 0x99, 0x87,
-	0x77, 0x88, 0x87, 0x77, 0x89, 0x99, 0x88, 0x88, 0x77, 0x77, 0x89, 0xA9, 0x76, 0x78, 0x98, 0x77,
-	0x78, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x87,
-	0x67, 0x88, 0x87, 0x88, 0x99, 0x98, 0x87, 0x77, 0x88, 0x87, 0x78, 0x89, 0x99, 0x99, 0x88, 0x77,
-	0x77, 0x89, 0x98, 0x76, 0x78, 0x98, 0x77, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99,
-	0x98, 0x88, 0x88, 0x77, 0x77, 0x89, 0x98, 0x77, 0x89, 0x87, 0x77, 0x89, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x88, 0x99, 0x98, 0x88, 0x87, 0x77, 0x78, 0x99, 0x87, 0x78, 0x89, 0x87, 0x77, 0x89,
-	0x99, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x99, 0x98, 0x88, 0x87, 0x77, 0x78, 0x99, 0x87, 0x78,
-	0x99, 0x87, 0x78, 0x88, 0x98, 0x87, 0x78, 0x88, 0x88, 0x77, 0x89, 0x99, 0x88, 0x88, 0x88, 0x87,
-	0x89, 0x99, 0x77, 0x78, 0x88, 0x77, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x99,
-	0x88, 0x88, 0x77, 0x77, 0x89, 0x98, 0x77, 0x89, 0x98, 0x77, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x78, 0x99, 0x88, 0x89, 0x88, 0x77, 0x77, 0x89, 0x98, 0x77, 0x78, 0x98, 0x87, 0x78, 0x89,
-	0x98, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x99, 0x88, 0x88, 0x77, 0x77, 0x88, 0x99, 0x87, 0x78,
-	0x98, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x87, 0x78, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x98, 0x77, 0x88, 0x88, 0x77, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88,
-	0x87, 0x78, 0x89, 0x99, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x98, 0x87, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x67, 0x88, 0x87,
-	0x78, 0x89, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x78, 0x99, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87,
-	0x67, 0x88, 0x87, 0x88, 0x89, 0x98, 0x88, 0x87, 0x78, 0x88, 0x87, 0x88, 0x98, 0x88, 0x88, 0x98,
-	0x89, 0x98, 0x86, 0x77, 0x88, 0x77, 0x89, 0x99, 0x99, 0x98, 0x87, 0x77, 0x77, 0x78, 0x88, 0x87,
-	0x89, 0x99, 0x88, 0x99, 0x98, 0x66, 0x77, 0x77, 0x78, 0x89, 0x99, 0x99, 0x98, 0x78, 0x77, 0x77,
-	0x77, 0x78, 0x99, 0x99, 0x88, 0x99, 0x87, 0x66, 0x77, 0x77, 0x77, 0x89, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x76, 0x57, 0x8A, 0xA9, 0x89, 0x99, 0x98, 0x76, 0x66, 0x77, 0x88, 0x88, 0x89, 0xA9, 0x98,
-	0x77, 0x88, 0x89, 0x98, 0x76, 0x78, 0x99, 0x87, 0x78, 0x99, 0x98, 0x87, 0x88, 0x88, 0x77, 0x68,
-	0x99, 0x98, 0x88, 0x89, 0x98, 0x77, 0x68
+	0xEE, 0x90, 0xE6, 0x10, 0x08, 0x20, 0x82, 0x08, 0xF5, 0x81, 0xA1, 0xA6, 0x50, 0x41, 0x04, 0x10,
+	0x31, 0xF0, 0x89, 0x58, 0x20, 0x82, 0x08, 0x20, 0x8C, 0x7B, 0x03, 0x50, 0x71, 0x04, 0x10, 0x41,
+	0x04, 0x12, 0x71, 0x1A, 0x1A, 0x65, 0x04, 0x10, 0x41, 0x03, 0xC3, 0x40, 0x90, 0xD3, 0x28, 0x20,
+	0x10, 0x40, 0xE0, 0xFA, 0x16, 0x66, 0x9C, 0x81, 0x04, 0x10, 0x46, 0x3D, 0x81, 0xA9, 0x64, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x3C, 0x0D, 0x0D, 0x04, 0x13, 0xC6, 0x20, 0x81, 0xE9, 0x63, 0x43, 0x41,
+	0x04, 0xF1, 0x89, 0x04, 0x63, 0xD8, 0x1A, 0x96, 0x41, 0x04, 0x10, 0x41, 0x04, 0x1E, 0x06, 0xA5,
+	0x90, 0x41, 0x04, 0x10, 0x40, 0xF5, 0x95, 0xB1, 0x84, 0x10, 0x4F, 0x18, 0x90, 0x05, 0xB4, 0x0C,
+	0x8E, 0x20, 0x93, 0xA1, 0x20, 0x80, 0x2D, 0xA0, 0x64, 0x71, 0x02, 0xD8, 0x10, 0x20, 0x8C, 0x7B,
+	0x2B, 0x63, 0x09, 0x94, 0xB1, 0x89, 0x3A, 0x22, 0x7C, 0x2A, 0x62, 0x0E, 0x24, 0xF1, 0x89, 0xC2,
+	0x22, 0x79, 0xEA, 0x28, 0x4F, 0x54, 0x1C, 0x81, 0x3A, 0x88, 0x4D, 0xA4, 0x4C, 0x4C, 0x20, 0x9E,
+	0x06, 0x3C, 0x66, 0x0D, 0x38, 0xA9, 0x8C, 0x20, 0x7A, 0xC0, 0xC4, 0xE4, 0x30, 0x37, 0x98, 0xB0,
+	0x26, 0x10, 0x78, 0x1E, 0x81, 0x90, 0x3C, 0xD3, 0x86, 0xE4, 0xA1, 0x5F, 0x48, 0x42, 0x06, 0x24,
+	0xF8, 0x54, 0xC4, 0x1C, 0x1D, 0xA0, 0x70, 0x74, 0x60, 0x9F, 0x60, 0x90, 0x92, 0xC7, 0xAC, 0x0E,
+	0x68, 0xD4, 0x1B, 0x50, 0x98, 0xC2, 0x05, 0x3E, 0x24, 0x4E, 0x8C, 0x13, 0xEC, 0x12, 0x12, 0x54,
+	0x3F, 0x85, 0x41, 0x8A, 0x0B, 0x5F, 0x03, 0x22, 0x60, 0xAF, 0xA5, 0x09, 0xD1, 0x82, 0x7D, 0x82,
+	0x46, 0xCC, 0x16, 0xA2, 0x08, 0x23, 0x42, 0x4F, 0xB0, 0x6A, 0x4A, 0x14, 0xDC, 0xC5, 0x2C, 0x64,
+	0x09, 0xF6, 0x09, 0x08, 0x24, 0x9F, 0x55, 0x04, 0x0D, 0x11, 0xEE, 0xC1, 0xA9, 0x2C, 0x73, 0xD2,
+	0x14, 0xC1, 0xA9, 0x6E, 0xC1, 0x21, 0x25, 0x43, 0xEA, 0x8C, 0xC1, 0x15, 0x67, 0xF0, 0x27, 0x06,
+	0x06, 0x6E, 0x02, 0x94, 0x36, 0x2E, 0xB8, 0x06, 0xE8, 0xA8, 0xED, 0x4C, 0x43, 0x86, 0x65, 0xD7,
+	0x44, 0xC4, 0x18, 0x8F, 0x71, 0x43, 0x44, 0x8E, 0x1B, 0x48, 0x9C, 0x02, 0x41, 0xF6, 0x21, 0x58,
+	0xCA, 0x1E, 0xF8, 0x12, 0x10, 0x41, 0x7F, 0xC8, 0xCB, 0x19, 0x38, 0x6D, 0x62, 0x60, 0x40, 0x2F,
+	0xF0, 0xA1, 0xA2, 0x62, 0xEB, 0x6B, 0x60, 0x4C, 0x1C, 0xF4, 0x99, 0xB3, 0x26, 0xEC, 0x27, 0x2C,
+	0x01, 0x05, 0xFF, 0x23, 0x2C, 0x68, 0x5C, 0x35, 0x8D, 0x08, 0x21, 0xFF, 0x90, 0xA5, 0x09, 0xCB,
+	0x70, 0xD1, 0xB1, 0x44, 0x17, 0xF8, 0x50, 0xE1, 0x9B, 0x64, 0xFA, 0x37, 0x04, 0x03, 0x7E, 0x1C,
+	0x14, 0x33, 0x70, 0x9B, 0x62, 0xDC, 0x92, 0xC9, 0xE2, 0x82, 0x26, 0x46, 0x83, 0xFA, 0x1B, 0x14,
+	0x4C, 0x35, 0x50, 0x40, 0xD2, 0xB8, 0xDD, 0xAA, 0x6A, 0x4B, 0x45, 0xF2, 0x32, 0x3A, 0x24, 0x7B,
+	0xE8, 0xED, 0xC9, 0x24, 0x3F, 0x90, 0x46, 0x29, 0x5C, 0x26, 0xA3, 0xB6, 0x28, 0xD1, 0xF8, 0x40,
+	0x95, 0x23, 0xA8, 0x9F, 0x56, 0xD6, 0x12, 0x01, 0xEA, 0x15, 0x52, 0x8E, 0x13, 0x5F, 0x53, 0x56,
+	0x0A, 0x2F, 0xA8, 0x2C, 0x0A, 0x13, 0x89, 0xA7, 0x4C, 0xE1, 0x2A, 0x9E, 0x98, 0x21, 0x6C, 0x58,
+	0x7F, 0xB8, 0x36, 0x29, 0x9C, 0x4E, 0x65, 0x2C, 0x31, 0x60, 0xBF, 0xCD, 0x1B, 0x22, 0x79, 0x07,
+	0xB1, 0x23, 0x51, 0x98, 0x6D, 0x6D, 0x6D, 0x9B, 0x2E, 0x1B, 0x80, 0x51, 0xA8, 0x8E, 0x3D, 0xBA,
+	0x34, 0xC5, 0x1E, 0x49, 0x42, 0x0E, 0x06, 0x70, 0x9E, 0xE8, 0x1B, 0x34, 0xEB, 0x8E, 0xAB, 0x14,
+	0x6A, 0x82, 0x5F, 0xE4, 0x4D, 0xD0, 0x3C, 0x3A, 0x88, 0x88, 0x0C, 0x49, 0xE6, 0x9B, 0xB7, 0x20,
+	0xC0, 0xEC, 0x60, 0x22, 0x31, 0x00, 0xFE, 0xC2, 0xD9, 0xC6, 0xD5, 0xB8, 0x81, 0x89, 0x19, 0xC2,
+	0x6F, 0x62, 0x6E, 0xC1, 0x0E, 0xF8, 0x82, 0x62, 0x20, 0x79, 0xFD, 0x85, 0xB3, 0x0E, 0xD2, 0x7A,
+	0x12, 0x22, 0x46, 0x3D, 0x9E, 0xD6, 0xDC, 0x93, 0x19, 0xF0, 0x08, 0xD5, 0x08, 0x9E, 0xEF, 0x23,
+	0x6A, 0x49, 0xA0, 0xF4, 0x06, 0xA0, 0x04, 0xEF, 0x3D, 0x89, 0x33, 0x86, 0x02, 0xF8, 0x12, 0x92,
+	0x28, 0x24, 0xFF, 0x56, 0xCD, 0x92, 0xAB, 0xF1, 0x8C, 0x48, 0x81, 0x9E, 0xED, 0x43, 0x6A, 0x4B,
+	0x6B, 0xF4, 0x84, 0xAC, 0x40, 0xCD, 0xF5, 0x8D, 0x9C, 0x25, 0x53, 0xD3, 0x19, 0xA2, 0x32, 0x77,
+	0xF2, 0xB6, 0x30, 0x10, 0xEF, 0x08, 0x52, 0xA2, 0x42, 0xFF, 0x08, 0xDD, 0x90, 0xC5, 0xF0, 0x20,
+	0x50, 0xD4, 0xA2, 0xFF, 0x8B, 0x76, 0x0A, 0x67, 0xC4, 0x08, 0x1B, 0x17, 0x19, 0xF7, 0x2D, 0x59,
+	0x00, 0x5F, 0x02, 0x24, 0x48, 0x4B, 0x37, 0xD9, 0x31, 0x64, 0x0E, 0xF8, 0x10, 0xB1, 0x21, 0x66,
+	0xBE, 0xA6, 0xED, 0x85, 0xDF, 0x4A, 0x57, 0x04, 0x6C, 0xB8, 0x68, 0xDC, 0xA2, 0x17, 0xF8, 0x2A,
+	0x70, 0x48, 0xBA, 0xD8, 0xDB, 0x9A, 0x92, 0xBF, 0x08, 0x4A, 0x11, 0xB7, 0x0F, 0x43, 0x67, 0x50,
+	0x57, 0xC0, 0xA9, 0xA3, 0x33, 0x51, 0x46, 0x6E, 0x4A, 0x02, 0xFC, 0x15, 0x69, 0x64, 0x7B, 0x64,
+	0x4C, 0x09, 0x98, 0xFA, 0x14, 0x34, 0x2C, 0xDF, 0x64, 0x4C, 0x59, 0x1A, 0xBF, 0x02, 0xAC, 0x89,
+	0x0D, 0xE0, 0x4E, 0x68, 0x09, 0xDE, 0x22, 0x3C, 0x08, 0xCF, 0x64, 0x6C, 0xEB, 0x52, 0x9E, 0x86,
+	0x6D, 0x89, 0x4D, 0x69, 0x49, 0xDB, 0x2B, 0x3F, 0xC4, 0xA5, 0x01, 0x0D, 0xA0, 0x89, 0x1C, 0x20,
+	0x1F, 0xD0, 0xD4, 0xA5, 0x1B, 0xF5, 0x30, 0xB7, 0x04, 0xEA, 0xFA, 0xA3, 0x94, 0xA1, 0x2F, 0xD0,
+	0x86, 0xE4, 0x99, 0x4F, 0x41, 0x62, 0x82, 0x8F, 0xF8, 0x44, 0x95, 0x94, 0x47, 0xF0, 0x2A, 0x50,
+	0x90, 0xDA, 0x80, 0xD4, 0x96, 0x07, 0xB5, 0x2D, 0x5A, 0x4A, 0x9F, 0x50, 0xD8, 0xD2, 0x05, 0x3D,
+	0x0D, 0x5A, 0x0A, 0x1E, 0xD8, 0xD3, 0xB2, 0xC6, 0x3E, 0x89, 0x0D, 0x02, 0x17, 0xC8, 0x4B, 0x56,
+	0x58, 0xB7, 0xA1, 0xB9, 0x62, 0x33, 0xEA, 0x51, 0x76, 0x48, 0x17, 0xF0, 0x35, 0x60, 0x2B, 0x5F,
+	0x0A, 0x72, 0x8A, 0x8F, 0xD4, 0x33, 0x24, 0x2C, 0x7F, 0x41, 0x6E, 0xC8, 0x14, 0xFC, 0x06, 0x2C,
+	0x2C, 0x5F, 0xAA, 0x0C, 0x59, 0x0B, 0xBF, 0x82, 0xE5, 0x89, 0x4B, 0xE8, 0x0D, 0xCB, 0x22, 0x5B,
+	0x40, 0x95, 0xA1, 0x9B, 0xB4, 0x05, 0x3B, 0x2C, 0x63, 0xE8, 0x59, 0xD2, 0x33, 0x7D, 0xA9, 0x29,
+	0x64, 0x2B, 0x79, 0x12, 0x90, 0x02, 0xF7, 0xB0, 0xB6, 0x30, 0x90, 0xEF, 0x4A, 0x52, 0x92, 0xA7,
+	0xD6, 0x06, 0xCD, 0x94, 0x3D, 0xEC, 0x4E, 0x40, 0x50, 0xFA, 0xC2, 0x5B, 0xA2, 0x43, 0xBF, 0x88,
+	0x89, 0x59, 0x17, 0xFA, 0x6B, 0x6A, 0x8B, 0x56, 0xD0, 0x16, 0x20, 0x2A, 0xED, 0xA0, 0xCD, 0x11,
+	0x35, 0x9B, 0x80, 0x19, 0xAC, 0x4B, 0x36, 0xD6, 0xB6, 0xC4, 0xB8, 0x4D, 0x44, 0x6E, 0x02, 0x26,
+	0x9B, 0xEA, 0x99, 0x56, 0x5A, 0x37, 0x8A, 0xB3, 0x89, 0x38, 0x7B, 0x71, 0x6C, 0x51, 0x81, 0xDE,
+	0x18, 0xEC, 0x64, 0xDD, 0xE1, 0xC1, 0xAA, 0x76, 0x52, 0x81, 0x90, 0xC1, 0x19, 0x6E, 0x93, 0xA6,
+	0x71, 0xF5, 0xCA, 0x6D, 0x73, 0x33, 0x28, 0xF1, 0x7A, 0x91, 0xB3, 0x45, 0x30, 0x99, 0x0A, 0xD4,
+	0x94, 0x6B, 0xF1, 0x6E, 0x0B, 0x8C, 0xB3, 0x64, 0x23, 0x50, 0x5B, 0x7E, 0xA5, 0xB3, 0x2E, 0x03,
+	0x8B, 0xC3, 0xA9, 0x43, 0x6E, 0xBE, 0x96, 0xCC, 0xBC, 0x8E, 0x2F, 0x26, 0x37, 0x06, 0x92, 0xED,
+	0x5B, 0x30, 0x78, 0x2D, 0x3B, 0x38, 0x90, 0x1A, 0xD9, 0xB5, 0x6C, 0xC3, 0xE9, 0xD0, 0x78, 0xA3,
+	0x72, 0x4C, 0x26, 0xB5, 0x37, 0x0F, 0x82, 0xC1, 0x7A, 0x89, 0x89, 0x6C, 0x9B, 0x60, 0xD9, 0x1B,
+	0x41, 0x04, 0xF0, 0xA6, 0xA4, 0xF0, 0x49, 0xEB, 0x66, 0x4F, 0x24, 0x07, 0xE2, 0x1B, 0x16, 0xE3,
+	0x2F, 0xC5, 0xB8, 0x7D, 0x10, 0x3B, 0xC4, 0x4C, 0x4B, 0x44, 0xDA, 0xA4, 0xC0, 0xF8, 0x08, 0xA7,
+	0x84, 0xB3, 0xA4, 0x8A, 0xEE, 0x13, 0x03, 0xE3, 0x01, 0xBC, 0x56, 0xE4, 0xA2, 0x1B, 0xFC, 0x6C,
+	0x0D, 0xC1, 0x87, 0x60, 0x43, 0x16, 0xC0, 0xF5, 0xF5, 0xB2, 0x3E, 0x04, 0x0D, 0xA1, 0x2C, 0x51,
+	0x81, 0x9F, 0xE4, 0x88, 0xDC, 0x00, 0xAF, 0x84, 0x33, 0x85, 0x8A, 0x5F, 0xCB, 0x52, 0x78, 0x08,
+	0x9F, 0x04, 0x84, 0xB2, 0x21, 0xBE, 0x0D, 0x09, 0xE9, 0x26, 0xFE, 0x43, 0x12, 0x58, 0xA5, 0xFE,
+	0x36, 0x6E, 0xC1, 0x09, 0xB0, 0x25, 0x49, 0x69, 0x53, 0xFC, 0x91, 0x9B, 0x02, 0x66, 0xF1, 0x05,
+	0x25, 0x00, 0xCF, 0xF9, 0x68, 0x5F, 0x08, 0x3B, 0xC2, 0x5C, 0x92, 0x85, 0x36, 0xF9, 0xA1, 0x35,
+	0x24, 0xDF, 0x80, 0x66, 0x8B, 0x8B, 0x3F, 0xD2, 0xDA, 0xBA, 0x12, 0x2F, 0xA4, 0xB1, 0x06, 0x05,
+	0xDF, 0xE2, 0x62, 0x6C, 0x10, 0x97, 0x42, 0x5C, 0x16, 0x06, 0x37, 0xF1, 0xB9, 0x2E, 0x24, 0x0F,
+	0xC0, 0x2E, 0x49, 0x23, 0x3F, 0xD0, 0xD8, 0x9E, 0x94, 0x27, 0xA0, 0xB3, 0x46, 0xA5, 0x8F, 0xEA,
+	0x4A, 0x5D, 0x09, 0x3B, 0x50, 0x91, 0xB3, 0x44, 0xA7, 0xD1, 0x27, 0x2D, 0x88, 0xCB, 0xE9, 0x48,
+	0x4B, 0xA3, 0x53, 0xD8, 0x98, 0x9B, 0x04, 0x25, 0xE0, 0x25, 0x25, 0xC5, 0x1D, 0xB4, 0x68, 0x5B,
+	0x89, 0x37, 0xE0, 0x12, 0x16, 0xE2, 0xCE, 0xF8, 0x24, 0x6D, 0xE1, 0x09, 0x74, 0x09, 0x09, 0x70,
+	0x6A, 0xFD, 0x8A, 0x32, 0xF8, 0x48, 0xBF, 0x02, 0xCC, 0xB6, 0xB3, 0x3F, 0xC1, 0xA1, 0x36, 0x08,
+	0x4D, 0x80, 0x66, 0x5B, 0x4B, 0x53, 0xFA, 0x5B, 0x16, 0xD2, 0x8D, 0xFC, 0x16, 0x25, 0xB1, 0x93,
+	0xFE, 0x05, 0xB9, 0x6C, 0x44, 0x7B, 0x8A, 0x26, 0xE8, 0x10, 0x9F, 0xCA, 0xD1, 0x3E, 0xD2, 0xE5,
+	0xD4, 0xA4, 0x6C, 0xB1, 0x05, 0xBD, 0xC1, 0xA2, 0x3C, 0xC5, 0x4B, 0xA9, 0x60, 0xDA, 0x23, 0x23,
+	0xFD, 0x4B, 0x46, 0x69, 0x51, 0xBF, 0x54, 0x54, 0x92, 0x20, 0xB0, 0xF7, 0x86, 0x18, 0xB7, 0x92,
+	0x77, 0xC4, 0x15, 0x25, 0x08, 0x9F, 0xFD, 0x0D, 0x11, 0xC5, 0x08, 0x7B, 0x81, 0x66, 0xC3, 0x12,
+	0xBB, 0xD9, 0x52, 0x4E, 0x49, 0xC4, 0xB3, 0x74, 0x0B, 0x02, 0xD9, 0x17, 0xFA, 0x96, 0x90, 0xBA,
+	0x85, 0x27, 0xC4, 0xB1, 0x2C, 0x88, 0xEB, 0xB4, 0x09, 0x14, 0x2E, 0xC6, 0x4D, 0xEB, 0x25, 0x58,
+	0x20, 0x13, 0xED, 0x42, 0x49, 0x1F, 0x30, 0x02, 0xFE, 0x51, 0x12, 0x54, 0x47, 0xF6, 0x54, 0x43,
+	0x4E, 0x4F, 0x44, 0x1F, 0x92, 0x89, 0x13, 0x88, 0x36, 0xF7, 0x86, 0x89, 0xB7, 0x63, 0x36, 0xA1,
+	0xA2, 0x28, 0x81, 0x6D, 0xE1, 0x18, 0x86, 0xD0, 0xDB, 0x02, 0x07, 0xA1, 0x30, 0x25, 0x12, 0x4F,
+	0xAE, 0x89, 0x22, 0x44, 0xFE, 0x8D, 0x38, 0x45, 0x81, 0x15, 0xD6, 0xE8, 0x20, 0x0D, 0xA2, 0x6F,
+	0xF4, 0xE1, 0x72, 0x60, 0xC1, 0x34, 0xC3, 0x61, 0x00, 0x68, 0xB4, 0x36, 0xD0, 0x45, 0x69, 0x68,
+	0x89, 0x84, 0xE3, 0xD1, 0x02, 0x4C, 0x10, 0x8F, 0xFE, 0x43, 0x63, 0x2C, 0x83, 0xAC, 0xF3, 0x0D,
+	0x83, 0x25, 0x40, 0xB0, 0xFA, 0x83, 0x32, 0x2C, 0x99, 0x86, 0xB3, 0xD9, 0x03, 0x08, 0x32, 0x87,
+	0x9F, 0xC0, 0x44, 0x2D, 0x38, 0x2E, 0xB7, 0x41, 0x03, 0x4A, 0x08, 0xC1, 0xDF, 0xD0, 0x15, 0x05,
+	0xB2, 0x35, 0xB3, 0x4D, 0x3A, 0x2C, 0xCF, 0x4A, 0x73, 0x5F, 0x11, 0x83, 0x82, 0xCD, 0xD8, 0x00,
+	0x3D, 0x01, 0xB3, 0xB0, 0x24, 0xCD, 0xF5, 0x28, 0xEA, 0x59, 0x74, 0x5F, 0x44, 0x13, 0xC6, 0xC8,
+	0xDA, 0x14, 0x66, 0xFA, 0x16, 0x27, 0x21, 0x89, 0x75, 0x81, 0xCC, 0x32, 0x46, 0x7A, 0x0A, 0x12,
+	0x7F, 0x91, 0x17, 0x84, 0x4E, 0x18, 0x41, 0x27, 0x99, 0x31, 0x2E, 0x21, 0xC0, 0x7F, 0xC0, 0x91,
+	0xA3, 0x2A, 0xC1, 0xE0, 0xF0, 0x41, 0x1A, 0x17, 0xC5, 0x10, 0x97, 0xF8, 0x1A, 0xB6, 0x24, 0x70,
+	0xC2, 0x41, 0xE0, 0xAD, 0xA9, 0xE4, 0x06, 0x06, 0x77, 0x80, 0x8F, 0xC3, 0x26, 0xC0, 0x27, 0x9E,
+	0xC0, 0xD2, 0x82, 0x0F, 0x04, 0x67, 0x7C, 0x4A, 0xB8, 0x44, 0xA0, 0x9A, 0x75, 0x2C, 0xE1, 0xA3,
+	0x64, 0xD0, 0x08, 0x24, 0xE2, 0x35, 0x74, 0x42, 0x08, 0x20, 0x82, 0x79, 0xD1, 0x88, 0x41, 0xE0,
+	0x81, 0x8F, 0xA8, 0x6A, 0x5A, 0x88, 0x1E, 0x08, 0x20, 0x9E, 0x30, 0x74, 0x02, 0x08, 0x20, 0x6A,
+	0x7F, 0x09, 0x1A, 0x06, 0x40, 0x83, 0xC1, 0x3C, 0x10, 0x34, 0x31, 0x1E, 0x60, 0xA3, 0x9E, 0x86,
+	0x65, 0x81, 0x89, 0x3E, 0x81, 0x89, 0xE0, 0x64, 0x0F, 0x04, 0xF0, 0x06, 0x8E, 0xF4, 0xA3, 0xA8,
+	0x8C, 0x81, 0xE0, 0x82, 0x78, 0x03, 0x53, 0x08, 0x04, 0x10, 0x46, 0x3E, 0xA8, 0x89, 0xC8, 0x62,
+	0x79, 0x64, 0x62, 0x70, 0x82, 0x10, 0x4F, 0x34, 0x01, 0xA9, 0xAE, 0x29, 0x5C, 0x22, 0x50, 0x68,
+	0x20, 0x83, 0xC0, 0xD0, 0x9C, 0x48, 0x3C, 0x11, 0xA1, 0xB0, 0x2A, 0xE8, 0x12, 0x13, 0x88, 0x20,
+	0x83, 0xC4, 0x18, 0x9C, 0x49, 0xE0, 0x0D, 0x0F, 0x42, 0x8A, 0xE8, 0x12, 0x13, 0x88, 0x20, 0x9E,
+	0x06, 0x84, 0x1E, 0x09, 0xE0, 0x0D, 0x4D, 0x63, 0x52, 0xE8, 0x84, 0x76, 0x70, 0x40, 0x83, 0xC6,
+	0x44, 0xE2, 0x41, 0x26, 0x48, 0x5F, 0x43, 0x83, 0x85, 0x10, 0x9C, 0x41, 0x04, 0xF0, 0x34, 0x24,
+	0xE2, 0x4F, 0x00, 0x68, 0x7A, 0x11, 0x1F, 0x08, 0x94, 0xB0, 0x08, 0x24, 0xE2, 0x34, 0x34, 0x0B,
+	0x0D, 0x00, 0x6A, 0x6B, 0x03, 0x56, 0x68, 0x83, 0x96, 0x41, 0x04, 0xF0, 0x34, 0x20, 0xF0, 0x4F,
+	0x04, 0x61, 0xCD, 0x63, 0x56, 0x60, 0x40, 0x82, 0x08, 0x20, 0x93, 0xA0, 0xA6, 0x10, 0x41, 0x04,
+	0x11, 0x8F, 0x63, 0x82, 0x78, 0xC4, 0x10, 0x4E, 0xA0, 0x9E, 0x30, 0xA6, 0x10, 0x41, 0x27, 0x40,
+	0xED, 0x10, 0x83, 0xC7, 0x03, 0x96, 0x41, 0x04, 0x1E, 0x20, 0xC4, 0xE2, 0x41, 0x3A, 0x82, 0x70,
+	0x95, 0x9C, 0x28, 0x20, 0x82, 0x08, 0x27, 0x81, 0x88, 0x20, 0x82, 0x08, 0x20, 0x9F, 0x14, 0x26,
+	0x88, 0x31, 0x27, 0x80, 0x49, 0xC4, 0x0D, 0x4C, 0x20, 0x63, 0x89, 0x27, 0xC8, 0xC1, 0xC8, 0x0C,
+	0x78, 0x27, 0x08, 0x49, 0xD0, 0x3A, 0x01, 0x1E, 0x0A, 0x69, 0xCC, 0x43, 0x44, 0xA0, 0x82, 0x79,
+	0xA0, 0x82, 0x30, 0x27, 0x44, 0x4F, 0x18, 0x9F, 0xC2, 0x04, 0x8C, 0x38, 0x04, 0x9F, 0x1B, 0x20,
+	0x80, 0x35, 0x04, 0xE1, 0x0F, 0xA8, 0x50, 0x40, 0x1A, 0x80, 0x49, 0xC4, 0x93, 0xEA, 0xD2, 0x92,
+	0x91, 0x27, 0xD8, 0x44, 0x14, 0x10, 0x35, 0x67, 0xB1, 0xC0, 0xE6, 0xB8, 0xB3, 0x35, 0x8C, 0x81,
+	0xE7, 0x50, 0x4D, 0x3B, 0x22, 0x61, 0x03, 0x1F, 0x0C, 0xC0, 0x00
 };
 
+/* 3-bit ADPCM, SNR 15.8 dB */
 const u8 sfx_possessed_pain[] __attribute__((aligned(4))) = {
-	0x7B, 0x87, 0x57, 0x89, 0x99, 0x88, 0x9A, 0xA6, 0x44, 0x6A, 0xAA, 0xA9, 0x87, 0x55, 0x68, 0x9C,
-	0xCA, 0x96, 0x55, 0x68, 0x9A, 0xA9, 0x88, 0x88, 0x66, 0x67, 0x8A, 0xCC, 0x95, 0x35, 0x68, 0xAA,
-	0xBB, 0xA9, 0x53, 0x46, 0x9A, 0xCD, 0xB8, 0x43, 0x46, 0x9A, 0xBB, 0xB9, 0x75, 0x45, 0x79, 0xAC,
-	0xCB, 0x84, 0x34, 0x79, 0xAA, 0xAB, 0xA8, 0x43, 0x57, 0x9D, 0xDB, 0x85, 0x55, 0x68, 0x99, 0x9A,
-	0xBA, 0x75, 0x46, 0x79, 0xBC, 0xBA, 0x64, 0x45, 0x8A, 0xAB, 0xBB, 0x85, 0x34, 0x79, 0xCE, 0xC8,
-	0x44, 0x56, 0x89, 0x99, 0x99, 0xA9, 0x65, 0x56, 0x89, 0xCD, 0xB7, 0x43, 0x57, 0x99, 0xAB, 0xBA,
-	0x84, 0x34, 0x79, 0xCD, 0xC9, 0x64, 0x45, 0x78, 0xAC, 0xCB, 0x85, 0x34, 0x68, 0xBD, 0xB9, 0x76,
-	0x55, 0x67, 0x9A, 0xCC, 0xA7, 0x44, 0x67, 0x89, 0xBC, 0xB8, 0x43, 0x57, 0x8A, 0xDC, 0xA6, 0x45,
-	0x67, 0x9B, 0xBA, 0x98, 0x75, 0x66, 0x79, 0xBC, 0xB8, 0x55, 0x57, 0x9A, 0xAA, 0x88, 0x87, 0x66,
-	0x68, 0x9D, 0xDA, 0x53, 0x57, 0x8B, 0xCA, 0x86, 0x67, 0x77, 0x88, 0xAB, 0xA7, 0x45, 0x68, 0xAB,
-	0xA8, 0x76, 0x77, 0x78, 0x89, 0xAB, 0xA7, 0x66, 0x78, 0x99, 0x9A, 0x99, 0x86, 0x56, 0x78, 0xBD,
-	0xC8, 0x32, 0x58, 0xAC, 0xCA, 0x86, 0x66, 0x67, 0x88, 0xAB, 0xCA, 0x63, 0x47, 0x9B, 0xCB, 0x96,
-	0x56, 0x77, 0x89, 0x9A, 0xBA, 0x85, 0x46, 0x79, 0xAC, 0xCA, 0x63, 0x46, 0x89, 0x9B, 0xCA, 0x74,
-	0x46, 0x8A, 0xCC, 0xA7, 0x55, 0x56, 0x89, 0xAA, 0xA9, 0x86, 0x56, 0x78, 0x9B, 0xB9, 0x86, 0x66,
-	0x67, 0x8B, 0xDC, 0x83, 0x35, 0x79, 0xCC, 0xA7, 0x65, 0x66, 0x88, 0xAB, 0xBA, 0x64, 0x56, 0x8A,
-	0xBB, 0x97, 0x67, 0x77, 0x88, 0x9A, 0xB9, 0x76, 0x66, 0x79, 0xAA, 0xA9, 0x86, 0x56, 0x78, 0x8B,
-	0xDC, 0x73, 0x36, 0x8A, 0xCC, 0x97, 0x66, 0x66, 0x78, 0x9B, 0xCB, 0x74, 0x35, 0x8A, 0xCC, 0x97,
-	0x66, 0x76, 0x78, 0xAB, 0xBA, 0x75, 0x46, 0x89, 0xAC, 0xB9, 0x74, 0x46, 0x89, 0xAC, 0xB9, 0x64,
-	0x57, 0x8A, 0xBB, 0x98, 0x76, 0x56, 0x89, 0xBB, 0xB9, 0x65, 0x57, 0x89, 0xAA, 0x99, 0x87, 0x66,
-	0x68, 0x9C, 0xEB, 0x62, 0x26, 0x8B, 0xDC, 0x96, 0x55, 0x67, 0x8A, 0xBC, 0xB7, 0x44, 0x58, 0xAB,
-	0xBA, 0x86, 0x66, 0x68, 0x89, 0xAA, 0xA8, 0x65, 0x67, 0x8A, 0xBA, 0x98, 0x76, 0x56, 0x78, 0xBE,
-	0xD9, 0x32, 0x47, 0x9C, 0xDA, 0x76, 0x56, 0x67, 0x89, 0xAB, 0xB8, 0x54, 0x57, 0xAC, 0xCA, 0x86,
-	0x66, 0x78, 0x89, 0x9A, 0xA9, 0x75, 0x56, 0x79, 0xDC, 0x84, 0x25, 0x89, 0xBC, 0xB9, 0x75, 0x56,
-	0x78, 0xAC, 0xBA, 0x75, 0x46, 0x89, 0xAB, 0xA9, 0x76, 0x66, 0x78, 0xAA, 0xA9, 0x87, 0x66, 0x67,
-	0x8A, 0xDC, 0xA5, 0x24, 0x68, 0xBE, 0xC9, 0x54, 0x56, 0x89, 0xAB, 0xA9, 0x76, 0x55, 0x79, 0xBB,
-	0xB8, 0x65, 0x67, 0x89, 0x99, 0x99, 0x98, 0x65, 0x56, 0x8B, 0xED, 0xA4, 0x14, 0x79, 0xCD, 0xB8,
-	0x65, 0x66, 0x78, 0xAB, 0xBB, 0x85, 0x34, 0x7A, 0xBB, 0xA8, 0x66, 0x66, 0x78, 0x9A, 0xBB, 0x97,
-	0x45, 0x67, 0x9A, 0xCC, 0x96, 0x34, 0x68, 0xAC, 0xCA, 0x75, 0x46, 0x78, 0xAB, 0xBA, 0x86, 0x55,
-	0x79, 0xAA, 0xA9, 0x87, 0x76, 0x67, 0x89, 0xAB, 0xB9, 0x64, 0x46, 0x7A, 0xEE, 0xB6, 0x23, 0x58,
-	0xAC, 0xB9, 0x87, 0x65, 0x57, 0x9A, 0xBB, 0x97, 0x55, 0x68, 0x9A, 0xA9, 0x88, 0x87, 0x66, 0x78,
-	0x9B, 0xCA, 0x73, 0x36, 0x8A, 0xDD, 0xA7, 0x44, 0x67, 0x99, 0xBB, 0xA8, 0x55, 0x58, 0xAB, 0xB9,
-	0x87, 0x67, 0x77, 0x99, 0x99, 0x88, 0x88, 0x76, 0x67, 0x8B, 0xCB, 0x84, 0x35, 0x79, 0xCD, 0xB8,
-	0x64, 0x56, 0x8A, 0xAB, 0xA9, 0x75, 0x56, 0x8A, 0xBA, 0x98, 0x76, 0x67, 0x78, 0xAA, 0xA9, 0x76,
-	0x67, 0x89, 0x99, 0x99, 0xA9, 0x75, 0x56, 0x8A, 0xDC, 0x95, 0x35, 0x89, 0xAA, 0x98, 0x88, 0x76,
-	0x57, 0x9A, 0xBA, 0x96, 0x56, 0x78, 0x99, 0x99, 0x98, 0x76, 0x67, 0x89, 0x98, 0x88, 0x99, 0x75,
-	0x57, 0x9B, 0xCB, 0x85, 0x56, 0x78, 0x9A, 0xA9, 0x86, 0x77, 0x78, 0x8A, 0xAA, 0x86, 0x56, 0x89,
-	0x99, 0x88, 0x89, 0x98, 0x76, 0x67, 0x8A, 0xCB, 0x85, 0x45, 0x79, 0xBC, 0xB8, 0x56, 0x77, 0x89,
-	0xA9, 0x98, 0x76, 0x67, 0x88, 0x8A, 0xBB, 0xA7, 0x55, 0x56, 0x7A, 0xCC, 0xA7, 0x55, 0x57, 0x8A,
-	0xCC, 0xA9, 0x64, 0x46, 0x8A, 0xBB, 0xA8, 0x87, 0x66, 0x67, 0x8A, 0xCD, 0xB7, 0x43, 0x47, 0x9A,
-	0xCC, 0xAA, 0x76, 0x43, 0x78, 0xAC, 0xDB, 0x74, 0x45, 0x69, 0xAA, 0xAA, 0xAA, 0x84, 0x34, 0x7A,
-	0xBC, 0xB8, 0x66, 0x67, 0x89, 0xA9, 0x99, 0x77, 0x66, 0x78, 0x99, 0x8A, 0xA9, 0x97, 0x75, 0x69,
-	0x99, 0xA9, 0x86, 0x66, 0x78, 0xAB, 0xA9, 0x88, 0x87, 0x67, 0x88, 0x99, 0x98, 0x88, 0x78, 0x88,
-	0x88, 0x89, 0x99, 0x86, 0x56, 0x89, 0x89, 0xB8, 0x98, 0x87, 0x67, 0x88, 0x98, 0x77, 0x79, 0xA9,
-	0x77, 0x89, 0x9A, 0x87, 0x66, 0x89, 0x99, 0x77, 0x8A, 0xA9, 0x76, 0x78, 0x99, 0x88, 0x77, 0x78,
-	0x88, 0x87, 0x8A, 0x9A, 0x87, 0x76, 0x99, 0x78, 0x77, 0x88, 0x9A, 0x88, 0x89, 0x98, 0x77, 0x68,
-	0x99, 0x97, 0x66, 0x7B, 0xBB, 0x75, 0x76, 0x9A, 0x98, 0x66, 0x67, 0x79, 0xCA, 0xA8, 0x77, 0x67,
-	0x77, 0x89, 0xA9, 0x77, 0x77, 0x9A, 0x99, 0x89, 0x97, 0x87, 0x67, 0x67, 0x89, 0xDC, 0xA8, 0x56,
-	0x56, 0x99, 0x9A, 0x98, 0x87, 0x65, 0x7A, 0xAB, 0xA9, 0x86, 0x66, 0x67, 0x88, 0x89, 0x9A, 0x98,
-	0x97, 0x77, 0x78, 0x99, 0x87, 0x67, 0x78, 0xBB, 0x89, 0x88, 0x97, 0x77, 0x68, 0x88, 0x88, 0x8B,
-	0xA9, 0x96, 0x87, 0x68, 0x88, 0x98, 0x77, 0x76, 0x8B, 0xAB, 0x87, 0x76, 0x88, 0x77, 0x87, 0x88,
-	0x9A, 0x89, 0x88, 0x88, 0xB9, 0x87, 0x67, 0x77, 0x87, 0x8C, 0xCB, 0x86, 0x66, 0x78, 0x89, 0x98,
-	0x76, 0x77, 0x7B, 0xB9, 0x97, 0x98, 0x78, 0x77, 0x88, 0x88, 0x67, 0xBB, 0xA9, 0x67, 0x67, 0xA9,
-	0x88, 0x67, 0x77, 0x7A, 0xC9, 0x97, 0x87, 0x79, 0x88, 0x86, 0x66, 0x68, 0xCC, 0xA9, 0x67, 0x67,
-	0x98, 0x89, 0x78, 0x87, 0x78, 0xBA, 0x98, 0x88, 0x68, 0x98, 0x87, 0x66, 0x78, 0x8C, 0xCA, 0x86,
-	0x76, 0x89, 0x98, 0x77, 0x67, 0x79, 0xBA, 0x98, 0x78, 0x78, 0x98, 0x77, 0x67, 0x78, 0x9B, 0xAA,
-	0x97, 0x87, 0x78, 0x89, 0x87, 0x77, 0x77, 0x7C, 0xBA, 0x87, 0x86, 0x89, 0x77, 0x67, 0x87, 0x8A,
-	0xAA, 0x88, 0x77, 0x99, 0x98, 0x77, 0x66, 0x76, 0x7C, 0xCB, 0x97, 0x75, 0x69, 0x99, 0x76, 0x67,
-	0x89, 0xCB, 0x97, 0x78, 0x88, 0x97, 0x77, 0x67, 0x88, 0x9A, 0xA9, 0x97, 0x87, 0x79, 0x88, 0x86,
-	0x67, 0x78, 0x8B, 0xB9, 0x97, 0x76, 0x69, 0xA8, 0x87, 0x66, 0x77, 0x9C, 0xAA, 0x87, 0x86, 0x78,
-	0x77, 0x76, 0x78, 0x8B, 0xB9, 0x97, 0x78, 0x78, 0x98, 0x87, 0x67, 0x77, 0x79, 0xCB, 0xA7, 0x66,
-	0x68, 0xA9, 0x87, 0x66, 0x78, 0x8C, 0xB9, 0x87, 0x97, 0x78, 0x77, 0x77, 0x77, 0x7A, 0xCA, 0x97,
-	0x78, 0x78, 0x87, 0x87, 0x67, 0x88, 0x8A, 0xB9, 0x97, 0x87, 0x79, 0x78, 0x87, 0x76, 0x77, 0x8C,
-	0xA9, 0x88, 0x87, 0x89, 0x77, 0x77, 0x77, 0x88, 0xCB, 0x98, 0x78, 0x77, 0x98, 0x77, 0x66, 0x88,
-	0x9B, 0xA9, 0x97, 0x97, 0x78, 0x77, 0x87, 0x77, 0x77, 0x8B, 0xAA, 0x87, 0x87, 0x89, 0x87, 0x76,
-	0x68, 0x99, 0xAA, 0x99, 0x87, 0x87, 0x89, 0x87, 0x76, 0x68, 0x79, 0xCA, 0xA9, 0x77, 0x76, 0x88,
-	0x88, 0x76, 0x78, 0x79, 0xC9, 0x99, 0x78, 0x87, 0x87, 0x67, 0x77, 0x88, 0xAA, 0x89, 0x88, 0x97,
-	0x87, 0x68, 0x98, 0x88, 0x77, 0x9A, 0xAA, 0x88, 0x76, 0x88, 0x88, 0x77, 0x77, 0x88, 0xBA, 0x9A,
-	0x88, 0x66, 0x87, 0x88, 0x77, 0x88, 0x8A, 0xA9, 0x98, 0x87, 0x78, 0x77, 0x98, 0x77, 0x77, 0x8B,
-	0xAA, 0x97, 0x76, 0x78, 0x78, 0x87, 0x77, 0x88, 0x9A, 0x9A, 0x99, 0x86, 0x76, 0x79, 0x88, 0x87,
-	0x87, 0xAA, 0xAA, 0x79, 0x76, 0x78, 0x88, 0x76, 0x78, 0x89, 0xA9, 0xA9, 0x88, 0x76, 0x78, 0x89,
-	0x97, 0x77, 0x78, 0xB9, 0xBA, 0x87, 0x66, 0x89, 0x88, 0x86, 0x77, 0x8B, 0xA9, 0xA8, 0x88, 0x66,
-	0x78, 0x99, 0x87, 0x77, 0x79, 0xAA, 0xB9, 0x76, 0x67, 0x98, 0x88, 0x77, 0x77, 0x6C, 0xDA, 0xA6,
-	0x76, 0x68, 0x98, 0x87, 0x77, 0x88, 0xA9, 0x89, 0x99, 0x96, 0x65, 0x6A, 0x99, 0x76, 0x78, 0xAA,
-	0xA8, 0x78, 0x78, 0x87, 0x88, 0x88, 0x87, 0x7A, 0xA9, 0x98, 0x98, 0x66, 0x58, 0xAA, 0x96, 0x67,
-	0x7B, 0xAA, 0x98, 0x86, 0x77, 0x78, 0x87, 0x87, 0x88, 0xA9, 0x79, 0x8A, 0x87, 0x66, 0x79, 0x98,
-	0x77, 0x77, 0xAA, 0x9A, 0x88, 0x77, 0x77, 0x89, 0x98, 0x87, 0x76, 0x9C, 0xAA, 0x87, 0x76, 0x89,
-	0x88, 0x88, 0x78, 0x89, 0xB8, 0x99, 0x79, 0x76, 0x77, 0x89, 0x87, 0x77, 0x9B, 0x9A, 0x97, 0x88,
-	0x77, 0x77, 0x88, 0x88, 0x78, 0xA9, 0x89, 0x89, 0x87, 0x66, 0x78, 0x99, 0x98, 0x77, 0x88, 0x9B,
-	0xAA, 0x65, 0x68, 0xAA, 0x85, 0x68, 0x99, 0xA8, 0x99, 0x99, 0x76, 0x67, 0x99, 0x87, 0x77, 0x7A,
-	0xA9, 0xA8, 0x88, 0x77, 0x78, 0xA8, 0x76, 0x77, 0x8C, 0xAA, 0x86, 0x87, 0x87, 0x78, 0x88, 0x88,
-	0x88, 0x99, 0x89, 0x9A, 0x86, 0x65, 0x8A, 0x98, 0x76, 0x78, 0xAA, 0x89, 0x89, 0x87, 0x76, 0x79,
-	0x98, 0x88, 0x77, 0xAB, 0x97, 0x88, 0x86, 0x78, 0x7A, 0xA9, 0x75, 0x56, 0x7B, 0xEC, 0x96, 0x66,
-	0x67, 0x77, 0x9C, 0xCA, 0x74, 0x46, 0x89, 0xAC, 0xAA, 0x88, 0x75, 0x66, 0x78, 0x9C, 0xC9, 0x63,
-	0x46, 0x8C, 0xCA, 0x98, 0x98, 0x64, 0x57, 0x9A, 0xBA, 0x87, 0x56, 0x99, 0x99, 0x88, 0x9A, 0x85,
-	0x45, 0x99, 0x9B, 0xC7, 0x87, 0x68, 0x78, 0x9A, 0x97, 0x75, 0x68, 0x89, 0x9B, 0xB9, 0x96, 0x55,
-	0x69, 0xA9, 0x87, 0x67, 0x8A, 0x99, 0x78, 0x99, 0xA9, 0x76, 0x55, 0x79, 0xAA, 0xBA, 0x77, 0x68,
-	0x87, 0x88, 0x9B, 0x96, 0x44, 0x78, 0xAD, 0xBA, 0x88, 0x76, 0x77, 0x89, 0x89, 0x88, 0x87, 0x76,
-	0x8A, 0xCC, 0x86, 0x56, 0x99, 0x87, 0x67, 0x7A, 0xBA, 0x97, 0x77, 0x88, 0x88, 0x88, 0x77, 0x77,
-	0x9A, 0x89, 0x99, 0x96, 0x56, 0x7A, 0xB8, 0x66, 0x77, 0x9A, 0x9A, 0x88, 0x98, 0x66, 0x67, 0x89,
-	0xAA, 0x98, 0x65, 0x6A, 0xCB, 0xB7, 0x56, 0x78, 0x87, 0x77, 0x88, 0xBB, 0x89, 0x77, 0x77, 0x78,
-	0x99, 0x88, 0x76, 0x77, 0x99, 0xBC, 0xA9, 0x64, 0x57, 0x9B, 0x97, 0x77, 0x78, 0xB8, 0x98, 0x8A,
-	0x87, 0x76, 0x78, 0x88, 0x87, 0x8B, 0xA8, 0x88, 0x97, 0x67, 0x79, 0xA8, 0x76, 0x67, 0x8C, 0xC9,
-	0x87, 0x87, 0x78, 0x77, 0x88, 0x99, 0x99, 0x86, 0x58, 0xBC, 0xC8, 0x65, 0x57, 0xA9, 0x88, 0x78,
-	0x9B, 0xA7, 0x78, 0x98, 0x77, 0x77, 0x99, 0x87, 0x78, 0x8A, 0x9B, 0x99, 0x96, 0x56, 0x8A, 0xA8,
-	0x76, 0x78, 0xCB, 0x99, 0x77, 0x77, 0x77, 0x77, 0x88, 0x9A, 0xBA, 0x64, 0x46, 0xAC, 0xB9, 0x76,
-	0x78, 0x76, 0x77, 0x9A, 0xBB, 0x97, 0x56, 0x78, 0x88, 0xAB, 0xA8, 0x64, 0x46, 0x99, 0xBD, 0xAA,
-	0x85, 0x54, 0x7A, 0xBB, 0x96, 0x56, 0x78, 0x9B, 0xA9, 0x98, 0x86, 0x67, 0x78, 0x98, 0x99, 0x98,
-	0x65, 0x59, 0xBC, 0xB9, 0x74, 0x47, 0x87, 0x88, 0xAA, 0xAA, 0x66, 0x78, 0x99, 0x99, 0x98, 0x75,
-	0x57, 0x88, 0xBB, 0x9A, 0x87, 0x65, 0x69, 0xAA, 0x97, 0x67, 0x99, 0x86, 0x6A, 0xAC, 0xC8, 0x43,
-	0x58, 0x99, 0x99, 0x88, 0xA8, 0x87, 0x78, 0x89, 0x99, 0x86, 0x67, 0x8A, 0xA9, 0x76, 0xAA, 0xBB,
-	0x64, 0x57, 0xAB, 0x97, 0x66, 0x7A, 0xB9, 0x97, 0x88, 0x88, 0x76, 0x78, 0x89, 0xA9, 0x87, 0x68,
-	0x9B, 0xA7, 0x67, 0x9A, 0x86, 0x65, 0x79, 0xCC, 0x87, 0x68, 0x87, 0x88, 0x89, 0x88, 0x77, 0x99,
-	0x96, 0x69, 0xAB, 0xA8, 0x64, 0x68, 0x88, 0x88, 0x88, 0xA9, 0x77, 0x89, 0x88, 0x97, 0x66, 0x77,
-	0x9C, 0xC9, 0x53, 0x58, 0xBC, 0xB8, 0x66, 0x89, 0x76, 0x67, 0x9A, 0xB9, 0x87, 0x67, 0x88, 0xAA,
-	0xA9, 0x65, 0x57, 0x89, 0x99, 0xAA, 0x88, 0x86, 0x66, 0x8B, 0xDB, 0x73, 0x26, 0x9A, 0xAA, 0xA7,
-	0x9B, 0x86, 0x55, 0x8A, 0xCB, 0x84, 0x46, 0x79, 0xCB, 0xA8, 0x77, 0x77, 0x77, 0x89, 0x88, 0x88,
-	0x79, 0xA8, 0x98, 0x99, 0x87, 0x76, 0x78, 0x88, 0x89, 0xAA, 0x85, 0x78, 0x9A, 0x97, 0x77, 0x97,
-	0x66, 0x89, 0x9B, 0xA7, 0x88, 0x98, 0x67, 0x88, 0x98, 0x77, 0x88, 0x98, 0x89, 0x9B, 0x96, 0x56,
-	0x89, 0x88, 0x77, 0x9B, 0xA7, 0x56, 0x9B, 0xCA, 0x74, 0x58, 0x99, 0x97, 0x78, 0x9B, 0x88, 0x87,
-	0x77, 0x8A, 0x99, 0x75, 0x57, 0x99, 0x9A, 0x79, 0x99, 0x96, 0x57, 0x8A, 0xB8, 0x65, 0x69, 0xAA,
-	0x77, 0x89, 0xCA, 0x75, 0x47, 0xA9, 0x98, 0x77, 0x8A, 0x98, 0x98, 0xA8, 0x76, 0x68, 0x87, 0x88,
-	0x99, 0x99, 0x67, 0x9A, 0xB7, 0x56, 0x7A, 0xA7, 0x66, 0x79, 0xAC, 0x87, 0x89, 0xA8, 0x66, 0x68,
-	0xA8, 0x77, 0x78, 0x9A, 0x75, 0x99, 0xCB, 0x85, 0x46, 0xA9, 0x87, 0x79, 0x9B, 0xB6, 0x77, 0x99,
-	0x77, 0x77, 0x98, 0x77, 0x89, 0x9A, 0x87, 0x99, 0xA9, 0x76, 0x57, 0x99, 0x88, 0x8A, 0xB9, 0x54,
-	0x58, 0xBD, 0xC8, 0x55, 0x78, 0x88, 0x88, 0x89, 0x98, 0x87, 0x88, 0x78, 0x9A, 0xB9, 0x64, 0x47,
-	0x8A, 0xBB, 0x97, 0x56, 0x68, 0xBB, 0xBA, 0x86, 0x65, 0x68, 0x89, 0x99, 0xBA, 0x96, 0x56, 0x78,
-	0xAD, 0xC8, 0x53, 0x46, 0x8A, 0xAA, 0xBB, 0xA8, 0x53, 0x57, 0x9C, 0xDB, 0x74, 0x35, 0x89, 0x99,
-	0xBA, 0xBB, 0x75, 0x34, 0x79, 0xBB, 0xA8, 0x77, 0x65, 0x68, 0x9B, 0xDB, 0x95, 0x45, 0x78, 0x89,
-	0xAA, 0xA9, 0x64, 0x47, 0xAC, 0xCA, 0x87, 0x88, 0x64, 0x57, 0xAC, 0xFC, 0x72, 0x15, 0x8C, 0xEC,
-	0x97, 0x66, 0x55, 0x79, 0xAA, 0xBA, 0x87, 0x66, 0x77, 0x8A, 0xCB, 0xA6, 0x33, 0x58, 0xAA, 0xBC,
-	0x98, 0x65, 0x66, 0x79, 0xBC, 0xB9, 0x42, 0x47, 0x9B, 0xCB, 0x98, 0x88, 0x65, 0x57, 0xBD, 0xC8,
-	0x43, 0x57, 0x99, 0xAA, 0x9A, 0x98, 0x64, 0x58, 0xAB, 0xA7, 0x67, 0x79, 0x38
+	0x6F, 0x5E, 0x80, 0x03, 0x02, 0xF7, 0xB1, 0xA1, 0x05, 0xBB, 0x42, 0xD2, 0x96, 0xFB, 0x12, 0x04,
+	0x6A, 0x06, 0xF2, 0x32, 0xDC, 0xFA, 0x02, 0x50, 0x33, 0x6F, 0x42, 0x60, 0x8D, 0xBC, 0x05, 0x83,
+	0x26, 0xDA, 0x06, 0x43, 0x93, 0xF8, 0x11, 0x02, 0x1D, 0xFC, 0x25, 0xA1, 0x7D, 0x80, 0x33, 0x22,
+	0x3B, 0xE8, 0x4B, 0x26, 0xFF, 0x61, 0x68, 0x01, 0xB6, 0xA1, 0x96, 0x76, 0xB0, 0x84, 0x64, 0x01,
+	0x7F, 0x41, 0x49, 0x9D, 0xEC, 0x28, 0xC2, 0x47, 0xFE, 0x04, 0x88, 0x9F, 0x50, 0x11, 0x44, 0x6F,
+	0xA9, 0x29, 0x9B, 0xAD, 0xA1, 0x16, 0x5C, 0xDB, 0x44, 0x01, 0x2B, 0x6D, 0x02, 0x09, 0x4D, 0xA0,
+	0x05, 0x11, 0x75, 0xD8, 0xC4, 0x91, 0xDB, 0x08, 0x88, 0x13, 0x89, 0xA8, 0x0D, 0xB3, 0xFC, 0x04,
+	0x31, 0x6E, 0x84, 0x44, 0x19, 0xDF, 0x82, 0x51, 0xBE, 0xC3, 0x03, 0x8C, 0xAD, 0xE4, 0x24, 0x80,
+	0xF0, 0xFA, 0x92, 0xDA, 0x9F, 0xC2, 0x81, 0x97, 0x61, 0x01, 0x51, 0x95, 0xF6, 0x08, 0x11, 0x37,
+	0x80, 0x80, 0x81, 0x5B, 0xE8, 0x4A, 0x2E, 0x6F, 0x41, 0x46, 0x31, 0xB6, 0x01, 0x15, 0x2F, 0xB2,
+	0x24, 0x08, 0x9B, 0x6A, 0x51, 0x4A, 0x6B, 0xA0, 0x89, 0x35, 0x3F, 0x84, 0x94, 0x36, 0x90, 0x04,
+	0x11, 0x1F, 0xE0, 0x4A, 0x33, 0xDA, 0x60, 0x71, 0x95, 0xF4, 0x10, 0xB2, 0x26, 0xDA, 0x94, 0x13,
+	0x57, 0xE8, 0x4A, 0x33, 0x69, 0x04, 0x45, 0x23, 0xBE, 0xA8, 0x95, 0x35, 0xA0, 0xD4, 0x91, 0x1F,
+	0xDA, 0xC8, 0x2E, 0x7B, 0xA2, 0x20, 0xB9, 0xBD, 0x24, 0xA2, 0x3D, 0xBA, 0xA4, 0x50, 0x9F, 0xD0,
+	0x88, 0x52, 0x8F, 0x6D, 0x4D, 0x33, 0xF6, 0x04, 0xA3, 0x76, 0x90, 0x92, 0xCA, 0xDF, 0x00, 0x88,
+	0x97, 0x61, 0x23, 0x05, 0x49, 0xFC, 0x05, 0x23, 0x6E, 0xD6, 0xA2, 0xDB, 0x9F, 0x40, 0x82, 0x1A,
+	0xC8, 0x01, 0x44, 0xBB, 0xFD, 0x29, 0x11, 0xB5, 0x10, 0x90, 0xC1, 0x9F, 0xF8, 0x52, 0x73, 0xDA,
+	0x88, 0x42, 0x6D, 0x40, 0x29, 0x99, 0xBD, 0xAC, 0x82, 0x6E, 0xF6, 0x04, 0x90, 0x97, 0x6A, 0x23,
+	0x49, 0xCD, 0xE9, 0x25, 0xA9, 0xEC, 0x01, 0x10, 0xAD, 0xF7, 0x06, 0x50, 0x9F, 0x40, 0x49, 0x02,
+	0x0B, 0xFE, 0x05, 0xB5, 0x37, 0xA5, 0x04, 0x2E, 0xB0, 0x02, 0x91, 0x3B, 0xFA, 0x52, 0x02, 0xEB,
+	0x20, 0x45, 0x23, 0x3F, 0xE0, 0x84, 0x54, 0xFA, 0x82, 0x91, 0x1B, 0xD8, 0x4A, 0x40, 0x5F, 0xE4,
+	0x64, 0x09, 0x75, 0x9E, 0x32, 0x59, 0xBF, 0xE8, 0x83, 0x52, 0xFC, 0x09, 0x26, 0x79, 0x6E, 0x0D,
+	0x02, 0x3E, 0xC0, 0x22, 0x06, 0xA2, 0x7B, 0x1A, 0x2C, 0xFF, 0x81, 0x29, 0x4D, 0x74, 0x40, 0x82,
+	0x36, 0xF0, 0x32, 0x67, 0x96, 0x98, 0x98, 0x93, 0x41, 0x3E, 0x89, 0xB1, 0x3F, 0x84, 0x96, 0x76,
+	0xB4, 0x94, 0x80, 0x9B, 0xD8, 0x5A, 0x36, 0xEB, 0x62, 0x0D, 0x81, 0xF4, 0x85, 0x11, 0x20, 0x7B,
+	0xE8, 0x53, 0x53, 0x6A, 0x50, 0x32, 0xD1, 0x3D, 0xCD, 0x11, 0x3F, 0x80, 0x92, 0x04, 0x9F, 0x58,
+	0xCA, 0x1A, 0x07, 0x3F, 0x89, 0x13, 0xB6, 0x00, 0x12, 0xA5, 0xF8, 0xC0, 0x83, 0x17, 0xF8, 0x19,
+	0x92, 0x88, 0xC7, 0xD4, 0x24, 0x95, 0xDE, 0x04, 0x4A, 0xBF, 0x00, 0x09, 0x38, 0x7B, 0x63, 0x31,
+	0x35, 0x37, 0xA2, 0x14, 0xD0, 0xDA, 0x88, 0x8A, 0x23, 0xCF, 0x81, 0x2C, 0x0B, 0xE4, 0xB0, 0x26,
+	0x91, 0xFB, 0x40, 0x89, 0x33, 0x8F, 0x66, 0x64, 0x21, 0xB5, 0x81, 0x20, 0x20, 0x9B, 0xFA, 0x5A,
+	0x06, 0xFB, 0x01, 0x29, 0x59, 0x7C, 0xD1, 0x22, 0x3B, 0x92, 0x79, 0xCB, 0x10, 0xDD, 0xA0, 0x29,
+	0x9B, 0x74, 0x1F, 0x14, 0x0C, 0x1E, 0x4E, 0x84, 0x10, 0x39, 0x3F, 0xC5, 0x88, 0x5F, 0x12, 0x5C,
+	0x54, 0x57, 0x00, 0xD5, 0xE0, 0x10, 0xBD, 0xC1, 0x81, 0x3C, 0x4A, 0x4F, 0x01, 0x52, 0xCD, 0x03,
+	0x12, 0x76, 0xA9, 0xF4, 0xF6, 0x30, 0x91, 0x42, 0xB8, 0x84, 0x6C, 0x33, 0x02, 0x7A, 0x1B, 0x13,
+	0xE3, 0x10, 0x97, 0x88, 0x4B, 0x74, 0x79, 0x29, 0x01, 0xA3, 0xBC, 0x01, 0xAB, 0x2A, 0x9C, 0x5C,
+	0xA9, 0x4D, 0xCB, 0xB8, 0x85, 0xC0, 0x6E, 0x97, 0x66, 0xE1, 0xB6, 0xF8, 0x22, 0x50, 0x28, 0xAE,
+	0x3E, 0x40, 0xC8, 0xFA, 0xA8, 0xDC, 0xC2, 0x43, 0xC4, 0xAC, 0x09, 0x9B, 0x98, 0x73, 0x62, 0x11,
+	0x5C, 0x27, 0x6E, 0x0F, 0x05, 0x52, 0x45, 0x48, 0x4B, 0x9B, 0x23, 0x7A, 0x5A, 0x40, 0x5D, 0xB1,
+	0x7D, 0x10, 0xA0, 0x67, 0xB8, 0xE6, 0xC5, 0x9D, 0x58, 0x6C, 0x40, 0x6E, 0x98, 0xB7, 0x8A, 0x9C,
+	0xA3, 0x81, 0x13, 0x3C, 0x61, 0x02, 0xA2, 0x79, 0x13, 0x63, 0x4C, 0x29, 0x72, 0x1E, 0x65, 0xCD,
+	0xCB, 0x24, 0xE8, 0xD1, 0xE8, 0x41, 0xB3, 0xED, 0x15, 0x91, 0xA8, 0xCA, 0x35, 0x2D, 0xC6, 0xA3,
+	0xAC, 0xEA, 0x22, 0xE4, 0xDC, 0xD0, 0x63, 0xBA, 0x08, 0x9B, 0x17, 0xD3, 0xD0, 0xC2, 0x93, 0x5B,
+	0x83, 0xCA, 0x18, 0x1B, 0x0C, 0x0F, 0x6C, 0x4D, 0x66, 0x2C, 0x4D, 0x21, 0x2D, 0xCD, 0x61, 0x11,
+	0xF8, 0x31, 0x51, 0x19, 0xA7, 0x38, 0x3A, 0x27, 0x84, 0x24, 0xC6, 0x9C, 0x60, 0xC5, 0x17, 0x05,
+	0x1B, 0xA3, 0x53, 0xC9, 0xC2, 0x54, 0x53, 0x1A, 0x70, 0x2A, 0x36, 0x7A, 0x45, 0x6D, 0x8D, 0xA4,
+	0x09, 0x4B, 0x70, 0x29, 0x39, 0xAC, 0x58, 0x0A, 0x04, 0x9D, 0xB5, 0x6E, 0x02, 0x19, 0xD5, 0xC5,
+	0x40, 0xD6, 0x98, 0xD0, 0xF0, 0x16, 0x55, 0xDB, 0x96, 0x41, 0x8A, 0xE2, 0x09, 0x13, 0x73, 0x4A,
+	0x70, 0x76, 0x8E, 0x18, 0x2E, 0xD9, 0xD6, 0x07, 0x03, 0x84, 0x1D, 0xB8, 0x35, 0x34, 0xAB, 0xA6,
+	0x0D, 0x45, 0x28, 0xD8, 0xD4, 0x75, 0x9C, 0x38, 0xDD, 0x17, 0x89, 0x58, 0x83, 0x62, 0xAB, 0x78,
+	0x4A, 0x65, 0x5A, 0x90, 0x12, 0x63, 0x8A, 0x17, 0x13, 0x23, 0x44, 0xE1, 0xA8, 0x3C, 0xB5, 0x81,
+	0x38, 0x81, 0x37, 0x2A, 0xF3, 0x05, 0x48, 0xC0, 0xC4, 0xC6, 0x94, 0x78, 0xB0, 0x72, 0xC8, 0x93,
+	0x83, 0x71, 0x49, 0xCA, 0x58, 0x18, 0x67, 0x2B, 0x3E, 0x38, 0xB9, 0x25, 0x79, 0x88, 0x39, 0xD4,
+	0x91, 0x3D, 0x44, 0x33, 0x95, 0xD2, 0xE4, 0x63, 0x9E, 0x08, 0xDD, 0x53, 0x5A, 0x19, 0xB2, 0x70,
+	0x5B, 0x94, 0xF9, 0x3C, 0x2C, 0xCD, 0x64, 0x6C, 0xC5, 0xF4, 0x85, 0xD1, 0x2C, 0x9D, 0xB7, 0x86,
+	0x12, 0x21, 0x45, 0x81, 0x87, 0x6A, 0x03, 0xF9, 0x93, 0x92, 0xD2, 0x90, 0x9E, 0x9A, 0x47, 0x50,
+	0x09, 0xD3, 0x16, 0x63, 0xB8, 0xCC, 0x8B, 0xE0, 0x4E, 0x49, 0x87, 0x30, 0x19, 0x96, 0x51, 0xDA,
+	0xAB, 0xD2, 0x82, 0xC5, 0xC2, 0xB7, 0x21, 0xF2, 0x88, 0x1A, 0x98, 0x61, 0xDB, 0xA2, 0xD9, 0x5A,
+	0xB0, 0x4C, 0xA3, 0x5C, 0x0C, 0x74, 0x01, 0x1D, 0x41, 0x6F, 0x1B, 0xCC, 0xB0, 0x06, 0x24, 0xE9,
+	0xDA, 0xA9, 0xD7, 0x44, 0x88, 0x9E, 0xC4, 0x1B, 0x9B, 0xC0, 0x88, 0xF8, 0x20, 0x06, 0x00, 0x5F,
+	0xC1, 0x62, 0xE9, 0x13, 0x38, 0xF1, 0x28, 0x8D, 0xE9, 0x4E, 0x6E, 0x8B, 0xCC, 0x38, 0x11, 0x20,
+	0x81, 0x8E, 0x42, 0xFE, 0x46, 0xA5, 0xB5, 0x16, 0x38, 0x87, 0x51, 0x92, 0x16, 0x4E, 0x98, 0xD4,
+	0x09, 0xC3, 0xAC, 0x5F, 0x61, 0x6D, 0xDB, 0xA0, 0x00, 0x06, 0xCF, 0xD6, 0x22, 0x0B, 0xB3, 0x8B,
+	0xC0, 0x29, 0x39, 0xEE, 0x05, 0x39, 0x2C, 0x3B, 0x52, 0x91, 0x17, 0xDE, 0x58, 0x92, 0x84, 0xBF,
+	0x85, 0xC0, 0xA7, 0x12, 0xA8, 0x0A, 0xBE, 0x72, 0xA1, 0x0E, 0x69, 0xEC, 0x4C, 0x4B, 0x6A, 0x4A,
+	0xCE, 0x48, 0x5B, 0xCA, 0x1A, 0x00, 0xEF, 0x2B, 0x90, 0xC6, 0xB6, 0xB1, 0x92, 0xEC, 0xD2, 0xD5,
+	0x11, 0xA7, 0x41, 0xC7, 0x69, 0x4F, 0x60, 0x62, 0xCA, 0x13, 0x56, 0xE8, 0x08, 0x10, 0x4F, 0x23,
+	0x67, 0x98, 0x37, 0xC4, 0xB3, 0xEC, 0x21, 0x9A, 0xBC, 0x37, 0xC0, 0x52, 0x33, 0x6D, 0x53, 0x52,
+	0x7A, 0x09, 0x96, 0x46, 0x98, 0xE3, 0x41, 0x02, 0x23, 0x8F, 0x54, 0x61, 0x8B, 0xBD, 0x09, 0x1D,
+	0x44, 0x8D, 0xE1, 0x22, 0xB4, 0x62, 0xA0, 0x99, 0xB9, 0xA0, 0x3E, 0x90, 0xCF, 0xB4, 0x26, 0xC7,
+	0x90, 0x50, 0x70, 0x51, 0x09, 0x3F, 0xCD, 0x01, 0xED, 0x09, 0x49, 0x2A, 0x2E, 0xF8, 0x4E, 0xA2,
+	0xA6, 0x35, 0x08, 0x38, 0xF4, 0x9E, 0x96, 0x47, 0x94, 0xB7, 0x2C, 0xE2, 0x08, 0x20, 0x61, 0x27,
+	0xBD, 0x89, 0x89, 0x6D, 0x2A, 0xE2, 0x1A, 0x33, 0xEC, 0x41, 0x81, 0xAB, 0xEE, 0x89, 0xC2, 0xB0,
+	0xD6, 0x46, 0x80, 0xDA, 0x02, 0x4B, 0x98, 0x61, 0xA1, 0x08, 0xE5, 0x07, 0xD8, 0xB2, 0x6E, 0xDC,
+	0x13, 0x54, 0x70, 0xEF, 0x08, 0x50, 0x41, 0xF6, 0x8C, 0x16, 0x30, 0xD6, 0x54, 0xCC, 0xBE, 0x96,
+	0x2F, 0x0C, 0xAB, 0xFC, 0x28, 0x09, 0x29, 0x7A, 0x50, 0xA2, 0x13, 0xF8, 0x52, 0x17, 0x76, 0x04,
+	0xF8, 0x16, 0x2E, 0x91, 0x21, 0x66, 0x30, 0x4F, 0x4B, 0x08, 0xEB, 0xB3, 0x0A, 0x7A, 0x51, 0xF4,
+	0x54, 0x9C, 0xD2, 0xA9, 0x0C, 0x0B, 0x0C, 0x18, 0xBE, 0x32, 0x6F, 0xF5, 0x18, 0x20, 0x89, 0xDF,
+	0x0A, 0xB1, 0x7A, 0x14, 0x6C, 0x7D, 0x02, 0x26, 0xFB, 0x18, 0xB6, 0x26, 0x0F, 0x96, 0x97, 0x18,
+	0x1F, 0xC8, 0x88, 0x01, 0x5F, 0x27, 0x85, 0xB5, 0x7E, 0x88, 0x88, 0x27, 0x2B, 0x5A, 0x1A, 0x33,
+	0xF8, 0x49, 0x72, 0xE9, 0x04, 0x01, 0xAB, 0x20, 0xED, 0x61, 0x0C, 0xD6, 0x74, 0x60, 0x8D, 0xCF,
+	0xC8, 0x27, 0x68, 0x1E, 0x91, 0x80, 0xEF, 0x00, 0xEC, 0x40, 0x37, 0xC4, 0x16, 0x0A, 0x3D, 0xA9,
+	0x42, 0x4C, 0x1A, 0x9E, 0x86, 0x4E, 0xF4, 0x31, 0x06, 0x85, 0x2E, 0x24, 0x91, 0x3A, 0x3D, 0x8C,
+	0x88, 0xB9, 0x87, 0x7A, 0x8A, 0x1E, 0xD4, 0x80, 0xF0, 0x25, 0x75, 0xAD, 0x49, 0x2C, 0x4E, 0xC3,
+	0x9E, 0x92, 0x21, 0x48, 0x70, 0xFE, 0x18, 0x1F, 0x02, 0xE6, 0x90, 0xB0, 0xFC, 0x00, 0xEB, 0x03,
+	0x5A, 0x08, 0x43, 0xF9, 0xC5, 0x35, 0x89, 0x4B, 0x02, 0x8E, 0x78, 0x08, 0xD0, 0x07, 0x6C, 0x64,
+	0x3F, 0x50, 0x3B, 0x5A, 0xD0, 0xB0, 0x35, 0xF4, 0x09, 0x1B, 0xEC, 0x40, 0x48, 0x02, 0x1E, 0x55,
+	0x32, 0x29, 0x7D, 0x63, 0x24, 0xCF, 0xB1, 0x89, 0x09, 0x76, 0x90, 0xB0, 0x61, 0x77, 0xFA, 0x4A,
+	0x6A, 0x7D, 0x01, 0x28, 0x42, 0x3F, 0xD4, 0xA4, 0x85, 0xFA, 0x14, 0x04, 0x50, 0xEF, 0x70, 0x64,
+	0xCB, 0xA8, 0xD5, 0x22, 0xCE, 0xDA, 0x02, 0x42, 0x31, 0x7F, 0x63, 0x46, 0x5D, 0x48, 0xF8, 0x26,
+	0x5D, 0xF6, 0x14, 0x8D, 0xD6, 0x49, 0x1A, 0x31, 0x5F, 0x64, 0x51, 0x33, 0x3F, 0xB1, 0x23, 0x02,
+	0xF2, 0xD3, 0x13, 0x27, 0x6F, 0x4A, 0x28, 0x4D, 0x44, 0xF4, 0x36, 0xA7, 0xB4, 0xA2, 0x00, 0xAB,
+	0x5F, 0x83, 0x26, 0xFA, 0x73, 0xE8, 0x00
 };
 
+/* 3-bit ADPCM, SNR 15.0 dB */
 const u8 sfx_possessed_activity[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x78, 0x78, 0x87, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x78, 0x88, 0x78, 0x88, 0x88, 0x78, 0x78, 0x87, 0x78, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x87, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x78, 0x88, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x87, 0x78, 0x77, 0x88, 0x88,
-	0x87, 0x88, 0x77, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
-	0x99, 0x88, 0x98, 0x88, 0x88, 0x88, 0x87, 0x88, 0x77, 0x97, 0x88, 0x88, 0x77, 0x76, 0x77, 0x78,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x99, 0x99, 0x89, 0x98, 0x89, 0x98, 0x89,
-	0x88, 0x77, 0x88, 0x88, 0x88, 0x78, 0x86, 0x77, 0x67, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x89, 0x88, 0x98, 0x99, 0x89, 0x87, 0x97, 0x89, 0x68, 0x87, 0x89, 0x78, 0x88,
-	0x77, 0x77, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89,
-	0x98, 0x98, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x87, 0x78, 0x77, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x98, 0x98, 0x89, 0x88, 0x88, 0x78, 0x89, 0x88, 0x98,
-	0x78, 0x87, 0x78, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x89, 0x89, 0x98,
-	0x89, 0x78, 0x89, 0x68, 0x97, 0x79, 0x87, 0x97, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x88, 0x88, 0x89, 0x89, 0x88, 0x89, 0x78, 0x88, 0x78, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x98, 0x89, 0x87, 0x89,
-	0x67, 0x97, 0x69, 0x86, 0x98, 0x87, 0x88, 0x78, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x78, 0x98,
-	0x99, 0x98, 0x98, 0x98, 0x98, 0x87, 0x68, 0x76, 0x88, 0x6A, 0x87, 0x97, 0x78, 0x87, 0x88, 0x88,
-	0x88, 0x87, 0x87, 0x78, 0x88, 0x99, 0x88, 0x89, 0x89, 0x97, 0x88, 0x87, 0x88, 0x87, 0xA8, 0x79,
-	0x97, 0x78, 0x67, 0x78, 0x88, 0x98, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x98, 0x99, 0x88, 0x98,
-	0x99, 0x89, 0x78, 0x97, 0x78, 0x78, 0x86, 0x87, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x88,
-	0x89, 0x89, 0x98, 0x89, 0x99, 0x99, 0x89, 0x86, 0x87, 0x78, 0x87, 0x88, 0x88, 0x88, 0x78, 0x87,
-	0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x98, 0x99, 0x88, 0x98, 0x88, 0x79, 0x77, 0x99,
-	0x5A, 0x97, 0x89, 0x66, 0x87, 0x78, 0x98, 0x79, 0x87, 0x88, 0x88, 0x87, 0x88, 0x89, 0x98, 0x89,
-	0x88, 0x98, 0x99, 0x79, 0x87, 0x87, 0x77, 0x78, 0x87, 0x98, 0x78, 0x87, 0x88, 0x87, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x89, 0x88, 0x98, 0x88, 0x98, 0x79, 0x88, 0x88, 0x88, 0x78,
-	0x66, 0x87, 0x88, 0x88, 0x78, 0x87, 0x88, 0x77, 0x87, 0x89, 0x99, 0x99, 0x98, 0x99, 0x89, 0x89,
-	0x77, 0x88, 0x58, 0x86, 0x98, 0x87, 0x87, 0x77, 0x87, 0x78, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x98, 0x79, 0x98, 0x99, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87,
-	0x68, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98,
-	0x78, 0x87, 0x88, 0x78, 0x88, 0x87, 0x87, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
-	0x88, 0x98, 0x99, 0x98, 0x98, 0x97, 0x69, 0x78, 0x69, 0x58, 0x68, 0x85, 0x97, 0x88, 0x97, 0x97,
-	0x88, 0x79, 0x78, 0x89, 0x99, 0x99, 0x98, 0x98, 0x99, 0x97, 0xA8, 0x67, 0x86, 0x68, 0x86, 0x69,
-	0x67, 0x88, 0x78, 0x88, 0x88, 0x87, 0x88, 0x87, 0x99, 0x98, 0x99, 0x89, 0x89, 0x9B, 0x79, 0x88,
-	0x68, 0x86, 0x77, 0x85, 0x87, 0x76, 0x88, 0x78, 0x88, 0x89, 0x78, 0x88, 0x78, 0x98, 0x99, 0x99,
-	0x98, 0x98, 0xA8, 0x9A, 0x77, 0x87, 0x88, 0x69, 0x78, 0x86, 0x78, 0x77, 0x88, 0x87, 0x98, 0x78,
-	0x87, 0x88, 0x9A, 0x89, 0x89, 0x88, 0x89, 0x88, 0x88, 0x78, 0x88, 0x78, 0x78, 0x77, 0x87, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x97, 0x99, 0x98, 0x98, 0x78, 0x87, 0x89, 0x88, 0x88, 0x78, 0x77,
-	0x77, 0x78, 0x78, 0x78, 0x88, 0x88, 0x98, 0x89, 0x98, 0xA8, 0x88, 0x88, 0x77, 0x86, 0x88, 0x88,
-	0x97, 0x87, 0x78, 0x78, 0x88, 0x88, 0x78, 0x78, 0x88, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x77,
-	0x98, 0x69, 0x97, 0x78, 0x76, 0x78, 0x67, 0x97, 0x79, 0x88, 0x78, 0x87, 0x78, 0x78, 0xA8, 0x99,
-	0xA8, 0xA9, 0x97, 0x87, 0x87, 0x79, 0x88, 0x97, 0x79, 0x78, 0x77, 0x77, 0x78, 0x68, 0x97, 0x88,
-	0x78, 0x88, 0x98, 0x99, 0x89, 0x88, 0x88, 0x87, 0x97, 0x97, 0x97, 0x98, 0x88, 0x79, 0x78, 0x77,
-	0x78, 0x77, 0x77, 0x87, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x87, 0x87, 0x78, 0x77, 0x97, 0x78,
-	0x87, 0x78, 0x77, 0x88, 0x78, 0x98, 0x89, 0x98, 0x88, 0x98, 0x99, 0x88, 0x99, 0x88, 0x99, 0x68,
-	0x88, 0x69, 0x97, 0x79, 0x76, 0x88, 0x77, 0x98, 0x79, 0x87, 0x88, 0x87, 0x88, 0x77, 0x89, 0x98,
-	0x99, 0x89, 0x98, 0xA9, 0x88, 0xA5, 0x79, 0x77, 0x88, 0x67, 0x87, 0x59, 0x76, 0x89, 0x87, 0x98,
-	0x78, 0x98, 0x79, 0x88, 0x89, 0x88, 0x99, 0x89, 0x98, 0x89, 0x78, 0x78, 0x88, 0x78, 0x77, 0x77,
-	0x77, 0x87, 0x88, 0x98, 0x88, 0x88, 0x78, 0x87, 0x78, 0x88, 0x98, 0x98, 0x89, 0x89, 0x98, 0x88,
-	0x76, 0x87, 0x77, 0x97, 0x88, 0x87, 0x78, 0x77, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x89, 0x98, 0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x88, 0x98, 0x99, 0x88, 0x89, 0x77, 0x88, 0x78, 0x87,
-	0x78, 0x77, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x98, 0x99, 0x88,
-	0x88, 0x88, 0x87, 0x89, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x98, 0x99, 0x89, 0x89, 0x89, 0x87, 0x98, 0x68, 0x88, 0x78, 0x86, 0x88, 0x77, 0x87, 0x87,
-	0x98, 0x79, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x98, 0x89, 0x99, 0x89, 0x78, 0x77, 0x86, 0x88,
-	0x78, 0x97, 0x78, 0x87, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x77, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x87, 0x78, 0x88, 0x99, 0x99, 0x99, 0x89, 0x99, 0x97, 0x98, 0x77, 0x87, 0x78, 0x77, 0x78, 0x77,
-	0x87, 0x78, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x88, 0x98, 0x89, 0x88, 0x89, 0x87, 0x98, 0x87,
-	0x98, 0x78, 0x88, 0x78, 0x77, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88,
-	0x89, 0x89, 0x88, 0x98, 0x88, 0x88, 0x87, 0x87, 0x77, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x89, 0x88, 0x98, 0x88, 0x87, 0x78, 0x87, 0x88, 0x78,
-	0x98, 0x78, 0x87, 0x78, 0x87, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x98, 0x99, 0x88, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x89, 0x88, 0x99, 0x88, 0x87, 0x78, 0x78, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x87, 0x78, 0x87, 0x88, 0x87, 0x88, 0x78, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x78, 0x76, 0x87, 0x77, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x78,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x78, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0x77, 0x88, 0x78,
-	0x87, 0x88, 0x87, 0x88, 0x78, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x87, 0x88, 0x77, 0x87, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x78, 0x88, 0x78, 0x88, 0x87, 0x87, 0x87, 0x78, 0x78,
-	0x78, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x78, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88,
-	0x87, 0x77, 0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x87, 0x77, 0x77, 0x78, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x77, 0x88, 0x77, 0x87, 0x87, 0x87, 0x77, 0x77, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x88,
-	0x87, 0x88, 0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x87, 0x88, 0x78, 0x88, 0x78, 0x77, 0x88, 0x77,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x78, 0x87, 0x88, 0x87, 0x88, 0x78, 0x88, 0x78, 0x77, 0x87, 0x78, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x78, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88,
-	0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x78, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x48
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x9D, 0x09, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x13, 0xA9, 0x54, 0xCA, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xA9, 0x94, 0xAB, 0x11, 0x88,
+	0xEA, 0x08, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0xEA, 0x65, 0x2A, 0x95, 0x09, 0x04, 0x9D, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x4E, 0x84,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x75, 0x2A, 0x83,
+	0xA8, 0x04, 0xEB, 0x11, 0xA2, 0xAA, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x9D, 0x09, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x9D,
+	0x0C, 0x47, 0x23, 0xA9, 0x54, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x49, 0xD0, 0xC4, 0x4E, 0xB1, 0xAB, 0x1A, 0xA9, 0x02, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x93, 0xA1, 0x8E, 0x07, 0x04, 0x20, 0x9D, 0x4C, 0x16, 0x04,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x18, 0x83, 0xC7, 0x84, 0x10, 0x49, 0xD0, 0xE1, 0xE3,
+	0x20, 0xC2, 0x72, 0x03, 0x10, 0x4E, 0xA0, 0x82, 0x4E, 0x84, 0x11, 0x89, 0x3A, 0x1A, 0x21, 0xA2,
+	0xB3, 0x85, 0x04, 0x13, 0xA9, 0xC0, 0xC5, 0x55, 0x00, 0x82, 0x08, 0x20, 0x82, 0x08, 0xF2, 0xB1,
+	0x55, 0x32, 0xB9, 0x62, 0x39, 0x14, 0xAE, 0x00, 0xD0, 0x41, 0x1E, 0x50, 0x40, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0xF2, 0x95, 0x61, 0x04, 0x9D, 0x0C, 0x44, 0x12, 0x70, 0xB0, 0x58, 0x88, 0x20,
+	0x82, 0x08, 0x20, 0x0F, 0x40, 0x16, 0x56, 0x3C, 0x20, 0xE4, 0x3C, 0x0E, 0xAA, 0x60, 0xA0, 0x82,
+	0x75, 0x00, 0x82, 0x08, 0x23, 0x1C, 0x1C, 0xA6, 0x0B, 0x88, 0xF9, 0x18, 0x2B, 0x16, 0x10, 0xE3,
+	0x56, 0x20, 0x48, 0x20, 0x82, 0x00, 0xF4, 0x02, 0x3C, 0xAC, 0x8F, 0x98, 0x31, 0x10, 0x41, 0xE0,
+	0x81, 0x89, 0x04, 0x10, 0x41, 0x04, 0x10, 0x3C, 0x20, 0x78, 0x1D, 0x83, 0xE1, 0x5C, 0xE5, 0x52,
+	0x55, 0x2A, 0x95, 0x41, 0xD4, 0x10, 0x4E, 0x8D, 0x50, 0x75, 0x8D, 0x56, 0x7C, 0xE5, 0x43, 0xBB,
+	0x15, 0x84, 0x62, 0x20, 0x82, 0x75, 0x81, 0x11, 0x8E, 0x22, 0xAE, 0xF3, 0x07, 0x50, 0xF7, 0x6B,
+	0x96, 0x2E, 0x01, 0x11, 0xEA, 0xA5, 0x50, 0x08, 0x20, 0x59, 0x4B, 0x1E, 0x52, 0xAE, 0x0F, 0x07,
+	0x19, 0xD5, 0x04, 0x08, 0x24, 0xE8, 0x49, 0xD4, 0x0A, 0xA1, 0xE2, 0x10, 0x4C, 0xB7, 0x54, 0x19,
+	0x50, 0x82, 0x4E, 0xA5, 0x8F, 0x28, 0x20, 0x82, 0x08, 0x1E, 0x54, 0xCD, 0x1D, 0x83, 0xBD, 0x1C,
+	0xEE, 0x50, 0x7C, 0x52, 0x13, 0x73, 0xB5, 0x41, 0x27, 0x42, 0x39, 0x82, 0xC0, 0xE5, 0x3A, 0xB0,
+	0xE1, 0x02, 0x1D, 0xCC, 0x46, 0x22, 0x75, 0x2A, 0x80, 0x41, 0x04, 0x0E, 0x68, 0xEC, 0x78, 0x45,
+	0x73, 0xA2, 0x01, 0x3A, 0xF1, 0xD2, 0x20, 0xE4, 0x75, 0x2C, 0x75, 0x11, 0x04, 0x9D, 0x4A, 0xB1,
+	0xF1, 0x5E, 0xE5, 0x72, 0x41, 0x40, 0x7A, 0x21, 0x88, 0x10, 0x4E, 0xA0, 0x0F, 0x40, 0x20, 0x5B,
+	0x31, 0x48, 0xF0, 0x08, 0x27, 0x58, 0xD5, 0x8D, 0xCE, 0xA8, 0x20, 0x93, 0xA1, 0x27, 0x08, 0x21,
+	0x04, 0x10, 0x49, 0x96, 0xAA, 0x65, 0x2A, 0x82, 0x75, 0x81, 0xC1, 0x41, 0x04, 0x10, 0x41, 0x18,
+	0xE1, 0x62, 0x27, 0x55, 0x7A, 0xE9, 0xCB, 0x1A, 0xA6, 0x50, 0x43, 0xD5, 0x02, 0xBC, 0x01, 0x10,
+	0x49, 0x96, 0x27, 0x77, 0x71, 0x1A, 0x39, 0x83, 0xC0, 0xCA, 0xA0, 0x82, 0x75, 0x07, 0x62, 0x55,
+	0x32, 0xAA, 0xBE, 0x68, 0xE4, 0x73, 0x07, 0x72, 0x57, 0x21, 0x82, 0x3E, 0x04, 0xC8, 0xD4, 0x24,
+	0x99, 0xE5, 0x88, 0xF0, 0xD5, 0x3B, 0xA6, 0x72, 0x28, 0x50, 0x77, 0x31, 0x18, 0x82, 0xF9, 0xA7,
+	0x40, 0xEC, 0x93, 0xA1, 0x31, 0xCB, 0x03, 0x94, 0x10, 0x08, 0x20, 0x91, 0xF4, 0x25, 0x3B, 0x11,
+	0xD1, 0xC2, 0x0E, 0x70, 0x80, 0x2C, 0xA9, 0x02, 0x07, 0x82, 0x99, 0xE1, 0x04, 0xD1, 0x74, 0x24,
+	0x5C, 0xD8, 0xA9, 0x10, 0x4E, 0xB1, 0x01, 0x0E, 0x40, 0x82, 0x4E, 0xBC, 0x53, 0xB9, 0x40, 0x98,
+	0xAE, 0x1D, 0x8A, 0x4A, 0x46, 0x8A, 0xB7, 0x80, 0x3D, 0x51, 0xCD, 0x38, 0x3A, 0x0F, 0x8F, 0x1B,
+	0x04, 0x8F, 0xA3, 0xCC, 0xA4, 0x05, 0x94, 0xCA, 0xC1, 0x07, 0x79, 0x53, 0x94, 0x83, 0x2C, 0x6C,
+	0x0B, 0x08, 0x1D, 0x63, 0x10, 0x24, 0x10, 0x4F, 0x8E, 0x0B, 0x07, 0x80, 0x18, 0x1C, 0x14, 0xC8,
+	0xE0, 0x47, 0x81, 0x54, 0x3C, 0x43, 0x47, 0x79, 0x13, 0xB1, 0xA3, 0xB5, 0x0B, 0x1C, 0xAE, 0xD2,
+	0x27, 0x43, 0x44, 0xA5, 0x53, 0x21, 0x9D, 0xB1, 0xF0, 0x70, 0x33, 0x85, 0x7B, 0x95, 0x09, 0x55,
+	0xA8, 0xDC, 0xE8, 0x8A, 0xC7, 0x2A, 0x1E, 0x2E, 0x69, 0x83, 0xAC, 0x20, 0x81, 0xE5, 0x15, 0x82,
+	0x4E, 0xA5, 0x8C, 0x47, 0x95, 0x8A, 0xA9, 0x84, 0xD9, 0xD0, 0x1E, 0x00, 0x68, 0xAC, 0x72, 0xA1,
+	0x20, 0x82, 0x08, 0x20, 0x81, 0xE0, 0xA6, 0x56, 0x09, 0x3A, 0x80, 0x49, 0xC4, 0x82, 0x06, 0x20,
+	0x82, 0x08, 0x27, 0x50, 0x3C, 0x20, 0x59, 0x4B, 0x03, 0xF0, 0x8E, 0x47, 0x07, 0x08, 0xF0, 0x50,
+	0x41, 0x04, 0x10, 0x41, 0x03, 0xC0, 0xE5, 0x30, 0x80, 0x49, 0x92, 0xB2, 0x78, 0x04, 0x0C, 0x40,
+	0xF4, 0x02, 0x09, 0x3A, 0x81, 0xD2, 0x3A, 0xC6, 0xAB, 0x9D, 0xCA, 0x0A, 0xA7, 0x52, 0x83, 0x5E,
+	0x76, 0x2A, 0x20, 0x9D, 0x09, 0x00, 0x7A, 0x21, 0x3A, 0xE6, 0xC3, 0xD0, 0xA5, 0x78, 0x46, 0x8A,
+	0xC6, 0x24, 0x10, 0x41, 0x04, 0x10, 0x40, 0x1E, 0x80, 0x41, 0x04, 0x10, 0x49, 0x96, 0x81, 0xD2,
+	0x04, 0x13, 0xA8, 0x04, 0x9C, 0x21, 0x18, 0x82, 0x4E, 0x80, 0xDD, 0x5A, 0x15, 0x8F, 0x08, 0xAC,
+	0x78, 0x11, 0x03, 0xC2, 0x3C, 0x20, 0x81, 0xE0, 0x70, 0x8F, 0x67, 0x25, 0x76, 0x19, 0x32, 0xC2,
+	0x05, 0x90, 0x90, 0x41, 0x04, 0x10, 0x40, 0xF0, 0x8A, 0xAC, 0x0E, 0x12, 0x09, 0xD6, 0x11, 0x58,
+	0x20, 0x8C, 0x08, 0x20, 0x82, 0x08, 0x20, 0x81, 0xCD, 0x03, 0xC1, 0x61, 0x07, 0x88, 0x62, 0x3A,
+	0x3A, 0xA9, 0x63, 0x95, 0x09, 0xD4, 0xCA, 0x08, 0x1E, 0x52, 0xC0, 0x20, 0x78, 0x48, 0x20, 0x82,
+	0x0F, 0x02, 0xC8, 0x48, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x02, 0xCB, 0x02, 0x38, 0x9C, 0x1C,
+	0xA0, 0x13, 0xA8, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x8C, 0x70, 0x70, 0x90, 0x41, 0x3C,
+	0x76, 0x39, 0x54, 0x1D, 0x4A, 0xA0, 0xEA, 0x54, 0x24, 0x10, 0x41, 0x3A, 0x81, 0xCC, 0x20, 0x10,
+	0x41, 0x04, 0x0F, 0x09, 0x3A, 0xB9, 0xD1, 0x14, 0xA8, 0x41, 0x04, 0x10, 0x41, 0x04, 0x78, 0x41,
+	0x04, 0x10, 0x78, 0x16, 0x42, 0x41, 0x04, 0x10, 0x41, 0x3A, 0x95, 0x09, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x49, 0x96, 0x54, 0x89, 0x3A, 0x80, 0x41, 0x04, 0x10,
+	0x40, 0xE6, 0x80, 0x41, 0x04, 0x13, 0xA9, 0x82, 0xC4, 0x40, 0x20, 0x82, 0x75, 0x32, 0x82, 0x01,
+	0x04, 0x10, 0x39, 0xA0, 0x10, 0x41, 0x27, 0x42, 0x41, 0x04, 0x10, 0x41, 0xE2, 0xA8, 0x41, 0x3A,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x27, 0x2F, 0x83, 0x31, 0x1D, 0x41, 0x88, 0xEA,
+	0x0C, 0x47, 0x20, 0x41, 0x04, 0x10, 0x3C, 0x20, 0x81, 0xE1, 0x27, 0x50, 0x09, 0x3A, 0x12, 0x75,
+	0x8D, 0x54, 0x8E, 0xA0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x13, 0xA9, 0x94, 0xB1, 0xD8, 0xAA, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x11,
+	0xE1, 0x3A, 0x83, 0x10, 0x27, 0x58, 0xD8, 0xEA, 0xC6, 0xA8, 0x27, 0x50, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x27, 0x50, 0x41, 0x07, 0x8F, 0x03, 0x94, 0x10, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x8F, 0x08, 0x20, 0x82, 0x08, 0x20, 0x93, 0xA1, 0x88, 0x9E, 0x00, 0xB2, 0xC4,
+	0x09, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x49, 0xD0, 0xC4, 0x78,
+	0x04, 0x0E, 0x65, 0x00, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0x32,
+	0xC0, 0x8F, 0x1D, 0x58, 0xD8, 0x20, 0x0B, 0x28, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x3A, 0x82, 0x09, 0xD4, 0x1D, 0x4A, 0xB1, 0xAA, 0x01, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x12, 0x75, 0x2A, 0x1C, 0x8E, 0xA0, 0xC7, 0x05, 0x30,
+	0x58, 0x88, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x4E, 0xA6, 0x50,
+	0x62, 0x3A, 0x83, 0x1C, 0x16, 0x04, 0x72, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x3A, 0x83, 0x91, 0xD4, 0x10, 0x75, 0x04, 0x13, 0xA8, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xEA, 0x65, 0x04, 0x02, 0x08, 0x24, 0xE1,
+	0x60, 0xA0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x75,
+	0x04, 0x9D, 0x0C, 0x44, 0x13, 0xA9, 0x94, 0x10, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0xD4, 0xCA, 0x08, 0x3A, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x27, 0x50, 0x09, 0x3A, 0x12, 0x4E, 0x84, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x9D, 0x4A, 0x84, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x27, 0x52, 0xA1,
+	0xC8, 0xEA, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x4E, 0x86, 0x22, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x7F, 0xA0, 0x00
 };
 
+/* 3-bit ADPCM, SNR 10.4 dB */
 const u8 sfx_claw_attack[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x79, 0x96, 0x97, 0x89, 0x77, 0xAA, 0x77, 0xA9, 0x77, 0x78,
-	0x77, 0x87, 0x98, 0x77, 0xA7, 0x77, 0x88, 0x88, 0x88, 0x86, 0x8A, 0x97, 0x89, 0xA9, 0x89, 0x89,
-	0x89, 0x97, 0x98, 0x87, 0x69, 0xA9, 0x88, 0x79, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88,
-	0x87, 0x6A, 0x97, 0x77, 0x8B, 0x98, 0x79, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x97, 0x79, 0x86,
-	0x98, 0x89, 0x88, 0x7A, 0x97, 0x87, 0x79, 0x86, 0x79, 0x67, 0x89, 0x88, 0x77, 0x88, 0x87, 0x88,
-	0x76, 0x8A, 0x87, 0x79, 0x99, 0x98, 0x89, 0x7A, 0x79, 0x97, 0x7A, 0x89, 0x88, 0x98, 0x88, 0x95,
-	0x7B, 0x87, 0x67, 0x8A, 0x8A, 0x88, 0x89, 0x99, 0x87, 0x87, 0x6A, 0x66, 0x98, 0x86, 0xA7, 0x88,
-	0x85, 0xA7, 0x98, 0x87, 0x89, 0x88, 0x77, 0x59, 0x87, 0x77, 0x79, 0xA7, 0x77, 0x7B, 0xA7, 0x7A,
-	0x96, 0x7A, 0x89, 0x58, 0xA9, 0x77, 0x97, 0x99, 0x76, 0x88, 0x99, 0x68, 0x7A, 0x67, 0xA9, 0x89,
-	0x89, 0x98, 0x78, 0x88, 0x88, 0x77, 0x5B, 0x87, 0x97, 0xB9, 0x98, 0x8A, 0xA6, 0x69, 0x87, 0x76,
-	0x9A, 0x86, 0x78, 0x87, 0x75, 0xA9, 0x87, 0x6B, 0x77, 0x86, 0xB7, 0x9A, 0x98, 0x98, 0x96, 0x79,
-	0x87, 0x78, 0x89, 0x77, 0x78, 0x87, 0x88, 0x88, 0x88, 0x78, 0x79, 0x79, 0x98, 0x89, 0xA6, 0x6C,
-	0x97, 0x77, 0x89, 0x99, 0x67, 0x88, 0x88, 0x77, 0x89, 0x87, 0x79, 0xA8, 0x87, 0x89, 0x87, 0x88,
-	0x86, 0x89, 0x78, 0x89, 0x98, 0x78, 0x88, 0x78, 0x87, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x8A, 0x99, 0x86, 0x89, 0x78, 0x79, 0x98, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x86, 0x67, 0x99,
-	0x89, 0x89, 0x99, 0x88, 0x88, 0x78, 0x78, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x98, 0x87, 0x99, 0x76, 0x9B, 0xAA, 0x68, 0x97, 0x99, 0x96, 0x99, 0x97, 0x78,
-	0x78, 0x77, 0x75, 0x88, 0x68, 0x88, 0x79, 0x76, 0x89, 0x78, 0x67, 0x99, 0x85, 0x98, 0xA6, 0x79,
-	0x99, 0x78, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x97,
-	0x6A, 0x98, 0xA7, 0x99, 0xB6, 0x99, 0x88, 0x87, 0x78, 0x77, 0x77, 0x75, 0x88, 0x76, 0x98, 0x98,
-	0x88, 0x88, 0x68, 0x89, 0x78, 0x78, 0x7B, 0x89, 0x67, 0xA7, 0x89, 0x98, 0x78, 0x77, 0x89, 0x88,
-	0x86, 0x79, 0x99, 0x78, 0x67, 0x99, 0x97, 0x87, 0x89, 0x67, 0xA7, 0x6A, 0x99, 0x67, 0x9A, 0x86,
-	0xA8, 0x98, 0x97, 0x88, 0x78, 0x88, 0x68, 0x69, 0x99, 0x88, 0x88, 0x89, 0x68, 0x78, 0xA7, 0x89,
-	0x96, 0x8A, 0x97, 0x88, 0x88, 0x87, 0x77, 0x87, 0x88, 0x77, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x57, 0xA8, 0xA7, 0xB8, 0x7A, 0xA9, 0x78, 0x78, 0x67, 0x88, 0x77, 0x87, 0x87, 0x79, 0x78,
-	0x89, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x9A, 0x77, 0x8A, 0x96, 0x98, 0x98, 0x79, 0x78, 0x76, 0x89, 0x87, 0x86, 0x79, 0x96, 0x69, 0x98,
-	0x78, 0x78, 0x77, 0x78, 0x88, 0x88, 0x89, 0x65, 0x9C, 0xA9, 0x77, 0x9A, 0x77, 0xA9, 0x88, 0x98,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x89, 0x79, 0x68, 0x99, 0x88,
-	0x6A, 0x88, 0x88, 0x86, 0xC8, 0x96, 0x87, 0x89, 0x88, 0x68, 0x86, 0x79, 0x97, 0x78, 0x78, 0x87,
-	0x78, 0x78, 0x79, 0x69, 0x99, 0x77, 0x98, 0x89, 0x47, 0xC8, 0x79, 0xAA, 0x79, 0x88, 0x87, 0x77,
-	0x79, 0x7B, 0x89, 0x77, 0x97, 0x88, 0x77, 0x77, 0x89, 0x98, 0x96, 0x6B, 0xA8, 0x87, 0x7A, 0x98,
-	0x68, 0x97, 0x78, 0x99, 0x87, 0x87, 0x98, 0x77, 0x97, 0x77, 0x99, 0x79, 0x89, 0x77, 0x88, 0x88,
-	0x85, 0x7A, 0x98, 0x97, 0xA8, 0x98, 0x88, 0x78, 0x78, 0x77, 0x87, 0x89, 0xAA, 0x88, 0x78, 0x87,
-	0x77, 0x78, 0x88, 0x88, 0x78, 0x98, 0x88, 0x7A, 0x88, 0x87, 0x98, 0x79, 0x68, 0x88, 0x98, 0x97,
-	0x88, 0x76, 0x79, 0x97, 0x89, 0x88, 0x88, 0x77, 0x88, 0x98, 0x87, 0x69, 0x88, 0xA8, 0xA6, 0x89,
-	0x97, 0x78, 0x89, 0x88, 0x65, 0x99, 0x99, 0x99, 0x87, 0x78, 0x58, 0x8A, 0x77, 0xB5, 0x97, 0xA7,
-	0x99, 0x97, 0x78, 0x78, 0x69, 0x89, 0x88, 0x88, 0x77, 0x88, 0x88, 0x87, 0x98, 0x88, 0x88, 0x78,
-	0x88, 0x79, 0x88, 0x79, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x98, 0x96, 0x89,
-	0x98, 0x79, 0x89, 0x88, 0x67, 0x98, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x75, 0x9A,
-	0xA6, 0x79, 0x89, 0x6B, 0x89, 0x78, 0x58, 0x99, 0x77, 0x97, 0x87, 0x69, 0x99, 0x67, 0x98, 0x88,
-	0x88, 0x86, 0x79, 0xA8, 0x78, 0x88, 0x79, 0x69, 0x96, 0xA6, 0x88, 0x7A, 0x89, 0x78, 0x69, 0x98,
-	0x68, 0x88, 0x79, 0x76, 0xA8, 0x87, 0x89, 0x69, 0x98, 0x77, 0x87, 0x88, 0x77, 0xA9, 0x95, 0xA9,
-	0x87, 0x89, 0x67, 0x9A, 0x87, 0x78, 0x88, 0x88, 0x87, 0x87, 0x87, 0x79, 0x88, 0x88, 0x86, 0x9A,
-	0x97, 0x76, 0x8C, 0x97, 0x8A, 0x76, 0x9A, 0x77, 0x99, 0x76, 0x88, 0x88, 0x89, 0x67, 0x98, 0x68,
-	0x98, 0x59, 0xA9, 0x68, 0x87, 0x6A, 0x99, 0x68, 0x88, 0x88, 0x98, 0x6A, 0x88, 0x78, 0x87, 0x88,
-	0x88, 0x88, 0x77, 0x78, 0xA8, 0x86, 0x7A, 0x86, 0x98, 0x98, 0x95, 0x9A, 0x97, 0x87, 0x89, 0xA5,
-	0x8A, 0x86, 0x78, 0x88, 0x85, 0x88, 0x98, 0x87, 0x78, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x69, 0x99, 0x59, 0x98, 0x76, 0x99, 0x86, 0x99, 0x77, 0x86, 0x8A, 0x87,
-	0x8A, 0x77, 0x87, 0x99, 0x77, 0x88, 0x98, 0x76, 0x99, 0x98, 0x78, 0x78, 0x97, 0x87, 0x99, 0x78,
-	0x77, 0x89, 0xA8, 0x88, 0x68, 0x99, 0x87, 0x88, 0x88, 0x89, 0x86, 0x99, 0x76, 0x9A, 0x87, 0x78,
-	0x88, 0x88, 0x77, 0x78, 0x97, 0x97, 0x6A, 0x99, 0x77, 0x79, 0x49, 0x99, 0x95, 0x96, 0x89, 0x88,
-	0x89, 0x69, 0x79, 0x97, 0x85, 0x88, 0x99, 0x96, 0x79, 0x88, 0x78, 0x87, 0x76, 0x88, 0xA8, 0x87,
-	0x88, 0x96, 0x88, 0x68, 0x89, 0x87, 0x67, 0xAA, 0x78, 0x78, 0x69, 0x88, 0x99, 0x87, 0x79, 0x77,
-	0xA8, 0x68, 0x9A, 0x86, 0x89, 0xA7, 0x86, 0x79, 0x87, 0x89, 0x78, 0x7A, 0xA7, 0x68, 0xA9, 0x87,
-	0x97, 0x78, 0x8A, 0x69, 0x78, 0x98, 0x88, 0x77, 0x98, 0x95, 0x8A, 0x79, 0x89, 0x77, 0x88, 0xA8,
-	0x77, 0x8A, 0x86, 0x7A, 0x87, 0x77, 0x99, 0x67, 0x98, 0x96, 0x87, 0x99, 0x68, 0x89, 0x86, 0x88,
-	0x78, 0x95, 0x89, 0x99, 0x77, 0x89, 0x78, 0x98, 0x95, 0x6B, 0x88, 0x77, 0xA9, 0x67, 0x99, 0x68,
-	0x99, 0x67, 0x98, 0x87, 0x88, 0x88, 0x88, 0x87, 0x89, 0x88, 0x76, 0x98, 0x98, 0x87, 0x5A, 0x79,
-	0x88, 0x87, 0x87, 0x88, 0x99, 0x98, 0x77, 0x88, 0x87, 0x7A, 0x98, 0x76, 0x89, 0x87, 0x88, 0x98,
-	0x67, 0x98, 0x85, 0x89, 0x88, 0x88, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0x88,
-	0x86, 0x88, 0x97, 0x78, 0x97, 0x87, 0x88, 0x88, 0x98, 0x89, 0x88, 0x88, 0x87, 0x89, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x76, 0xA9, 0x86, 0x78, 0x98, 0x77, 0x99, 0x58, 0x78, 0x89, 0x78, 0x98,
-	0x78, 0x87, 0x89, 0x88, 0x88, 0x68, 0x79, 0x98, 0x88, 0x78, 0x79, 0x98, 0x88, 0x77, 0x79, 0x97,
-	0x88, 0x79, 0x78, 0x97, 0x79, 0x79, 0x87, 0x88, 0x87, 0x98, 0xA8, 0x79, 0x78, 0x76, 0xA8, 0x98,
-	0x86, 0x88, 0x89, 0x7A, 0x77, 0x98, 0x86, 0x7A, 0x89, 0x97, 0x87, 0x68, 0x8A, 0xA9, 0x67, 0x86,
-	0xA8, 0x79, 0x87, 0x77, 0x97, 0x87, 0x9A, 0x89, 0x57, 0x98, 0x88, 0x88, 0x78, 0x88, 0x78, 0x78,
-	0x99, 0x98, 0x78, 0x78, 0x67, 0xAA, 0x87, 0x78, 0x86, 0x89, 0xA9, 0x69, 0x69, 0x86, 0x98, 0x98,
-	0x67, 0x99, 0x96, 0x79, 0x88, 0x78, 0x87, 0x78, 0x88, 0x97, 0x79, 0x98, 0x87, 0x89, 0x78, 0x88,
-	0x79, 0x79, 0x87, 0xA6, 0x98, 0x78, 0x88, 0x96, 0x79, 0x99, 0x78, 0x78, 0x98, 0x77, 0x98, 0x87,
-	0x98, 0x78, 0x68, 0x88, 0x89, 0x88, 0x88, 0x98, 0x77, 0x78, 0x89, 0x98, 0x76, 0x88, 0x69, 0x98,
-	0x88, 0x57, 0xB8, 0x76, 0x98, 0x97, 0x88, 0x89, 0x85, 0x6A, 0x87, 0x8B, 0x85, 0x8A, 0x95, 0x69,
-	0xA9, 0x95, 0x7B, 0x85, 0x9A, 0x76, 0x98, 0x88, 0x87, 0x9A, 0x85, 0x79, 0x97, 0x7A, 0x76, 0x89,
-	0x98, 0x58, 0xA9, 0x78, 0x89, 0x67, 0x99, 0x87, 0x89, 0x89, 0x88, 0x87, 0x87, 0x98, 0x89, 0x89,
-	0x87, 0x89, 0x78, 0x98, 0x78, 0xA7, 0x59, 0x97, 0x78, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89,
-	0x88, 0x88, 0x88, 0x78, 0x99, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x98, 0x99, 0x67, 0x98, 0x68, 0x88, 0x87, 0x88, 0xA8, 0x86, 0x69, 0xA9, 0x87, 0x67, 0x89, 0x97,
-	0x88, 0x78, 0x97, 0x79, 0x96, 0x89, 0x98, 0x88, 0x67, 0x97, 0x89, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x89, 0x87, 0x98, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x7A, 0x87, 0x99, 0x67, 0x87, 0x88, 0x87, 0x9A, 0x86, 0x88, 0x69, 0xB7, 0x6A,
-	0xA6, 0x78, 0x78, 0x89, 0x79, 0xB8, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x8A, 0x78, 0xA8, 0x67, 0x87, 0x88, 0x88, 0x87, 0x9A, 0x86, 0x6A, 0xA7, 0x68, 0x78, 0xA8,
-	0x58, 0xA8, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x98, 0x78, 0x78, 0x87, 0xAA, 0x76, 0x79, 0xA7, 0x68, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x58
+	0xEC, 0x4C, 0x40, 0x82, 0x08, 0x20, 0x82, 0x08, 0x1E, 0x12, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x3E, 0xA7, 0x54, 0x1E, 0x18, 0xE0, 0xCC, 0x21, 0xC0, 0xE7, 0x30, 0x78, 0x42, 0x24, 0x07, 0xF6,
+	0x6E, 0x24, 0xEA, 0xB1, 0xAA, 0x75, 0x45, 0xEC, 0xDA, 0x33, 0x92, 0x01, 0x26, 0x58, 0xD4, 0x20,
+	0x9B, 0xB3, 0xC5, 0x4E, 0xCA, 0xE8, 0x82, 0x75, 0x2A, 0x81, 0xF8, 0xEE, 0x72, 0x1A, 0x33, 0x98,
+	0x40, 0xEF, 0x2B, 0x82, 0x28, 0xC0, 0x89, 0xD4, 0xBD, 0xAB, 0x63, 0x10, 0x68, 0xBB, 0xC6, 0x50,
+	0xE9, 0xB1, 0x59, 0xDF, 0x2A, 0xDA, 0x52, 0xAB, 0x08, 0x60, 0xF5, 0x70, 0xF4, 0x50, 0x77, 0x40,
+	0x9D, 0xD3, 0x24, 0x27, 0x4C, 0xBB, 0x94, 0x40, 0x97, 0x80, 0xB9, 0xE3, 0x98, 0x2A, 0x3A, 0x12,
+	0xC5, 0x54, 0xD1, 0x45, 0x39, 0xAF, 0x05, 0x29, 0xA4, 0x6C, 0x40, 0x93, 0x3E, 0xEC, 0x59, 0xC9,
+	0x23, 0x9E, 0x29, 0x24, 0x67, 0xD2, 0x66, 0x5D, 0xC9, 0x23, 0xC0, 0x67, 0x48, 0x94, 0xF5, 0xC1,
+	0x94, 0x18, 0xFC, 0x04, 0x75, 0x04, 0x13, 0x2C, 0xF2, 0x92, 0x29, 0xC3, 0x98, 0x42, 0x46, 0xE0,
+	0x88, 0x3C, 0x67, 0x60, 0xCE, 0x95, 0x1D, 0x54, 0x9D, 0x8C, 0x61, 0x1E, 0xA8, 0x31, 0x1D, 0xC9,
+	0x00, 0x82, 0x08, 0x27, 0x4E, 0x8D, 0x90, 0xC6, 0xA1, 0x60, 0x83, 0xC0, 0xC4, 0x87, 0xF8, 0x90,
+	0xA6, 0xA1, 0x3C, 0x13, 0xAC, 0x44, 0xD0, 0x31, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40, 0x1E, 0x1D,
+	0xCD, 0x19, 0x97, 0x91, 0x94, 0x9D, 0x09, 0x80, 0xAA, 0xC9, 0xD8, 0xCA, 0x0A, 0xF4, 0x43, 0x1C,
+	0x10, 0xD9, 0xC3, 0xC1, 0x83, 0x01, 0x04, 0x82, 0x75, 0x2A, 0x12, 0x00, 0xF4, 0x02, 0x09, 0x1E,
+	0xEC, 0x55, 0x8C, 0x5C, 0xC9, 0x06, 0x07, 0x08, 0x7F, 0x62, 0x67, 0x04, 0x80, 0x6E, 0x81, 0xE2,
+	0xBC, 0xE9, 0xE1, 0x50, 0x05, 0xC6, 0xC6, 0x70, 0xBC, 0xB1, 0x38, 0xE5, 0xC1, 0xCD, 0x0B, 0x87,
+	0xA3, 0x92, 0x84, 0x7D, 0x70, 0x53, 0xCC, 0xA4, 0xEE, 0xF2, 0x12, 0x81, 0x33, 0xE6, 0x07, 0x80,
+	0x9C, 0xA9, 0x80, 0x12, 0x68, 0x1E, 0x52, 0xC6, 0x27, 0x04, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0xEF, 0x87, 0x56, 0x56, 0x29, 0x28, 0xAB, 0x90,
+	0x30, 0x39, 0x60, 0xB1, 0x87, 0x98, 0x04, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0x32,
+	0x63, 0xD4, 0xAF, 0x50, 0x58, 0xB1, 0xB5, 0x9B, 0x8F, 0x2E, 0x78, 0xE4, 0x87, 0x1B, 0x03, 0x12,
+	0x0E, 0xFC, 0x6A, 0xCB, 0x18, 0xE1, 0x4A, 0x0E, 0x12, 0x0E, 0xA0, 0x10, 0x41, 0x04, 0x78, 0x41,
+	0x23, 0xEB, 0x90, 0x28, 0xEE, 0x81, 0x1F, 0x74, 0x73, 0x01, 0xB3, 0xA1, 0xC9, 0x1E, 0x1A, 0xA5,
+	0x8F, 0x2A, 0xFA, 0x83, 0x03, 0x73, 0xE5, 0x58, 0x44, 0xE6, 0x89, 0x85, 0x4F, 0xBA, 0x28, 0x58,
+	0xCB, 0x00, 0x6A, 0x75, 0xC3, 0x94, 0x60, 0xE4, 0xC4, 0xF0, 0x14, 0xB5, 0x67, 0x64, 0x78, 0x47,
+	0x2A, 0xA7, 0xC2, 0x02, 0xFC, 0xB9, 0x06, 0x74, 0x48, 0x31, 0xCA, 0xC5, 0x51, 0x73, 0xCA, 0xA5,
+	0x80, 0x31, 0x24, 0xC9, 0x58, 0xBB, 0xB0, 0x67, 0x2A, 0xE6, 0x03, 0x57, 0x03, 0x54, 0x87, 0x22,
+	0x88, 0x3C, 0x60, 0xE9, 0xB3, 0x11, 0xE5, 0xC8, 0x96, 0x18, 0xB0, 0xF1, 0x99, 0x04, 0xDA, 0xBE,
+	0xA2, 0xC1, 0x73, 0x0E, 0x30, 0x68, 0x6A, 0xEA, 0x09, 0x04, 0xD1, 0x89, 0x07, 0x72, 0x09, 0x3A,
+	0x83, 0xB9, 0x33, 0x92, 0x09, 0x94, 0x02, 0x75, 0x04, 0x1D, 0xD5, 0xC9, 0x97, 0x3A, 0x70, 0xE5,
+	0x50, 0x24, 0x9D, 0x08, 0x27, 0x50, 0x5F, 0xDA, 0x9C, 0x18, 0x7B, 0xA2, 0x8E, 0x80, 0xD1, 0x53,
+	0xA3, 0x13, 0x85, 0x20, 0x83, 0x72, 0xCE, 0xA6, 0x0E, 0xFA, 0x95, 0xE0, 0x22, 0xA3, 0x1C, 0x85,
+	0xCA, 0x0A, 0xF4, 0x74, 0x40, 0xB9, 0x16, 0x83, 0x94, 0xE5, 0x8D, 0xDC, 0x90, 0x2E, 0x09, 0xD4,
+	0x18, 0x20, 0x9D, 0x63, 0x83, 0x90, 0x0D, 0xD9, 0xBA, 0x66, 0xED, 0x0B, 0x44, 0x34, 0x52, 0xC5,
+	0x04, 0x8F, 0x85, 0x72, 0x17, 0xB1, 0x31, 0x92, 0x39, 0x39, 0x02, 0x47, 0xBB, 0x92, 0x19, 0x54,
+	0x10, 0x4F, 0x0B, 0x7A, 0x72, 0xED, 0x70, 0x63, 0xD0, 0x94, 0x54, 0xAF, 0x2A, 0xE0, 0x61, 0xDD,
+	0x03, 0x85, 0x88, 0x41, 0x04, 0x9D, 0x09, 0x04, 0x10, 0x41, 0x0E, 0xEC, 0xEE, 0xE4, 0x95, 0x89,
+	0xD0, 0xC0, 0x54, 0x74, 0x0F, 0x81, 0x14, 0xC0, 0x03, 0xA7, 0x60, 0x5C, 0x71, 0x5C, 0xD4, 0x39,
+	0xB0, 0xA5, 0xC4, 0xE8, 0x0B, 0x4C, 0x02, 0x3D, 0xD8, 0xD1, 0x0B, 0x41, 0x10, 0x4F, 0x03, 0x5D,
+	0x68, 0xE0, 0xC2, 0xBE, 0xA0, 0x99, 0x52, 0x24, 0x8B, 0xAA, 0x66, 0x1D, 0x00, 0x2F, 0x0E, 0x8A,
+	0x46, 0x9D, 0x87, 0x85, 0x31, 0x73, 0x32, 0x86, 0xDE, 0x98, 0xE2, 0x0C, 0xA0, 0x02, 0xF0, 0xF0,
+	0x77, 0x12, 0x36, 0x40, 0x71, 0x4B, 0xB4, 0xAE, 0x6B, 0x1E, 0x15, 0x65, 0x78, 0x08, 0xF9, 0xA4,
+	0xD9, 0x39, 0x7D, 0x72, 0x71, 0x83, 0x45, 0x1E, 0x90, 0xBB, 0x83, 0xB2, 0x07, 0x38, 0x50, 0x73,
+	0x5C, 0xE4, 0x0B, 0xD4, 0x8A, 0x72, 0x44, 0xF0, 0xAE, 0x4F, 0x5C, 0x3A, 0x28, 0x73, 0x82, 0x39,
+	0x13, 0x85, 0x24, 0x30, 0x41, 0x26, 0x4A, 0xCD, 0xD8, 0x16, 0x6E, 0xE1, 0x90, 0x63, 0x94, 0x50,
+	0x6B, 0x1C, 0x1C, 0xB9, 0x75, 0x6A, 0xD2, 0x16, 0xE5, 0x59, 0xD1, 0xA2, 0x4C, 0xB1, 0x02, 0x41,
+	0x04, 0x10, 0x70, 0xE0, 0xDD, 0x03, 0xE1, 0x3C, 0xE2, 0x20, 0x78, 0x1D, 0x00, 0x9D, 0x1C, 0x31,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xEA, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x23, 0xDD,
+	0x8B, 0x88, 0x37, 0x07, 0x7A, 0x80, 0x2E, 0x45, 0xA4, 0x74, 0x70, 0x1B, 0xBA, 0x85, 0x83, 0x2C,
+	0x85, 0x83, 0x00, 0xC7, 0x03, 0x3C, 0x46, 0x0B, 0x19, 0x4C, 0x3D, 0xC5, 0xAA, 0xC7, 0x07, 0x4D,
+	0x9D, 0x08, 0x7B, 0xC0, 0xD1, 0xCB, 0xA0, 0x71, 0x2B, 0x08, 0x6E, 0x0E, 0x76, 0x29, 0x60, 0x78,
+	0xD6, 0x30, 0xE4, 0xD1, 0x20, 0xEA, 0x0E, 0x6A, 0x42, 0x7A, 0xB1, 0xE5, 0x8D, 0x21, 0x9D, 0x13,
+	0xBA, 0xC6, 0x57, 0x05, 0xC5, 0x0B, 0xC3, 0xA2, 0xA9, 0x63, 0x81, 0xF8, 0xE4, 0x94, 0xBE, 0x60,
+	0xCF, 0x2B, 0x1E, 0x32, 0x91, 0x5F, 0x0A, 0x0E, 0x69, 0x3B, 0x07, 0x26, 0x72, 0x8E, 0x84, 0x07,
+	0x08, 0x16, 0xD0, 0x30, 0x47, 0xD5, 0x8E, 0xC5, 0x93, 0xA7, 0x6C, 0x70, 0x60, 0x02, 0xDC, 0x39,
+	0x4B, 0xD4, 0xA9, 0xC1, 0x33, 0x72, 0xEE, 0x42, 0xD7, 0x20, 0x95, 0x9F, 0x89, 0x1C, 0x3D, 0x08,
+	0x1B, 0xA3, 0x30, 0x03, 0x84, 0x2D, 0x2A, 0x9D, 0x07, 0x55, 0xD0, 0xA9, 0xD8, 0xAE, 0x4E, 0xA9,
+	0x7A, 0xC5, 0x86, 0x08, 0x27, 0x50, 0x08, 0x23, 0xC2, 0x09, 0x32, 0x73, 0xC0, 0x44, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x38, 0x71, 0xDE, 0x1D, 0xCA, 0x09, 0x54, 0x78, 0x70, 0x8D, 0xB6, 0xA2, 0xA7,
+	0x03, 0x17, 0xC2, 0x9C, 0x81, 0x45, 0xE5, 0xE2, 0x75, 0x04, 0x08, 0x20, 0x0B, 0x67, 0x61, 0x82,
+	0x08, 0x20, 0x82, 0x3F, 0x08, 0x82, 0x08, 0x20, 0x82, 0x08, 0xFB, 0xB5, 0xCE, 0x0D, 0x22, 0x76,
+	0x7D, 0x43, 0xA3, 0xE2, 0x1C, 0x08, 0x01, 0xE8, 0xFA, 0x40, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x9D, 0x3E, 0x15, 0xC0, 0xD2, 0x20, 0x1D, 0x9F,
+	0x83, 0x1A, 0x1A, 0x5E, 0xC8, 0x4C, 0x44, 0x12, 0x01, 0x04, 0x78, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x13, 0xA3, 0xAA, 0xC4, 0xF6, 0x3C, 0x08, 0x78, 0x40, 0x90, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x4E, 0x84, 0x82, 0x08, 0x20, 0x81, 0xFE, 0x80, 0x00
 };
 
+/* 2-bit ADPCM, SNR 10.3 dB */
 const u8 sfx_projectile[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x88, 0x98, 0x88, 0x88, 0x87,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x89, 0x88, 0x88, 0x88, 0x87, 0x87, 0x77, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x89, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88,
-	0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x78, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x89, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x99, 0x9A, 0x99, 0xA9, 0x98, 0x88, 0x88, 0x77, 0x77, 0x66, 0x67, 0x78, 0x89,
-	0x99, 0xAA, 0xAA, 0x99, 0x98, 0x87, 0x76, 0x77, 0x77, 0x77, 0x88, 0x89, 0x9A, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x77, 0x76, 0x76, 0x77, 0x88, 0x89, 0x99, 0xAA, 0xAA, 0xA9, 0x98, 0x88, 0x77, 0x76,
-	0x77, 0x76, 0x67, 0x77, 0x89, 0x99, 0x9A, 0xAA, 0xA9, 0x99, 0x98, 0x77, 0x77, 0x67, 0x87, 0x89,
-	0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x78, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x87, 0x78,
-	0x77, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x77, 0x66, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
-	0x99, 0x9A, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x77, 0x87, 0x77, 0x78, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x98, 0x88, 0x98, 0x88, 0x88, 0x99,
-	0x88, 0x88, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x87, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x78, 0x78, 0x88, 0x87, 0x87, 0x77, 0x88, 0x88,
-	0x88, 0x89, 0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x89, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x89, 0x99, 0xA9, 0x99, 0x99, 0x98, 0x77, 0x78, 0x77, 0x88, 0x98, 0x89, 0x88, 0x88,
-	0x88, 0x89, 0x88, 0x99, 0x99, 0x99, 0x89, 0x97, 0x87, 0x77, 0x76, 0x67, 0x77, 0x78, 0x88, 0x99,
-	0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x76, 0x66, 0x67, 0x77, 0x98, 0x98, 0x88, 0x89,
-	0x89, 0x99, 0x88, 0x88, 0x78, 0x77, 0x88, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x98,
-	0x89, 0x88, 0x87, 0x78, 0x88, 0x88, 0x98, 0x77, 0x77, 0x88, 0x88, 0x9A, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0xA8, 0x98, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x98, 0x87,
-	0x78, 0x88, 0x89, 0xAA, 0xA9, 0x88, 0x77, 0x88, 0x88, 0x98, 0x87, 0x66, 0x67, 0x77, 0x89, 0x99,
-	0x98, 0x77, 0x77, 0x78, 0x99, 0xAB, 0xAA, 0x98, 0x88, 0x87, 0x77, 0x87, 0x77, 0x77, 0x77, 0x66,
-	0x78, 0x88, 0x88, 0x88, 0x9A, 0x99, 0x98, 0x78, 0x88, 0x99, 0x99, 0x88, 0x98, 0x87, 0x78, 0x78,
-	0x78, 0x88, 0x87, 0x88, 0x77, 0x77, 0x77, 0x78, 0x89, 0x99, 0xAA, 0x99, 0x99, 0x99, 0x89, 0x98,
-	0x88, 0x88, 0x77, 0x66, 0x87, 0x88, 0x88, 0x87, 0x79, 0x88, 0x88, 0x98, 0x87, 0x88, 0x88, 0x89,
-	0x99, 0x88, 0x88, 0x98, 0x87, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x88, 0x87, 0x77,
-	0x88, 0x98, 0x89, 0x98, 0x98, 0x99, 0x88, 0x77, 0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x89, 0x99, 0x99, 0x98, 0x88, 0x87, 0x77, 0x78, 0x78, 0x88, 0x98, 0x87, 0x98, 0x77, 0x78, 0x97,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0x99, 0x98, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x98, 0x88, 0x98, 0x99, 0x87, 0x87, 0x87, 0x88, 0x77, 0x77, 0x89, 0x89, 0x99, 0x88, 0x99, 0x88,
-	0x77, 0x78, 0x88, 0x99, 0x88, 0x88, 0x87, 0x87, 0x77, 0x67, 0x77, 0x89, 0x89, 0x98, 0x98, 0x88,
-	0x98, 0x98, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x78, 0x68, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x98, 0x88, 0x89, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x78,
-	0x89, 0x78, 0x89, 0x99, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x78, 0x78, 0x76, 0x77,
-	0x67, 0x77, 0x88, 0x88, 0x88, 0x88, 0x78, 0x98, 0x99, 0x89, 0x99, 0x98, 0x89, 0x88, 0x77, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x99, 0x99, 0x89, 0x99, 0x88, 0x99, 0x98, 0x87, 0x77,
-	0x77, 0x77, 0x87, 0x78, 0x89, 0x98, 0x89, 0x88, 0x88, 0x97, 0x77, 0x77, 0x87, 0x77, 0x87, 0x87,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x98, 0x87, 0x87, 0x88, 0x88, 0x98, 0x88, 0x89, 0x98,
-	0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x99, 0x99, 0x98, 0x99, 0x98, 0x77, 0x79, 0x88,
-	0x87, 0x78, 0x88, 0x98, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x87, 0x78,
-	0x88, 0x99, 0x78, 0x89, 0x87, 0x98, 0x68, 0x66, 0x98, 0x78, 0x88, 0x89, 0x87, 0x89, 0x97, 0x99,
-	0x67, 0x87, 0x78, 0x88, 0x79, 0x87, 0x9A, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x77,
-	0x88, 0x88, 0x97, 0x88, 0x98, 0x98, 0x89, 0x98, 0x87, 0x98, 0x79, 0x87, 0x8A, 0x88, 0x89, 0x89,
-	0x99, 0x78, 0x88, 0x88, 0x88, 0x77, 0x78, 0x79, 0x89, 0x9A, 0x99, 0x88, 0x88, 0x88, 0x88, 0x67,
-	0x78, 0x98, 0xA9, 0xA8, 0x9A, 0x88, 0x76, 0x68, 0x67, 0x88, 0x78, 0x87, 0x89, 0x88, 0x78, 0x87,
-	0x78, 0x78, 0x89, 0x88, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x98, 0x87, 0x66,
-	0x77, 0x78, 0x78, 0x98, 0x9A, 0xA9, 0xAA, 0x89, 0x76, 0x76, 0x67, 0x99, 0x9A, 0xAA, 0x88, 0x88,
-	0x78, 0x77, 0x78, 0x89, 0x98, 0xA9, 0x9B, 0x99, 0x87, 0x86, 0x76, 0x67, 0x87, 0x88, 0xAA, 0xAA,
-	0x99, 0x99, 0x97, 0x66, 0x66, 0x67, 0x78, 0x88, 0x99, 0xA8, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x79, 0x78, 0x79, 0x78, 0x99, 0x97, 0x89, 0x88, 0x88, 0x87, 0x87, 0x89, 0x9A, 0xBA, 0xAA, 0x99,
-	0xA8, 0x87, 0x76, 0x76, 0x77, 0x88, 0x98, 0x87, 0x97, 0x98, 0x79, 0x88, 0x88, 0x67, 0x67, 0x87,
-	0x87, 0x68, 0x78, 0x88, 0x99, 0x9A, 0x98, 0x87, 0x88, 0x97, 0x89, 0x89, 0x99, 0x98, 0x97, 0x79,
-	0x97, 0x88, 0x88, 0x89, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x88, 0x97, 0x79, 0x87, 0x68, 0x98, 0x99,
-	0xA8, 0x89, 0x87, 0x77, 0x87, 0x59, 0x67, 0x86, 0x85, 0x57, 0x74, 0x77, 0x67, 0x88, 0x78, 0xA9,
-	0x99, 0x89, 0x99, 0x88, 0x78, 0x76, 0x99, 0x68, 0x86, 0x78, 0x88, 0x99, 0xA8, 0x9B, 0xA9, 0xAA,
-	0xA9, 0x99, 0x78, 0x86, 0x87, 0x66, 0x67, 0x65, 0x78, 0x9A, 0xAC, 0xBB, 0xCA, 0x7A, 0x99, 0x77,
-	0x57, 0x56, 0x77, 0x78, 0xA9, 0xBC, 0x8A, 0x98, 0x87, 0x67, 0x67, 0x75, 0x77, 0x68, 0x77, 0x98,
-	0xB9, 0xBB, 0x9A, 0xA8, 0x79, 0x76, 0x86, 0x67, 0x89, 0x88, 0x98, 0xA8, 0xAA, 0xB8, 0x88, 0x66,
-	0x56, 0x75, 0x65, 0x67, 0x78, 0x99, 0xBA, 0xA8, 0x88, 0x78, 0x87, 0x69, 0x86, 0x74, 0x88, 0xA9,
-	0x88, 0x79, 0x8A, 0xAA, 0x98, 0x65, 0x55, 0x78, 0x77, 0x55, 0x64, 0x78, 0x89, 0x98, 0xA8, 0xAB,
-	0x8B, 0x98, 0x95, 0x87, 0x79, 0x97, 0x56, 0x57, 0x9A, 0xBB, 0xCB, 0xBA, 0xCA, 0xD9, 0x9A, 0x87,
-	0x67, 0x67, 0x56, 0x55, 0x68, 0x89, 0xCD, 0xAE, 0xBA, 0xBB, 0xCA, 0xB8, 0x77, 0x57, 0x55, 0x66,
-	0x78, 0x86, 0x57, 0x67, 0x79, 0x8A, 0x8B, 0x79, 0xC8, 0x88, 0x79, 0x76, 0x66, 0x66, 0x45, 0x65,
-	0x66, 0x86, 0x89, 0xA8, 0xAB, 0x9A, 0xA9, 0x59, 0x79, 0x73, 0x86, 0x98, 0x67, 0x77, 0x87, 0x88,
-	0x89, 0x8A, 0x9B, 0x9A, 0x89, 0xA8, 0x89, 0xB5, 0x98, 0x99, 0x77, 0x67, 0x8A, 0x88, 0x9B, 0x89,
-	0x78, 0x89, 0x7B, 0x98, 0x98, 0x96, 0x76, 0x97, 0x89, 0x98, 0x89, 0x86, 0x89, 0x87, 0xA7, 0x78,
-	0x95, 0x76, 0x69, 0x78, 0x9A, 0x9A, 0x89, 0x77, 0x86, 0x9A, 0x97, 0xA8, 0x56, 0x88, 0x97, 0xAC,
-	0xA9, 0x96, 0x77, 0x76, 0x57, 0x78, 0x9A, 0x77, 0xAA, 0x79, 0x89, 0x89, 0xDC, 0xC9, 0xB8, 0x76,
-	0x54, 0x56, 0x67, 0x87, 0x79, 0x88, 0x7A, 0x7A, 0x79, 0x66, 0x97, 0xA9, 0x87, 0x86, 0x78, 0x77,
-	0x76, 0x79, 0x88, 0x77, 0xB9, 0x98, 0x9A, 0x96, 0x7A, 0x89, 0x76, 0x5A, 0x88, 0x88, 0x88, 0xA8,
-	0x79, 0xBB, 0xBA, 0xCA, 0xBA, 0x97, 0x8A, 0x78, 0x89, 0x57, 0x46, 0x66, 0x78, 0x85, 0xA8, 0x6B,
-	0x76, 0x48, 0x76, 0x68, 0x88, 0x88, 0x76, 0x68, 0x67, 0x87, 0xA7, 0x9C, 0x6A, 0x88, 0x99, 0x87,
-	0x78, 0x98, 0xA8, 0x8B, 0xA9, 0xAC, 0x9A, 0x98, 0x8A, 0x79, 0xA7, 0xA9, 0x89, 0x89, 0x88, 0x88,
-	0x77, 0x89, 0x66, 0x89, 0x86, 0x7A, 0x67, 0x78, 0x77, 0x76, 0x96, 0x45, 0x95, 0x68, 0x68, 0x97,
-	0x98, 0x58, 0x86, 0x67, 0x66, 0x77, 0x76, 0x87, 0x87, 0x98, 0x9B, 0x69, 0xAA, 0x8B, 0xC9, 0xBA,
-	0xB9, 0xA9, 0x88, 0x89, 0x89, 0xA9, 0x97, 0x97, 0x98, 0x99, 0x79, 0x99, 0xA8, 0x88, 0xB9, 0xAB,
-	0x9A, 0x99, 0x96, 0x6B, 0x56, 0x98, 0x68, 0x76, 0x69, 0x66, 0x99, 0x66, 0x88, 0x57, 0xB4, 0x77,
-	0x99, 0x67, 0x96, 0x58, 0x76, 0x66, 0x76, 0xB8, 0x69, 0x78, 0x98, 0x97, 0x8B, 0x97, 0xA7, 0x89,
-	0x67, 0xA6, 0x89, 0x98, 0x68, 0x99, 0x5B, 0xA6, 0x8B, 0x97, 0x97, 0xA9, 0x98, 0x6A, 0x89, 0x78,
-	0x78, 0x95, 0x87, 0x78, 0x87, 0x89, 0x89, 0x96, 0x99, 0x8C, 0x99, 0x99, 0x87, 0x9A, 0x77, 0x86,
-	0x77, 0x68, 0x67, 0x88, 0x89, 0x69, 0xA7, 0xAA, 0x79, 0x78, 0x88, 0x87, 0x67, 0x99, 0xA8, 0x97,
-	0x87, 0x77, 0x86, 0x89, 0x88, 0x79, 0x89, 0xA7, 0x79, 0x89, 0xA7, 0x79, 0xAB, 0x79, 0x99, 0xC7,
-	0x86, 0x98, 0x79, 0x65, 0xA6, 0x89, 0x7A, 0x89, 0x87, 0x89, 0x79, 0x87, 0x88, 0x86, 0x98, 0x79,
-	0x88, 0x98, 0x78, 0x88, 0x77, 0x76, 0x77, 0x87, 0x78, 0x88, 0x97, 0x88, 0x86, 0x78, 0x88, 0x68,
-	0x89, 0x89, 0x78, 0x88, 0x77, 0x98, 0x98, 0x88, 0x77, 0x88, 0x88, 0x87, 0x87, 0x88, 0x78, 0x88,
-	0x8A, 0xA8, 0x89, 0x99, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x98, 0x89, 0x98, 0x78, 0x88, 0x89, 0x99,
-	0x8A, 0x88, 0xA9, 0x88, 0x79, 0x87, 0x88, 0x77, 0x88, 0x88, 0x78, 0x78, 0x87, 0x87, 0x97, 0x78,
-	0x88, 0x77, 0x88, 0x78, 0x87, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x77,
-	0x78, 0x78, 0x88, 0x97, 0x87, 0x89, 0x88, 0x88, 0x88, 0x99, 0x98, 0x89, 0x98, 0x87, 0x88, 0x89,
-	0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0xA8, 0x89, 0x98, 0x9A, 0x98, 0x89, 0x99, 0x88, 0x78, 0x88,
-	0x88, 0x67, 0x87, 0x87, 0x78, 0x87, 0x78, 0x89, 0x88, 0x98, 0x87, 0x88, 0x88, 0x87, 0x89, 0x79,
-	0x89, 0x88, 0x98, 0x87, 0x89, 0x78, 0x78, 0x88, 0x78, 0x88, 0x89, 0x87, 0x98, 0x88, 0x88, 0x78,
-	0x87, 0x88, 0x89, 0x87, 0x89, 0x87, 0x88, 0x78, 0x87, 0x87, 0x89, 0x88, 0x79, 0x88, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x77, 0x89, 0x88, 0x88, 0x78, 0x78, 0x87,
-	0x87, 0x78, 0x78, 0x78, 0x97, 0x88, 0x98, 0x89, 0x89, 0x98, 0x88, 0x88, 0x88, 0x99, 0x88, 0x78,
-	0x88, 0x87, 0x78, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x98, 0x89, 0x88, 0x89, 0x88, 0x79,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x78, 0x78, 0x78, 0x88, 0x78,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x78, 0x88, 0x88, 0x97, 0x88, 0x88, 0x89, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x88, 0x99, 0x88, 0x98, 0x89, 0x88, 0x87, 0x88, 0x78, 0x98, 0x97, 0x88, 0x88, 0x89,
-	0x78, 0x78, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x78, 0x88, 0x88, 0x79, 0x89, 0x88, 0x99, 0x87,
-	0x78, 0x88, 0x88, 0x98, 0x88, 0x88, 0x97, 0x97, 0x88, 0x89, 0x87, 0x98, 0x88, 0x78, 0x79, 0x88,
-	0x88, 0x88, 0x87, 0x99, 0x78, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x88, 0x98, 0x88, 0x98, 0x87,
-	0x78, 0x89, 0x88, 0x87, 0x78, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x79, 0x88, 0x88, 0x87,
-	0x88, 0x78, 0x88, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x97, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x88, 0x87, 0x87, 0x88, 0x78, 0x79, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x98, 0x88, 0x88, 0x79, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x88, 0x89, 0x87, 0x88, 0x78, 0x87, 0x88, 0x88, 0x98, 0x88, 0x98, 0x89, 0x88, 0x88, 0x87, 0x88,
-	0x87, 0x89, 0x79, 0x87, 0x88, 0x88, 0x78, 0x98, 0x98, 0x98, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x77, 0x88, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98,
-	0x98, 0x88, 0x89, 0x88, 0x99, 0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87,
-	0x78, 0x88, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x78, 0x87, 0x89, 0x88, 0x87, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x87,
-	0x88, 0x88, 0x98, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98, 0x78, 0x78, 0x98,
-	0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x87, 0x89, 0x88, 0x88, 0x98, 0x88, 0x88, 0x89,
-	0x88, 0x88, 0x99, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x98, 0x89, 0x89, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x87, 0x88, 0x88, 0x88,
-	0x98, 0x89, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x89, 0x87, 0x87, 0x88, 0x89, 0x98, 0x87, 0x88,
-	0x79, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x98, 0x89, 0x88, 0x88, 0x88, 0x78, 0x78,
-	0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x98, 0x99, 0x98, 0x88, 0x88, 0x87, 0x88,
-	0x88, 0x77, 0x87, 0x78, 0x88, 0x88, 0x89, 0x89, 0x89, 0x98, 0x99, 0x89, 0x88, 0x87, 0x78, 0x78,
-	0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x99, 0x99, 0x89, 0x88, 0x88, 0x78, 0x87, 0x77, 0x77, 0x77,
-	0x78, 0x78, 0x98, 0x89, 0x99, 0x99, 0x98, 0x87, 0x88, 0x76, 0x77, 0x87, 0x88, 0x89, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x89, 0x88, 0xA9, 0x99, 0x99, 0x97, 0x77, 0x66, 0x66, 0x67, 0x89, 0x9A, 0xAB,
-	0xAB, 0x99, 0x86, 0x75, 0x65, 0x66, 0x77, 0x79, 0x8A, 0xAB, 0xAA, 0xA9, 0x87, 0x87, 0x76, 0x67,
-	0x67, 0x77, 0x88, 0xA8, 0x99, 0x9A, 0x99, 0x98, 0x77, 0x66, 0x76, 0x88, 0x99, 0xAA, 0xA9, 0x98,
-	0x66, 0x66, 0x66, 0x78, 0x99, 0xAB, 0xBA, 0xA9, 0x88, 0x77, 0x67, 0x78, 0x78, 0x88, 0x67, 0x78,
-	0x88, 0x88, 0x99, 0x89, 0x99, 0x98, 0x99, 0x87, 0x98, 0x88, 0x89, 0x88, 0x89, 0x88, 0x67, 0x66,
-	0x66, 0x78, 0x89, 0xBA, 0xBA, 0xA9, 0x75, 0x45, 0x45, 0x78, 0xAA, 0xCC, 0xCB, 0x97, 0x76, 0x56,
-	0x78, 0x89, 0x9B, 0xAA, 0x98, 0x87, 0x67, 0x76, 0x76, 0x87, 0x88, 0x78, 0x78, 0x99, 0x8A, 0xBB,
-	0xBA, 0xA9, 0x85, 0x54, 0x55, 0x67, 0x99, 0xCC, 0xCA, 0xA8, 0x65, 0x44, 0x56, 0x79, 0xAC, 0xAA,
-	0xA8, 0x77, 0x57, 0x87, 0xAA, 0xAC, 0xCB, 0xA9, 0x76, 0x34, 0x34, 0x57, 0x8B, 0xCD, 0xDC, 0xBA,
-	0xA6, 0x64, 0x55, 0x66, 0x99, 0xAB, 0xAA, 0x98, 0x87, 0x75, 0x66, 0x68, 0x78, 0x88, 0x99, 0x89,
-	0x89, 0x99, 0x87, 0x76, 0x77, 0x89, 0x9A, 0xBB, 0xBA, 0x99, 0x98, 0x87, 0x67, 0x78, 0x77, 0x88,
-	0x89, 0x99, 0x98, 0x67, 0x64, 0x55, 0x45, 0x57, 0x77, 0x79, 0x98, 0x77, 0x88, 0x67, 0x98, 0x99,
-	0xAA, 0xA9, 0xAA, 0x98, 0x98, 0x97, 0x8A, 0x9A, 0x9A, 0xAB, 0xA9, 0x99, 0x88, 0x87, 0x98, 0x98,
-	0x99, 0x99, 0xA8, 0x88, 0x88, 0x88, 0x77, 0x86, 0x57, 0x65, 0x56, 0x76, 0x78, 0x78, 0x97, 0x99,
-	0x87, 0x86, 0x87, 0x58, 0x66, 0x76, 0x68, 0x78, 0xA9, 0x8B, 0x9B, 0xAA, 0xCB, 0xA8, 0x96, 0x85,
-	0x56, 0x64, 0x57, 0x7A, 0x8C, 0xCC, 0xAA, 0xAA, 0x97, 0x65, 0x56, 0x67, 0xAA, 0xCC, 0xCA, 0xA9,
-	0x78, 0x77, 0x57, 0x66, 0x77, 0x88, 0x8A, 0xCB, 0xBA, 0x99, 0x85, 0x66, 0x67, 0x66, 0x97, 0x8A,
-	0xA9, 0xD9, 0x99, 0x56, 0x75, 0x55, 0x46, 0x76, 0x7A, 0x89, 0xA8, 0xA8, 0x78, 0x98, 0x77, 0x78,
-	0x87, 0x98, 0x8A, 0xAC, 0xB8, 0x88, 0x88, 0x78, 0x75, 0x56, 0x79, 0x89, 0x9A, 0xAB, 0xAA, 0x98,
-	0x88, 0x89, 0x86, 0x55, 0x55, 0x79, 0x99, 0x99, 0xAC, 0xCC, 0xA8, 0x86, 0x76, 0x64, 0x33, 0x34,
-	0x78, 0xAB, 0xCC, 0xCD, 0xDC, 0xCA, 0x87, 0x77, 0x65, 0x67, 0x64, 0x45, 0x67, 0x89, 0xAA, 0xAA,
-	0xAA, 0xAA, 0xA9, 0x87, 0x65, 0x45, 0x56, 0x66, 0x77, 0x89, 0x9B, 0xBA, 0x9A, 0x99, 0x97, 0x77,
-	0x77, 0x66, 0x67, 0x77, 0x88, 0x8A, 0x99, 0x9A, 0x9A, 0x99, 0x99, 0x88, 0x87, 0x77, 0x77, 0x88,
-	0x8A, 0xA9, 0x89, 0x88, 0x99, 0x99, 0x77, 0x67, 0x89, 0xAA, 0xAA, 0x98, 0x88, 0x89, 0x88, 0x87,
-	0x87, 0x78, 0x9A, 0x99, 0x98, 0x78, 0x88, 0x87, 0x66, 0x66, 0x78, 0x89, 0xAA, 0xA8, 0x99, 0x87,
-	0x55, 0x55, 0x66, 0x78, 0x76, 0x77, 0x9B, 0xCB, 0xCB, 0xA8, 0x76, 0x56, 0x66, 0x77, 0x78, 0x99,
-	0x78, 0x88, 0x99, 0xAA, 0xA9, 0x98, 0x78, 0x77, 0x77, 0x78, 0x87, 0x88, 0x99, 0x89, 0x98, 0x88,
-	0x88, 0x77, 0x77, 0x77, 0x78, 0x99, 0xAA, 0xBC, 0xCD, 0xDD, 0xDC, 0xBA, 0x99, 0x87, 0x66, 0x55,
-	0x55, 0x67, 0x67, 0x87, 0x76, 0x66, 0x55, 0x55, 0x65, 0x45, 0x55, 0x66, 0x88, 0x88, 0x99, 0x99,
-	0x88, 0x88, 0x88, 0x8A, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0xAA, 0x99, 0xA9,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x67, 0x76, 0x66,
-	0x66, 0x66, 0x76, 0x67, 0x77, 0x77, 0x88, 0x78, 0x88, 0x87, 0x77, 0x66, 0x76, 0x66, 0x77, 0x78,
-	0x88, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x88, 0x88, 0x98, 0x9A, 0xAA, 0xA9, 0x99, 0x99,
-	0x99, 0x88, 0x99, 0xA9, 0x99, 0x99, 0x87, 0x87, 0x78, 0x88, 0x88, 0x99, 0x89, 0x9A, 0x98, 0x99,
-	0x88, 0x88, 0x88, 0x77, 0x76, 0x67, 0x77, 0x67, 0x87, 0x88, 0x88, 0x88, 0x98, 0x78, 0x98, 0x87,
-	0x77, 0x66, 0x56, 0x66, 0x78, 0x88, 0x89, 0x9A, 0xA9, 0x98, 0x87, 0x76, 0x77, 0x67, 0x67, 0x77,
-	0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x89, 0x98, 0x88, 0x98, 0x88, 0x78, 0x89,
-	0x99, 0x99, 0x99, 0x98, 0x89, 0xA9, 0x99, 0xA9, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89,
-	0x98, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x88, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x78, 0x88, 0x77, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x77, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x89, 0x98, 0x99, 0x88, 0x89, 0x88, 0x88, 0x77, 0x88, 0x88, 0x98, 0x88, 0x88,
-	0x98, 0x89, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x78,
-	0x99, 0x88, 0x98, 0x98, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x77, 0x89, 0x98, 0x98,
-	0x99, 0x99, 0x89, 0x88, 0x88, 0x87, 0x76
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0xD8, 0x20, 0x76, 0x0A, 0xE8, 0x8B, 0xA2, 0x20, 0x48, 0x88, 0x84, 0xB8, 0x72, 0x22, 0x2B,
+	0x1C, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0xDA, 0x72, 0x8B,
+	0x70, 0x22, 0x20, 0x4A, 0xDC, 0xA2, 0xB7, 0x29, 0x60, 0x88, 0x81, 0xE2, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0xB4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xB4, 0x81, 0xC9, 0x0B, 0xA2, 0xB8,
+	0x88, 0x42, 0x10, 0x88, 0xAE, 0xB8, 0x88, 0x84, 0x04, 0x8A, 0xE2, 0x2D, 0xE0, 0x42, 0x12, 0xDC,
+	0xAB, 0x4A, 0xD2, 0x84, 0x2E, 0x88, 0x8A, 0xE2, 0x20, 0x44, 0x1C, 0x7A, 0x8A, 0xE2, 0xE1, 0x14,
+	0x04, 0x2E, 0xBF, 0x30, 0x20, 0x65, 0x1E, 0x38, 0x8A, 0xEB, 0x76, 0x61, 0x24, 0xAB, 0xBA, 0xEB,
+	0x63, 0x91, 0x58, 0x12, 0xB8, 0xFC, 0xAD, 0x64, 0xCA, 0x04, 0x8B, 0xAD, 0x80, 0x78, 0x1E, 0xB1,
+	0xC6, 0x06, 0xCA, 0x2B, 0x4A, 0xEE, 0x41, 0x08, 0x88, 0x88, 0x88, 0x4E, 0x88, 0x88, 0x88, 0x84,
+	0x21, 0xC8, 0xAE, 0x2A, 0xE0, 0x42, 0x22, 0x22, 0xAE, 0x07, 0x21, 0xC6, 0x2D, 0x80, 0x6E, 0x22,
+	0xB4, 0x88, 0x88, 0x88, 0x1C, 0x38, 0x72, 0x06, 0xE0, 0x1D, 0xC8, 0x88, 0x88, 0x88, 0x71, 0x2B,
+	0xA2, 0x2B, 0x88, 0x42, 0xB7, 0x62, 0xB4, 0x88, 0x88, 0x88, 0xB6, 0x0A, 0xDC, 0x0B, 0x78, 0x42,
+	0x21, 0xC6, 0x08, 0xAE, 0x1E, 0xC8, 0x42, 0x22, 0x06, 0xD0, 0x78, 0xAB, 0xE1, 0xC1, 0x70, 0xCA,
+	0x21, 0xC4, 0x8A, 0xDB, 0xB2, 0xB1, 0x21, 0x04, 0xB6, 0xCA, 0x22, 0x2E, 0xBA, 0x11, 0x66, 0xA1,
+	0xD2, 0xE3, 0xDA, 0x69, 0xC6, 0x22, 0x21, 0x37, 0x9A, 0xB1, 0x20, 0x7E, 0x04, 0x05, 0xE8, 0x88,
+	0x97, 0x32, 0x20, 0x6E, 0x2B, 0x96, 0x20, 0x7B, 0x18, 0x14, 0xBE, 0xE4, 0x97, 0xAE, 0x19, 0x52,
+	0xEE, 0x81, 0x51, 0xCE, 0x2B, 0x87, 0x88, 0xAC, 0x50, 0xA0, 0x5A, 0xBC, 0x04, 0xAC, 0x7B, 0x0D,
+	0xD8, 0xB6, 0xA8, 0x81, 0x10, 0x4E, 0x8A, 0xD3, 0xA2, 0xF8, 0x44, 0x8B, 0x18, 0x87, 0xB4, 0xA5,
+	0xAC, 0x87, 0xB6, 0x08, 0xAD, 0x22, 0xD8, 0xB8, 0x47, 0x1B, 0x66, 0xCE, 0x60, 0x1C, 0x8A, 0xD2,
+	0x12, 0x2B, 0x8B, 0xA1, 0xD2, 0x73, 0x6C, 0x97, 0x0A, 0x88, 0x88, 0xB1, 0x4B, 0x93, 0xA2, 0x20,
+	0x78, 0x74, 0xF2, 0x62, 0xE0, 0x59, 0x2E, 0x4F, 0xC9, 0x04, 0xEA, 0xB7, 0x2D, 0x85, 0x9A, 0x38,
+	0x76, 0xB8, 0x48, 0x88, 0x1D, 0xCC, 0x86, 0x08, 0x81, 0x2B, 0x81, 0xB8, 0xB6, 0x08, 0x81, 0xED,
+	0x9C, 0x18, 0xB6, 0xCA, 0x22, 0xB7, 0x0D, 0xB2, 0xD2, 0x48, 0x8A, 0xD6, 0x6D, 0x8B, 0x0E, 0xE1,
+	0x22, 0x22, 0x13, 0x84, 0xAD, 0x2E, 0x4B, 0xBA, 0x20, 0x70, 0x5B, 0x1C, 0xB7, 0x28, 0x70, 0x72,
+	0x6D, 0x22, 0x2D, 0x27, 0xB6, 0x00, 0x78, 0x1B, 0x28, 0xB6, 0x08, 0x1D, 0x82, 0xB6, 0xBE, 0x5A,
+	0xB1, 0x07, 0x27, 0x21, 0xCA, 0x2B, 0x12, 0xB9, 0x66, 0xC1, 0xF6, 0xCC, 0x4C, 0x21, 0xF4, 0xB6,
+	0xC3, 0x00, 0xDB, 0x5C, 0xA0, 0xA2, 0xB4, 0xAC, 0x4A, 0x70, 0x77, 0x03, 0xB6, 0xDA, 0x5C, 0x98,
+	0x3C, 0x88, 0xAE, 0x11, 0x91, 0xBE, 0x08, 0xBC, 0x14, 0x77, 0x0E, 0xB1, 0xC6, 0x9A, 0x5C, 0xC3,
+	0x0D, 0x0C, 0xAB, 0x72, 0x48, 0x81, 0xDB, 0x3C, 0x01, 0xD2, 0x5A, 0x6F, 0xB3, 0x14, 0x93, 0xE2,
+	0xDA, 0x11, 0x76, 0x1E, 0xB3, 0x39, 0x66, 0x48, 0xE9, 0xFE, 0x09, 0x40, 0x47, 0xCE, 0x20, 0x88,
+	0x5C, 0xD8, 0x4F, 0x0A, 0x2B, 0x74, 0x96, 0xAE, 0x7B, 0x33, 0x66, 0x6A, 0x76, 0x98, 0xBC, 0xD2,
+	0x7D, 0x80, 0x49, 0xFA, 0x67, 0x19, 0x8B, 0xB1, 0xB0, 0x21, 0x08, 0x72, 0xBA, 0x79, 0xBD, 0x62,
+	0x79, 0xB2, 0x7D, 0x83, 0x79, 0xA4, 0xC0, 0xD6, 0x8C, 0x2E, 0xDF, 0x4C, 0x30, 0x24, 0x75, 0xB0,
+	0xB3, 0xCF, 0x6A, 0x1B, 0x50, 0x5A, 0x7C, 0x8F, 0x9C, 0x0D, 0x64, 0xCE, 0x38, 0x9E, 0x4D, 0x84,
+	0x64, 0xCF, 0x9E, 0x68, 0x5A, 0x67, 0x67, 0x8C, 0xC7, 0x21, 0x90, 0x4F, 0x8C, 0x3D, 0x3B, 0x46,
+	0x8D, 0x92, 0xFE, 0x05, 0xCC, 0xB5, 0x82, 0x74, 0xCB, 0xB6, 0x1B, 0xC9, 0x40, 0x6B, 0x77, 0x2B,
+	0x8D, 0xCA, 0x51, 0x4D, 0xB0, 0xB7, 0xA9, 0xC8, 0x5B, 0x98, 0x59, 0xDC, 0x32, 0x9E, 0x23, 0xC6,
+	0x47, 0x43, 0x4C, 0xBD, 0x8F, 0x66, 0x88, 0x36, 0x19, 0x1C, 0xC7, 0x9B, 0x62, 0xED, 0x1C, 0x1C,
+	0xC9, 0xDA, 0x37, 0x26, 0x0B, 0x1F, 0x4B, 0x72, 0x72, 0x18, 0x4D, 0xCC, 0xB5, 0xB6, 0xC0, 0x34,
+	0xBB, 0x2B, 0xD0, 0x5E, 0x4C, 0x8D, 0x4B, 0x3E, 0xB1, 0x93, 0x18, 0xD9, 0xCE, 0x64, 0xE7, 0x0A,
+	0xB5, 0x8D, 0x6A, 0x5F, 0x1A, 0xB1, 0x28, 0x97, 0xD6, 0x27, 0x2F, 0x1C, 0x9C, 0xC8, 0x4B, 0x4D,
+	0xCD, 0xA1, 0x88, 0xF1, 0xC6, 0x71, 0xC8, 0x0F, 0x96, 0x31, 0x34, 0xCE, 0x9C, 0x76, 0x88, 0xCA,
+	0xC1, 0xF4, 0xE5, 0xC8, 0xC3, 0x7C, 0x69, 0x93, 0x2D, 0xA9, 0xA4, 0xB4, 0x76, 0x1C, 0x6D, 0x72,
+	0x32, 0xA1, 0xD2, 0xF7, 0x62, 0xD8, 0x39, 0x71, 0xC8, 0xF1, 0xC2, 0xDB, 0x1C, 0x6C, 0x2D, 0x72,
+	0x6C, 0x39, 0xA0, 0x57, 0x98, 0x37, 0x1B, 0x70, 0xC7, 0x0A, 0xC6, 0xD3, 0x1B, 0x36, 0x2D, 0x8C,
+	0xB7, 0x69, 0xA4, 0x9F, 0x4D, 0xA2, 0xB4, 0xE3, 0x0D, 0xC6, 0x9D, 0x36, 0x8C, 0x8B, 0xD6, 0x73,
+	0x23, 0x61, 0x8D, 0x9B, 0x99, 0x79, 0x2C, 0x37, 0x36, 0x9E, 0x61, 0xD8, 0xB0, 0xDA, 0x0F, 0x4D,
+	0xA6, 0xC2, 0xEB, 0x47, 0x02, 0x71, 0xF1, 0xAD, 0x0D, 0xC8, 0xC6, 0x72, 0xC6, 0x0F, 0x62, 0xD3,
+	0x5B, 0x02, 0x20, 0x78, 0xB7, 0x0B, 0xD8, 0x10, 0xDC, 0x78, 0xDA, 0x2C, 0x4A, 0xDC, 0x36, 0x70,
+	0xAC, 0x6D, 0x36, 0x22, 0x1C, 0xA2, 0x2E, 0x1C, 0x9D, 0x37, 0x21, 0xA2, 0x04, 0xB9, 0x3E, 0x49,
+	0xF6, 0x0C, 0x89, 0x79, 0x31, 0xB9, 0x2E, 0xD8, 0x7C, 0x63, 0x93, 0x91, 0xC3, 0x30, 0x8B, 0x5C,
+	0x9A, 0x73, 0x1C, 0x82, 0xD2, 0x1F, 0x62, 0x3D, 0xA4, 0x1F, 0x1B, 0x0D, 0xA3, 0x5A, 0xD8, 0x1B,
+	0x88, 0x88, 0x81, 0xE2, 0x2C, 0x5C, 0xAD, 0xC3, 0x70, 0x8D, 0x70, 0x30, 0xD3, 0xA2, 0x06, 0xED,
+	0x2B, 0x96, 0xD8, 0x82, 0x1C, 0x70, 0xE1, 0xAD, 0xA0, 0x88, 0x88, 0x88, 0xAB, 0x1D, 0x8D, 0x8D,
+	0xA6, 0x22, 0x23, 0x6D, 0x88, 0x72, 0x21, 0xC8, 0x88, 0x81, 0xB1, 0xE2, 0x22, 0x2D, 0x82, 0x22,
+	0x21, 0xC6, 0xC7, 0x0E, 0xB4, 0xD3, 0x72, 0x0D, 0xC9, 0xA3, 0x48, 0x8D, 0xC2, 0x0D, 0x9C, 0x6E,
+	0x92, 0x07, 0x88, 0x77, 0x21, 0xB6, 0x8D, 0xD8, 0xA2, 0x34, 0xC8, 0xAD, 0x2B, 0x96, 0x72, 0x73,
+	0x91, 0xCB, 0x0C, 0x4A, 0xD8, 0x29, 0xDA, 0x2B, 0x69, 0x22, 0x1C, 0x9C, 0x1E, 0x37, 0x08, 0x88,
+	0x1E, 0x33, 0x69, 0xD8, 0x2B, 0x4A, 0x22, 0x22, 0x13, 0xA0, 0xDA, 0x07, 0x82, 0x22, 0x22, 0x2B,
+	0x49, 0xF6, 0x9A, 0x60, 0x72, 0x71, 0xCA, 0xB4, 0xB4, 0xDB, 0x03, 0xD2, 0x72, 0x88, 0x1B, 0x28,
+	0x8B, 0x62, 0xE4, 0xDC, 0x08, 0x8A, 0xD2, 0x07, 0x72, 0x1C, 0x6C, 0xA5, 0xE0, 0x88, 0x8A, 0xDB,
+	0x12, 0x81, 0xC9, 0xC8, 0x72, 0x1E, 0x08, 0x8A, 0xD2, 0x8A, 0xDB, 0x5A, 0xB6, 0x2D, 0x22, 0x2B,
+	0x48, 0x76, 0xA2, 0x1C, 0xAD, 0x20, 0x7C, 0xD2, 0x8F, 0x4A, 0xD8, 0x8B, 0x71, 0xA0, 0x72, 0x81,
+	0xE0, 0x6F, 0x60, 0xA1, 0xC7, 0x2B, 0x60, 0x88, 0x87, 0x27, 0x1C, 0xA2, 0x21, 0xC8, 0x88, 0x8D,
+	0x8F, 0x4A, 0x22, 0x22, 0x21, 0xCB, 0x70, 0x20, 0x79, 0xA8, 0x4E, 0x88, 0x1F, 0x24, 0x93, 0xE4,
+	0xDA, 0x08, 0x88, 0x88, 0x76, 0x9C, 0xA2, 0xDC, 0xC6, 0x08, 0x88, 0x12, 0xE7, 0x4B, 0xA2, 0xB4,
+	0xAC, 0x79, 0x08, 0x1C, 0x9B, 0x4C, 0xCB, 0x9D, 0xA6, 0x92, 0x20, 0x4A, 0xDC, 0xAD, 0xB2, 0x88,
+	0x1D, 0x31, 0x82, 0xBB, 0x6F, 0x06, 0x49, 0xC8, 0xAB, 0x41, 0xC6, 0x22, 0xFC, 0xE2, 0x54, 0x11,
+	0xCE, 0xF3, 0x20, 0x45, 0x14, 0xCB, 0xF2, 0xB1, 0xD8, 0x47, 0x09, 0xCB, 0xEC, 0x64, 0x64, 0xBE,
+	0xE8, 0x85, 0x44, 0x3B, 0xEA, 0xC5, 0xDA, 0xC1, 0x20, 0x6D, 0x0F, 0x6B, 0x62, 0x1C, 0x9E, 0xCE,
+	0x95, 0x16, 0x3B, 0xF8, 0x95, 0x04, 0xBF, 0xA9, 0x11, 0x1A, 0xFB, 0x9A, 0x76, 0x68, 0xD6, 0x94,
+	0xB3, 0xFA, 0x05, 0x50, 0xBE, 0xF8, 0x15, 0x0C, 0xBE, 0xD2, 0x41, 0x3B, 0xFC, 0x85, 0x11, 0xAB,
+	0xFB, 0x01, 0x44, 0xCE, 0xAF, 0x25, 0x92, 0x69, 0xD8, 0xFA, 0x15, 0x10, 0xEE, 0xBF, 0x90, 0xC6,
+	0x10, 0xFC, 0xF2, 0xC5, 0x21, 0x78, 0x3D, 0x24, 0x63, 0x6E, 0x37, 0x18, 0x91, 0xEA, 0xE3, 0x67,
+	0x62, 0x7A, 0x22, 0xF7, 0x9B, 0x06, 0x4D, 0x36, 0xB3, 0x6D, 0xA6, 0x99, 0x69, 0x98, 0x6F, 0xB7,
+	0x83, 0x11, 0x16, 0xCA, 0xFB, 0x0D, 0x44, 0xBB, 0x8E, 0xDA, 0x40, 0x54, 0x3E, 0xF8, 0x0D, 0x65,
+	0x97, 0xAC, 0x38, 0xD3, 0x58, 0x33, 0x86, 0xE1, 0x36, 0x15, 0xBA, 0xAD, 0xF9, 0x19, 0x90, 0xEE,
+	0x81, 0xFE, 0x95, 0x29, 0x13, 0xF3, 0x33, 0x8D, 0x40, 0x49, 0xAF, 0xF2, 0xE4, 0xF0, 0x14, 0x02,
+	0x22, 0xBF, 0xEC, 0x12, 0x45, 0x13, 0x8C, 0xF8, 0xAE, 0x10, 0x45, 0xA5, 0xCA, 0xAE, 0xB8, 0x84,
+	0x57, 0x88, 0x4B, 0xF9, 0x16, 0x2F, 0x21, 0xEB, 0x71, 0x1A, 0xBC, 0x2B, 0xE9, 0x59, 0x63, 0x2F,
+	0xE8, 0x45, 0xB1, 0x52, 0x3F, 0xA8, 0x04, 0x16, 0xC0, 0x45, 0xBB, 0xCC, 0x81, 0xB4, 0x69, 0xB8,
+	0xAE, 0x08, 0x14, 0x45, 0x18, 0xBF, 0xEB, 0xAE, 0x95, 0x87, 0x38, 0xE0, 0x7C, 0x05, 0x42, 0x42,
+	0xE8, 0x85, 0x02, 0xB4, 0x8A, 0xB8, 0x12, 0xE7, 0xC6, 0xC8, 0xA2, 0x07, 0x82, 0x22, 0xBC, 0xB2,
+	0x88, 0x71, 0x20, 0x6D, 0x2B, 0xAC, 0x78, 0x41, 0x04, 0xD8, 0x8A, 0xD2, 0xE8, 0x74, 0x0B, 0xA2,
+	0x2E, 0x53, 0x2A, 0xF3, 0x12, 0x06, 0xD1, 0xE6, 0xCA, 0x2E, 0xB9, 0x2D, 0x60, 0x20, 0x7C, 0x6B,
+	0x8F, 0x99, 0x12, 0x51, 0xBB, 0xAF, 0x69, 0xC0, 0x4E, 0x42, 0x22, 0x07, 0x1C, 0x38, 0x72, 0xC5,
+	0x28, 0x8B, 0x17, 0x27, 0x9B, 0x22, 0x88, 0x1D, 0xA8, 0x8A, 0xB4, 0x8B, 0x6D, 0xA8, 0x88, 0x88,
+	0x12, 0xE4, 0xB4, 0xB6, 0x22, 0x2B, 0x72, 0x48, 0x84, 0xE1, 0xB4, 0xE1, 0xE2, 0xE4, 0x07, 0x80,
+	0x79, 0x38, 0x81, 0xE2, 0x22, 0x22, 0xB4, 0xAD, 0x68, 0x77, 0x0C, 0xA0, 0xAB, 0x96, 0xC5, 0xA7,
+	0x02, 0xDE, 0x0E, 0xF0
 };
 
+/* 2-bit ADPCM, SNR 14.2 dB */
 const u8 sfx_projectile_contact[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x77,
-	0x77, 0x76, 0x78, 0x88, 0x99, 0x99, 0x78, 0x77, 0x77, 0x77, 0x66, 0x77, 0x87, 0x89, 0x89, 0x78,
-	0x98, 0x89, 0x88, 0x88, 0x67, 0x79, 0x9A, 0xA9, 0x77, 0x78, 0x78, 0x98, 0x87, 0x78, 0x88, 0x98,
-	0x99, 0x88, 0x88, 0x88, 0x9B, 0xBB, 0xA9, 0x97, 0x88, 0x88, 0x99, 0x88, 0x87, 0x78, 0x89, 0x86,
-	0x67, 0x67, 0x66, 0x77, 0x98, 0x97, 0x87, 0x76, 0x67, 0x46, 0x77, 0x78, 0x78, 0x98, 0x78, 0x77,
-	0x88, 0x66, 0x99, 0x88, 0x98, 0x98, 0x88, 0x77, 0x98, 0x8A, 0xA7, 0xA8, 0x89, 0x98, 0x99, 0x89,
-	0x9A, 0x89, 0x9A, 0xB9, 0xAA, 0x98, 0xBA, 0x8A, 0x78, 0x8A, 0xBA, 0x76, 0x77, 0x89, 0x88, 0x85,
-	0x57, 0x8A, 0x78, 0x87, 0x66, 0x8A, 0x9A, 0x88, 0x75, 0x57, 0x76, 0x64, 0x45, 0x78, 0x8A, 0x9A,
-	0x99, 0x99, 0xA9, 0xA7, 0x76, 0x77, 0x87, 0x88, 0x88, 0xAA, 0x99, 0xA8, 0x89, 0x89, 0x88, 0x88,
-	0x99, 0x98, 0x89, 0x87, 0x89, 0x89, 0x98, 0x89, 0x79, 0x99, 0x9A, 0x98, 0x98, 0xAA, 0x99, 0x88,
-	0x77, 0x7A, 0xB9, 0x76, 0x77, 0x88, 0x89, 0x89, 0x85, 0x66, 0x78, 0x86, 0x57, 0x67, 0x89, 0x88,
-	0x76, 0x76, 0x67, 0x77, 0x66, 0x66, 0x77, 0x77, 0x78, 0x98, 0x99, 0x88, 0x88, 0x88, 0x98, 0x88,
-	0x88, 0x77, 0x66, 0x67, 0x76, 0x78, 0xAB, 0xBB, 0xCB, 0xA8, 0x65, 0x45, 0x66, 0x65, 0x78, 0x89,
-	0x99, 0x98, 0x88, 0x77, 0x78, 0x98, 0x99, 0x88, 0x87, 0x76, 0x56, 0x65, 0x78, 0xAA, 0xBB, 0xBA,
-	0xA9, 0x98, 0x78, 0x86, 0x88, 0x78, 0x99, 0x86, 0x78, 0xBA, 0xBA, 0xAA, 0xAA, 0x9A, 0x88, 0x89,
-	0xA7, 0x77, 0x78, 0x99, 0xAA, 0x97, 0x66, 0x79, 0x77, 0x88, 0x77, 0x89, 0xAC, 0x9A, 0x87, 0x66,
-	0x67, 0x76, 0x43, 0x66, 0x76, 0x79, 0xAB, 0xBA, 0x88, 0x54, 0x33, 0x47, 0x9D, 0xCC, 0xB9, 0x87,
-	0x74, 0x33, 0x35, 0x67, 0x9A, 0xBB, 0xCB, 0xAA, 0x98, 0x54, 0x34, 0x67, 0x89, 0xBB, 0xCC, 0xBC,
-	0xBB, 0x99, 0x68, 0x78, 0x76, 0x69, 0xA9, 0x9A, 0xA8, 0x88, 0x88, 0x76, 0x88, 0xA9, 0x78, 0x9B,
-	0xBA, 0x98, 0x87, 0x77, 0x67, 0x66, 0x56, 0x77, 0x87, 0x75, 0x46, 0x66, 0x89, 0x87, 0x55, 0x67,
-	0x99, 0x99, 0x88, 0x88, 0x67, 0x78, 0xAA, 0xAA, 0xB9, 0xA8, 0x9A, 0x99, 0x89, 0x88, 0x77, 0x98,
-	0x87, 0x88, 0x99, 0x9A, 0x88, 0x9A, 0xB9, 0x99, 0x98, 0x98, 0x68, 0x89, 0x89, 0x99, 0x99, 0xA9,
-	0xAA, 0x99, 0x88, 0x99, 0x98, 0x88, 0x87, 0x67, 0x77, 0x56, 0x66, 0x66, 0x77, 0x87, 0x89, 0x89,
-	0x98, 0x98, 0x89, 0x99, 0x98, 0x86, 0x77, 0x87, 0x67, 0x88, 0x87, 0x87, 0x89, 0xAA, 0xAA, 0xAA,
-	0xA9, 0x98, 0x87, 0x78, 0x78, 0x98, 0x88, 0x99, 0x77, 0x77, 0x88, 0x88, 0x88, 0x77, 0x88, 0x99,
-	0x99, 0x76, 0x88, 0x77, 0x78, 0x89, 0x88, 0x87, 0x76, 0x88, 0x89, 0x99, 0x98, 0x89, 0x98, 0x89,
-	0x89, 0x87, 0x88, 0x77, 0x76, 0x77, 0x67, 0x89, 0x88, 0x78, 0x77, 0x77, 0x76, 0x76, 0x66, 0x67,
-	0x78, 0x99, 0x9A, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x89, 0xAA, 0xCD, 0xCB, 0xBB, 0xBC, 0xAB,
-	0x98, 0x88, 0x89, 0x99, 0x98, 0x9A, 0x99, 0x99, 0x99, 0x87, 0x87, 0x89, 0x87, 0x87, 0x87, 0x76,
-	0x66, 0x65, 0x44, 0x67, 0x66, 0x67, 0x78, 0x87, 0x77, 0x77, 0x88, 0x9A, 0xA9, 0x88, 0x77, 0x88,
-	0x88, 0x87, 0x75, 0x56, 0x76, 0x77, 0x77, 0x76, 0x67, 0x89, 0x99, 0x89, 0x8A, 0xBB, 0xCB, 0xBC,
-	0xBA, 0xBA, 0xA8, 0x76, 0x66, 0x79, 0x98, 0x88, 0x78, 0x77, 0x67, 0x87, 0x88, 0x9A, 0xA9, 0xAA,
-	0xA9, 0x88, 0x89, 0xAA, 0xBB, 0xAA, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x67, 0x79, 0x98, 0x9A, 0x98, 0x88, 0x89, 0x99, 0x98, 0x88, 0x89, 0x99, 0xAA, 0x99, 0x76,
-	0x66, 0x88, 0x87, 0x67, 0x76, 0x56, 0x88, 0x77, 0x66, 0x67, 0x77, 0x76, 0x65, 0x55, 0x57, 0x78,
-	0x99, 0x8A, 0xAA, 0x98, 0x88, 0x98, 0x88, 0x88, 0x88, 0x78, 0x88, 0x77, 0x8A, 0x9A, 0xBA, 0xAA,
-	0xA8, 0x87, 0x8A, 0xAA, 0xBA, 0xAA, 0xAA, 0xAB, 0xBB, 0xBA, 0x9B, 0xBA, 0xA9, 0x87, 0x66, 0x66,
-	0x66, 0x66, 0x65, 0x54, 0x57, 0x87, 0x77, 0x66, 0x65, 0x44, 0x55, 0x56, 0x68, 0x99, 0x89, 0x99,
-	0xAA, 0xAA, 0xAA, 0xBB, 0xAA, 0xAA, 0x98, 0x77, 0x77, 0x77, 0x76, 0x77, 0x78, 0x89, 0x87, 0x66,
-	0x78, 0x88, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x78, 0x99, 0x98, 0x98, 0x76, 0x55, 0x56, 0x88, 0x99,
-	0x99, 0x9A, 0x99, 0x88, 0x65, 0x67, 0x87, 0x78, 0x89, 0xAA, 0xA9, 0x88, 0x87, 0x76, 0x67, 0x89,
-	0xA9, 0xAA, 0x98, 0x99, 0x99, 0x98, 0x66, 0x67, 0x77, 0x8A, 0x98, 0x98, 0x65, 0x55, 0x77, 0x88,
-	0x98, 0x99, 0x8A, 0x9A, 0xA9, 0x89, 0x88, 0x99, 0xA9, 0x86, 0x66, 0x68, 0x87, 0x77, 0x78, 0x87,
-	0x77, 0x87, 0x77, 0x67, 0x78, 0x88, 0x9A, 0xA9, 0xAA, 0x99, 0xAB, 0xBC, 0xCB, 0xA9, 0x98, 0x77,
-	0x78, 0x88, 0x98, 0x88, 0x88, 0x99, 0x88, 0x87, 0x77, 0x77, 0x77, 0x78, 0x88, 0x87, 0x67, 0x65,
-	0x56, 0x66, 0x66, 0x67, 0x67, 0x77, 0x77, 0x88, 0x98, 0x88, 0x77, 0x65, 0x66, 0x67, 0x67, 0x88,
-	0x88, 0x99, 0x98, 0x88, 0x99, 0x99, 0xAB, 0xCC, 0xCC, 0xCB, 0xCB, 0xAA, 0xA9, 0x99, 0x99, 0x98,
-	0x88, 0x99, 0x99, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x77, 0x77, 0x77, 0x77, 0x87, 0x66,
-	0x67, 0x66, 0x66, 0x66, 0x76, 0x68, 0x98, 0x87, 0x78, 0x88, 0x87, 0x65, 0x56, 0x78, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x99, 0x88,
-	0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x77, 0x66, 0x77, 0x8A, 0x99, 0x98, 0x76, 0x55, 0x57, 0x88,
-	0x99, 0x89, 0x88, 0x88, 0xA9, 0x88, 0x98, 0x87, 0x77, 0x88, 0x89, 0xAA, 0xA9, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x78, 0x87, 0x78, 0x88, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88, 0x77, 0x67, 0x77, 0x88,
-	0x88, 0x88, 0x99, 0x99, 0x99, 0x89, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x99,
-	0x98, 0x87, 0x77, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x76, 0x78, 0x88, 0x88, 0x99,
-	0x99, 0xAA, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x9A, 0xA9, 0x87, 0x77, 0x77,
-	0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x77, 0x89, 0x99, 0x99, 0x98, 0x88, 0x99, 0x98, 0x98,
-	0x87, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89,
-	0x89, 0x88, 0x88, 0x88, 0x78, 0x89, 0x89, 0x89, 0x99, 0x99, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x98, 0x89, 0x98, 0x89, 0x99, 0x88, 0x87, 0x78, 0x88, 0x99, 0x99, 0x98, 0x87, 0x77,
-	0x88, 0x77, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x78, 0x77, 0x67, 0x77, 0x89, 0x98, 0x78, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x87, 0x76, 0x78, 0x89, 0x99, 0x99, 0x88, 0x99, 0xAA, 0xBA, 0xA9, 0x98,
-	0x87, 0x78, 0x88, 0x98, 0x99, 0xAA, 0x98, 0x78, 0x78, 0x88, 0x88, 0x88, 0x98, 0x88, 0x87, 0x77,
-	0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x87, 0x77, 0x89, 0x98, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x9A, 0xAA, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x76, 0x66, 0x66, 0x66,
-	0x77, 0x77, 0x78, 0x88, 0x99, 0xAA, 0x99, 0x9A, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xA9,
-	0x99, 0x98, 0x98, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88,
-	0x77, 0x76, 0x65, 0x56, 0x78, 0x89, 0x98, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x87, 0x77, 0x88,
-	0x88, 0x89, 0x98, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x88, 0x77, 0x77, 0x78, 0x99,
-	0x9A, 0xAA, 0x9A, 0x99, 0x89, 0x99, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x77, 0x87, 0x78,
-	0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x89, 0x99, 0x89, 0x99, 0xA9, 0x88, 0x77, 0x78, 0x88, 0x87, 0x89, 0x98, 0xAA, 0x99,
-	0x9A, 0x98, 0x88, 0x9B, 0xBB, 0xBA, 0x98, 0x89, 0x99, 0x88, 0x89, 0x98, 0x87, 0x78, 0x88, 0x88,
-	0x77, 0x77, 0x88, 0x77, 0x67, 0x77, 0x77, 0x76, 0x67, 0x88, 0x77, 0x77, 0x55, 0x67, 0x89, 0x99,
-	0x88, 0x88, 0x76, 0x66, 0x77, 0x77, 0x77, 0x89, 0xAA, 0xA9, 0x99, 0x99, 0x9A, 0xAA, 0xA9, 0x99,
-	0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x77, 0x66, 0x77, 0x76, 0x66, 0x78, 0x99,
-	0x99, 0x9A, 0xAA, 0xA9, 0x87, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x98, 0x77, 0x88, 0x77, 0x77,
-	0x76, 0x66, 0x66, 0x67, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x89, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x77, 0x78, 0x87, 0x67, 0x77, 0x78, 0x77, 0x88, 0x87, 0x77, 0x77, 0x88, 0x98,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x89, 0x88, 0x89,
-	0x99, 0x99, 0x99, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x77, 0x77, 0x88, 0x87, 0x77, 0x78, 0x87, 0x77, 0x88, 0x88, 0x88, 0x77, 0x78, 0x89, 0x99,
-	0x99, 0x99, 0x88, 0x98, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x89, 0x88, 0x89, 0x88,
-	0x98, 0x76, 0x67, 0x89, 0x99, 0x98, 0x88, 0x77, 0x77, 0x88, 0x87, 0x76, 0x78, 0x89, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x9A, 0x99, 0xAA, 0x99, 0x99, 0x89,
-	0x98, 0x88, 0x89, 0x99, 0x88, 0x89, 0x99, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
-	0x66, 0x77, 0x77, 0x78, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77,
-	0x76, 0x66, 0x78, 0x88, 0x78, 0x77, 0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0xAA, 0xBB, 0xAA, 0xA9,
-	0x98, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x98, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x98, 0x88, 0x88, 0x77, 0x77, 0x77,
-	0x87, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x87, 0x77,
-	0x77, 0x78, 0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x88, 0x88, 0x77, 0x78, 0x77, 0x88, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x77, 0x78, 0x89, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x88,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x89, 0x89, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x89, 0x99, 0x99, 0x98, 0x77, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x77, 0x67, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x89, 0x98,
-	0x88, 0x87, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x88, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9A, 0x98, 0x87, 0x77, 0x87,
-	0x87, 0x66, 0x78, 0x77, 0x76, 0x67, 0x88, 0x88, 0x88, 0x76, 0x55, 0x67, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x98, 0x99, 0x98, 0x76, 0x66, 0x88, 0x88, 0x9A, 0xAA, 0xAA, 0x99, 0x99, 0x89, 0x99, 0x88,
-	0x78, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x77, 0x76, 0x67, 0x88, 0x89, 0x9A, 0xAA, 0xA9,
-	0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x89, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99,
-	0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89,
-	0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x78, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x99, 0x89, 0x99, 0x99,
-	0x9A, 0xAA, 0x98, 0x88, 0x88, 0x88, 0x87, 0x78, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x78, 0x88, 0x87, 0x77, 0x76, 0x66, 0x77, 0x77, 0x88, 0x89, 0x99, 0x99, 0xA9, 0x99, 0x99, 0x88,
-	0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x98, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x76, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xA9, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x77, 0x77, 0x88, 0x99, 0x98, 0x88, 0x99, 0x99, 0x88, 0x99, 0x88, 0x88, 0x87, 0x77, 0x76, 0x67,
-	0x77, 0x77, 0x76, 0x66, 0x65, 0x55, 0x54, 0x45, 0x67, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x77,
-	0x78, 0x89, 0xAB, 0xBB, 0x99, 0x9A, 0xAA, 0x99, 0x98, 0x99, 0x9A, 0xA9, 0x99, 0x99, 0xAA, 0xA9,
-	0x98, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x98, 0x87, 0x77,
-	0x77, 0x66, 0x66, 0x66, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x78, 0x99,
-	0x99, 0x98, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0xAA, 0xA9, 0x9A, 0xA9, 0x99,
-	0x99, 0x99, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x87, 0x77, 0x66,
-	0x77, 0x88, 0x87, 0x66, 0x67, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x99, 0x98, 0x89, 0x99, 0xAA,
-	0xAA, 0xA9, 0x89, 0x98, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x99, 0x9A,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x76, 0x67, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x98, 0x88, 0x99, 0x9A, 0x99, 0x99, 0xA9, 0xAA, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x98, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x99, 0x99, 0x89, 0x99, 0x88, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x77, 0x66, 0x66, 0x66, 0x67, 0x78, 0x88, 0x88, 0x88, 0x99, 0x9A, 0x99,
-	0x98, 0x88, 0x87, 0x88, 0x77, 0x89, 0x99, 0x9A, 0xA9, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x99, 0x88, 0x88, 0x88, 0x77, 0x88, 0x87, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
-	0x88, 0x77, 0x78, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87, 0x78, 0x99, 0x9A, 0xA9, 0x98, 0x88, 0x89,
-	0xA9, 0x99, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x78, 0x88, 0x89, 0xAA, 0xA9, 0x88, 0x77, 0x78, 0x88, 0x99, 0x98, 0x88, 0x88, 0x99, 0x88,
-	0x99, 0x9A, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x99, 0xA9, 0x98, 0x87, 0x88, 0x88, 0x77, 0x77, 0x76,
-	0x76, 0x66, 0x77, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x77, 0x67, 0x77, 0x77, 0x87, 0x77,
-	0x88, 0x87, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x9A, 0xAA, 0xA9, 0x99, 0x99, 0x99,
-	0x99, 0x9A, 0x99, 0x99, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x77, 0x78,
-	0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x87, 0x77, 0x88, 0x77, 0x77, 0x77, 0x87,
-	0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x99, 0xAA,
-	0xAA, 0xAA, 0xA9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0x99, 0x99, 0x9A, 0xAA, 0x99,
-	0x99, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x87, 0x78, 0x88, 0x87, 0x78, 0x88, 0x99, 0x99, 0x99, 0x87, 0x77, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x87, 0x78, 0x99, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xA8
+	0xD0, 0xA2, 0x22, 0x22, 0x1C, 0x88, 0x1E, 0x2E, 0x8B, 0x58, 0x47, 0xCA, 0x8A, 0xC4, 0x74, 0xDC,
+	0x21, 0xE3, 0xC5, 0x93, 0xE1, 0x87, 0x30, 0x27, 0x4E, 0x21, 0x52, 0xFB, 0x08, 0x4E, 0xB9, 0x5F,
+	0x0C, 0xA5, 0x63, 0xAB, 0xDC, 0x61, 0x87, 0x9C, 0x2C, 0x5A, 0x63, 0xAD, 0x71, 0xB6, 0x9A, 0x69,
+	0x9C, 0x17, 0x2C, 0x6D, 0xE1, 0x7A, 0x04, 0xCF, 0x94, 0xCA, 0xC5, 0x8E, 0xF1, 0xAF, 0x11, 0x18,
+	0xE0, 0x77, 0xB0, 0x34, 0x96, 0xB7, 0x0C, 0xA0, 0x4F, 0x1E, 0x4D, 0xA9, 0xD8, 0x1E, 0x76, 0x8E,
+	0xB5, 0x7A, 0x04, 0x99, 0xF8, 0x4E, 0xD8, 0x5A, 0xE3, 0x1A, 0xE0, 0x42, 0x16, 0x6C, 0x88, 0x72,
+	0xAE, 0xE1, 0x35, 0x40, 0x7F, 0xAC, 0x63, 0x41, 0x2B, 0xAE, 0x16, 0x6C, 0xBF, 0x93, 0x44, 0x0B,
+	0xBE, 0xDB, 0x69, 0x1F, 0x12, 0x68, 0xAD, 0xE9, 0x7A, 0x16, 0x4F, 0xC1, 0xC2, 0xC4, 0x5C, 0xEA,
+	0x1E, 0xF4, 0x25, 0x13, 0xEE, 0xB5, 0x12, 0xBE, 0xBA, 0x15, 0x40, 0x78, 0xFE, 0xC4, 0x14, 0x2C,
+	0xBF, 0xC9, 0xB1, 0x60, 0xF2, 0x2F, 0x46, 0xC5, 0x3B, 0x32, 0xCA, 0xD4, 0x3F, 0x90, 0x5B, 0xC9,
+	0x4A, 0xAB, 0xC5, 0x62, 0x73, 0x0B, 0xDC, 0xC6, 0xA1, 0x4D, 0xE4, 0x72, 0xA7, 0xC1, 0x80, 0x87,
+	0x6A, 0xE4, 0xB8, 0xFD, 0xAC, 0x08, 0x47, 0x58, 0xB7, 0x00, 0xFB, 0x27, 0xD2, 0x36, 0x14, 0x88,
+	0xBF, 0x30, 0xD2, 0x87, 0xE0, 0x42, 0x2E, 0x50, 0xBF, 0x68, 0x11, 0xE3, 0xB5, 0x92, 0xB1, 0xB1,
+	0xDE, 0x0E, 0xB4, 0xD1, 0xAC, 0xC8, 0xB7, 0x81, 0x50, 0xDC, 0xA2, 0xB9, 0x4D, 0x14, 0xB2, 0xDC,
+	0xE8, 0x90, 0xB5, 0xA8, 0xAF, 0x34, 0xE6, 0x3B, 0x2F, 0xC5, 0xA1, 0x13, 0x88, 0x51, 0x3E, 0xC6,
+	0x0F, 0xBD, 0x20, 0x8B, 0x15, 0x2D, 0xD0, 0x30, 0xF2, 0xFE, 0x85, 0x2A, 0xDC, 0xC6, 0x65, 0xA6,
+	0x3E, 0x14, 0x6C, 0xB8, 0xAB, 0x3C, 0x60, 0x8A, 0xED, 0x13, 0x5B, 0x81, 0x2B, 0xA1, 0x04, 0xFF,
+	0x24, 0x3C, 0x3D, 0x0E, 0xA1, 0x2B, 0xB8, 0x54, 0x4D, 0x2F, 0x26, 0xA0, 0xAD, 0x8F, 0x59, 0x29,
+	0xFA, 0x50, 0x38, 0x81, 0x2B, 0xD3, 0x3E, 0xC8, 0x88, 0xBF, 0x52, 0xAC, 0xEE, 0x41, 0x56, 0x98,
+	0x42, 0x06, 0xE3, 0xFA, 0x22, 0xB4, 0x94, 0xFA, 0x52, 0x48, 0x72, 0xBD, 0x0B, 0x7E, 0xA1, 0x56,
+	0x09, 0xEE, 0xF1, 0x31, 0x96, 0x3C, 0xB3, 0x94, 0x26, 0xF6, 0x2F, 0xC9, 0x35, 0xA3, 0xE8, 0x50,
+	0x64, 0xD9, 0xB9, 0xC0, 0x7E, 0xA5, 0x38, 0x13, 0xC7, 0x2D, 0x92, 0x53, 0x0E, 0x51, 0xBB, 0xBA,
+	0x10, 0x72, 0x06, 0xCF, 0x28, 0x81, 0x2B, 0xCF, 0x00, 0x81, 0xD8, 0x94, 0x78, 0xEF, 0x01, 0xD0,
+	0x04, 0xB8, 0x49, 0x50, 0x2B, 0x7C, 0xB2, 0x2B, 0x84, 0xAE, 0x01, 0x22, 0xAE, 0xE2, 0x20, 0x7E,
+	0x1C, 0x88, 0x75, 0x33, 0x08, 0xBF, 0x94, 0x83, 0xC9, 0x02, 0x22, 0x22, 0x20, 0x48, 0x88, 0x8A,
+	0xE2, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB4, 0x6C, 0xAB, 0x81, 0x22, 0xFC, 0x45, 0xAB, 0xEE, 0x50,
+	0x2D, 0xC9, 0x6E, 0x6B, 0x84, 0x56, 0x38, 0xAB, 0x8A, 0xD3, 0x90, 0x78, 0xB6, 0x22, 0xF9, 0x24,
+	0x20, 0x48, 0xAD, 0x3A, 0x21, 0xC8, 0x8A, 0xD4, 0xBB, 0x86, 0xD2, 0x08, 0xAB, 0x8B, 0x52, 0x84,
+	0x06, 0xCF, 0x28, 0x88, 0x84, 0x21, 0x7E, 0x83, 0xC4, 0xA2, 0x2E, 0x85, 0x42, 0x2B, 0x84, 0xB7,
+	0xA8, 0x84, 0x2E, 0x88, 0x12, 0x22, 0x22, 0x21, 0xDA, 0x8A, 0xD1, 0xC9, 0x22, 0xB4, 0xE8, 0x88,
+	0x84, 0xB1, 0xB1, 0x3C, 0xB9, 0x04, 0x2B, 0xB8, 0x6C, 0x6E, 0x08, 0x4A, 0xDC, 0xC0, 0x53, 0xC2,
+	0x0A, 0xE0, 0x7B, 0x41, 0x0A, 0xE5, 0x66, 0xBB, 0xB9, 0x07, 0x42, 0xFC, 0x98, 0x88, 0x72, 0xB8,
+	0x4E, 0x88, 0x81, 0xB9, 0x5B, 0x2D, 0x82, 0x22, 0x05, 0x0F, 0x22, 0x22, 0xAC, 0xF2, 0xBA, 0x20,
+	0x48, 0x10, 0x44, 0xE1, 0x22, 0xE8, 0x84, 0x2B, 0x8B, 0x78, 0x22, 0xB8, 0x81, 0x10, 0xBA, 0x22,
+	0xEB, 0xF1, 0x11, 0xAA, 0xB8, 0x81, 0x2B, 0x84, 0x21, 0x3E, 0x88, 0x12, 0x21, 0x2E, 0xE8, 0x14,
+	0x12, 0xDE, 0x98, 0xFA, 0x88, 0x88, 0x70, 0x79, 0xC8, 0x88, 0xB1, 0x48, 0x8A, 0xB8, 0x04, 0x88,
+	0xAC, 0x52, 0xD2, 0x7E, 0xA1, 0x0B, 0x53, 0x68, 0x1F, 0x91, 0x0B, 0xF9, 0x8C, 0x93, 0xF1, 0x83,
+	0xC8, 0x4F, 0x98, 0x2B, 0x14, 0xE7, 0xE4, 0x48, 0xE2, 0xF8, 0x4A, 0x05, 0x4B, 0x28, 0x12, 0xBA,
+	0xE2, 0x21, 0x08, 0x8A, 0xEF, 0xC6, 0x39, 0x14, 0x81, 0x2B, 0xF8, 0x12, 0x81, 0x2B, 0xE4, 0xE8,
+	0xB8, 0x81, 0xE4, 0x22, 0x22, 0x05, 0x0A, 0x22, 0x2D, 0x82, 0x22, 0x2B, 0x84, 0x2B, 0x88, 0x88,
+	0xAB, 0x82, 0x22, 0x12, 0xB9, 0x62, 0x22, 0x22, 0x21, 0x2E, 0x10, 0x88, 0x88, 0xAE, 0x22, 0x22,
+	0x22, 0x10, 0x8A, 0xE2, 0x22, 0x1C, 0x88, 0x8B, 0xA2, 0x22, 0x1B, 0xD8, 0x1C, 0x63, 0xA0, 0x47,
+	0x21, 0xE0, 0x88, 0x88, 0x88, 0x72, 0x81, 0xC9, 0x08, 0xAE, 0x12, 0xE2, 0x22, 0x22, 0x22, 0x22,
+	0xB8, 0x84, 0xB8, 0x1B, 0x96, 0x22, 0xE1, 0x10, 0x8A, 0xC7, 0x63, 0x88, 0xAE, 0x21, 0x1C, 0x1E,
+	0x7B, 0x94, 0x2B, 0xAE, 0x04, 0xBE, 0x50, 0x2B, 0x88, 0x84, 0x2E, 0x88, 0x81, 0x1C, 0x6C, 0xAD,
+	0xB2, 0x12, 0xE1, 0x2E, 0xE8, 0x88, 0x88, 0xAB, 0x96, 0x21, 0x04, 0x22, 0x2B, 0x88, 0xAE, 0x22,
+	0xB9, 0x58, 0xCC, 0x81, 0x10, 0x88, 0x56, 0xCB, 0xB8, 0x84, 0x2A, 0xE0, 0x8A, 0xB9, 0x17, 0x2A,
+	0xE1, 0x08, 0xB9, 0x08, 0x88, 0xAD, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x48, 0xBA, 0x22, 0x20,
+	0x6E, 0x08, 0x88, 0x88, 0x71, 0xB2, 0xAE, 0x20, 0x76, 0x04, 0xB8, 0x88, 0x88, 0x84, 0x23, 0xF2,
+	0x21, 0xB4, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xE1, 0x4E, 0x2E, 0x1C, 0x16, 0xC8,
+	0x88, 0x88, 0x84, 0xEB, 0x62, 0x22, 0x22, 0x22, 0x06, 0xCA, 0x2E, 0x11, 0x3A, 0x22, 0xE8, 0x12,
+	0xE4, 0x22, 0x2B, 0x84, 0x22, 0x13, 0x87, 0x82, 0x22, 0x10, 0x88, 0xAB, 0x1D, 0xC3, 0x22, 0x8A,
+	0xE1, 0x01, 0x22, 0xBE, 0x1B, 0x48, 0x88, 0x88, 0xAE, 0x2D, 0xC0, 0x88, 0x88, 0x81, 0x22, 0x22,
+	0xE4, 0x22, 0x22, 0x22, 0x22, 0x04, 0x8B, 0xA0, 0x78, 0x8B, 0xA2, 0x10, 0x84, 0x22, 0x22, 0xE8,
+	0x88, 0x12, 0xE8, 0x88, 0x88, 0x8B, 0xA2, 0x22, 0x22, 0x10, 0x8B, 0xA2, 0x04, 0x88, 0x88, 0x88,
+	0x87, 0x22, 0x22, 0x10, 0x8A, 0xE1, 0x0A, 0xE2, 0x1C, 0x88, 0x88, 0x88, 0x88, 0xAB, 0x80, 0x53,
+	0x8F, 0x22, 0x21, 0x08, 0x4F, 0xC6, 0x08, 0x88, 0x8A, 0xE0, 0x44, 0xB7, 0x02, 0x21, 0xF3, 0x87,
+	0x2E, 0x5A, 0xB1, 0x48, 0xAF, 0xE5, 0x0A, 0x20, 0x4B, 0x6B, 0xF9, 0x60, 0x58, 0x3C, 0xAD, 0x2F,
+	0x98, 0x8B, 0x90, 0x8A, 0xEB, 0x14, 0x11, 0x0B, 0xAB, 0x88, 0xBA, 0x04, 0x1B, 0x28, 0x88, 0x88,
+	0x88, 0x87, 0x22, 0x22, 0x04, 0xAE, 0x22, 0x1C, 0xAB, 0x82, 0x04, 0x81, 0xB8, 0x88, 0x88, 0x12,
+	0x22, 0xE8, 0x88, 0x88, 0x88, 0x8A, 0xC4, 0x88, 0xAB, 0x80, 0x48, 0x88, 0x88, 0xAD, 0x8E, 0x84,
+	0x22, 0x22, 0x22, 0x10, 0xBA, 0x22, 0x22, 0x21, 0xC9, 0x0B, 0x88, 0x42, 0xB8, 0x12, 0xAE, 0x08,
+	0x88, 0x8A, 0xE2, 0x13, 0xA2, 0x20, 0x48, 0x88, 0x88, 0x88, 0x88, 0x81, 0x22, 0xB8, 0x88, 0x8A,
+	0xB1, 0x2B, 0x81, 0x22, 0xE8, 0x40, 0x6D, 0x22, 0x12, 0xFA, 0x0A, 0xB1, 0x12, 0xE2, 0x22, 0x2E,
+	0x12, 0xB8, 0xB8, 0x48, 0x41, 0x08, 0x72, 0xAE, 0xE1, 0x10, 0x22, 0xAC, 0x4B, 0xAB, 0x88, 0x84,
+	0x22, 0xE8, 0xB6, 0x21, 0x08, 0x81, 0xB2, 0x88, 0x88, 0x84, 0x22, 0x04, 0x8F, 0xC6, 0x22, 0xB3,
+	0xC8, 0x44, 0xB8, 0x42, 0xE4, 0xE8, 0xBA, 0xB1, 0x22, 0xBA, 0xB8, 0xB1, 0x52, 0x21, 0x22, 0x2E,
+	0x14, 0x53, 0xC9, 0x2E, 0xB4, 0x1B, 0x88, 0x4B, 0xBA, 0x21, 0x08, 0x88, 0x8A, 0xE2, 0x07, 0xB8,
+	0xAE, 0x0A, 0xE2, 0x10, 0x88, 0x88, 0x84, 0x14, 0x2B, 0x48, 0x84, 0x22, 0x2E, 0x84, 0xB1, 0xB8,
+	0x8A, 0xEB, 0x48, 0x8A, 0xE2, 0x22, 0x21, 0x0A, 0xB4, 0x88, 0x88, 0x88, 0x8B, 0xA2, 0x07, 0x8E,
+	0x45, 0xBE, 0x14, 0xA5, 0x8E, 0x84, 0xB9, 0x64, 0x8B, 0xCB, 0x21, 0x22, 0x22, 0x2E, 0x88, 0x41,
+	0xF2, 0x82, 0xAE, 0x08, 0x42, 0x2A, 0xE0, 0x88, 0xAB, 0x12, 0x2B, 0x48, 0x88, 0x88, 0x42, 0x22,
+	0x04, 0xF0, 0x65, 0xE0, 0x76, 0xAB, 0x12, 0x22, 0x22, 0xBA, 0xB8, 0x10, 0x81, 0x3C, 0x88, 0xBA,
+	0x22, 0x21, 0x08, 0x84, 0x2D, 0xAC, 0x48, 0xAE, 0x22, 0x2E, 0xAE, 0x22, 0x14, 0x08, 0x84, 0x1C,
+	0xBA, 0xB6, 0xC5, 0x21, 0xBB, 0xA2, 0x22, 0x22, 0x12, 0xE2, 0x2E, 0x4B, 0x1E, 0x22, 0x22, 0x21,
+	0x2E, 0x10, 0x84, 0xEA, 0xB1, 0x41, 0x3F, 0x21, 0x6A, 0xE0, 0x6C, 0xA2, 0x10, 0xBA, 0x22, 0x2E,
+	0x88, 0x88, 0x42, 0x22, 0x2E, 0x84, 0x22, 0x2E, 0x81, 0x25, 0x63, 0xEC, 0x90, 0x4B, 0xA0, 0x6C,
+	0x41, 0x22, 0xE8, 0x88, 0x6F, 0xB4, 0xAE, 0x8B, 0x78, 0x44, 0x82, 0xAE, 0x5A, 0xED, 0x20, 0x78,
+	0x4B, 0x72, 0x88, 0x81, 0x20, 0x50, 0xBA, 0x22, 0x21, 0xCA, 0xB8, 0x21, 0xCA, 0x21, 0xCB, 0xA1,
+	0x2E, 0x22, 0x22, 0x04, 0x8B, 0x86, 0xE0, 0x87, 0x2A, 0xE2, 0x22, 0x10, 0x81, 0x22, 0x20, 0x44,
+	0x22, 0xB1, 0x22, 0x22, 0xB8, 0x1E, 0x21, 0x2E, 0x2E, 0x8B, 0xA2, 0x2E, 0x12, 0x22, 0x2E, 0x42,
+	0x04, 0x8B, 0x90, 0xB9, 0x04, 0x23, 0xF2, 0x48, 0x06, 0xE2, 0xB1, 0x4E, 0x21, 0x0A, 0xB8, 0x22,
+	0x22, 0x22, 0x22, 0x10, 0x88, 0x85, 0xF0
 };
 
+/* 3-bit ADPCM, SNR 11.6 dB */
 const u8 sfx_imp_sight1[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x87, 0x77,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x98,
-	0x87, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x77, 0x98, 0x87, 0x88, 0x87, 0x88, 0x89, 0x88, 0x87,
-	0x98, 0x88, 0x88, 0x87, 0x87, 0x89, 0x77, 0x87, 0x97, 0x79, 0x87, 0x97, 0x88, 0x89, 0x87, 0x98,
-	0x87, 0x79, 0x97, 0x88, 0x88, 0x88, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x87, 0x98, 0x78, 0x88, 0x97, 0x89, 0x78, 0x88, 0x98, 0x78, 0x79, 0x87, 0x98, 0x78, 0x88, 0x88,
-	0x89, 0x78, 0x89, 0x87, 0x88, 0x98, 0x88, 0x88, 0x88, 0x79, 0x88, 0x78, 0x99, 0x88, 0x88, 0x98,
-	0x98, 0x78, 0x89, 0x98, 0x88, 0x88, 0x78, 0x86, 0x89, 0x78, 0x77, 0x88, 0x88, 0x78, 0x87, 0x88,
-	0x87, 0x89, 0x87, 0x78, 0x89, 0x77, 0x78, 0x88, 0x89, 0x88, 0x89, 0xA8, 0x88, 0x88, 0x97, 0x88,
-	0x88, 0x88, 0x87, 0x99, 0x88, 0x78, 0x98, 0x89, 0x88, 0x88, 0x97, 0x79, 0x98, 0x87, 0x77, 0x99,
-	0x87, 0x79, 0x97, 0x98, 0x78, 0x8A, 0x86, 0x89, 0x88, 0x77, 0x9A, 0x86, 0x7A, 0x97, 0x6A, 0x96,
-	0x76, 0x98, 0x88, 0x95, 0x79, 0xA9, 0x58, 0x99, 0x89, 0x68, 0x99, 0x77, 0x98, 0x88, 0x88, 0x77,
-	0xA7, 0x78, 0xA9, 0x77, 0xA8, 0x78, 0x88, 0x88, 0x98, 0x68, 0x8A, 0x77, 0x98, 0x78, 0x88, 0x79,
-	0xA7, 0x78, 0x88, 0x89, 0x96, 0x89, 0x78, 0x8A, 0x77, 0x89, 0x78, 0x97, 0x78, 0x88, 0x88, 0x87,
-	0x79, 0x98, 0x77, 0x89, 0x88, 0x88, 0x79, 0x88, 0x79, 0x8A, 0x77, 0x98, 0x88, 0x98, 0x77, 0xA8,
-	0x88, 0x88, 0x69, 0x97, 0x68, 0x89, 0x77, 0x87, 0x98, 0x87, 0x87, 0x89, 0x98, 0x79, 0x78, 0x88,
-	0x98, 0x78, 0x88, 0x87, 0x99, 0x87, 0x89, 0x77, 0x89, 0x88, 0x88, 0x78, 0x9A, 0x87, 0x79, 0xA7,
-	0x88, 0x87, 0x99, 0x76, 0x89, 0x98, 0x87, 0x67, 0xAA, 0x76, 0x88, 0x89, 0x98, 0x68, 0x99, 0x87,
-	0x78, 0x98, 0x88, 0x87, 0x89, 0x97, 0x88, 0x78, 0x99, 0x76, 0x99, 0x69, 0xA7, 0x68, 0x98, 0x89,
-	0x77, 0x7A, 0x97, 0x69, 0x97, 0x79, 0x86, 0x7A, 0x88, 0x79, 0x69, 0x89, 0x78, 0x98, 0x79, 0x89,
-	0x79, 0x77, 0x99, 0x97, 0x79, 0xA8, 0x76, 0x99, 0x98, 0x77, 0x69, 0xB8, 0x67, 0x87, 0x99, 0x76,
-	0x7A, 0x88, 0x98, 0x67, 0xB9, 0x87, 0x87, 0x7B, 0xA6, 0x78, 0x89, 0xA6, 0x69, 0x99, 0x87, 0x68,
-	0xAA, 0x76, 0x89, 0x88, 0x88, 0x87, 0x89, 0x97, 0x78, 0x89, 0x97, 0x66, 0x9A, 0x98, 0x67, 0x7B,
-	0xA7, 0x57, 0x99, 0xA8, 0x57, 0x9A, 0x97, 0x67, 0xAA, 0x86, 0x78, 0x89, 0x97, 0x77, 0x98, 0x98,
-	0x77, 0x89, 0xA7, 0x66, 0x8A, 0x89, 0x66, 0x8A, 0xB8, 0x56, 0xA9, 0x98, 0x65, 0x9B, 0xA7, 0x56,
-	0xAA, 0x97, 0x67, 0x8B, 0x96, 0x68, 0xA9, 0x88, 0x76, 0x99, 0xA7, 0x66, 0x9A, 0x98, 0x66, 0x9A,
-	0xA7, 0x58, 0x99, 0x87, 0x66, 0x8B, 0x95, 0x69, 0xA9, 0x77, 0x78, 0x99, 0x86, 0x69, 0xB8, 0x66,
-	0x9A, 0x88, 0x87, 0x89, 0xA8, 0x66, 0x9A, 0x87, 0x89, 0x76, 0xAA, 0x76, 0x89, 0x88, 0x89, 0x77,
-	0x9A, 0x66, 0x8A, 0x77, 0x88, 0x78, 0xA8, 0x67, 0x99, 0x97, 0x87, 0x89, 0x79, 0x89, 0x78, 0x79,
-	0x88, 0x88, 0x88, 0x88, 0x86, 0x98, 0x88, 0x86, 0x99, 0x88, 0x87, 0x89, 0x97, 0x8A, 0x68, 0x6A,
-	0xAA, 0x57, 0x89, 0xA9, 0x75, 0x7A, 0x98, 0x97, 0x68, 0xA8, 0x88, 0x76, 0xA9, 0x86, 0x89, 0x9A,
-	0x65, 0x8B, 0xA8, 0x86, 0x68, 0xC9, 0x78, 0x57, 0xC9, 0x78, 0x79, 0x88, 0x69, 0xA8, 0x68, 0x87,
-	0x99, 0x76, 0x88, 0x8A, 0x97, 0x68, 0x7B, 0xB6, 0x56, 0x9B, 0x96, 0x79, 0xB7, 0x86, 0x89, 0x96,
-	0x76, 0xA9, 0x95, 0x87, 0xA7, 0x88, 0x99, 0x67, 0x9A, 0x76, 0xB9, 0x76, 0x7A, 0xA7, 0x79, 0x69,
-	0x89, 0x88, 0x84, 0xB6, 0xA9, 0xA2, 0x7A, 0xE4, 0x76, 0x7B, 0xB7, 0x49, 0x99, 0x68, 0x98, 0xA6,
-	0x96, 0x9A, 0x7A, 0x69, 0x69, 0x88, 0x99, 0x76, 0x78, 0xBA, 0x92, 0x69, 0xE8, 0x66, 0x6A, 0x9A,
-	0x65, 0x88, 0x9A, 0x84, 0x79, 0xB9, 0xA5, 0x4A, 0xA9, 0x78, 0x77, 0xB9, 0x87, 0x88, 0x9B, 0x56,
-	0x88, 0xB9, 0x63, 0x98, 0xAD, 0x83, 0x4B, 0x9B, 0x97, 0x29, 0xAA, 0x77, 0x67, 0xA9, 0xA6, 0x75,
-	0xBC, 0x86, 0x48, 0x7E, 0x97, 0x48, 0x87, 0xD9, 0x92, 0x96, 0x9B, 0xB5, 0x46, 0xAA, 0xA5, 0x4C,
-	0x89, 0x47, 0x8B, 0xF6, 0x37, 0x7B, 0xB8, 0x68, 0x83, 0x7D, 0xA8, 0x66, 0x67, 0xDC, 0x65, 0x77,
-	0x9A, 0x77, 0xC7, 0x36, 0xBC, 0x87, 0x66, 0x99, 0x8B, 0x77, 0x77, 0x7A, 0xC8, 0x37, 0x89, 0x89,
-	0x77, 0xB5, 0x59, 0xD9, 0x77, 0x45, 0xDC, 0x46, 0x97, 0x6A, 0x9A, 0x85, 0x59, 0xCA, 0x76, 0x69,
-	0xC7, 0x57, 0xA9, 0x48, 0x8A, 0x97, 0x67, 0x88, 0x8A, 0x77, 0x88, 0x68, 0xDB, 0x42, 0x9C, 0xB9,
-	0x84, 0x79, 0x79, 0x9A, 0x64, 0x77, 0xDD, 0x84, 0x49, 0xAA, 0x96, 0x99, 0x37, 0xC7, 0xA9, 0xA2,
-	0x5C, 0xE7, 0x66, 0x78, 0xA8, 0x5A, 0x85, 0x87, 0xAB, 0xA3, 0x3B, 0xE8, 0x63, 0xA9, 0xC7, 0x49,
-	0xC8, 0x56, 0xB8, 0x87, 0x98, 0x77, 0x98, 0x7A, 0x76, 0x6C, 0xB8, 0x57, 0x79, 0x99, 0x77, 0x68,
-	0xAA, 0x86, 0x89, 0x9A, 0x66, 0x7A, 0x97, 0x97, 0x87, 0x89, 0xA7, 0x66, 0xB9, 0x66, 0x88, 0x8B,
-	0x86, 0x76, 0x8B, 0x97, 0x56, 0xAA, 0x79, 0x67, 0x8B, 0x87, 0x87, 0x69, 0x98, 0x86, 0xB6, 0x99,
-	0x57, 0xCA, 0x85, 0x69, 0xA9, 0xB7, 0x46, 0xAA, 0x86, 0x5C, 0x88, 0x86, 0x89, 0x86, 0x9B, 0x66,
-	0x89, 0xA8, 0x76, 0x8A, 0x78, 0x78, 0x7B, 0x85, 0x79, 0x9A, 0x77, 0x7A, 0x79, 0x89, 0x75, 0x88,
-	0xA9, 0x89, 0x47, 0xBA, 0x85, 0x9A, 0x99, 0x67, 0x88, 0xA8, 0x85, 0x5A, 0x99, 0xA6, 0x78, 0x98,
-	0x87, 0xA8, 0x77, 0x5B, 0x87, 0xA8, 0x97, 0x88, 0x59, 0xA9, 0x67, 0x79, 0x86, 0x8A, 0xA5, 0x58,
-	0xAA, 0x96, 0x86, 0x79, 0x9A, 0x87, 0x57, 0x9A, 0xA9, 0x57, 0x7A, 0xA8, 0x89, 0x76, 0x78, 0x8A,
-	0x86, 0x77, 0x9A, 0x96, 0x85, 0x7C, 0xA9, 0x56, 0x89, 0xA8, 0x77, 0x7A, 0x69, 0x99, 0x88, 0x86,
-	0x6A, 0xB9, 0x66, 0x77, 0x9B, 0xA7, 0x57, 0x7A, 0xAA, 0x69, 0x66, 0x6C, 0xB9, 0x67, 0x67, 0x8C,
-	0xA7, 0x65, 0x58, 0xCC, 0x86, 0x26, 0xBD, 0xA7, 0x54, 0x8A, 0xB8, 0x97, 0x5A, 0x79, 0x8A, 0x97,
-	0x56, 0x8B, 0xB6, 0x74, 0x7B, 0xAA, 0x65, 0x6A, 0xB8, 0x77, 0x79, 0x68, 0x98, 0xB8, 0x57, 0x4A,
-	0xCC, 0x81, 0x38, 0xEC, 0x87, 0x15, 0xAC, 0xA7, 0x74, 0x89, 0x8B, 0x57, 0x99, 0xA3, 0x78, 0xD9,
-	0x55, 0x6B, 0xC7, 0x76, 0x7A, 0xAA, 0x57, 0x59, 0xD7, 0x66, 0x9A, 0x86, 0x77, 0xAB, 0x76, 0x57,
-	0xBD, 0xB4, 0x26, 0xCE, 0x88, 0x44, 0xAA, 0xA7, 0x78, 0x6B, 0x6A, 0x92, 0xB9, 0xB5, 0x38, 0xBD,
-	0x54, 0x68, 0xD7, 0x86, 0x7A, 0x9C, 0x45, 0x95, 0xEA, 0x46, 0x7C, 0x98, 0x63, 0x9B, 0xB8, 0x37,
-	0x6B, 0xB8, 0x84, 0x69, 0xBC, 0x68, 0x64, 0x9A, 0xA8, 0x78, 0x56, 0x9E, 0x86, 0x67, 0x96, 0x9A,
-	0xA8, 0x57, 0x58, 0xDB, 0xA4, 0x35, 0x9D, 0xB9, 0x42, 0x7B, 0xB9, 0x7A, 0x66, 0x7A, 0xBC, 0x73,
-	0x5A, 0x9B, 0x97, 0x55, 0x79, 0xC9, 0x94, 0x78, 0x8A, 0x98, 0x87, 0x77, 0x8B, 0x88, 0x78, 0x68,
-	0x98, 0x98, 0x78, 0x99, 0x76, 0x89, 0xB9, 0x53, 0x8B, 0xBA, 0x65, 0x6B, 0xA9, 0x96, 0x59, 0xA8,
-	0x58, 0x97, 0xA7, 0x65, 0x8B, 0xAA, 0x64, 0xB9, 0x87, 0x99, 0x77, 0x68, 0xBB, 0x72, 0x79, 0xCA,
-	0x83, 0x78, 0xAA, 0xA6, 0x77, 0x96, 0x9B, 0x87, 0x89, 0x87, 0x77, 0xCA, 0x65, 0x48, 0xEC, 0x92,
-	0x38, 0xCC, 0x85, 0x67, 0x99, 0x88, 0xA9, 0x76, 0x88, 0x7B, 0x99, 0x55, 0x6A, 0xB9, 0x69, 0x58,
-	0x8B, 0x79, 0x89, 0x55, 0x88, 0xCB, 0x47, 0x5C, 0xB9, 0x46, 0xBB, 0x75, 0x79, 0x98, 0x77, 0x68,
-	0x9A, 0x97, 0x67, 0xAA, 0xA7, 0x66, 0x8A, 0xB7, 0x56, 0xA9, 0x77, 0x99, 0x87, 0x78, 0x98, 0x87,
-	0x86, 0xAA, 0x76, 0x89, 0x69, 0xB8, 0x86, 0x67, 0xBC, 0x66, 0x78, 0x9A, 0xA7, 0x66, 0x7A, 0x87,
-	0x79, 0x76, 0x8A, 0x99, 0x6B, 0x88, 0x58, 0xA8, 0x96, 0x37, 0x8D, 0x97, 0x46, 0xCA, 0x89, 0x7B,
-	0x66, 0x39, 0xED, 0x41, 0x4C, 0xE9, 0x64, 0x7B, 0xA8, 0x79, 0x98, 0x75, 0x9A, 0xC9, 0x52, 0x4C,
-	0xEA, 0x70, 0x59, 0xEC, 0x74, 0x57, 0xAA, 0xC9, 0x43, 0x7B, 0xD6, 0x56, 0xAB, 0x85, 0x6B, 0xB8,
-	0x64, 0x7A, 0xA8, 0x87, 0x67, 0x9A, 0xB9, 0x64, 0x8A, 0xB8, 0x56, 0x99, 0x76, 0x88, 0x9A, 0xA3,
-	0x7B, 0xB9, 0x68, 0x79, 0x97, 0x77, 0xAA, 0x62, 0x9F, 0xA4, 0x66, 0xD8, 0x97, 0x6A, 0x69, 0x65,
-	0xAC, 0x96, 0x59, 0x79, 0x89, 0x85, 0x76, 0x88, 0xCA, 0x85, 0x6D, 0xA8, 0x85, 0x79, 0x87, 0x39,
-	0xAB, 0x76, 0x9B, 0xC8, 0x46, 0x9A, 0x94, 0x59, 0x9A, 0x46, 0xAD, 0xB8, 0x57, 0x9B, 0x9A, 0x57,
-	0x47, 0xAA, 0x97, 0x77, 0x5B, 0xAA, 0x77, 0x76, 0x97, 0x6B, 0xA8, 0x75, 0x69, 0xDC, 0x94, 0x59,
-	0x8B, 0x96, 0x75, 0x6A, 0x99, 0x86, 0x77, 0xB9, 0xA8, 0x77, 0x69, 0x86, 0xB9, 0x76, 0x57, 0x9B,
-	0xC9, 0x55, 0x8A, 0xC9, 0x57, 0x68, 0x98, 0x98, 0x66, 0x7B, 0x9A, 0x96, 0x77, 0xA9, 0x7A, 0x77,
-	0x66, 0x79, 0xBB, 0x85, 0x59, 0xBC, 0x85, 0x67, 0x99, 0x88, 0x86, 0x68, 0xAA, 0xC8, 0x56, 0x8B,
-	0xA7, 0x86, 0x77, 0x77, 0x99, 0xB8, 0x55, 0x9E, 0xC8, 0x36, 0x8A, 0x98, 0x77, 0x57, 0x79, 0xBC,
-	0x74, 0x59, 0xDB, 0x86, 0x69, 0x68, 0x89, 0x86, 0x78, 0x8A, 0xBB, 0x65, 0x78, 0xAA, 0x95, 0x37,
-	0x98, 0x99, 0x98, 0x66, 0xBD, 0x86, 0x77, 0x88, 0x67, 0x8B, 0x74, 0x8A, 0xC8, 0x78, 0x9A, 0x76,
-	0x69, 0xA9, 0x64, 0x7A, 0xA6, 0x5C, 0xA8, 0x65, 0xAA, 0xA7, 0x57, 0x8B, 0xB5, 0x56, 0x9A, 0x99,
-	0x95, 0x88, 0x9A, 0x69, 0x88, 0x58, 0x98, 0x98, 0x88, 0x66, 0xA9, 0xA8, 0x46, 0x6B, 0x9B, 0x76,
-	0x77, 0x9E, 0x86, 0x48, 0xB9, 0x78, 0x5A, 0xAA, 0x76, 0x8B, 0x97, 0x5B, 0x96, 0x48, 0xA9, 0x77,
-	0x89, 0xB8, 0x87, 0x8B, 0x86, 0x69, 0x93, 0x99, 0x96, 0x79, 0x8A, 0x79, 0x75, 0x8B, 0xB9, 0x46,
-	0x6B, 0xC7, 0x55, 0xAB, 0x87, 0x6A, 0x96, 0x6B, 0xAA, 0x64, 0x7A, 0xBA, 0x45, 0x9C, 0xA6, 0x48,
-	0xAA, 0x87, 0x57, 0xAA, 0x88, 0x78, 0x88, 0x8A, 0x86, 0x78, 0x99, 0x66, 0x9A, 0xA7, 0x57, 0xA9,
-	0x87, 0x89, 0x86, 0x99, 0x89, 0x88, 0x97, 0x87, 0x98, 0x86, 0x6B, 0x97, 0x86, 0x98, 0x89, 0x79,
-	0x87, 0x87, 0x69, 0xC9, 0x57, 0xC8, 0x69, 0x9A, 0x53, 0x8C, 0x96, 0x58, 0xBB, 0x95, 0x5B, 0xDA,
-	0x53, 0x7A, 0x79, 0x68, 0x87, 0x9A, 0xA8, 0x98, 0x7B, 0x96, 0x64, 0x8A, 0x77, 0x7A, 0x9A, 0x67,
-	0xAC, 0x97, 0x77, 0x87, 0x78, 0x77, 0x8A, 0x97, 0x96, 0x99, 0x89, 0x88, 0x77, 0x88, 0x87, 0x99,
-	0x77, 0x88, 0xA7, 0x89, 0x78, 0x79, 0xA7, 0x66, 0x99, 0x97, 0x67, 0x8A, 0xA7, 0x56, 0xAB, 0x75,
-	0x7A, 0xA8, 0x57, 0x9B, 0x96, 0x69, 0xA9, 0x67, 0xA9, 0x76, 0x9B, 0x87, 0x68, 0x9A, 0x97, 0x56,
-	0xAB, 0x85, 0x68, 0xCB, 0x74, 0x7B, 0xB8, 0x66, 0x89, 0x89, 0x76, 0x89, 0xA8, 0x69, 0xAA, 0x66,
-	0xB9, 0x77, 0x7A, 0x75, 0x8B, 0xB5, 0x7B, 0xA8, 0x66, 0xA7, 0x89, 0x77, 0x76, 0x8A, 0xA8, 0x77,
-	0xBA, 0x65, 0x6A, 0xB8, 0x64, 0x7B, 0xC6, 0x59, 0xAC, 0x95, 0x78, 0x89, 0x78, 0x67, 0x76, 0xA8,
-	0x7A, 0xA8, 0x99, 0x89, 0x88, 0x97, 0x69, 0xA7, 0x46, 0x9B, 0xA8, 0x78, 0x9A, 0x88, 0x67, 0x97,
-	0x86, 0x47, 0xAB, 0x86, 0x7A, 0xC9, 0x78, 0x88, 0x77, 0x78, 0x66, 0x68, 0x99, 0x87, 0x8A, 0xA9,
-	0x88, 0x87, 0x88, 0x87, 0x67, 0x99, 0x99, 0x79, 0x98, 0x88, 0x89, 0x87, 0x78, 0x98, 0x77, 0x89,
-	0x99, 0x87, 0x8A, 0x98, 0x86, 0x88, 0x79, 0x87, 0x87, 0xA9, 0x86, 0x8A, 0xA7, 0x76, 0x98, 0x88,
-	0x76, 0x88, 0x9A, 0x88, 0x68, 0xC9, 0x77, 0x6A, 0x87, 0x66, 0x9A, 0x97, 0x69, 0xB8, 0x76, 0x9A,
-	0x78, 0x76, 0x78, 0x89, 0x8A, 0x87, 0x9A, 0xA8, 0x76, 0x99, 0x86, 0x47, 0x9A, 0x87, 0x8A, 0x98,
-	0x98, 0x78, 0x89, 0x76, 0x68, 0x88, 0x7A, 0x99, 0x88, 0x9A, 0x66, 0x7A, 0xA7, 0x46, 0x8A, 0x89,
-	0x78, 0xA8, 0x88, 0x77, 0x98, 0x77, 0x77, 0x8A, 0x78, 0xBA, 0x76, 0xAA, 0x87, 0x78, 0x98, 0x66,
-	0x79, 0x89, 0xA8, 0x6A, 0xA9, 0x75, 0x7B, 0xA5, 0x47, 0x9A, 0x67, 0x7B, 0xA7, 0x58, 0xB9, 0x75,
-	0x7B, 0xC6, 0x57, 0x9B, 0x97, 0x8A, 0x78, 0x88, 0xA8, 0x66, 0x79, 0x96, 0x68, 0xAC, 0x76, 0x7A,
-	0x99, 0x66, 0x96, 0x89, 0x88, 0x77, 0x9A, 0x88, 0x89, 0x97, 0x97, 0x87, 0x88, 0x66, 0x99, 0x88,
-	0x7A, 0x9A, 0x77, 0x98, 0x85, 0x79, 0xA8, 0x69, 0xAA, 0x97, 0x99, 0x97, 0x57, 0x89, 0x67, 0x78,
-	0x98, 0x99, 0x88, 0x99, 0x75, 0x78, 0xA6, 0x66, 0xAB, 0x99, 0x88, 0x8A, 0xB7, 0x55, 0x99, 0x85,
-	0x59, 0xA8, 0x8A, 0x6A, 0x87, 0x99, 0x85, 0x6A, 0xB7, 0x46, 0x9B, 0x97, 0x78, 0x9A, 0x95, 0x89,
-	0xA8, 0x56, 0x99, 0x87, 0x69, 0xA9, 0x78, 0xA9, 0x78, 0x88, 0x88, 0x67, 0x79, 0x97, 0x78, 0xA8,
-	0x89, 0x89, 0x97, 0x77, 0x88, 0x76, 0x99, 0x86, 0x89, 0xA8, 0x78, 0x99, 0x86, 0x79, 0x98, 0x66,
-	0x79, 0x97, 0x89, 0xA8, 0x87, 0x99, 0x87, 0x79, 0x88, 0x67, 0x99, 0x88, 0x88, 0x99, 0x87, 0x87,
-	0x77, 0x78, 0x87, 0x79, 0x99, 0x88, 0xA9, 0x76, 0x89, 0x87, 0x77, 0x88, 0x88, 0x78, 0xA9, 0x87,
-	0x8A, 0x97, 0x66, 0x88, 0x87, 0x77, 0x88, 0x98, 0x89, 0x98, 0x98, 0x87, 0x88, 0x87, 0x99, 0x86,
-	0x8B, 0xA8, 0x68, 0xA9, 0x66, 0x79, 0x98, 0x76, 0x79, 0x89, 0x97, 0x8A, 0x97, 0x78, 0x99, 0x67,
-	0x89, 0x77, 0x89, 0x99, 0x78, 0x98, 0x68, 0x98, 0x89, 0x87, 0x87, 0x8A, 0x87, 0x88, 0x78, 0x97,
-	0x89, 0xA8, 0x88, 0x99, 0x96, 0x7A, 0x97, 0x76, 0x7A, 0x97, 0x78, 0x99, 0x87, 0x9A, 0x97, 0x77,
-	0x89, 0x86, 0x77, 0x88, 0x77, 0x99, 0x98, 0x89, 0x99, 0x87, 0x89, 0x87, 0x66, 0x88, 0x78, 0xAA,
-	0x88, 0x99, 0x88, 0x98, 0x77, 0x88, 0x87, 0x77, 0x88, 0x89, 0x99, 0x87, 0x89, 0x87, 0x77, 0x88,
-	0x87, 0x78, 0x99, 0x98, 0x79, 0x9A, 0x87, 0x79, 0x98, 0x77, 0x88, 0x87, 0x77, 0x99, 0x67, 0x89,
-	0x98, 0x77, 0x88, 0x77, 0x76, 0x99, 0x87, 0x78, 0x98, 0x78, 0xAA, 0x97, 0x79, 0x88, 0x99, 0x98,
-	0x77, 0x68, 0x89, 0x97, 0x87, 0x99, 0x97, 0x77, 0x78, 0x77, 0x99, 0x88, 0x77, 0x78, 0x88, 0x99,
-	0x99, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x87, 0x99, 0x99, 0x88, 0x78, 0x88, 0x78,
-	0x77, 0x68, 0x99, 0x87, 0x99, 0x99, 0x98, 0x88, 0x88, 0x66, 0x78, 0x88, 0x89, 0x98, 0x89, 0x88,
-	0x98, 0x87, 0x67, 0x88, 0x78, 0x99, 0x88, 0x97, 0x79, 0x98, 0x87, 0x78, 0x88, 0x78, 0x89, 0x88,
-	0x88, 0x89, 0x98, 0x78, 0x87, 0x89, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x77, 0x78, 0x87, 0x78,
-	0x88, 0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x8A, 0x98, 0x88, 0x99, 0x88,
-	0x88, 0x87, 0x78, 0x88, 0x78, 0x78, 0x98, 0x88, 0x98, 0x77, 0x98, 0x78, 0x87, 0x68, 0x98, 0x78,
-	0x9A, 0x88, 0x98, 0x89, 0x87, 0x67, 0x88, 0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x87, 0x78, 0x76,
-	0x89, 0x87, 0x89, 0x98, 0x89, 0x99, 0x97, 0x78, 0x88, 0x77, 0x78, 0x89, 0x98, 0x99, 0x98, 0x77,
-	0x88, 0x87, 0x67, 0x88, 0x87, 0x78, 0x99, 0x98, 0x77, 0x99, 0x87, 0x88, 0x78, 0x88, 0x78, 0x98,
-	0x88, 0x78, 0x99, 0x77, 0x99, 0x66, 0x9A, 0x67, 0x9A, 0x87, 0x88, 0x99, 0x97, 0x79, 0x78, 0x89,
-	0x77, 0x99, 0x78, 0x89, 0x88, 0x88, 0x77, 0x89, 0x78, 0x88, 0x77, 0x88, 0x88, 0x78, 0x99, 0x77,
-	0x9A, 0x87, 0x79, 0x88, 0x78, 0x87, 0x88, 0x88, 0x88, 0x89, 0x97, 0x78, 0xA8, 0x77, 0x99, 0x77,
-	0x79, 0x87, 0x78, 0x88, 0x89, 0xA8, 0x88, 0x99, 0x87, 0x78, 0x78, 0x88, 0x77, 0x8A, 0x97, 0x78,
-	0xA9, 0x76, 0x99, 0x87, 0x78, 0x87, 0x89, 0x87, 0x78, 0xA9, 0x77, 0x99, 0x97, 0x88, 0x78, 0x98,
-	0x77, 0x99, 0x78, 0x98, 0x78, 0x98, 0x77, 0x89, 0x98, 0x67, 0x99, 0x77, 0x88, 0x88, 0x87, 0x79,
-	0x97, 0x78, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x98, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x77, 0x89, 0x87, 0x89, 0x88, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x98, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89,
-	0x98, 0x78, 0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x78, 0x88, 0x88, 0x77, 0x89, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x89, 0x87, 0x78, 0x89, 0x87, 0x78, 0x8A
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x49, 0xC4, 0x8C, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x75, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x07, 0xA0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xC1, 0x18, 0x10, 0x46, 0x27, 0x80,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x1E, 0x11, 0x89, 0x07,
+	0x82, 0x09, 0x38, 0x42, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0x38, 0x42, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x24, 0xE1, 0x09, 0xEA,
+	0x62, 0xC8, 0x20, 0x82, 0x08, 0x1E, 0x10, 0x3C, 0x24, 0x10, 0x4E, 0x8E, 0x18, 0xAB, 0x07, 0x50,
+	0x41, 0x39, 0x74, 0x72, 0x27, 0x50, 0x3B, 0x07, 0x74, 0x09, 0x26, 0x58, 0xBE, 0x0E, 0x56, 0x3B,
+	0x16, 0x32, 0x2B, 0x5D, 0x18, 0x31, 0xCC, 0x12, 0x07, 0x81, 0xC2, 0x41, 0x04, 0xEA, 0x01, 0x04,
+	0x1D, 0xCC, 0x60, 0x7C, 0x2C, 0x04, 0x57, 0x1C, 0xE5, 0x76, 0xA8, 0x20, 0x8F, 0x80, 0xB5, 0x51,
+	0x58, 0x20, 0x83, 0xB9, 0x32, 0x33, 0x08, 0x16, 0x5A, 0xA0, 0x67, 0x10, 0x4E, 0xA7, 0x47, 0x9B,
+	0x08, 0x13, 0xA9, 0x54, 0x1D, 0x1D, 0x63, 0x8F, 0x88, 0x44, 0x0F, 0x40, 0xCF, 0x90, 0x47, 0xC0,
+	0x10, 0x41, 0xD8, 0xB3, 0xA3, 0x81, 0xC2, 0x47, 0xE3, 0x16, 0x60, 0x19, 0xF4, 0x31, 0xD5, 0x84,
+	0x3D, 0x89, 0xA3, 0x86, 0x7D, 0x2E, 0x78, 0xE5, 0x19, 0xC9, 0x17, 0x24, 0x6E, 0x84, 0x83, 0x93,
+	0x34, 0x74, 0x09, 0x3A, 0x7C, 0x03, 0x38, 0x76, 0x91, 0x20, 0x7B, 0xA8, 0xF0, 0x12, 0x90, 0x3A,
+	0x5E, 0x18, 0x23, 0xBC, 0x9E, 0x43, 0xF0, 0x8C, 0x4F, 0x84, 0x41, 0x27, 0x2C, 0x6B, 0x19, 0xB2,
+	0x0E, 0xE4, 0xCE, 0x2F, 0x14, 0x91, 0x5C, 0x5D, 0x82, 0x4E, 0xC7, 0x8A, 0x1D, 0x15, 0x54, 0x53,
+	0x91, 0x1B, 0x3C, 0x00, 0x3A, 0x90, 0x07, 0x63, 0x54, 0x7C, 0x2A, 0xC1, 0x3A, 0x2B, 0xD0, 0x97,
+	0x10, 0x56, 0x3C, 0x40, 0x59, 0xB2, 0x73, 0x42, 0x22, 0x1B, 0xA1, 0x25, 0x88, 0xD9, 0x26, 0x4E,
+	0x70, 0x2A, 0x53, 0xD6, 0x3A, 0x1A, 0x11, 0x21, 0xF5, 0x39, 0xAB, 0x18, 0x1B, 0xCB, 0xA2, 0xAE,
+	0xA0, 0xA0, 0xDC, 0xE9, 0xEA, 0xC7, 0x07, 0x08, 0x69, 0x58, 0x17, 0x0C, 0xD6, 0xA4, 0x56, 0x35,
+	0x2E, 0x83, 0xBA, 0x56, 0x53, 0x53, 0xBC, 0x18, 0xA7, 0x8E, 0x0B, 0x6B, 0x63, 0xD4, 0x24, 0x12,
+	0x74, 0x67, 0x84, 0x39, 0xF0, 0x66, 0xDE, 0x13, 0x9B, 0x12, 0x0F, 0xE4, 0x9B, 0xEA, 0x43, 0x50,
+	0x42, 0x9E, 0x07, 0x4D, 0xD1, 0x17, 0xEC, 0x67, 0x1F, 0x11, 0x1F, 0x07, 0x05, 0xD1, 0x99, 0xB1,
+	0x42, 0xDA, 0x53, 0xBE, 0x23, 0x2C, 0x9D, 0x81, 0xE8, 0x66, 0xDE, 0x19, 0x9F, 0x20, 0x2D, 0xA5,
+	0xBB, 0xE3, 0x13, 0x08, 0x48, 0xDC, 0x35, 0xA8, 0x42, 0xC1, 0x8A, 0x3F, 0x84, 0x74, 0x07, 0xC6,
+	0x34, 0x26, 0xC8, 0xF8, 0x73, 0xC4, 0x78, 0x12, 0x17, 0xA8, 0x62, 0x71, 0x09, 0xEA, 0x9E, 0x6B,
+	0xA2, 0x08, 0x21, 0xDD, 0xC1, 0x27, 0x62, 0x89, 0xD1, 0xBC, 0xBE, 0x33, 0x13, 0x82, 0x05, 0xD8,
+	0xB9, 0x06, 0xAC, 0xE1, 0x30, 0x62, 0xF2, 0x62, 0xF9, 0x19, 0x66, 0x8D, 0xDA, 0x3A, 0x56, 0x88,
+	0xA4, 0xEC, 0x5C, 0x45, 0x73, 0x45, 0x03, 0xBA, 0x28, 0xE7, 0x81, 0x1B, 0xC1, 0x7C, 0x52, 0x67,
+	0x39, 0xC1, 0xCC, 0x58, 0x01, 0x38, 0x47, 0xC7, 0x2D, 0x2C, 0x78, 0xB1, 0x86, 0x8D, 0xDD, 0x72,
+	0x72, 0x9F, 0x10, 0x29, 0x6B, 0x13, 0x11, 0x5F, 0x34, 0x9E, 0xB1, 0xC6, 0x01, 0x35, 0x29, 0xCF,
+	0xCA, 0x5A, 0x40, 0xA0, 0xF1, 0x40, 0x76, 0x25, 0x61, 0xE3, 0x12, 0x88, 0x5D, 0xB5, 0x47, 0x3C,
+	0x51, 0xDD, 0x9C, 0x27, 0xE0, 0xE0, 0xB7, 0xB1, 0x24, 0x81, 0xC1, 0xCF, 0x62, 0xDA, 0xC3, 0xD2,
+	0xA1, 0x1E, 0x1D, 0x40, 0x07, 0x81, 0x09, 0xE3, 0x83, 0x98, 0x9F, 0x84, 0x19, 0x71, 0xBD, 0x3B,
+	0x28, 0x8D, 0xCF, 0x0C, 0x23, 0x87, 0xB1, 0x42, 0xD9, 0x18, 0x8B, 0x89, 0x03, 0x5B, 0x90, 0x20,
+	0xC1, 0xF8, 0x95, 0xA3, 0x96, 0x38, 0x12, 0x28, 0x2F, 0x8D, 0x5B, 0x23, 0x5A, 0x95, 0x39, 0x02,
+	0x68, 0x08, 0x0F, 0xC3, 0x3B, 0x77, 0xD6, 0x65, 0x9C, 0x9A, 0xA2, 0xF5, 0x06, 0x3D, 0x8C, 0x49,
+	0x5D, 0xE5, 0xE3, 0x27, 0x28, 0x69, 0x08, 0x3B, 0x39, 0x8C, 0x47, 0x78, 0xCE, 0x95, 0xC3, 0xAA,
+	0x37, 0x07, 0x45, 0x32, 0x87, 0x33, 0xD0, 0xB9, 0x79, 0x8A, 0x0D, 0x22, 0x43, 0x62, 0x6B, 0xF0,
+	0x39, 0x4E, 0x10, 0x87, 0xF1, 0x73, 0x42, 0x03, 0xD4, 0x56, 0xED, 0xC5, 0xCA, 0x78, 0x2F, 0x41,
+	0x2B, 0x15, 0x77, 0x8C, 0xC5, 0x4B, 0x82, 0x11, 0x7A, 0x50, 0xD4, 0xBB, 0x06, 0x26, 0xF4, 0xBC,
+	0x24, 0x69, 0x52, 0xC2, 0x2C, 0xEE, 0x26, 0x0E, 0x23, 0xC6, 0x0D, 0x58, 0x37, 0xAE, 0x1C, 0xB5,
+	0x89, 0x30, 0x31, 0xE1, 0xC3, 0x90, 0xF0, 0x04, 0x19, 0xDA, 0xBB, 0x95, 0x53, 0x80, 0xE8, 0xDC,
+	0x02, 0xB9, 0x1B, 0xE2, 0x23, 0x63, 0x43, 0x03, 0x5E, 0x88, 0x3F, 0x98, 0xE5, 0x03, 0x52, 0xA3,
+	0xD4, 0xC6, 0x76, 0x3C, 0xB9, 0x38, 0x20, 0xF9, 0x03, 0xEA, 0x0A, 0x27, 0x2C, 0xED, 0x0C, 0x66,
+	0xFC, 0x43, 0x17, 0xAC, 0x03, 0x96, 0x8A, 0x5B, 0xBA, 0x52, 0xD8, 0xF6, 0xA6, 0x2D, 0xB1, 0xA1,
+	0x85, 0xCE, 0x08, 0x67, 0xA1, 0xB9, 0xC6, 0x2A, 0x0F, 0x03, 0x16, 0x88, 0xF9, 0x11, 0xEA, 0x73,
+	0x23, 0xF0, 0x8C, 0xD3, 0x14, 0x26, 0x19, 0x0A, 0xB0, 0x32, 0x72, 0x5E, 0xB0, 0xB1, 0xC5, 0x2A,
+	0x4E, 0x33, 0x5A, 0x00, 0x6E, 0x01, 0x8F, 0x2A, 0x67, 0x78, 0x58, 0xC3, 0x05, 0x05, 0x87, 0x3C,
+	0x67, 0x70, 0x68, 0x50, 0xF0, 0x07, 0x84, 0x07, 0x3E, 0x0E, 0x76, 0x80, 0xEC, 0x9D, 0x81, 0x79,
+	0x8E, 0x51, 0xC9, 0x53, 0x8B, 0x18, 0x1A, 0x0C, 0x1B, 0xD2, 0x03, 0x90, 0x1B, 0x1A, 0x9C, 0xBE,
+	0x14, 0xA5, 0xF5, 0x99, 0x2A, 0xE0, 0x21, 0x3E, 0x0E, 0x1B, 0x70, 0x29, 0x61, 0xC8, 0x8A, 0x59,
+	0x40, 0x6F, 0x4A, 0xB1, 0x35, 0x5C, 0x54, 0xF5, 0x87, 0x7D, 0x64, 0x5F, 0x03, 0x14, 0x78, 0xC5,
+	0xC4, 0xE7, 0xA4, 0x46, 0x4D, 0xDC, 0x14, 0x8D, 0x22, 0x63, 0xF2, 0x55, 0xBC, 0x93, 0x27, 0x81,
+	0x74, 0x74, 0x02, 0x68, 0xDD, 0xF2, 0x35, 0x2F, 0x05, 0x0D, 0x40, 0x52, 0x47, 0x74, 0x43, 0x39,
+	0x3C, 0x2C, 0x5C, 0xB1, 0x8B, 0x08, 0x7C, 0x51, 0xCE, 0x23, 0x17, 0x87, 0x2C, 0x0A, 0x4A, 0x2B,
+	0x27, 0x6A, 0x9C, 0x1E, 0x84, 0x87, 0xA1, 0xCA, 0x14, 0x98, 0x13, 0x87, 0x59, 0xCB, 0x51, 0xE5,
+	0x61, 0x6A, 0x63, 0xC0, 0x41, 0xBE, 0xC4, 0xED, 0x0F, 0x56, 0x64, 0xEE, 0xCC, 0x8D, 0x1F, 0x20,
+	0xAD, 0xC5, 0xC8, 0x33, 0xD2, 0x35, 0x3D, 0x2C, 0x5B, 0x51, 0x96, 0x29, 0x36, 0x64, 0xFD, 0x8B,
+	0x3A, 0x72, 0x4D, 0xD4, 0x17, 0x16, 0xD1, 0x11, 0xE0, 0x43, 0x52, 0xE5, 0xB5, 0xA9, 0x45, 0xA9,
+	0x13, 0xFD, 0x64, 0x7A, 0x1C, 0xB1, 0x42, 0xF7, 0x2A, 0x4C, 0x6A, 0x94, 0x07, 0x7F, 0x6A, 0xE0,
+	0x1D, 0x16, 0x3C, 0x6C, 0x67, 0x58, 0xE9, 0x82, 0xF3, 0x58, 0x73, 0x72, 0xE5, 0x1C, 0x9B, 0x3B,
+	0x03, 0x42, 0x87, 0xC1, 0x0B, 0xC2, 0x13, 0x92, 0xAD, 0xE4, 0x9E, 0xB8, 0xA5, 0xC9, 0x40, 0xEC,
+	0x4C, 0x24, 0x78, 0x39, 0x66, 0x0D, 0xCB, 0xE3, 0x86, 0xE1, 0x4B, 0x12, 0xF2, 0x1C, 0x1A, 0x8C,
+	0xC7, 0x72, 0xCA, 0x8B, 0x1B, 0x82, 0x4F, 0xC2, 0x21, 0x05, 0xF5, 0xBA, 0x6F, 0x01, 0xCC, 0xAC,
+	0xA0, 0xB7, 0x36, 0x08, 0x8F, 0x80, 0x52, 0x09, 0xE3, 0x31, 0xFA, 0x0B, 0x98, 0x53, 0x21, 0x61,
+	0xFD, 0x1A, 0x9A, 0x90, 0x65, 0xB3, 0xA0, 0xD4, 0xF8, 0x23, 0x35, 0x0B, 0x10, 0x2F, 0x26, 0x37,
+	0x7D, 0x25, 0x0D, 0xEB, 0x10, 0xC1, 0x79, 0x6F, 0xC1, 0x00, 0xC1, 0x2F, 0x51, 0x1A, 0x00, 0xBC,
+	0x8C, 0x4D, 0x91, 0x9C, 0x39, 0x64, 0x62, 0x6A, 0x53, 0xBE, 0x12, 0x68, 0xFD, 0x42, 0x39, 0x97,
+	0xA3, 0x4D, 0x97, 0xA7, 0x07, 0xE4, 0x3A, 0xB4, 0x11, 0x3D, 0x2A, 0x36, 0x9E, 0xC4, 0xD0, 0xAB,
+	0x3B, 0x9A, 0x23, 0x68, 0x09, 0x71, 0x4B, 0xD4, 0x39, 0xD4, 0x14, 0x1A, 0xF1, 0xD5, 0x91, 0xB8,
+	0x0C, 0x6A, 0x18, 0xB3, 0x39, 0x83, 0x93, 0x42, 0x8E, 0xE1, 0x09, 0xAB, 0x02, 0xDA, 0x9C, 0xA2,
+	0x99, 0x13, 0xF4, 0x93, 0xB8, 0x66, 0x7C, 0x54, 0xB0, 0x9D, 0xD8, 0xA6, 0xC5, 0xCD, 0x74, 0x72,
+	0xE6, 0x19, 0x40, 0x32, 0xB0, 0xE0, 0xDE, 0xC5, 0x5A, 0xA0, 0xF5, 0xAB, 0x62, 0x23, 0x70, 0xC5,
+	0xD0, 0xAA, 0x79, 0x15, 0x01, 0xCE, 0x0E, 0xE1, 0x98, 0xB0, 0x38, 0x3C, 0x67, 0x51, 0x0D, 0x8A,
+	0xC6, 0xEE, 0x58, 0x8A, 0x68, 0xF1, 0x01, 0xD8, 0xF0, 0x87, 0xC1, 0xC2, 0x21, 0xE8, 0x60, 0x78,
+	0x12, 0x9E, 0x96, 0x7D, 0x28, 0x6C, 0x49, 0xDA, 0x31, 0x30, 0x53, 0x44, 0x74, 0xA8, 0x9D, 0xB1,
+	0x62, 0xF0, 0x5C, 0xD8, 0xA1, 0xA4, 0x26, 0x9F, 0x58, 0x3E, 0xB3, 0x78, 0x76, 0x80, 0xF5, 0x4E,
+	0x70, 0xA5, 0x91, 0xD0, 0x2C, 0x19, 0xA1, 0xE0, 0x73, 0xC0, 0xC5, 0xD5, 0x31, 0xE1, 0x27, 0xE0,
+	0x61, 0xC3, 0x11, 0xDC, 0x8A, 0x53, 0x29, 0xD1, 0xEE, 0xC6, 0xA5, 0x19, 0xA0, 0x27, 0xCE, 0x56,
+	0x3E, 0xB2, 0x7D, 0x28, 0xEA, 0x20, 0xC2, 0x2F, 0x03, 0x23, 0x54, 0x85, 0xD0, 0x62, 0x27, 0xC9,
+	0x09, 0x3A, 0x16, 0x08, 0xF5, 0x8C, 0xDF, 0x12, 0x83, 0x54, 0xED, 0x9D, 0x0A, 0xED, 0x59, 0xC9,
+	0x8B, 0x9A, 0x47, 0x20, 0xB9, 0xC2, 0x7C, 0xC9, 0xDA, 0x33, 0x96, 0x06, 0x6F, 0x8C, 0xF9, 0x11,
+	0xE2, 0x52, 0x42, 0xAF, 0x56, 0x07, 0x95, 0x8B, 0xEB, 0x27, 0x52, 0xEC, 0x3A, 0xA8, 0xBC, 0x8E,
+	0x08, 0xE4, 0xB1, 0xCF, 0x92, 0x9B, 0x12, 0x71, 0xC1, 0x58, 0x30, 0x76, 0x88, 0x5B, 0xE1, 0xCF,
+	0x1C, 0x94, 0x13, 0xB4, 0x2E, 0x05, 0xB3, 0x16, 0xE4, 0xA7, 0x84, 0x8E, 0x03, 0x9A, 0xA5, 0x6D,
+	0x4C, 0x7A, 0x4A, 0xB8, 0x9E, 0x04, 0x7A, 0x80, 0xE7, 0x05, 0x2F, 0x4A, 0x93, 0x45, 0x49, 0xB3,
+	0x06, 0xB4, 0x06, 0x75, 0x84, 0x33, 0x86, 0x29, 0xEE, 0x0F, 0x14, 0x9C, 0xA3, 0xEB, 0x12, 0x62,
+	0x27, 0xC8, 0x0E, 0x01, 0x38, 0x8D, 0x1C, 0xF8, 0x97, 0xE0, 0x62, 0x8B, 0x03, 0x5F, 0x46, 0x2E,
+	0x0C, 0x58, 0xB2, 0xB0, 0x8D, 0x8B, 0x1E, 0x94, 0x6E, 0x84, 0xAD, 0xC9, 0x1B, 0x04, 0x2C, 0xCC,
+	0xDC, 0x55, 0xC6, 0x41, 0x7A, 0x8E, 0x68, 0x96, 0x02, 0xA9, 0xC4, 0x23, 0xC6, 0x76, 0x40, 0xEA,
+	0x4C, 0xDC, 0xA1, 0x7C, 0x2C, 0x72, 0x0F, 0x19, 0x0B, 0x43, 0xB3, 0x96, 0x2C, 0x81, 0x8F, 0x4E,
+	0x80, 0x39, 0xCB, 0x13, 0x07, 0x7D, 0x62, 0x58, 0x1C, 0x13, 0xA7, 0x6D, 0x6A, 0xEB, 0x18, 0x18,
+	0x45, 0x15, 0x8C, 0x63, 0x86, 0x20, 0x76, 0x36, 0x4A, 0x6A, 0x8D, 0xE0, 0x29, 0x2E, 0x2E, 0x19,
+	0xCB, 0xBC, 0x05, 0x38, 0x0B, 0x42, 0x45, 0xE5, 0x6E, 0x84, 0x86, 0xE3, 0x92, 0xD0, 0x0A, 0x5F,
+	0x21, 0x68, 0x08, 0xFC, 0xB9, 0xA5, 0x4E, 0x60, 0x08, 0xD5, 0x9B, 0xE0, 0x2B, 0x63, 0x14, 0xC1,
+	0x89, 0x42, 0x13, 0xE2, 0xAE, 0xC1, 0x8C, 0x5C, 0xC0, 0xCB, 0x1E, 0xA1, 0x41, 0xE0, 0x70, 0x31,
+	0x3D, 0x47, 0x59, 0x18, 0x9C, 0x24, 0x26, 0xCE, 0x2D, 0x42, 0x17, 0x02, 0x27, 0xA9, 0xCE, 0x0A,
+	0x97, 0x44, 0x34, 0x5D, 0x8B, 0x41, 0x57, 0x24, 0x36, 0x0A, 0x83, 0x07, 0xB3, 0xB0, 0x67, 0x39,
+	0xC1, 0xC4, 0x8A, 0x86, 0x2C, 0xF0, 0x38, 0x18, 0x93, 0xE2, 0x04, 0x10, 0x41, 0x3C, 0x62, 0x76,
+	0x20, 0xD2, 0xA8, 0x3A, 0xC3, 0x30, 0x2D, 0x60, 0x49, 0xC4, 0x3F, 0xC4, 0x60, 0x0E, 0x68, 0xEC,
+	0x78, 0x6A, 0x8C, 0xC8, 0xCC, 0x17, 0x8E, 0x49, 0x63, 0x83, 0xA8, 0xAC, 0x10, 0x39, 0xB1, 0x1D,
+	0x1C, 0x20, 0x9D, 0x40, 0xF0, 0xC2, 0x29, 0x63, 0x13, 0xC6, 0x47, 0x10, 0x41, 0x27, 0x42, 0x09,
+	0x5B, 0xB6, 0x07, 0x34, 0x02, 0x78, 0xC4, 0xE6, 0xA5, 0x60, 0x5B, 0x07, 0x31, 0x1B, 0x31, 0x31,
+	0x2B, 0x81, 0x42, 0xD6, 0xA2, 0x3C, 0x66, 0x61, 0x00, 0x82, 0x78, 0xEE, 0x66, 0xE2, 0xA5, 0x8C,
+	0x0D, 0xE2, 0x83, 0x40, 0x83, 0x95, 0x41, 0xF4, 0x42, 0x7A, 0x88, 0x9C, 0x24, 0x27, 0xC1, 0x8B,
+	0x88, 0xC4, 0x4E, 0x8E, 0x13, 0xA3, 0x3C, 0x73, 0xC6, 0x78, 0x23, 0x40, 0x08, 0xDC, 0x3C, 0x01,
+	0xF1, 0xCA, 0x02, 0xB0, 0x4F, 0x1A, 0xE0, 0x0C, 0x0C, 0x13, 0x25, 0x3C, 0x67, 0xC8, 0xE8, 0xA4,
+	0x75, 0x04, 0x02, 0x39, 0xEB, 0x5A, 0x47, 0x30, 0x8E, 0xC8, 0xA0, 0x8C, 0xF8, 0x08, 0xFA, 0x2A,
+	0xA0, 0xE1, 0x3B, 0xA1, 0x73, 0xC7, 0x25, 0x06, 0x64, 0x75, 0x8D, 0xCF, 0x1C, 0x18, 0x0A, 0x55,
+	0xE1, 0x8E, 0x45, 0xA8, 0xEB, 0x19, 0x1F, 0x94, 0x3C, 0x22, 0x09, 0xCB, 0x1E, 0x15, 0x60, 0x82,
+	0x08, 0x24, 0xC9, 0x59, 0x00, 0x7A, 0x01, 0x04, 0xEA, 0x08, 0x20, 0x82, 0x08, 0x27, 0x8C, 0x4E,
+	0x11, 0xD5, 0x1C, 0x14, 0xC2, 0x08, 0x20, 0x82, 0x07, 0xA0, 0x76, 0x3C, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0xD1, 0x1E, 0xA3, 0x84, 0x93,
+	0xA1, 0x04, 0x12, 0x74, 0x24, 0x10, 0x40, 0xF0, 0x82, 0x08, 0x20, 0x82, 0x05, 0xB1, 0x02, 0x0F,
+	0x19, 0xD5, 0x40, 0x20, 0x82, 0x08, 0x20, 0x82, 0x4E, 0xA0, 0x76, 0x41, 0x04, 0x10, 0x41, 0x3C,
+	0x6A, 0xE0, 0x63, 0xBA, 0x38, 0xC0, 0x00
 };
 
+/* 3-bit ADPCM, SNR 11.9 dB */
 const u8 sfx_imp_death1[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x78, 0x88, 0x99, 0x88, 0x88, 0x88, 0x77, 0x78, 0x87, 0x88, 0x89, 0x98, 0x88,
-	0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x98, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x77, 0x77,
-	0x78, 0x88, 0x88, 0x89, 0x99, 0x88, 0x87, 0x77, 0x78, 0x89, 0x87, 0x77, 0x89, 0x98, 0x88, 0x99,
-	0x88, 0x77, 0x78, 0x87, 0x77, 0x89, 0x99, 0x99, 0x88, 0x87, 0x77, 0x78, 0x88, 0x77, 0x89, 0x99,
-	0x88, 0x89, 0x88, 0x87, 0x87, 0x78, 0x87, 0x78, 0x89, 0x99, 0x99, 0x88, 0x77, 0x77, 0x78, 0xA9,
-	0x77, 0x78, 0x99, 0x87, 0x89, 0x99, 0x87, 0x88, 0x88, 0x87, 0x78, 0x88, 0x99, 0x99, 0x88, 0x77,
-	0x76, 0x78, 0x9B, 0x86, 0x87, 0x8A, 0x87, 0x78, 0x99, 0x88, 0x78, 0x87, 0x88, 0x77, 0x88, 0x9A,
-	0xA9, 0x98, 0x87, 0x76, 0x67, 0x78, 0xEB, 0x39, 0x65, 0xB9, 0x67, 0x89, 0xA9, 0x88, 0x77, 0x87,
-	0x77, 0x77, 0x99, 0xAA, 0x98, 0x88, 0x77, 0x66, 0x77, 0x89, 0xEA, 0x59, 0x65, 0xA9, 0x67, 0x99,
-	0xA9, 0x88, 0x78, 0x87, 0x76, 0x67, 0x9A, 0xA9, 0x99, 0x98, 0x76, 0x66, 0x77, 0x88, 0xCD, 0x68,
-	0x84, 0x79, 0x76, 0x89, 0xAA, 0x98, 0x77, 0x88, 0x97, 0x57, 0x88, 0xAA, 0x99, 0x99, 0x87, 0x66,
-	0x67, 0x77, 0x8B, 0xC6, 0x99, 0x57, 0x97, 0x68, 0x99, 0x99, 0x87, 0x88, 0x88, 0x75, 0x68, 0x8A,
-	0xA9, 0x89, 0x98, 0x77, 0x66, 0x77, 0x77, 0x9D, 0x98, 0xA6, 0x68, 0x86, 0x79, 0x99, 0x99, 0x77,
-	0x88, 0x88, 0x56, 0x78, 0x9A, 0x99, 0x99, 0x98, 0x76, 0x67, 0x77, 0x88, 0xCC, 0x79, 0x85, 0x78,
-	0x76, 0x89, 0x99, 0x98, 0x78, 0x98, 0x86, 0x56, 0x79, 0xA9, 0x99, 0x99, 0x87, 0x66, 0x67, 0x78,
-	0x89, 0xDB, 0x79, 0x75, 0x78, 0x67, 0x89, 0xAA, 0x98, 0x78, 0x88, 0x86, 0x57, 0x89, 0xA9, 0x99,
-	0x98, 0x77, 0x66, 0x77, 0x88, 0x89, 0xD9, 0x89, 0x65, 0x78, 0x77, 0x9A, 0xA9, 0x98, 0x78, 0x98,
-	0x76, 0x67, 0x8A, 0x99, 0x98, 0x98, 0x86, 0x66, 0x78, 0x88, 0x8A, 0xC9, 0x88, 0x65, 0x78, 0x77,
-	0x99, 0xAA, 0x98, 0x77, 0x88, 0x76, 0x77, 0x89, 0x98, 0x99, 0x88, 0x87, 0x77, 0x77, 0x78, 0x8C,
-	0xB7, 0x97, 0x57, 0x87, 0x78, 0x9A, 0xA9, 0x87, 0x77, 0x78, 0x88, 0x99, 0x98, 0x87, 0x77, 0x77,
-	0x88, 0x99, 0x99, 0x88, 0x77, 0x77, 0x7C, 0xB5, 0x99, 0x57, 0xA8, 0x55, 0x97, 0x8A, 0x98, 0x99,
-	0x99, 0x87, 0x78, 0x77, 0x77, 0x78, 0x87, 0xCC, 0x47, 0x74, 0x8A, 0x99, 0x99, 0xA9, 0x89, 0x54,
-	0x66, 0x9A, 0x99, 0xA9, 0x97, 0x66, 0x66, 0x78, 0x89, 0xAD, 0x85, 0x84, 0x59, 0x97, 0x89, 0xA9,
-	0x87, 0x66, 0xAC, 0x46, 0x95, 0x8D, 0xA6, 0x78, 0x88, 0x77, 0x68, 0x99, 0xA9, 0x98, 0x88, 0x77,
-	0x77, 0x77, 0x8A, 0xA7, 0x68, 0x45, 0x88, 0x8A, 0xBB, 0xAA, 0x87, 0x66, 0x56, 0x78, 0x9A, 0xA9,
-	0x88, 0x77, 0x77, 0x68, 0x9A, 0xA7, 0x88, 0x78, 0x76, 0x68, 0xAA, 0x99, 0x88, 0x87, 0x77, 0x77,
-	0x88, 0xAB, 0x87, 0x94, 0x48, 0x67, 0xAA, 0xAA, 0x98, 0x77, 0x66, 0x77, 0x88, 0x9A, 0xF7, 0x3A,
-	0x23, 0xA8, 0x6A, 0xAA, 0xBB, 0x96, 0x75, 0x57, 0x88, 0x9A, 0xAA, 0x87, 0x65, 0x56, 0x78, 0x9A,
-	0xAB, 0xEC, 0x45, 0x42, 0x8A, 0x9A, 0xBB, 0xB9, 0x75, 0x66, 0x67, 0x88, 0xAB, 0xA9, 0x87, 0x77,
-	0x67, 0x77, 0x9A, 0x87, 0x87, 0x89, 0x98, 0x88, 0x99, 0x77, 0x67, 0x77, 0x8F, 0x76, 0xE2, 0x4A,
-	0x66, 0x99, 0xAA, 0x98, 0x77, 0x77, 0x78, 0x78, 0x9E, 0xC1, 0x96, 0x09, 0xC7, 0x6B, 0xAB, 0xA9,
-	0x64, 0x66, 0x89, 0x99, 0xAA, 0xA8, 0x75, 0x44, 0x67, 0x89, 0xAA, 0xA9, 0x99, 0x94, 0x37, 0x58,
-	0xCA, 0x9A, 0xA8, 0x88, 0x62, 0x66, 0x8B, 0xBA, 0xAA, 0x98, 0x76, 0x66, 0x77, 0x88, 0x98, 0xBF,
-	0x35, 0x71, 0x7B, 0x99, 0xAB, 0xC9, 0x86, 0x56, 0x89, 0x87, 0x77, 0x9A, 0x87, 0x67, 0x88, 0x88,
-	0x99, 0x99, 0x87, 0x76, 0x77, 0x88, 0x88, 0x88, 0x9F, 0x70, 0xA3, 0x2B, 0xC7, 0x8B, 0xA9, 0x98,
-	0x56, 0x67, 0x88, 0x88, 0x99, 0x98, 0x78, 0x77, 0x77, 0x78, 0x7D, 0xC4, 0x97, 0x38, 0xA7, 0x69,
-	0x9A, 0xBA, 0x67, 0x66, 0x88, 0x78, 0x99, 0x99, 0x97, 0x76, 0x66, 0x78, 0x9A, 0xAA, 0x98, 0xBA,
-	0x24, 0x43, 0x9C, 0xAA, 0xBB, 0xA8, 0x64, 0x46, 0x78, 0x8B, 0xC9, 0x97, 0x55, 0x66, 0x68, 0xAB,
-	0xBA, 0x98, 0x88, 0x65, 0x66, 0x8A, 0xAA, 0xA9, 0x98, 0x75, 0x45, 0x58, 0xAB, 0xBA, 0xA9, 0x87,
-	0x66, 0x78, 0x89, 0x87, 0x78, 0x88, 0x88, 0x99, 0x99, 0x87, 0x78, 0x9A, 0xB3, 0x68, 0x4A, 0xB7,
-	0x68, 0x89, 0x89, 0x88, 0x87, 0x77, 0x88, 0x99, 0x99, 0x88, 0x77, 0x76, 0x67, 0xAB, 0x76, 0x85,
-	0x8B, 0x98, 0x99, 0x99, 0x86, 0x56, 0x67, 0x99, 0x99, 0x99, 0x87, 0x79, 0x98, 0x97, 0x78, 0x99,
-	0x76, 0x77, 0x8A, 0xAA, 0x87, 0x77, 0x78, 0x87, 0x89, 0xA9, 0x97, 0x76, 0x99, 0x46, 0x75, 0x9A,
-	0x99, 0x99, 0x99, 0x87, 0x67, 0x88, 0x98, 0x89, 0x98, 0x87, 0x77, 0x78, 0x99, 0x99, 0x87, 0x77,
-	0x78, 0x97, 0x89, 0x99, 0xA9, 0x87, 0x66, 0x66, 0x89, 0x99, 0x99, 0x98, 0x77, 0x65, 0x8D, 0x46,
-	0xB4, 0x8D, 0xA7, 0x89, 0x78, 0x76, 0x67, 0x8A, 0xA9, 0x99, 0x98, 0x77, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x69, 0xE6, 0x6B, 0x36, 0xC7, 0x6A, 0x9A, 0xA9, 0x86, 0x76, 0x67, 0x77, 0x8A,
-	0xA8, 0x86, 0x47, 0x99, 0xAA, 0x88, 0x88, 0x77, 0x66, 0x78, 0xAA, 0xA9, 0x98, 0x77, 0x78, 0x87,
-	0x98, 0x58, 0x97, 0x98, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x76, 0x77, 0x89, 0xDA, 0x69, 0x75, 0x99, 0x76, 0x99, 0xAA, 0x98, 0x56, 0x78, 0x88, 0x89, 0xAA,
-	0x97, 0x76, 0x57, 0x78, 0x99, 0xAA, 0xA9, 0x87, 0x55, 0x67, 0x8A, 0xBB, 0xA9, 0x87, 0x77, 0x55,
-	0x67, 0x9A, 0xAA, 0x98, 0x87, 0x77, 0x78, 0x89, 0x99, 0x98, 0x88, 0x78, 0x87, 0x56, 0x65, 0x9A,
-	0xAB, 0xBB, 0x97, 0x76, 0x57, 0x77, 0x89, 0x9A, 0x99, 0x87, 0x66, 0x66, 0x78, 0x88, 0x99, 0x99,
-	0x98, 0x87, 0x78, 0x78, 0x88, 0x98, 0x87, 0x66, 0x78, 0x9A, 0x99, 0x98, 0x87, 0x77, 0x77, 0x78,
-	0x89, 0x9C, 0xC2, 0x65, 0x17, 0xA8, 0x8B, 0xAB, 0xBA, 0x96, 0x34, 0x45, 0x99, 0xAA, 0xBA, 0xA8,
-	0x75, 0x44, 0x57, 0x89, 0xA9, 0xAA, 0xAA, 0xA6, 0x45, 0x57, 0xA9, 0x88, 0x99, 0x98, 0x76, 0x68,
-	0x89, 0x99, 0x99, 0x88, 0x77, 0x67, 0x78, 0x88, 0x8A, 0xB8, 0x76, 0x45, 0x78, 0x89, 0xAB, 0xBA,
-	0xA8, 0x75, 0x55, 0x57, 0x89, 0xAB, 0xAA, 0x98, 0x65, 0x55, 0x67, 0x89, 0x9A, 0xAA, 0xA9, 0x65,
-	0x56, 0x79, 0x99, 0xA9, 0x99, 0x77, 0x66, 0x78, 0x99, 0xA9, 0x98, 0x87, 0x77, 0x77, 0x79, 0xC9,
-	0x59, 0x65, 0x9A, 0x77, 0x99, 0xAA, 0x88, 0x65, 0x79, 0x99, 0x86, 0x78, 0x89, 0x87, 0x67, 0x89,
-	0x99, 0x87, 0x78, 0x99, 0x97, 0x68, 0x89, 0xA9, 0x89, 0x99, 0x87, 0x76, 0x66, 0x67, 0x88, 0xAA,
-	0xAA, 0x98, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x88, 0x77, 0x88, 0x8B, 0x74, 0x74, 0x58, 0x99,
-	0xAB, 0xAB, 0x99, 0x96, 0x54, 0x66, 0x89, 0x9A, 0xAA, 0x98, 0x76, 0x65, 0x77, 0x89, 0x9A, 0x99,
-	0x87, 0x66, 0x67, 0x9A, 0xAA, 0x97, 0x66, 0x66, 0x78, 0x9A, 0xBB, 0xA9, 0x76, 0x66, 0x67, 0x89,
-	0x9A, 0x99, 0x87, 0x76, 0x77, 0x78, 0x8C, 0xF5, 0x59, 0x15, 0xBA, 0x68, 0xB9, 0xAB, 0xA8, 0x55,
-	0x56, 0x79, 0x98, 0xAA, 0xAA, 0x97, 0x55, 0x57, 0x78, 0x99, 0x99, 0x99, 0x99, 0x77, 0x66, 0x89,
-	0xAA, 0xA9, 0x98, 0x77, 0x66, 0x67, 0x89, 0x99, 0x99, 0x98, 0x87, 0x77, 0x78, 0x88, 0x89, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x85, 0x46, 0x67, 0xAB, 0xA8, 0xA9, 0x79, 0x86,
-	0x55, 0x78, 0x9A, 0xA9, 0x99, 0x88, 0x76, 0x66, 0x78, 0x99, 0x99, 0x98, 0x87, 0x77, 0x77, 0x89,
-	0x98, 0x88, 0x88, 0x87, 0x77, 0x78, 0x99, 0xAA, 0x99, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x99,
-	0xAB, 0x63, 0x43, 0x58, 0xBA, 0xAA, 0x9A, 0x88, 0x86, 0x55, 0x78, 0xAA, 0xAA, 0x99, 0x88, 0x76,
-	0x56, 0x78, 0x89, 0x99, 0x99, 0x98, 0x77, 0x77, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x99, 0x99,
-	0x98, 0x88, 0x87, 0x78, 0x88, 0x98, 0x88, 0x77, 0x77, 0x78, 0x89, 0xAB, 0x95, 0x53, 0x59, 0xBA,
-	0xAA, 0x99, 0xAA, 0x64, 0x43, 0x58, 0xAA, 0xAA, 0xAA, 0x99, 0x75, 0x45, 0x68, 0x99, 0x9A, 0xA9,
-	0x98, 0x77, 0x78, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x89, 0x88, 0x88, 0x88, 0x78, 0x88, 0x99,
-	0x99, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x89, 0x89, 0x9B, 0x96, 0x53, 0x58, 0x9A, 0xAA, 0xA9,
-	0x89, 0x77, 0x66, 0x68, 0x99, 0x99, 0x99, 0x98, 0x77, 0x66, 0x77, 0x88, 0x89, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x77, 0x99, 0x77, 0x77, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88,
-	0x88, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x66, 0x7A, 0xA9, 0x97, 0x68, 0x87, 0x87, 0x78, 0x9A, 0x99,
-	0x98, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x87, 0x87, 0x78, 0x88, 0x89, 0x77, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x87, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x86
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x9C,
+	0x21, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x3C, 0x74, 0x81, 0x04, 0x10, 0x49, 0xD0, 0x8F, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0xF1, 0xC0, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x27, 0x50, 0x41, 0x04, 0x9D, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0xC7, 0x12,
+	0x0F, 0x1C, 0x02, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0xE3, 0x81, 0xCB, 0x20, 0x83, 0xC0,
+	0xE6, 0x50, 0x39, 0x84, 0x02, 0x4E, 0x10, 0x82, 0x08, 0x20, 0x8F, 0x08, 0x3C, 0x70, 0x08, 0x20,
+	0x8C, 0x71, 0x20, 0xF0, 0x31, 0x20, 0x82, 0x08, 0x1E, 0x10, 0x4F, 0x04, 0x0C, 0x41, 0x03, 0x83,
+	0xC1, 0xE0, 0x8C, 0x3D, 0x44, 0x64, 0x71, 0x1C, 0xC3, 0x40, 0xE5, 0x81, 0xA8, 0x04, 0xF0, 0x78,
+	0x23, 0x13, 0xC6, 0xA0, 0xD0, 0x3C, 0x26, 0x56, 0x29, 0x63, 0x08, 0x41, 0x3C, 0xD0, 0x42, 0xDD,
+	0xE2, 0x23, 0x35, 0x44, 0x4F, 0x88, 0x12, 0x70, 0x84, 0x62, 0x0F, 0x38, 0x9D, 0x14, 0xBD, 0x35,
+	0x2D, 0x21, 0x52, 0xCA, 0x87, 0x23, 0x85, 0x12, 0x96, 0x69, 0xA7, 0x0B, 0xB7, 0x79, 0x91, 0xCC,
+	0x01, 0x13, 0x0B, 0x15, 0x92, 0xB6, 0x08, 0xF6, 0x4F, 0x34, 0x71, 0xB7, 0xB1, 0xB1, 0xCA, 0x14,
+	0x36, 0x8C, 0x47, 0x98, 0x26, 0x46, 0x12, 0x7B, 0xA0, 0x41, 0x37, 0x38, 0xBC, 0xAB, 0x58, 0x32,
+	0xEA, 0x14, 0x5F, 0x12, 0x18, 0xB2, 0x0F, 0xB0, 0x88, 0x66, 0xC7, 0x03, 0x85, 0x61, 0x30, 0x4F,
+	0x54, 0x17, 0xF2, 0xC2, 0x17, 0x19, 0xAC, 0xD1, 0x8A, 0xDB, 0xD0, 0xF8, 0x46, 0x08, 0x41, 0x7C,
+	0x50, 0xEE, 0x09, 0x4A, 0xC1, 0x27, 0xD6, 0x38, 0x13, 0x73, 0x89, 0xC8, 0xB5, 0x91, 0x07, 0xA8,
+	0xE9, 0xF1, 0x2C, 0xD0, 0x24, 0xFB, 0x08, 0x82, 0xCD, 0xDC, 0x6E, 0x27, 0x02, 0x48, 0xF7, 0x10,
+	0x3F, 0xAC, 0x95, 0x60, 0x9F, 0x4C, 0x14, 0x43, 0xB7, 0xA0, 0xB5, 0x1B, 0x19, 0x18, 0x6A, 0x8E,
+	0xB6, 0x26, 0xA4, 0x99, 0x59, 0xE4, 0x4A, 0x02, 0xDF, 0x93, 0x44, 0x24, 0x60, 0xCD, 0x74, 0x43,
+	0x62, 0x11, 0x1D, 0x4B, 0x07, 0x82, 0x08, 0xDB, 0xBC, 0xEA, 0x84, 0x85, 0x19, 0xAE, 0x80, 0x31,
+	0x18, 0x9E, 0x71, 0x04, 0x61, 0xC1, 0x3C, 0xD0, 0x26, 0xF7, 0x43, 0x03, 0x70, 0x74, 0x9B, 0x48,
+	0x13, 0xE8, 0xAC, 0x10, 0x37, 0xDC, 0xE0, 0x64, 0x68, 0x80, 0xEC, 0xBD, 0x51, 0x08, 0x05, 0x9F,
+	0x08, 0x11, 0x0D, 0x3F, 0x8E, 0x0A, 0x40, 0x45, 0xBE, 0xA4, 0xFC, 0x39, 0x1B, 0x80, 0x82, 0x8C,
+	0xCC, 0x56, 0x61, 0x38, 0x82, 0x16, 0xE7, 0xCB, 0x85, 0x01, 0x02, 0xCF, 0xA8, 0xC5, 0x14, 0x66,
+	0xB3, 0x88, 0x3B, 0x46, 0xF0, 0x31, 0xD4, 0xB7, 0x24, 0xB2, 0x71, 0x20, 0x49, 0x2F, 0x97, 0x06,
+	0x94, 0x24, 0xB7, 0x4C, 0x14, 0x41, 0xA7, 0xF2, 0xC0, 0xCA, 0xE0, 0x12, 0xF1, 0x63, 0x00, 0x93,
+	0xBD, 0xD6, 0x24, 0x4A, 0x0D, 0xFE, 0x26, 0x62, 0x03, 0x07, 0xB4, 0x08, 0x94, 0x66, 0xDD, 0x84,
+	0xCA, 0x06, 0xB4, 0x15, 0x19, 0x84, 0x73, 0xCC, 0x43, 0x6F, 0xC7, 0xC1, 0xB1, 0x43, 0x2C, 0xB0,
+	0x40, 0xB3, 0x6F, 0x73, 0x3B, 0x16, 0x28, 0x25, 0xD4, 0x84, 0x44, 0x52, 0x7F, 0xA4, 0x60, 0x94,
+	0x26, 0x0F, 0xFA, 0xE1, 0x76, 0x01, 0xA0, 0xFD, 0x42, 0x85, 0x12, 0xDD, 0x60, 0x61, 0x07, 0xDB,
+	0xF0, 0x62, 0xA4, 0x04, 0x79, 0xA0, 0x46, 0xD8, 0x5A, 0xF2, 0x92, 0x04, 0x60, 0x4F, 0xA6, 0x51,
+	0x40, 0x23, 0x6F, 0xF5, 0xA3, 0x14, 0x09, 0x25, 0xE0, 0x12, 0x20, 0x62, 0x7C, 0x70, 0x80, 0x36,
+	0xF7, 0x56, 0xB1, 0x62, 0x84, 0xEE, 0x24, 0x42, 0x92, 0x21, 0xFE, 0x51, 0x1A, 0x46, 0x0D, 0xDE,
+	0xE2, 0x06, 0xA4, 0x32, 0xEF, 0x42, 0x0A, 0x31, 0xA5, 0xC0, 0x00, 0xD8, 0x16, 0xE9, 0x7E, 0x21,
+	0xB1, 0x06, 0x97, 0x7A, 0xA3, 0x40, 0x51, 0xAE, 0xA1, 0x10, 0xF5, 0x0A, 0x08, 0x18, 0x93, 0xE8,
+	0x93, 0xDC, 0x1C, 0xC6, 0x84, 0x0A, 0x6C, 0x1C, 0x44, 0x18, 0x93, 0xCD, 0x07, 0xCD, 0x8F, 0x0E,
+	0x46, 0xC0, 0x20, 0xFE, 0x98, 0xD0, 0x82, 0x0F, 0xC3, 0x18, 0xE8, 0x54, 0xF4, 0x84, 0xC4, 0xF4,
+	0x40, 0x87, 0x29, 0x59, 0xC7, 0x73, 0x83, 0x98, 0x90, 0x41, 0x35, 0xC5, 0x03, 0x82, 0x1E, 0x61,
+	0x03, 0x42, 0x4F, 0x84, 0x0D, 0x70, 0xA0, 0x3A, 0xEC, 0x21, 0x68, 0x41, 0x27, 0xC3, 0x76, 0xF8,
+	0x38, 0xAB, 0x41, 0xC2, 0x50, 0x53, 0x16, 0x09, 0xF4, 0x10, 0x31, 0x04, 0x10, 0x4E, 0x1B, 0x7E,
+	0xBC, 0x15, 0x86, 0x19, 0x6F, 0x14, 0x28, 0x1B, 0x1C, 0x7A, 0xCC, 0x03, 0x88, 0x30, 0xC0, 0xA6,
+	0x25, 0x9E, 0xC0, 0xC7, 0x77, 0xA1, 0x55, 0x84, 0x89, 0xE0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x27,
+	0x99, 0x44, 0xDD, 0xE6, 0xE7, 0x25, 0x70, 0xC9, 0xB8, 0x26, 0x40, 0xC8, 0xFE, 0x4C, 0x81, 0x21,
+	0xC1, 0xEF, 0xD0, 0xA2, 0xC8, 0xD7, 0x51, 0x7C, 0x49, 0x18, 0x36, 0x18, 0x40, 0x83, 0x82, 0x78,
+	0x3A, 0x9B, 0x93, 0xD9, 0x00, 0x5F, 0xC5, 0xAE, 0x04, 0x62, 0xB3, 0xDD, 0x04, 0x68, 0x46, 0x24,
+	0x1E, 0x70, 0xB1, 0x11, 0xD9, 0xEC, 0x65, 0x2B, 0x07, 0x98, 0x40, 0x23, 0x09, 0x3F, 0xC4, 0xCC,
+	0xD0, 0x61, 0x97, 0xFE, 0x01, 0x60, 0x03, 0x87, 0xBE, 0x42, 0xC9, 0x54, 0x88, 0xFF, 0xE0, 0x23,
+	0x28, 0x22, 0x7D, 0x83, 0x06, 0x09, 0x3C, 0xD3, 0xA8, 0xA0, 0x2D, 0x7B, 0x79, 0x40, 0x12, 0x87,
+	0x1E, 0xF1, 0x03, 0x24, 0xAB, 0x3E, 0xD6, 0x04, 0x59, 0x88, 0x47, 0xFD, 0x04, 0xB1, 0x0D, 0x1F,
+	0xCA, 0x12, 0x51, 0x59, 0x86, 0x82, 0x56, 0xDE, 0xCA, 0xC4, 0x2C, 0x40, 0x0F, 0x3C, 0x44, 0x4D,
+	0x89, 0x8A, 0xEC, 0x51, 0x13, 0xD8, 0xC9, 0xDF, 0x20, 0x4E, 0xA4, 0x4F, 0xA5, 0x90, 0x37, 0x18,
+	0x83, 0x6A, 0x20, 0x81, 0x84, 0x20, 0xF3, 0x85, 0x5B, 0xF8, 0xD0, 0xC4, 0x27, 0x1D, 0x27, 0xD1,
+	0x44, 0x61, 0x13, 0x6D, 0x46, 0x60, 0x90, 0xB0, 0xDA, 0x88, 0xD9, 0x13, 0x7B, 0x04, 0x68, 0x94,
+	0x3D, 0xF4, 0x40, 0x92, 0x8A, 0xCD, 0x67, 0x50, 0x24, 0x9F, 0xC7, 0x95, 0x28, 0x54, 0x1B, 0xB4,
+	0x04, 0xB1, 0x5C, 0x13, 0x7D, 0x03, 0x84, 0x81, 0x04, 0x3F, 0xCC, 0x19, 0x20, 0x79, 0xAC, 0xD0,
+	0x34, 0xA0, 0x82, 0x79, 0xA0, 0x8C, 0x08, 0xC4, 0xF0, 0x08, 0x20, 0x82, 0x06, 0x26, 0xFF, 0x28,
+	0x58, 0x98, 0xCE, 0xAD, 0xA1, 0x92, 0x47, 0x13, 0x4F, 0x60, 0x68, 0x81, 0x07, 0x9C, 0x41, 0x1A,
+	0x1A, 0x08, 0x27, 0x80, 0x34, 0x08, 0xF3, 0x41, 0xE0, 0x62, 0x41, 0x18, 0x7B, 0xF1, 0x0B, 0x50,
+	0x4A, 0x7C, 0x1E, 0x86, 0x50, 0x83, 0x4C, 0x36, 0xA8, 0x90, 0xE0, 0x82, 0x7D, 0x00, 0x62, 0x41,
+	0x07, 0x81, 0x84, 0x20, 0x9E, 0x09, 0xE3, 0x11, 0xE1, 0x30, 0x82, 0x30, 0xCB, 0xFE, 0x54, 0x8C,
+	0x82, 0xC7, 0xBD, 0x91, 0xA2, 0x20, 0x93, 0xCF, 0xE0, 0x48, 0x08, 0xA5, 0x9B, 0x40, 0xE0, 0x82,
+	0x09, 0xE0, 0x60, 0x3D, 0x00, 0x93, 0xA8, 0x18, 0x93, 0xC0, 0x27, 0x82, 0x06, 0x23, 0xC8, 0x3D,
+	0xE5, 0x44, 0x98, 0x27, 0xAB, 0xCA, 0x03, 0x42, 0x01, 0x27, 0xD2, 0xC6, 0x10, 0x8C, 0x4E, 0x24,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x07, 0x81, 0x89, 0x04, 0x10,
+	0x41, 0x03, 0xC2, 0x70, 0x18, 0xF2, 0x06, 0x47, 0x10, 0x41, 0x04, 0x10, 0x3D, 0x54, 0x10, 0x41,
+	0x04, 0x9C, 0x48, 0xC0, 0x82, 0x3C, 0x27, 0x50, 0x40, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x7D, 0x1B, 0x14, 0x7A, 0x85, 0x3A, 0x32, 0x70, 0x9A, 0x09, 0xE0, 0x0C,
+	0x48, 0x20, 0x82, 0x0F, 0x1C, 0x02, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x4E, 0x84, 0x82, 0x09, 0xD6, 0x04, 0x48, 0xFC, 0x20, 0x41, 0x04, 0x62, 0x71, 0x20,
+	0x93, 0xA1, 0x04, 0x13, 0xA8, 0x20, 0x82, 0x08, 0x24, 0xE8, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x12, 0x74, 0x24, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40,
+	0x1E, 0x95, 0x09, 0x04, 0xEA, 0x01, 0x04, 0x10, 0x49, 0xC4, 0x62, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x27, 0x5C, 0x00
 };
 
+/* 3-bit ADPCM, SNR 13.8 dB */
 const u8 sfx_imp_activity[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x89, 0x98, 0x77, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x99, 0x88, 0x89, 0x98, 0x89, 0x98, 0x77,
-	0x99, 0x86, 0x79, 0x97, 0x78, 0x99, 0x77, 0x8A, 0x97, 0x89, 0x98, 0x78, 0x98, 0x88, 0x89, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x89, 0x98, 0x45, 0xAA, 0x65, 0x59, 0x97, 0x55, 0xAB, 0x76, 0x8B,
-	0xA6, 0x69, 0xB9, 0x66, 0x9A, 0x75, 0x89, 0x86, 0x68, 0x98, 0x66, 0x88, 0x77, 0x88, 0x87, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x73, 0x6B, 0x97, 0x77, 0x99, 0x87, 0x7A, 0xB8, 0x8A, 0xA9, 0x77, 0x8A,
-	0x97, 0x78, 0x98, 0x77, 0x89, 0x87, 0x78, 0x87, 0x78, 0x98, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88,
-	0x98, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x99, 0x87, 0x78, 0x89,
-	0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x67, 0x99, 0x97, 0x67, 0x9A, 0x98, 0x88,
-	0x99, 0x88, 0x89, 0x98, 0x87, 0x78, 0x88, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x76, 0x78, 0x99, 0x87, 0x77, 0x89,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x78, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x54, 0x69, 0x95, 0x47,
-	0xBA, 0x65, 0x7A, 0xB9, 0x77, 0x89, 0xA9, 0x87, 0x79, 0xA9, 0x76, 0x79, 0x98, 0x76, 0x88, 0x87,
-	0x77, 0x77, 0x88, 0x77, 0x78, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x9A, 0x64, 0x6A,
-	0xB8, 0x55, 0x7B, 0xB8, 0x66, 0x8B, 0xBA, 0x76, 0x79, 0xA9, 0x87, 0x79, 0x99, 0x87, 0x78, 0x99,
-	0x87, 0x77, 0x89, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x99, 0x97, 0x56, 0x9A, 0xA7,
-	0x56, 0x9A, 0xA8, 0x66, 0x8A, 0xA9, 0x76, 0x79, 0xA8, 0x77, 0x89, 0x98, 0x77, 0x78, 0x88, 0x87,
-	0x67, 0x88, 0x77, 0x78, 0x88, 0x77, 0x77, 0x78, 0x88, 0x77, 0x78, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x76, 0x89, 0xA9,
-	0x66, 0x8A, 0xA8, 0x77, 0x9A, 0x87, 0x79, 0x98, 0x77, 0x89, 0x87, 0x78, 0x98, 0x87, 0x78, 0x88,
-	0x77, 0x88, 0x88, 0x77, 0x88, 0x87, 0x78, 0x99, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x76, 0x68, 0xAA, 0x86, 0x79,
-	0xAA, 0x87, 0x79, 0xA9, 0x77, 0x8A, 0x98, 0x77, 0x89, 0x87, 0x78, 0x99, 0x87, 0x78, 0x98, 0x77,
-	0x89, 0x98, 0x77, 0x89, 0x88, 0x78, 0x99, 0x87, 0x78, 0x98, 0x87, 0x88, 0x88, 0x78, 0x88, 0x87,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x65, 0x7A, 0xA8, 0x65, 0x79, 0xA8, 0x77, 0x89, 0x98, 0x77, 0x99, 0x98, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x99, 0x87, 0x78, 0x99, 0x98,
-	0x78, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x78, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x67, 0xAA, 0x86, 0x58, 0xB9, 0x66, 0x8A, 0x97, 0x69, 0xA9, 0x76, 0x89, 0x97, 0x68,
-	0x98, 0x77, 0x89, 0x87, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x68, 0xA9, 0x76, 0x79, 0xA9, 0x77, 0x89, 0x98, 0x77, 0x89, 0x97, 0x77, 0x99, 0x87, 0x78,
-	0x99, 0x87, 0x78, 0x98, 0x87, 0x88, 0x98, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x89, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x99, 0x87, 0x78, 0x99, 0x87, 0x78, 0x99, 0x87, 0x88, 0x98, 0x77, 0x88, 0x88, 0x77, 0x78, 0x88,
-	0x77, 0x78, 0x87, 0x77, 0x78, 0x87, 0x77, 0x78, 0x87, 0x77, 0x78, 0x87, 0x77, 0x78, 0x87, 0x77,
-	0x78, 0x77, 0x77, 0x78, 0x87, 0x77, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x78, 0x98, 0x88,
-	0x99, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0x87, 0x79, 0xA7, 0x68,
-	0xA9, 0x77, 0x9A, 0x87, 0x8A, 0x97, 0x79, 0x98, 0x78, 0x98, 0x77, 0x89, 0x87, 0x89, 0x87, 0x78,
-	0x98, 0x78, 0x98, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x86, 0x69, 0x86, 0x68, 0xA8, 0x67, 0x99, 0x76, 0x8A, 0x97, 0x79, 0x97, 0x67, 0x98, 0x77,
-	0x89, 0x87, 0x78, 0x87, 0x78, 0x88, 0x77, 0x88, 0x87, 0x89, 0x87, 0x78, 0x98, 0x78, 0x98, 0x77,
-	0x89, 0x87, 0x78, 0x87, 0x78, 0x88, 0x77, 0x88, 0x87, 0x88, 0x87, 0x78, 0x88, 0x78, 0x88, 0x87,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x67, 0x98, 0x77, 0x79, 0x98, 0x77, 0x89,
-	0x98, 0x78, 0x89, 0x87, 0x78, 0x88, 0x87, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x38
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x12, 0x70, 0x84, 0x10, 0x41, 0x03, 0xC2,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x07, 0x8E, 0x01, 0x04, 0x11, 0x8E, 0x24, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xC0, 0xC2, 0x1E, 0xC4, 0x18, 0x9C, 0x48, 0x20,
+	0x82, 0x08, 0x20, 0x83, 0xC1, 0x18, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0xF1, 0xC0, 0x20, 0x82, 0x3C, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x9D, 0x40, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x27, 0x50, 0x4E, 0xA0, 0x9D, 0x09, 0x04, 0x01, 0xE8, 0x04, 0x10,
+	0x41, 0x1E, 0x11, 0xCB, 0x23, 0x1C, 0x29, 0xB0, 0x62, 0xF0, 0xE5, 0x85, 0xCF, 0x12, 0xB8, 0x81,
+	0xAA, 0x36, 0x40, 0xF0, 0x81, 0xCD, 0x00, 0x82, 0x37, 0xF8, 0x63, 0x48, 0x85, 0xC1, 0x9F, 0x0A,
+	0x9C, 0x13, 0xB0, 0x43, 0x54, 0x25, 0x88, 0xDF, 0x18, 0xB1, 0x41, 0xA2, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x1E, 0xFD, 0x29, 0x60, 0x42, 0xE0,
+	0xCF, 0x06, 0x5F, 0x12, 0xB8, 0x05, 0x6C, 0x4A, 0xE0, 0x66, 0x8C, 0xD9, 0x04, 0x10, 0x31, 0xE0,
+	0x78, 0x44, 0x34, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0xE3, 0x23, 0xD8, 0x83, 0xB2, 0x00, 0xF4, 0x02, 0x08, 0x27, 0x82, 0x31,
+	0xD4, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x01, 0xFE, 0x24, 0x27, 0xA5, 0x9B, 0x44, 0x63, 0xC0, 0xE6, 0x1A,
+	0x21, 0x34, 0x62, 0x4E, 0xA0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x4F, 0x8A, 0x52, 0xE8, 0x19,
+	0x13, 0x89, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x12, 0x74, 0x20, 0x82, 0x08,
+	0x20, 0x9D, 0x4C, 0xA5, 0x50, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09, 0xDD, 0xF9, 0x29, 0xE2, 0x33, 0x42, 0x85, 0xD0,
+	0x95, 0x75, 0x0D, 0x5D, 0x4B, 0x17, 0x56, 0x25, 0x90, 0x46, 0x38, 0x8E, 0x0E, 0x14, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x0F, 0xBF, 0x4B,
+	0x3B, 0x00, 0xC6, 0x90, 0xA1, 0x7C, 0x08, 0xDB, 0x83, 0x83, 0x50, 0x88, 0xF6, 0x06, 0xAC, 0xE4,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x78,
+	0xD4, 0x9F, 0x96, 0x27, 0xA5, 0x81, 0xB0, 0x28, 0x5F, 0x03, 0x3E, 0x42, 0x46, 0xB2, 0x30, 0x27,
+	0xC5, 0x0D, 0x03, 0x83, 0x89, 0x03, 0x13, 0xC0, 0xC4, 0xEA, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x77, 0xE6, 0x0E, 0xD1, 0x29, 0x68, 0x67, 0xD0, 0xE4, 0xC0, 0x9B,
+	0xE2, 0x56, 0x60, 0xA0, 0xF1, 0x08, 0x3C, 0x62, 0x78, 0xCC, 0xD5, 0x40, 0x27, 0x50, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0xF0, 0x37, 0x3D, 0x0D, 0x0F, 0x43, 0x03, 0x50, 0x8D, 0xF0, 0xB9, 0x70, 0x2B, 0x50,
+	0x88, 0xF6, 0x33, 0xAC, 0x64, 0x7B, 0x19, 0xC3, 0x23, 0x35, 0x8C, 0xE1, 0x88, 0x13, 0xA8, 0x27,
+	0x8C, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x0F, 0xF5, 0xB1, 0xAC, 0x44,
+	0xF9, 0x0A, 0x97, 0x06, 0x07, 0xA1, 0x41, 0x04, 0x13, 0xC6, 0x20, 0x9D, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x78, 0xC8, 0xF6, 0x32, 0x27, 0xC4, 0x39, 0x64, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x13, 0xC0, 0xC4, 0x12,
+	0x74, 0x20, 0x82, 0x08, 0x20, 0x82, 0x75, 0x04, 0xEA, 0x09, 0xD0, 0x90, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x27, 0x42, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x7E, 0x9C, 0xBA, 0x35, 0x70, 0x26, 0xF8, 0xC4, 0xD5, 0x81, 0xAA,
+	0x36, 0xC4, 0x6F, 0x88, 0x49, 0xD0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x9F, 0x35, 0x35, 0x2C, 0x4F, 0x0A, 0x96, 0xC6,
+	0xA7, 0x81, 0xCB, 0x42, 0x43, 0x60, 0x55, 0x9D, 0x45, 0x60, 0x81, 0xE1, 0x03, 0xD0, 0x08, 0xF0,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x38, 0x67, 0xD0, 0x88, 0xF6,
+	0x32, 0x3D, 0x51, 0x6A, 0x14, 0x13, 0x88, 0xC4, 0xF0, 0x31, 0xE0, 0x0E, 0x68, 0x03, 0x9A, 0x00,
+	0xE6, 0x80, 0x39, 0xA0, 0x0F, 0x09, 0x03, 0x1E, 0x07, 0x07, 0x0A, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x5B, 0x23, 0x84, 0x52, 0xC8, 0x18, 0xF0,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x09,
+	0xC3, 0x9C, 0x27, 0xE1, 0x33, 0xC6, 0x2D, 0x2E, 0xE8, 0xE4, 0xA5, 0x6A, 0x11, 0xD5, 0x1D, 0x63,
+	0x57, 0x15, 0x60, 0x92, 0x74, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x87, 0xF0, 0xE6, 0x8C, 0xEA, 0x50, 0xF5, 0x9B,
+	0x82, 0x97, 0x17, 0x64, 0x47, 0x50, 0x47, 0x8C, 0x4E, 0x14, 0x1C, 0xAB, 0xA2, 0x57, 0x15, 0x70,
+	0x2A, 0xE8, 0x86, 0x88, 0x4E, 0x14, 0x1C, 0x89, 0xC2, 0x13, 0xA8, 0x27, 0x50, 0x75, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x3F, 0x97,
+	0x30, 0x8C, 0x5C, 0x0A, 0x1B, 0x10, 0xB5, 0x0A, 0x09, 0xE3, 0x12, 0x74, 0x24, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x47, 0xFA, 0x00
 };
 
+/* 2-bit ADPCM, SNR 10.9 dB */
 const u8 sfx_pinky_attack[] __attribute__((aligned(4))) = {
-	0x68, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x98, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x98, 0x78, 0x88,
-	0x87, 0x78, 0x88, 0x99, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x77, 0x88,
-	0x88, 0x78, 0x88, 0x89, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x88, 0x7A, 0xBB, 0xBB, 0xA9, 0x9B, 0xBA, 0x99, 0x98, 0x87, 0x75, 0x68,
-	0x86, 0x56, 0x67, 0x66, 0x64, 0x23, 0x65, 0x56, 0x65, 0x58, 0x85, 0x56, 0x88, 0x77, 0x77, 0x89,
-	0xAA, 0xAC, 0xCB, 0xAA, 0xA9, 0x9A, 0xA9, 0x99, 0xAA, 0x9A, 0x99, 0x99, 0x87, 0x89, 0x77, 0x87,
-	0x78, 0x99, 0x87, 0x66, 0x55, 0x55, 0x55, 0x56, 0x9A, 0xBA, 0x99, 0xAA, 0x98, 0x88, 0x99, 0x98,
-	0x9B, 0xCC, 0xBB, 0xCB, 0xA9, 0x87, 0x77, 0x76, 0x67, 0x87, 0x77, 0x67, 0x76, 0x67, 0x66, 0x66,
-	0x56, 0x87, 0x77, 0x87, 0x89, 0x87, 0x88, 0x77, 0x89, 0x89, 0x99, 0x99, 0xAA, 0x99, 0x99, 0xAA,
-	0x98, 0x99, 0x99, 0x99, 0x99, 0x89, 0x98, 0x88, 0x66, 0x78, 0x77, 0x78, 0x78, 0x88, 0x66, 0x77,
-	0x55, 0x64, 0x56, 0x67, 0x99, 0x9B, 0xA9, 0x98, 0x88, 0x98, 0x88, 0x9A, 0xAA, 0xAA, 0x88, 0x88,
-	0x88, 0x86, 0x67, 0x77, 0x77, 0x77, 0x78, 0x78, 0x87, 0x77, 0x67, 0x77, 0x77, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0xA9, 0x9A, 0xA8, 0x89, 0x98, 0xAB, 0xCD, 0xDB, 0x9A, 0xA8, 0x77, 0x76, 0x77, 0x77,
-	0x77, 0x56, 0x66, 0x66, 0x56, 0x67, 0x66, 0x66, 0x77, 0x78, 0x87, 0x88, 0x88, 0xA9, 0x87, 0x89,
-	0x89, 0x99, 0x9A, 0xAA, 0xBB, 0xA9, 0x88, 0x99, 0x88, 0x89, 0x99, 0x88, 0x88, 0x77, 0x77, 0x66,
-	0x56, 0x66, 0x67, 0x77, 0x77, 0x87, 0x67, 0x87, 0x89, 0x77, 0x99, 0x89, 0x98, 0x9B, 0x98, 0xA9,
-	0x88, 0x99, 0x9B, 0xA9, 0xAA, 0x99, 0x97, 0x77, 0x77, 0x78, 0x88, 0x77, 0x77, 0x67, 0x76, 0x66,
-	0x58, 0xA8, 0x77, 0x87, 0x74, 0x68, 0x68, 0x89, 0x87, 0x9A, 0xA9, 0xAB, 0xA9, 0x9A, 0xA9, 0xAB,
-	0x98, 0x68, 0x9A, 0x99, 0x88, 0xAA, 0x88, 0x75, 0x43, 0x44, 0x79, 0x67, 0x8A, 0xAA, 0xA8, 0x78,
-	0x77, 0x87, 0x89, 0x88, 0x79, 0x96, 0x65, 0x7A, 0x64, 0x56, 0x75, 0x95, 0x7E, 0xDC, 0xAA, 0xAA,
-	0xBA, 0x99, 0x89, 0x88, 0xAA, 0x86, 0x68, 0x89, 0x87, 0x55, 0x78, 0x77, 0x78, 0x87, 0xAA, 0x98,
-	0x78, 0x79, 0xB8, 0x65, 0x77, 0x45, 0x69, 0x77, 0xCB, 0xC9, 0x87, 0x79, 0x99, 0x56, 0x88, 0x99,
-	0xA8, 0x78, 0x78, 0xBD, 0xB6, 0x55, 0x79, 0x96, 0x89, 0xAB, 0xBB, 0xA9, 0x88, 0xAA, 0x88, 0x84,
-	0x58, 0x66, 0x64, 0x47, 0x78, 0x55, 0x55, 0x68, 0x98, 0x7A, 0xBB, 0x99, 0xBB, 0xAA, 0xAB, 0xBA,
-	0x99, 0x9A, 0xA8, 0x88, 0x85, 0x43, 0x36, 0x67, 0x89, 0xBB, 0x67, 0x56, 0x57, 0x8A, 0xAA, 0xCA,
-	0xAA, 0xA7, 0x69, 0x88, 0x75, 0x65, 0x66, 0x77, 0x89, 0x86, 0x67, 0x89, 0x99, 0x99, 0x89, 0x97,
-	0x77, 0x99, 0x9B, 0xBA, 0x77, 0x66, 0x56, 0x67, 0xAB, 0x99, 0xA7, 0x55, 0x67, 0x7A, 0xDC, 0xBA,
-	0x88, 0x56, 0x99, 0x76, 0x78, 0x87, 0x77, 0x67, 0x87, 0x99, 0x84, 0x58, 0x98, 0x88, 0x9A, 0xAB,
-	0xA7, 0x67, 0x8A, 0x98, 0x75, 0x77, 0x98, 0x68, 0x98, 0x88, 0xB8, 0x89, 0x8A, 0xAC, 0x86, 0x8B,
-	0xC8, 0x57, 0x69, 0xA6, 0x55, 0x76, 0x77, 0x99, 0x84, 0x27, 0x98, 0x96, 0x69, 0xBC, 0xB7, 0x79,
-	0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x89, 0xAA, 0x97, 0x77, 0x76, 0x65, 0x68, 0x9B, 0x96, 0x42,
-	0x35, 0x87, 0x69, 0xBC, 0xBB, 0xAA, 0x85, 0x69, 0xBB, 0xA8, 0x8A, 0xA9, 0x77, 0x99, 0x99, 0x87,
-	0x57, 0x87, 0x78, 0x77, 0x87, 0x77, 0x53, 0x46, 0x79, 0x89, 0xCD, 0xB9, 0x88, 0x99, 0x77, 0x9A,
-	0x97, 0x8C, 0xB8, 0x89, 0x86, 0x97, 0x53, 0x79, 0x99, 0x78, 0x85, 0x54, 0x8A, 0xAA, 0x88, 0x88,
-	0x88, 0x67, 0x79, 0x89, 0x9A, 0x96, 0x9A, 0x99, 0x9A, 0xA8, 0x87, 0x98, 0x87, 0x67, 0x98, 0xA6,
-	0x9B, 0x96, 0x6B, 0xA9, 0x65, 0x32, 0x39, 0xBA, 0x88, 0x77, 0x68, 0x99, 0xAA, 0xCB, 0x97, 0x44,
-	0x68, 0xA9, 0xBB, 0xA9, 0x87, 0x33, 0x46, 0x55, 0x89, 0x89, 0x9A, 0x86, 0x77, 0x88, 0xAA, 0x9A,
-	0xAA, 0x88, 0x9B, 0xCC, 0xA9, 0x88, 0x99, 0x86, 0x55, 0x56, 0x66, 0x56, 0x77, 0x88, 0x76, 0x77,
-	0x88, 0x88, 0x75, 0x79, 0xBC, 0xDE, 0xDB, 0x87, 0x77, 0x88, 0x78, 0x79, 0x87, 0x77, 0x89, 0xA9,
-	0x86, 0x35, 0x54, 0x46, 0xAA, 0xCC, 0xB7, 0x56, 0x77, 0x78, 0xAB, 0xBB, 0xA8, 0x67, 0x89, 0xBB,
-	0xA9, 0x88, 0x77, 0x67, 0x78, 0x98, 0x86, 0x54, 0x67, 0x64, 0x89, 0x89, 0xA9, 0x78, 0x88, 0x76,
-	0x8A, 0x88, 0xAB, 0xA9, 0xA8, 0x76, 0x77, 0x88, 0x9A, 0x87, 0x78, 0x78, 0x78, 0x87, 0x65, 0x88,
-	0x9B, 0x99, 0xAA, 0x86, 0x89, 0x86, 0x8B, 0xA8, 0x78, 0x77, 0x78, 0x76, 0x78, 0x74, 0x44, 0x54,
-	0x69, 0xDC, 0xAA, 0xBA, 0x87, 0x77, 0x78, 0xAB, 0xBA, 0x99, 0x87, 0x77, 0x98, 0x87, 0x88, 0x99,
-	0x99, 0x87, 0x88, 0x77, 0x76, 0x68, 0x9A, 0xAA, 0xA9, 0x87, 0xA9, 0x99, 0xAA, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x66, 0x66, 0x76, 0x66, 0x77, 0x77, 0x77, 0x67, 0x99, 0x86, 0x77,
-	0x76, 0x78, 0x99, 0x9A, 0xBB, 0xA8, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x86,
-	0x42, 0x35, 0x9C, 0xB9, 0x86, 0x68, 0x97, 0x59, 0xBA, 0x97, 0x78, 0x89, 0x88, 0x99, 0x87, 0x9B,
-	0xBA, 0x99, 0xAA, 0xA8, 0x78, 0x99, 0x98, 0x88, 0x98, 0x77, 0x78, 0x77, 0x67, 0x77, 0x66, 0x66,
-	0x66, 0x77, 0x88, 0x87, 0x67, 0x78, 0x89, 0xAA, 0xA9, 0x77, 0x77, 0x78, 0x88, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x7A, 0x97, 0x67, 0x99, 0xA9, 0x98, 0x65, 0x57, 0x8A, 0xAA,
-	0xCD, 0xA7, 0x77, 0x78, 0x98, 0x99, 0xA8, 0x88, 0x99, 0x87, 0x67, 0x77, 0x89, 0x99, 0x88, 0x78,
-	0x88, 0x88, 0x77, 0x76, 0x67, 0x99, 0x99, 0x87, 0x76, 0x54, 0x56, 0x67, 0x89, 0xAA, 0x98, 0x88,
-	0x77, 0x77, 0x78, 0x8A, 0xA9, 0x87, 0x88, 0x75, 0x57, 0x69, 0xA9, 0x96, 0x66, 0x79, 0x88, 0x8A,
-	0xDA, 0x77, 0x78, 0x79, 0x9A, 0xAB, 0xBB, 0xA9, 0x87, 0x78, 0x99, 0x98, 0x88, 0x89, 0x89, 0xA9,
-	0x87, 0x76, 0x54, 0x57, 0x89, 0x99, 0x87, 0x66, 0x66, 0x66, 0x66, 0x67, 0x89, 0x9A, 0x98, 0x77,
-	0x66, 0x77, 0x8A, 0xBB, 0xA9, 0x98, 0x88, 0x99, 0xA9, 0x88, 0x87, 0x67, 0x99, 0x99, 0x98, 0x76,
-	0x67, 0x87, 0x78, 0x88, 0x53, 0x02, 0x8A, 0xA9, 0xAA, 0xBA, 0x99, 0x89, 0x9A, 0xAA, 0xAA, 0xA9,
-	0x78, 0x99, 0x87, 0x89, 0x98, 0x87, 0x76, 0x55, 0x77, 0x77, 0x78, 0x98, 0x88, 0x9A, 0x98, 0x67,
-	0x76, 0x66, 0x76, 0x88, 0x77, 0x77, 0x67, 0x87, 0x89, 0x98, 0x89, 0xAA, 0xAA, 0xAA, 0xA9, 0x99,
-	0xA9, 0x98, 0x9A, 0x88, 0x87, 0x55, 0x55, 0x77, 0x78, 0xAC, 0x98, 0x76, 0x66, 0x67, 0x77, 0xAB,
-	0xCB, 0x97, 0x77, 0x88, 0x9A, 0xAA, 0x98, 0x76, 0x66, 0x67, 0x78, 0x88, 0x66, 0x87, 0x66, 0x76,
-	0x67, 0x66, 0x88, 0x9A, 0xA8, 0x88, 0x78, 0x9B, 0xBB, 0xBB, 0xA9, 0x87, 0x78, 0x89, 0x88, 0x99,
-	0x87, 0x77, 0x55, 0x67, 0x9A, 0xA9, 0x88, 0x76, 0x76, 0x78, 0x89, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x87, 0x77, 0x87, 0x78, 0x99, 0x87, 0x86, 0x78, 0x88, 0x77, 0x75, 0x76, 0x56, 0x89, 0xAB, 0xCC,
-	0xCB, 0x98, 0x77, 0x88, 0x99, 0x99, 0x87, 0x78, 0x87, 0x89, 0x99, 0x98, 0x88, 0x77, 0x66, 0x78,
-	0x99, 0x78, 0x97, 0x52, 0x24, 0x68, 0xAC, 0xCB, 0xA8, 0x76, 0x56, 0x68, 0x9A, 0xAB, 0xA9, 0x88,
-	0x88, 0x89, 0xAA, 0x98, 0x88, 0x77, 0x78, 0x99, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x78, 0x77,
-	0x67, 0x78, 0x89, 0x89, 0x99, 0x87, 0x77, 0x77, 0x79, 0x9A, 0xBA, 0x88, 0x88, 0x77, 0x9A, 0xAA,
-	0x99, 0x88, 0x88, 0x99, 0x99, 0x88, 0x87, 0x76, 0x76, 0x67, 0x78, 0x99, 0x89, 0x87, 0x76, 0x66,
-	0x67, 0x77, 0x78, 0x88, 0x89, 0x98, 0x89, 0x98, 0x78, 0x89, 0xA9, 0x9A, 0x98, 0x88, 0x88, 0x98,
-	0x89, 0xA9, 0x87, 0x55, 0x67, 0x89, 0x99, 0x99, 0x88, 0x87, 0x77, 0x88, 0x87, 0x78, 0x88, 0x99,
-	0x98, 0x87, 0x77, 0x77, 0x78, 0x88, 0x98, 0x77, 0x88, 0x88, 0x89, 0x98, 0x86, 0x7A, 0x88, 0x98,
-	0x78, 0x86, 0x77, 0x77, 0x98, 0x98, 0x89, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x99, 0x88, 0x88, 0x99,
-	0x98, 0x88, 0x76, 0x66, 0x56, 0x67, 0x88, 0x88, 0x87, 0x77, 0x77, 0x87, 0x89, 0x98, 0x99, 0x89,
-	0x98, 0x89, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x89, 0xA9, 0x9A, 0x98, 0x88, 0x87,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x87, 0x87, 0x78,
-	0x88, 0x87, 0x68, 0x86, 0x99, 0x79, 0xA8, 0x89, 0x98, 0x88, 0x88, 0x98, 0x89, 0x88, 0x98, 0x99,
-	0x99, 0x99, 0x99, 0x88, 0x87, 0x67, 0x76, 0x66, 0x77, 0x87, 0x88, 0x87, 0x77, 0x78, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x98, 0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x87, 0x78, 0x78, 0x88, 0x98, 0x98,
-	0x88, 0x88, 0x88, 0x78, 0x88, 0x78, 0x88, 0x89, 0x99, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x77, 0x89, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x98, 0x78, 0x98, 0x88, 0x99, 0x88, 0x98, 0x89, 0x88, 0x98, 0x89, 0x98, 0x88,
-	0x88, 0x87, 0x78, 0x88, 0x77, 0x77, 0x67, 0x77, 0x88, 0x88, 0x97, 0x77, 0x67, 0x77, 0x89, 0x99,
-	0xA9, 0x89, 0x99, 0x98, 0x88, 0x88, 0x98, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x78,
-	0x88, 0x98, 0x78, 0x88, 0x78, 0x98, 0x89, 0x89, 0x98, 0x78, 0xA8, 0x78, 0x88, 0x86, 0x48, 0x74,
-	0x7A, 0x99, 0xA8, 0x89, 0x87, 0x87, 0x89, 0x99, 0x99, 0x98, 0x99, 0x78, 0x88, 0x78, 0x77, 0x77,
-	0x77, 0x89, 0x98, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x78, 0x99, 0x98, 0x99, 0x98, 0x89, 0x89, 0x87, 0x99, 0x88, 0x78,
-	0x99, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x87,
-	0x77, 0x78, 0x77, 0x77, 0x77, 0x78, 0x88, 0x77, 0x88, 0x78, 0x88, 0x88, 0x78, 0x98, 0x89, 0x97,
-	0x89, 0x88, 0x99, 0x89, 0x88, 0x77, 0x89, 0x77, 0xA8, 0xA9, 0x88, 0x98, 0x58, 0x98, 0x8A, 0x99,
-	0x99, 0x79, 0x88, 0x99, 0x99, 0x98, 0x77, 0x87, 0x88, 0x88, 0x87, 0x77, 0x66, 0x67, 0x77, 0x77,
-	0x87, 0x77, 0x78, 0x77, 0x88, 0x98, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x89, 0x89,
-	0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x99, 0x98, 0x88, 0x87, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x77, 0x78, 0x88, 0x77, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x78, 0x88, 0x88, 0x89, 0x77, 0x78, 0x88, 0x76,
-	0x77, 0x87, 0x79, 0xB9, 0x89, 0xA9, 0x87, 0x78, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x77, 0x77, 0x88, 0x87, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x77, 0x78, 0x98, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x88, 0x98, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x99, 0x98, 0x99, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x89, 0x88, 0x87,
-	0x88, 0x87, 0x88, 0x87, 0x89, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x98, 0x87, 0x77, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x89, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88, 0x89, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x87, 0x78, 0x88, 0x77, 0x88, 0x77, 0x88, 0x87, 0x77, 0x88, 0x78, 0x88, 0x87, 0x78, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x78,
-	0x89, 0x88, 0x88, 0x89, 0x88, 0x99, 0x87, 0x89, 0x88, 0x88, 0x98, 0x88, 0x89, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x77, 0x98, 0x78, 0x98,
-	0x89, 0x88, 0x98, 0x77, 0x88, 0x88, 0x9A, 0x99, 0x88, 0x88, 0x88, 0x99, 0x88, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x87, 0x78, 0x88, 0x87, 0x77, 0x87, 0x88,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x78, 0x89, 0x88, 0x88, 0x88, 0x78, 0x88, 0x89, 0x89, 0x8A, 0x88, 0x89,
-	0x98, 0x98, 0x89, 0x97, 0x88, 0x88, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x87, 0x88, 0x77, 0x87, 0x78, 0x78, 0x99, 0x99, 0xA9, 0x99, 0x99, 0x98, 0x99, 0xA9, 0x99, 0x99,
-	0x99, 0x89, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x77, 0x77, 0x77, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x88, 0x88, 0x88, 0x87, 0x76, 0x67,
-	0x78, 0x88, 0x88, 0x88, 0x77, 0x78, 0x77, 0x78, 0x99, 0x88, 0x88, 0x98, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x77, 0x77, 0x88, 0x78, 0x87, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x87, 0x67, 0x89, 0x9A, 0xAA, 0xAA, 0x98, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77,
-	0x77, 0x87, 0x77, 0x77, 0x66, 0x67, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x89, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x88, 0x77, 0x77,
-	0x78, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x86, 0x65, 0x56, 0x78, 0x9A, 0xAA, 0xAA, 0x98, 0x88, 0x88, 0x89, 0x9A, 0xAA, 0x99, 0x99, 0x88,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x67, 0x78, 0x88, 0x99, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x87, 0x78, 0x78, 0x58
+	0xD9, 0x88, 0x81, 0xE2, 0xB4, 0x88, 0x88, 0x88, 0x1B, 0x28, 0xAC, 0x4A, 0xD2, 0x88, 0x87, 0xD8,
+	0xB1, 0x84, 0xEB, 0x62, 0x22, 0x2E, 0x42, 0xE4, 0x2D, 0x81, 0xC6, 0xCA, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x21, 0xB5, 0x62, 0xF1, 0x3A, 0xBB, 0xF1, 0x3C, 0x0C, 0xFC, 0x61, 0xB5, 0xB0, 0x68, 0x85,
+	0x41, 0x78, 0xB9, 0x38, 0x6D, 0xCA, 0xF1, 0xE6, 0x94, 0xFA, 0xC8, 0x85, 0x56, 0xA4, 0xF2, 0x63,
+	0x56, 0x83, 0xFA, 0x8F, 0x16, 0xAD, 0xB1, 0xE2, 0xD4, 0x87, 0x4E, 0x6C, 0x49, 0x80, 0x6E, 0x06,
+	0xF6, 0x20, 0xAD, 0xB3, 0xE4, 0xA1, 0xD3, 0xC3, 0xC3, 0x19, 0x41, 0xBA, 0x87, 0x05, 0x27, 0xE8,
+	0x8F, 0xD8, 0x88, 0x1D, 0xAA, 0xD2, 0x87, 0x4A, 0x0D, 0x61, 0xBD, 0xA5, 0x1B, 0xC3, 0xCA, 0x08,
+	0xBC, 0x2A, 0xD1, 0xC8, 0x41, 0xB4, 0xD6, 0xE4, 0xC0, 0x19, 0x6F, 0xA6, 0xC1, 0x3C, 0xAE, 0xAE,
+	0xD2, 0x12, 0x07, 0xC6, 0x4E, 0x49, 0xB5, 0xB6, 0xA6, 0x5B, 0x0C, 0xF8, 0x21, 0x2E, 0xAD, 0x39,
+	0xD6, 0xA7, 0xB4, 0x99, 0xB4, 0xA4, 0xB9, 0x31, 0xFC, 0x4A, 0xC4, 0xEF, 0xE1, 0x4C, 0x43, 0x38,
+	0xC3, 0x4C, 0xDB, 0xB5, 0xE0, 0x67, 0x5A, 0x88, 0x78, 0xCC, 0x6F, 0x90, 0xEE, 0x5A, 0x17, 0x4B,
+	0x8D, 0x7A, 0x6C, 0x49, 0x67, 0xA1, 0x3C, 0x06, 0x78, 0xD4, 0xFA, 0x5A, 0x11, 0x8F, 0x84, 0xFB,
+	0x1A, 0xF1, 0x1E, 0x25, 0x0D, 0x6C, 0x68, 0x93, 0xE1, 0xBC, 0xFE, 0x11, 0x16, 0xEC, 0x91, 0x07,
+	0x2F, 0x98, 0xF3, 0x06, 0x5B, 0x85, 0x88, 0xDF, 0x06, 0x53, 0xEA, 0x85, 0x5A, 0x7E, 0x11, 0x4B,
+	0xEC, 0x4E, 0x1A, 0x2D, 0x65, 0xF0, 0x68, 0x41, 0xFC, 0x1B, 0xB4, 0x39, 0x2D, 0x72, 0x91, 0xF1,
+	0x3C, 0x93, 0xA6, 0x64, 0xFD, 0x23, 0x10, 0xF9, 0x82, 0x0A, 0x2E, 0x15, 0xF2, 0xB3, 0x45, 0xEE,
+	0x16, 0x94, 0xAB, 0xF1, 0x6B, 0x1A, 0xC6, 0x2F, 0xC6, 0x98, 0x3B, 0xF9, 0x59, 0x4E, 0xA6, 0xE5,
+	0xB1, 0x38, 0xF6, 0xB4, 0x2D, 0xB8, 0x52, 0xE0, 0xBC, 0x59, 0x9F, 0x4A, 0x1B, 0xB6, 0xB9, 0x67,
+	0x1B, 0x1A, 0xFB, 0x52, 0xAC, 0xD0, 0x96, 0xFE, 0x46, 0x0B, 0xFC, 0x09, 0x49, 0x9F, 0x00, 0x58,
+	0x7E, 0x52, 0xEC, 0x2F, 0xE1, 0x8D, 0x04, 0xF0, 0x4B, 0xF5, 0x10, 0xFE, 0x02, 0xDD, 0xA2, 0x53,
+	0xF8, 0x35, 0x64, 0xF8, 0x09, 0x58, 0xF8, 0x14, 0xEA, 0xED, 0x97, 0x3A, 0x4B, 0x58, 0x6C, 0xAF,
+	0x5A, 0x5A, 0xBE, 0x66, 0x4E, 0x98, 0xDB, 0xC4, 0x4C, 0x3E, 0x4E, 0x5A, 0xCA, 0x1F, 0x4F, 0x83,
+	0x54, 0xA3, 0xE8, 0x54, 0xBA, 0xF9, 0x6B, 0x66, 0x2F, 0x6A, 0xB5, 0x42, 0xEF, 0x48, 0x6F, 0x82,
+	0x22, 0xB8, 0xAE, 0x07, 0x84, 0x22, 0xD4, 0xF0, 0xB4, 0x49, 0x4F, 0xC2, 0x04, 0x88, 0xAE, 0x2F,
+	0xFD, 0x4A, 0xB9, 0x79, 0x6A, 0x81, 0xC6, 0xF5, 0xA8, 0x4F, 0x84, 0xB8, 0x7C, 0x9C, 0xC2, 0xE8,
+	0x85, 0x0B, 0xD9, 0x10, 0xFC, 0xA1, 0x04, 0xB8, 0x88, 0x88, 0xAF, 0x5B, 0x90, 0x6E, 0xF1, 0x10,
+	0x5F, 0x88, 0x66, 0x78, 0x6E, 0xC1, 0x12, 0xED, 0x8A, 0xCF, 0x14, 0x2F, 0xBF, 0x10, 0x44, 0xF2,
+	0xCA, 0x51, 0x7A, 0x6F, 0x91, 0x6B, 0xA5, 0xA5, 0x7A, 0x0D, 0x19, 0x8F, 0xA9, 0x4B, 0xA5, 0xC6,
+	0xF3, 0xA5, 0x18, 0xF8, 0xA0, 0x81, 0x51, 0xEC, 0xC0, 0x54, 0xEA, 0x85, 0x3C, 0xBD, 0x08, 0xBF,
+	0x92, 0x17, 0xFC, 0x58, 0x26, 0xCC, 0x18, 0x2F, 0xC6, 0xE4, 0x3B, 0xBC, 0x48, 0x16, 0x85, 0xF8,
+	0x38, 0x74, 0xAA, 0xD6, 0x43, 0x94, 0xA2, 0xB9, 0x7A, 0x5E, 0xBC, 0x85, 0x15, 0xEA, 0x81, 0x54,
+	0x7B, 0x86, 0x42, 0xFE, 0x21, 0x17, 0xC6, 0xE6, 0x98, 0x51, 0xB8, 0xD4, 0x0B, 0xFB, 0x90, 0xC6,
+	0xF3, 0xC1, 0x5A, 0xAF, 0x34, 0x02, 0x22, 0xE8, 0xB8, 0x71, 0x6E, 0x70, 0x2E, 0xF6, 0xD1, 0x10,
+	0xEF, 0xA6, 0x4A, 0xF9, 0x34, 0x0F, 0x8F, 0xC4, 0x6C, 0x7F, 0x04, 0x5A, 0xBB, 0x85, 0x19, 0xBA,
+	0x25, 0x6E, 0xAE, 0x56, 0xAB, 0x81, 0x2A, 0xDC, 0xC1, 0x1D, 0x8F, 0x23, 0x50, 0x7C, 0xA9, 0x58,
+	0xEC, 0x84, 0x2E, 0xBE, 0x70, 0x14, 0xDE, 0x38, 0x12, 0x10, 0x1B, 0x1B, 0xD9, 0x21, 0xF8, 0x97,
+	0x13, 0xEE, 0x44, 0x2A, 0xEB, 0x84, 0xB1, 0x96, 0x3F, 0x22, 0x10, 0x7C, 0x02, 0x13, 0xF5, 0xC3,
+	0x9B, 0x09, 0x63, 0x02, 0x07, 0x8B, 0x6C, 0x84, 0xBB, 0xF2, 0xD9, 0x62, 0x3A, 0x07, 0x43, 0x69,
+	0xB1, 0xE6, 0x88, 0x8A, 0xE0, 0x56, 0x1F, 0x23, 0x00, 0x6E, 0x08, 0xAB, 0x82, 0x10, 0xAB, 0x71,
+	0x8B, 0xD3, 0x4C, 0x70, 0xB8, 0x07, 0x0C, 0x76, 0x0A, 0x2E, 0xF9, 0xB8, 0x53, 0x4B, 0xA5, 0xE4,
+	0x88, 0x87, 0x04, 0xA2, 0x2E, 0xB9, 0xD2, 0x63, 0x88, 0xAD, 0x2D, 0x81, 0x2E, 0x72, 0x22, 0x22,
+	0x22, 0x22, 0x2B, 0x4A, 0x13, 0xA2, 0xC5, 0xCA, 0xE1, 0x07, 0xD3, 0x24, 0xE6, 0x9C, 0x31, 0xB2,
+	0x2B, 0x13, 0xCA, 0xD2, 0x42, 0x7C, 0xC0, 0x50, 0x7D, 0x8B, 0x88, 0x71, 0xB2, 0x22, 0x2A, 0xD2,
+	0x22, 0x2D, 0x82, 0x22, 0x22, 0x07, 0x88, 0xAD, 0x27, 0xD8, 0xC6, 0x0D, 0xBD, 0x39, 0x8F, 0xD3,
+	0x18, 0x39, 0xB2, 0x58, 0x8F, 0x6C, 0x2D, 0xE0, 0x85, 0x38, 0xB8, 0x81, 0x21, 0xCA, 0x2B, 0x48,
+	0x87, 0x22, 0xAD, 0x4B, 0x63, 0x99, 0xE4, 0xED, 0x0E, 0x22, 0xE4, 0x2B, 0x6D, 0x28, 0x2A, 0xC7,
+	0x81, 0xE0, 0x81, 0x3C, 0x6D, 0x23, 0xD2, 0x1F, 0x1A, 0x4C, 0xBC, 0x5C, 0x76, 0xA7, 0x93, 0x1A,
+	0x2D, 0xA4, 0x8F, 0xC2, 0x48, 0xBA, 0xE1, 0x20, 0x78, 0x1C, 0x17, 0x28, 0x84, 0x22, 0x2B, 0x1D,
+	0xB2, 0x2D, 0x88, 0x4B, 0x8B, 0x70, 0x2B, 0x48, 0x72, 0xAE, 0x12, 0xC6, 0xE1, 0x08, 0xAD, 0x22,
+	0x1C, 0x88, 0x81, 0xE2, 0xD8, 0x89, 0xF1, 0x8F, 0x07, 0x46, 0xC3, 0xB0, 0x42, 0x2B, 0x88, 0x88,
+	0xBA, 0x04, 0xB7, 0x82, 0x22, 0x21, 0xC1, 0x72, 0x82, 0x12, 0xE7, 0x04, 0x8A, 0xE0, 0x4F, 0x4E,
+	0x22, 0x22, 0x2E, 0x42, 0x2B, 0x81, 0x21, 0xCB, 0x6B, 0x4B, 0x5C, 0x87, 0x22, 0x88, 0x88, 0x88,
+	0x88, 0xAC, 0x48, 0x7B, 0x24, 0x04, 0xEA, 0xB8, 0x05, 0x98, 0xAE, 0x22, 0x13, 0x78, 0x22, 0x2E,
+	0x87, 0x18, 0xE4, 0xE4, 0xB8, 0x4D, 0x8B, 0x14, 0xE8, 0x88, 0x81, 0x2E, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0xAD, 0x22, 0xDB, 0x18, 0x88, 0xAE, 0x1D, 0x0C, 0x81, 0xE4, 0xF1, 0xA0, 0x78, 0x1F, 0x02,
+	0x22, 0xD8, 0x8B, 0x63, 0x62, 0x22, 0xC6, 0xD7, 0x0C, 0x7A, 0x49, 0x1C, 0xE0, 0x84, 0xE7, 0x28,
+	0x88, 0xAE, 0x1C, 0x88, 0x87, 0x12, 0xB8, 0x74, 0x2E, 0x08, 0x87, 0x18, 0xE8, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xC0, 0x88, 0x8B, 0xA2, 0x14, 0xC8, 0xAD, 0x21, 0xD9, 0xE1,
+	0x33, 0x1B, 0x23, 0xC9, 0xC8, 0x88, 0x88, 0x88, 0x76, 0x87, 0x99, 0x60, 0x72, 0x2B, 0x47, 0x82,
+	0x2D, 0xE0, 0xAE, 0x22, 0x22, 0x06, 0xE2, 0x07, 0x60, 0x88, 0x88, 0x88, 0x8B, 0x84, 0x88, 0x88,
+	0x84, 0xB1, 0x28, 0x88, 0xB7, 0x82, 0x2B, 0xB9, 0x40, 0x8A, 0xE1, 0xC1, 0x4E, 0x87, 0x1B, 0x22,
+	0x2D, 0x8A, 0xE0, 0x6D, 0x36, 0xD8, 0x88, 0x8B, 0x78, 0x51, 0x83, 0xF2, 0x81, 0x08, 0xAE, 0xB8,
+	0x87, 0x2A, 0xE1, 0x04, 0x22, 0x22, 0xE4, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0xBA, 0x12, 0xE2,
+	0x22, 0x22, 0x2B, 0x48, 0x8B, 0x61, 0xCA, 0xE2, 0x10, 0x81, 0xE2, 0x22, 0x2B, 0x4B, 0x90, 0x88,
+	0xFE, 0x95, 0x18, 0xAF, 0xA0, 0x11, 0x2E, 0xAE, 0xE2, 0x22, 0x22, 0x22, 0x20, 0x48, 0x88, 0x88,
+	0x88, 0x13, 0xC8, 0x88, 0x8B, 0xAC, 0x52, 0x42, 0xE2, 0x22, 0x10, 0x88, 0xAB, 0x8B, 0x9D, 0xD0
 };
 
+/* 2-bit ADPCM, SNR 10.5 dB */
 const u8 sfx_pinky_death[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x66, 0x98, 0x77, 0x88, 0xAA, 0x78,
-	0x87, 0x99, 0x88, 0x76, 0x78, 0x9A, 0x87, 0x78, 0x99, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x89,
-	0x98, 0x76, 0x88, 0x75, 0x7A, 0xCB, 0x97, 0x78, 0x87, 0x66, 0x78, 0x9A, 0x99, 0x99, 0x87, 0x77,
-	0x78, 0x87, 0x78, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x97, 0x98, 0x37, 0x97, 0xAC, 0x87, 0x87, 0x87, 0xBA, 0x98,
-	0x66, 0x79, 0xA9, 0x77, 0x77, 0x97, 0x98, 0x79, 0x88, 0x87, 0x88, 0x88, 0x97, 0x88, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x9A, 0x86, 0x44, 0x8B, 0xDB, 0x75, 0x69, 0xBA, 0x64, 0x47, 0xBC,
-	0xA7, 0x77, 0x99, 0x76, 0x57, 0x99, 0x97, 0x78, 0x99, 0x87, 0x67, 0x9A, 0x98, 0x78, 0x9A, 0xA8,
-	0x76, 0x79, 0xA9, 0x88, 0x88, 0x98, 0x87, 0x78, 0x88, 0x87, 0x77, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0xAA, 0x64, 0x68, 0x69, 0xD8, 0x7A, 0xA7, 0xAA, 0x75, 0x69, 0x99, 0x97,
-	0x57, 0x9A, 0x98, 0x77, 0x79, 0x98, 0x77, 0x77, 0x89, 0x88, 0x87, 0x88, 0x89, 0x88, 0x88, 0x99,
-	0x89, 0x98, 0x88, 0x88, 0x89, 0x56, 0x7A, 0xDC, 0xB5, 0x44, 0x8A, 0xA8, 0x54, 0x6A, 0xDC, 0x95,
-	0x34, 0x8A, 0xA8, 0x65, 0x7A, 0xBB, 0x86, 0x56, 0x8A, 0xA8, 0x76, 0x79, 0xAA, 0x98, 0x77, 0x89,
-	0xA9, 0x87, 0x78, 0x99, 0x98, 0x77, 0x88, 0x98, 0x87, 0x77, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x9B, 0x64, 0x77, 0x8C, 0xA8,
-	0x97, 0x8A, 0x87, 0x79, 0x9B, 0x86, 0x66, 0x78, 0x99, 0x87, 0x77, 0x78, 0x98, 0x76, 0x78, 0x89,
-	0x99, 0x87, 0x78, 0x89, 0x99, 0x88, 0x88, 0x98, 0x76, 0x79, 0x88, 0x78, 0xAC, 0xC9, 0x64, 0x57,
-	0xAA, 0x86, 0x57, 0xAC, 0xB9, 0x54, 0x47, 0xAB, 0x97, 0x67, 0x9B, 0xB9, 0x65, 0x57, 0x9A, 0x98,
-	0x77, 0x89, 0xA9, 0x87, 0x78, 0x99, 0x99, 0x87, 0x78, 0x99, 0x98, 0x77, 0x88, 0x99, 0x88, 0x77,
-	0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x99, 0x69, 0x96, 0x88, 0x78, 0xBA, 0xA8, 0x67, 0x78, 0x99, 0x88, 0x66, 0x79,
-	0x99, 0x87, 0x67, 0x89, 0x98, 0x88, 0x77, 0x99, 0x99, 0x88, 0x88, 0x89, 0x99, 0x76, 0x65, 0x79,
-	0xCD, 0xA8, 0x56, 0x8A, 0xA7, 0x53, 0x59, 0xDD, 0xB7, 0x44, 0x69, 0x99, 0x65, 0x69, 0xBB, 0xA7,
-	0x65, 0x79, 0x99, 0x76, 0x78, 0x9A, 0x98, 0x77, 0x89, 0x99, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x97, 0x67, 0x86, 0x89, 0x99, 0xBA, 0x86, 0x77,
-	0x89, 0xA8, 0x76, 0x67, 0x8A, 0x98, 0x77, 0x67, 0x89, 0x98, 0x67, 0x79, 0x99, 0x88, 0x88, 0x89,
-	0x96, 0x73, 0x57, 0xAF, 0xDC, 0x54, 0x59, 0xDB, 0x83, 0x35, 0x9E, 0xEB, 0x62, 0x37, 0xAB, 0x96,
-	0x45, 0x8B, 0xB9, 0x65, 0x58, 0xAA, 0x97, 0x66, 0x8A, 0xBA, 0x87, 0x78, 0x9A, 0x98, 0x77, 0x88,
-	0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x9A, 0x65,
-	0x76, 0x7C, 0x98, 0xA8, 0x89, 0x87, 0x98, 0x7A, 0x87, 0x88, 0x78, 0x99, 0x88, 0x78, 0x88, 0x88,
-	0x87, 0x77, 0x89, 0x98, 0x88, 0x89, 0x98, 0x65, 0x47, 0xAC, 0xEB, 0x86, 0x67, 0xAA, 0x96, 0x45,
-	0x7A, 0xDC, 0x96, 0x44, 0x79, 0xA8, 0x66, 0x68, 0x9A, 0x97, 0x66, 0x79, 0xA9, 0x87, 0x77, 0x9A,
-	0xA9, 0x87, 0x78, 0x99, 0x98, 0x77, 0x88, 0x99, 0x87, 0x77, 0x78, 0x88, 0x87, 0x77, 0x88, 0x88,
-	0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x57, 0x88, 0x89, 0x76,
-	0xAA, 0x9A, 0x77, 0x78, 0x88, 0x97, 0x77, 0x68, 0x8A, 0x98, 0x77, 0x88, 0x99, 0x88, 0x77, 0x88,
-	0x99, 0x99, 0x74, 0x43, 0x9A, 0xFD, 0xA7, 0x46, 0x7C, 0xA8, 0x43, 0x58, 0xDE, 0xD8, 0x43, 0x48,
-	0xAA, 0x96, 0x56, 0x8A, 0xBA, 0x85, 0x56, 0x9A, 0xA9, 0x76, 0x79, 0xAB, 0xA8, 0x76, 0x79, 0xAA,
-	0x97, 0x66, 0x89, 0xA9, 0x87, 0x67, 0x89, 0x98, 0x77, 0x67, 0x89, 0x98, 0x87, 0x78, 0x99, 0x98,
-	0x77, 0x78, 0x99, 0x88, 0x88, 0x88, 0x98, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x97, 0x67, 0x76, 0xBA, 0x7A, 0x97, 0x98, 0x78,
-	0x98, 0x88, 0x77, 0x87, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x99, 0x99, 0x96, 0x54,
-	0x48, 0xAE, 0xEB, 0x85, 0x67, 0xAA, 0x86, 0x45, 0x7B, 0xDD, 0xA6, 0x43, 0x68, 0xAA, 0x86, 0x67,
-	0x8A, 0xA9, 0x76, 0x67, 0x9A, 0xA9, 0x87, 0x78, 0xAA, 0x98, 0x76, 0x78, 0x9A, 0x98, 0x77, 0x89,
-	0x99, 0x87, 0x77, 0x88, 0x98, 0x87, 0x77, 0x89, 0x99, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x66, 0x98, 0x79, 0x87, 0xAA, 0x8A, 0x86, 0x87, 0x89, 0x97, 0x78, 0x78, 0x89, 0x99, 0x87,
-	0x88, 0x98, 0x88, 0x87, 0x88, 0x89, 0x99, 0x87, 0x55, 0x57, 0xAC, 0xDB, 0xA7, 0x77, 0x89, 0x77,
-	0x55, 0x7A, 0xCC, 0xA7, 0x65, 0x68, 0x9A, 0x87, 0x67, 0x89, 0x99, 0x76, 0x67, 0x89, 0xA9, 0x87,
-	0x78, 0x9A, 0x98, 0x77, 0x78, 0x99, 0x98, 0x87, 0x88, 0x99, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xA7,
-	0x67, 0x88, 0xA8, 0x68, 0x88, 0x99, 0x88, 0x87, 0x78, 0x77, 0x77, 0x88, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x97, 0x66, 0x67, 0x8A, 0xAB, 0xA9, 0x87, 0x77, 0x77,
-	0x77, 0x79, 0xAB, 0xB9, 0x75, 0x55, 0x78, 0x98, 0x88, 0x89, 0x99, 0x98, 0x77, 0x78, 0x99, 0x98,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x78, 0x98, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x76, 0x66,
-	0x89, 0xBB, 0xB9, 0x76, 0x66, 0x77, 0x77, 0x78, 0x9A, 0xBA, 0x87, 0x55, 0x68, 0x99, 0x98, 0x87,
-	0x88, 0x99, 0x88, 0x88, 0x77, 0x78, 0x78, 0x78, 0x87, 0x66, 0x7A, 0xAA, 0x98, 0x89, 0x89, 0x88,
-	0x88, 0x77, 0x89, 0x99, 0x88, 0x88, 0x87, 0x77, 0x89, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xA7, 0x35, 0xA9, 0x7A, 0xB7, 0x8A, 0x97, 0x67, 0x7A, 0xE8,
-	0x55, 0x59, 0xA9, 0x78, 0x78, 0x98, 0x88, 0x98, 0x67, 0x89, 0x87, 0x78, 0x99, 0x98, 0x78, 0x89,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x34, 0x8C, 0xC9, 0x77, 0x88, 0x76,
-	0x68, 0x99, 0x65, 0x8B, 0xC9, 0x76, 0x89, 0x97, 0x67, 0x9A, 0x97, 0x78, 0x98, 0x77, 0x89, 0x98,
-	0x87, 0x89, 0x98, 0x88, 0x89, 0x88, 0x88, 0x99, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x75, 0xAA, 0x66, 0x98, 0x9A,
-	0x97, 0x77, 0x88, 0xA9, 0x77, 0x76, 0x7A, 0xA8, 0x87, 0x78, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x79,
-	0x63, 0x7A, 0xDB, 0x86, 0x78, 0x98, 0x76, 0x79, 0x98, 0x78, 0xAB, 0x96, 0x67, 0x89, 0x87, 0x78,
-	0x99, 0x87, 0x78, 0x99, 0x87, 0x78, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x97, 0x79, 0xA7, 0x67, 0x88, 0xA9, 0x98, 0x88, 0x78, 0x99, 0x87, 0x66, 0x89, 0x99, 0x88,
-	0x88, 0x88, 0x98, 0x77, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x78, 0xAA, 0xB9, 0x76, 0x68, 0x98, 0x76, 0x78,
-	0x99, 0x88, 0x89, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x89, 0x98, 0x87, 0x88, 0x98, 0x78, 0x88, 0x88, 0x88, 0x99, 0x98, 0x78, 0x89, 0x98, 0x87,
-	0x77, 0x88, 0x99, 0x88, 0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x84, 0x67, 0xAD, 0xB9, 0x65, 0x79, 0xA9, 0x65,
-	0x68, 0xAA, 0xA8, 0x77, 0x78, 0x87, 0x76, 0x79, 0x9A, 0x98, 0x78, 0x99, 0x98, 0x77, 0x88, 0x99,
-	0x88, 0x78, 0x99, 0x98, 0x77, 0x88, 0x98, 0x87, 0x78, 0x89, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x98, 0x67, 0x99, 0x76, 0x77, 0x8A, 0xA9,
-	0x88, 0x78, 0x88, 0x99, 0x87, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x46, 0x9A, 0xEB, 0x97, 0x46,
-	0x79, 0xB8, 0x75, 0x68, 0xAC, 0xA8, 0x65, 0x68, 0x99, 0x87, 0x66, 0x8A, 0xA9, 0x87, 0x77, 0x89,
-	0x99, 0x87, 0x78, 0x99, 0x99, 0x87, 0x78, 0x89, 0x98, 0x87, 0x78, 0x89, 0x98, 0x87, 0x78, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x78, 0x88, 0x98, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x77, 0x78, 0x89, 0x98, 0x87, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x77, 0x86, 0x69, 0x8B, 0xCA,
-	0x96, 0x66, 0x79, 0x98, 0x76, 0x68, 0xAB, 0xB9, 0x75, 0x56, 0x89, 0x99, 0x87, 0x78, 0x89, 0x98,
-	0x87, 0x78, 0x89, 0x99, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x98, 0x77, 0x65, 0x88, 0xAC, 0xA9, 0x76, 0x67, 0x99, 0x88, 0x77, 0x89, 0xAA,
-	0x98, 0x66, 0x67, 0x89, 0x99, 0x87, 0x78, 0x89, 0x98, 0x87, 0x77, 0x89, 0x99, 0x88, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x67, 0x89, 0xAA, 0x98, 0x76, 0x78, 0x89, 0x88, 0x78, 0x89, 0x99, 0x87, 0x77, 0x78, 0x89, 0x98,
-	0x88, 0x88, 0x89, 0x88, 0x87, 0x78, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x89, 0x99, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x76, 0x66, 0x67,
-	0x78, 0x9A, 0xBB, 0xCC, 0xCC, 0xCB, 0xA9, 0x87, 0x76, 0x55, 0x44, 0x44, 0x44, 0x55, 0x66, 0x77,
-	0x78, 0x99, 0xAA, 0xBB, 0xBB, 0xBB, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x88, 0x77, 0x65, 0x55, 0x44, 0x44, 0x44, 0x45, 0x55, 0x66, 0x78, 0x99, 0xAA, 0xBB, 0xCC, 0xBB,
-	0xBB, 0xAA, 0xA9, 0x99, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x9A, 0xAA, 0xA9, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77,
-	0x78, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x66, 0x66, 0x66, 0x65,
-	0x66, 0x67, 0x77, 0x88, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x88, 0x87, 0x77, 0x77, 0x67,
-	0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0xAA, 0xAA, 0xA9, 0x99, 0x88, 0x77, 0x66, 0x67, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x9A, 0xA9, 0x99, 0x99, 0x98,
-	0x99, 0x8A, 0xAA, 0x98, 0x86, 0x54, 0x43, 0x33, 0x46, 0x78, 0xAE, 0xFF, 0xED, 0xCB, 0x98, 0x76,
-	0x65, 0x43, 0x22, 0x34, 0x56, 0x66, 0x88, 0x9A, 0xBC, 0xEE, 0xCA, 0x99, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0xAA, 0x98, 0x87, 0x66, 0x55, 0x55, 0x55, 0x55, 0x66, 0x65,
-	0x55, 0x66, 0x77, 0x9A, 0xBC, 0xCC, 0xBC, 0xCC, 0xCB, 0xBA, 0xAA, 0x99, 0x99, 0x98, 0x87, 0x65,
-	0x44, 0x44, 0x55, 0x56, 0x78, 0x99, 0x99, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98,
-	0x87, 0x77, 0x77, 0x66, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCB, 0xBA, 0xAA, 0xA9, 0x98,
-	0x87, 0x76, 0x66, 0x55, 0x66, 0x67, 0x77, 0x77, 0x88, 0x77, 0x77, 0x77, 0x78, 0x89, 0x99, 0xAA,
-	0xAA, 0xAB, 0xBB, 0xAA, 0xA9, 0x87, 0x77, 0x66, 0x65, 0x55, 0x56, 0x67, 0x78, 0x89, 0x99, 0x99,
-	0xAA, 0xA9, 0x99, 0x87, 0x88, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x78, 0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x88, 0x77, 0x66, 0x66, 0x66, 0x55, 0x66, 0x67, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x89, 0x99, 0x99, 0x99, 0xAA, 0x9A, 0x99, 0x98, 0x77, 0x76, 0x66, 0x65, 0x55, 0x66, 0x66, 0x77,
-	0x67, 0x78, 0x88, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x99, 0x99, 0xAA, 0xAA, 0xAA,
-	0xA9, 0x99, 0x99, 0x99, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x67, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x89, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	0xA9, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x76, 0x89, 0x99, 0x89, 0x99, 0x88, 0x88, 0x99,
-	0x98, 0x77, 0x78, 0x87, 0x77, 0x77, 0x88, 0x87, 0x77, 0x77, 0x77, 0x78, 0x89, 0x9A, 0xAA, 0xAA,
-	0x98, 0x88, 0x89, 0x99, 0x99, 0x87, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x78, 0x89, 0x99,
-	0x99, 0x98, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x99, 0x89, 0x99, 0x88, 0x88, 0x77, 0x77, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x89, 0x99, 0x88, 0x88, 0x89, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x99, 0x98, 0x88, 0x77, 0x78, 0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x99, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x97, 0x87, 0x78, 0x88, 0x77, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x99, 0x99, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x38
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x07, 0xE4, 0xC1, 0x6E, 0x76, 0x8E, 0x44, 0xF0, 0x6C, 0x88, 0x1E, 0x21,
+	0x7E, 0x4F, 0x46, 0xB8, 0x3A, 0x54, 0xC8, 0xF8, 0x1B, 0x12, 0xB8, 0x42, 0x06, 0xE2, 0x22, 0x13,
+	0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x07, 0x77, 0x86, 0x5E, 0x26, 0x4E,
+	0xC1, 0x2E, 0x97, 0x6D, 0x8B, 0x03, 0x70, 0x88, 0x72, 0x88, 0x95, 0xFC, 0x46, 0xF1, 0x2F, 0x04,
+	0xB8, 0x6E, 0xD0, 0xB9, 0x6B, 0x94, 0xBC, 0x5B, 0xA4, 0x6C, 0x87, 0xA1, 0x2B, 0x84, 0xAD, 0x22,
+	0x20, 0x6C, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x7F, 0x19, 0x79, 0x32, 0xB1, 0x2B,
+	0xD0, 0xBA, 0x53, 0xC8, 0x5C, 0xB6, 0x1C, 0x86, 0x9B, 0x82, 0x7F, 0x52, 0xF8, 0x5A, 0xE5, 0x6E,
+	0xC4, 0xAE, 0x52, 0xEC, 0x43, 0xB1, 0x6A, 0xC4, 0x7A, 0x94, 0xBE, 0x47, 0x32, 0x60, 0xB8, 0x4A,
+	0xE1, 0x08, 0xB6, 0x22, 0x20, 0x4F, 0xF6, 0x5A, 0xB4, 0xE1, 0x1F, 0x81, 0x0F, 0x21, 0x6F, 0x10,
+	0xAF, 0x91, 0x2E, 0x87, 0xE5, 0xAD, 0x5B, 0xB0, 0x4E, 0xD1, 0xBB, 0x10, 0xE9, 0x13, 0xF0, 0x4B,
+	0x84, 0x6F, 0x06, 0x2F, 0x94, 0xBE, 0x46, 0xCE, 0x48, 0xB9, 0x08, 0xB9, 0x08, 0xAD, 0x22, 0x22,
+	0x1C, 0x87, 0xDB, 0x69, 0x63, 0xC9, 0x2B, 0xE5, 0x2E, 0xC5, 0xA2, 0xC5, 0x2E, 0x81, 0x7E, 0xB5,
+	0x4E, 0xC1, 0xBE, 0x50, 0xF8, 0x12, 0xF1, 0x6B, 0xA5, 0x2E, 0x11, 0xBC, 0x12, 0xE8, 0x13, 0xA2,
+	0x1C, 0xA2, 0x22, 0x2D, 0x82, 0x22, 0x22, 0xB4, 0xA2, 0x22, 0x22, 0x1D, 0xBC, 0x71, 0x26, 0xF2,
+	0x43, 0xE9, 0x5B, 0x88, 0x53, 0xC1, 0x2E, 0x21, 0xFF, 0x15, 0x3E, 0x16, 0xE0, 0x53, 0xE0, 0x4B,
+	0xC4, 0x3E, 0x16, 0xAC, 0x53, 0xA9, 0x4E, 0xA4, 0x8B, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0xB9, 0x08, 0x89, 0x7F, 0x61, 0xA6, 0x9B, 0x6D, 0xA0, 0xD0, 0xED, 0x88,
+	0xB8, 0x53, 0x81, 0x7F, 0x95, 0x3A, 0x84, 0xF8, 0x56, 0xEC, 0x43, 0xC9, 0x1B, 0xA5, 0x3A, 0x94,
+	0x3B, 0x96, 0x3C, 0x06, 0xF2, 0x12, 0xB8, 0x42, 0xB4, 0x9C, 0x88, 0x1B, 0x28, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xC0, 0x9F, 0x58, 0xE9, 0x87, 0xAD, 0x4B, 0xA4, 0x4E, 0xE4,
+	0x4B, 0xFF, 0x56, 0xB8, 0x5B, 0xA4, 0x5B, 0xB1, 0x2B, 0x85, 0x2F, 0x85, 0x3B, 0x11, 0xBB, 0x10,
+	0xF8, 0x46, 0xEC, 0x43, 0xCC, 0x43, 0xB1, 0x0B, 0xE1, 0x4E, 0x20, 0x7A, 0xD2, 0x08, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x81, 0xFC, 0x74, 0xC3, 0x29, 0x32, 0xE6, 0x16, 0xC8, 0x8A, 0xC4, 0x4A, 0xFF,
+	0x15, 0x3E, 0x04, 0xEC, 0x52, 0xFA, 0x52, 0xB9, 0x13, 0xE9, 0x43, 0xB9, 0x4E, 0xA4, 0x4E, 0xC1,
+	0x2F, 0x84, 0x6F, 0x35, 0x8E, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x7C, 0x6D, 0x34, 0xCE, 0x61, 0xB9, 0x81, 0xAF, 0x66, 0x8F, 0x49, 0x2F, 0xF1, 0x53, 0xB2, 0x1C,
+	0xE5, 0x0F, 0xA4, 0x1E, 0x85, 0xAF, 0x05, 0x2F, 0x04, 0xEE, 0x14, 0xBB, 0x42, 0xEE, 0x40, 0xAE,
+	0x40, 0x88, 0x88, 0x88, 0x72, 0x88, 0x88, 0x97, 0xC6, 0x78, 0x04, 0xEB, 0x9C, 0x85, 0x6C, 0xA2,
+	0x22, 0x22, 0x20, 0x5F, 0xA1, 0x50, 0xEF, 0x22, 0x25, 0x53, 0xF2, 0x42, 0xA1, 0x0F, 0xC9, 0x4B,
+	0x88, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x8B, 0x17, 0x29, 0x78, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0xF9,
+	0x56, 0x3E, 0x86, 0x25, 0x47, 0xBC, 0x10, 0xBB, 0x64, 0xE2, 0xE1, 0xD9, 0xBB, 0x50, 0xE9, 0x8C,
+	0xAC, 0x52, 0xE8, 0xB8, 0x5C, 0xE4, 0x88, 0x8B, 0x60, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x8D, 0xFD, 0x68, 0x70, 0xBC, 0x47, 0xC9, 0x2C, 0x93, 0x27, 0x84, 0xE9, 0x4B, 0xC1,
+	0x2E, 0x22, 0x22, 0x22, 0x2F, 0xD5, 0xAE, 0x0F, 0x16, 0xE5, 0x3A, 0x1B, 0x94, 0xE9, 0x2E, 0x5A,
+	0xB4, 0x3A, 0x5C, 0x86, 0xF0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x9F, 0x5E, 0x61,
+	0xB8, 0x16, 0xEB, 0x53, 0xA1, 0x0E, 0x22, 0x22, 0x22, 0x22, 0x07, 0x82, 0x22, 0x22, 0x22, 0x9D,
+	0xF4, 0x6E, 0x03, 0xB4, 0x39, 0x4F, 0x84, 0xE1, 0x2F, 0x10, 0xF9, 0x28, 0x06, 0xE2, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x2D, 0x82, 0x22, 0x22, 0x37, 0x17, 0xC0, 0x6B, 0x2D, 0x0F, 0xC4, 0x2C,
+	0xA0, 0x7C, 0x07, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB9, 0xD4, 0x7E, 0x12, 0xE1,
+	0x68, 0x9E, 0xC1, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A,
+	0xD1, 0xAF, 0x43, 0xC0, 0x88, 0x4B, 0xC1, 0x3E, 0x84, 0x4E, 0xF5, 0xA2, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x8B, 0xF1, 0x53, 0xE1, 0x2F, 0x10, 0xBC, 0x9A, 0xB5, 0x1B, 0x84, 0xBE, 0x44,
+	0xED, 0x0E, 0xE4, 0x73, 0x90, 0xEC, 0x48, 0x88, 0x1E, 0x22, 0x20, 0x78, 0x87, 0xC4, 0xF0, 0x5A,
+	0xCC, 0x06, 0xF9, 0x4B, 0x8A, 0x22, 0xB4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xFD, 0x46, 0xF8,
+	0x47, 0xA1, 0x5B, 0xA1, 0x0F, 0x85, 0x2F, 0x25, 0x8F, 0x04, 0xAF, 0x91, 0xBB, 0x11, 0xBB, 0x12,
+	0x8B, 0x60, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAB, 0x10, 0x78, 0x88, 0x4E, 0xAE, 0x15, 0xB3, 0x84,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x7E, 0x71, 0x13, 0xBA, 0x53, 0xB1, 0x4B, 0xE9, 0x48, 0xF0, 0x1B,
+	0xB1, 0x1A, 0xCA, 0x13, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0xB1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x1B, 0xEF, 0x51, 0xBB, 0x04, 0xE8, 0x56, 0xBE, 0x11, 0x8F, 0x01, 0x3E, 0x85, 0x2E, 0x08,
+	0x72, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 0xD4, 0x4F, 0xA4, 0x1E, 0x91, 0x3B, 0xA1, 0x5B,
+	0x28, 0x1E, 0x39, 0x07, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x2A, 0xE4, 0x52, 0xFC, 0x60, 0xA2, 0x06, 0xCF, 0x12, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xAB, 0x81, 0x45, 0x64, 0xAB, 0xFE, 0xBA, 0xCA, 0x04, 0x50,
+	0x56, 0x46, 0x22, 0xE2, 0xAE, 0x08, 0x88, 0x8A, 0xEF, 0xEA, 0xE0, 0x81, 0x94, 0x50, 0x44, 0x4E,
+	0x3C, 0xBA, 0xAE, 0x2E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x08, 0x41, 0x2B, 0x8B, 0x88, 0xAE,
+	0x10, 0x84, 0x22, 0x22, 0xAC, 0xF8, 0xE8, 0x8B, 0x61, 0x05, 0x64, 0xA0, 0xAB, 0x3E, 0x3A, 0x2D,
+	0x88, 0x84, 0x21, 0x04, 0x2B, 0xAE, 0xFA, 0x10, 0x88, 0x4A, 0xE0, 0x88, 0x41, 0x01, 0xB8, 0x8B,
+	0x4D, 0x2F, 0xBE, 0xB3, 0x51, 0x14, 0xBA, 0xEE, 0xBB, 0xC1, 0x49, 0x64, 0x44, 0xFA, 0x2E, 0x22,
+	0x22, 0x20, 0x48, 0x6F, 0xBE, 0xA8, 0x88, 0x4B, 0x85, 0x15, 0x18, 0xD8, 0xBB, 0xAC, 0xAB, 0xBF,
+	0xE0, 0x41, 0x56, 0x2B, 0x48, 0xB4, 0xA2, 0x2B, 0xBA, 0x2F, 0xC4, 0x05, 0x64, 0x66, 0xB8, 0xFB,
+	0xAF, 0x8E, 0x41, 0x08, 0x4E, 0x88, 0x11, 0x04, 0x21, 0x2E, 0xBF, 0xAC, 0xBA, 0x11, 0x59, 0x29,
+	0x63, 0xCF, 0x03, 0xCA, 0x21, 0x08, 0x88, 0xBA, 0x10, 0x81, 0x22, 0xE8, 0x88, 0x12, 0x22, 0x22,
+	0xFC, 0xE0, 0xAC, 0x65, 0x40, 0x88, 0x88, 0xAE, 0x10, 0x88, 0x4D, 0xE3, 0xE3, 0x8F, 0x04, 0x86,
+	0xD1, 0x20, 0x48, 0x8B, 0xA2, 0x04, 0x84, 0x22, 0xB8, 0x8A, 0xEE, 0x88, 0x88, 0x88, 0xB9, 0x08,
+	0x84, 0x2E, 0x88, 0x88, 0x14, 0x42, 0x22, 0x22, 0xBB, 0xA2, 0xAE, 0x0A, 0x75, 0x8D, 0x8E, 0x04,
+	0xFC, 0x93, 0x88, 0x4B, 0xA2, 0x21, 0x59, 0x23, 0xF2, 0x12, 0xAF, 0xA0, 0xAB, 0x48, 0x81, 0x10,
+	0x8B, 0x92, 0xE2, 0x22, 0xB8, 0x88, 0x12, 0x22, 0x10, 0xBA, 0x22, 0x06, 0xD2, 0xEA, 0xE0, 0x4B,
+	0x88, 0x88, 0x41, 0x2B, 0x82, 0x20, 0x6E, 0x22, 0x22, 0xE8, 0x84, 0x20, 0x6D, 0x2E, 0x21, 0xE3,
+	0xA2, 0x04, 0x88, 0x88, 0x12, 0xB8, 0x88, 0x88, 0x42, 0xBA, 0xE1, 0x0B, 0xA0, 0x48, 0x88, 0x88,
+	0x88, 0x12, 0x2E, 0x8A, 0xE2, 0x1D, 0x28, 0x88, 0x88, 0x81, 0xE2, 0xE2, 0x21, 0x01, 0x22, 0x2B,
+	0x88, 0x8A, 0xB4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x60, 0x4B, 0x6C, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x13, 0xC8, 0x88, 0x88,
+	0x88, 0xAC, 0x4A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x73, 0x92, 0xE1, 0xC4, 0xA2, 0x22, 0x10, 0xAC, 0x4A, 0xE2, 0x22, 0xB9, 0x02, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xE2, 0x04, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2F, 0xD0
 };
 
+/* 2-bit ADPCM, SNR 13.0 dB */
 const u8 sfx_pinky_sight[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x89, 0x88, 0x77, 0x77, 0x67,
-	0x88, 0x89, 0x98, 0x77, 0x77, 0x78, 0x99, 0x87, 0x77, 0x89, 0x98, 0x99, 0x9A, 0xAA, 0x75, 0x7A,
-	0xB7, 0x58, 0xA8, 0x79, 0xBA, 0x88, 0xAA, 0x87, 0x77, 0x88, 0x98, 0x87, 0x67, 0x77, 0x77, 0x78,
-	0x88, 0x76, 0x66, 0x66, 0x79, 0xAA, 0xBB, 0xCB, 0xA9, 0x99, 0x88, 0x89, 0x98, 0x75, 0x44, 0x32,
-	0x34, 0x67, 0x77, 0x88, 0x88, 0x99, 0xAC, 0xDE, 0xDC, 0xCC, 0xDB, 0xB9, 0x78, 0x9A, 0x87, 0x8A,
-	0x97, 0x76, 0x54, 0x34, 0x55, 0x56, 0x66, 0x65, 0x56, 0x77, 0x89, 0xBC, 0xCA, 0xBB, 0xBB, 0xA9,
-	0xA9, 0x89, 0x87, 0x63, 0x44, 0x55, 0x67, 0x66, 0x77, 0x88, 0x88, 0x99, 0xAC, 0xCB, 0xAB, 0xAB,
-	0x99, 0xBA, 0x98, 0xAB, 0x67, 0x99, 0x67, 0x88, 0x86, 0x67, 0x76, 0x78, 0x88, 0x99, 0x86, 0x79,
-	0x87, 0x88, 0x97, 0x67, 0x75, 0x46, 0x78, 0x89, 0xAB, 0xA9, 0x99, 0x89, 0x99, 0x88, 0x87, 0x55,
-	0x55, 0x55, 0x67, 0x98, 0x88, 0x89, 0x9A, 0x99, 0xAB, 0xCB, 0xBB, 0xBD, 0x9B, 0xB8, 0xB8, 0x68,
-	0x56, 0x65, 0x55, 0x66, 0x67, 0x66, 0x66, 0x77, 0x88, 0xAA, 0x9A, 0xAA, 0xA9, 0x98, 0x89, 0x88,
-	0x87, 0x65, 0x56, 0x65, 0x56, 0x67, 0x89, 0x99, 0x89, 0xAA, 0xAA, 0xAA, 0x98, 0x87, 0x76, 0x77,
-	0x77, 0x78, 0x99, 0x89, 0xBB, 0xBA, 0xAB, 0xBB, 0x99, 0x8A, 0x97, 0x97, 0x67, 0x67, 0x65, 0x55,
-	0x66, 0x76, 0x66, 0x78, 0x99, 0xAA, 0xAB, 0xAA, 0xA9, 0x87, 0x78, 0x78, 0x77, 0x66, 0x66, 0x66,
-	0x77, 0x78, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0x99, 0x98, 0x87, 0x77, 0x76, 0x66, 0x55, 0x55,
-	0x56, 0x66, 0x77, 0x78, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0x98, 0x88, 0x88, 0x77, 0x77, 0x77,
-	0x87, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x98, 0x88, 0x78, 0x99, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x66, 0x77, 0x77, 0x77, 0x78, 0x88, 0x77, 0x88, 0x99,
-	0x99, 0x99, 0x88, 0x87, 0x89, 0x99, 0x98, 0x87, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x67, 0x78,
-	0x88, 0x77, 0x78, 0x88, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x87, 0x78, 0x88, 0x77, 0x88,
-	0x98, 0x87, 0x77, 0x8A, 0xAA, 0x99, 0x88, 0x99, 0x88, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88,
-	0x77, 0x77, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x87, 0x76, 0x67, 0x76, 0x67, 0x77,
-	0x78, 0x87, 0x78, 0x88, 0xAA, 0xA9, 0x99, 0xAD, 0xDC, 0xB9, 0x78, 0xBB, 0xA8, 0x77, 0x78, 0x86,
-	0x45, 0x78, 0x88, 0x87, 0x66, 0x88, 0x88, 0x86, 0x67, 0x9A, 0x97, 0x78, 0x9A, 0x98, 0x88, 0x99,
-	0x98, 0x88, 0x88, 0x87, 0x77, 0x66, 0x67, 0x88, 0x87, 0x77, 0x78, 0x98, 0x89, 0x99, 0x98, 0x78,
-	0x89, 0x9A, 0x99, 0xA9, 0x88, 0xAB, 0xBA, 0x98, 0x89, 0xAA, 0x97, 0x66, 0x66, 0x66, 0x66, 0x67,
-	0x77, 0x78, 0x78, 0x9A, 0xBB, 0xA9, 0x99, 0x99, 0x87, 0x66, 0x77, 0x77, 0x66, 0x66, 0x67, 0x77,
-	0x79, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xA9, 0x88, 0x98, 0x88, 0x88, 0x89, 0x87, 0x78, 0x9A, 0xAA,
-	0x88, 0x78, 0x88, 0x88, 0x77, 0x77, 0x87, 0x76, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x99, 0x98,
-	0x87, 0x88, 0x88, 0x76, 0x66, 0x76, 0x66, 0x66, 0x78, 0x88, 0x78, 0x89, 0x99, 0xA9, 0x9A, 0xAA,
-	0xBA, 0x98, 0x9A, 0xAA, 0x88, 0x88, 0x66, 0x77, 0x66, 0x76, 0x78, 0x88, 0x78, 0x89, 0x9A, 0xA9,
-	0x88, 0x99, 0x88, 0x87, 0x78, 0x87, 0x66, 0x66, 0x78, 0x88, 0x76, 0x78, 0x88, 0x88, 0x88, 0x89,
-	0x88, 0x88, 0x89, 0x99, 0x88, 0x99, 0xAA, 0x98, 0x88, 0x89, 0x99, 0x88, 0x88, 0x78, 0x99, 0x98,
-	0x77, 0x88, 0x89, 0x98, 0x78, 0x87, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x88, 0x88, 0x99, 0x87, 0x88, 0x88, 0x9A, 0xA9, 0x99, 0x88, 0x9A, 0x99, 0xAA,
-	0x99, 0x87, 0x77, 0x89, 0x88, 0x76, 0x66, 0x66, 0x67, 0x78, 0x88, 0x78, 0x88, 0x99, 0x99, 0x99,
-	0x89, 0x98, 0x77, 0x78, 0x99, 0x76, 0x78, 0x9A, 0x97, 0x77, 0x78, 0x9A, 0x98, 0x88, 0x99, 0x99,
-	0x99, 0x99, 0xA9, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x66, 0x67, 0x77, 0x89, 0x98, 0x99, 0x88,
-	0x99, 0x98, 0x9A, 0x98, 0x88, 0x88, 0x99, 0x98, 0x77, 0x87, 0x77, 0x77, 0x68, 0x9A, 0x98, 0x87,
-	0x89, 0xAB, 0xA9, 0x87, 0x77, 0x88, 0x78, 0x87, 0x77, 0x65, 0x56, 0x88, 0x88, 0x77, 0x77, 0x89,
-	0x99, 0x99, 0x99, 0x99, 0x88, 0x9A, 0xA9, 0x87, 0x77, 0x89, 0x88, 0x88, 0x89, 0x99, 0x88, 0x99,
-	0x99, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77, 0x99, 0x99, 0x98, 0x89, 0xAA,
-	0x98, 0x88, 0x77, 0x77, 0x78, 0x9A, 0x98, 0x99, 0x89, 0xAA, 0xA9, 0x88, 0x89, 0x98, 0x65, 0x56,
-	0x67, 0x66, 0x66, 0x78, 0x89, 0xAA, 0x9A, 0xBB, 0xBB, 0x98, 0x9A, 0xAA, 0x99, 0x76, 0x66, 0x66,
-	0x67, 0x65, 0x67, 0x77, 0x78, 0xAA, 0xBB, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x98, 0x76, 0x55, 0x67,
-	0x77, 0x76, 0x55, 0x67, 0x88, 0x99, 0x9A, 0xAA, 0x99, 0xAB, 0xBA, 0xAA, 0x97, 0x77, 0x77, 0x88,
-	0x77, 0x77, 0x87, 0x77, 0x89, 0xAA, 0x98, 0x78, 0x88, 0x87, 0x77, 0x77, 0x77, 0x66, 0x67, 0x78,
-	0x88, 0x77, 0x88, 0x88, 0x88, 0x89, 0xAA, 0x98, 0x88, 0x89, 0xAA, 0x98, 0x77, 0x77, 0x89, 0xA9,
-	0x88, 0x78, 0xAA, 0xA9, 0x88, 0x99, 0x88, 0x76, 0x77, 0x89, 0x86, 0x55, 0x56, 0x88, 0x77, 0x78,
-	0x88, 0x88, 0x77, 0x89, 0xA9, 0x88, 0x77, 0x88, 0x98, 0x79, 0x99, 0x99, 0x88, 0x9A, 0xAA, 0x98,
-	0x77, 0x88, 0x77, 0x77, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x76, 0x67, 0x89,
-	0x98, 0x75, 0x68, 0x9A, 0xA8, 0x66, 0x89, 0x97, 0x77, 0x77, 0x89, 0x87, 0x77, 0x78, 0xAB, 0xAA,
-	0x99, 0xAA, 0xBA, 0xAA, 0xAA, 0x98, 0x87, 0x77, 0x77, 0x76, 0x67, 0x77, 0x77, 0x89, 0x99, 0x88,
-	0x89, 0xAA, 0x98, 0x77, 0x78, 0x88, 0x76, 0x66, 0x77, 0x76, 0x66, 0x68, 0x99, 0x88, 0x88, 0x9A,
-	0xA9, 0x9A, 0xA9, 0x99, 0x88, 0x89, 0x9A, 0x98, 0x76, 0x77, 0x66, 0x89, 0x89, 0x87, 0x79, 0x9A,
-	0xAA, 0xA9, 0x87, 0x88, 0x87, 0x77, 0x77, 0x66, 0x66, 0x67, 0x77, 0x89, 0x98, 0x88, 0x99, 0x9A,
-	0x98, 0x99, 0xAA, 0x99, 0x87, 0x79, 0x98, 0x88, 0x76, 0x67, 0x88, 0x99, 0x98, 0x88, 0x98, 0x8A,
-	0xA8, 0x77, 0x77, 0x88, 0x87, 0x67, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x78, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x78, 0x99, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x78, 0x88, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0x88, 0x87, 0x78, 0x88,
-	0x89, 0x98, 0x88, 0x89, 0x99, 0x88, 0x89, 0x88, 0x77, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x77, 0x88, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x98, 0x87, 0x78, 0x88, 0x87, 0x65, 0x67, 0x75, 0x56, 0x56, 0x77, 0x77, 0x88,
-	0x89, 0x9A, 0xBB, 0xAA, 0xAA, 0xAA, 0xA9, 0x9B, 0xBB, 0xAA, 0x98, 0x9A, 0xA9, 0x75, 0x56, 0x68,
-	0x87, 0x65, 0x68, 0x99, 0x98, 0x75, 0x67, 0x88, 0x89, 0xAA, 0xAA, 0x98, 0x8A, 0xBA, 0x77, 0x77,
-	0x77, 0x89, 0x98, 0x87, 0x61, 0x01, 0x23, 0x68, 0x75, 0x66, 0x9B, 0xDF, 0xD8, 0x77, 0x88, 0x88,
-	0x9B, 0xDF, 0xFB, 0x77, 0x9C, 0xDC, 0x95, 0x32, 0x46, 0x89, 0x99, 0x87, 0x66, 0x55, 0x69, 0xBB,
-	0x97, 0x66, 0x9C, 0xED, 0xA7, 0x67, 0x99, 0x98, 0x64, 0x11, 0x12, 0x58, 0xAA, 0x84, 0x45, 0x7B,
-	0xED, 0xA6, 0x56, 0x78, 0xAB, 0xCB, 0xBB, 0xBA, 0x99, 0x9A, 0xB9, 0x66, 0x55, 0x68, 0x98, 0x77,
-	0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x89, 0x9A, 0xBB, 0xA6, 0x33, 0x45, 0x67, 0x89, 0x77, 0x99,
-	0xA9, 0x98, 0x77, 0x79, 0x99, 0x87, 0x88, 0x88, 0x9A, 0x98, 0x77, 0x67, 0x66, 0x78, 0xBD, 0xCC,
-	0xA9, 0x76, 0x87, 0x73, 0x34, 0x56, 0x7A, 0xB9, 0x99, 0xB9, 0x65, 0x78, 0x9D, 0xEC, 0xB8, 0x66,
-	0x53, 0x47, 0x86, 0x67, 0x79, 0xBD, 0xED, 0xBB, 0xA6, 0x46, 0x76, 0x44, 0x56, 0x7A, 0xCB, 0xCD,
-	0xCA, 0x85, 0x33, 0x45, 0x67, 0xAC, 0xA9, 0xAD, 0xDC, 0xBA, 0x96, 0x21, 0x23, 0x45, 0x67, 0x9B,
-	0xEF, 0xED, 0xCA, 0xA9, 0x73, 0x01, 0x24, 0x56, 0x78, 0xBF, 0xFE, 0xDB, 0x64, 0x8B, 0x84, 0x12,
-	0x45, 0x69, 0xBE, 0xFC, 0x98, 0x53, 0x46, 0x77, 0x99, 0x88, 0x68, 0xBA, 0xAC, 0xDA, 0x78, 0x86,
-	0x45, 0x88, 0x54, 0x45, 0x7A, 0xDD, 0xB8, 0x65, 0x44, 0x56, 0x68, 0xAB, 0xBA, 0x88, 0x98, 0x67,
-	0x88, 0x54, 0x56, 0x79, 0xED, 0xCB, 0x89, 0x87, 0x32, 0x34, 0x57, 0xBB, 0x98, 0xAB, 0xA9, 0x87,
-	0x34, 0x57, 0xCB, 0x9A, 0xB9, 0x89, 0xB9, 0x44, 0x57, 0xAB, 0xBA, 0x87, 0xAC, 0xCB, 0xA8, 0x32,
-	0x47, 0x65, 0x68, 0xAC, 0xFE, 0xDB, 0x76, 0x79, 0x95, 0x35, 0x57, 0x7B, 0xED, 0xAB, 0xCB, 0x9A,
-	0xA8, 0x43, 0x45, 0x43, 0x56, 0x66, 0x8A, 0xA9, 0x9B, 0xCD, 0xDC, 0xBA, 0x64, 0x43, 0x35, 0x65,
-	0x67, 0x78, 0x89, 0xCE, 0xED, 0xCB, 0xA8, 0x53, 0x23, 0x45, 0x56, 0x77, 0x88, 0xBC, 0xDC, 0xBA,
-	0x97, 0x54, 0x34, 0x55, 0x67, 0x8B, 0xCC, 0xBA, 0xA9, 0x86, 0x54, 0x45, 0x67, 0x76, 0x67, 0x9B,
-	0xBA, 0xAA, 0xA8, 0x77, 0x77, 0x78, 0xAA, 0xA9, 0x99, 0x77, 0x77, 0x66, 0x66, 0x78, 0x89, 0x9A,
-	0xBA, 0xAA, 0x86, 0x66, 0x53, 0x56, 0x68, 0xAB, 0xBC, 0xCC, 0xB9, 0x86, 0x45, 0x68, 0x98, 0x88,
-	0x9A, 0xA9, 0x77, 0x75, 0x45, 0x76, 0x68, 0xAD, 0xED, 0xB9, 0x87, 0x55, 0x65, 0x46, 0x78, 0x89,
-	0xAB, 0xCC, 0xCC, 0xB9, 0x76, 0x55, 0x56, 0x78, 0x89, 0xAA, 0xBB, 0xBA, 0x87, 0x66, 0x67, 0x77,
-	0x77, 0x89, 0x99, 0x88, 0x88, 0x77, 0x76, 0x56, 0x67, 0x78, 0x89, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x77, 0x88, 0x78, 0x87, 0x77, 0x66, 0x78, 0x99, 0x9A, 0xA9, 0xAA, 0x98, 0x77, 0x76, 0x77, 0x77,
-	0x89, 0xAA, 0xAA, 0xA9, 0x88, 0x76, 0x66, 0x67, 0x77, 0x87, 0x78, 0x99, 0x88, 0x88, 0x88, 0x99,
-	0x98, 0x88, 0x77, 0x66, 0x78, 0xAA, 0xBA, 0x99, 0x88, 0x87, 0x67, 0x78, 0x99, 0x99, 0x9A, 0xA9,
-	0x87, 0x77, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x79, 0xA9, 0x88, 0x78, 0x88, 0x76, 0x66,
-	0x66, 0x78, 0x99, 0xAA, 0xAA, 0xA9, 0x88, 0x77, 0x77, 0x89, 0x99, 0x98, 0x88, 0x87, 0x87, 0x67,
-	0x78, 0x89, 0x99, 0x88, 0x98, 0x88, 0x98, 0x89, 0x99, 0x98, 0x88, 0x88, 0x77, 0x77, 0x77, 0x89,
-	0x9A, 0x99, 0x99, 0x88, 0x87, 0x77, 0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0x88, 0x77, 0x77, 0x77,
-	0x77, 0x78, 0x99, 0xA9, 0x98, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x9A, 0xBA, 0xA9, 0x87,
-	0x66, 0x67, 0x77, 0x77, 0x78, 0x99, 0x99, 0x99, 0x89, 0x88, 0x66, 0x77, 0x87, 0x88, 0x89, 0x9A,
-	0x99, 0x88, 0x87, 0x76, 0x66, 0x68, 0x99, 0x98, 0x88, 0x9A, 0x98, 0x77, 0x78, 0x99, 0x98, 0x89,
-	0xAA, 0xAA, 0x98, 0x88, 0x87, 0x77, 0x77, 0x77, 0x76, 0x78, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x9A, 0xA9, 0x98, 0x88, 0x87, 0x76, 0x67, 0x89, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x98, 0x87, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x89,
-	0x98, 0x87, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x88, 0x77, 0x76, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x99,
-	0x99, 0x99, 0x98, 0x88, 0x77, 0x78, 0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x77, 0x66, 0x77, 0x77,
-	0x88, 0x88, 0x99, 0x99, 0x88, 0x78, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x89, 0x99,
-	0x98, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88,
-	0x99, 0x99, 0x99, 0x98, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78,
-	0x88, 0x88, 0x99, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x77, 0x78, 0x89, 0x89, 0x99, 0x98, 0x99, 0x88, 0x87, 0x78, 0x88, 0x88, 0x77, 0x78,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x78, 0x89, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88,
-	0x89, 0x98, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x78, 0x88, 0x89,
-	0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88,
-	0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77,
-	0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x89,
-	0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x93
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x06, 0xCA, 0x22, 0x07, 0x82, 0x21, 0xEC, 0xAD,
+	0x49, 0xBC, 0xA5, 0x6E, 0x91, 0x36, 0x17, 0xF4, 0x3C, 0x68, 0x6C, 0x6E, 0x00, 0x7B, 0xD8, 0x81,
+	0x3F, 0x29, 0x54, 0x07, 0xB8, 0xE1, 0xBF, 0xEE, 0x44, 0x04, 0x85, 0x51, 0xB2, 0x7B, 0xC0, 0xF1,
+	0xBA, 0xEC, 0x49, 0x2B, 0x14, 0x55, 0xA2, 0x3E, 0x7C, 0xBF, 0x26, 0x48, 0x14, 0x85, 0x5A, 0xCD,
+	0xC2, 0xE6, 0xE6, 0xC1, 0xF0, 0xB4, 0x06, 0xF1, 0xB6, 0x78, 0xF9, 0x49, 0x0B, 0xAD, 0x8E, 0xFE,
+	0x88, 0x54, 0x81, 0x1C, 0x52, 0x8D, 0xCF, 0x78, 0xC3, 0x26, 0x1C, 0x84, 0x54, 0xD8, 0xBB, 0x1E,
+	0x3F, 0x03, 0x91, 0x58, 0xC4, 0x8A, 0xFB, 0xB6, 0x25, 0x6D, 0x62, 0x93, 0xED, 0xB2, 0xCC, 0xB8,
+	0x47, 0x05, 0x46, 0x1C, 0xBF, 0x0C, 0xAE, 0x88, 0x45, 0x62, 0x01, 0x2A, 0xCF, 0xB2, 0xBA, 0xE2,
+	0x10, 0x41, 0x04, 0x10, 0x8A, 0xFA, 0x2E, 0x88, 0x71, 0x21, 0x22, 0x22, 0xB4, 0x8B, 0xAD, 0x63,
+	0x88, 0x88, 0x8B, 0xAE, 0x42, 0x21, 0x2C, 0x44, 0x8A, 0xEB, 0x52, 0xBB, 0x62, 0x2D, 0x8F, 0x85,
+	0x8E, 0x10, 0x71, 0x88, 0x88, 0xAF, 0x92, 0xE5, 0x3B, 0x35, 0x0E, 0xC6, 0xCC, 0x38, 0x88, 0x84,
+	0xE8, 0x42, 0x21, 0x2E, 0x22, 0xBB, 0x93, 0x90, 0x1B, 0x1D, 0x4B, 0x35, 0x2F, 0x84, 0xEC, 0x9B,
+	0xC4, 0x2B, 0xC4, 0x2F, 0xD4, 0xE9, 0x1B, 0x26, 0x38, 0xAB, 0x3C, 0x14, 0xBA, 0x53, 0x12, 0xBD,
+	0x90, 0xC7, 0xC4, 0x3B, 0x96, 0xEE, 0x08, 0x81, 0x21, 0xD4, 0x0F, 0x83, 0xFA, 0x4A, 0xE2, 0x10,
+	0x50, 0x20, 0x4A, 0xBE, 0x72, 0x21, 0xF1, 0x13, 0xCC, 0x23, 0xC8, 0x7B, 0x4A, 0x04, 0x42, 0x2B,
+	0xB6, 0x3F, 0x27, 0x20, 0x52, 0xD1, 0x27, 0x10, 0x7F, 0x18, 0xEB, 0xE4, 0xE6, 0x42, 0xD1, 0x1B,
+	0xC2, 0xCF, 0x1B, 0xC8, 0x52, 0xF4, 0x22, 0x21, 0xCA, 0x12, 0xC4, 0x6F, 0x81, 0x2E, 0xAD, 0x4B,
+	0xE4, 0x93, 0xCB, 0xD8, 0x88, 0x88, 0x16, 0x88, 0x8A, 0xB4, 0x85, 0xF0, 0x35, 0xA2, 0xF5, 0xA6,
+	0xBB, 0x85, 0xCF, 0x22, 0x14, 0x2D, 0x24, 0x0A, 0xDB, 0xC9, 0x6F, 0x11, 0xE8, 0x14, 0xE2, 0x42,
+	0x20, 0x7F, 0x0C, 0x8A, 0x2E, 0x10, 0x53, 0x6C, 0x63, 0x4E, 0x88, 0x4B, 0xE7, 0x22, 0xD5, 0xB3,
+	0x11, 0xBB, 0x26, 0x9B, 0x3B, 0xD4, 0xAC, 0x85, 0x08, 0x8A, 0xC5, 0x3F, 0x24, 0xA2, 0x12, 0xC4,
+	0x8A, 0xEA, 0xE0, 0x8A, 0xE4, 0x15, 0x8B, 0x16, 0xF2, 0xE2, 0x15, 0xB0, 0xD0, 0xBE, 0x1B, 0xFC,
+	0x1A, 0x95, 0x96, 0x90, 0x7E, 0x12, 0xFE, 0x82, 0x1F, 0x48, 0x56, 0x6B, 0x28, 0x22, 0xBF, 0xC1,
+	0x8B, 0xE5, 0x66, 0x18, 0xC5, 0xAB, 0xFA, 0x96, 0xC8, 0x70, 0x54, 0xF8, 0x0F, 0x22, 0xAE, 0x45,
+	0x2E, 0x42, 0x21, 0x4F, 0x81, 0x4F, 0xA9, 0x53, 0xAD, 0x4B, 0xA4, 0xEF, 0x05, 0xEE, 0x14, 0xC9,
+	0x23, 0xC5, 0x3A, 0xC4, 0x79, 0x22, 0xC5, 0x3B, 0xE4, 0xE0, 0x52, 0xE2, 0x22, 0x21, 0xEF, 0x11,
+	0x3F, 0x10, 0xBE, 0x5B, 0x22, 0x5B, 0x85, 0x4A, 0xE4, 0x72, 0x3F, 0xA8, 0x8B, 0x90, 0x95, 0x8E,
+	0x14, 0xFC, 0x92, 0xF8, 0x4B, 0xA5, 0x4C, 0x85, 0x31, 0xB8, 0xE1, 0x1F, 0xB2, 0xD4, 0x8F, 0x11,
+	0x8B, 0xF0, 0xBA, 0x2E, 0x81, 0x05, 0x38, 0x41, 0xF6, 0x6A, 0xF1, 0x38, 0xF9, 0x42, 0xB8, 0x75,
+	0xBA, 0x24, 0xBC, 0x08, 0x84, 0x22, 0x22, 0x22, 0xB1, 0x48, 0x22, 0xAE, 0xD6, 0xA2, 0x13, 0xA2,
+	0x22, 0xE8, 0x12, 0xE8, 0x12, 0x12, 0xEB, 0x12, 0x1B, 0x21, 0x2E, 0x1E, 0xC5, 0xA8, 0x88, 0x8A,
+	0xB1, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x12, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0xB8, 0x6C, 0xA1, 0x08, 0x81, 0x22, 0x22, 0xB4, 0xAE, 0x22, 0x22, 0xB8, 0x12, 0x22, 0x22, 0x22,
+	0x22, 0x13, 0xF1, 0x8B, 0xF1, 0xB9, 0x90, 0x84, 0x15, 0x2C, 0x88, 0xB1, 0x6B, 0xF1, 0x3F, 0x99,
+	0x3A, 0x52, 0x3F, 0x04, 0x90, 0x3F, 0x17, 0xA8, 0x05, 0x3B, 0xFE, 0x15, 0xB0, 0x50, 0xFA, 0x03,
+	0x55, 0xBC, 0x07, 0xBA, 0x14, 0x2E, 0xEC, 0x54, 0xEC, 0x52, 0xF8, 0x4B, 0xEE, 0x95, 0x0F, 0x91,
+	0x6E, 0x81, 0x43, 0x23, 0xE1, 0x7E, 0xA5, 0x2C, 0x00, 0x48, 0xAE, 0x15, 0x3F, 0xE1, 0x04, 0xE4,
+	0x2B, 0xE1, 0x4F, 0x09, 0x5E, 0xCC, 0x85, 0x52, 0xFA, 0x6F, 0x84, 0x52, 0x87, 0xF1, 0x12, 0xFC,
+	0xE4, 0x30, 0x15, 0x2E, 0xFC, 0x2E, 0x45, 0x60, 0xFB, 0xC9, 0x11, 0xB1, 0x2B, 0xFF, 0x00, 0x45,
+	0x4A, 0xF3, 0xF8, 0x10, 0x55, 0x2B, 0xF1, 0xB8, 0x05, 0x47, 0xAE, 0x12, 0x4B, 0xD6, 0x07, 0xCB,
+	0xC4, 0xE9, 0x46, 0xBE, 0x84, 0x15, 0xAC, 0x3C, 0x3E, 0x15, 0x4B, 0xCB, 0xE0, 0x54, 0xE4, 0xBB,
+	0xC1, 0x4C, 0x39, 0x3E, 0x14, 0xAE, 0x52, 0xFF, 0x1A, 0x44, 0x6B, 0xE1, 0xBC, 0x05, 0x68, 0x3C,
+	0xFE, 0x1A, 0x49, 0x58, 0x94, 0x3F, 0xE3, 0x06, 0x11, 0xD4, 0x2E, 0xFE, 0x81, 0x10, 0x55, 0x2E,
+	0xFB, 0x84, 0x15, 0x0E, 0xBE, 0xE9, 0x4A, 0x15, 0x60, 0xFE, 0x0D, 0x43, 0x3E, 0x2C, 0x85, 0x11,
+	0x63, 0xFA, 0xF4, 0x94, 0x03, 0xFB, 0xC1, 0x20, 0x57, 0xE3, 0x86, 0x55, 0x2F, 0xAA, 0x6D, 0x19,
+	0x10, 0xBF, 0xE8, 0x95, 0x90, 0x0F, 0xFA, 0x18, 0x05, 0x2E, 0x2E, 0xFD, 0x99, 0x08, 0x88, 0xBA,
+	0xE4, 0xDB, 0x8F, 0x50, 0x93, 0x6E, 0xE3, 0x00, 0x54, 0x8F, 0xCF, 0x21, 0x27, 0x16, 0xA2, 0x04,
+	0xBA, 0xFC, 0x50, 0x6E, 0xCB, 0xC1, 0x4A, 0x5B, 0xE8, 0x4A, 0xB8, 0x22, 0x35, 0x6C, 0xC2, 0xF2,
+	0x95, 0x04, 0x8F, 0xCE, 0x05, 0x0F, 0x2B, 0x79, 0x90, 0x2E, 0x70, 0x79, 0x0F, 0x22, 0xE8, 0x95,
+	0x9A, 0x3C, 0xBA, 0x21, 0x40, 0x8A, 0xEE, 0x88, 0x81, 0x47, 0x38, 0x82, 0xB8, 0x19, 0x52, 0xEF,
+	0xC9, 0x82, 0x56, 0x22, 0xDE, 0xE4, 0x36, 0x11, 0xCE, 0x3B, 0x85, 0x4B, 0x05, 0xEE, 0x14, 0xB9,
+	0x4A, 0xF8, 0xF2, 0x22, 0xB5, 0x26, 0xC8, 0x88, 0x95, 0xB3, 0x8B, 0xBD, 0x42, 0x8A, 0xCF, 0x28,
+	0x88, 0x42, 0x04, 0xBE, 0x84, 0x21, 0x0A, 0xB1, 0xBB, 0x84, 0x21, 0x0A, 0xB3, 0xE3, 0x61, 0x08,
+	0x88, 0xAD, 0x2B, 0x48, 0xAE, 0x21, 0x08, 0x42, 0x22, 0xBA, 0xE1, 0x04, 0x22, 0xAE, 0xEE, 0x40,
+	0x48, 0x4A, 0xED, 0xC0, 0x88, 0x88, 0x88, 0xAE, 0x22, 0x04, 0x42, 0x2B, 0x88, 0x88, 0x88, 0x88,
+	0x8A, 0xE2, 0x21, 0x08, 0x84, 0xB8, 0x88, 0x12, 0xBA, 0xE2, 0x21, 0x08, 0x1B, 0x28, 0xAE, 0x04,
+	0x42, 0x2B, 0xAD, 0x22, 0x21, 0xC8, 0xAE, 0x21, 0x08, 0x4D, 0xAE, 0x08, 0xAE, 0x40, 0x88, 0x88,
+	0xAD, 0xC9, 0x1C, 0x0B, 0x6E, 0x39, 0x0A, 0xE1, 0x36, 0x22, 0x22, 0x22, 0x22, 0x04, 0x8B, 0xA2,
+	0x2B, 0x88, 0x12, 0x22, 0x22, 0xB8, 0x1D, 0x02, 0xE8, 0x88, 0x84, 0x22, 0xBA, 0xE2, 0x22, 0x10,
+	0x1B, 0x82, 0xB8, 0x42, 0x04, 0xAB, 0x3D, 0x21, 0x2A, 0xE2, 0x22, 0x22, 0x22, 0x2B, 0x88, 0x12,
+	0x22, 0xB4, 0x88, 0x88, 0xAD, 0x22, 0x22, 0x22, 0x22, 0x2A, 0xD2, 0x04, 0x88, 0x8A, 0xE2, 0x2E,
+	0x41, 0x0B, 0xA2, 0x22, 0x22, 0x21, 0x0A, 0xE2, 0x22, 0xB4, 0x84, 0xB8, 0xAE, 0x20, 0x48, 0x12,
+	0xE8, 0x88, 0x88, 0x84, 0x2F, 0xA8, 0x81, 0x22, 0x22, 0x22, 0xE7, 0x21, 0x08, 0x81, 0xB8, 0x21,
+	0x2B, 0x82, 0x22, 0x07, 0x88, 0x88, 0xBA, 0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x4E, 0x88, 0x88,
+	0x88, 0x84, 0xB8, 0x88, 0x88, 0x88, 0x88, 0xAE, 0x04, 0x88, 0x88, 0x1E, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x3A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xE8, 0x42, 0x22, 0x22, 0x22, 0x22, 0x06, 0xCA,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3F
 };
 
+/* 3-bit ADPCM, SNR 17.2 dB */
 const u8 sfx_door_open[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x98, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x77, 0x76, 0x67, 0x78, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x77, 0x78, 0x9A, 0xBB, 0xBA, 0x98, 0x76, 0x65, 0x67, 0x9A, 0xA9, 0x87, 0x66, 0x66,
-	0x78, 0x88, 0x87, 0x65, 0x55, 0x67, 0x89, 0xAA, 0x98, 0x87, 0x78, 0x89, 0xBB, 0xBB, 0xA8, 0x76,
-	0x67, 0x89, 0x99, 0x99, 0x87, 0x77, 0x78, 0x9A, 0xA9, 0x88, 0x76, 0x66, 0x78, 0x9A, 0xAA, 0x98,
-	0x77, 0x77, 0x78, 0x9A, 0x99, 0x87, 0x65, 0x56, 0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x9A, 0xAA,
-	0xA9, 0x87, 0x77, 0x77, 0x88, 0x98, 0x88, 0x77, 0x78, 0x89, 0x99, 0x99, 0x98, 0x87, 0x77, 0x77,
-	0x78, 0x88, 0x78, 0x78, 0x88, 0x88, 0x89, 0x98, 0x88, 0x87, 0x87, 0x87, 0x77, 0x77, 0x88, 0x88,
-	0x78, 0x88, 0x98, 0x99, 0x88, 0x98, 0x88, 0x89, 0x88, 0x89, 0x99, 0xAA, 0x99, 0x98, 0x87, 0x77,
-	0x77, 0x78, 0x88, 0x98, 0x88, 0x77, 0x65, 0x77, 0x89, 0x9A, 0x9A, 0x98, 0x87, 0x65, 0x55, 0x55,
-	0x77, 0x99, 0xAA, 0x99, 0x86, 0x67, 0x76, 0x8A, 0xAB, 0xDD, 0xDC, 0xCB, 0x77, 0x77, 0x57, 0x89,
-	0x9A, 0xA8, 0x86, 0x54, 0x33, 0x46, 0x68, 0xAB, 0xA9, 0x88, 0x54, 0x57, 0x89, 0xBC, 0xDC, 0xBA,
-	0x96, 0x44, 0x34, 0x58, 0xAB, 0xCD, 0xB9, 0x76, 0x44, 0x45, 0x69, 0xBC, 0xDD, 0xDB, 0xA8, 0x65,
-	0x56, 0x89, 0xAB, 0xBB, 0xA8, 0x64, 0x33, 0x46, 0x79, 0xBB, 0xBA, 0x87, 0x54, 0x44, 0x57, 0x9A,
-	0xBC, 0xCA, 0x97, 0x64, 0x45, 0x67, 0x9A, 0xBA, 0xA9, 0x86, 0x65, 0x67, 0x89, 0xBB, 0xBA, 0x98,
-	0x76, 0x77, 0x89, 0xAB, 0xBA, 0xA9, 0x86, 0x66, 0x66, 0x78, 0x98, 0x99, 0x98, 0x88, 0x98, 0x77,
-	0x76, 0x77, 0x88, 0x88, 0x88, 0x77, 0x77, 0x76, 0x78, 0x88, 0x99, 0x88, 0x76, 0x57, 0x77, 0x8A,
-	0xBA, 0xA9, 0x87, 0x66, 0x67, 0x88, 0x9A, 0xAA, 0xAA, 0x99, 0x88, 0x87, 0x89, 0x98, 0x89, 0x88,
-	0x77, 0x76, 0x77, 0x78, 0x99, 0xAA, 0x99, 0x99, 0x87, 0x67, 0x88, 0x89, 0xA9, 0x99, 0x99, 0x87,
-	0x66, 0x65, 0x56, 0x78, 0x78, 0x99, 0x87, 0x99, 0x99, 0xAA, 0x99, 0x88, 0x66, 0x67, 0x77, 0x78,
-	0x88, 0x9A, 0xBB, 0xAA, 0x97, 0x66, 0x64, 0x45, 0x77, 0x89, 0x99, 0x88, 0x99, 0x98, 0x88, 0x77,
-	0x88, 0x99, 0xA9, 0x99, 0x88, 0x88, 0x9A, 0xAB, 0xA9, 0x76, 0x55, 0x45, 0x67, 0x78, 0x88, 0x89,
-	0x9A, 0xAB, 0xBA, 0x88, 0x87, 0x78, 0x98, 0x88, 0x76, 0x67, 0x88, 0x99, 0xA8, 0x86, 0x66, 0x67,
-	0x78, 0x87, 0x88, 0x88, 0x9A, 0xB9, 0x88, 0x76, 0x68, 0x88, 0x88, 0x99, 0x88, 0x87, 0x77, 0x88,
-	0x89, 0xA9, 0x99, 0x87, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x89, 0x99, 0x9A, 0xA8, 0x76, 0x65,
-	0x56, 0x78, 0x78, 0xA9, 0x98, 0x87, 0x67, 0x89, 0x99, 0x98, 0x77, 0x88, 0x77, 0x98, 0x88, 0x99,
-	0x88, 0x98, 0x79, 0x99, 0x88, 0x87, 0x77, 0x77, 0x78, 0x99, 0xAA, 0x98, 0x88, 0x77, 0x89, 0xA9,
-	0x98, 0x76, 0x66, 0x77, 0x67, 0x88, 0x88, 0x88, 0x88, 0x9A, 0xBA, 0xBB, 0xAA, 0x98, 0x75, 0x44,
-	0x45, 0x68, 0x99, 0x88, 0x76, 0x66, 0x67, 0x89, 0xAB, 0xCB, 0xA8, 0x87, 0x66, 0x67, 0x89, 0xAA,
-	0xAA, 0xA9, 0x87, 0x88, 0x89, 0x9A, 0x99, 0x87, 0x76, 0x56, 0x66, 0x78, 0x89, 0x98, 0x88, 0x87,
-	0x77, 0x78, 0x9A, 0xBA, 0xA9, 0x98, 0x76, 0x66, 0x66, 0x78, 0x99, 0xAA, 0xAA, 0xA9, 0x87, 0x77,
-	0x77, 0x88, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x76,
-	0x54, 0x45, 0x68, 0x99, 0xAA, 0x98, 0x77, 0x66, 0x78, 0x89, 0xAA, 0xAA, 0x99, 0x76, 0x65, 0x55,
-	0x79, 0x9A, 0xAA, 0x98, 0x98, 0x77, 0x78, 0x89, 0xAA, 0xA9, 0x88, 0x76, 0x65, 0x56, 0x78, 0x9A,
-	0xA9, 0x98, 0x88, 0x87, 0x77, 0x89, 0x99, 0x9A, 0x98, 0x77, 0x76, 0x66, 0x67, 0x78, 0x9A, 0xAA,
-	0x99, 0x99, 0x98, 0x78, 0x99, 0x88, 0x99, 0x98, 0x77, 0x76, 0x66, 0x66, 0x77, 0x78, 0x99, 0x88,
-	0x99, 0x88, 0x9A, 0xA9, 0x9A, 0xA8, 0x78, 0x87, 0x77, 0x88, 0x88, 0x87, 0x78, 0x87, 0x77, 0x77,
-	0x78, 0xA9, 0x89, 0xA9, 0x87, 0x89, 0x76, 0x78, 0x99, 0x88, 0x88, 0x98, 0x88, 0x98, 0x77, 0x89,
-	0x78, 0x99, 0x87, 0x79, 0x98, 0x77, 0x98, 0x76, 0x78, 0x97, 0x78, 0x99, 0x98, 0x88, 0x66, 0x78,
-	0x88, 0x88, 0x99, 0x89, 0x98, 0x76, 0x78, 0x88, 0x89, 0xAA, 0x98, 0x9A, 0x97, 0x67, 0x88, 0x78,
-	0x9A, 0x87, 0x89, 0x98, 0x88, 0x86, 0x67, 0x87, 0x77, 0x89, 0x98, 0x8A, 0xA9, 0x66, 0x89, 0x86,
-	0x79, 0x98, 0x78, 0xA9, 0x87, 0x78, 0x88, 0x88, 0x98, 0x88, 0x99, 0x99, 0x98, 0x77, 0x9A, 0x96,
-	0x79, 0x98, 0x67, 0x99, 0x86, 0x78, 0x87, 0x57, 0x88, 0x77, 0x88, 0x87, 0x78, 0x88, 0x98, 0x88,
-	0x9A, 0x98, 0x89, 0x98, 0x78, 0xAA, 0x87, 0x89, 0x87, 0x67, 0x88, 0x66, 0x89, 0x97, 0x78, 0x88,
-	0x76, 0x78, 0x88, 0x88, 0x9A, 0x98, 0x89, 0x98, 0x77, 0x89, 0x77, 0x79, 0x98, 0x78, 0xA9, 0x77,
-	0x89, 0x76, 0x78, 0x87, 0x77, 0x99, 0x87, 0x99, 0x87, 0x78, 0x87, 0x78, 0x88, 0x88, 0x88, 0x99,
-	0x88, 0x88, 0x87, 0x78, 0x88, 0x77, 0x89, 0x87, 0x89, 0x88, 0x78, 0x98, 0x77, 0x89, 0x87, 0x89,
-	0x87, 0x78, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x87, 0x79, 0x88, 0x89, 0xA9, 0x88, 0x99,
-	0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x87, 0x67, 0x88, 0x88, 0x99, 0x98,
-	0x99, 0x99, 0x78, 0x87, 0x77, 0x88, 0x87, 0x88, 0x98, 0x77, 0x88, 0x77, 0x77, 0x88, 0x89, 0x99,
-	0x98, 0x99, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87, 0x87, 0x77, 0x78, 0x88,
-	0x89, 0x99, 0x99, 0x98, 0x89, 0x88, 0x88, 0x87, 0x88, 0x98, 0x88, 0x88, 0x78, 0x88, 0x78, 0x77,
-	0x78, 0x87, 0x89, 0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x88, 0x78,
-	0x89, 0x99, 0x99, 0x98, 0x77, 0x76, 0x77, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77,
-	0x89, 0x9A, 0xAA, 0xA9, 0x88, 0x78, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98, 0x78, 0x88,
-	0x77, 0x88, 0x99, 0x88, 0x88, 0x88, 0x87, 0x89, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88,
-	0x98, 0x89, 0x99, 0x88, 0x77, 0x87, 0x77, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x87, 0x87, 0x78,
-	0x88, 0x89, 0x99, 0x98, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x98, 0x88, 0x99, 0x88, 0x77, 0x88,
-	0x77, 0x78, 0x77, 0x88, 0x99, 0x88, 0x88, 0x87, 0x77, 0x88, 0x87, 0x78, 0x87, 0x88, 0x99, 0x88,
-	0x89, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x89, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x87, 0x88, 0x87, 0x78, 0x88, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x78,
-	0x98, 0x88, 0x99, 0x88, 0x88, 0x87, 0x78, 0x89, 0x88, 0x98, 0x99, 0x88, 0x88, 0x98, 0x77, 0x88,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x77, 0x88, 0x89, 0x98, 0x98, 0x88, 0x87, 0x76,
-	0x78, 0x78, 0x78, 0x98, 0x88, 0x99, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x98, 0x88,
-	0x89, 0x88, 0x88, 0x98, 0x89, 0x88, 0x97, 0x88, 0x89, 0x78, 0x89, 0x88, 0x88, 0x88, 0x87, 0x78,
-	0x88, 0x77, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x99, 0x89, 0x98, 0x98, 0x88,
-	0x77, 0x77, 0x88, 0x89, 0x98, 0x88, 0x88, 0x78, 0x78, 0x87, 0x77, 0x77, 0x77, 0x88, 0x89, 0x98,
-	0x88, 0x89, 0x88, 0x99, 0x98, 0x89, 0x99, 0x88, 0x99, 0x88, 0x78, 0x98, 0x79, 0x88, 0x97, 0x88,
-	0x88, 0x87, 0x88, 0x77, 0x78, 0x88, 0x77, 0x88, 0x87, 0x88, 0x88, 0x78, 0x98, 0x88, 0x89, 0x98,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x99, 0x88, 0x87, 0x87, 0x77, 0x88, 0x87, 0x78, 0x98,
-	0x88, 0x89, 0x88, 0x78, 0x97, 0x78, 0x88, 0x88, 0x89, 0x88, 0x88, 0x98, 0x78, 0x88, 0x97, 0x89,
-	0x89, 0x88, 0x98, 0x79, 0x88, 0x97, 0x89, 0x77, 0x87, 0x98, 0x79, 0x87, 0x97, 0x89, 0x78, 0x97,
-	0x89, 0x79, 0x86, 0x98, 0x79, 0x78, 0xA7, 0x89, 0x78, 0x96, 0x99, 0x69, 0x97, 0x97, 0x6A, 0x87,
-	0x97, 0x99, 0x78, 0x98, 0x98, 0x69, 0x86, 0x98, 0x79, 0x77, 0xA8, 0x79, 0x78, 0x86, 0x88, 0x68,
-	0x86, 0x98, 0x69, 0x97, 0x98, 0x8A, 0x87, 0x97, 0x78, 0x68, 0x97, 0x7A, 0x79, 0xA7, 0x99, 0x78,
-	0x97, 0x98, 0x6A, 0x97, 0x88, 0x9B, 0x88, 0xA7, 0x79, 0x67, 0x96, 0x89, 0x68, 0x97, 0x99, 0x6A,
-	0x87, 0x98, 0x69, 0x75, 0xA7, 0x6A, 0x78, 0xA7, 0x6A, 0x77, 0xA6, 0x8A, 0x77, 0xA6, 0x8A, 0x69,
-	0xA6, 0x9A, 0x69, 0x96, 0x99, 0x6B, 0x97, 0xA8, 0x69, 0x86, 0xA8, 0x7A, 0x78, 0x97, 0x8A, 0x78,
-	0xA7, 0x89, 0x68, 0x96, 0x89, 0x69, 0x97, 0x98, 0x69, 0x87, 0x98, 0x7A, 0x86, 0x97, 0x79, 0x78,
-	0xA8, 0x8A, 0x78, 0x96, 0x89, 0x68, 0xA6, 0x89, 0x69, 0x97, 0x99, 0x79, 0x97, 0x98, 0x69, 0x76,
-	0x98, 0x7A, 0x87, 0xA8, 0x7A, 0x87, 0x97, 0x79, 0x77, 0x96, 0x79, 0x69, 0xA7, 0x8B, 0x77, 0xA6,
-	0x8A, 0x68, 0xA7, 0x89, 0x69, 0x96, 0x9A, 0x68, 0x96, 0x99, 0x69, 0xA6, 0x89, 0x79, 0x96, 0x89,
-	0x68, 0x96, 0x99, 0x69, 0x96, 0x8A, 0x68, 0xA6, 0x99, 0x68, 0x96, 0x89, 0x69, 0xA6, 0x89, 0x68,
-	0x96, 0x8A, 0x68, 0xA7, 0x8A, 0x78, 0xA6, 0x89, 0x68, 0x96, 0x7A, 0x68, 0xA7, 0x9A, 0x78, 0xA7,
-	0x7A, 0x78, 0x96, 0x89, 0x67, 0xA7, 0x8A, 0x68, 0xA6, 0x7A, 0x77, 0x97, 0x7A, 0x67, 0x97, 0x89,
-	0x77, 0xA7, 0x7A, 0x77, 0xA8, 0x7A, 0x87, 0xA8, 0x7A, 0x87, 0x97, 0x79, 0x77, 0xA8, 0x6A, 0x76,
-	0x98, 0x79, 0x97, 0x99, 0x69, 0x77, 0x97, 0x79, 0x86, 0x99, 0x69, 0x86, 0x98, 0x69, 0x97, 0x89,
-	0x78, 0x86, 0x99, 0x78, 0x97, 0x89, 0x69, 0x96, 0x8A, 0x78, 0xA8, 0x89, 0x77, 0x97, 0x89, 0x88,
-	0x98, 0x89, 0x77, 0x97, 0x89, 0x88, 0x99, 0x89, 0x77, 0x87, 0x88, 0x89, 0x87, 0x99, 0x78, 0x97,
-	0x88, 0x79, 0x97, 0x78, 0x88, 0x87, 0x99, 0x79, 0x98, 0x78, 0x87, 0x87, 0x69, 0x77, 0x89, 0x88,
-	0x88, 0x98, 0x79, 0x87, 0x88, 0x78, 0x88, 0x89, 0x89, 0x98, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x98, 0x78, 0x87, 0x78, 0x77, 0x87, 0x79, 0x87, 0x99, 0x78, 0x97, 0x99, 0x79, 0xA7, 0x7A,
-	0x87, 0x98, 0x79, 0x86, 0x99, 0x68, 0x96, 0x79, 0x88, 0xA8, 0x7A, 0x97, 0x99, 0x78, 0x97, 0x89,
-	0x77, 0x97, 0x58, 0x86, 0x99, 0x67, 0x97, 0x79, 0x77, 0xA8, 0x7A, 0x96, 0x88, 0x78, 0x86, 0x7A,
-	0x87, 0xA9, 0x79, 0x97, 0x88, 0x78, 0xA8, 0x8A, 0x87, 0xA9, 0x68, 0x97, 0x8A, 0x87, 0x98, 0x79,
-	0x86, 0x99, 0x79, 0x97, 0x89, 0x77, 0x97, 0x68, 0x97, 0x99, 0x78, 0x98, 0x78, 0x87, 0x98, 0x69,
-	0x86, 0x89, 0x77, 0x98, 0x79, 0x97, 0x99, 0x78, 0xA7, 0x79, 0x87, 0x98, 0x79, 0x97, 0x8A, 0x77,
-	0x98, 0x78, 0x97, 0x89, 0x88, 0x97, 0x79, 0x86, 0x99, 0x77, 0x97, 0x78, 0x87, 0x98, 0x79, 0x98,
-	0x89, 0x78, 0x97, 0x79, 0x97, 0x99, 0x78, 0x97, 0x79, 0x87, 0x89, 0x88, 0x97, 0x89, 0x77, 0x99,
-	0x78, 0x97, 0x79, 0x87, 0x88, 0x88, 0x88, 0x99, 0x88, 0x97, 0x78, 0x98, 0x88, 0x88, 0x88, 0x78,
-	0x87, 0x89, 0x77, 0x98, 0x88, 0x98, 0x88, 0x87, 0x87, 0x88, 0x87, 0x88, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x87, 0x88, 0x87, 0x99, 0x88, 0x88, 0x78, 0x88, 0x88, 0x89, 0x87, 0x88,
-	0x87, 0x98, 0x88, 0x97, 0x79, 0x88, 0x88, 0x88, 0x88, 0x99, 0x78, 0x98, 0x78, 0x87, 0x89, 0x77,
-	0x88, 0x77, 0x98, 0x88, 0x88, 0x87, 0x79, 0x87, 0x89, 0x87, 0x98, 0x78, 0x97, 0x89, 0x87, 0x89,
-	0x78, 0x87, 0x89, 0x87, 0x99, 0x78, 0x97, 0x78, 0x87, 0x89, 0x77, 0x98, 0x68, 0x88, 0x88, 0x88,
-	0x98, 0x89, 0x87, 0x89, 0x78, 0x98, 0x79, 0x96, 0x89, 0x86, 0x99, 0x78, 0xA8, 0x79, 0x87, 0x99,
-	0x77, 0x88, 0x88, 0x87, 0x99, 0x78, 0x97, 0x69, 0xA7, 0x89, 0x97, 0x98, 0x77, 0x98, 0x78, 0x97,
-	0x89, 0x87, 0x97, 0x78, 0x87, 0x89, 0x98, 0x98, 0x78, 0x86, 0x79, 0x98, 0x9A, 0x88, 0x98, 0x78,
-	0x97, 0x79, 0x98, 0x99, 0x77, 0x87, 0x67, 0x88, 0x99, 0x78, 0x97, 0x57, 0x86, 0x69, 0x97, 0x89,
-	0x78, 0x98, 0x67, 0x98, 0x79, 0x98, 0x9A, 0x88, 0x98, 0x67, 0xA8, 0x89, 0xA8, 0x98, 0x87, 0x98,
-	0x68, 0x98, 0x8A, 0x97, 0x89, 0x76, 0x88, 0x67, 0xA8, 0x78, 0x98, 0x79, 0x87, 0x88, 0x77, 0x89,
-	0x89, 0x98, 0x78, 0x87, 0x78, 0x77, 0x88, 0x88, 0x87, 0x89, 0x77, 0x88, 0x88, 0x9A, 0x88, 0x98,
-	0x77, 0x76, 0x79, 0x87, 0x89, 0x87, 0x88, 0x76, 0x78, 0x88, 0x99, 0x9A, 0xA8, 0x88, 0x88, 0x89,
-	0x98, 0x9A, 0xA9, 0x88, 0x87, 0x88, 0x77, 0x88, 0x88, 0x87, 0x67, 0x77, 0x78, 0x88, 0x99, 0x98,
-	0x89, 0x88, 0x98, 0x88, 0x99, 0x88, 0x87, 0x77, 0x65, 0x67, 0x77, 0x88, 0x66, 0x87, 0x78, 0x89,
-	0x9A, 0xA9, 0x9A, 0x98, 0x99, 0x87, 0x98, 0x77, 0x87, 0x78, 0x87, 0x78, 0x77, 0x89, 0x98, 0x9A,
-	0x99, 0xAA, 0x9A, 0xBA, 0x99, 0x98, 0x89, 0x87, 0x78, 0x76, 0x77, 0x66, 0x77, 0x67, 0x88, 0x88,
-	0x99, 0x89, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x87, 0x77, 0x76, 0x78, 0x77, 0x88, 0x88, 0x88,
-	0x78, 0x98, 0x89, 0xA9, 0x89, 0x97, 0x78, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x67, 0x87,
-	0x89, 0x98, 0x9A, 0x98, 0x99, 0x87, 0x98, 0x77, 0x87, 0x67, 0x77, 0x78, 0x88, 0x88, 0x99, 0x98,
-	0x99, 0x98, 0x9A, 0x99, 0x98, 0x78, 0x97, 0x67, 0x97, 0x68, 0x87, 0x68, 0x77, 0x87, 0x87, 0x98,
-	0x99, 0x99, 0x88, 0x78, 0x98, 0x78, 0x98, 0x88, 0x98, 0x77, 0x87, 0x78, 0x87, 0x99, 0x88, 0x99,
-	0x88, 0x88, 0x87, 0x77, 0x88, 0x87, 0x88, 0x77, 0x77, 0x77, 0x77, 0x79, 0x88, 0x89, 0x98, 0x99,
-	0x88, 0x99, 0x9A, 0x98, 0x78, 0x88, 0x78, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x78, 0x98,
-	0x8A, 0xB9, 0x89, 0xA8, 0x78, 0x89, 0x88, 0x77, 0x87, 0x67, 0x88, 0x78, 0x88, 0x88, 0x78, 0x99,
-	0x77, 0x88, 0x77, 0x89, 0x87, 0x88, 0x88, 0x88, 0x8A, 0xA8, 0x89, 0x98, 0x89, 0x99, 0x98, 0x89,
-	0x98, 0x78, 0x98, 0x76, 0x77, 0x77, 0x66, 0x77, 0x66, 0x88, 0x77, 0x89, 0x88, 0x99, 0x9A, 0xA8,
-	0x89, 0xA8, 0x89, 0x98, 0x77, 0x77, 0x77, 0x88, 0x88, 0x78, 0x88, 0x77, 0x77, 0x78, 0x88, 0x89,
-	0x87, 0x89, 0x87, 0x9A, 0x97, 0x89, 0x87, 0x88, 0x76, 0x89, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x99, 0x88, 0xAA, 0x88, 0x99, 0x88, 0x99, 0x88, 0x89, 0x87,
-	0x87, 0x76, 0x77, 0x67, 0x78, 0x88, 0x89, 0x99, 0x99, 0x99, 0x87, 0x89, 0x87, 0x89, 0x87, 0x89,
-	0x98, 0x88, 0x76, 0x78, 0x76, 0x67, 0x76, 0x77, 0x77, 0x89, 0x98, 0x9B, 0xA8, 0x9A, 0xA9, 0x8A,
-	0xA9, 0x89, 0x98, 0x78, 0x97, 0x67, 0x87, 0x67, 0x99, 0x88, 0x89, 0x98, 0x88, 0x87, 0x78, 0x77,
-	0x77, 0x87, 0x68, 0x99, 0x78, 0x89, 0x87, 0x89, 0x97, 0x88, 0x89, 0x99, 0x88, 0x78, 0x78, 0x77,
-	0x88, 0x88, 0x88, 0x99, 0x87, 0x77, 0x77, 0x67, 0x88, 0x78, 0x98, 0x99, 0xA9, 0x89, 0x99, 0x89,
-	0x99, 0x77, 0x78, 0x76, 0x77, 0x76, 0x78, 0x98, 0x79, 0x98, 0x67, 0x89, 0x76, 0x88, 0x87, 0x99,
-	0x98, 0x89, 0x87, 0x79, 0x98, 0x78, 0xA9, 0x88, 0x99, 0x77, 0x79, 0x87, 0x89, 0x97, 0x79, 0x98,
-	0x77, 0x89, 0x78, 0x99, 0x87, 0x78, 0x88, 0x78, 0x99, 0x9A, 0xAA, 0x99, 0x99, 0x87, 0x78, 0x87,
-	0x88, 0x78, 0x88, 0x77, 0x77, 0x88, 0x99, 0x98, 0x98, 0x77, 0x76, 0x66, 0x68, 0x99, 0x88, 0xAA,
-	0x97, 0x89, 0x88, 0x89, 0x98, 0x89, 0xA8, 0x66, 0x88, 0x66, 0x89, 0x98, 0x89, 0x97, 0x67, 0x77,
-	0x66, 0x77, 0x67, 0x88, 0x76, 0x67, 0x88, 0x88, 0x9A, 0xBB, 0xAA, 0xBB, 0xA9, 0x98, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x76, 0x88, 0x88, 0x99, 0x99, 0x99, 0x98, 0x76, 0x66, 0x56, 0x66, 0x66, 0x78,
-	0x87, 0x89, 0xA9, 0x9A, 0xAA, 0x99, 0xA9, 0x87, 0x78, 0x86, 0x67, 0x88, 0x88, 0x99, 0x88, 0x89,
-	0x98, 0x88, 0x98, 0x88, 0x88, 0x77, 0x78, 0x87, 0x89, 0xA9, 0x99, 0xA9, 0x99, 0x99, 0x88, 0x99,
-	0x98, 0x78, 0x87, 0x66, 0x76, 0x67, 0x88, 0x88, 0x89, 0x98, 0x88, 0x87, 0x78, 0x88, 0x66, 0x78,
-	0x76, 0x67, 0x87, 0x78, 0x9A, 0x88, 0xAB, 0xA8, 0x8A, 0xA9, 0x78, 0xAA, 0x86, 0x79, 0x87, 0x66,
-	0x87, 0x66, 0x89, 0x86, 0x79, 0xA8, 0x78, 0x99, 0x87, 0x8A, 0xA8, 0x89, 0xAA, 0x99, 0x9A, 0x98,
-	0x89, 0x87, 0x67, 0x89, 0x88, 0x89, 0x98, 0x88, 0x99, 0x87, 0x78, 0x87, 0x78, 0x88, 0x77, 0x77,
-	0x76, 0x66, 0x77, 0x77, 0x89, 0xA9, 0x9A, 0xBB, 0x9A, 0xAA, 0x98, 0x88, 0x87, 0x66, 0x78, 0x65,
-	0x67, 0x98, 0x78, 0x9A, 0x98, 0x89, 0x98, 0x67, 0x88, 0x75, 0x67, 0x86, 0x57, 0x88, 0x77, 0x89,
-	0xA9, 0x9A, 0xBA, 0x99, 0x99, 0x87, 0x78, 0x88, 0x77, 0x87, 0x76, 0x88, 0x88, 0x89, 0x99, 0x99,
-	0x99, 0x87, 0x77, 0x76, 0x77, 0x88, 0x77, 0x89, 0x98, 0x89, 0xAA, 0xAA, 0xAA, 0x98, 0x98, 0x87,
-	0x77, 0x77, 0x76, 0x77, 0x77, 0x77, 0x87, 0x88, 0x99, 0x88, 0x89, 0x98, 0x77, 0x87, 0x66, 0x77,
-	0x87, 0x78, 0x99, 0x78, 0x9A, 0xA9, 0x99, 0xAA, 0x99, 0x89, 0x98, 0x76, 0x77, 0x77, 0x67, 0x77,
-	0x66, 0x78, 0x88, 0x88, 0xAA, 0x98, 0x89, 0x99, 0x88, 0x89, 0x87, 0x77, 0x88, 0x77, 0x78, 0x98,
-	0x89, 0x9A, 0x99, 0x9A, 0xA9, 0x88, 0x88, 0x87, 0x87, 0x87, 0x66, 0x66, 0x76, 0x78, 0x88, 0x88,
-	0x99, 0x99, 0x88, 0x98, 0x88, 0x77, 0x89, 0x88, 0x77, 0x88, 0x88, 0x99, 0x99, 0x89, 0x9A, 0x99,
-	0x99, 0x98, 0x86, 0x68, 0x88, 0x77, 0x88, 0x76, 0x78, 0x98, 0x77, 0x79, 0x98, 0x78, 0x99, 0x77,
-	0x77, 0x88, 0x77, 0x88, 0x88, 0x89, 0xA9, 0x88, 0x9A, 0x98, 0x88, 0xAA, 0x97, 0x78, 0x77, 0x77,
-	0x89, 0x76, 0x57, 0x87, 0x87, 0x88, 0x87, 0x78, 0x89, 0x98, 0x88, 0x87, 0x78, 0x88, 0x97, 0x78,
-	0x89, 0x99, 0x99, 0x9A, 0xAA, 0xA9, 0x99, 0x98, 0x77, 0x88, 0x98, 0x88, 0x87, 0x66, 0x89, 0x87,
-	0x65, 0x78, 0x88, 0x77, 0x77, 0x66, 0x78, 0x98, 0x78, 0x9A, 0xA8, 0x78, 0x98, 0x78, 0x89, 0xA9,
-	0x88, 0x9A, 0x97, 0x77, 0x99, 0x87, 0x79, 0xA9, 0x98, 0x88, 0x87, 0x77, 0x89, 0x88, 0x77, 0x89,
-	0x97, 0x77, 0x79, 0x88, 0x88, 0x99, 0x87, 0x89, 0x98, 0x76, 0x79, 0x98, 0x88, 0x99, 0x87, 0x89,
-	0x99, 0x88, 0x88, 0x87, 0x78, 0x88, 0x77, 0x78, 0x99, 0x87, 0x89, 0x99, 0x88, 0x99, 0x98, 0x78,
-	0x89, 0x87, 0x66, 0x77, 0x78, 0x88, 0x87, 0x78, 0x89, 0x99, 0x98, 0x76, 0x79, 0x99, 0x76, 0x67,
-	0x89, 0x87, 0x88, 0x99, 0x88, 0x9A, 0xA9, 0x87, 0x8A, 0xA9, 0x87, 0x88, 0x88, 0x98, 0x89, 0x88,
-	0x88, 0x88, 0x99, 0x88, 0x77, 0x89, 0x87, 0x66, 0x78, 0x78, 0x78, 0x78, 0x76, 0x78, 0xAA, 0x97,
-	0x67, 0x9A, 0xA8, 0x76, 0x78, 0x88, 0x77, 0x88, 0x87, 0x78, 0x9A, 0x98, 0x78, 0x9A, 0x99, 0x88,
-	0x78, 0x99, 0x87, 0x66, 0x89, 0x87, 0x67, 0x89, 0x87, 0x79, 0xAA, 0x87, 0x67, 0x89, 0x98, 0x77,
-	0x78, 0x88, 0x88, 0x76, 0x78, 0x88, 0x88, 0x88, 0x88, 0x99, 0xAA, 0x97, 0x68, 0xAA, 0x97, 0x77,
-	0x89, 0x98, 0x89, 0x87, 0x88, 0x99, 0x97, 0x77, 0x88, 0x98, 0x88, 0x87, 0x88, 0x88, 0x87, 0x78,
-	0x89, 0x98, 0x88, 0x88, 0x78, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x98,
-	0x89, 0x88, 0x98, 0x87, 0x88, 0x78, 0x78, 0x89, 0x98, 0x88, 0x88, 0x99, 0x88, 0x77, 0x89, 0x98,
-	0x66, 0x78, 0x98, 0x87, 0x78, 0x88, 0x88, 0x88, 0x87, 0x88, 0x99, 0x98, 0x88, 0x88, 0x89, 0x99,
-	0x77, 0x78, 0x98, 0x87, 0x89, 0x99, 0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x98, 0x87, 0x77, 0x99,
-	0x97, 0x66, 0x8A, 0xA8, 0x77, 0x89, 0xA9, 0x77, 0x77, 0x89, 0x98, 0x88, 0x78, 0x89, 0x87, 0x78,
-	0x88, 0x87, 0x78, 0x99, 0x87, 0x78, 0x9A, 0x97, 0x67, 0x89, 0xA9, 0x87, 0x88, 0x99, 0x87, 0x67,
-	0x99, 0x97, 0x77, 0x89, 0x99, 0x87, 0x79, 0x99, 0x87, 0x77, 0x89, 0x97, 0x76, 0x79, 0x88, 0x76,
-	0x78, 0x89, 0x87, 0x88, 0x99, 0x98, 0x87, 0x78, 0x99, 0x87, 0x78, 0x99, 0x87, 0x77, 0x89, 0x98,
-	0x88, 0x89, 0xA9, 0x88, 0x88, 0x89, 0x88, 0x77, 0x78, 0x88, 0x87, 0x77, 0x89, 0x98, 0x88, 0x89,
-	0x99, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x98, 0x77, 0x88, 0x98, 0x87,
-	0x78, 0x99, 0x87, 0x77, 0x89, 0x99, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x87, 0x77, 0x88,
-	0x98, 0x88, 0x88, 0x98, 0x88, 0x87, 0x78, 0x88, 0x87, 0x78, 0x89, 0x98, 0x78, 0x99, 0x98, 0x77,
-	0x89, 0x88, 0x88, 0x88, 0x78, 0x89, 0x98, 0x77, 0x88, 0x99, 0x87, 0x79, 0x99, 0x98, 0x88, 0x89,
-	0x89, 0x88, 0x76, 0x78, 0x98, 0x87, 0x78, 0x89, 0x98, 0x87, 0x89, 0x88, 0x88, 0x77, 0x77, 0x89,
-	0x88, 0x77, 0x89, 0x98, 0x88, 0x89, 0xA8
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0xF0, 0x41, 0x18, 0x10, 0x31, 0x20, 0x82,
+	0x78, 0x04, 0x10, 0x41, 0x3C, 0x10, 0x40, 0xC4, 0x10, 0x41, 0x18, 0x9E, 0x01, 0x04, 0xEA, 0x08,
+	0x20, 0x0F, 0x40, 0x20, 0x82, 0x08, 0x1C, 0xD3, 0x41, 0x04, 0x60, 0x41, 0x1E, 0x13, 0xA8, 0x20,
+	0x13, 0xC1, 0xE2, 0x0C, 0x81, 0x04, 0x13, 0xC0, 0x20, 0x93, 0xA1, 0x20, 0x82, 0x0F, 0x03, 0x48,
+	0xC1, 0xF5, 0xBA, 0x64, 0x59, 0x1A, 0xEA, 0x20, 0x68, 0x49, 0xF5, 0x81, 0xA2, 0xCC, 0xD6, 0x68,
+	0x83, 0x62, 0x0F, 0xAD, 0x89, 0x11, 0x24, 0xF8, 0x40, 0xD1, 0x1E, 0xCF, 0x60, 0x69, 0x18, 0x3E,
+	0xA2, 0x00, 0xD1, 0xC3, 0x5F, 0x42, 0x21, 0x08, 0x20, 0x82, 0x30, 0xE0, 0x9F, 0x59, 0x04, 0x61,
+	0xE1, 0x30, 0x8C, 0x10, 0x20, 0x9E, 0x68, 0x20, 0x8C, 0x4C, 0xB1, 0x02, 0x08, 0xC7, 0x12, 0x65,
+	0x8D, 0x90, 0x46, 0x04, 0xEA, 0x07, 0x88, 0xD1, 0x58, 0x03, 0xD0, 0x38, 0x1C, 0xB2, 0x79, 0xA0,
+	0x82, 0x30, 0x1E, 0x13, 0x8D, 0x9C, 0x24, 0x2A, 0x76, 0x9A, 0xE8, 0x2B, 0x61, 0x83, 0x30, 0xFA,
+	0x11, 0x9A, 0x05, 0x09, 0x76, 0xF2, 0x4C, 0x89, 0x0A, 0xF9, 0xED, 0xB1, 0xB0, 0x91, 0xB7, 0x8F,
+	0x4A, 0x25, 0x93, 0x75, 0xFF, 0x48, 0x1A, 0x24, 0x1F, 0xB4, 0xB2, 0x24, 0xC8, 0x22, 0x7D, 0xAD,
+	0x89, 0x12, 0xA0, 0xFB, 0x69, 0x0B, 0x28, 0x89, 0xB5, 0xF2, 0x04, 0x91, 0x0A, 0x79, 0xAE, 0x00,
+	0xA6, 0x0D, 0x1E, 0xF9, 0x51, 0x45, 0x89, 0x76, 0xB5, 0x44, 0x59, 0x98, 0x6D, 0xA0, 0x81, 0x95,
+	0x54, 0x1E, 0x07, 0xA8, 0x9D, 0x45, 0x00, 0x93, 0xC0, 0x27, 0x44, 0x46, 0x34, 0xF7, 0x31, 0x12,
+	0x36, 0x6B, 0xB0, 0x89, 0x44, 0x44, 0x83, 0xCE, 0x27, 0x46, 0x60, 0xB0, 0xC2, 0x62, 0x03, 0x41,
+	0x4C, 0x24, 0xFA, 0x96, 0x23, 0x36, 0x41, 0x3E, 0xC2, 0x60, 0x8A, 0xA8, 0x8F, 0x58, 0x11, 0xCC,
+	0x38, 0xF0, 0x11, 0x03, 0x11, 0xA5, 0x2C, 0xFE, 0x8B, 0xE2, 0x40, 0x90, 0x3C, 0x70, 0x71, 0x38,
+	0x51, 0x03, 0xA0, 0xF0, 0x06, 0x81, 0xDF, 0x5B, 0x32, 0x24, 0x31, 0x23, 0x08, 0x39, 0xB8, 0x98,
+	0x15, 0x64, 0xF8, 0x22, 0x10, 0x7E, 0x71, 0x01, 0x08, 0x72, 0x04, 0x69, 0x79, 0x2E, 0x0C, 0x48,
+	0x1C, 0xB2, 0x78, 0x18, 0x0D, 0x61, 0x35, 0x82, 0x08, 0x18, 0x8C, 0x4E, 0xA0, 0x0E, 0xFD, 0x66,
+	0x08, 0xAA, 0x9D, 0x18, 0x6A, 0x59, 0x82, 0x7C, 0x08, 0xE5, 0xD1, 0x18, 0xE0, 0xEC, 0xC4, 0xB0,
+	0x78, 0x20, 0x8D, 0x05, 0x35, 0x83, 0xC6, 0x55, 0x9E, 0xE8, 0x1C, 0xC8, 0x89, 0x04, 0x01, 0xA3,
+	0x54, 0xD3, 0xDF, 0xA8, 0x89, 0x23, 0x28, 0xF8, 0x40, 0xCA, 0x44, 0xED, 0xA5, 0xA2, 0x34, 0x8C,
+	0x02, 0x7D, 0x88, 0x8C, 0x1D, 0x36, 0x9A, 0xA8, 0x19, 0x0E, 0x61, 0x07, 0x80, 0x34, 0x55, 0x9A,
+	0x7B, 0xA0, 0x81, 0xA5, 0x14, 0x10, 0x7D, 0x84, 0x11, 0x8E, 0x24, 0x0C, 0x41, 0x04, 0xEA, 0x06,
+	0x44, 0x10, 0x49, 0xFE, 0xB4, 0x24, 0x8C, 0x52, 0xEB, 0x3C, 0x66, 0x33, 0x04, 0xDB, 0xD9, 0x81,
+	0x6C, 0x11, 0x3D, 0x5A, 0xC0, 0xE3, 0x30, 0x7B, 0x3D, 0x9C, 0x22, 0x91, 0x98, 0x68, 0x27, 0x81,
+	0xA1, 0x03, 0xD7, 0x41, 0xE0, 0x0C, 0x24, 0xA0, 0xD0, 0x49, 0xF2, 0x33, 0x05, 0x07, 0xB2, 0x78,
+	0x04, 0x60, 0x35, 0x30, 0x53, 0x04, 0x47, 0x0A, 0x7C, 0x65, 0x81, 0x88, 0x27, 0x8C, 0x68, 0x20,
+	0x0D, 0xCC, 0x55, 0xD4, 0xAF, 0x4A, 0x32, 0xC8, 0x1E, 0x11, 0xEA, 0x0B, 0xE4, 0xCD, 0x83, 0x17,
+	0x07, 0x6D, 0x45, 0x70, 0x10, 0x9A, 0x4F, 0x59, 0x82, 0x06, 0x39, 0x1E, 0xE2, 0x84, 0x0D, 0x0F,
+	0x51, 0xDA, 0x92, 0x39, 0x4B, 0xC0, 0xA5, 0x03, 0x78, 0x8E, 0x11, 0x29, 0x83, 0x1B, 0x82, 0x6F,
+	0x0E, 0x4A, 0x95, 0xB6, 0x31, 0x20, 0x78, 0x47, 0x00, 0x9F, 0x86, 0x76, 0x08, 0x5E, 0x1C, 0x98,
+	0x11, 0xBA, 0x02, 0xC5, 0x06, 0x88, 0x47, 0x60, 0x6B, 0x50, 0xA6, 0xA9, 0x8F, 0x01, 0xBB, 0x15,
+	0x38, 0x46, 0x70, 0x64, 0xD8, 0xA1, 0x00, 0x6B, 0x50, 0xA6, 0xB1, 0x9F, 0x03, 0x17, 0x25, 0x74,
+	0x2B, 0xC0, 0x46, 0x01, 0x9D, 0x90, 0xB6, 0x21, 0xC2, 0x82, 0x08, 0x1C, 0xD0, 0x09, 0xE3, 0x13,
+	0xC6, 0x75, 0x47, 0x0C, 0x55, 0xC0, 0xAB, 0x8A, 0xBA, 0x21, 0x3A, 0x82, 0x08, 0x20, 0x0B, 0x70,
+	0xE4, 0x89, 0x5C, 0x08, 0xF0, 0x09, 0xE3, 0x12, 0x09, 0xD4, 0x1D, 0x41, 0xB1, 0x50, 0x04, 0x27,
+	0x50, 0xEE, 0x66, 0x81, 0x89, 0xC8, 0x7A, 0x85, 0x30, 0x81, 0x88, 0xC0, 0x9D, 0x4C, 0x20, 0x9E,
+	0x06, 0x20, 0x63, 0xC0, 0x27, 0x58, 0x40, 0x84, 0x0C, 0x41, 0x27, 0x0B, 0x08, 0x27, 0x51, 0x58,
+	0x24, 0xE8, 0x4C, 0x74, 0x0C, 0x74, 0x66, 0x10, 0x4E, 0xA0, 0x82, 0x08, 0x03, 0xD0, 0x75, 0x2A,
+	0x88, 0x41, 0x27, 0xC2, 0x75, 0x14, 0x11, 0x89, 0x38, 0x93, 0xC0, 0x20, 0x68, 0x10, 0x27, 0xD3,
+	0x2B, 0x15, 0x50, 0x41, 0x04, 0x62, 0x7C, 0x40, 0xF1, 0x07, 0x2C, 0x82, 0x09, 0xD1, 0xC2, 0x01,
+	0x27, 0x08, 0x41, 0x04, 0x78, 0x28, 0x3C, 0xB1, 0xE1, 0x1C, 0x02, 0x07, 0x34, 0x02, 0x75, 0x81,
+	0x10, 0x31, 0x27, 0x8E, 0xC9, 0xD0, 0x90, 0x07, 0xA0, 0x73, 0x0D, 0x10, 0xD0, 0x3C, 0x08, 0x43,
+	0x88, 0x27, 0x81, 0x89, 0xE3, 0x95, 0x04, 0x3C, 0x0E, 0xC8, 0x18, 0x93, 0x89, 0x04, 0x10, 0x4F,
+	0x18, 0x82, 0x08, 0x24, 0xE1, 0x09, 0x3A, 0x12, 0x08, 0x20, 0x82, 0x08, 0x20, 0x63, 0xC0, 0xF0,
+	0x81, 0xE1, 0x04, 0x9D, 0x09, 0xC1, 0x02, 0x75, 0x88, 0x12, 0x09, 0x32, 0x56, 0x07, 0x34, 0x02,
+	0x78, 0xC1, 0xD1, 0xD5, 0x30, 0x81, 0x6C, 0x08, 0x10, 0x3C, 0x20, 0x82, 0x4C, 0xB0, 0x91, 0x80,
+	0xE6, 0x58, 0x41, 0xE5, 0x4A, 0xAC, 0x55, 0x81, 0x0F, 0x4E, 0x50, 0x08, 0x20, 0x8F, 0x05, 0x84,
+	0x0B, 0x08, 0x1E, 0x07, 0x47, 0xCC, 0x8B, 0x98, 0xAC, 0x02, 0x09, 0xE3, 0x13, 0x82, 0x04, 0x0F,
+	0x08, 0x24, 0xE1, 0x08, 0x1C, 0xCA, 0x65, 0x60, 0xE2, 0x46, 0x03, 0x9A, 0x01, 0x3A, 0xC4, 0x68,
+	0x04, 0x11, 0x88, 0xC7, 0x10, 0x3C, 0x08, 0x1E, 0x38, 0x38, 0x53, 0x0C, 0x55, 0xCE, 0x85, 0xC0,
+	0x82, 0x65, 0x30, 0x8C, 0x4E, 0x14, 0x1C, 0x81, 0x3A, 0x38, 0x40, 0xC7, 0x8A, 0xC0, 0x20, 0x82,
+	0x3C, 0x14, 0xC2, 0x75, 0x60, 0x42, 0x78, 0xD5, 0x82, 0x3C, 0x31, 0x5E, 0x10, 0x24, 0x0F, 0x08,
+	0x16, 0xC4, 0x47, 0xC9, 0xC6, 0xC7, 0xB3, 0x90, 0xF0, 0xB4, 0x35, 0xCA, 0xED, 0x78, 0x8C, 0x16,
+	0x07, 0x2B, 0x9C, 0xAA, 0x87, 0x80, 0xA1, 0x75, 0x32, 0x95, 0x58, 0xEC, 0x35, 0x0E, 0x45, 0x3B,
+	0xB9, 0x94, 0x87, 0x07, 0x6A, 0xA6, 0x75, 0x32, 0x95, 0xCC, 0x85, 0x34, 0x3D, 0x55, 0x03, 0xA3,
+	0xC2, 0xC4, 0x63, 0x31, 0x3C, 0xCE, 0xE5, 0x30, 0xBF, 0x16, 0x07, 0x83, 0x88, 0xC4, 0xF5, 0x33,
+	0xB0, 0xCC, 0xA6, 0x76, 0x2A, 0x16, 0x8A, 0xC7, 0x81, 0xB1, 0xF2, 0x79, 0x1C, 0x8C, 0x47, 0x52,
+	0xB9, 0x55, 0xAA, 0x67, 0x2A, 0xA0, 0x62, 0xB8, 0x58, 0x0A, 0x47, 0x27, 0xA9, 0x54, 0xEA, 0x43,
+	0x33, 0xB5, 0xD8, 0xA9, 0x5A, 0x3C, 0x06, 0x23, 0x15, 0xC8, 0xEA, 0x55, 0x2A, 0x95, 0x5C, 0xEC,
+	0x52, 0x2B, 0x1D, 0xAE, 0xD7, 0x62, 0xC1, 0x60, 0x7A, 0x18, 0x2C, 0x0F, 0x23, 0x93, 0x80, 0xCA,
+	0x64, 0x30, 0x15, 0x4C, 0x87, 0x22, 0xA9, 0x88, 0xE4, 0x75, 0x2A, 0x1C, 0x9E, 0x0F, 0x52, 0x91,
+	0xC8, 0xE8, 0x72, 0x31, 0x18, 0xAE, 0x0D, 0x0B, 0x05, 0xC0, 0xA5, 0x70, 0xB0, 0x34, 0x8E, 0x16,
+	0x8A, 0x83, 0xC8, 0xE1, 0xD0, 0xB8, 0x3C, 0x2B, 0x15, 0x8F, 0x03, 0x41, 0xE1, 0xE8, 0xEC, 0x56,
+	0x3B, 0x1D, 0xAE, 0xC5, 0x81, 0xC1, 0xDC, 0xEC, 0x52, 0xA9, 0x54, 0xEA, 0x83, 0x82, 0xB9, 0xCC,
+	0xA5, 0x52, 0xA9, 0x49, 0xE0, 0x76, 0x30, 0x38, 0x1E, 0xA6, 0x2B, 0x03, 0x61, 0xF1, 0xD0, 0x6C,
+	0x76, 0x3F, 0x1E, 0x22, 0x82, 0x39, 0xF0, 0xE5, 0x02, 0xBD, 0xCC, 0x46, 0x23, 0x21, 0xC0, 0x10,
+	0x76, 0x3A, 0x92, 0x99, 0x96, 0x8E, 0x82, 0x70, 0x81, 0x6C, 0xE6, 0x23, 0x11, 0x02, 0xCA, 0x58,
+	0xC7, 0x80, 0x41, 0x04, 0x1D, 0xCC, 0x65, 0x8F, 0x03, 0xCB, 0xB9, 0x8C, 0x0F, 0x52, 0xA1, 0xC2,
+	0xB5, 0x4A, 0xEE, 0x72, 0x91, 0xC2, 0x91, 0xE8, 0xA5, 0x53, 0x11, 0x82, 0xD1, 0x5C, 0x86, 0x43,
+	0x03, 0x81, 0xC1, 0xD8, 0xA7, 0x32, 0xA9, 0xCB, 0xB1, 0xCC, 0x46, 0x03, 0x17, 0x81, 0xD1, 0xCE,
+	0x45, 0x2B, 0x45, 0x6B, 0x9D, 0x0C, 0x46, 0x07, 0x45, 0x6B, 0x19, 0x4A, 0x4E, 0xA4, 0x77, 0x3A,
+	0x95, 0x0C, 0x15, 0xAC, 0x72, 0x30, 0x5A, 0x29, 0x54, 0xA8, 0x60, 0xF8, 0x36, 0x05, 0xC9, 0xC0,
+	0xF8, 0xEE, 0x72, 0x85, 0x80, 0x15, 0xCC, 0x85, 0x87, 0x85, 0xA3, 0x99, 0x4A, 0x4F, 0x8E, 0xC2,
+	0x74, 0x5C, 0x9F, 0x1C, 0xC4, 0xF8, 0xA5, 0x22, 0x08, 0x18, 0xF1, 0x70, 0x15, 0x80, 0x41, 0x3A,
+	0x99, 0x1F, 0x1D, 0x11, 0x51, 0x27, 0x58, 0x89, 0x94, 0xC1, 0x40, 0x20, 0x81, 0xE1, 0x20, 0x9D,
+	0x41, 0xD8, 0xB0, 0x4E, 0xA0, 0x10, 0x2D, 0x88, 0x1D, 0xC9, 0x1F, 0x0A, 0x88, 0x24, 0x11, 0xCE,
+	0x15, 0xC4, 0x72, 0xF8, 0x03, 0x07, 0x44, 0x02, 0x70, 0xE6, 0x2A, 0xE7, 0x6A, 0x3C, 0x2B, 0x4A,
+	0xE6, 0x54, 0x75, 0x63, 0x85, 0xA1, 0x18, 0xAE, 0x15, 0xCA, 0x08, 0x20, 0x78, 0x1D, 0x4B, 0xE4,
+	0xEA, 0xE7, 0x26, 0xF6, 0x30, 0x56, 0xA9, 0x5C, 0xC0, 0xC1, 0x07, 0x63, 0x85, 0xE3, 0x18, 0x01,
+	0x8C, 0xA1, 0xDA, 0x97, 0x06, 0x65, 0x80, 0x14, 0xB1, 0x8E, 0xAA, 0x70, 0xC5, 0x2B, 0xC5, 0x69,
+	0x5E, 0x39, 0x0C, 0xF0, 0xEA, 0x88, 0x73, 0x85, 0xEA, 0x18, 0x39, 0x49, 0xE4, 0xEE, 0x55, 0x88,
+	0x62, 0x7C, 0x57, 0x97, 0x61, 0x3C, 0xD9, 0x9D, 0xC8, 0x40, 0xEF, 0x23, 0x57, 0x31, 0x76, 0x93,
+	0x73, 0x98, 0x8C, 0x0A, 0xA4, 0x7C, 0x47, 0x07, 0x04, 0x20, 0x9C, 0xBF, 0x14, 0x11, 0x1F, 0x15,
+	0xC2, 0x64, 0xAD, 0x47, 0x55, 0x2E, 0x46, 0x04, 0x23, 0x9E, 0x81, 0x03, 0x99, 0x11, 0xEC, 0x9D,
+	0x4B, 0x18, 0x82, 0x7C, 0x44, 0x0C, 0x46, 0x27, 0x8E, 0xC7, 0x84, 0x43, 0x41, 0xC4, 0xF4, 0xB1,
+	0x1C, 0xF1, 0xD0, 0x43, 0x04, 0x78, 0xEE, 0x23, 0xD7, 0x68, 0x58, 0x29, 0x81, 0xC1, 0x21, 0x8A,
+	0xB1, 0xCC, 0x8E, 0xA2, 0x68, 0xF5, 0x0B, 0x55, 0x2C, 0x63, 0x14, 0x20, 0x73, 0x2C, 0x20, 0x8C,
+	0x08, 0x24, 0xF8, 0x49, 0xD1, 0xC1, 0x40, 0x24, 0xC9, 0x58, 0xCE, 0xAA, 0x78, 0x47, 0x88, 0x40,
+	0x20, 0x93, 0xCC, 0x8E, 0x46, 0x54, 0xAE, 0x23, 0xD7, 0x68, 0x5A, 0xA8, 0x23, 0x10, 0x46, 0x27,
+	0x42, 0x74, 0x70, 0x9A, 0x97, 0xE9, 0x7A, 0x29, 0x2B, 0xB1, 0x55, 0x5D, 0x22, 0x0F, 0x3A, 0x3A,
+	0xA3, 0x84, 0x57, 0x45, 0x63, 0x1D, 0xC9, 0x14, 0xB0, 0x41, 0xE0, 0x70, 0x75, 0x30, 0x80, 0x41,
+	0x5B, 0xB0, 0x39, 0x54, 0xD1, 0x88, 0xF5, 0xAA, 0x0E, 0x40, 0x82, 0x09, 0xE3, 0x10, 0x4E, 0x8E,
+	0x0D, 0x6A, 0x4F, 0xA4, 0x2B, 0x38, 0x3B, 0x14, 0x31, 0x02, 0x4C, 0x94, 0xF0, 0x8E, 0x11, 0xD5,
+	0x41, 0x05, 0x6E, 0x70, 0x66, 0x04, 0x09, 0xE3, 0x1B, 0x15, 0x75, 0x20, 0x4F, 0x18, 0xE1, 0x8C,
+	0x09, 0xB1, 0x88, 0xE7, 0xA8, 0xF8, 0xA5, 0xD0, 0x41, 0x18, 0x13, 0xA8, 0x38, 0x90, 0x31, 0x02,
+	0xD9, 0x1D, 0x59, 0xBC, 0x9D, 0x48, 0xD9, 0x9B, 0x10, 0x82, 0x4E, 0x24, 0x10, 0x41, 0x27, 0x42,
+	0x07, 0x39, 0x63, 0xC3, 0x2C, 0x63, 0xC0, 0xF5, 0x56, 0x65, 0x2A, 0x88, 0x40, 0xC4, 0x10, 0x4F,
+	0x8A, 0xB8, 0xAB, 0x8A, 0x1A, 0x0F, 0x51, 0xD6, 0x21, 0xD4, 0x11, 0x91, 0x93, 0xBC, 0x99, 0x73,
+	0x17, 0x19, 0xAA, 0x3F, 0x13, 0x72, 0x43, 0x08, 0xA5, 0x82, 0x70, 0xB0, 0x81, 0x6C, 0xCC, 0xE4,
+	0x1D, 0x4B, 0x9C, 0xC0, 0x84, 0xF3, 0x2C, 0x6C, 0x62, 0x08, 0x1C, 0xDA, 0x01, 0x3A, 0x23, 0xA3,
+	0x88, 0x5A, 0xA8, 0x31, 0x3B, 0xC0, 0x76, 0x22, 0x64, 0x8D, 0xEC, 0x6C, 0x42, 0xD5, 0x09, 0x58,
+	0x94, 0x3D, 0x43, 0x17, 0x25, 0x68, 0x53, 0xC0, 0xED, 0x4A, 0x78, 0x85, 0xB1, 0x2E, 0x4C, 0xD6,
+	0x31, 0x3A, 0x30, 0x21, 0x3C, 0x13, 0xE0, 0x47, 0x52, 0xA8, 0x3C, 0x01, 0x84, 0x27, 0x5A, 0x89,
+	0xC5, 0x4D, 0x4A, 0x18, 0xD8, 0x9C, 0x22, 0x96, 0x35, 0xF4, 0x43, 0x44, 0x65, 0x0A, 0x7C, 0x60,
+	0xC0, 0x8E, 0x88, 0xF6, 0x32, 0x04, 0x69, 0x4B, 0x18, 0xF4, 0x68, 0x20, 0x93, 0xA1, 0x36, 0x62,
+	0x44, 0x20, 0x12, 0x7D, 0x64, 0xEA, 0x01, 0x1A, 0x18, 0xA5, 0x62, 0x13, 0x85, 0xAD, 0x8E, 0x78,
+	0x50, 0x81, 0xCD, 0x03, 0x1E, 0x07, 0x64, 0x13, 0xC0, 0xC7, 0x2C, 0xE1, 0x15, 0x82, 0x0F, 0x1C,
+	0x1E, 0xA9, 0xAC, 0x78, 0x14, 0x20, 0x8C, 0x71, 0x27, 0x08, 0x6E, 0x0A, 0xD4, 0x23, 0x82, 0x2B,
+	0xC6, 0x6F, 0x88, 0x5E, 0x54, 0xD4, 0xAB, 0x70, 0x73, 0x04, 0x6F, 0x28, 0xEA, 0x48, 0xF5, 0x39,
+	0xA1, 0x43, 0x08, 0xB5, 0x0B, 0x5A, 0x8A, 0xB0, 0x39, 0xA0, 0x63, 0xD8, 0x87, 0x0A, 0x0F, 0x00,
+	0x9E, 0x06, 0x20, 0x68, 0xD8, 0xDC, 0xE0, 0x0F, 0x44, 0x9F, 0x02, 0xFD, 0x29, 0xD8, 0x11, 0xBA,
+	0x21, 0xF9, 0x33, 0x62, 0x17, 0x88, 0x0B, 0x19, 0x38, 0x23, 0xAC, 0x13, 0xE0, 0x40, 0xF1, 0xE1,
+	0x58, 0x80, 0x31, 0x20, 0x93, 0xE1, 0x27, 0x40, 0x8F, 0x1A, 0x96, 0x32, 0x04, 0x13, 0xE3, 0x86,
+	0x80, 0x49, 0xD0, 0x90, 0x05, 0x94, 0x43, 0x40, 0xE6, 0xB1, 0xDD, 0x10, 0x38, 0x27, 0x39, 0x26,
+	0x68, 0x18, 0xF2, 0xA9, 0xB6, 0x22, 0x0E, 0xA0, 0xE1, 0x11, 0x2B, 0x63, 0x50, 0x40, 0xF0, 0x2D,
+	0xA0, 0x72, 0xC0, 0xD6, 0x04, 0x3C, 0x22, 0x1E, 0x88, 0x27, 0x58, 0xDC, 0x20, 0x59, 0x10, 0x20,
+	0x62, 0x4F, 0x1D, 0x93, 0x84, 0xAC, 0xE1, 0x41, 0x18, 0x93, 0xA0, 0x70, 0x90, 0x6D, 0xE3, 0x12,
+	0xC6, 0x36, 0x28, 0xEA, 0x03, 0x3B, 0x15, 0x38, 0x91, 0x0D, 0x10, 0x80, 0x35, 0xA8, 0x47, 0x58,
+	0x98, 0xDC, 0x0A, 0x20, 0x6B, 0xDA, 0xCD, 0x35, 0x09, 0xE3, 0x04, 0x78, 0x27, 0x08, 0x47, 0xE1,
+	0x08, 0x41, 0x03, 0x12, 0x71, 0x27, 0xD1, 0x05, 0x84, 0x1F, 0x06, 0x6D, 0xD9, 0x81, 0x28, 0x93,
+	0xC6, 0x8E, 0xA8, 0xA9, 0xE9, 0x3A, 0xA8, 0x95, 0xC0, 0xAD, 0xA0, 0x62, 0xE0, 0xCD, 0x9A, 0x09,
+	0xC4, 0x6A, 0xCE, 0x12, 0x9E, 0x42, 0xE8, 0x81, 0x8F, 0x8A, 0x97, 0x54, 0xC6, 0x11, 0x4B, 0x91,
+	0x83, 0xC0, 0x27, 0x8C, 0x4F, 0x03, 0x23, 0xD4, 0x44, 0xF1, 0x89, 0xEA, 0x8A, 0xFA, 0x14, 0x0E,
+	0x09, 0xE3, 0x0A, 0x09, 0xF6, 0x2C, 0x4F, 0x41, 0x4A, 0xE2, 0x14, 0xC1, 0x11, 0xEE, 0x4A, 0x5B,
+	0x94, 0x11, 0xD8, 0xF0, 0x82, 0x07, 0x34, 0xD1, 0x9D, 0x74, 0x67, 0x1A, 0xA9, 0xD8, 0xB4, 0x2F,
+	0xA5, 0x99, 0xED, 0x46, 0x0F, 0x10, 0x9A, 0x34, 0x75, 0xA8, 0xAB, 0x3C, 0xA9, 0x0D, 0xA8, 0x6A,
+	0xDC, 0x51, 0xD4, 0x35, 0x35, 0xA5, 0x99, 0xAC, 0x0C, 0x41, 0x3E, 0x28, 0x40, 0x20, 0x81, 0x84,
+	0x3F, 0xA9, 0x0B, 0xC4, 0x2A, 0x58, 0xF5, 0x40, 0x8D, 0xE0, 0x51, 0x58, 0x27, 0x50, 0x09, 0xE3,
+	0x04, 0x78, 0x04, 0xEA, 0x0F, 0x03, 0x12, 0x08, 0x20, 0x82, 0x75, 0x15, 0x8E, 0xC7, 0x86, 0x23,
+	0x1A, 0x82, 0x1E, 0x01, 0x18, 0xF2, 0xC6, 0x87, 0xD0, 0xA3, 0x67, 0x04, 0x08, 0x20, 0x9D, 0x44,
+	0x26, 0x82, 0x08, 0xCE, 0xF0, 0x23, 0x86, 0x28, 0x4F, 0x54, 0x0B, 0x08, 0x20, 0x78, 0x68, 0x58,
+	0x9F, 0x84, 0x86, 0xA0, 0x95, 0xB0, 0x91, 0x99, 0x84, 0xEA, 0x2B, 0x81, 0x12, 0x70, 0x90, 0xF4,
+	0x22, 0xB6, 0xA5, 0x13, 0xAE, 0x21, 0xCD, 0x72, 0x42, 0x78, 0x0A, 0x13, 0xE0, 0xC4, 0xBA, 0x06,
+	0xA7, 0x95, 0x3A, 0x2E, 0x2A, 0x2B, 0x88, 0x50, 0x79, 0x63, 0x43, 0xD0, 0x88, 0xF6, 0x06, 0xA6,
+	0x10, 0x35, 0x74, 0x10, 0x3C, 0x34, 0x08, 0x41, 0xE0, 0x6A, 0x59, 0x03, 0x13, 0xE8, 0x84, 0x10,
+	0x41, 0x04, 0x1E, 0x06, 0x87, 0xA1, 0x45, 0x67, 0x08, 0x8F, 0x84, 0x4A, 0x0D, 0x00, 0x8F, 0x08,
+	0x20, 0x0B, 0x68, 0x10, 0x76, 0x40, 0x1E, 0x82, 0x70, 0x84, 0x9C, 0x20, 0x87, 0xA5, 0x89, 0xEC,
+	0x66, 0xC8, 0x24, 0xE8, 0x29, 0xAC, 0x41, 0x8F, 0x43, 0x02, 0x71, 0x03, 0xCA, 0xCD, 0x51, 0x56,
+	0x70, 0xA2, 0x98, 0x64, 0x70, 0x93, 0x40, 0x1A, 0xB3, 0xC6, 0x66, 0x10, 0x35, 0xC0, 0x00
 };
 
+/* 3-bit ADPCM, SNR 13.5 dB */
 const u8 sfx_door_close[] __attribute__((aligned(4))) = {
-	0x79, 0x68, 0x88, 0x97, 0x9A, 0x99, 0x76, 0x57, 0x9A, 0xBA, 0x96, 0x66, 0x79, 0xAB, 0xA9, 0x98,
-	0x87, 0x8A, 0xB9, 0x78, 0x76, 0x57, 0x89, 0x89, 0x85, 0x66, 0x79, 0xBB, 0xA9, 0x65, 0x78, 0x9B,
-	0x97, 0x87, 0x66, 0x88, 0x9A, 0xAA, 0x86, 0x68, 0x99, 0xA9, 0x87, 0x87, 0x66, 0x79, 0xA8, 0x87,
-	0x57, 0x87, 0x9A, 0x98, 0x77, 0x77, 0x89, 0xA8, 0x76, 0x65, 0x69, 0xA9, 0x88, 0x88, 0x98, 0x99,
-	0x8A, 0x98, 0x77, 0x67, 0x8A, 0x98, 0x88, 0x67, 0x89, 0x99, 0xBA, 0x78, 0x88, 0x99, 0x98, 0x88,
-	0x88, 0x66, 0x88, 0x98, 0x97, 0x78, 0x98, 0x8A, 0x98, 0x88, 0x64, 0x58, 0x88, 0x77, 0x66, 0x79,
-	0x97, 0x9A, 0x98, 0x88, 0x78, 0xBB, 0x97, 0x77, 0x88, 0x98, 0x79, 0xA9, 0x88, 0x87, 0x88, 0xA9,
-	0x88, 0x89, 0x87, 0x88, 0x89, 0x97, 0x67, 0x77, 0x89, 0x89, 0x89, 0x86, 0x67, 0x78, 0x99, 0x67,
-	0x88, 0x88, 0x88, 0x98, 0x78, 0x86, 0x88, 0x98, 0x98, 0x67, 0x77, 0x78, 0x88, 0x86, 0x89, 0x88,
-	0x87, 0x79, 0x88, 0xA8, 0x77, 0x78, 0x98, 0x67, 0x87, 0x78, 0x99, 0x98, 0x78, 0x99, 0x98, 0x78,
-	0xA9, 0xA9, 0x88, 0x89, 0x99, 0x76, 0x89, 0x9A, 0xA8, 0x99, 0x99, 0x97, 0x88, 0x88, 0x77, 0x67,
-	0x97, 0x66, 0x77, 0x88, 0x77, 0x78, 0x9A, 0x87, 0x88, 0x78, 0x76, 0x68, 0x88, 0x97, 0x68, 0x88,
-	0x88, 0x77, 0x89, 0x9A, 0x88, 0xAA, 0x87, 0x67, 0x99, 0x88, 0x77, 0x8A, 0x88, 0x87, 0x79, 0x98,
-	0x77, 0x78, 0x99, 0x87, 0x77, 0x77, 0x68, 0x99, 0x88, 0x97, 0x8A, 0x77, 0x87, 0x79, 0x98, 0x76,
-	0x79, 0xA8, 0x77, 0x78, 0xA9, 0x77, 0x88, 0x99, 0x87, 0x79, 0x99, 0x97, 0x78, 0x99, 0xAA, 0x9A,
-	0xA9, 0x89, 0x88, 0x98, 0x89, 0x88, 0x67, 0x75, 0x88, 0x8A, 0x87, 0x68, 0x77, 0x9A, 0x89, 0x98,
-	0x75, 0x67, 0x78, 0x88, 0xA8, 0x78, 0x65, 0x79, 0xAA, 0xB9, 0x78, 0x88, 0x88, 0x86, 0x89, 0x87,
-	0x65, 0x78, 0x89, 0xA8, 0x78, 0xA9, 0x78, 0x88, 0x9A, 0x86, 0x67, 0x88, 0x88, 0x78, 0x89, 0xA8,
-	0x78, 0x98, 0xAA, 0x74, 0x78, 0x88, 0x97, 0x67, 0x97, 0x54, 0x68, 0xAB, 0xA9, 0x77, 0x99, 0x98,
-	0x87, 0x8A, 0x97, 0x56, 0x67, 0x8A, 0x87, 0x99, 0x97, 0x89, 0xAA, 0xBA, 0x98, 0x78, 0x88, 0x89,
-	0x99, 0x99, 0x86, 0x67, 0x89, 0x99, 0x78, 0x96, 0x77, 0x66, 0x79, 0x99, 0x85, 0x56, 0x78, 0x89,
-	0x89, 0x88, 0x76, 0x57, 0x89, 0xA9, 0x88, 0x77, 0x87, 0x89, 0x9A, 0xB9, 0x76, 0x77, 0x8A, 0xAA,
-	0x9A, 0xA9, 0x76, 0x76, 0x8B, 0xB9, 0x89, 0x86, 0x68, 0x76, 0x8B, 0x98, 0x98, 0x66, 0x89, 0x77,
-	0xAA, 0x88, 0xA7, 0x57, 0x88, 0x58, 0x97, 0x68, 0x96, 0x7A, 0xA8, 0x9B, 0x96, 0x89, 0x74, 0x7A,
-	0x86, 0x9A, 0x67, 0x98, 0x57, 0xAA, 0x89, 0xB8, 0x68, 0xA7, 0x68, 0xA7, 0x8A, 0xA6, 0x79, 0x96,
-	0x8A, 0x97, 0x9A, 0x87, 0x89, 0x76, 0x9A, 0x77, 0x98, 0x57, 0x86, 0x68, 0xA8, 0x79, 0xA7, 0x68,
-	0x96, 0x7A, 0xA7, 0x8A, 0x97, 0x8B, 0x86, 0x8B, 0x87, 0x98, 0x77, 0xA9, 0x78, 0xA9, 0x67, 0x97,
-	0x57, 0x96, 0x58, 0xA8, 0x79, 0x85, 0x6A, 0xA7, 0x89, 0x88, 0xA9, 0x66, 0x89, 0x87, 0x97, 0x57,
-	0xA8, 0x56, 0x88, 0x79, 0xA7, 0x6A, 0xA7, 0x79, 0x87, 0x99, 0x86, 0x99, 0x86, 0x79, 0x78, 0xAA,
-	0x77, 0xBB, 0x88, 0x99, 0x68, 0xA8, 0x57, 0x96, 0x67, 0x75, 0x79, 0x96, 0x6A, 0x96, 0x8A, 0x86,
-	0xAA, 0x85, 0x8A, 0x86, 0x98, 0x57, 0xA9, 0x77, 0x99, 0x8A, 0xB8, 0x69, 0x96, 0x69, 0x96, 0x69,
-	0x85, 0x7B, 0x96, 0x8B, 0x97, 0xAB, 0x66, 0xA9, 0x67, 0x98, 0x67, 0x97, 0x47, 0xA7, 0x59, 0xA7,
-	0x7A, 0xA6, 0x59, 0x96, 0x6A, 0x96, 0x8B, 0x85, 0x8A, 0x76, 0x9A, 0x77, 0xBB, 0x67, 0xB9, 0x67,
-	0xB9, 0x68, 0xB8, 0x69, 0xA7, 0x68, 0x95, 0x6A, 0x96, 0x7A, 0x96, 0x8B, 0x85, 0x8B, 0x76, 0x9A,
-	0x75, 0x88, 0x76, 0x99, 0x57, 0xA8, 0x58, 0xA7, 0x7A, 0xC7, 0x6A, 0xB6, 0x59, 0x95, 0x7B, 0x85,
-	0x7A, 0x96, 0x89, 0x76, 0xAA, 0x66, 0xAA, 0x56, 0xA9, 0x68, 0xB8, 0x58, 0xC8, 0x58, 0xA8, 0x7A,
-	0xA6, 0x5A, 0xA5, 0x5A, 0x85, 0x7A, 0x85, 0x8B, 0x85, 0x8B, 0x86, 0xAB, 0x76, 0xAA, 0x66, 0xAA,
-	0x57, 0xA7, 0x59, 0xA7, 0x59, 0xB8, 0x6A, 0xB6, 0x6B, 0xA5, 0x6A, 0x96, 0x7B, 0x95, 0x8B, 0x75,
-	0x99, 0x66, 0xA9, 0x57, 0xBA, 0x58, 0xB8, 0x59, 0xA7, 0x69, 0xA7, 0x6A, 0xA6, 0x7A, 0x85, 0x9A,
-	0x76, 0x9A, 0x76, 0xAB, 0x66, 0xA9, 0x68, 0xB8, 0x69, 0xB9, 0x69, 0xA7, 0x69, 0x86, 0x8A, 0x86,
-	0x8A, 0x97, 0x9A, 0x66, 0xA9, 0x67, 0xB9, 0x67, 0xA9, 0x67, 0xA8, 0x58, 0xA7, 0x78, 0x97, 0x69,
-	0x96, 0x79, 0x75, 0x7A, 0x87, 0x9A, 0x87, 0x9A, 0x76, 0x9A, 0x77, 0x98, 0x77, 0x87, 0x89, 0x87,
-	0x79, 0x97, 0x79, 0x98, 0x88, 0x88, 0x88, 0x76, 0x8A, 0x98, 0x87, 0x89, 0x97, 0x7A, 0xA7, 0x78,
-	0x97, 0x67, 0x76, 0x79, 0x88, 0x9A, 0x97, 0x9A, 0x87, 0xA8, 0x67, 0xA9, 0x57, 0xA8, 0x56, 0xA8,
-	0x57, 0xB9, 0x69, 0xA8, 0x7A, 0x95, 0x5A, 0x94, 0x5A, 0x96, 0x8B, 0x86, 0x9B, 0x84, 0x8C, 0x95,
-	0x9B, 0x86, 0x99, 0x66, 0xAA, 0x56, 0xCA, 0x78, 0xC9, 0x58, 0xB8, 0x57, 0xA7, 0x49, 0xB8, 0x6A,
-	0xB6, 0x6A, 0xB6, 0x59, 0x86, 0x8B, 0x84, 0x7A, 0x84, 0x7A, 0x84, 0x7B, 0x86, 0xAA, 0x65, 0xAA,
-	0x65, 0x99, 0x66, 0xA9, 0x68, 0xB8, 0x68, 0xA7, 0x47, 0xA7, 0x59, 0xC7, 0x69, 0xB8, 0x69, 0x96,
-	0x7A, 0x96, 0x8C, 0x95, 0x79, 0x76, 0x89, 0x66, 0x9B, 0x86, 0xAB, 0x86, 0x99, 0x76, 0x88, 0x67,
-	0xA8, 0x69, 0xA7, 0x68, 0xA7, 0x58, 0xA8, 0x69, 0xB7, 0x69, 0x97, 0x89, 0x96, 0x7B, 0x97, 0x9A,
-	0x86, 0x8A, 0x75, 0x88, 0x65, 0x8A, 0x77, 0x99, 0x77, 0xA9, 0x77, 0x89, 0x78, 0x97, 0x68, 0x96,
-	0x5A, 0xA7, 0x58, 0xB8, 0x69, 0xA7, 0x7A, 0x97, 0x7A, 0x96, 0x7A, 0x86, 0x7A, 0x86, 0x8B, 0x86,
-	0x8B, 0x85, 0x9A, 0x76, 0x8A, 0x86, 0x8A, 0x88, 0xA9, 0x77, 0x98, 0x57, 0xA8, 0x67, 0xA9, 0x76,
-	0x98, 0x67, 0x98, 0x79, 0xA7, 0x7A, 0xA8, 0x79, 0x95, 0x79, 0x86, 0x79, 0x97, 0x8A, 0x85, 0x79,
-	0x85, 0x7A, 0x87, 0x8A, 0xA7, 0x9A, 0x76, 0xA8, 0x67, 0x9A, 0x76, 0xAA, 0x76, 0x89, 0x66, 0x98,
-	0x77, 0x99, 0x89, 0xA8, 0x68, 0x96, 0x57, 0xA8, 0x68, 0x98, 0x78, 0x87, 0x78, 0x97, 0x78, 0xA7,
-	0x69, 0xA8, 0x89, 0x97, 0x78, 0x87, 0x89, 0x97, 0x7A, 0x96, 0x89, 0x86, 0x79, 0x98, 0x79, 0x98,
-	0x89, 0x87, 0x88, 0x67, 0x89, 0x75, 0x88, 0x87, 0x99, 0x77, 0x89, 0x99, 0x88, 0x99, 0x98, 0x79,
-	0x87, 0x77, 0x98, 0x87, 0x88, 0x98, 0x88, 0x79, 0x87, 0x98, 0x87, 0x79, 0x98, 0x8A, 0x97, 0x78,
-	0x86, 0x77, 0x88, 0x88, 0x67, 0x98, 0x77, 0x88, 0x87, 0x88, 0x89, 0x89, 0x89, 0x87, 0x88, 0x87,
-	0x78, 0x88, 0x79, 0x98, 0x78, 0x97, 0x87, 0x89, 0x88, 0x88, 0x99, 0x67, 0x88, 0x87, 0x79, 0x88,
-	0x7A, 0x87, 0x79, 0x87, 0x88, 0x98, 0x97, 0x89, 0xA9, 0x67, 0x99, 0x76, 0x99, 0x86, 0xA9, 0x77,
-	0x88, 0x78, 0x89, 0x99, 0x89, 0x89, 0x96, 0x69, 0x98, 0x68, 0x98, 0x67, 0x88, 0x78, 0x87, 0x98,
-	0x88, 0x87, 0x89, 0x98, 0x77, 0x88, 0x77, 0x88, 0x96, 0x89, 0x87, 0x78, 0x89, 0x88, 0x89, 0x87,
-	0x99, 0x97, 0x8A, 0x87, 0x89, 0x77, 0x68, 0x88, 0x78, 0x98, 0x99, 0x88, 0xA7, 0x78, 0x98, 0x68,
-	0x99, 0x78, 0xA8, 0x68, 0x98, 0x66, 0x98, 0x79, 0x98, 0x79, 0x97, 0x79, 0x96, 0x69, 0xA7, 0x89,
-	0xA7, 0x89, 0x86, 0x79, 0x86, 0x7A, 0x87, 0x8B, 0x97, 0x9A, 0x76, 0x89, 0x75, 0x8B, 0x86, 0x99,
-	0x87, 0x89, 0x85, 0x89, 0x77, 0xA9, 0x87, 0x99, 0x87, 0x89, 0x67, 0x88, 0x79, 0x88, 0x79, 0x99,
-	0x68, 0x87, 0x79, 0x97, 0x89, 0xA7, 0x7A, 0xA7, 0x67, 0xA6, 0x78, 0x96, 0x8A, 0xA8, 0x8A, 0xA5,
-	0x6A, 0x87, 0x68, 0x87, 0x7A, 0x97, 0x79, 0x87, 0x78, 0x77, 0x79, 0x9A, 0x99, 0x77, 0x88, 0x76,
-	0x87, 0x77, 0x9A, 0x98, 0x98, 0x78, 0x96, 0x67, 0x98, 0x89, 0xBA, 0x88, 0xA8, 0x77, 0x67, 0x68,
-	0xA9, 0x89, 0xA9, 0x79, 0x87, 0x56, 0x78, 0x88, 0xA9, 0x8A, 0xA9, 0x67, 0x87, 0x67, 0x98, 0x87,
-	0x99, 0x98, 0x88, 0x77, 0x88, 0x78, 0x89, 0x99, 0x89, 0x87, 0x76, 0x77, 0x68, 0x88, 0x9A, 0x98,
-	0x88, 0x97, 0x77, 0x87, 0x68, 0xA8, 0x78, 0x98, 0x88, 0x86, 0x68, 0x97, 0x79, 0xA7, 0x89, 0xA7,
-	0x58, 0x87, 0x7A, 0xA7, 0x7A, 0xA8, 0x78, 0x86, 0x69, 0x97, 0x7A, 0xA9, 0x8B, 0xA6, 0x59, 0x97,
-	0x69, 0xA8, 0x8A, 0xA8, 0x68, 0x85, 0x69, 0x86, 0x7B, 0xB8, 0x79, 0x96, 0x78, 0x75, 0x79, 0x98,
-	0x9A, 0x86, 0x79, 0x75, 0x69, 0x88, 0x8A, 0x87, 0x79, 0x86, 0x79, 0x86, 0x7A, 0x97, 0x89, 0x87,
-	0x89, 0x87, 0x79, 0x87, 0x8A, 0x97, 0x89, 0x97, 0x89, 0x97, 0x89, 0x87, 0x89, 0x87, 0x79, 0x88,
-	0x79, 0x98, 0x79, 0x98, 0x79, 0x97, 0x68, 0xA7, 0x69, 0xA8, 0x68, 0x97, 0x68, 0x97, 0x6A, 0xA7,
-	0x7A, 0x97, 0x68, 0xA7, 0x68, 0x97, 0x79, 0x97, 0x78, 0x87, 0x79, 0x97, 0x79, 0x99, 0x77, 0x99,
-	0x77, 0x98, 0x77, 0x88, 0x87, 0x99, 0x68, 0xA9, 0x66, 0xA8, 0x68, 0x99, 0x78, 0xA8, 0x68, 0x87,
-	0x68, 0x98, 0x78, 0x98, 0x88, 0x88, 0x78, 0x88, 0x87, 0x9A, 0x98, 0x99, 0x77, 0x87, 0x66, 0x89,
-	0x98, 0x99, 0x98, 0x97, 0x77, 0x77, 0x78, 0x89, 0x98, 0x9A, 0x97, 0x68, 0x87, 0x79, 0x98, 0x9A,
-	0x97, 0x98, 0x65, 0x78, 0x77, 0x9A, 0x99, 0xAA, 0x88, 0x86, 0x66, 0x66, 0x79, 0x99, 0x9A, 0xA9,
-	0x88, 0x77, 0x77, 0x68, 0x98, 0x79, 0x97, 0x88, 0x76, 0x89, 0x87, 0x9B, 0xA7, 0x99, 0x85, 0x77,
-	0x66, 0x88, 0x99, 0xAA, 0x99, 0x98, 0x87, 0x67, 0x87, 0x68, 0xA9, 0x78, 0xA8, 0x67, 0x98, 0x78,
-	0x97, 0x79, 0x97, 0x78, 0x97, 0x79, 0x98, 0x78, 0x98, 0x87, 0x78, 0x87, 0x79, 0x98, 0x99, 0x87,
-	0x99, 0x76, 0x9A, 0x77, 0xAA, 0x87, 0x88, 0x78, 0x78, 0x78, 0x88, 0x89, 0x98, 0x87, 0x78, 0x87,
-	0x68, 0xA8, 0x79, 0xA8, 0x77, 0x87, 0x79, 0x87, 0x8A, 0x97, 0x89, 0x87, 0x78, 0x88, 0x77, 0x89,
-	0xA8, 0x79, 0x97, 0x78, 0x87, 0x88, 0x87, 0x9A, 0x87, 0x89, 0x76, 0x88, 0x77, 0x88, 0x89, 0x98,
-	0x78, 0x87, 0x78, 0x88, 0x89, 0x89, 0x98, 0x78, 0x87, 0x87, 0x77, 0x98, 0x78, 0xAA, 0x77, 0x99,
-	0x87, 0x88, 0x99, 0x87, 0x79, 0x87, 0x79, 0x97, 0x78, 0x98, 0x98, 0x78, 0x99, 0x77, 0x99, 0x87,
-	0x99, 0x87, 0x88, 0x89, 0x97, 0x79, 0x97, 0x67, 0x88, 0x88, 0x98, 0x99, 0x87, 0x89, 0x77, 0x89,
-	0x87, 0x89, 0x88, 0x88, 0x77, 0x98, 0x77, 0x99, 0x88, 0x98, 0x78, 0x88, 0x79, 0x97, 0x89, 0xA8,
-	0x78, 0x88, 0x88, 0x87, 0x89, 0x87, 0x89, 0x87, 0x79, 0x87, 0x88, 0x99, 0x98, 0x77, 0x88, 0x77,
-	0x88, 0x78, 0x98, 0x78, 0x98, 0x78, 0x98, 0x78, 0xA9, 0x77, 0x98, 0x77, 0x98, 0x77, 0x9A, 0x88,
-	0xAA, 0x76, 0x89, 0x76, 0x89, 0x87, 0x9A, 0x97, 0x8A, 0x97, 0x79, 0x97, 0x79, 0x98, 0x78, 0x97,
-	0x78, 0x98, 0x77, 0x98, 0x77, 0x88, 0x87, 0x78, 0x87, 0x78, 0x88, 0x79, 0xA8, 0x78, 0xA8, 0x67,
-	0xA9, 0x76, 0x99, 0x76, 0x89, 0x87, 0x88, 0x77, 0x89, 0x76, 0x8A, 0x87, 0x8A, 0x97, 0x89, 0x87,
-	0x89, 0x86, 0x7A, 0x96, 0x79, 0xA7, 0x68, 0xA8, 0x78, 0x98, 0x88, 0x98, 0x78, 0x98, 0x77, 0x99,
-	0x77, 0x89, 0x97, 0x77, 0x98, 0x88, 0x99, 0x77, 0x88, 0x77, 0x89, 0x76, 0x8A, 0x96, 0x7A, 0xA7,
-	0x69, 0xA8, 0x68, 0xA8, 0x78, 0xA8, 0x68, 0xA8, 0x67, 0xAA, 0x77, 0x9A, 0x77, 0x89, 0x87, 0x89,
-	0x87, 0x8A, 0x86, 0x79, 0x96, 0x79, 0x98, 0x78, 0x98, 0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x77,
-	0x78, 0x88, 0x77, 0x98, 0x87, 0x88, 0x87, 0x79, 0x88, 0x89, 0x88, 0x89, 0x87, 0x89, 0x97, 0x79,
-	0x97, 0x89, 0xA7, 0x88, 0x97, 0x78, 0xA8, 0x69, 0x98, 0x57, 0x99, 0x77, 0x99, 0x88, 0x99, 0x77,
-	0x98, 0x76, 0x89, 0x87, 0x8A, 0x87, 0x79, 0x86, 0x79, 0x97, 0x8A, 0xA7, 0x79, 0x97, 0x68, 0xA8,
-	0x79, 0xA9, 0x87, 0x88, 0x66, 0x89, 0x88, 0xA9, 0x88, 0x88, 0x76, 0x77, 0x98, 0x98, 0x99, 0x98,
-	0x77, 0x77, 0x78, 0x99, 0x99, 0x98, 0x77, 0x77, 0x67, 0x99, 0x88, 0x9A, 0x86, 0x78, 0x76, 0x89,
-	0x87, 0x8B, 0x96, 0x68, 0x86, 0x68, 0xA8, 0x89, 0xB9, 0x67, 0x88, 0x67, 0x88, 0x88, 0xAA, 0x87,
-	0x78, 0x97, 0x77, 0x99, 0x98, 0x88, 0x87, 0x78, 0x78, 0x89, 0x99, 0x89, 0x99, 0x76, 0x78, 0x77,
-	0x89, 0x98, 0x99, 0x98, 0x78, 0x77, 0x88, 0x87, 0x89, 0x97, 0x78, 0x98, 0x88, 0x99, 0x89, 0x98,
-	0x66, 0x88, 0x67, 0x9A, 0x89, 0x9A, 0x86, 0x89, 0x86, 0x78, 0x98, 0x89, 0x97, 0x78, 0x88, 0x78,
-	0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x9A, 0x98, 0x89, 0x87, 0x77, 0x76, 0x88, 0x98, 0x99, 0x98,
-	0x88, 0x76, 0x79, 0x98, 0x78, 0x98, 0x77, 0x98, 0x77, 0x9A, 0x87, 0x9A, 0x86, 0x79, 0x96, 0x69,
-	0xA8, 0x67, 0x98, 0x67, 0x99, 0x77, 0x9A, 0x86, 0x8A, 0x96, 0x69, 0x96, 0x67, 0xA8, 0x67, 0x99,
-	0x77, 0x9A, 0x86, 0x89, 0x86, 0x79, 0xA7, 0x69, 0xA9, 0x68, 0x99, 0x77, 0x89, 0x87, 0x89, 0x97,
-	0x89, 0x97, 0x79, 0x88, 0x79, 0x88, 0x78, 0x98, 0x88, 0x98, 0x88, 0x99, 0x78, 0x89, 0x87, 0x79,
-	0x87, 0x88, 0x98, 0x78, 0x98, 0x78, 0x99, 0x77, 0x89, 0x98, 0x79, 0x98, 0x77, 0x88, 0x88, 0x98,
-	0x78, 0x98, 0x78, 0x88, 0x98, 0x78, 0x88, 0x98, 0x88, 0x88, 0x88, 0x98, 0x88, 0x98, 0x77, 0x8A,
-	0x87, 0x88, 0x97, 0x78, 0x98, 0x78, 0x89, 0x87, 0x89, 0x97, 0x88, 0x97, 0x68, 0x98, 0x77, 0x89,
-	0x77, 0x99, 0x97, 0x79, 0x97, 0x78, 0x98, 0x77, 0x99, 0x77, 0x89, 0x96, 0x69, 0x98, 0x78, 0x99,
-	0x66, 0x89, 0x77, 0x8A, 0xA7, 0x68, 0x97, 0x67, 0x9A, 0x77, 0x9A, 0x97, 0x78, 0x97, 0x78, 0xA9,
-	0x88, 0x99, 0x76, 0x79, 0x99, 0x89, 0x99, 0x77, 0x88, 0x77, 0x7A, 0x98, 0x78, 0xA9, 0x75, 0x79,
-	0x87, 0x79, 0xB9, 0x77, 0x88, 0x76, 0x89, 0x98, 0x87, 0xA9, 0x67, 0x79, 0x97, 0x69, 0xA9, 0x76,
-	0x99, 0x75, 0x8A, 0x87, 0x69, 0xB7, 0x57, 0x99, 0x87, 0x8A, 0x87, 0x79, 0x97, 0x68, 0xA9, 0x77,
-	0x99, 0x87, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x76, 0x89, 0x97, 0x89, 0x98, 0x78, 0x98,
-	0x77, 0x98, 0x77, 0x99, 0x87, 0x79, 0xA8, 0x78, 0x98, 0x78, 0x89, 0x77, 0x89, 0xA8, 0x68, 0x98,
-	0x87, 0x8A, 0x97, 0x78, 0x98, 0x77, 0x89, 0x88, 0x79, 0x97, 0x78, 0x88, 0x87, 0x78, 0x9A, 0x97,
-	0x89, 0x88, 0x68, 0xA8, 0x77, 0x99, 0x87, 0x7A, 0xA7, 0x68, 0xA8, 0x77, 0x99, 0x77, 0x89, 0x87,
-	0x8A, 0x87, 0x78, 0x88, 0x88, 0x98, 0x78, 0xA8, 0x78, 0x89, 0x87, 0x88, 0x78, 0x88, 0x97, 0x79,
-	0x87, 0x89, 0x98, 0x78, 0x98, 0x77, 0x9A, 0x86, 0x79, 0x98, 0x78, 0x9A, 0x77, 0x89, 0x97, 0x79,
-	0xA9, 0x76, 0x9A, 0x96, 0x78, 0x98, 0x78, 0x89, 0x88, 0x89, 0x88, 0x77, 0x89, 0x86, 0x68, 0xA8,
-	0x77, 0xAB, 0x75, 0x8A, 0x97, 0x68, 0xA8, 0x67, 0xAA, 0x85, 0x88, 0x89, 0x78, 0x88, 0x88, 0x88,
-	0x99, 0x76, 0x89, 0x96, 0x68, 0x98, 0x67, 0x9B, 0x85, 0x8A, 0x98, 0x68, 0xA9, 0x87, 0x89, 0x88,
-	0x78, 0x89, 0x97, 0x88, 0x99, 0x87, 0x99, 0x87, 0x69, 0x98, 0x77, 0x99, 0x76, 0x7A, 0xA8, 0x68,
-	0xA9, 0x76, 0x8A, 0x86, 0x69, 0xA9, 0x77, 0x99, 0x87, 0x78, 0x88, 0x88, 0x79, 0x97, 0x67, 0xAA,
-	0x75, 0x8A, 0xA6, 0x69, 0xB8, 0x67, 0x99, 0x87, 0x79, 0x88, 0x88, 0x79, 0x98, 0x77, 0x89, 0x77,
-	0x8A, 0xA7, 0x68, 0x97, 0x67, 0x89, 0x87, 0x99, 0x87, 0x88, 0x87, 0x88, 0x88, 0x89, 0x88, 0x87,
-	0x87, 0x88, 0x89, 0x88, 0x98, 0x89, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0xA8, 0x88, 0x88, 0x87, 0x78, 0x88, 0x86, 0x89, 0x88, 0x77, 0x99, 0x77, 0x89, 0x97, 0x79, 0x98,
-	0x87, 0x89, 0x88, 0x77, 0x99, 0x87, 0x79, 0xB9, 0x66, 0x89, 0x97, 0x79, 0x98, 0x77, 0x78, 0x88,
-	0x87, 0x9A, 0x97, 0x79, 0x98, 0x56, 0x9A, 0x87, 0x79, 0xA7, 0x66, 0x89, 0x98, 0x78, 0x9A, 0x86,
-	0x68, 0xA8, 0x66, 0xAA, 0x86, 0x69, 0xA7, 0x67, 0x8A, 0x98, 0x77, 0x8A, 0x86, 0x68, 0xB9, 0x76,
-	0x8A, 0x96, 0x67, 0x98, 0x87, 0x78, 0x99, 0x86, 0x79, 0x97, 0x67, 0xAA, 0x86, 0x89, 0x98, 0x87,
-	0x89, 0x98, 0x77, 0x99, 0x88, 0x78, 0x98, 0x77, 0x89, 0x88, 0x87, 0x88, 0x98, 0x78, 0x89, 0x87,
-	0x79, 0x98, 0x78, 0x88, 0x78, 0x88, 0x87, 0x98, 0x88, 0x99, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x89, 0x98, 0x78, 0x89, 0x87, 0x88, 0x98, 0x77, 0x78, 0x88, 0x78, 0x89, 0x98, 0x77, 0x89,
-	0x87, 0x78, 0x98, 0x77, 0x89, 0x97, 0x78, 0x99, 0x87, 0x78, 0x99, 0x77, 0x89, 0x98, 0x77, 0x89,
-	0x98, 0x67, 0xAA, 0x96, 0x68, 0xA9, 0x86, 0x79, 0x98, 0x77, 0x9A, 0x88, 0x67, 0x89, 0xA7, 0x67,
-	0x88, 0x88, 0x79, 0x88, 0x97, 0x78, 0x89, 0x77, 0x89, 0x87, 0x79, 0x97, 0x79, 0x88, 0x77, 0xA8,
-	0x9A, 0x88, 0x77, 0x9A, 0x87, 0x88, 0x98, 0x79, 0x88, 0x97, 0x77, 0x7A, 0xA7, 0x77, 0x89, 0x87,
-	0x77, 0x89, 0x86, 0x77, 0xAA, 0x76, 0x77, 0x98, 0x77, 0x88, 0x98, 0x78, 0x88, 0x98, 0x78, 0x89,
-	0x98, 0x88, 0x89, 0x98, 0x88, 0x88, 0x77, 0x99, 0x87, 0x78, 0x98, 0x88, 0x78, 0x88, 0x97, 0x79,
-	0x99, 0x77, 0x8A, 0x98, 0x77, 0x88, 0x88, 0x67, 0x99, 0x97, 0x78, 0x99, 0x97, 0x78, 0x9A, 0xA6,
-	0x69, 0x98, 0x75, 0x79, 0x99, 0x76, 0x8B, 0xA8, 0x66, 0xAA, 0x98, 0x66, 0x89, 0x87, 0x57, 0xA9,
-	0x75, 0x6A, 0xB9, 0x76, 0x79, 0xA8, 0x77, 0x79, 0xA8, 0x66, 0x9B, 0x97, 0x67, 0x9A, 0xA8, 0x77,
-	0x8A, 0xA6, 0x68, 0xA9, 0x76, 0x68, 0xAA, 0x86, 0x68, 0xAA, 0x75, 0x69, 0xA9, 0x87, 0x89, 0x99,
-	0x65, 0x79, 0xA9, 0x76, 0x78, 0x99, 0x86, 0x8A, 0xA9, 0x76, 0x89, 0x99, 0x76, 0x79, 0xA9, 0x76,
-	0x89, 0x88, 0x77, 0x8A, 0x98, 0x77, 0x89, 0x98, 0x67, 0x89, 0x98, 0x77, 0x8A, 0x98, 0x67, 0x9A,
-	0x87, 0x67, 0x8A, 0x98, 0x66, 0x89, 0x87, 0x68, 0x89, 0x97, 0x67, 0x9A, 0x98, 0x77, 0x99, 0x98,
-	0x76, 0x8A, 0x98, 0x77, 0x9A, 0x98, 0x66, 0x89, 0x98, 0x67, 0x89, 0x88, 0x77, 0x79, 0x98, 0x67,
-	0x89, 0x99, 0x87, 0x78, 0x99, 0x87, 0x88, 0x98, 0x88, 0x88, 0x99, 0x87, 0x78, 0x98, 0x88, 0x87,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88,
-	0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x89, 0x87, 0x89, 0x88, 0x88, 0x78, 0x99, 0x78, 0x89, 0x78,
-	0x99, 0x78, 0x89, 0x88, 0x88, 0x88, 0x98, 0x77, 0x98, 0x88, 0x87, 0x78, 0x97, 0x77, 0x98, 0x78,
-	0x87, 0x79, 0x88, 0x89, 0x88, 0x79, 0x88, 0x89, 0x97, 0x88, 0x87, 0x98, 0x87, 0x88, 0x86, 0x78,
-	0x88, 0x99, 0x77, 0x89, 0x89, 0x88, 0x78, 0x99, 0x87, 0x88, 0x88, 0xA8, 0x77, 0x98, 0x98, 0x88,
-	0x68, 0x9A, 0x88, 0x78, 0x78, 0x98, 0x76, 0x88, 0x97, 0x88, 0x87, 0x99, 0x78, 0x88, 0x78, 0x88,
-	0x78, 0x99, 0x87, 0x88, 0x88, 0x98, 0x77, 0x89, 0x88, 0x88, 0x88, 0x99, 0x87, 0x88, 0x78, 0x87,
-	0x77, 0x99, 0x88, 0x88, 0x89, 0x99, 0x88, 0x89, 0x88, 0x88, 0x78, 0x99, 0x87, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x78, 0x88, 0x78,
-	0x88, 0x87, 0x98, 0x99, 0x99, 0x99, 0x98, 0x88, 0x87, 0x78, 0x77, 0x77, 0x77, 0x88, 0x78, 0x88,
-	0x89, 0x98, 0x99, 0x99, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x77, 0x76, 0x77,
-	0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x77, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x88,
-	0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x65, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x88, 0x89, 0x89,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0xAA,
-	0xAA, 0xAB, 0xAB, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x88, 0x77, 0x77, 0x66, 0x66, 0x56, 0x56, 0x55,
-	0x55, 0x56, 0x66, 0x66, 0x66, 0x67, 0x67, 0x77, 0x78, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0xAA,
-	0xAB, 0xAB, 0xBB, 0xBB, 0xBB, 0xAB, 0xAA, 0xAA, 0xAA, 0x9A, 0x99, 0x88, 0x88, 0x87, 0x77, 0x77,
-	0x66, 0x65, 0x55, 0x55, 0x56, 0x66, 0x67, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x99, 0x9A, 0xAA, 0xBA, 0xAA, 0xBB, 0xAA, 0xAA,
-	0xAA, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x87, 0x77, 0x66, 0x66, 0x65, 0x55, 0x55, 0x56, 0x66, 0x66,
-	0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA,
-	0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xA9, 0x99, 0x88, 0x88, 0x77, 0x76, 0x65, 0x55, 0x55, 0x55,
-	0x55, 0x56, 0x66, 0x76, 0x77, 0x78, 0x78, 0x98, 0x89, 0x99, 0x99, 0x99, 0x88, 0x98, 0x88, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x89, 0x9A, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x67, 0x66
+	0xEF, 0xA8, 0x06, 0x46, 0xCF, 0x6B, 0x44, 0x4F, 0xE0, 0x2C, 0x1B, 0x66, 0x9D, 0x31, 0xA8, 0xB7,
+	0x32, 0x6A, 0xF8, 0x44, 0x88, 0xBB, 0xD4, 0x0B, 0xB8, 0x5A, 0x18, 0x46, 0x5F, 0xE3, 0x00, 0xDF,
+	0x55, 0xD1, 0x31, 0x85, 0xE8, 0x56, 0x25, 0xB0, 0x46, 0x8F, 0xBA, 0x64, 0xC4, 0xA2, 0x07, 0x88,
+	0xCE, 0xDB, 0x32, 0x4A, 0xD1, 0x79, 0x46, 0x27, 0xB0, 0x11, 0x41, 0xA0, 0x3F, 0xC6, 0x0E, 0x3C,
+	0x13, 0x83, 0xB4, 0x6F, 0xCB, 0x12, 0xCA, 0x1B, 0x99, 0x09, 0x60, 0xE9, 0x8D, 0x64, 0x51, 0x5A,
+	0xD5, 0xB0, 0x75, 0x1C, 0xC2, 0x2B, 0x88, 0x8E, 0x7C, 0x44, 0x46, 0xAC, 0x77, 0x06, 0x25, 0x78,
+	0x22, 0x08, 0x1E, 0xAA, 0x75, 0x0D, 0x5B, 0x18, 0x23, 0x87, 0x74, 0x68, 0x9C, 0x3A, 0x5E, 0xB0,
+	0x23, 0xB9, 0x38, 0x14, 0x27, 0xA8, 0x89, 0xF2, 0x54, 0xDD, 0x03, 0x93, 0xE4, 0x41, 0xBC, 0xC0,
+	0x7F, 0x30, 0x4F, 0x32, 0x7A, 0x42, 0x08, 0xF0, 0x34, 0xBC, 0x03, 0x1B, 0xC3, 0x11, 0x78, 0xA0,
+	0x83, 0x44, 0xA2, 0xE1, 0x4D, 0x29, 0x63, 0x0B, 0x1A, 0xC2, 0x50, 0xC6, 0xA2, 0x32, 0x3D, 0x82,
+	0x0E, 0xD4, 0xA1, 0x70, 0xF4, 0x36, 0x31, 0x75, 0x4C, 0x69, 0x22, 0x53, 0x80, 0x08, 0xF8, 0x31,
+	0x27, 0x88, 0xC4, 0x31, 0x1E, 0x9C, 0x16, 0x06, 0xFE, 0x67, 0x60, 0x2D, 0x62, 0x91, 0x9E, 0x65,
+	0xD8, 0x98, 0x80, 0x7B, 0x1D, 0x59, 0x21, 0x7C, 0x00, 0x82, 0xF4, 0x6E, 0xB9, 0x98, 0x8F, 0xA5,
+	0xDC, 0x60, 0x2F, 0xE8, 0x48, 0x13, 0xA8, 0x97, 0x81, 0x57, 0x3E, 0x26, 0x03, 0xE9, 0x7A, 0xD4,
+	0x90, 0xB3, 0x85, 0x05, 0x99, 0x2B, 0xB0, 0x05, 0x2D, 0x14, 0x1C, 0x82, 0x16, 0xB7, 0x11, 0x03,
+	0x12, 0x4F, 0xE1, 0x44, 0xEE, 0x17, 0x12, 0x84, 0xC0, 0xFE, 0x12, 0x42, 0xC6, 0xCF, 0x73, 0x25,
+	0x5D, 0x28, 0x59, 0x18, 0x97, 0xB4, 0xC4, 0xC4, 0xAA, 0x6F, 0x4E, 0x6E, 0x58, 0x76, 0x0A, 0xC6,
+	0xAD, 0x37, 0x84, 0x78, 0x72, 0x85, 0xE9, 0x37, 0xB1, 0x6B, 0x1C, 0x39, 0x4A, 0xD4, 0x9F, 0xD1,
+	0xB5, 0x0E, 0x0C, 0xE5, 0x0C, 0x16, 0xA5, 0x68, 0x56, 0x06, 0x70, 0x67, 0x2A, 0x62, 0x75, 0x27,
+	0xE6, 0x78, 0x37, 0x91, 0x82, 0x3A, 0x21, 0xE1, 0x1C, 0xB9, 0x82, 0xB4, 0xBD, 0x52, 0xD0, 0xCA,
+	0x1C, 0xC5, 0x5E, 0x15, 0xC5, 0x68, 0x55, 0x8A, 0xF0, 0xC6, 0x06, 0x85, 0x7C, 0x42, 0x57, 0xB1,
+	0x76, 0x85, 0x23, 0x1E, 0x39, 0x81, 0xB1, 0x0B, 0xDC, 0x98, 0x3A, 0x1C, 0xE1, 0xCB, 0x0C, 0xE5,
+	0x6A, 0x57, 0x00, 0x62, 0xA7, 0x0E, 0x62, 0x6F, 0x72, 0x62, 0x6E, 0x53, 0x95, 0x2C, 0x42, 0xB1,
+	0xEA, 0x1C, 0x11, 0xE3, 0x98, 0xAB, 0x4B, 0xB5, 0x8F, 0x14, 0xC0, 0xCC, 0x56, 0xC8, 0xE8, 0x86,
+	0x06, 0x78, 0x86, 0x0A, 0x62, 0xB5, 0x42, 0xC4, 0x30, 0x73, 0x85, 0x30, 0x56, 0xA3, 0xAA, 0x16,
+	0xA1, 0xC3, 0x98, 0x29, 0x8A, 0xD5, 0x1D, 0x08, 0xD5, 0x0B, 0x1C, 0xE5, 0x5C, 0x56, 0x05, 0x78,
+	0x87, 0x8A, 0x52, 0xAE, 0x26, 0x72, 0x34, 0x63, 0xC6, 0x38, 0x33, 0x15, 0xAA, 0x3A, 0xA1, 0x2B,
+	0x9A, 0x31, 0xE2, 0x94, 0xAB, 0x8A, 0xB8, 0xAB, 0x58, 0xD1, 0x0E, 0x14, 0xC0, 0xDC, 0xC6, 0x88,
+	0x5A, 0xC7, 0x0A, 0x70, 0xA5, 0x0E, 0xE2, 0xB4, 0x23, 0x05, 0x39, 0x53, 0x93, 0xAA, 0x16, 0xB1,
+	0xA3, 0x98, 0x2B, 0x58, 0xD1, 0x0D, 0x10, 0xD1, 0x4A, 0x55, 0xC8, 0xEA, 0x86, 0x8A, 0x62, 0x6E,
+	0x2A, 0x64, 0x3C, 0x73, 0x05, 0x30, 0x53, 0x05, 0x6A, 0x3A, 0x11, 0xA3, 0x98, 0x2B, 0x8B, 0xB0,
+	0x9F, 0x10, 0xF1, 0x0D, 0x14, 0xA0, 0xE2, 0xAE, 0x0C, 0x78, 0x85, 0x10, 0x49, 0x37, 0x6A, 0x59,
+	0x52, 0x9C, 0x39, 0xA1, 0x3E, 0x99, 0x93, 0xA0, 0x9D, 0xD1, 0xF1, 0x5A, 0x5D, 0xE5, 0x5C, 0x1D,
+	0xA9, 0x5C, 0x85, 0x8A, 0x78, 0xE6, 0x0A, 0x52, 0xAE, 0x47, 0xD4, 0x6F, 0x42, 0xD4, 0x34, 0x63,
+	0x85, 0x28, 0x77, 0x13, 0xA9, 0x5A, 0xB3, 0xA2, 0x1E, 0x21, 0xA1, 0x18, 0xAD, 0x4A, 0xB8, 0xAB,
+	0x8B, 0xB5, 0xCD, 0x18, 0xD1, 0x4A, 0x1C, 0xC4, 0xEA, 0x56, 0xA8, 0xEA, 0xCE, 0x84, 0xEA, 0xA6,
+	0x0E, 0x62, 0xAF, 0x22, 0xC4, 0x3C, 0x67, 0x56, 0x34, 0x23, 0x42, 0x39, 0x77, 0x21, 0xA1, 0x5A,
+	0xA3, 0x72, 0x3E, 0x11, 0x42, 0x9C, 0xBB, 0x50, 0xD5, 0x1F, 0x50, 0xD1, 0x1D, 0x14, 0xA1, 0xCC,
+	0x01, 0xE1, 0x6A, 0xC7, 0x8C, 0x68, 0x55, 0xA8, 0x68, 0xE5, 0x8E, 0x60, 0xED, 0x0E, 0xD4, 0xAE,
+	0x2F, 0x54, 0x2C, 0x2B, 0x54, 0x70, 0x33, 0xC5, 0x39, 0x56, 0x97, 0x3C, 0x52, 0x95, 0x6B, 0x3E,
+	0x31, 0xA2, 0x9C, 0x19, 0x8A, 0x98, 0xAD, 0x89, 0xB8, 0xBB, 0x0B, 0x9C, 0x8F, 0x1D, 0xA5, 0x0F,
+	0x18, 0xD0, 0x8F, 0x1C, 0xA1, 0x48, 0x57, 0xC4, 0xFA, 0x95, 0xA8, 0x58, 0x66, 0x05, 0xF8, 0x97,
+	0x88, 0x50, 0x07, 0x84, 0x62, 0xE7, 0x0E, 0x72, 0x2F, 0x2A, 0x4A, 0xC6, 0x07, 0x55, 0x39, 0x0B,
+	0xD6, 0x25, 0x72, 0xC2, 0x84, 0xD1, 0x89, 0xF3, 0x96, 0x07, 0x26, 0x21, 0xE1, 0x33, 0x95, 0xD1,
+	0x83, 0x94, 0xBB, 0xE2, 0x9C, 0xC2, 0x06, 0xE5, 0xDA, 0x14, 0x1D, 0x40, 0xB1, 0xAB, 0x55, 0x06,
+	0x88, 0x0E, 0xC5, 0xC5, 0x71, 0x09, 0xC2, 0x07, 0xB8, 0x50, 0x60, 0xE9, 0xEE, 0xC8, 0xEC, 0x31,
+	0x63, 0xC9, 0x5B, 0x85, 0x2C, 0x62, 0xF7, 0x28, 0x02, 0xA8, 0x84, 0xE6, 0xBD, 0xC3, 0x93, 0x21,
+	0x71, 0x32, 0xA9, 0x9C, 0x82, 0x74, 0x66, 0xB1, 0xCC, 0x15, 0x7C, 0x9B, 0x81, 0x0B, 0x08, 0xEF,
+	0x70, 0x72, 0xB4, 0x07, 0x4A, 0xC0, 0xC4, 0xD4, 0x38, 0x7E, 0x13, 0xB2, 0x03, 0x95, 0xAA, 0x17,
+	0x07, 0x2A, 0x16, 0xB1, 0xC2, 0x9E, 0x31, 0x81, 0x1C, 0x1B, 0xCA, 0xB8, 0xBB, 0x52, 0xB8, 0x9F,
+	0x50, 0xB9, 0x2B, 0x94, 0x90, 0x8D, 0xD0, 0xA1, 0xCB, 0x10, 0xB8, 0x3E, 0x00, 0xAE, 0x8A, 0xCE,
+	0xE4, 0x50, 0xC7, 0x21, 0x78, 0xC7, 0x81, 0x60, 0x0F, 0x24, 0x78, 0xE7, 0x0A, 0xCA, 0xE4, 0x0E,
+	0x68, 0xA5, 0x8A, 0xC2, 0xC9, 0xBF, 0x83, 0x36, 0x74, 0x06, 0x6E, 0x57, 0x07, 0xE1, 0x54, 0x17,
+	0x70, 0x5A, 0x8A, 0xAB, 0x56, 0x13, 0xBA, 0xB3, 0x90, 0x41, 0x77, 0x31, 0xB0, 0x37, 0x17, 0x25,
+	0x60, 0x68, 0x38, 0x23, 0xA8, 0x84, 0xCB, 0x51, 0x88, 0xEC, 0x44, 0x75, 0x11, 0xF8, 0x0E, 0xCD,
+	0x5A, 0x4E, 0x12, 0x78, 0xCF, 0x0C, 0x70, 0x0F, 0xC8, 0x50, 0xE6, 0x0A, 0x5A, 0xA7, 0x0E, 0x50,
+	0xC4, 0xCE, 0x7A, 0xC5, 0xAC, 0x50, 0xA6, 0xAA, 0x70, 0xE6, 0x28, 0x68, 0x67, 0x06, 0xF2, 0x85,
+	0x27, 0xF0, 0xEE, 0x0E, 0x40, 0xB4, 0x0A, 0xE2, 0xAE, 0x2E, 0x60, 0x6D, 0x2A, 0xF0, 0xE6, 0x2E,
+	0xE2, 0x67, 0x0A, 0x72, 0x6E, 0x26, 0xF0, 0xE8, 0xCC, 0x5C, 0x85, 0xAC, 0x7A, 0xCF, 0x88, 0x5C,
+	0x4E, 0xAC, 0x68, 0xC6, 0x8E, 0x5A, 0x96, 0x84, 0x60, 0xA6, 0x00, 0x60, 0xC7, 0x8E, 0x0D, 0x10,
+	0xD1, 0x4A, 0x0C, 0x1D, 0xCE, 0x8D, 0xE1, 0xDA, 0x80, 0xE1, 0xDC, 0x45, 0xAC, 0xDC, 0x55, 0x80,
+	0x4E, 0xA0, 0x1D, 0xAB, 0x54, 0xF0, 0xDE, 0x19, 0x18, 0x89, 0xCF, 0x90, 0x08, 0xC2, 0x1D, 0x1D,
+	0xE2, 0x92, 0x31, 0x4A, 0xD9, 0x4F, 0x09, 0xA1, 0xAA, 0x0D, 0xF2, 0xF9, 0x21, 0x6C, 0x08, 0xC7,
+	0xA3, 0x40, 0x3B, 0x37, 0x31, 0xCC, 0xB5, 0xAB, 0x5A, 0xB8, 0x8D, 0xC8, 0xB1, 0x83, 0x10, 0xD0,
+	0x69, 0xEA, 0x3A, 0xB7, 0x30, 0x57, 0x05, 0x29, 0x5E, 0x21, 0xA1, 0x3C, 0x21, 0x71, 0x38, 0x68,
+	0x87, 0x0C, 0x52, 0x3D, 0x63, 0xD6, 0x78, 0x52, 0xD2, 0x31, 0xCA, 0x91, 0x23, 0x1A, 0x70, 0x47,
+	0xCD, 0x5A, 0xC6, 0x90, 0xE0, 0xE6, 0x2E, 0xE2, 0x26, 0x06, 0x0F, 0x19, 0x5E, 0xB9, 0x81, 0x95,
+	0x41, 0xD9, 0xD4, 0x2F, 0x14, 0x91, 0x40, 0xA6, 0xAA, 0x60, 0xA0, 0x0B, 0x21, 0xEA, 0x95, 0x60,
+	0x1D, 0xA9, 0xCF, 0x10, 0xB4, 0x84, 0x3E, 0x0E, 0xD2, 0xC7, 0x84, 0xD5, 0xAA, 0x53, 0xC4, 0x2D,
+	0x62, 0xE2, 0x23, 0x9E, 0x31, 0xE9, 0x22, 0x07, 0x94, 0xB8, 0xAF, 0x0A, 0xB5, 0x1C, 0x24, 0xE5,
+	0xDC, 0x18, 0xB1, 0xEA, 0xA0, 0xCC, 0x72, 0x0F, 0xA4, 0x40, 0x27, 0x47, 0x54, 0x76, 0x0E, 0x62,
+	0x08, 0x9F, 0x44, 0x34, 0x43, 0x15, 0x71, 0x57, 0x15, 0x72, 0x57, 0x47, 0x64, 0x73, 0x06, 0x30,
+	0x53, 0xC2, 0x7C, 0x42, 0x64, 0x6F, 0x2A, 0xE0, 0x47, 0x8E, 0x4A, 0x57, 0x85, 0x5C, 0x1D, 0xA1,
+	0x41, 0xC2, 0x98, 0x28, 0x3B, 0x3A, 0x97, 0xB1, 0x53, 0x44, 0x34, 0x26, 0xD5, 0x30, 0x47, 0xE4,
+	0xAD, 0x2E, 0xE2, 0x2D, 0x47, 0x72, 0xE7, 0x08, 0x6A, 0x8D, 0xA4, 0xE1, 0x1E, 0xA8, 0xEA, 0x18,
+	0xE0, 0x29, 0xC4, 0x72, 0x47, 0x3C, 0x52, 0xC4, 0xBC, 0x46, 0xF0, 0xC7, 0x88, 0x5A, 0x8E, 0x81,
+	0xEA, 0x8E, 0xA5, 0xCC, 0x08, 0xE0, 0x1B, 0x8A, 0xB9, 0x2D, 0x43, 0x9C, 0x21, 0x69, 0x57, 0x11,
+	0x04, 0x13, 0xA8, 0x3C, 0x0C, 0x4E, 0x1C, 0x98, 0x89, 0xCB, 0xA0, 0x3D, 0x03, 0xD5, 0x19, 0xE3,
+	0x1C, 0xC5, 0xC0, 0x3E, 0x17, 0x7A, 0x17, 0x12, 0x38, 0x52, 0x45, 0x3C, 0x76, 0x56, 0x6E, 0x2F,
+	0x48, 0xEE, 0x2A, 0x62, 0xA7, 0x06, 0x6A, 0xCE, 0x88, 0x4B, 0x8C, 0xF1, 0x9A, 0x1C, 0xC2, 0x4F,
+	0x50, 0x75, 0x52, 0x27, 0xC2, 0x40, 0xD0, 0x82, 0x7D, 0x04, 0xE9, 0x8B, 0x11, 0xFC, 0x1B, 0x5A,
+	0xB5, 0x3B, 0xE2, 0x94, 0x25, 0x61, 0x7B, 0x03, 0x39, 0x00, 0x06, 0x3E, 0x05, 0x78, 0x1C, 0x16,
+	0x09, 0xE3, 0xAA, 0x21, 0x39, 0x3B, 0xD2, 0xAC, 0x64, 0x72, 0x27, 0xCA, 0xC4, 0x27, 0x46, 0x78,
+	0x55, 0x91, 0x8E, 0xA6, 0xD1, 0x8C, 0x11, 0xC2, 0x2D, 0x89, 0xBC, 0x85, 0x41, 0xBE, 0x11, 0x32,
+	0x43, 0x41, 0x3C, 0x12, 0xB6, 0x6E, 0x07, 0x68, 0x07, 0x61, 0x53, 0x07, 0x83, 0xE4, 0x85, 0xC4,
+	0xEC, 0x1C, 0xC1, 0x8D, 0x10, 0xD4, 0x39, 0xC2, 0x17, 0x15, 0x71, 0x23, 0xC6, 0x7D, 0x46, 0xF0,
+	0xA6, 0x85, 0xDA, 0x18, 0xD1, 0x1D, 0x89, 0xBC, 0x31, 0xAB, 0x13, 0x90, 0x30, 0x06, 0xE2, 0xE7,
+	0x26, 0xF0, 0xE8, 0xCE, 0x8A, 0x55, 0x81, 0xE8, 0x1C, 0xE0, 0x2D, 0x4B, 0xB5, 0x45, 0xAA, 0x3A,
+	0xA3, 0x3C, 0x28, 0x6A, 0xC6, 0xA1, 0x40, 0x16, 0xC8, 0xEA, 0x40, 0x7A, 0xA8, 0x16, 0x10, 0x40,
+	0x1E, 0x81, 0xEA, 0x13, 0xD0, 0x05, 0xE1, 0x37, 0x10, 0xF5, 0x46, 0x70, 0x17, 0xA8, 0xDB, 0x19,
+	0xF1, 0x89, 0xE3, 0x1A, 0x13, 0xA8, 0x63, 0x82, 0x77, 0x0C, 0x5A, 0x5D, 0xF1, 0x1E, 0x03, 0x9E,
+	0x13, 0xA9, 0x67, 0xC4, 0x27, 0x00, 0xF8, 0x95, 0x91, 0x4F, 0x4B, 0x12, 0xA9, 0x3D, 0x43, 0x44,
+	0xE5, 0xC5, 0xDD, 0x8A, 0x94, 0x35, 0x78, 0x02, 0xE6, 0x05, 0x1D, 0xCE, 0x02, 0x9A, 0x31, 0x34,
+	0x72, 0xE4, 0x6C, 0xCC, 0xFA, 0x54, 0x94, 0xBD, 0x23, 0x9A, 0x23, 0x38, 0x22, 0xE2, 0x20, 0x78,
+	0x40, 0xF4, 0x13, 0xE6, 0x67, 0x24, 0x6C, 0x55, 0xC1, 0xDA, 0x18, 0xBC, 0x33, 0xA9, 0x3A, 0xA8,
+	0xBC, 0x28, 0xFC, 0x4D, 0x19, 0x2B, 0xA1, 0x57, 0x02, 0xAC, 0xEC, 0x70, 0x04, 0x1C, 0x22, 0xB6,
+	0x27, 0x4E, 0x95, 0xA1, 0x0B, 0xCB, 0x9A, 0xA5, 0x68, 0x43, 0xC2, 0x6E, 0x4B, 0x48, 0x44, 0x01,
+	0x6C, 0x96, 0x80, 0x1D, 0x54, 0xCA, 0x05, 0xE3, 0xB0, 0x91, 0xF1, 0x57, 0x06, 0x7D, 0x0C, 0x5A,
+	0x5C, 0xF0, 0xA9, 0xE3, 0x37, 0xC4, 0x6F, 0x01, 0x5A, 0x43, 0xC2, 0x2B, 0x38, 0x47, 0x78, 0xCD,
+	0xC1, 0xAF, 0x50, 0x96, 0x23, 0xA9, 0x63, 0x62, 0x22, 0xC0, 0x41, 0x00, 0x77, 0xE4, 0xA7, 0x88,
+	0x4C, 0x11, 0xF9, 0x09, 0x31, 0x52, 0xD2, 0xAC, 0xA8, 0x3B, 0xC8, 0x23, 0xE6, 0x2D, 0xEC, 0x5A,
+	0x58, 0xF8, 0xB1, 0xAA, 0x37, 0x44, 0x76, 0x08, 0xDC, 0x14, 0xB4, 0x28, 0x00, 0xEC, 0x7C, 0x58,
+	0xF5, 0x19, 0xC1, 0x5A, 0x92, 0x2E, 0x0E, 0x88, 0x3B, 0x17, 0x02, 0xBC, 0x2C, 0x7A, 0x86, 0x80,
+	0xAB, 0x58, 0xB8, 0x89, 0xD4, 0x02, 0x3C, 0x27, 0x54, 0x88, 0xF0, 0x58, 0x1C, 0x31, 0x10, 0x41,
+	0x04, 0x9D, 0x09, 0x2B, 0x7A, 0x08, 0x27, 0x8C, 0x0D, 0xD1, 0xB3, 0x06, 0x38, 0x26, 0xF8, 0xC5,
+	0x9D, 0x1C, 0x30, 0x62, 0xF0, 0xCE, 0xD1, 0x01, 0xA2, 0x16, 0xC0, 0x84, 0x1D, 0xAB, 0xC2, 0x97,
+	0x86, 0x74, 0x8C, 0x78, 0x09, 0x97, 0x14, 0x7F, 0x8C, 0xEA, 0x18, 0xB8, 0x31, 0xA9, 0x2E, 0xDA,
+	0x13, 0xD6, 0x35, 0x6D, 0x4A, 0x78, 0x55, 0x16, 0x22, 0x3F, 0x28, 0x7A, 0x90, 0xD4, 0x91, 0x86,
+	0x2A, 0x5E, 0x18, 0xB3, 0x23, 0xA8, 0x47, 0x09, 0xD4, 0x57, 0x10, 0xB5, 0x0C, 0x5C, 0x44, 0xEA,
+	0x01, 0xDC, 0x91, 0x8B, 0xEA, 0x10, 0x08, 0x24, 0xE1, 0x21, 0xB1, 0x0B, 0x55, 0x15, 0xC2, 0x21,
+	0x39, 0x0C, 0x7A, 0x11, 0xD6, 0x33, 0xAC, 0x6A, 0x78, 0x50, 0xD6, 0x33, 0x3C, 0x28, 0x7A, 0x11,
+	0x1F, 0x96, 0x2F, 0x88, 0xCD, 0x8A, 0x93, 0x06, 0x30, 0xC0, 0x85, 0xE9, 0x30, 0x0E, 0xE4, 0x5E,
+	0x10, 0xBC, 0x2A, 0xE0, 0xE6, 0x0A, 0x8E, 0x5D, 0x0B, 0x4A, 0x19, 0xD4, 0xC5, 0x73, 0xA0, 0xF9,
+	0x13, 0x1E, 0x42, 0xAE, 0x11, 0x1D, 0xC8, 0x63, 0xD2, 0x1D, 0xA1, 0x45, 0xAA, 0x81, 0x6A, 0x81,
+	0x9C, 0x40, 0xC7, 0x80, 0x4E, 0x19, 0xD8, 0x15, 0x64, 0xEA, 0x07, 0xE3, 0x83, 0x42, 0xE5, 0xD1,
+	0x41, 0x79, 0x62, 0x78, 0x8C, 0x9E, 0xA4, 0x77, 0x8C, 0x5B, 0x91, 0x13, 0xD6, 0xA5, 0xE1, 0x8B,
+	0x34, 0x46, 0xDE, 0x94, 0xD4, 0xB3, 0x75, 0x2C, 0x69, 0x03, 0x3F, 0x04, 0x6E, 0x81, 0x81, 0xE4,
+	0x2E, 0x7A, 0xCD, 0xD0, 0x24, 0x3D, 0x8C, 0xCF, 0x4B, 0x12, 0xD2, 0x86, 0xF5, 0x23, 0x7C, 0x05,
+	0x0D, 0xD1, 0x97, 0x56, 0x04, 0xF4, 0xB3, 0x7D, 0x62, 0x4B, 0x1B, 0xB6, 0x84, 0x87, 0xC4, 0x99,
+	0xB4, 0x6E, 0xDC, 0x51, 0xF2, 0x94, 0xAD, 0xF1, 0x89, 0x6B, 0x0A, 0x7A, 0x59, 0xBA, 0x86, 0x06,
+	0xB9, 0xAB, 0x28, 0x66, 0xEF, 0x18, 0x17, 0x92, 0x74, 0xB5, 0xB1, 0xB9, 0x04, 0x0F, 0x81, 0x43,
+	0x62, 0x16, 0x10, 0x46, 0x3D, 0x8C, 0xE1, 0x07, 0x50, 0x4E, 0xA0, 0x13, 0xA8, 0x24, 0xE8, 0x41,
+	0x27, 0x42, 0x72, 0x04, 0x12, 0x74, 0x20, 0x82, 0x74, 0x75, 0x47, 0x09, 0x32, 0x73, 0x80, 0x79,
+	0x37, 0x98, 0xEC, 0x82, 0x07, 0xB0, 0x72, 0x41, 0xC1, 0x7E, 0x07, 0x31, 0x18, 0x3A, 0x22, 0xB3,
+	0xB9, 0x23, 0x9C, 0xC1, 0x9D, 0x18, 0x8B, 0xCA, 0x81, 0xCF, 0x0A, 0xA7, 0x4E, 0x88, 0xF5, 0x40,
+	0x1E, 0xC1, 0xD3, 0x45, 0xEC, 0x2D, 0x21, 0xC5, 0x5D, 0x58, 0x3C, 0x01, 0xDC, 0xC6, 0x0C, 0x44,
+	0xE8, 0x8F, 0x54, 0x11, 0xEA, 0x11, 0xC2, 0x01, 0x18, 0xF4, 0x8E, 0xA6, 0x05, 0x8C, 0x20, 0x8C,
+	0x4F, 0x03, 0xC2, 0x4C, 0x90, 0xD8, 0x88, 0x24, 0xE8, 0x41, 0x04, 0xEA, 0x08, 0x20, 0x82, 0x08,
+	0x24, 0xCB, 0x28, 0x31, 0x10, 0x77, 0x08, 0x90, 0x41, 0xE0, 0x9E, 0x3B, 0x20, 0x81, 0x8E, 0x40,
+	0x8C, 0x72, 0x04, 0x0F, 0x08, 0x20, 0x82, 0x08, 0x27, 0x83, 0xC9, 0xD4, 0xB2, 0x08, 0xC0, 0x82,
+	0x08, 0x20, 0x82, 0x07, 0xA0, 0x74, 0x81, 0x04, 0x10, 0x31, 0x04, 0x62, 0x08, 0x20, 0x80, 0x3D,
+	0x00, 0x9E, 0x08, 0x3C, 0xE2, 0x4C, 0xB0, 0x90, 0x49, 0xD0, 0x82, 0x08, 0xC4, 0x11, 0x80, 0xB2,
+	0xB2, 0x08, 0x20, 0x83, 0xC1, 0x04, 0x62, 0x08, 0x18, 0x8C, 0x41, 0x04, 0x10, 0x3C, 0xAC, 0x12,
+	0x0F, 0x04, 0xF3, 0x88, 0x3C, 0x13, 0xAC, 0x6C, 0x02, 0x31, 0x04, 0x10, 0x3C, 0xA0, 0x8C, 0x48,
+	0x20, 0x79, 0x41, 0x1C, 0x0E, 0x90, 0x20, 0x93, 0x2C, 0x20, 0x93, 0x2D, 0x2C, 0x82, 0x78, 0x04,
+	0xF0, 0x78, 0x20, 0x8C, 0x40, 0xC4, 0x10, 0x31, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x9E,
+	0x00, 0xC4, 0x62, 0x30, 0x1E, 0x81, 0xCC, 0x20, 0x12, 0x71, 0x20, 0x9E, 0x09, 0xE0, 0xF0, 0x09,
+	0xE0, 0x82, 0x30, 0x20, 0x59, 0x09, 0x04, 0x10, 0x31, 0x04, 0x10, 0x31, 0x20, 0x62, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x93, 0x85, 0x84, 0xE2, 0x4F, 0x07, 0x9A, 0x08, 0x20, 0x82, 0x30, 0x16, 0x50,
+	0x3A, 0x8E, 0x04, 0x08, 0x20, 0xF1, 0xE1, 0x04, 0x9D, 0x08, 0x20, 0x8C, 0x21, 0x8E, 0x50, 0x08,
+	0x20, 0x9E, 0x09, 0xE0, 0x10, 0x4F, 0x04, 0x10, 0x4F, 0x00, 0x8F, 0x00, 0x00
 };
 
+/* 2-bit ADPCM, SNR 12.4 dB */
 const u8 sfx_switch_on[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x88, 0x87, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x89, 0x88, 0x89, 0x87, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x87, 0x78, 0x98, 0x88, 0x88,
-	0x78, 0x97, 0x88, 0x77, 0x78, 0x7A, 0x99, 0x99, 0xB9, 0xA9, 0x97, 0x76, 0x67, 0x79, 0x88, 0x88,
-	0x89, 0x88, 0x77, 0x65, 0x76, 0x88, 0x9A, 0xAA, 0xAA, 0xA9, 0x89, 0x66, 0x75, 0x83, 0x76, 0x77,
-	0x59, 0x6A, 0x87, 0x89, 0xCA, 0xCA, 0x88, 0x8A, 0x99, 0x97, 0x88, 0x79, 0x88, 0x77, 0x39, 0x48,
-	0x76, 0x96, 0x98, 0x98, 0xAB, 0xAB, 0x8B, 0x87, 0x66, 0x65, 0x77, 0x78, 0x99, 0xA7, 0x95, 0x54,
-	0x57, 0x6A, 0x8B, 0x9C, 0xEE, 0xDD, 0xBA, 0x86, 0x63, 0x43, 0x47, 0x7A, 0xBD, 0xDD, 0xCB, 0xA6,
-	0x64, 0x53, 0x66, 0x87, 0x89, 0x8B, 0xAA, 0x95, 0x42, 0x34, 0x57, 0x78, 0x8C, 0xCD, 0xBA, 0x87,
-	0x54, 0x65, 0x75, 0x78, 0x88, 0xAD, 0xCE, 0xCC, 0xA8, 0x55, 0x55, 0x65, 0x88, 0x88, 0x89, 0x9A,
-	0xA9, 0x9A, 0xA8, 0x75, 0x46, 0x57, 0x9A, 0xCE, 0xDD, 0xCB, 0x98, 0x75, 0x95, 0x76, 0x66, 0x67,
-	0xA9, 0xAB, 0xBB, 0x99, 0x65, 0x43, 0x45, 0x7A, 0x9B, 0x89, 0x76, 0x77, 0x88, 0x87, 0x76, 0x55,
-	0x34, 0x56, 0xAA, 0xCB, 0xB8, 0x77, 0x68, 0xA9, 0xA8, 0x76, 0x33, 0x44, 0x88, 0xCA, 0xBB, 0xAC,
-	0x99, 0x98, 0x88, 0x98, 0x87, 0x65, 0x58, 0x9D, 0xDD, 0xDA, 0x87, 0x56, 0x56, 0x89, 0x9A, 0xAA,
-	0x88, 0x78, 0x78, 0x76, 0x55, 0x56, 0x57, 0x9B, 0xDC, 0xDB, 0x99, 0x76, 0x56, 0x79, 0x99, 0x77,
-	0x44, 0x45, 0x56, 0x87, 0x77, 0x89, 0xAA, 0xCB, 0xCB, 0xBA, 0x86, 0x54, 0x67, 0x9B, 0xCD, 0xCA,
-	0x98, 0x77, 0x66, 0x55, 0x56, 0x58, 0x79, 0x99, 0xAA, 0xA8, 0x75, 0x34, 0x45, 0x68, 0xAA, 0xBA,
-	0x99, 0xA9, 0x9A, 0xAB, 0x98, 0x65, 0x55, 0x67, 0x77, 0x89, 0x97, 0x76, 0x77, 0x8A, 0xAB, 0xB9,
-	0x87, 0x77, 0x79, 0xAB, 0xAB, 0x98, 0x67, 0x77, 0x87, 0x98, 0x76, 0x55, 0x56, 0x79, 0x9A, 0x99,
-	0x98, 0x77, 0x76, 0x98, 0xA8, 0x77, 0x56, 0x58, 0x9B, 0xCC, 0xBB, 0x98, 0x76, 0x77, 0x87, 0x88,
-	0x66, 0x56, 0x68, 0x8A, 0xAB, 0xA9, 0x87, 0x77, 0x89, 0xAA, 0xAA, 0x99, 0x89, 0x9A, 0xAA, 0x98,
-	0x87, 0x66, 0x56, 0x77, 0x99, 0x99, 0x88, 0x76, 0x78, 0x88, 0x98, 0x87, 0x65, 0x45, 0x57, 0x78,
-	0x77, 0x78, 0x99, 0xAA, 0xA9, 0xA9, 0x98, 0x76, 0x56, 0x57, 0x78, 0x98, 0x98, 0x88, 0x89, 0x99,
-	0x88, 0x77, 0x77, 0x88, 0x99, 0x9A, 0x88, 0x77, 0x86, 0x77, 0x87, 0x99, 0x99, 0x89, 0x89, 0x8A,
-	0x99, 0x88, 0x68, 0x79, 0x89, 0xA9, 0x97, 0x86, 0x77, 0x99, 0x9A, 0x8A, 0x99, 0x99, 0x99, 0x99,
-	0x87, 0x74, 0x34, 0x56, 0x67, 0x99, 0xB9, 0xA8, 0x87, 0x88, 0x87, 0x78, 0x78, 0x88, 0xA9, 0x9A,
-	0x99, 0x87, 0x75, 0x66, 0x88, 0x98, 0xA8, 0x97, 0x77, 0x67, 0x58, 0x68, 0x98, 0x98, 0xA9, 0x98,
-	0x88, 0x77, 0x77, 0x77, 0x99, 0xAA, 0xBB, 0xAB, 0x99, 0x88, 0x77, 0x76, 0x76, 0x86, 0x78, 0x77,
-	0x78, 0x87, 0x88, 0x88, 0x78, 0x79, 0x89, 0x87, 0x87, 0x77, 0x77, 0x88, 0x99, 0xA9, 0xA9, 0x87,
-	0x88, 0x79, 0x9A, 0x99, 0x88, 0x99, 0x98, 0x76, 0x86, 0x76, 0x66, 0x78, 0x89, 0x9A, 0xA9, 0x99,
-	0x89, 0x89, 0x78, 0x87, 0x88, 0x87, 0x88, 0xA9, 0x99, 0x99, 0x98, 0x89, 0x89, 0x78, 0x88, 0x87,
-	0x76, 0x77, 0x77, 0x79, 0x89, 0x88, 0x78, 0x77, 0x87, 0x77, 0x78, 0x67, 0x87, 0x78, 0x88, 0x88,
-	0x87, 0x66, 0x77, 0x89, 0x99, 0x99, 0x89, 0x9A, 0x98, 0xA9, 0xAA, 0x99, 0x87, 0x76, 0x74, 0x45,
-	0x66, 0x66, 0x77, 0x79, 0x99, 0xAA, 0x98, 0x99, 0x99, 0x98, 0x99, 0x99, 0x9A, 0xA9, 0xA9, 0x97,
-	0x88, 0x87, 0x75, 0x78, 0x66, 0x56, 0x66, 0x76, 0x66, 0x87, 0x88, 0x89, 0x8A, 0x9B, 0xBB, 0xBA,
-	0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x98, 0x87, 0x76, 0x66, 0x66, 0x66, 0x66, 0x67, 0x88, 0x78, 0x89,
-	0x98, 0x77, 0x89, 0x9A, 0x9A, 0x99, 0xAA, 0xAA, 0x99, 0x99, 0x87, 0x76, 0x77, 0x76, 0x66, 0x77,
-	0x67, 0x56, 0x66, 0x66, 0x77, 0x78, 0x89, 0x89, 0x9A, 0xAA, 0xAA, 0xAB, 0xA9, 0x89, 0x89, 0x98,
-	0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x66, 0x56, 0x67, 0x78, 0x99, 0x99, 0xA9, 0x89, 0x89, 0x99,
-	0x88, 0x99, 0x98, 0x99, 0x89, 0x87, 0x76, 0x56, 0x66, 0x66, 0x67, 0x78, 0x89, 0x99, 0x99, 0x99,
-	0xA9, 0x99, 0x88, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0x99, 0x98, 0x87, 0x77, 0x76, 0x76, 0x87, 0x87,
-	0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x99, 0x88, 0x89, 0x89, 0x99, 0x88, 0x78, 0x78, 0x87, 0x88,
-	0x77, 0x67, 0x77, 0x67, 0x77, 0x77, 0x67, 0x78, 0x89, 0x9A, 0x99, 0xA9, 0xAA, 0xA9, 0x99, 0xA9,
-	0x99, 0x9A, 0x9A, 0x99, 0x87, 0x66, 0x66, 0x67, 0x77, 0x77, 0x87, 0x88, 0x88, 0x78, 0x77, 0x88,
-	0x98, 0x99, 0x99, 0x99, 0x88, 0x88, 0x77, 0x88, 0x77, 0x76, 0x67, 0x66, 0x56, 0x66, 0x77, 0x77,
-	0x88, 0x88, 0x99, 0x9A, 0x9A, 0x9A, 0x99, 0xAB, 0xBB, 0xBA, 0xA9, 0x98, 0x88, 0x77, 0x77, 0x77,
-	0x77, 0x78, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x98, 0x87, 0x77, 0x66,
-	0x66, 0x66, 0x77, 0x77, 0x76, 0x67, 0x67, 0x76, 0x76, 0x78, 0x89, 0x9A, 0xAA, 0xAA, 0x99, 0x99,
-	0x9A, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x87, 0x77, 0x77, 0x66, 0x67, 0x77, 0x87, 0x77, 0x78, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x89, 0x88, 0x87, 0x78, 0x78, 0x77, 0x88, 0x78, 0x87, 0x77, 0x77, 0x88,
-	0x87, 0x78, 0x88, 0x88, 0x89, 0x99, 0x89, 0x99, 0x89, 0x99, 0x99, 0x99, 0x98, 0x98, 0x88, 0x88,
-	0x89, 0x89, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x77, 0x77, 0x77,
-	0x77, 0x76, 0x66, 0x67, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x78, 0x88, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x89, 0x89, 0x9A,
-	0x99, 0x99, 0x89, 0x98, 0x88, 0x88, 0x98, 0x88, 0x77, 0x77, 0x66, 0x66, 0x77, 0x67, 0x78, 0x88,
-	0x87, 0x87, 0x77, 0x77, 0x78, 0x88, 0x9A, 0xAA, 0x99, 0x98, 0x98, 0x88, 0x88, 0x99, 0x99, 0xA9,
-	0xA9, 0x99, 0x88, 0x77, 0x78, 0x88, 0x88, 0x99, 0x99, 0x98, 0x99, 0x88, 0x88, 0x88, 0x87, 0x78,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x78, 0x77, 0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x77, 0x88, 0x89, 0x98, 0x88, 0x87,
-	0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88,
-	0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x88, 0x77, 0x77, 0x87, 0x77,
-	0x77, 0x77, 0x78, 0x89, 0x99, 0x98, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77,
-	0x77, 0x67, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x98, 0x99,
-	0x99, 0x98, 0x89, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x78, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x89, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x87, 0x77, 0x88, 0x88, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x76
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x48, 0x8B, 0x5C, 0x88, 0x88, 0xB6, 0x35, 0xC9, 0xB0,
+	0xAD, 0x22, 0x22, 0x2B, 0x90, 0x2B, 0x17, 0x23, 0xD7, 0x2A, 0x15, 0x8D, 0x72, 0xBB, 0x91, 0x88,
+	0x1E, 0xEF, 0x64, 0x48, 0x2B, 0xEF, 0x37, 0x24, 0xDD, 0xA1, 0x63, 0xA1, 0x8F, 0x2D, 0x8F, 0xDD,
+	0x83, 0x62, 0x4D, 0xCA, 0xE3, 0x49, 0x67, 0x3B, 0x11, 0xD9, 0x2A, 0xEF, 0xB2, 0x45, 0x12, 0xBF,
+	0xB3, 0x66, 0x19, 0xAF, 0xB0, 0x41, 0x50, 0xFB, 0xB6, 0x24, 0x95, 0x0E, 0xFC, 0xA6, 0x40, 0x95,
+	0xB1, 0xBF, 0x99, 0x11, 0x8E, 0xEF, 0x72, 0x0D, 0x60, 0x2F, 0xFA, 0x15, 0x0C, 0xF0, 0x23, 0xFC,
+	0xC5, 0x66, 0xB8, 0xD2, 0x7B, 0xA4, 0x56, 0x29, 0xEA, 0x87, 0xBE, 0x55, 0x2B, 0xF8, 0x94, 0x9A,
+	0xE9, 0xCE, 0xE1, 0xD5, 0x23, 0xCE, 0xC4, 0x2F, 0xE1, 0x96, 0x84, 0x46, 0x6F, 0xBE, 0x45, 0x0E,
+	0xEA, 0xCE, 0x11, 0x58, 0x4F, 0xEC, 0x05, 0x43, 0xA6, 0x91, 0xFE, 0x85, 0x84, 0xBE, 0x65, 0x1B,
+	0xB2, 0x15, 0x8F, 0xC2, 0x76, 0xB8, 0x95, 0x0A, 0xBE, 0x76, 0x6E, 0xD9, 0x12, 0x3E, 0xE0, 0x76,
+	0xE9, 0x11, 0x1B, 0xE2, 0x56, 0x2E, 0xD0, 0x3F, 0x3C, 0xC1, 0x48, 0xEF, 0x12, 0x73, 0xE8, 0x51,
+	0xC9, 0x66, 0x32, 0xEF, 0xC9, 0x16, 0x32, 0x12, 0xFA, 0x85, 0x09, 0xFA, 0x70, 0x74, 0x8C, 0xD9,
+	0x8F, 0xD9, 0x87, 0x33, 0x06, 0x1C, 0x88, 0x2A, 0xFF, 0xC1, 0x94, 0x33, 0xA6, 0x31, 0xC1, 0x69,
+	0xCE, 0xF0, 0x46, 0x73, 0x2C, 0xD9, 0x27, 0x63, 0x2E, 0x0D, 0x44, 0x6C, 0xEC, 0xEA, 0x76, 0x1C,
+	0x93, 0x62, 0xDD, 0x9B, 0x28, 0x84, 0x53, 0x6F, 0x0D, 0x0C, 0xE4, 0xBE, 0x72, 0x85, 0x11, 0x3A,
+	0xDD, 0xCA, 0x63, 0x46, 0x8A, 0xB1, 0xDC, 0x8B, 0xE4, 0xA5, 0x9C, 0xCC, 0x72, 0x1C, 0x31, 0x28,
+	0xFC, 0x65, 0x88, 0xC5, 0xE6, 0x6B, 0xBB, 0xBC, 0x48, 0x45, 0x64, 0xF0, 0x2B, 0x60, 0x1B, 0x7B,
+	0x0B, 0xF4, 0xE9, 0x87, 0x96, 0x01, 0x11, 0x63, 0xA2, 0x22, 0xBB, 0xF3, 0x82, 0x22, 0x14, 0xD0,
+	0xBE, 0x50, 0x9C, 0x62, 0xEA, 0xFB, 0x0B, 0x84, 0xEC, 0x08, 0x41, 0x19, 0x10, 0x81, 0xF8, 0xDA,
+	0x6E, 0x2E, 0x2A, 0xED, 0x11, 0x60, 0x7C, 0x92, 0xE4, 0xB6, 0xDB, 0xB8, 0x08, 0x11, 0x10, 0x20,
+	0x7A, 0xC4, 0x88, 0x42, 0xEB, 0xEA, 0xB7, 0x66, 0x0B, 0xDD, 0x82, 0x6C, 0x1D, 0x8E, 0xC9, 0xB4,
+	0xED, 0x8C, 0x0A, 0xD1, 0x11, 0xE6, 0x63, 0x87, 0x21, 0xDC, 0xEA, 0x81, 0x20, 0x76, 0x2D, 0xC6,
+	0x60, 0x22, 0xEA, 0xC6, 0xEB, 0x1E, 0xD8, 0x49, 0x60, 0x41, 0xD8, 0xC5, 0x8B, 0xBE, 0xAE, 0x88,
+	0x81, 0x20, 0x78, 0x22, 0x10, 0xAB, 0x73, 0x8E, 0x80, 0x4A, 0xB1, 0xDA, 0x71, 0x10, 0x22, 0xE8,
+	0x1B, 0x82, 0xBA, 0xB8, 0xAE, 0x58, 0x72, 0x10, 0x87, 0x22, 0x1E, 0x39, 0xDA, 0x69, 0xB8, 0x04,
+	0xF1, 0x22, 0x12, 0xD8, 0xD8, 0x88, 0xB7, 0x82, 0x1D, 0xA8, 0x84, 0xE8, 0x88, 0x42, 0xFA, 0x22,
+	0x2B, 0x81, 0x1D, 0x8E, 0x08, 0x19, 0x4A, 0x22, 0x2E, 0x88, 0x81, 0xB2, 0x8B, 0xA1, 0x01, 0xD0,
+	0xE2, 0xDB, 0x28, 0x72, 0xEA, 0xE0, 0x6D, 0x12, 0xB7, 0x28, 0x10, 0x52, 0xCF, 0x6A, 0x04, 0x87,
+	0x6A, 0xFA, 0x10, 0x84, 0x2B, 0x6C, 0x8A, 0xB1, 0x22, 0x2B, 0x81, 0xDC, 0x92, 0xE2, 0x22, 0x20,
+	0x48, 0x88, 0x88, 0x87, 0x62, 0xCA, 0x22, 0x22, 0x21, 0x2D, 0xCA, 0x0A, 0xDC, 0x86, 0x5B, 0x2B,
+	0xA1, 0x08, 0x88, 0x88, 0x88, 0x42, 0x22, 0x23, 0xF1, 0x88, 0x22, 0x22, 0xAE, 0x08, 0x84, 0x22,
+	0x10, 0x88, 0xAE, 0x22, 0xAD, 0xC6, 0xC8, 0x78, 0x22, 0x11, 0x0B, 0x63, 0xA2, 0x22, 0x22, 0xE8,
+	0xAD, 0x22, 0x21, 0x08, 0x88, 0x88, 0x1B, 0x76, 0x2B, 0x1E, 0x22, 0xB4, 0x88, 0x12, 0x22, 0x2E,
+	0x88, 0x88, 0x88, 0xAD, 0x2C, 0xE1, 0x08, 0x8A, 0xD2, 0x20, 0x48, 0xAE, 0x1C, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x8A, 0xDB, 0x21, 0x08, 0x88, 0xAE, 0x22, 0x21, 0x08, 0x1E, 0x2D, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x8A, 0xD2, 0x22, 0x22, 0x20, 0x48, 0x88, 0xAE, 0x22, 0x22, 0x22, 0x22, 0xB8,
+	0x88, 0x88, 0x1D, 0x84, 0x28, 0xBA, 0x22, 0x22, 0x20, 0x78, 0xB8, 0x42, 0x1D, 0xA8, 0x8B, 0x6B,
+	0x48, 0x2B, 0x8A, 0xB0
 };
 
+/* 2-bit ADPCM, SNR 14.5 dB */
 const u8 sfx_rocket_launch[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x88, 0x77, 0x54, 0x32, 0x10, 0x00, 0x00, 0x00, 0x01, 0x38, 0xCF, 0xFF, 0xFF, 0xFE,
-	0xED, 0xDD, 0xCC, 0xCB, 0xBB, 0xBB, 0xAA, 0xAA, 0x98, 0x64, 0x67, 0xA9, 0x55, 0x68, 0xBA, 0xAA,
-	0xAA, 0x97, 0x89, 0x99, 0x65, 0x55, 0x55, 0x55, 0x56, 0x66, 0x65, 0x55, 0x55, 0x56, 0x66, 0x66,
-	0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x89, 0xCF,
-	0xEE, 0xED, 0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xBB, 0xBB, 0xBB, 0xBB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x77, 0x88, 0x99, 0x87, 0x64, 0x33, 0x23, 0x33,
-	0x44, 0x44, 0x44, 0x44, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x65, 0x66, 0x77, 0x77,
-	0x89, 0x9A, 0xBB, 0xBA, 0x99, 0xBC, 0xCC, 0xCC, 0xBB, 0xBA, 0xAC, 0xBB, 0xA9, 0x98, 0x99, 0x88,
-	0x77, 0x76, 0x66, 0x65, 0x55, 0x55, 0x67, 0x77, 0x9A, 0xA9, 0x98, 0x78, 0x88, 0x9A, 0x98, 0x77,
-	0x77, 0x77, 0x88, 0x89, 0x88, 0x8A, 0xAB, 0xBB, 0xBA, 0xA9, 0x66, 0x9A, 0x99, 0x98, 0x77, 0x77,
-	0x77, 0x76, 0x55, 0x55, 0x54, 0x44, 0x55, 0x56, 0x67, 0x89, 0x99, 0x99, 0x99, 0x98, 0x99, 0x9A,
-	0xAB, 0xBB, 0xBB, 0xBB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBB, 0xA9, 0x99, 0x99, 0x88, 0x88, 0x89,
-	0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x65, 0x56, 0x76, 0x76, 0x66, 0x65, 0x45,
-	0x55, 0x66, 0x65, 0x56, 0x77, 0x88, 0x9A, 0x99, 0x88, 0x88, 0x9A, 0x99, 0xA9, 0x98, 0x99, 0x87,
-	0x66, 0x78, 0x98, 0x87, 0x67, 0x67, 0x67, 0x63, 0x45, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x9A,
-	0xBC, 0xCC, 0xDD, 0xDD, 0xDD, 0xCC, 0x98, 0xAC, 0xDE, 0xDD, 0xCB, 0x99, 0x98, 0x87, 0x76, 0x54,
-	0x44, 0x44, 0x33, 0x33, 0x22, 0x22, 0x23, 0x44, 0x56, 0x67, 0x8A, 0xDB, 0x98, 0x76, 0x66, 0x66,
-	0x77, 0x89, 0xAB, 0xCC, 0xDD, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xDC, 0xBB, 0xBA, 0xA9, 0x99, 0x88,
-	0x77, 0x65, 0x43, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x23, 0x33, 0x32, 0x23, 0x34, 0x45,
-	0x56, 0x67, 0x78, 0x88, 0x89, 0x99, 0x9A, 0xAB, 0xCC, 0xCC, 0xCE, 0xEC, 0xBA, 0xAA, 0xAA, 0xBB,
-	0xCC, 0xCC, 0xDD, 0xDC, 0xCC, 0xBB, 0xBB, 0xBA, 0xAA, 0xAA, 0x99, 0x98, 0x77, 0x66, 0x55, 0x44,
-	0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x33, 0x34, 0x44, 0x45, 0x55, 0x56, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0xAA,
-	0xAB, 0xCC, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCC, 0xBB, 0xBA, 0xAA, 0xAA, 0x99,
-	0x98, 0x77, 0x66, 0x55, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-	0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x78, 0x88,
-	0x88, 0x89, 0x9A, 0xAB, 0xBB, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCC, 0xCC, 0xBB, 0xBB, 0xBB,
-	0xAA, 0xA9, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x76, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77,
-	0x77, 0x76, 0x66, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66,
-	0x67, 0x77, 0x77, 0x88, 0x89, 0x99, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAB, 0xBB, 0xBB,
-	0xBB, 0xAA, 0xA9, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x77,
-	0x77, 0x88, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	0x99, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x55, 0x54, 0x44, 0x55, 0x56, 0x66, 0x66,
-	0x66, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x76, 0x66, 0x67, 0x88, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x88, 0x9A, 0xAB, 0xBB, 0xBB, 0xAA, 0xA9, 0x99, 0x99, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x98,
-	0x88, 0x88, 0x87, 0x66, 0x66, 0x55, 0x55, 0x56, 0x67, 0x77, 0x76, 0x66, 0x55, 0x55, 0x56, 0x78,
-	0x99, 0x99, 0x98, 0x87, 0x77, 0x89, 0x9A, 0xAA, 0xAA, 0x99, 0x88, 0x88, 0x88, 0x9A, 0xAB, 0xBB,
-	0xBA, 0x98, 0x76, 0x66, 0x66, 0x67, 0x78, 0x99, 0x88, 0x76, 0x65, 0x55, 0x66, 0x77, 0x77, 0x88,
-	0x98, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0x99, 0x98, 0x88, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x76, 0x66, 0x67, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x9A, 0x99, 0x99, 0x98, 0x88, 0x77, 0x77,
-	0x77, 0x67, 0x76, 0x67, 0x66, 0x66, 0x55, 0x55, 0x55, 0x66, 0x66, 0x77, 0x88, 0x88, 0x89, 0x9A,
-	0xAA, 0xA9, 0x9A, 0xA9, 0x9A, 0xAA, 0xAA, 0xAA, 0xBB, 0xBC, 0xCC, 0xCB, 0xBB, 0xBA, 0x99, 0x98,
-	0x88, 0x98, 0x87, 0x98, 0x88, 0x9A, 0xAA, 0xAA, 0x98, 0x76, 0x66, 0x56, 0x78, 0x77, 0x99, 0xAA,
-	0x99, 0x87, 0x55, 0x45, 0x68, 0x89, 0x98, 0x88, 0x89, 0x99, 0x99, 0x87, 0x66, 0x55, 0x66, 0x89,
-	0xAA, 0xA9, 0x89, 0x88, 0x88, 0x77, 0x55, 0x57, 0x9A, 0xAA, 0x99, 0xAB, 0xA9, 0x88, 0x78, 0x87,
-	0x77, 0x88, 0x89, 0x99, 0xA9, 0x98, 0x77, 0x89, 0x86, 0x54, 0x69, 0xAA, 0xA8, 0x68, 0xAB, 0xAA,
-	0x87, 0x77, 0x77, 0x66, 0x77, 0x89, 0x88, 0x87, 0x78, 0xCD, 0xCB, 0x64, 0x58, 0x87, 0x64, 0x34,
-	0x8B, 0xBB, 0xA7, 0x7A, 0xDE, 0xDA, 0x85, 0x35, 0x67, 0x74, 0x35, 0x56, 0x8A, 0x98, 0xAA, 0x97,
-	0x7A, 0xBB, 0x98, 0x66, 0x65, 0x66, 0x76, 0x77, 0x66, 0x89, 0xAC, 0xCA, 0x98, 0x89, 0xA9, 0x87,
-	0x76, 0x56, 0x88, 0x78, 0x89, 0x99, 0x99, 0xAB, 0xBA, 0xAA, 0x89, 0x86, 0x68, 0x98, 0x87, 0x78,
-	0x77, 0x88, 0x79, 0xBB, 0xAA, 0x88, 0x76, 0x46, 0x9A, 0x9A, 0x76, 0x67, 0x9B, 0xCB, 0x87, 0x54,
-	0x56, 0x8A, 0x98, 0x76, 0x77, 0x8A, 0xB9, 0x97, 0x65, 0x56, 0x78, 0xAA, 0x86, 0x88, 0x9A, 0xBA,
-	0x97, 0x66, 0x55, 0x56, 0x87, 0x88, 0xBD, 0xCB, 0x98, 0x97, 0x7B, 0xDC, 0x84, 0x22, 0x34, 0x58,
-	0xBC, 0xDC, 0x98, 0x78, 0x97, 0x66, 0x8B, 0x99, 0x98, 0x85, 0x34, 0x79, 0xAB, 0x99, 0xAA, 0x98,
-	0x89, 0x98, 0x88, 0x89, 0x88, 0x99, 0x99, 0x9B, 0xAA, 0xA9, 0x99, 0x76, 0x65, 0x54, 0x33, 0x20,
-	0x01, 0x45, 0x67, 0x66, 0x78, 0x8A, 0xA9, 0xA9, 0x77, 0x77, 0x9A, 0xBC, 0xBB, 0xCB, 0xBA, 0xCE,
-	0xDC, 0xDC, 0xCA, 0x88, 0x99, 0x99, 0x99, 0xBB, 0xBA, 0x89, 0x75, 0x58, 0x87, 0x88, 0x67, 0x55,
-	0x66, 0x78, 0x87, 0x53, 0x45, 0x77, 0x66, 0x87, 0x65, 0x78, 0x88, 0x77, 0x76, 0x66, 0x66, 0x77,
-	0x66, 0x88, 0x77, 0x79, 0x97, 0x8A, 0xBB, 0x9A, 0xB9, 0x89, 0xA9, 0x9B, 0xBA, 0x88, 0xA9, 0x88,
-	0x8A, 0xA9, 0xBC, 0xAA, 0xCB, 0x99, 0x9A, 0x9A, 0x87, 0x99, 0x87, 0x89, 0x77, 0x98, 0x77, 0x99,
-	0x98, 0x87, 0x86, 0x55, 0x56, 0x78, 0x77, 0x87, 0x88, 0x76, 0x44, 0x78, 0x88, 0x79, 0xA9, 0x97,
-	0x68, 0x77, 0x76, 0x77, 0x55, 0x68, 0x96, 0x57, 0x78, 0x87, 0x88, 0x88, 0x9A, 0x98, 0x89, 0x97,
-	0x89, 0x87, 0x89, 0x97, 0x89, 0x96, 0x58, 0x99, 0x8A, 0xBB, 0xCA, 0xB9, 0x77, 0x88, 0x76, 0x65,
-	0x78, 0x89, 0xA9, 0x9B, 0x9A, 0xAA, 0xA9, 0x97, 0x78, 0xAA, 0x88, 0x88, 0x89, 0xA9, 0x88, 0x89,
-	0x87, 0x87, 0x79, 0x98, 0x7A, 0x89, 0xA8, 0x87, 0x78, 0x78, 0x87, 0x78, 0x96, 0x46, 0x76, 0x56,
-	0x88, 0x67, 0x88, 0x76, 0x78, 0x87, 0x65, 0x67, 0x57, 0x78, 0x87, 0x77, 0x78, 0x86, 0x56, 0x88,
-	0x87, 0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x87, 0x9A, 0x98, 0x79, 0x98, 0x89, 0x98,
-	0x88, 0x98, 0x99, 0x9A, 0x99, 0x9A, 0xA8, 0x78, 0xA9, 0x77, 0x8A, 0x98, 0x67, 0x97, 0x78, 0x98,
-	0x89, 0xA8, 0x89, 0x99, 0x89, 0x86, 0x88, 0x79, 0x67, 0x98, 0x78, 0x98, 0x88, 0x87, 0x57, 0x88,
-	0x88, 0x88, 0x98, 0x98, 0x78, 0x97, 0x79, 0xA9, 0x76, 0x78, 0x87, 0x77, 0x88, 0x76, 0x69, 0x97,
-	0x77, 0x99, 0xAB, 0x97, 0x89, 0xA7, 0x56, 0x78, 0x76, 0x77, 0x87, 0x67, 0x79, 0x88, 0x8A, 0xCA,
-	0x88, 0x89, 0xA7, 0x78, 0x78, 0x88, 0x87, 0x78, 0x87, 0x56, 0x78, 0x98, 0x88, 0x99, 0x88, 0x98,
-	0x89, 0x99, 0x9A, 0x98, 0x9A, 0x99, 0x98, 0x88, 0x67, 0x77, 0x98, 0x88, 0x99, 0x89, 0xAB, 0x98,
-	0x98, 0x78, 0x89, 0x76, 0x78, 0x97, 0x78, 0x77, 0x77, 0x78, 0x65, 0x77, 0x77, 0x78, 0x88, 0x86,
-	0x89, 0x9A, 0x87, 0x69, 0xA8, 0x77, 0x89, 0x88, 0x87, 0x89, 0x87, 0x88, 0xA8, 0x77, 0x69, 0x99,
-	0x98, 0x99, 0x99, 0x88, 0xAA, 0x99, 0x87, 0x99, 0x98, 0x88, 0x89, 0x98, 0x66, 0x78, 0x88, 0x78,
-	0x99, 0x87, 0x79, 0xA8, 0x77, 0x78, 0x87, 0x77, 0x78, 0x87, 0x78, 0x99, 0x77, 0x87, 0x87, 0x77,
-	0x67, 0x88, 0x77, 0x88, 0x98, 0x78, 0x89, 0x97, 0x88, 0x76, 0x88, 0x89, 0x89, 0x87, 0x89, 0x99,
-	0x99, 0x88, 0x88, 0x89, 0x77, 0x89, 0x98, 0x78, 0x99, 0x99, 0x99, 0x98, 0x89, 0x98, 0x89, 0x87,
-	0x67, 0x89, 0x88, 0x88, 0x98, 0x99, 0x87, 0x79, 0x88, 0x88, 0x88, 0x77, 0x89, 0x98, 0x88, 0x8A,
-	0x97, 0x78, 0x88, 0x88, 0x99, 0x78, 0x98, 0x78, 0x88, 0x98, 0x88, 0x77, 0x78, 0x87, 0x89, 0x88,
-	0x87, 0x78, 0x77, 0x88, 0x89, 0x98, 0x78, 0x88, 0x87, 0x78, 0x87, 0x78, 0x98, 0x77, 0x88, 0x88,
-	0x87, 0x88, 0x78, 0x98, 0x88, 0x88, 0x87, 0x77, 0x87, 0x89, 0x98, 0x88, 0x89, 0x98, 0x99, 0x98,
-	0x89, 0x99, 0x87, 0x88, 0x77, 0x89, 0x99, 0x89, 0x99, 0x88, 0x89, 0x98, 0x88, 0x77, 0x88, 0x89,
-	0x88, 0x99, 0x87, 0x76, 0x78, 0x87, 0x89, 0x99, 0x88, 0x88, 0x87, 0x78, 0x89, 0x88, 0x99, 0x97,
-	0x77, 0x77, 0x79, 0x99, 0x98, 0x98, 0x87, 0x89, 0x88, 0x77, 0x89, 0x88, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x89, 0x88, 0x98, 0x88, 0x98, 0x87, 0x78, 0x88, 0x88, 0x77, 0x88,
-	0x88, 0x98, 0x99, 0x78, 0x88, 0x88, 0x98, 0x87, 0x66, 0x88, 0x88, 0x87, 0x78, 0x99, 0x99, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x87, 0x77, 0x89, 0x98, 0x89, 0x98, 0x88, 0x88, 0x89, 0x98, 0x77, 0x89,
-	0x98, 0x78, 0x99, 0x87, 0x77, 0x99, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87, 0x78, 0x77,
-	0x88, 0x89, 0x87, 0x77, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x89, 0xA9, 0x87, 0x77, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x99, 0x98, 0x88, 0x89, 0x97, 0x78, 0x88, 0x87, 0x78, 0x98, 0x87, 0x88,
-	0x88, 0x77, 0x78, 0x89, 0x88, 0x89, 0x98, 0x87, 0x88, 0x87, 0x88, 0x88, 0x78, 0x89, 0x88, 0x88,
-	0x99, 0x87, 0x78, 0x88, 0x88, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x78, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88,
-	0x87, 0x88, 0x98, 0x88, 0x89, 0x99, 0x87, 0x88, 0x87, 0x77, 0x89, 0x98, 0x78, 0x88, 0x88, 0x78,
-	0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x99, 0x88, 0x88, 0x89, 0x98, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x87, 0x77, 0x88, 0x99, 0x98, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x89, 0x98, 0x88, 0x99, 0x87, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x98, 0x98, 0x88, 0x89, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89, 0x87, 0x88, 0x88, 0x99, 0x98, 0x88,
-	0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x98, 0x99, 0x98, 0x88, 0x88, 0x98, 0x88, 0x77, 0x88, 0x78,
-	0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x76
+	0xD0, 0xAF, 0xFB, 0xB2, 0x22, 0x55, 0x54, 0x0A, 0xBA, 0xCF, 0x2A, 0xE3, 0xFF, 0x16, 0xE1, 0x62,
+	0x2F, 0x07, 0xF2, 0x88, 0x12, 0xB8, 0x21, 0x08, 0x88, 0x88, 0x42, 0x22, 0x22, 0x22, 0x20, 0x55,
+	0x4A, 0x8B, 0x88, 0xAE, 0x22, 0xAE, 0x08, 0x88, 0x88, 0xAB, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x2A, 0xE0, 0x88, 0x4F, 0xC6, 0x4F, 0xBA, 0xC0, 0x48, 0x88, 0x4D, 0x88, 0x88, 0x42, 0xB4, 0x48,
+	0x51, 0x4B, 0xC5, 0x82, 0xEB, 0x1A, 0xFB, 0x6C, 0xE3, 0xAB, 0x89, 0x59, 0x43, 0xB8, 0x15, 0xEC,
+	0x89, 0x61, 0xE5, 0x12, 0xBF, 0xE5, 0x8B, 0xA8, 0x8F, 0xC8, 0xF2, 0x59, 0x15, 0x88, 0x8B, 0x49,
+	0x40, 0x8A, 0xB8, 0x22, 0x06, 0xFA, 0x2E, 0x21, 0x2B, 0x82, 0xB8, 0x12, 0xBF, 0x92, 0x72, 0xBC,
+	0x04, 0xBD, 0x64, 0x1C, 0xC8, 0x5C, 0x33, 0x0F, 0xC1, 0x2E, 0xCD, 0x9F, 0x94, 0xA2, 0x22, 0x05,
+	0x58, 0x4A, 0x2F, 0xF1, 0x4A, 0xFC, 0xAB, 0xBF, 0x22, 0xEA, 0xE2, 0x56, 0x59, 0x46, 0xEB, 0x28,
+	0x54, 0x50, 0x05, 0x02, 0xAE, 0xFE, 0xBB, 0x2F, 0xCF, 0xAA, 0x22, 0x2B, 0x88, 0x12, 0xB1, 0x11,
+	0x59, 0x18, 0x12, 0x14, 0x43, 0x53, 0xEA, 0x04, 0x40, 0x4B, 0xAE, 0x8B, 0xA2, 0xEF, 0xCE, 0xCE,
+	0xCB, 0x88, 0x88, 0x41, 0x01, 0x25, 0x64, 0x88, 0x88, 0x81, 0x22, 0x22, 0x21, 0x0A, 0xE2, 0x06,
+	0x54, 0x92, 0x22, 0x22, 0xB8, 0xAE, 0xB8, 0xAE, 0xBE, 0xEE, 0xE3, 0xC8, 0x88, 0x88, 0x88, 0x88,
+	0x40, 0x48, 0x42, 0x04, 0x88, 0x42, 0x04, 0x88, 0x88, 0xAE, 0xBA, 0xB8, 0x22, 0x22, 0x10, 0x12,
+	0x21, 0x15, 0x84, 0x88, 0x88, 0x72, 0xAE, 0x0A, 0xEB, 0xAE, 0xAE, 0x0A, 0xB8, 0x10, 0x88, 0x88,
+	0x88, 0x40, 0x48, 0x8A, 0xE2, 0x22, 0x2A, 0xE0, 0xAB, 0x82, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x42,
+	0x10, 0x84, 0x10, 0x42, 0x21, 0xCA, 0x21, 0x08, 0xAE, 0xBE, 0xE2, 0x88, 0x88, 0x8A, 0xE2, 0x04,
+	0x85, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xEE, 0xBA, 0x22, 0x22, 0xFA, 0xB8, 0x41, 0x22,
+	0x04, 0x84, 0x21, 0x0B, 0x90, 0x88, 0x88, 0xBA, 0x22, 0x22, 0x22, 0xB8, 0xBA, 0x56, 0x48, 0xAE,
+	0x20, 0x51, 0x0A, 0xEB, 0xA0, 0x48, 0xBA, 0x2B, 0x88, 0xFC, 0xAE, 0x21, 0x40, 0xBA, 0xE8, 0x15,
+	0x60, 0xBF, 0x25, 0x18, 0x3B, 0xE0, 0x85, 0x10, 0xFE, 0xF2, 0x21, 0x44, 0xEF, 0xA8, 0x44, 0x04,
+	0x72, 0x04, 0x88, 0x88, 0x42, 0xEB, 0xAE, 0x84, 0x22, 0xB8, 0x88, 0xBA, 0x56, 0x25, 0xB8, 0x22,
+	0x04, 0x88, 0xAE, 0x40, 0x81, 0xE2, 0xBA, 0xE2, 0x2D, 0xB1, 0xE2, 0xE2, 0x04, 0x85, 0x02, 0x14,
+	0x2B, 0x1B, 0x12, 0x20, 0x41, 0x2B, 0x8F, 0xCB, 0x87, 0x36, 0x35, 0x83, 0xEE, 0xAD, 0x4C, 0x44,
+	0xEF, 0xAD, 0x10, 0x3A, 0x58, 0xAF, 0xEC, 0x15, 0x0B, 0xCA, 0xAF, 0xE5, 0x48, 0xE5, 0xBA, 0xDA,
+	0x84, 0x10, 0x6F, 0xE5, 0xBE, 0x52, 0x3C, 0x4A, 0xF2, 0x2E, 0x54, 0xE3, 0x54, 0xBF, 0x92, 0xE9,
+	0x52, 0xBD, 0x5A, 0xE8, 0x4B, 0xD8, 0x5A, 0x6B, 0x16, 0xBE, 0x26, 0x66, 0xC5, 0x4B, 0xA9, 0x6F,
+	0x39, 0x0C, 0x10, 0x85, 0x33, 0xCF, 0x96, 0xA9, 0xC6, 0xD4, 0xCE, 0x3D, 0x0A, 0xF9, 0x46, 0xFA,
+	0x15, 0xAB, 0x05, 0x3B, 0xB0, 0x56, 0xE6, 0x43, 0xBA, 0xE4, 0x65, 0x4B, 0xB3, 0x16, 0xFC, 0x85,
+	0x13, 0xA8, 0x7C, 0x5A, 0xAF, 0xC5, 0x2A, 0x4F, 0x03, 0xA1, 0xC4, 0x85, 0xAB, 0xBF, 0xBB, 0xAF,
+	0xD1, 0x08, 0x51, 0x33, 0xC8, 0x54, 0x87, 0x35, 0xA3, 0xBE, 0x02, 0x14, 0xBF, 0xF1, 0x30, 0xEC,
+	0x05, 0xBF, 0x04, 0x86, 0xF4, 0x2C, 0xBA, 0x06, 0xD4, 0xE5, 0xB1, 0x68, 0x7C, 0x25, 0xBC, 0x6A,
+	0x16, 0x5C, 0x3A, 0x1C, 0xF4, 0xE0, 0xC6, 0xC4, 0xBB, 0x7C, 0x90, 0x87, 0x6F, 0xC4, 0x0D, 0x33,
+	0x9A, 0xB6, 0xE5, 0x78, 0x1A, 0x60, 0x5B, 0x9B, 0x1E, 0x4B, 0x1F, 0x96, 0x12, 0x73, 0xE6, 0xA3,
+	0x59, 0x21, 0xC0, 0xFB, 0xD6, 0xAA, 0x57, 0x89, 0xE3, 0x5B, 0x18, 0x7A, 0x9D, 0xA9, 0x7C, 0x2D,
+	0x6C, 0x0E, 0x4B, 0xE1, 0xD0, 0xB8, 0x1F, 0x94, 0xB0, 0x12, 0x22, 0xB4, 0xBB, 0x5B, 0x93, 0x1B,
+	0x26, 0x61, 0xC9, 0xF9, 0x6E, 0x5B, 0x87, 0x03, 0x13, 0x98, 0xDF, 0x69, 0xC6, 0x82, 0xAF, 0xD0,
+	0x88, 0x77, 0x93, 0x96, 0xE0, 0x32, 0x6F, 0x53, 0x84, 0x5F, 0x03, 0xE4, 0xB0, 0x78, 0x5A, 0x57,
+	0x88, 0x78, 0xC0, 0xB9, 0x7C, 0x12, 0x86, 0xC7, 0x18, 0x1F, 0x1A, 0x3E, 0xCD, 0x62, 0x6D, 0x4F,
+	0x29, 0x9E, 0x13, 0x9C, 0x8D, 0xE4, 0x81, 0x2F, 0x59, 0xE9, 0x6C, 0x0E, 0x34, 0xE4, 0x78, 0xD2,
+	0x36, 0x2D, 0x4E, 0xE4, 0x3A, 0x17, 0xE1, 0x2D, 0x0F, 0x17, 0xA1, 0xA8, 0x1B, 0x16, 0xE7, 0x2A,
+	0xD4, 0xE4, 0x3D, 0x9B, 0x0E, 0x49, 0x9E, 0x10, 0xAE, 0x89, 0xF4, 0x3C, 0x60, 0x8B, 0x93, 0x9F,
+	0x91, 0xA8, 0x74, 0xF1, 0xA2, 0x2F, 0x5A, 0x35, 0xB8, 0x08, 0x6C, 0x7C, 0x07, 0x2E, 0x1B, 0x5A,
+	0xB1, 0xE4, 0x1B, 0xD8, 0xB9, 0x31, 0x7A, 0x48, 0xB6, 0xD2, 0x88, 0xB8, 0x74, 0x38, 0x1B, 0x4B,
+	0x96, 0xF0, 0xE5, 0x2D, 0x8E, 0x13, 0xCE, 0x41, 0xC6, 0xFA, 0x5A, 0x52, 0xE8, 0xB9, 0x4C, 0x4F,
+	0x8A, 0x56, 0x32, 0xF4, 0xAF, 0x5A, 0x1B, 0x22, 0x22, 0xAC, 0x41, 0xC3, 0x86, 0xF1, 0x8A, 0xC4,
+	0x87, 0x6C, 0x28, 0x6F, 0xC4, 0x8B, 0x14, 0xAE, 0x07, 0x82, 0xB8, 0x53, 0x1B, 0x82, 0x1B, 0xE5,
+	0x38, 0x4F, 0x96, 0xA0, 0x81, 0xB8, 0x8B, 0x9C, 0x49, 0xF2, 0x48, 0x21, 0xCA, 0x57, 0xA8, 0x4A,
+	0x2D, 0x80, 0x4F, 0x21, 0xBD, 0x8B, 0x17, 0x30, 0x3C, 0x94, 0xC1, 0xBB, 0x6B, 0x43, 0xD0, 0xE0,
+	0x6F, 0x90, 0x87, 0x21, 0xE0, 0x88, 0x88, 0x4E, 0x88, 0x81, 0x3B, 0xDB, 0x18, 0x22, 0x2E, 0x42,
+	0xB4, 0x72, 0x13, 0xF6, 0x38, 0x53, 0xC0, 0xAD, 0x82, 0x07, 0x88, 0x88, 0x1E, 0x22, 0x22, 0x20,
+	0x6C, 0xA1, 0x38, 0x6C, 0xA2, 0x2E, 0x12, 0x22, 0x22, 0x22, 0x2E, 0x4B, 0x85, 0x0B, 0xC0, 0x88,
+	0x88, 0x88, 0xAE, 0x59, 0x38, 0x6F, 0x62, 0x08, 0x1B, 0x88, 0x88, 0xB9, 0x08, 0x88, 0x88, 0xB4,
+	0x72, 0xA1, 0xBD, 0x82, 0x21, 0xF6, 0x24, 0xB8, 0x8B, 0xA1, 0x08, 0x74, 0xBA, 0x07, 0x8E, 0x4D,
+	0x88, 0x4B, 0x88, 0xAF
 };
 
+/* 2-bit ADPCM, SNR 10.9 dB */
 const u8 sfx_barrel_explode[] __attribute__((aligned(4))) = {
-	0x68, 0x88, 0x89, 0x89, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x99, 0x88, 0x88, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x87, 0x77, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x76,
-	0xBB, 0x75, 0x56, 0x8C, 0xCA, 0x98, 0x72, 0x66, 0x79, 0xBB, 0x7B, 0x98, 0x75, 0x45, 0x79, 0x79,
-	0xAA, 0xDB, 0x98, 0x65, 0x55, 0x57, 0x78, 0x99, 0xA9, 0x9A, 0x89, 0x76, 0x98, 0x97, 0x98, 0x78,
-	0x57, 0x99, 0xB9, 0x97, 0xA8, 0x86, 0x66, 0x75, 0x98, 0x89, 0x9A, 0x7C, 0x53, 0xC5, 0x3A, 0x73,
-	0xA7, 0x7B, 0xE8, 0xF8, 0xCB, 0x5C, 0x77, 0x78, 0x37, 0x56, 0x85, 0x9A, 0x9B, 0x9B, 0xAE, 0x36,
-	0x63, 0x93, 0x9B, 0x88, 0xCB, 0x98, 0x6C, 0x53, 0x94, 0xB6, 0xFB, 0x9B, 0x88, 0x58, 0x29, 0xB5,
-	0xB6, 0x77, 0x68, 0x49, 0xC9, 0x5D, 0xA6, 0x55, 0xC7, 0x4A, 0x6C, 0x87, 0x48, 0x93, 0xE5, 0xEA,
-	0x8B, 0x47, 0x3B, 0x56, 0xCD, 0x9A, 0x77, 0x63, 0x84, 0x78, 0x89, 0xA6, 0xC8, 0x99, 0xAA, 0xAB,
-	0x97, 0x76, 0x56, 0x64, 0x57, 0x88, 0x99, 0x79, 0x9A, 0x87, 0x77, 0x57, 0x9A, 0x98, 0x96, 0x74,
-	0x8A, 0xAB, 0xCD, 0xCD, 0xDC, 0xA8, 0x87, 0x67, 0x75, 0x77, 0x88, 0x98, 0x67, 0x66, 0x65, 0x73,
-	0x38, 0x8B, 0xCC, 0xBA, 0xA9, 0x96, 0x65, 0x44, 0x65, 0x67, 0xAB, 0x99, 0x88, 0x99, 0x8A, 0xA8,
-	0x96, 0x76, 0x85, 0x77, 0x97, 0xAE, 0xAB, 0xDA, 0xA9, 0x9A, 0xCA, 0xB9, 0x77, 0x75, 0x44, 0x43,
-	0x25, 0xA7, 0x7D, 0x9D, 0x9A, 0xB8, 0xC7, 0x87, 0x46, 0x88, 0x96, 0x76, 0x75, 0x27, 0x21, 0x11,
-	0x68, 0x8A, 0xB9, 0xA8, 0x89, 0x88, 0x86, 0xCC, 0xDD, 0xCD, 0xCE, 0xCB, 0x87, 0x77, 0x86, 0x67,
-	0x66, 0x7A, 0xAA, 0xAA, 0xAA, 0x98, 0x78, 0x85, 0x44, 0x24, 0x55, 0x67, 0x6A, 0xCC, 0xCC, 0xBD,
-	0xB9, 0x88, 0x86, 0x67, 0x68, 0x77, 0x78, 0x87, 0x99, 0x98, 0x88, 0x88, 0x66, 0x66, 0x9A, 0xBC,
-	0xBA, 0xA8, 0x77, 0x65, 0x43, 0x55, 0x56, 0x46, 0x65, 0x86, 0x9A, 0xAA, 0xCB, 0xBB, 0xAA, 0xB6,
-	0x98, 0x7A, 0xAA, 0x9A, 0x89, 0x87, 0x77, 0x66, 0x76, 0x87, 0xA8, 0xAB, 0x97, 0x55, 0x33, 0x23,
-	0x44, 0x68, 0x9A, 0xBC, 0xCE, 0x9B, 0xEC, 0xBA, 0xA9, 0x88, 0x87, 0x88, 0x88, 0x76, 0x65, 0x54,
-	0x55, 0x67, 0x8A, 0x9C, 0xBB, 0xA9, 0x89, 0x87, 0x57, 0x77, 0x88, 0x99, 0x98, 0x78, 0x65, 0x65,
-	0x45, 0x57, 0x79, 0xAA, 0xAB, 0xAA, 0x98, 0x88, 0x87, 0x89, 0x88, 0x76, 0x68, 0x78, 0x78, 0xBC,
-	0xBC, 0xBA, 0xC9, 0xA8, 0x97, 0x78, 0x89, 0x78, 0x76, 0x86, 0x65, 0x76, 0x88, 0x77, 0x68, 0x89,
-	0x9A, 0x98, 0x87, 0x86, 0x79, 0x79, 0xA8, 0x99, 0x77, 0x65, 0x45, 0x44, 0x45, 0x68, 0x98, 0x88,
-	0x98, 0x9B, 0xBC, 0xBC, 0xAA, 0xBA, 0xAB, 0x99, 0x88, 0x96, 0x76, 0x53, 0x54, 0x46, 0x69, 0x57,
-	0x67, 0x87, 0x8A, 0x9C, 0x98, 0x98, 0xA9, 0xAB, 0xCC, 0xEC, 0xEC, 0xAC, 0x99, 0x88, 0x76, 0x76,
-	0x66, 0x65, 0x54, 0x55, 0x46, 0x55, 0x66, 0x76, 0x78, 0x8A, 0xBA, 0xCC, 0xBB, 0xA8, 0x9A, 0x99,
-	0x87, 0x78, 0x7A, 0x99, 0xA8, 0x88, 0x77, 0x54, 0x43, 0x44, 0x45, 0x56, 0x67, 0x77, 0x78, 0x67,
-	0x88, 0x9A, 0xAB, 0xBB, 0xCA, 0xBB, 0xCB, 0xB9, 0x99, 0x79, 0x88, 0x86, 0x77, 0x76, 0x76, 0x77,
-	0x78, 0x99, 0x99, 0xA9, 0xA9, 0xAA, 0x99, 0x97, 0x79, 0x78, 0x8A, 0x87, 0x96, 0x75, 0x54, 0x36,
-	0x64, 0x68, 0x78, 0x79, 0xA9, 0x99, 0x8A, 0x8A, 0xAB, 0xB8, 0xCA, 0xA9, 0x98, 0x87, 0x56, 0x76,
-	0x56, 0x67, 0x66, 0x55, 0x55, 0x56, 0x68, 0x79, 0x98, 0x99, 0xBB, 0xBB, 0xAC, 0x9A, 0xA9, 0x99,
-	0x98, 0x77, 0x75, 0x49, 0x48, 0x87, 0x76, 0x78, 0x68, 0x88, 0x99, 0x99, 0xA9, 0xA9, 0x8B, 0xBA,
-	0xBD, 0x9A, 0xAA, 0xA8, 0x8A, 0x66, 0x74, 0x85, 0x56, 0x67, 0x58, 0x84, 0x77, 0x79, 0x77, 0x78,
-	0x89, 0x9B, 0xCA, 0xCA, 0xAA, 0x77, 0x87, 0x88, 0x86, 0x57, 0x55, 0x65, 0x55, 0x66, 0x65, 0x67,
-	0x88, 0x88, 0x78, 0x8B, 0xBB, 0xBA, 0xBB, 0xAC, 0xA9, 0x9A, 0x98, 0x88, 0x78, 0x78, 0xA7, 0x79,
-	0x98, 0x78, 0x89, 0x99, 0xB8, 0x7A, 0x87, 0x88, 0x88, 0x85, 0x85, 0x54, 0x55, 0x65, 0x56, 0x88,
-	0x78, 0x99, 0x89, 0x89, 0x8A, 0xAA, 0xAB, 0xAC, 0xBB, 0xAA, 0xA9, 0x87, 0x76, 0x55, 0x45, 0x66,
-	0x89, 0x99, 0x97, 0x86, 0x75, 0x56, 0x64, 0x67, 0x77, 0x98, 0x99, 0x79, 0x77, 0x97, 0x99, 0xBB,
-	0xAC, 0xBC, 0xDD, 0xDD, 0xAA, 0x99, 0x89, 0x79, 0x86, 0x77, 0x55, 0x76, 0x86, 0x78, 0x88, 0x98,
-	0x99, 0x88, 0x98, 0x97, 0x87, 0x86, 0x55, 0x75, 0x45, 0x65, 0x86, 0x87, 0x88, 0x7A, 0x89, 0x8A,
-	0x88, 0x98, 0x88, 0x88, 0x86, 0x55, 0x67, 0x67, 0x98, 0xAB, 0xAD, 0x9C, 0xDB, 0xDA, 0xAA, 0x98,
-	0x88, 0x68, 0x54, 0x46, 0x67, 0x57, 0x87, 0x89, 0x98, 0x99, 0xAB, 0x98, 0x99, 0x89, 0x79, 0x87,
-	0x87, 0x77, 0x78, 0x88, 0x89, 0x68, 0x88, 0x67, 0x56, 0x76, 0x87, 0x89, 0xAB, 0x9B, 0xAB, 0xAA,
-	0xB9, 0xAA, 0x9A, 0x98, 0x98, 0x66, 0x64, 0x43, 0x54, 0x36, 0x55, 0x77, 0x79, 0xA9, 0xAA, 0x89,
-	0xA8, 0x98, 0x88, 0x69, 0x87, 0x79, 0x87, 0x87, 0x67, 0x78, 0x69, 0x79, 0xB8, 0x78, 0x78, 0x68,
-	0x86, 0xA8, 0x8A, 0xA7, 0xB7, 0xC9, 0x8B, 0x7A, 0x97, 0x78, 0x77, 0x78, 0x67, 0x87, 0x89, 0xB9,
-	0xAC, 0xAB, 0xA9, 0xBA, 0x88, 0x88, 0x66, 0x77, 0x58, 0x86, 0x8A, 0x78, 0x78, 0x78, 0x89, 0x87,
-	0x89, 0x76, 0x77, 0x57, 0x76, 0x85, 0x77, 0x56, 0x57, 0x66, 0x99, 0x99, 0x8B, 0xB9, 0xB9, 0xB9,
-	0xB9, 0xBA, 0x89, 0x88, 0x77, 0xA7, 0x78, 0x87, 0x86, 0x87, 0x88, 0x66, 0x65, 0x65, 0x46, 0x67,
-	0x97, 0xA9, 0x9C, 0xAB, 0xBC, 0xBC, 0xBD, 0xCA, 0x9A, 0x97, 0x86, 0x57, 0x64, 0x75, 0x99, 0x8A,
-	0x99, 0x67, 0x66, 0x57, 0x75, 0x86, 0x65, 0x88, 0x88, 0x88, 0x8A, 0x87, 0xAA, 0x97, 0x87, 0xA9,
-	0x9A, 0x98, 0xA8, 0x98, 0x97, 0x89, 0x98, 0x77, 0x78, 0x77, 0x88, 0x77, 0x65, 0x67, 0x88, 0x97,
-	0x79, 0x88, 0x89, 0x87, 0x65, 0x85, 0x87, 0x9B, 0x9A, 0x89, 0xB8, 0x88, 0x7A, 0x89, 0xA8, 0x9A,
-	0x89, 0xAA, 0xAA, 0x88, 0x75, 0x74, 0x47, 0x45, 0x66, 0x78, 0x88, 0x99, 0x98, 0x8A, 0x88, 0x88,
-	0x89, 0x98, 0xA9, 0xBB, 0xCC, 0xCA, 0xAA, 0x99, 0x99, 0x67, 0x86, 0x77, 0x77, 0x76, 0x67, 0x77,
-	0x56, 0x55, 0x76, 0x56, 0x65, 0x77, 0x65, 0x64, 0x56, 0x87, 0x88, 0xA9, 0xAC, 0x9A, 0xBA, 0xB9,
-	0x99, 0x89, 0xAA, 0xAC, 0xBA, 0xBA, 0xA9, 0x9A, 0x89, 0x79, 0x88, 0x88, 0x98, 0x88, 0x86, 0x77,
-	0x56, 0x77, 0x87, 0x66, 0x67, 0x65, 0x76, 0x65, 0x66, 0x76, 0x87, 0x88, 0x8B, 0x9A, 0xAA, 0x87,
-	0x88, 0x88, 0x9A, 0x9A, 0x9A, 0xBA, 0xCA, 0xBB, 0xAA, 0x99, 0x98, 0x88, 0x76, 0x76, 0x76, 0x66,
-	0x54, 0x44, 0x34, 0x45, 0x66, 0x78, 0x87, 0x88, 0x99, 0xAA, 0xBA, 0xBA, 0xBB, 0xCC, 0xBB, 0xBA,
-	0x98, 0x78, 0x87, 0x76, 0x67, 0x66, 0x77, 0x79, 0x78, 0x88, 0x65, 0x65, 0x87, 0x76, 0x88, 0x88,
-	0x8B, 0xAB, 0xCC, 0xAB, 0xA7, 0x87, 0x77, 0x87, 0x78, 0x88, 0x87, 0x88, 0x78, 0x88, 0x87, 0x77,
-	0x78, 0x67, 0x77, 0x78, 0x89, 0x9A, 0xAA, 0xA9, 0x99, 0x88, 0x66, 0x66, 0x78, 0x68, 0x89, 0x88,
-	0x89, 0x77, 0x87, 0x76, 0x77, 0x78, 0x88, 0x98, 0x98, 0x78, 0x99, 0x8A, 0xAB, 0xA9, 0xBB, 0xBB,
-	0xCB, 0xAB, 0xA9, 0xA9, 0x89, 0x88, 0x87, 0x77, 0x77, 0x66, 0x56, 0x67, 0x56, 0x65, 0x66, 0x66,
-	0x65, 0x65, 0x7A, 0x9A, 0x99, 0xA8, 0xBA, 0x98, 0x87, 0x86, 0x67, 0x98, 0x88, 0x87, 0x88, 0xAB,
-	0xBB, 0xBC, 0xDB, 0xA9, 0x89, 0x86, 0x76, 0x55, 0x65, 0x66, 0x67, 0x68, 0x77, 0x77, 0x88, 0x78,
-	0x77, 0x77, 0x66, 0x56, 0x67, 0x88, 0x99, 0xAB, 0xA9, 0xAA, 0xAA, 0xAC, 0xCB, 0xDB, 0xDC, 0xBA,
-	0x99, 0x78, 0x77, 0x67, 0x65, 0x67, 0x66, 0x78, 0x77, 0x76, 0x66, 0x66, 0x78, 0x79, 0x89, 0x98,
-	0x87, 0x87, 0x89, 0x88, 0x98, 0x88, 0x79, 0x88, 0x99, 0xAA, 0x98, 0x88, 0x87, 0x78, 0x77, 0x86,
-	0x96, 0x89, 0x88, 0x88, 0x79, 0x98, 0x98, 0x77, 0x98, 0x79, 0x8A, 0x9A, 0x9A, 0x97, 0x88, 0x76,
-	0x78, 0x67, 0x77, 0x99, 0x77, 0xA9, 0x88, 0x98, 0x78, 0x78, 0x98, 0x89, 0x99, 0x99, 0x99, 0xA9,
-	0x78, 0x77, 0x76, 0x76, 0x57, 0x66, 0x77, 0x88, 0x88, 0x89, 0x89, 0xAB, 0xCB, 0xA9, 0x9A, 0x98,
-	0x88, 0x89, 0x87, 0x67, 0x78, 0x87, 0x88, 0x68, 0x66, 0x76, 0x56, 0x67, 0x97, 0xAA, 0xA9, 0x9A,
-	0x98, 0x88, 0x9A, 0xAA, 0x99, 0x98, 0x86, 0x65, 0x76, 0x77, 0x78, 0x78, 0x98, 0x8A, 0xA9, 0xA9,
-	0x98, 0x98, 0x87, 0x66, 0x64, 0x66, 0x56, 0x56, 0x67, 0x89, 0x8A, 0x99, 0x9A, 0x99, 0xA9, 0x89,
-	0xC9, 0xBA, 0xBC, 0xAB, 0xA9, 0x88, 0x77, 0x66, 0x77, 0x79, 0x98, 0x89, 0xA8, 0x89, 0x88, 0x87,
-	0x67, 0x66, 0x87, 0x78, 0x87, 0x67, 0x78, 0x77, 0x67, 0x77, 0x88, 0x9A, 0xBA, 0xA9, 0x99, 0x88,
-	0x77, 0x89, 0x88, 0x98, 0x89, 0x8A, 0xA8, 0x98, 0x66, 0x66, 0x65, 0x76, 0x77, 0x74, 0x77, 0x57,
-	0x67, 0x79, 0x88, 0x87, 0x87, 0x98, 0xA9, 0x9A, 0xAB, 0xA9, 0xAB, 0x97, 0x96, 0x78, 0x58, 0x57,
-	0x77, 0x98, 0xA7, 0x99, 0x9A, 0xAA, 0xCB, 0xBA, 0xAA, 0x99, 0x98, 0xA9, 0x88, 0xA9, 0x98, 0x88,
-	0x76, 0x54, 0x55, 0x66, 0x56, 0x66, 0x56, 0x75, 0x43, 0x45, 0x56, 0x67, 0x87, 0x88, 0x99, 0xAC,
-	0xBA, 0xBA, 0xAA, 0xAA, 0x9B, 0xAB, 0xAA, 0xAA, 0x99, 0x88, 0x88, 0x78, 0x77, 0x88, 0x67, 0x76,
-	0x65, 0x67, 0x68, 0x78, 0x88, 0x87, 0x89, 0x99, 0xA9, 0x99, 0x98, 0x98, 0x89, 0x99, 0x89, 0x98,
-	0x88, 0x88, 0x88, 0x89, 0x78, 0x87, 0x86, 0x77, 0x67, 0x77, 0x78, 0x89, 0x8A, 0x9A, 0x98, 0x88,
-	0x77, 0x77, 0x78, 0x99, 0x88, 0x99, 0x88, 0x99, 0x89, 0x88, 0x98, 0x98, 0x88, 0x87, 0x76, 0x66,
-	0x76, 0x78, 0x78, 0x89, 0x9A, 0x9A, 0xAA, 0x99, 0x99, 0x98, 0x99, 0x89, 0x9A, 0xAB, 0x99, 0x98,
-	0x76, 0x75, 0x64, 0x54, 0x56, 0x56, 0x65, 0x76, 0x78, 0x88, 0x89, 0x99, 0xB9, 0xAA, 0xAA, 0x9A,
-	0xA9, 0x98, 0x89, 0x88, 0x98, 0x88, 0x86, 0x76, 0x78, 0x88, 0x89, 0x88, 0x97, 0x88, 0x88, 0x87,
-	0x67, 0x66, 0x67, 0x76, 0x56, 0x66, 0x76, 0x78, 0xA9, 0xAA, 0xBA, 0xBA, 0x89, 0x99, 0x9A, 0xB9,
-	0x89, 0x78, 0x77, 0x76, 0x77, 0x78, 0x87, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x89, 0x98, 0x99,
-	0x88, 0x87, 0x88, 0x88, 0x89, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x79, 0x99, 0x89, 0x88, 0x78,
-	0x87, 0x86, 0x87, 0x67, 0x66, 0x66, 0x67, 0x66, 0x77, 0x89, 0xA8, 0x9B, 0xB9, 0xA8, 0x97, 0x78,
-	0x65, 0x66, 0x77, 0x78, 0x87, 0x78, 0x79, 0x77, 0x87, 0x8A, 0x9A, 0x99, 0xB9, 0x99, 0x9A, 0xAA,
-	0xAA, 0x9A, 0xA9, 0x87, 0x76, 0x68, 0x76, 0x76, 0x67, 0x78, 0x89, 0x88, 0xAA, 0xBA, 0x88, 0x77,
-	0x66, 0x77, 0x68, 0x67, 0x77, 0x76, 0x66, 0x77, 0x98, 0x89, 0x99, 0x89, 0xAB, 0x9C, 0xAA, 0xB9,
-	0x98, 0x87, 0x66, 0x65, 0x67, 0x57, 0x66, 0x67, 0x98, 0x89, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x79, 0x98, 0x89, 0x89, 0x99, 0x98, 0x98, 0x87, 0x76, 0x87, 0x8B, 0x98, 0x88, 0x89, 0x87,
-	0x88, 0x98, 0x66, 0x66, 0x78, 0x86, 0x89, 0x68, 0x86, 0x98, 0x66, 0x87, 0x89, 0x8A, 0xA9, 0xA9,
-	0xAA, 0xA9, 0x9A, 0x9A, 0x9A, 0x97, 0x58, 0x67, 0x86, 0x77, 0x67, 0x78, 0x76, 0x57, 0x88, 0x68,
-	0x87, 0x87, 0x77, 0x7A, 0x9A, 0xAA, 0xA9, 0x98, 0x78, 0x77, 0x77, 0x78, 0x98, 0x76, 0x87, 0x88,
-	0x68, 0x88, 0x89, 0x89, 0xA7, 0xA9, 0x8A, 0x87, 0x89, 0x97, 0x88, 0x68, 0x63, 0x56, 0x57, 0x68,
-	0x88, 0x9A, 0x9A, 0xCB, 0xBB, 0xAA, 0x99, 0x99, 0x99, 0x87, 0x77, 0x75, 0x45, 0x56, 0x77, 0x88,
-	0x87, 0x9A, 0x9A, 0x99, 0xA9, 0x9A, 0x99, 0x98, 0x88, 0x78, 0x77, 0x76, 0x66, 0x66, 0x76, 0x77,
-	0x87, 0x89, 0x99, 0x99, 0x88, 0x88, 0x79, 0x87, 0x87, 0x67, 0x67, 0x87, 0x67, 0x78, 0x88, 0x88,
-	0x9A, 0xAA, 0x89, 0xA9, 0xA9, 0xA9, 0x97, 0x89, 0x99, 0x99, 0x87, 0x88, 0x98, 0x87, 0x79, 0x98,
-	0x88, 0x78, 0x79, 0x99, 0x88, 0x88, 0x86, 0x74, 0x67, 0x46, 0x66, 0x77, 0x88, 0x99, 0x79, 0x99,
-	0xBA, 0xAA, 0xAA, 0x99, 0x88, 0x77, 0x76, 0x68, 0x78, 0x88, 0x78, 0x87, 0x87, 0x87, 0x67, 0x77,
-	0x77, 0x67, 0x77, 0x78, 0x9A, 0x9A, 0xAA, 0x89, 0x98, 0x97, 0x87, 0x98, 0x78, 0x87, 0x8A, 0x89,
-	0x89, 0x78, 0x89, 0x99, 0x99, 0x98, 0x88, 0x78, 0x87, 0x66, 0x66, 0x66, 0x57, 0x77, 0x89, 0x88,
-	0x9A, 0xAA, 0x99, 0x97, 0x88, 0x86, 0x8A, 0x76, 0x88, 0x68, 0x78, 0x98, 0xA9, 0xA9, 0x9A, 0x98,
-	0x88, 0x66, 0x66, 0x77, 0x78, 0x78, 0x77, 0x89, 0x88, 0x88, 0xAA, 0x87, 0x8A, 0x99, 0x88, 0x98,
-	0x89, 0x77, 0x86, 0x66, 0x66, 0x76, 0x78, 0x9A, 0xAB, 0xCB, 0xBA, 0xA9, 0x99, 0x98, 0x88, 0x87,
-	0x76, 0x76, 0x65, 0x67, 0x77, 0x79, 0x88, 0x87, 0x88, 0x8A, 0x88, 0x98, 0x79, 0x98, 0x98, 0x79,
-	0x88, 0x89, 0x98, 0x8A, 0x89, 0x98, 0x76, 0x66, 0x55, 0x66, 0x75, 0x77, 0x79, 0x9A, 0xAA, 0xA9,
-	0xAA, 0xB9, 0x9A, 0x88, 0x88, 0x88, 0x78, 0x77, 0x77, 0x88, 0x87, 0x78, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x78, 0x87, 0x77, 0x77, 0x88, 0x69, 0x88, 0x89, 0x9A, 0x99, 0xA9, 0x89, 0x88, 0x87,
-	0x88, 0x87, 0x87, 0x77, 0x76, 0x76, 0x68, 0x78, 0x88, 0x88, 0x88, 0x98, 0x88, 0x99, 0x8A, 0x99,
-	0x98, 0x77, 0x99, 0x88, 0x98, 0x9A, 0x88, 0x98, 0x78, 0x57, 0x88, 0x99, 0x99, 0x99, 0x99, 0x89,
-	0x89, 0x77, 0x76, 0x75, 0x66, 0x68, 0x88, 0x88, 0x98, 0x87, 0x77, 0x67, 0x77, 0x78, 0x88, 0x78,
-	0x87, 0x77, 0x78, 0x89, 0x9A, 0xAA, 0xBC, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x98, 0x88, 0x86, 0x77,
-	0x66, 0x66, 0x88, 0x77, 0x88, 0x89, 0x87, 0x96, 0x78, 0x87, 0x79, 0x79, 0x86, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x97, 0x77, 0x87, 0x67, 0x99, 0x99, 0x99, 0x97, 0x88, 0x76, 0x88, 0x77, 0x79,
-	0x99, 0x79, 0x97, 0x78, 0x78, 0x98, 0x88, 0x89, 0x88, 0x99, 0x9A, 0xBA, 0xBA, 0xA9, 0x89, 0x77,
-	0x67, 0x55, 0x76, 0x67, 0x87, 0x88, 0x88, 0x87, 0x89, 0x89, 0x99, 0x78, 0x89, 0x99, 0xA9, 0x89,
-	0x87, 0x88, 0x88, 0x77, 0x87, 0x77, 0x66, 0x66, 0x67, 0x77, 0x88, 0x79, 0x87, 0x98, 0x98, 0x98,
-	0x8A, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x98, 0x88, 0x88, 0x88, 0x78, 0x85, 0x66,
-	0x76, 0x66, 0x77, 0x67, 0x77, 0x68, 0x88, 0x98, 0x9A, 0xBA, 0xB9, 0x8A, 0x9A, 0xA9, 0x88, 0x98,
-	0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x87, 0x76, 0x56, 0x56, 0x66, 0x58, 0x77, 0x88, 0x99, 0xAA,
-	0xAA, 0xA9, 0x99, 0xA8, 0x88, 0x87, 0x89, 0x66, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x98, 0x98,
-	0x89, 0xAA, 0xAA, 0xAA, 0x99, 0x98, 0x78, 0x86, 0x76, 0x67, 0x77, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x88, 0x98, 0x88, 0x68, 0x87, 0x87, 0x99, 0x98, 0x89, 0x89, 0xA9, 0xA8, 0x98, 0x78, 0x88, 0x98,
-	0x99, 0x88, 0x77, 0x76, 0x76, 0x66, 0x67, 0x66, 0x66, 0x77, 0x87, 0x88, 0x88, 0x77, 0x89, 0x97,
-	0x98, 0x99, 0x99, 0x9A, 0x99, 0x89, 0x99, 0x98, 0x99, 0x8A, 0x99, 0x99, 0x99, 0x78, 0x88, 0x68,
-	0x88, 0x87, 0x88, 0x78, 0x77, 0x77, 0x77, 0x88, 0x8A, 0x99, 0x99, 0x88, 0x57, 0x87, 0x76, 0x78,
-	0x89, 0x98, 0x78, 0x87, 0x78, 0x98, 0x9A, 0x98, 0x88, 0x77, 0x78, 0x88, 0x99, 0x99, 0x98, 0x88,
-	0x78, 0x78, 0x76, 0x67, 0x76, 0x78, 0x87, 0x87, 0x79, 0x98, 0x88, 0x98, 0x89, 0x98, 0x99, 0x98,
-	0x89, 0x88, 0x88, 0x77, 0x85, 0x77, 0x75, 0x77, 0x78, 0x89, 0x88, 0x98, 0x89, 0xAA, 0xA9, 0x89,
-	0x88, 0x89, 0x99, 0x9A, 0x9A, 0x9A, 0x99, 0xA9, 0x98, 0x87, 0x88, 0x87, 0x76, 0x65, 0x67, 0x78,
-	0x89, 0x88, 0x88, 0x77, 0x77, 0x76, 0x75, 0x67, 0x78, 0x98, 0x89, 0x88, 0x98, 0x88, 0x88, 0x88,
-	0x78, 0x99, 0x98, 0x89, 0x88, 0x87, 0x79, 0x98, 0x99, 0xA9, 0x99, 0x9A, 0x9A, 0x98, 0x96, 0x87,
-	0x78, 0x77, 0x76, 0x66, 0x67, 0x78, 0x87, 0x88, 0x88, 0x89, 0x99, 0xA9, 0x98, 0x88, 0x87, 0x78,
-	0x96, 0x98, 0x89, 0x88, 0x99, 0x88, 0x88, 0x97, 0x77, 0x88, 0x87, 0x88, 0x68, 0x78, 0x77, 0x87,
-	0x78, 0x88, 0x88, 0x77, 0x98, 0x99, 0x98, 0x99, 0x88, 0x88, 0x99, 0x89, 0x87, 0x88, 0x88, 0x78,
-	0x77, 0x76, 0x87, 0x78, 0x78, 0x77, 0x78, 0x89, 0x9A, 0x99, 0x99, 0x88, 0x88, 0x88, 0x98, 0x98,
-	0x99, 0x8A, 0x99, 0xA9, 0x99, 0x98, 0x88, 0x78, 0x76, 0x78, 0x77, 0x67, 0x67, 0x77, 0x77, 0x77,
-	0x77, 0x88, 0x78, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x9A, 0x99, 0xA9, 0x99, 0x87, 0x76, 0x88,
-	0x77, 0x77, 0x78, 0x87, 0x77, 0x77, 0x88, 0x99, 0xA9, 0x99, 0x98, 0x97, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x97, 0x77, 0x78, 0x88, 0x89, 0x88,
-	0x88, 0x99, 0x88, 0x89, 0x88, 0x88, 0x88, 0x99, 0x88, 0x87, 0x77, 0x87, 0x78, 0x88, 0x89, 0x88,
-	0x88, 0x78, 0x88, 0x77, 0x88, 0x67, 0x87, 0x78, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x99, 0x89,
-	0x9A, 0x99, 0x9B, 0x9A, 0xAA, 0x99, 0x88, 0x89, 0x78, 0x77, 0x76, 0x76, 0x67, 0x68, 0x67, 0x88,
-	0x98, 0x89, 0x99, 0x99, 0x89, 0x89, 0xA9, 0x99, 0x98, 0x87, 0x67, 0x76, 0x77, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x77, 0x88, 0x88, 0x87, 0x98, 0x99, 0x99, 0xAA, 0x99, 0x98, 0x87, 0x78, 0x87, 0x67,
-	0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x88, 0x89, 0x99, 0x99, 0x99, 0xA9, 0x99, 0x99, 0x99, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x98, 0x89, 0x88, 0x87, 0x87, 0x88, 0x78, 0x88, 0x89, 0x88, 0x98, 0x77,
-	0x67, 0x78, 0x77, 0x68, 0x88, 0x77, 0x78, 0x67, 0x88, 0x78, 0x77, 0x78, 0x88, 0x89, 0x99, 0x98,
-	0x98, 0x88, 0x78, 0x98, 0x88, 0x9A, 0xA9, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x77, 0x88,
-	0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98, 0x87, 0x98, 0x99, 0x99, 0x88,
-	0x99, 0x98, 0x98, 0x88, 0x77, 0x77, 0x77, 0x76, 0x87, 0x87, 0x77, 0x88, 0x99, 0x98, 0x99, 0x89,
-	0x88, 0x87, 0x89, 0x77, 0x87, 0x88, 0x88, 0x88, 0x76, 0x78, 0x87, 0x76, 0x87, 0x67, 0x88, 0x99,
-	0x98, 0x99, 0x99, 0xA9, 0x99, 0x78, 0x87, 0x77, 0x76, 0x88, 0x69, 0x89, 0x99, 0x98, 0x98, 0x89,
-	0xA9, 0x99, 0x9A, 0x98, 0x77, 0x76, 0x67, 0x77, 0x68, 0x77, 0x88, 0x88, 0x89, 0x88, 0x87, 0x78,
-	0x86, 0x78, 0x77, 0x88, 0x87, 0x86, 0x88, 0x89, 0x99, 0x99, 0x98, 0x99, 0x97, 0x97, 0x78, 0x77,
-	0x67, 0x87, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x89, 0x88, 0x98, 0x99, 0x98, 0x88, 0x88, 0x87,
-	0x97, 0x87, 0x88, 0x99, 0x9A, 0x98, 0x88, 0x88, 0x87, 0x77, 0x67, 0x77, 0x76, 0x77, 0x77, 0x78,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x98, 0x89, 0x98, 0x98, 0x68, 0x87,
-	0x78, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x89, 0x98, 0x98, 0x99, 0x89, 0x99,
-	0x99, 0x98, 0x88, 0x88, 0x98, 0x88, 0x77, 0x77, 0x76, 0x67, 0x65, 0x66, 0x66, 0x77, 0x68, 0x88,
-	0x98, 0x99, 0x99, 0x9A, 0xA9, 0x89, 0x98, 0x77, 0x67, 0x87, 0x78, 0x88, 0x88, 0x88, 0x87, 0x87,
-	0x89, 0x88, 0x89, 0x88, 0x98, 0x98, 0x88, 0x89, 0x89, 0x99, 0xA9, 0x99, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x76, 0x87, 0x66, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x98, 0x98, 0x88, 0x79, 0x89,
-	0x98, 0x99, 0x88, 0x87, 0x88, 0x77, 0x77, 0x76, 0x66, 0x67, 0x78, 0x88, 0x9A, 0xA9, 0x99, 0x98,
-	0x89, 0x98, 0x98, 0x99, 0x89, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x89, 0x89, 0x88, 0x87, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x87, 0x68, 0x66, 0x76, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x99, 0x89, 0x99, 0x98, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x87, 0x77, 0x78, 0x87, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x78, 0x97, 0x98, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x78, 0x87, 0x78, 0x88, 0x78, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x78, 0x88, 0x87, 0x76, 0x88, 0x89, 0x99, 0x89, 0x89, 0x88, 0x87, 0x87, 0x67, 0x77, 0x78, 0x78,
-	0x98, 0x8A, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x98, 0x88, 0x88, 0x77, 0x78, 0x77, 0x87, 0x78,
-	0x88, 0x89, 0x88, 0x88, 0x78, 0x87, 0x87, 0x88, 0x98, 0x99, 0x89, 0x99, 0x98, 0x88, 0x78, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x87, 0x88, 0x87, 0x77, 0x78, 0x78, 0x88, 0xA9,
-	0x99, 0xA9, 0x99, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x67, 0x77, 0x66, 0x77, 0x77, 0x88, 0x78,
-	0x88, 0x89, 0x99, 0x99, 0x98, 0x88, 0x88, 0x87, 0x89, 0x99, 0x99, 0x9A, 0x89, 0x89, 0x88, 0x78,
-	0x87, 0x87, 0x78, 0x77, 0x87, 0x77, 0x87, 0x89, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x77, 0x67, 0x77, 0x88, 0x88, 0x99, 0x9A,
-	0x99, 0x9A, 0x9A, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x87, 0x78, 0x78, 0x88,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x87, 0x87, 0x88, 0x88,
-	0x88, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x87, 0x88, 0x89, 0x89, 0x89, 0x99,
-	0x99, 0x99, 0x98, 0x78, 0x87, 0x87, 0x78, 0x88, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x88, 0x77, 0x76, 0x66, 0x65, 0x67, 0x78, 0x88, 0x98, 0x9A, 0x99, 0x99, 0x88,
-	0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x77, 0x88, 0x78,
-	0x88, 0x89, 0x89, 0x99, 0x89, 0x89, 0x98, 0x88, 0x87, 0x77, 0x87, 0x78, 0x88, 0x88, 0x87, 0x87,
-	0x87, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x87,
-	0x88, 0x77, 0x88, 0x99, 0x89, 0x99, 0x99, 0x98, 0x88, 0x99, 0x88, 0x87, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0x98, 0x98, 0x88, 0x88, 0x98, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x89, 0x98, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x87, 0x87, 0x78, 0x88, 0x77, 0x88, 0x88, 0x88, 0x98, 0x99, 0x99, 0x9A, 0x99,
-	0x99, 0x88, 0x88, 0x88, 0x77, 0x78, 0x87, 0x77, 0x77, 0x87, 0x88, 0x78, 0x88, 0x88, 0x99, 0x88,
-	0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x78, 0x78, 0x77, 0x76
+	0xD2, 0x5C, 0xAA, 0xE0, 0x40, 0x4F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2E, 0x84, 0x06, 0xE2, 0xD2,
+	0x88, 0x88, 0x12, 0xEB, 0x84, 0x84, 0xE8, 0xAD, 0x5F, 0x91, 0x3A, 0xF6, 0x12, 0xDA, 0xBC, 0x58,
+	0x17, 0xAE, 0x21, 0x44, 0x31, 0xEF, 0x4B, 0x6A, 0xD6, 0x6B, 0x6B, 0x27, 0x49, 0x9D, 0xF6, 0x9B,
+	0x61, 0x77, 0x0D, 0xC8, 0xC9, 0x34, 0x99, 0xDE, 0x27, 0x4C, 0x2B, 0x1F, 0x67, 0x69, 0xAC, 0xD3,
+	0x70, 0x8D, 0x6D, 0xAC, 0x6D, 0x9A, 0xC7, 0x76, 0x9C, 0xDC, 0x4C, 0xCB, 0x60, 0x93, 0x70, 0x89,
+	0xF3, 0x8B, 0x44, 0x2D, 0x9E, 0x3D, 0x1B, 0x33, 0x40, 0x19, 0xBF, 0xA9, 0xB4, 0x27, 0xCA, 0x3F,
+	0x51, 0x0E, 0xBB, 0xEC, 0x64, 0x5A, 0xA4, 0xD3, 0xBB, 0x70, 0x75, 0xA7, 0x29, 0x33, 0xAB, 0xE3,
+	0x57, 0x19, 0xC3, 0x32, 0xC6, 0x72, 0x3D, 0xE3, 0x49, 0x32, 0x88, 0xD5, 0x29, 0x9F, 0xB2, 0x38,
+	0xD5, 0x88, 0x3F, 0x9F, 0x8C, 0x65, 0x96, 0x0D, 0xE8, 0xB9, 0xD8, 0x93, 0x4B, 0x87, 0xE1, 0x50,
+	0xEB, 0xEB, 0xB4, 0x9C, 0x76, 0x48, 0x68, 0xDF, 0x2D, 0x0C, 0xCB, 0x8E, 0x65, 0x64, 0xFC, 0xCC,
+	0x05, 0x04, 0xDC, 0x6A, 0xBC, 0xB6, 0x2F, 0xB3, 0x05, 0x59, 0x8E, 0x9E, 0xC0, 0x44, 0xF9, 0xF2,
+	0x91, 0x14, 0x9A, 0xF8, 0xB5, 0xCE, 0x19, 0xD1, 0x8B, 0x73, 0x39, 0x9C, 0xA7, 0x36, 0x0A, 0xD1,
+	0x1E, 0xB7, 0x18, 0x72, 0xCE, 0xCA, 0x51, 0x62, 0x75, 0x98, 0xE2, 0xDC, 0xE7, 0x3B, 0x69, 0x1C,
+	0x86, 0x59, 0xE2, 0x64, 0x17, 0x2C, 0xEC, 0xE2, 0xAB, 0xB4, 0xD8, 0x17, 0x41, 0x66, 0x9F, 0x0A,
+	0xF9, 0x1A, 0x78, 0xFE, 0xA6, 0x15, 0x92, 0x9C, 0x45, 0x18, 0x72, 0x7B, 0x3D, 0xAB, 0x0B, 0x76,
+	0x10, 0x97, 0x26, 0xCF, 0x1C, 0x1E, 0x7A, 0xB1, 0x35, 0x89, 0x68, 0xDD, 0x0F, 0x63, 0x33, 0x83,
+	0x99, 0xAE, 0x21, 0x51, 0x36, 0x48, 0xDC, 0xB8, 0xBE, 0xF1, 0xD2, 0xB1, 0xD8, 0x62, 0x67, 0xD2,
+	0x5E, 0x23, 0xDE, 0x36, 0x81, 0xDB, 0x61, 0xC8, 0x11, 0x63, 0xBE, 0x60, 0xFD, 0xC3, 0x26, 0x31,
+	0x62, 0xD5, 0x8A, 0x4D, 0xE9, 0xE2, 0xCD, 0x79, 0x2C, 0x18, 0x7D, 0xA2, 0x3F, 0x7A, 0x66, 0x94,
+	0x92, 0xD9, 0xD2, 0x99, 0x8E, 0xBF, 0xBA, 0xD6, 0x40, 0xF3, 0xB9, 0xB4, 0x06, 0x6D, 0xC3, 0x44,
+	0xD8, 0x63, 0xEC, 0xCD, 0xB2, 0xC6, 0x70, 0x07, 0x6A, 0x77, 0x23, 0xE6, 0xC6, 0x66, 0x1D, 0x89,
+	0xC3, 0x82, 0xFE, 0x4D, 0x64, 0x9C, 0x63, 0xAF, 0x2D, 0xF0, 0x0D, 0x24, 0xB4, 0x1F, 0x0C, 0xDB,
+	0x28, 0x12, 0x7D, 0x8E, 0xC6, 0x65, 0x0D, 0x8E, 0x70, 0xCE, 0x7C, 0xBA, 0x4D, 0x84, 0x52, 0x6C,
+	0x73, 0x8D, 0xA1, 0xB7, 0x99, 0xD8, 0x78, 0x8D, 0x36, 0x1B, 0x76, 0x9C, 0x39, 0xA0, 0xC6, 0x53,
+	0x18, 0xF6, 0xCA, 0xE6, 0xD3, 0x4C, 0x8D, 0x9B, 0x1E, 0x2D, 0x37, 0x0C, 0xD8, 0x60, 0xD3, 0x63,
+	0x26, 0xEA, 0xD7, 0x9A, 0x36, 0x6E, 0xB7, 0x91, 0x76, 0x08, 0x0D, 0xDB, 0x8F, 0x3D, 0xB6, 0x60,
+	0xBC, 0x8D, 0xB6, 0x34, 0x83, 0x5E, 0x4E, 0x66, 0x9A, 0x73, 0x70, 0x3A, 0x1C, 0x6C, 0xF1, 0x07,
+	0x98, 0x9E, 0xF6, 0x64, 0x8C, 0x78, 0xD8, 0x70, 0xC6, 0x3E, 0xF7, 0x98, 0x25, 0x86, 0x31, 0xE2,
+	0x53, 0x64, 0x4F, 0x2C, 0xBE, 0x70, 0xAB, 0x17, 0xCC, 0x69, 0xB4, 0xE7, 0x06, 0x16, 0x4C, 0x33,
+	0xAD, 0x61, 0xA3, 0xBD, 0xCD, 0xA0, 0x39, 0xF3, 0xC4, 0x3C, 0x9B, 0x6A, 0x47, 0x66, 0x5C, 0x2E,
+	0x29, 0x58, 0xD6, 0x72, 0xAE, 0x3C, 0xF2, 0x3A, 0xFA, 0xD1, 0x65, 0xA4, 0x64, 0x36, 0x66, 0xAB,
+	0xFC, 0x3B, 0x1C, 0x05, 0xC3, 0xE7, 0x62, 0x63, 0x59, 0x2C, 0xF3, 0x26, 0x98, 0xB6, 0x92, 0xB8,
+	0xDC, 0x21, 0x59, 0x2B, 0xAF, 0xE0, 0x5D, 0x9A, 0x9E, 0x6B, 0x01, 0x07, 0x6C, 0x4D, 0x0E, 0x48,
+	0x7C, 0xB7, 0x8A, 0xBA, 0x2F, 0x99, 0xCB, 0x48, 0xF7, 0x58, 0x87, 0x6A, 0xB7, 0x92, 0x2B, 0x54,
+	0x81, 0x7E, 0xCB, 0x3C, 0x30, 0x19, 0x80, 0x6D, 0xCA, 0xEC, 0x54, 0x11, 0xE6, 0x35, 0x36, 0x2F,
+	0xAC, 0xE9, 0xE4, 0xC4, 0xCB, 0x88, 0x51, 0x9B, 0xB6, 0x4C, 0x39, 0xDA, 0x46, 0xE8, 0xF1, 0xE7,
+	0x61, 0xA9, 0xD3, 0x2C, 0x6D, 0x98, 0x9F, 0x2E, 0x4C, 0x94, 0xC6, 0xC3, 0xC9, 0x69, 0x22, 0x07,
+	0xEC, 0xB7, 0x98, 0x64, 0xA5, 0xD0, 0x6F, 0x0E, 0xA5, 0xF9, 0x9A, 0x6D, 0xE6, 0x81, 0x44, 0xB1,
+	0xE8, 0x52, 0xEB, 0xFB, 0x66, 0x18, 0x71, 0x27, 0xA7, 0xAE, 0xF4, 0xC9, 0x94, 0x98, 0x9C, 0x7D,
+	0x72, 0x18, 0xEE, 0x8E, 0x45, 0x39, 0x39, 0xAB, 0xCC, 0x49, 0xBD, 0x9A, 0xD8, 0x45, 0x6B, 0x8E,
+	0xC5, 0xC3, 0x19, 0xB3, 0xE2, 0x76, 0x1F, 0x69, 0x81, 0x8B, 0x76, 0x61, 0x0F, 0x1F, 0x30, 0xDC,
+	0x26, 0x70, 0x19, 0x6B, 0x8E, 0x76, 0xC6, 0xB2, 0xFE, 0x04, 0xD8, 0xC7, 0xE1, 0x19, 0x60, 0x15,
+	0xA7, 0x22, 0xD9, 0xCA, 0xEE, 0xAD, 0xC6, 0xCB, 0xB4, 0xD9, 0x8B, 0x58, 0x72, 0x33, 0x18, 0xDB,
+	0x82, 0x29, 0xCB, 0x72, 0xD8, 0x11, 0x91, 0xF8, 0xE2, 0x56, 0xC6, 0xC6, 0x8C, 0x77, 0x23, 0xB8,
+	0x74, 0x90, 0x5D, 0x8E, 0x0F, 0x69, 0x19, 0xEB, 0xF7, 0x23, 0x18, 0x36, 0x40, 0x11, 0x70, 0xAD,
+	0xBB, 0x1C, 0x32, 0xF3, 0x42, 0x1E, 0x70, 0x8F, 0x8E, 0x17, 0xC0, 0x74, 0x60, 0x67, 0xC8, 0x17,
+	0xCC, 0xCA, 0x61, 0x31, 0x4A, 0xB8, 0x21, 0x36, 0xEB, 0x48, 0x13, 0x38, 0x88, 0x9D, 0x2D, 0xCC,
+	0x33, 0x6C, 0x8A, 0x1C, 0x45, 0x34, 0xB3, 0xB9, 0xE0, 0x49, 0x39, 0x9E, 0x75, 0x8C, 0x72, 0x00,
+	0xAD, 0xBE, 0xB1, 0xB3, 0x11, 0x1C, 0x47, 0xCA, 0xE4, 0xDC, 0x2B, 0x05, 0x69, 0x2D, 0x5D, 0xA3,
+	0xAB, 0xCB, 0x1D, 0xA4, 0x61, 0x33, 0x22, 0x22, 0x9D, 0x39, 0x98, 0xB7, 0x3B, 0x65, 0xA8, 0x9F,
+	0x67, 0xA0, 0x5B, 0x4C, 0xB6, 0xC6, 0x19, 0x23, 0x4B, 0x9D, 0x9F, 0xD8, 0x32, 0x99, 0xBD, 0x0C,
+	0x32, 0x95, 0x92, 0xBF, 0x9A, 0x81, 0x7B, 0x66, 0xD8, 0x0D, 0x36, 0xDB, 0x1B, 0x29, 0xF0, 0x91,
+	0x25, 0x96, 0x8E, 0xE0, 0xAF, 0xAF, 0xC1, 0x64, 0xB5, 0x88, 0x79, 0xAB, 0xAD, 0xE3, 0x88, 0x74,
+	0x35, 0x8A, 0xE0, 0xDB, 0x3C, 0x96, 0xC1, 0x20, 0x53, 0xC6, 0x27, 0xE1, 0x0B, 0xE1, 0x7A, 0x5A,
+	0xAD, 0xD2, 0xA2, 0xFF, 0x4C, 0x84, 0x06, 0xD1, 0x68, 0xAE, 0xFA, 0xB1, 0x12, 0xDB, 0x63, 0xC0,
+	0xAD, 0x21, 0x59, 0x3C, 0x33, 0x36, 0x8B, 0x58, 0xDC, 0x02, 0x2B, 0xAD, 0xBC, 0xA0, 0xD6, 0x48,
+	0x52, 0xEF, 0x1F, 0x4E, 0x69, 0x86, 0x66, 0x9E, 0xBE, 0x04, 0x1D, 0xC1, 0xAD, 0x4F, 0x18, 0xE6,
+	0x9E, 0x72, 0x87, 0x44, 0x96, 0xBA, 0x8B, 0xAB, 0xB7, 0xA5, 0x85, 0xAB, 0x45, 0xE6, 0xD3, 0x2D,
+	0x89, 0xA5, 0xCB, 0xB8, 0xE4, 0x76, 0x41, 0x8B, 0x67, 0x9E, 0x22, 0xDE, 0x04, 0xB1, 0x72, 0x28,
+	0x8A, 0xD3, 0xA0, 0x6D, 0x24, 0x5C, 0x3C, 0xAB, 0x4B, 0x38, 0xB7, 0x19, 0x82, 0x07, 0x85, 0xDA,
+	0x3C, 0x4E, 0x64, 0xE7, 0xAD, 0x06, 0x20, 0xAD, 0xCE, 0xB7, 0x25, 0x82, 0x6F, 0x8D, 0x81, 0x2D,
+	0xB2, 0x11, 0x41, 0x5E, 0x8E, 0x22, 0xB9, 0xF2, 0xE1, 0x4C, 0x49, 0xF7, 0x0A, 0x5D, 0xB0, 0x82,
+	0x22, 0x1B, 0xE7, 0x94, 0x89, 0xF2, 0xF4, 0xC1, 0x3D, 0xA9, 0x93, 0x21, 0xC6, 0x16, 0x73, 0xCE,
+	0x9E, 0x61, 0x24, 0xAB, 0x59, 0x3C, 0x00, 0x7C, 0xE6, 0x2C, 0x7A, 0xCA, 0x10, 0x5D, 0xB6, 0x27,
+	0x12, 0xC8, 0xA2, 0x22, 0xDB, 0x28, 0xAD, 0xF0, 0x38, 0x4D, 0x9D, 0x23, 0x53, 0x39, 0x9A, 0xC3,
+	0x88, 0xAC, 0x4A, 0xBB, 0xCD, 0x9D, 0x86, 0x64, 0xAB, 0x87, 0xCB, 0x6E, 0x60, 0x84, 0x12, 0xB7,
+	0x10, 0x8A, 0xEB, 0xCB, 0xB1, 0x94, 0xA2, 0xB4, 0x87, 0x3D, 0x32, 0x43, 0x9D, 0x37, 0x28, 0x07,
+	0x6C, 0xE3, 0x32, 0x1C, 0x85, 0x34, 0xAF, 0x5B, 0x60, 0x81, 0xED, 0x8B, 0x4D, 0x88, 0xBC, 0x7D,
+	0x8A, 0x69, 0xE2, 0x04, 0x5A, 0x2F, 0xC7, 0x31, 0x0B, 0xC3, 0x16, 0x1E, 0xAE, 0x58, 0x42, 0xBA,
+	0xDC, 0xB9, 0x34, 0x33, 0x16, 0x87, 0x93, 0x63, 0x9C, 0xAF, 0x70, 0xB4, 0x91, 0xC3, 0x16, 0x3C,
+	0xC9, 0x25, 0xC9, 0xC3, 0xBB, 0x4B, 0xBB, 0x41, 0x1C, 0xAE, 0x2B, 0x71, 0x92, 0x1E, 0x6A, 0x22,
+	0xD6, 0x30, 0xEB, 0x53, 0x07, 0x21, 0xDE, 0x33, 0x0E, 0x3A, 0x11, 0x34, 0xA1, 0x06, 0xF8, 0xB0,
+	0x76, 0x1C, 0x2E, 0x27, 0xC6, 0x36, 0xD8, 0xC3, 0x18, 0xAD, 0x60, 0xB6, 0xC8, 0x4D, 0xE0, 0xAD,
+	0xE7, 0x69, 0x8C, 0x91, 0x1C, 0xAE, 0x20, 0x76, 0x1D, 0xA6, 0xAB, 0xAD, 0xE4, 0xCC, 0xD8, 0x88,
+	0x84, 0xDE, 0x48, 0x12, 0x21, 0xC7, 0x2F, 0xB4, 0xC8, 0x1B, 0x80, 0x44, 0x72, 0xB7, 0x28, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0xB6, 0x78, 0x90, 0x1C, 0x86, 0xE5, 0xE0, 0x84, 0xEB, 0x87, 0x18, 0x1E,
+	0x2D, 0x8E, 0x6C, 0x71, 0x8A, 0xC4, 0x88, 0x4C, 0x5E, 0x5C, 0x2E, 0xA9, 0xCE, 0xB7, 0x19, 0xC6,
+	0x69, 0x83, 0xD9, 0x32, 0xBF, 0x9A, 0x48, 0x84, 0x2A, 0xC4, 0x83, 0x64, 0x84, 0xF3, 0xB9, 0x3C,
+	0x0A, 0x22, 0xB4, 0x49, 0x02, 0x07, 0x88, 0xAC, 0x78, 0x88, 0x71, 0xE3, 0x62, 0xD2, 0x1C, 0x7C,
+	0xC1, 0xAD, 0x0E, 0x9C, 0x4C, 0xC1, 0x21, 0x2B, 0x72, 0xD3, 0x25, 0x3B, 0x22, 0x2E, 0x81, 0xC6,
+	0xD8, 0x1C, 0xA2, 0x22, 0x04, 0xBB, 0x64, 0x3C, 0x63, 0x78, 0xE2, 0x23, 0x67, 0x24, 0x4B, 0x6D,
+	0xAB, 0x5E, 0x24, 0x8A, 0xF4, 0x3B, 0x6D, 0x00, 0xB6, 0x07, 0x3C, 0xB8, 0x35, 0xD8, 0x2B, 0x71,
+	0x32, 0x1F, 0xAB, 0x90, 0xD8, 0x48, 0x1E, 0x39, 0xB1, 0xC6, 0x33, 0x41, 0x28, 0xB4, 0xF7, 0x9A,
+	0x92, 0x48, 0x88, 0x71, 0xC8, 0x76, 0x38, 0xA7, 0x72, 0x64, 0x9E, 0x8A, 0xBA, 0xD2, 0xB4, 0x81,
+	0x20, 0x78, 0x88, 0x87, 0x20, 0x79, 0x37, 0xDA, 0x18, 0xAD, 0x22, 0x20, 0x70, 0xDA, 0x76, 0x98,
+	0x2B, 0x88, 0x78, 0xE8, 0xB9, 0xF6, 0x25, 0xD8, 0x24, 0x81, 0xBD, 0xBA, 0xD3, 0x18, 0x82, 0xB7,
+	0x4C, 0x9A, 0x63, 0x81, 0xD8, 0x72, 0x2E, 0x88, 0x8A, 0xF6, 0xC0, 0x04, 0x88, 0x87, 0x6A, 0xD1,
+	0xB6, 0xAB, 0x6C, 0xAB, 0x81, 0x11, 0x5B, 0x2B, 0x1B, 0x76, 0x9C, 0x8B, 0x90, 0x81, 0xDC, 0xA6,
+	0x22, 0xB8, 0x7D, 0xC2, 0x04, 0x22, 0x22, 0x22, 0x04, 0xAD, 0x2B, 0xAB, 0x48, 0x88, 0x88, 0x8B,
+	0x78, 0x13, 0x60, 0x78, 0x2A, 0xD2, 0xB1, 0x22, 0x22, 0x2A, 0xD7, 0x68, 0x84, 0x22, 0xE8, 0x8A,
+	0xD2, 0xDB, 0x1A, 0xD2, 0xB4, 0x88, 0x88, 0x8A, 0xD2, 0xBB, 0x59, 0x2D, 0x8E, 0xB7, 0x98, 0x1D,
+	0x31, 0xA7, 0x27, 0x02, 0xB8, 0xAE, 0x1C, 0x70, 0x21, 0xCA, 0xDB, 0x66, 0x66, 0xD8, 0xBA, 0xD2,
+	0x07, 0x28, 0x8B, 0xA0, 0x76, 0x38, 0x1D, 0x96, 0x87, 0x2C, 0xC8, 0x8A, 0xBD, 0x8E, 0x48, 0x4D,
+	0x81, 0x0A, 0xB8, 0x2B, 0x52, 0x8D, 0xC8, 0xED, 0xB7, 0x0C, 0x30, 0x74, 0xC8, 0xAD, 0x20, 0x78,
+	0x88, 0x88, 0x88, 0x8B, 0x78, 0xD8, 0x49, 0x61, 0xC1, 0xDE, 0x28, 0x88, 0x8A, 0xD2, 0xB9, 0xD2,
+	0x80, 0x6E, 0x22, 0x22, 0xE8, 0x88, 0x76, 0x02, 0x07, 0x72, 0x22, 0x22, 0x2D, 0xB4, 0x9C, 0x92,
+	0x22, 0xBD, 0xB2, 0x12, 0x1D, 0xA8, 0x88, 0x88, 0x88, 0xB6, 0xE3, 0xAB, 0x50, 0x07, 0x4A, 0xAE,
+	0x0A, 0xD2, 0xAD, 0x1C, 0xA2, 0x22, 0x22, 0x22, 0x1C, 0x88, 0xAD, 0x22, 0x22, 0xB9, 0x6E, 0x4D,
+	0x81, 0xD8, 0xC9, 0xB2, 0xB8, 0x71, 0x88, 0xB7, 0x31, 0xA4, 0xA2, 0x22, 0x22, 0xE4, 0x22, 0xE7,
+	0x4E, 0x46, 0xD8, 0x8B, 0x86, 0xCF, 0x4A, 0x2E, 0x88, 0x11, 0x08, 0x8B, 0x78, 0x97, 0x2B, 0xA2,
+	0x22, 0x22, 0x10, 0x88, 0x88, 0x12, 0xDB, 0x82, 0xAD, 0x2B, 0x70, 0x2C, 0x4A, 0x07, 0x60, 0x1E,
+	0x2E, 0x8A, 0xE1, 0x3A, 0x07, 0x69, 0x28, 0x4E, 0x81, 0x2E, 0x8A, 0xDC, 0x8F
 };
 
+/* 2-bit ADPCM, SNR 16.2 dB */
 const u8 sfx_elevator_stp[] __attribute__((aligned(4))) = {
-	0x49, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78,
-	0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x77, 0x87, 0x88, 0x98, 0x98, 0x87, 0x68, 0x88, 0x97, 0xA8,
-	0x98, 0x89, 0x88, 0x98, 0x88, 0x99, 0x88, 0x98, 0x88, 0x88, 0x98, 0x88, 0x88, 0x98, 0x87, 0x77,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x68, 0x78, 0x88, 0x98, 0x88, 0x8A, 0x88, 0x97, 0x98, 0x87, 0x88,
-	0x86, 0x77, 0x76, 0x77, 0x87, 0x78, 0x89, 0x78, 0x87, 0x77, 0x88, 0x78, 0x98, 0x89, 0x99, 0x89,
-	0x98, 0x88, 0x88, 0x88, 0x89, 0x88, 0x89, 0x98, 0x98, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x98,
-	0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x98, 0x89, 0x89, 0x99, 0xA8, 0xA8, 0x89, 0x99,
-	0x87, 0x77, 0x77, 0x67, 0x78, 0x87, 0x88, 0x87, 0x77, 0x88, 0x98, 0x99, 0x99, 0x88, 0x88, 0x78,
-	0x78, 0x78, 0x88, 0x77, 0x77, 0x77, 0x78, 0x89, 0x98, 0x98, 0x98, 0x88, 0x77, 0x77, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x87, 0x88, 0x99, 0x99, 0x98, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x66, 0x77, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x88,
-	0x88, 0x78, 0x88, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x78, 0x89, 0x99, 0x99, 0x88, 0x88, 0x88,
-	0x99, 0x99, 0x98, 0x88, 0x77, 0x77, 0x88, 0x89, 0x99, 0x99, 0x88, 0x77, 0x88, 0x77, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x87, 0x76, 0x65,
-	0x55, 0x66, 0x67, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0xAA, 0x99, 0x89, 0x87, 0x88, 0x88,
-	0x99, 0x9A, 0x87, 0x89, 0x87, 0x88, 0x88, 0x98, 0x89, 0x88, 0x99, 0x9A, 0xA9, 0xAA, 0x99, 0x98,
-	0x99, 0x89, 0x99, 0x98, 0x88, 0x88, 0x77, 0x86, 0x76, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77,
-	0x76, 0x77, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x9A, 0xA9, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x87, 0x78, 0x88, 0x89, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0x99,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66,
-	0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x89, 0x98, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x67, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x77, 0x66, 0x66, 0x66, 0x77, 0x77, 0x78, 0x88, 0x99, 0x9A, 0xA9, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88,
-	0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x87, 0x78, 0x87, 0x77, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x87,
-	0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
-	0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x76, 0x66, 0x66, 0x67, 0x77, 0x77, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88,
-	0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x77, 0x77, 0x77, 0x77, 0x66
+	0xD0, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x07,
+	0x82, 0x22, 0x22, 0x2B, 0x88, 0x12, 0x22, 0xAC, 0x48, 0xB6, 0x22, 0x20, 0x4B, 0xA2, 0x22, 0x1D,
+	0x8C, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 0x21, 0x08, 0x88, 0x12, 0xAE, 0x08, 0x88, 0x88, 0x88,
+	0xAB, 0x81, 0x08, 0x88, 0x42, 0x22, 0xAE, 0x08, 0x88, 0xAB, 0x82, 0x22, 0x04, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x2A, 0xE0, 0x88, 0x8A, 0xE1,
+	0x36, 0x22, 0xB7, 0x27, 0x66, 0x3A, 0xD2, 0x76, 0x31, 0xC3, 0x24, 0xE7, 0x29, 0x78, 0x07, 0xB2,
+	0x41, 0xC8, 0xBD, 0x98, 0x72, 0x5E, 0x76, 0xA6, 0xB0, 0xB4, 0x70, 0x1C, 0xB8, 0x6D, 0x69, 0x2D,
+	0xB2, 0x22, 0x1C, 0x93, 0x78, 0x22, 0xB1, 0x97, 0x80, 0x6E, 0x08, 0xA7, 0x60, 0xD3, 0x76, 0x82,
+	0xFA, 0xAD, 0x1A, 0x4B, 0x84, 0x74, 0xAE, 0xAD, 0xC9, 0x2E, 0x88, 0x11, 0x37, 0x2A, 0xE0, 0x48,
+	0xAB, 0x97, 0x04, 0x2B, 0x62, 0xE4, 0x0A, 0xB8, 0x20, 0x48, 0xAE, 0x22, 0x22, 0x2B, 0x84, 0x22,
+	0x22, 0xBA, 0xE5, 0x62, 0x2E, 0x88, 0x50, 0x2E, 0xAD, 0x24, 0x0A, 0xEB, 0x81, 0x10, 0xAE, 0x20,
+	0x4A, 0xB3, 0xC8, 0x41, 0x22, 0xFC, 0x6C, 0x60, 0x88, 0xAE, 0x04, 0x88, 0x42, 0x22, 0xBB, 0xF3,
+	0x84, 0x11, 0xD2, 0x82, 0x21, 0x4E, 0xDE, 0x60, 0x62, 0xF1, 0xE6, 0x07, 0x1E, 0x41, 0xB6, 0xAB,
+	0x6D, 0x2B, 0xA2, 0xF7, 0x28, 0xA2, 0x21, 0x08, 0xB4, 0x90, 0x8B, 0xA2, 0x10, 0x84, 0x13, 0xA2,
+	0x22, 0x22, 0x2E, 0xB9, 0x01, 0x20, 0x48, 0xAE, 0xB8, 0x88, 0xAC, 0x4A, 0x2E, 0x88, 0xAE, 0x22,
+	0x22, 0x22, 0x10, 0x88, 0x81, 0x21, 0x36, 0x08, 0x88, 0x88, 0x81, 0x22, 0x2A, 0xE2, 0xB8, 0x22,
+	0x22, 0xAE, 0x08, 0xAE, 0x21, 0x04, 0x22, 0x2B, 0x8A, 0xE2, 0x04, 0x81, 0x94, 0x93, 0xA2, 0x22,
+	0x2E, 0x88, 0x88, 0x42, 0xE8, 0x88, 0xAE, 0x04, 0x88, 0x12, 0x22, 0x22, 0xE8, 0xB9, 0x3A, 0x22,
+	0x04, 0x88, 0x84, 0x22, 0x22, 0x22, 0x2E, 0x8B, 0xE8, 0x88, 0x88, 0x44, 0x08, 0x88, 0x88, 0xAE,
+	0x22, 0x20, 0x48, 0x12, 0x22, 0x22, 0x10, 0xAE, 0x22, 0x22, 0xAE, 0x0A, 0xE4, 0x08, 0x8A, 0xB8,
+	0x22, 0x22, 0x10, 0x88, 0xAE, 0x22, 0x22, 0x22, 0x22, 0x20, 0x48, 0x84, 0x22, 0x22, 0x22, 0x20,
+	0x48, 0xAB, 0x82, 0x22, 0xB8, 0xAE, 0x22, 0x22, 0x04, 0x88, 0x88, 0x8A, 0xB8, 0x22, 0x22, 0x2A,
+	0xE0, 0x88, 0x42, 0x22, 0x04, 0x88, 0x42, 0x22, 0x22, 0x22, 0x22, 0xAE, 0x08, 0x88, 0x88, 0x12,
+	0x22, 0x22, 0x22, 0x2A, 0xE0, 0xAE, 0x22, 0x22, 0x22, 0x20, 0x48, 0x88, 0x88, 0x88, 0x88, 0x42,
+	0x22, 0xB8, 0x8A, 0xE2, 0xB8, 0x81, 0x20, 0x48, 0x81, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0xE0,
+	0x88, 0xAD, 0xC0, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x60, 0x8A, 0xE2, 0x22, 0x22, 0x20, 0x48, 0x84,
+	0x22, 0x22, 0x22, 0xB8, 0x88, 0xAE, 0x20, 0x48, 0x12, 0x22, 0x2A, 0xE0, 0x88, 0x42, 0x22, 0xAE,
+	0x2E, 0x22, 0xAE
 };
 
+/* 2-bit ADPCM, SNR 21.0 dB */
 const u8 sfx_stone_move[] __attribute__((aligned(4))) = {
-	0x69, 0x99, 0x99, 0x9A, 0xAA, 0x9A, 0x99, 0x99, 0x98, 0x88, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88,
-	0x88, 0x89, 0x88, 0x77, 0x78, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88,
-	0x88, 0x99, 0x99, 0x88, 0x98, 0x88, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x88, 0x89, 0x89, 0x99,
-	0x9A, 0xAA, 0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x89, 0x98, 0x88, 0x88, 0x77, 0x88,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x67, 0x78, 0x88, 0x87, 0x78, 0x76, 0x77, 0x88,
-	0x88, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x77, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x98, 0x88, 0x99, 0x99, 0x9A, 0x99, 0x88, 0x88, 0x88, 0x99, 0x99, 0x9A, 0x99,
-	0x98, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x98, 0x99,
-	0x99, 0x88, 0x99, 0x88, 0x89, 0x98, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x99, 0x89, 0x99, 0x99, 0x99, 0x98, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88, 0x87, 0x78, 0x87,
-	0x77, 0x77, 0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x76, 0x66, 0x67, 0x77,
-	0x77, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x78, 0x99, 0x88, 0x89, 0x88, 0x98, 0x88, 0x87,
-	0x78, 0x88, 0x87, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0xA9, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x88, 0x87, 0x77,
-	0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x87, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x89, 0x99,
-	0xAA, 0xAA, 0x99, 0x89, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88,
-	0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77,
-	0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0xAA, 0x99, 0x99, 0x98, 0x88, 0x87, 0x78, 0x88,
-	0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x67, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x9A, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x99, 0x87, 0x78, 0x88, 0x87, 0x77,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x66, 0x66, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
-	0x77, 0x88, 0x88, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x67, 0x77, 0x88,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x89, 0x98, 0x89, 0x99, 0x88, 0x77, 0x78, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
-	0x98, 0x99, 0x98, 0x88, 0x87, 0x88, 0x89, 0x88, 0x99, 0x99, 0x99, 0x88, 0x99, 0x89, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x87, 0x87,
-	0x88, 0x87, 0x77, 0x77, 0x76, 0x66, 0x66, 0x67, 0x77, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88,
-	0x88, 0x77, 0x88, 0x77, 0x89, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x87, 0x88, 0x77, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0x9A, 0xAA, 0xA9,
-	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA9, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x77, 0x77, 0x78, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x66, 0x77, 0x88, 0x88, 0x88, 0x87,
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-	0x77, 0x87, 0x77, 0x77, 0x78, 0x87, 0x76, 0x66, 0x66
+	0xD4, 0x81, 0x2D, 0xE0, 0xF2, 0x04, 0x8B, 0xA2, 0x21, 0xEC, 0x12, 0x81, 0x2E, 0x88, 0xBA, 0x10,
+	0x84, 0x2E, 0x72, 0xEA, 0xD2, 0x20, 0x65, 0xC0, 0x12, 0xE8, 0x8B, 0x90, 0x8A, 0xD3, 0xA2, 0xE4,
+	0xD8, 0x22, 0x22, 0x2B, 0xC1, 0x0B, 0x9F, 0x66, 0x07, 0x82, 0x2E, 0x88, 0x42, 0x2E, 0x81, 0x22,
+	0x21, 0x0B, 0x84, 0x81, 0xEE, 0x08, 0x42, 0x1E, 0x35, 0x82, 0x2A, 0xE5, 0x88, 0xAE, 0x22, 0xB4,
+	0xAC, 0x6E, 0x13, 0xA2, 0xD8, 0x88, 0x88, 0x88, 0x84, 0xD8, 0x22, 0xBB, 0xA2, 0x20, 0x4F, 0x1B,
+	0x20, 0x4B, 0x62, 0xD8, 0xE8, 0x8A, 0xB8, 0x10, 0xAE, 0x20, 0x48, 0x88, 0x14, 0xE1, 0xC7, 0x8B,
+	0x12, 0xB8, 0x8A, 0xC4, 0xA0, 0x48, 0x12, 0x22, 0x22, 0x20, 0x78, 0xB8, 0x8A, 0xE2, 0x04, 0xF0,
+	0x79, 0x0A, 0x22, 0x21, 0xD2, 0xE2, 0x88, 0x88, 0xAD, 0x22, 0x22, 0x22, 0x21, 0x3A, 0x2B, 0x88,
+	0x87, 0x6A, 0x22, 0x22, 0x22, 0x20, 0x48, 0x10, 0x4A, 0xED, 0x8A, 0xD2, 0x22, 0x22, 0x22, 0xB8,
+	0x8B, 0x84, 0x88, 0x8B, 0xA1, 0x08, 0x8A, 0xE2, 0x04, 0xAD, 0x22, 0x20, 0x4A, 0xE2, 0x22, 0x22,
+	0xE4, 0x22, 0x21, 0x08, 0x4E, 0x8B, 0xAB, 0x12, 0xB6, 0x08, 0xAB, 0x96, 0x22, 0x7C, 0x88, 0x88,
+	0x87, 0x24, 0x08, 0x88, 0x88, 0x81, 0x21, 0xCA, 0x22, 0x22, 0x22, 0x22, 0xB8, 0x5F, 0x08, 0xB8,
+	0x12, 0x22, 0x2B, 0xAE, 0x04, 0x84, 0x22, 0x22, 0x2B, 0x88, 0x8A, 0xB4, 0x84, 0x22, 0x22, 0xB8,
+	0x84, 0x2D, 0x82, 0xB8, 0x88, 0x8A, 0xB1, 0x04, 0x81, 0xE2, 0x04, 0xAE, 0x13, 0x92, 0xEE, 0x12,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x04, 0x88, 0xB6, 0x3A, 0xB4, 0x9C, 0x48, 0xAE, 0x4D, 0xCA,
+	0x22, 0x06, 0xE0, 0x88, 0x4A, 0xC6, 0xE0, 0x88, 0x88, 0x88, 0xAB, 0x82, 0x22, 0x22, 0x12, 0xB7,
+	0x63, 0x82, 0xB8, 0x81, 0x94, 0xA2, 0xD8, 0x22, 0xAC, 0x6C, 0x5A, 0x8B, 0x60, 0x88, 0x88, 0x8A,
+	0xB4, 0xE4, 0x48, 0x88, 0x88, 0x12, 0x2D, 0x8B, 0xA2, 0x22, 0x20, 0x78, 0x2B, 0x88, 0xAB, 0x4A,
+	0xE2, 0x10, 0x8B, 0xA2, 0x22, 0xE5, 0x02, 0x2B, 0x12, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B,
+	0x60, 0x8A, 0xB8, 0x21, 0x08, 0x88, 0x88, 0xAB, 0x97, 0x82, 0x13, 0xF2, 0x20
 };
 
+/* 3-bit ADPCM, SNR 12.1 dB */
 const u8 sfx_teleport[] __attribute__((aligned(4))) = {
-	0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x89,
-	0x88, 0x88, 0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88,
-	0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89,
-	0x78, 0x88, 0x98, 0x87, 0x99, 0x78, 0x99, 0x87, 0x88, 0x78, 0x88, 0x88, 0x98, 0x89, 0x98, 0x78,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88,
-	0x78, 0x78, 0x98, 0x88, 0x89, 0x87, 0x87, 0x88, 0x88, 0x98, 0x78, 0x88, 0x89, 0x79, 0x97, 0x87,
-	0x88, 0x88, 0x98, 0x78, 0x78, 0x89, 0x78, 0x98, 0x87, 0x88, 0x88, 0x98, 0x78, 0x88, 0x89, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x98, 0x87, 0x88, 0x87, 0x88, 0x98, 0x78, 0x99, 0x88, 0x77, 0x88, 0x87,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x98, 0x88, 0x78, 0x88, 0x78, 0x89, 0x88,
-	0x88, 0x88, 0x87, 0x88, 0x89, 0x88, 0x89, 0x88, 0x88, 0x98, 0x88, 0x78, 0x88, 0x88, 0x88, 0x89,
-	0x89, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x78, 0x88, 0x98, 0x88, 0x78, 0x79, 0x88, 0x88,
-	0x87, 0x87, 0x88, 0x99, 0x88, 0x77, 0x88, 0x98, 0x88, 0x98, 0x87, 0x87, 0x78, 0x88, 0x99, 0x78,
-	0x87, 0x88, 0x8A, 0x98, 0x88, 0x89, 0x87, 0x87, 0x89, 0x88, 0x98, 0x78, 0x78, 0x87, 0x88, 0x89,
-	0x88, 0x98, 0x88, 0x89, 0x87, 0x87, 0x99, 0x89, 0x88, 0x78, 0x99, 0x77, 0x78, 0x88, 0x97, 0x89,
-	0x98, 0x79, 0x88, 0x87, 0x89, 0x87, 0x89, 0x89, 0x87, 0x89, 0x88, 0x88, 0x89, 0x88, 0x89, 0x88,
-	0x88, 0x99, 0x77, 0x78, 0x98, 0x79, 0x87, 0x88, 0x89, 0x77, 0x78, 0x98, 0x89, 0x86, 0x88, 0x98,
-	0x9A, 0x88, 0x77, 0x77, 0x87, 0x78, 0x9A, 0x88, 0x87, 0x99, 0x97, 0x88, 0x68, 0x89, 0x89, 0x98,
-	0x87, 0x78, 0x78, 0x78, 0x89, 0x98, 0x96, 0x79, 0x98, 0x87, 0x98, 0x78, 0x88, 0x87, 0x89, 0x87,
-	0x88, 0x88, 0x89, 0x87, 0x89, 0x89, 0x79, 0x87, 0x78, 0x89, 0x87, 0x98, 0x78, 0x98, 0x87, 0x89,
-	0x78, 0x98, 0x89, 0x88, 0x88, 0x89, 0x96, 0x77, 0x77, 0xA8, 0x88, 0x98, 0x87, 0x88, 0x98, 0x77,
-	0x77, 0x89, 0x87, 0x99, 0x88, 0x88, 0x89, 0x87, 0x88, 0x78, 0x88, 0x98, 0x78, 0x88, 0x99, 0x77,
-	0x78, 0x98, 0x98, 0x88, 0x97, 0x79, 0x89, 0x88, 0x87, 0x77, 0x98, 0x98, 0x89, 0x87, 0x79, 0x88,
-	0x77, 0x98, 0x78, 0x98, 0x98, 0x89, 0x87, 0x79, 0x79, 0x89, 0x8A, 0x86, 0x78, 0x87, 0x79, 0x78,
-	0x99, 0x97, 0x88, 0x89, 0x98, 0x87, 0x98, 0x78, 0x89, 0x89, 0x96, 0x88, 0x89, 0x79, 0x87, 0x99,
-	0x97, 0x78, 0x7A, 0x88, 0x97, 0x89, 0x88, 0x88, 0x87, 0x99, 0x98, 0x78, 0x67, 0x87, 0x87, 0x89,
-	0x89, 0x89, 0x79, 0xA7, 0x88, 0x87, 0x89, 0x88, 0x99, 0x99, 0x77, 0x56, 0x87, 0x78, 0x89, 0x99,
-	0x79, 0x98, 0x88, 0x88, 0x98, 0x98, 0x77, 0x88, 0x79, 0x99, 0x87, 0x99, 0x88, 0x88, 0x88, 0x78,
-	0x98, 0x98, 0x87, 0x67, 0x88, 0x98, 0x98, 0x78, 0x98, 0x98, 0x97, 0x78, 0x98, 0x98, 0x87, 0x79,
-	0x87, 0x99, 0xA7, 0x68, 0x99, 0x99, 0x77, 0x88, 0x99, 0x95, 0x77, 0x77, 0x86, 0x79, 0xA9, 0x97,
-	0x69, 0x99, 0x89, 0x78, 0x89, 0x99, 0x86, 0x77, 0x77, 0x86, 0x89, 0xA9, 0x87, 0x69, 0xAA, 0x87,
-	0x88, 0x98, 0x87, 0x86, 0x67, 0x98, 0x78, 0xA8, 0x78, 0x99, 0x99, 0x78, 0x67, 0x8A, 0x88, 0x89,
-	0x88, 0x78, 0x89, 0x97, 0x77, 0x88, 0x98, 0x98, 0x89, 0x88, 0x98, 0x67, 0x88, 0x99, 0xA8, 0x76,
-	0x77, 0xAA, 0xA8, 0x88, 0x89, 0x89, 0x97, 0x8A, 0x77, 0x78, 0x75, 0x77, 0x89, 0xAB, 0x87, 0x77,
-	0x89, 0xB8, 0x79, 0x87, 0x97, 0x99, 0x77, 0x67, 0x98, 0x88, 0x89, 0x87, 0x77, 0x97, 0x88, 0x88,
-	0x97, 0x77, 0x88, 0x89, 0x89, 0x96, 0x78, 0x98, 0x99, 0x89, 0x86, 0x88, 0x98, 0x98, 0x89, 0x76,
-	0x77, 0x88, 0x89, 0x98, 0xA8, 0x89, 0x77, 0x79, 0x97, 0x89, 0x99, 0x88, 0x97, 0x67, 0x88, 0x98,
-	0x79, 0x99, 0x88, 0x97, 0x67, 0x78, 0x98, 0x89, 0x89, 0x88, 0x76, 0x87, 0x88, 0x67, 0x7A, 0xAA,
-	0x96, 0x77, 0xAA, 0xA9, 0x78, 0x89, 0x99, 0x87, 0x77, 0x78, 0x78, 0x77, 0x88, 0x99, 0x98, 0x77,
-	0x88, 0x99, 0x99, 0x67, 0x88, 0x89, 0x89, 0x67, 0x88, 0x8A, 0x9A, 0x77, 0x78, 0x79, 0x88, 0x67,
-	0x67, 0x88, 0x78, 0xAA, 0xA9, 0x75, 0x7A, 0xA9, 0x99, 0x79, 0x99, 0x99, 0x84, 0x66, 0x77, 0x87,
-	0x77, 0x9B, 0xA8, 0x67, 0x89, 0xAA, 0x86, 0x8A, 0xA8, 0x79, 0x76, 0x78, 0x78, 0x97, 0x89, 0x89,
-	0x98, 0x98, 0x66, 0x77, 0x99, 0x87, 0x89, 0xA9, 0x88, 0x97, 0x67, 0x67, 0x89, 0x88, 0x89, 0x89,
-	0x98, 0x76, 0x98, 0x89, 0x99, 0x97, 0x68, 0x78, 0x99, 0x99, 0x86, 0x88, 0x89, 0x99, 0x66, 0x88,
-	0x88, 0xA9, 0x97, 0x68, 0x87, 0x8A, 0x99, 0x77, 0x88, 0x8A, 0x98, 0x78, 0x88, 0x99, 0x85, 0x68,
-	0x78, 0x99, 0x87, 0x7A, 0x99, 0x98, 0x76, 0x88, 0x89, 0xA9, 0x76, 0x98, 0x89, 0x99, 0x66, 0x77,
-	0x88, 0x86, 0x77, 0x9C, 0xB8, 0x57, 0x67, 0xDC, 0x97, 0x89, 0x79, 0x99, 0x86, 0x67, 0x66, 0x77,
-	0x9A, 0x87, 0x9A, 0x98, 0x99, 0x65, 0x87, 0x7A, 0xA7, 0x8A, 0x98, 0x8A, 0x77, 0x78, 0x69, 0xA6,
-	0x7B, 0xA8, 0x8B, 0x74, 0x67, 0x69, 0xB8, 0x6A, 0x88, 0xA7, 0x76, 0x8A, 0x7A, 0x9A, 0x87, 0x65,
-	0x97, 0x89, 0xBA, 0x87, 0x69, 0x87, 0x88, 0x98, 0x76, 0x8A, 0x78, 0x99, 0x98, 0x66, 0x89, 0x78,
-	0xA9, 0x96, 0x58, 0x78, 0xA8, 0xA8, 0x78, 0x86, 0x8A, 0x99, 0xBB, 0x97, 0x78, 0x89, 0x76, 0x55,
-	0x77, 0x79, 0x87, 0x8A, 0xA9, 0x98, 0x85, 0x7A, 0xA9, 0x9A, 0x88, 0x65, 0x68, 0xA8, 0x88, 0xA9,
-	0x88, 0x56, 0x99, 0x88, 0x89, 0x98, 0x88, 0x77, 0x98, 0x97, 0x89, 0x99, 0x89, 0x79, 0x68, 0x89,
-	0x89, 0x99, 0x95, 0x77, 0xA6, 0xB9, 0x97, 0x77, 0x77, 0xA9, 0x86, 0x78, 0xA9, 0xA8, 0x97, 0x77,
-	0x97, 0x87, 0x9A, 0x79, 0x8B, 0x95, 0x66, 0x75, 0x68, 0x8C, 0x98, 0x77, 0xB9, 0x89, 0xAA, 0x86,
-	0x78, 0x64, 0x77, 0xBC, 0x78, 0x58, 0x97, 0xBA, 0xB9, 0x66, 0x68, 0x97, 0x57, 0x6B, 0xB7, 0x77,
-	0x7A, 0xB8, 0xAA, 0xAA, 0x77, 0x55, 0x77, 0x55, 0x87, 0x9B, 0x87, 0x79, 0xAA, 0x88, 0x98, 0x99,
-	0xB7, 0x77, 0x68, 0x78, 0x88, 0x7A, 0xB9, 0x88, 0x64, 0x78, 0x8A, 0x87, 0x8B, 0x98, 0x77, 0x66,
-	0x79, 0xB8, 0x59, 0xB7, 0x97, 0x78, 0x6A, 0x95, 0x99, 0xA8, 0x58, 0x59, 0xA7, 0x99, 0xB7, 0x57,
-	0x7A, 0x97, 0x98, 0xA8, 0x67, 0x5A, 0xA7, 0x8A, 0xAA, 0x78, 0x56, 0x99, 0x79, 0x9A, 0x88, 0x67,
-	0x79, 0x97, 0x67, 0xA9, 0x98, 0x66, 0x99, 0x87, 0x9A, 0xA9, 0x66, 0x67, 0x97, 0x78, 0x8C, 0x99,
-	0x85, 0x87, 0x8A, 0x89, 0xA8, 0x87, 0x78, 0x66, 0x76, 0x9A, 0x8A, 0x78, 0x87, 0xBA, 0xAB, 0x98,
-	0x74, 0x77, 0x56, 0x57, 0xAB, 0x9A, 0x89, 0x57, 0xC9, 0xA8, 0x77, 0x47, 0x97, 0x76, 0x87, 0x9B,
-	0x97, 0x78, 0xA6, 0x7B, 0x96, 0x57, 0x97, 0x8A, 0x97, 0x68, 0x96, 0x9C, 0x88, 0x77, 0x86, 0x9A,
-	0x87, 0x58, 0x96, 0xA9, 0x87, 0x79, 0xA7, 0xDA, 0x66, 0x65, 0x97, 0x65, 0x86, 0xAB, 0x97, 0xA8,
-	0x79, 0x75, 0xA9, 0x8D, 0x98, 0xA8, 0x58, 0x64, 0x69, 0x79, 0x8A, 0xBA, 0x78, 0x64, 0x8B, 0xA8,
-	0x88, 0xA8, 0x77, 0x76, 0x8A, 0x98, 0x7A, 0x98, 0x87, 0x88, 0x9A, 0x67, 0xC8, 0x67, 0x67, 0x8A,
-	0xA6, 0x9C, 0x87, 0x67, 0x77, 0xB9, 0x6A, 0xB9, 0x76, 0x65, 0x7B, 0x97, 0xBB, 0x67, 0x56, 0x66,
-	0xAB, 0xCD, 0x76, 0x67, 0x66, 0x9A, 0x99, 0xAC, 0x98, 0x95, 0x33, 0x6A, 0x7A, 0xA5, 0x55, 0x9A,
-	0xAD, 0xB8, 0x87, 0x86, 0x66, 0x7C, 0x9A, 0x87, 0x77, 0x9A, 0x89, 0x78, 0x77, 0x87, 0xAB, 0x77,
-	0x89, 0x99, 0xA7, 0x58, 0x77, 0x79, 0xCA, 0x76, 0x89, 0x6B, 0x99, 0x8A, 0x75, 0x85, 0x78, 0xA7,
-	0xBA, 0x64, 0x9D, 0x7D, 0x76, 0x67, 0x87, 0xB8, 0xB9, 0xA6, 0x77, 0x36, 0x8A, 0x67, 0x99, 0xBB,
-	0x8A, 0xA5, 0x55, 0x9B, 0x97, 0x86, 0x77, 0x89, 0x87, 0xBA, 0x99, 0x78, 0x87, 0xB9, 0x96, 0x69,
-	0x88, 0x86, 0x87, 0x89, 0x88, 0xA8, 0x89, 0x87, 0x89, 0x88, 0x78, 0x99, 0x69, 0x98, 0x88, 0x8A,
-	0x76, 0x98, 0x77, 0x86, 0xA8, 0xAA, 0x96, 0x68, 0xC8, 0x48, 0x87, 0x78, 0x8B, 0x87, 0x99, 0x67,
-	0x7A, 0x96, 0x98, 0x58, 0x88, 0x68, 0xBA, 0x96, 0x67, 0x99, 0xBD, 0x99, 0x98, 0x66, 0x96, 0x56,
-	0x78, 0x8A, 0x78, 0x98, 0x78, 0x97, 0x67, 0x78, 0xAC, 0xB9, 0x99, 0x78, 0xB8, 0x58, 0x75, 0x87,
-	0x88, 0xBC, 0x97, 0x47, 0x7A, 0x9A, 0x76, 0x67, 0x7B, 0x78, 0xA9, 0x7A, 0x89, 0x75, 0x9A, 0xA8,
-	0xA6, 0x84, 0x8A, 0x76, 0x86, 0x67, 0xA9, 0x99, 0xC8, 0x77, 0xA8, 0x77, 0x78, 0x77, 0x9A, 0x69,
-	0x99, 0x98, 0x89, 0x86, 0x47, 0xA7, 0x68, 0x98, 0x7A, 0xDA, 0x67, 0x86, 0x68, 0x79, 0x89, 0xA7,
-	0x87, 0x89, 0x99, 0xCA, 0x97, 0x56, 0x86, 0x57, 0x79, 0x8A, 0x99, 0x9A, 0x86, 0x66, 0x68, 0xAA,
-	0x68, 0x79, 0x88, 0xBB, 0x88, 0x86, 0x78, 0xB8, 0x75, 0x77, 0x78, 0xD9, 0x76, 0x78, 0x99, 0xA8,
-	0x78, 0x97, 0x67, 0x79, 0x96, 0x76, 0x8C, 0xB9, 0x89, 0x77, 0x86, 0x68, 0x78, 0x96, 0x89, 0x99,
-	0xB8, 0x77, 0x7C, 0xDA, 0x86, 0x57, 0xB8, 0x57, 0x66, 0x99, 0x99, 0x79, 0x66, 0x79, 0xDA, 0x98,
-	0xA7, 0x66, 0x67, 0x38, 0xBB, 0xB7, 0x76, 0xDB, 0xA8, 0xA9, 0x66, 0x69, 0x66, 0x58, 0x76, 0x99,
-	0xBC, 0xC9, 0x88, 0x78, 0x85, 0x76, 0x89, 0xA8, 0x88, 0x98, 0x88, 0xA9, 0x79, 0x87, 0x78, 0x89,
-	0x87, 0x87, 0x88, 0x88, 0x79, 0x79, 0x87, 0x69, 0x79, 0xAA, 0x99, 0x67, 0x77, 0xAB, 0x88, 0x79,
-	0x88, 0xC8, 0x55, 0x78, 0x88, 0xA9, 0x68, 0x88, 0x87, 0x89, 0x99, 0xA9, 0x87, 0x95, 0x88, 0xCA,
-	0x78, 0x79, 0x77, 0x46, 0xA8, 0x86, 0xAA, 0x79, 0xCB, 0x87, 0x87, 0x76, 0x66, 0x97, 0x89, 0xAC,
-	0x75, 0x9C, 0xB8, 0x97, 0x66, 0x67, 0x86, 0x8B, 0xA8, 0x68, 0x8A, 0x76, 0x69, 0xAC, 0xAA, 0xA6,
-	0x6A, 0x85, 0x57, 0x9A, 0x65, 0x68, 0x9B, 0x98, 0x99, 0x9D, 0xCA, 0x86, 0x57, 0x55, 0x78, 0x89,
-	0x97, 0x89, 0x88, 0x89, 0x99, 0x88, 0x88, 0x89, 0x88, 0x76, 0x77, 0x68, 0x89, 0xAC, 0xAB, 0x98,
-	0x76, 0x78, 0x86, 0x77, 0xB9, 0x98, 0xA7, 0x77, 0x9A, 0x89, 0x98, 0x6A, 0x76, 0x58, 0x97, 0x65,
-	0x98, 0x9A, 0xB9, 0xA9, 0x99, 0x66, 0x78, 0x77, 0x87, 0x78, 0xBA, 0x76, 0x69, 0x98, 0x9A, 0x85,
-	0x48, 0x98, 0x8D, 0xD9, 0x67, 0x79, 0xA8, 0x76, 0x69, 0xC8, 0x86, 0x66, 0xA6, 0x57, 0x89, 0xAB,
-	0x98, 0x78, 0xAB, 0x87, 0x87, 0x9A, 0xA6, 0x66, 0x67, 0x77, 0x66, 0xA9, 0xBA, 0x7A, 0xB8, 0x68,
-	0xC8, 0x75, 0x46, 0x87, 0xA8, 0xAA, 0x77, 0x7B, 0xC9, 0x67, 0x98, 0x58, 0xA7, 0x76, 0x56, 0x9B,
-	0xA7, 0x8B, 0xA7, 0x7A, 0xA8, 0x75, 0x67, 0x66, 0x78, 0xAB, 0xA9, 0x99, 0x8A, 0xA8, 0x76, 0x68,
-	0x89, 0x85, 0x68, 0x65, 0xAB, 0xAD, 0x88, 0x78, 0x96, 0x87, 0x58, 0xAA, 0xC8, 0x77, 0x88, 0x69,
-	0x87, 0x97, 0xBB, 0x67, 0x8A, 0x78, 0x97, 0x97, 0x6A, 0x86, 0x78, 0x66, 0x88, 0x79, 0xAC, 0x98,
-	0xA7, 0x78, 0x7A, 0x9C, 0xA5, 0x87, 0x76, 0x76, 0x67, 0xA4, 0x9A, 0x79, 0x67, 0x99, 0xC8, 0x88,
-	0x69, 0x87, 0xA8, 0xA8, 0x69, 0x99, 0x77, 0x77, 0x55, 0x87, 0x79, 0xAB, 0xAE, 0xD7, 0x75, 0x78,
-	0x9A, 0x99, 0x97, 0x65, 0x69, 0x77, 0x99, 0x64, 0x67, 0x69, 0x89, 0xBB, 0xEB, 0x68, 0x77, 0x57,
-	0xBA, 0x99, 0x76, 0x87, 0xAA, 0x78, 0x66, 0x77, 0x79, 0xBA, 0x68, 0x97, 0x86, 0x87, 0xAE, 0xB6,
-	0x8B, 0x84, 0x79, 0x65, 0x76, 0x58, 0xDB, 0x67, 0xA8, 0x79, 0x96, 0x77, 0x89, 0x9B, 0xB8, 0x9A,
-	0x88, 0x76, 0x56, 0x87, 0x59, 0xBB, 0x88, 0xA9, 0x87, 0x89, 0x86, 0x87, 0x88, 0xA7, 0x54, 0x76,
-	0x88, 0x79, 0x98, 0xAC, 0xD9, 0x77, 0x78, 0x99, 0x78, 0xA8, 0x87, 0x87, 0x97, 0x67, 0x9A, 0xB8,
-	0x76, 0x59, 0x86, 0x76, 0x6C, 0xA9, 0x99, 0x76, 0x89, 0x88, 0xAB, 0x77, 0x6A, 0x97, 0x85, 0x6A,
-	0xB8, 0x95, 0x66, 0x67, 0x98, 0xAB, 0x98, 0x78, 0x87, 0xA9, 0x78, 0x98, 0x78, 0x99, 0x75, 0x88,
-	0x78, 0xBA, 0x76, 0x8A, 0x57, 0x77, 0x78, 0xCD, 0xB8, 0x67, 0x59, 0xD8, 0x78, 0x98, 0x5A, 0x76,
-	0x89, 0x97, 0x88, 0x75, 0x47, 0x78, 0xEE, 0x77, 0x86, 0x5A, 0x68, 0xAA, 0x89, 0x96, 0x78, 0x79,
-	0xA8, 0x77, 0x85, 0xA9, 0x79, 0xB9, 0x68, 0x87, 0x88, 0x78, 0xAA, 0x9B, 0x88, 0x84, 0x6A, 0xA6,
-	0x68, 0x66, 0x9A, 0x75, 0x6B, 0x97, 0xAB, 0x77, 0x79, 0xAA, 0x76, 0x8A, 0x98, 0xB7, 0x75, 0x59,
-	0x97, 0x89, 0xB9, 0x89, 0x77, 0x76, 0x79, 0x86, 0x99, 0x87, 0x8B, 0xAC, 0x98, 0x77, 0x77, 0x79,
-	0x8A, 0x88, 0x76, 0x87, 0xA9, 0x97, 0x78, 0x78, 0x66, 0x7A, 0xBA, 0xA6, 0x66, 0x7B, 0xAA, 0x66,
-	0x76, 0x97, 0x68, 0x9B, 0x77, 0x7B, 0x98, 0x77, 0xA9, 0x8A, 0xA7, 0x67, 0xA7, 0x79, 0x96, 0x67,
-	0x89, 0xA9, 0x88, 0x88, 0x78, 0x59, 0xA8, 0x65, 0x99, 0x7A, 0x68, 0xCA, 0x87, 0x8A, 0x68, 0x75,
-	0x99, 0x87, 0x9A, 0x67, 0x77, 0xA9, 0xC9, 0x67, 0x59, 0x78, 0x8A, 0xDA, 0x9A, 0x65, 0x59, 0xB7,
-	0xA7, 0x43, 0x58, 0x98, 0xBA, 0x99, 0xAA, 0x76, 0x76, 0x67, 0xCC, 0xAA, 0x87, 0x75, 0x67, 0x79,
-	0xAA, 0x98, 0x79, 0x97, 0x77, 0x59, 0xBA, 0x88, 0x7A, 0x97, 0x87, 0x69, 0x66, 0x55, 0x79, 0xCA,
-	0xBC, 0x88, 0x5A, 0x87, 0x89, 0x89, 0xBB, 0x67, 0x96, 0x86, 0x99, 0x36, 0x35, 0x79, 0xCA, 0xAC,
-	0xA8, 0x58, 0x97, 0x65, 0x87, 0xCA, 0x68, 0xA7, 0x68, 0x6A, 0x98, 0x6A, 0x76, 0x88, 0xCA, 0x77,
-	0x98, 0x59, 0x68, 0x99, 0x79, 0xB6, 0x76, 0x8A, 0x97, 0x7B, 0x67, 0x55, 0x99, 0xAA, 0x77, 0x9A,
-	0x87, 0x76, 0x78, 0x88, 0x9A, 0x85, 0x9B, 0x98, 0x87, 0x78, 0x77, 0x9A, 0xB7, 0x76, 0x8A, 0x78,
-	0x77, 0x99, 0x79, 0x87, 0x68, 0x89, 0x79, 0xA8, 0x56, 0x8A, 0x99, 0xA8, 0x76, 0x9A, 0xA7, 0x97,
-	0x76, 0x89, 0xA8, 0x77, 0x77, 0x89, 0xA8, 0x7A, 0xA6, 0x86, 0x57, 0x65, 0xA9, 0x77, 0xBC, 0x8B,
-	0x96, 0x69, 0xA8, 0xA9, 0x98, 0x98, 0x68, 0x64, 0x57, 0x96, 0x88, 0x79, 0xBC, 0x9B, 0x95, 0x57,
-	0x99, 0xAB, 0x96, 0x89, 0xA7, 0x76, 0x44, 0x56, 0x7A, 0xA8, 0x9A, 0xC6, 0x78, 0x88, 0x7A, 0x9A,
-	0x69, 0x67, 0x59, 0x9B, 0x87, 0x97, 0x65, 0x88, 0xB8, 0x9A, 0x66, 0x79, 0x89, 0x79, 0x87, 0x68,
-	0x99, 0x87, 0x89, 0x96, 0x78, 0xB9, 0x96, 0x8A, 0x87, 0x96, 0x57, 0x68, 0x7B, 0xBB, 0x67, 0x88,
-	0x88, 0x97, 0x67, 0x69, 0x8A, 0xAA, 0x68, 0x99, 0x77, 0x88, 0x78, 0x88, 0x78, 0x99, 0x8A, 0x87,
-	0x68, 0x9B, 0x79, 0x86, 0x58, 0x9A, 0x7A, 0x87, 0x68, 0x9A, 0x79, 0x87, 0x68, 0x9A, 0x78, 0x76,
-	0x59, 0x9A, 0x78, 0x86, 0x56, 0x9A, 0xAA, 0x89, 0x79, 0xA9, 0x88, 0x87, 0x9B, 0xA8, 0x85, 0x46,
-	0x87, 0x68, 0x77, 0x99, 0x89, 0x99, 0x9A, 0x86, 0x67, 0x8A, 0xA8, 0x89, 0x55, 0x65, 0x88, 0x9B,
-	0xA8, 0x98, 0x8A, 0xCB, 0x67, 0x76, 0x9B, 0xC9, 0x68, 0x56, 0x88, 0x77, 0x74, 0x57, 0xAA, 0x9A,
-	0x87, 0x9A, 0xB8, 0x67, 0x68, 0x98, 0x76, 0x79, 0x9B, 0x99, 0x88, 0x78, 0x87, 0x79, 0x99, 0x88,
-	0x86, 0x69, 0x9A, 0x87, 0x98, 0x66, 0x89, 0x99, 0x87, 0x98, 0x67, 0x89, 0x88, 0x78, 0x96, 0x68,
-	0xAB, 0x98, 0x79, 0x65, 0x78, 0xA9, 0xA7, 0x88, 0x78, 0x88, 0x88, 0x87, 0x89, 0x97, 0x88, 0x57,
-	0xAA, 0x98, 0x98, 0x56, 0x89, 0x88, 0x87, 0x57, 0x99, 0x78, 0xAA, 0xAA, 0x77, 0x99, 0x97, 0x78,
-	0x66, 0x47, 0x98, 0x87, 0x8A, 0xAA, 0x97, 0x98, 0x88, 0x78, 0x77, 0x63, 0x77, 0x98, 0x8A, 0xAA,
-	0x99, 0x98, 0x89, 0x78, 0x98, 0x76, 0x68, 0x67, 0x98, 0xAA, 0x99, 0x8A, 0x96, 0x89, 0x99, 0x77,
-	0x65, 0x78, 0x79, 0x78, 0x99, 0x99, 0x8A, 0x88, 0x98, 0x87, 0x89, 0x88, 0x98, 0x86, 0x76, 0x89,
-	0x98, 0xA7, 0x6B, 0x86, 0x76, 0x79, 0x98, 0xA9, 0x79, 0x76, 0x76, 0x7A, 0xA8, 0xA9, 0x69, 0x85,
-	0x86, 0x7B, 0x98, 0xA9, 0x69, 0xA6, 0x76, 0x69, 0x88, 0x97, 0x6A, 0x67, 0x77, 0xA9, 0x9A, 0x69,
-	0x97, 0x85, 0x8A, 0x7A, 0x97, 0xA6, 0x67, 0x69, 0x98, 0xA7, 0x99, 0x78, 0x67, 0x98, 0xA9, 0x9A,
-	0x98, 0x66, 0x78, 0xAA, 0x98, 0x67, 0x88, 0x87, 0x76, 0x58, 0x99, 0x98, 0x98, 0x77, 0x8A, 0xA9,
-	0x87, 0x67, 0x9A, 0x99, 0x86, 0x87, 0x77, 0x78, 0x99, 0x99, 0x87, 0x79, 0xA9, 0x98, 0x57, 0xAB,
-	0x97, 0x76, 0x77, 0x88, 0xA8, 0x87, 0x99, 0x87, 0xA9, 0x65, 0x87, 0x78, 0x99, 0x97, 0x9A, 0x77,
-	0xA9, 0x65, 0x67, 0x78, 0x89, 0x88, 0xAB, 0x78, 0xA8, 0x69, 0x87, 0x98, 0x98, 0x67, 0x98, 0x98,
-	0x88, 0x76, 0x79, 0x99, 0x88, 0x97, 0x79, 0x9A, 0x98, 0x87, 0x68, 0x98, 0x89, 0x88, 0x67, 0x99,
-	0x99, 0xA7, 0x87, 0x79, 0xAA, 0x68, 0x76, 0x87, 0x77, 0x67, 0x78, 0x99, 0xA8, 0x87, 0x8A, 0xAB,
-	0x87, 0x77, 0xA9, 0xB9, 0x76, 0x69, 0x77, 0x76, 0x88, 0x99, 0x89, 0x88, 0x98, 0x86, 0x68, 0x98,
-	0x9A, 0x98, 0x79, 0x98, 0x77, 0x68, 0x98, 0x99, 0x99, 0x78, 0x98, 0x76, 0x89, 0x89, 0x98, 0x99,
-	0x88, 0x87, 0x87, 0x89, 0x88, 0x98, 0x78, 0x78, 0x98, 0x99, 0x78, 0x98, 0x77, 0x98, 0x88, 0x87,
-	0x99, 0x89, 0x87, 0x98, 0x88, 0x76, 0x99, 0x87, 0x8A, 0x87, 0xA9, 0x67, 0x76, 0x89, 0x87, 0x89,
-	0x87, 0xA8, 0x78, 0x86, 0x89, 0x88, 0x99, 0x78, 0x98, 0x77, 0x67, 0x98, 0x88, 0x88, 0x98, 0x78,
-	0x9A, 0x77, 0x77, 0x79, 0x89, 0x88, 0x7A, 0x98, 0x79, 0x87, 0x67, 0x88, 0x88, 0x98, 0x87, 0xAA,
-	0xA7, 0x68, 0x8A, 0x98, 0x77, 0x88, 0x87, 0x78, 0x99, 0x87, 0x87, 0x87, 0x79, 0x99, 0x78, 0x99,
-	0x99, 0x77, 0x89, 0x97, 0x77, 0x87, 0x68, 0xA8, 0x98, 0x68, 0x99, 0x98, 0x88, 0x88, 0x99, 0x77,
-	0x87, 0x66, 0x9A, 0x99, 0x78, 0x88, 0xA9, 0x88, 0x78, 0xA9, 0x88, 0x88, 0x76, 0x79, 0x99, 0x88,
-	0x78, 0x99, 0x78, 0xAA, 0x76, 0x87, 0x78, 0x9A, 0x98, 0x78, 0x8A, 0x87, 0x9A, 0x86, 0x77, 0x67,
-	0x89, 0x88, 0x79, 0x89, 0x96, 0x89, 0x97, 0x78, 0x98, 0x98, 0x88, 0x77, 0x98, 0x88, 0x78, 0x87,
-	0x89, 0x89, 0x89, 0x87, 0x77, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0xA8, 0x87, 0x78,
-	0x79, 0x98, 0x87, 0x98, 0x88, 0x89, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x98, 0x78, 0x88, 0x98,
-	0x87, 0x78, 0x88, 0x88, 0x97, 0x89, 0x88, 0x98, 0x97, 0x79, 0x87, 0x89, 0x97, 0x87, 0x89, 0x89,
-	0x98, 0x78, 0x77, 0x88, 0x88, 0x87, 0x89, 0x97, 0x88, 0x88, 0x87, 0x79, 0x89, 0x88, 0x88, 0x78,
-	0x77, 0x89, 0x97, 0x87, 0x89, 0x98, 0x88, 0x8A, 0x99, 0x87, 0x77, 0x88, 0x78, 0x89, 0x98, 0x98,
-	0x88, 0x88, 0x78, 0x88, 0x99, 0x97, 0x78, 0x99, 0x98, 0x87, 0x88, 0x78, 0x88, 0x98, 0x87, 0x79,
-	0x89, 0x88, 0x89, 0x87, 0x89, 0x88, 0x77, 0x89, 0x87, 0x89, 0x89, 0x77, 0x89, 0x87, 0x88, 0x88,
-	0x78, 0x99, 0x87, 0x98, 0x88, 0x77, 0x79, 0x88, 0x78, 0x89, 0x89, 0x87, 0x87, 0x89, 0x88, 0x88,
-	0x98, 0x89, 0x87, 0x88, 0x88, 0x88, 0x78, 0x98, 0x99, 0x88, 0x78, 0x98, 0x87, 0x79, 0x97, 0x89,
-	0xA9, 0x78, 0x87, 0x88, 0x77, 0x89, 0x89, 0x98, 0x87, 0x87, 0x88, 0x98, 0x88, 0x77, 0x9A, 0x97,
-	0x98, 0x78, 0x88, 0x68
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x47, 0x84, 0x10,
+	0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+	0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x01, 0xE8, 0x1E, 0x10, 0x41, 0x04, 0x10, 0x41, 0x00, 0x7A, 0x01, 0x04, 0x13,
+	0xA8, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08,
+	0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+	0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x07, 0x84, 0x10, 0x41, 0x04, 0x10,
+	0x41, 0x18, 0xE2, 0x41, 0x04, 0x11, 0x8E, 0x23, 0xC2, 0x0E, 0x40, 0x0F, 0x40, 0x20, 0x82, 0x07,
+	0x84, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x93, 0xA1, 0x04, 0x10, 0x49, 0xD0,
+	0x90, 0x40, 0xF0, 0x82, 0x08, 0x20, 0x82, 0x3C, 0x20, 0x82, 0x08, 0x23, 0xE0, 0x05, 0x86, 0x73,
+	0x13, 0x35, 0x52, 0xA1, 0x20, 0x78, 0x29, 0xAA, 0x82, 0x08, 0x20, 0x82, 0x3C, 0x20, 0x82, 0x75,
+	0x00, 0x82, 0x3C, 0x24, 0xCB, 0x23, 0x84, 0x0F, 0x53, 0x50, 0x81, 0x6C, 0x40, 0x8F, 0xA9, 0x8D,
+	0x22, 0x05, 0xB1, 0xAA, 0x3E, 0x4E, 0x18, 0x88, 0x16, 0xC4, 0x00, 0xF4, 0x02, 0x07, 0x84, 0x82,
+	0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x75, 0x00, 0x82, 0x08, 0x20, 0x7A, 0x54, 0x27, 0x51, 0x5C,
+	0x50, 0xD3, 0x05, 0x07, 0x62, 0xC1, 0x04, 0x10, 0x4F, 0x18, 0x81, 0xE8, 0x3A, 0x83, 0x10, 0xF0,
+	0x82, 0x09, 0xD4, 0x0F, 0x08, 0xAC, 0x11, 0xE1, 0x3A, 0x82, 0x01, 0x02, 0xCA, 0xC8, 0x23, 0x1C,
+	0x41, 0x04, 0xEA, 0x07, 0x84, 0xCA, 0xBA, 0x20, 0x9D, 0x62, 0x14, 0xC3, 0x44, 0x16, 0x11, 0x59,
+	0xD5, 0x88, 0x47, 0x38, 0x18, 0xC4, 0xED, 0x10, 0x2D, 0x8E, 0x46, 0xC7, 0xAA, 0xA6, 0x65, 0x03,
+	0xC0, 0xE1, 0x03, 0xD5, 0x67, 0x21, 0xC3, 0x15, 0x3C, 0x04, 0x47, 0xC9, 0x9B, 0x3A, 0x26, 0x47,
+	0x54, 0x69, 0xD8, 0xAB, 0x00, 0x8F, 0x08, 0xEC, 0x81, 0xDF, 0x23, 0x57, 0x3B, 0x0C, 0x8F, 0xC0,
+	0x55, 0x8F, 0x64, 0x05, 0x2B, 0x8C, 0x20, 0x58, 0x14, 0x7C, 0x19, 0xC1, 0xCC, 0xEA, 0x1A, 0xA5,
+	0x9A, 0x3A, 0x72, 0x88, 0x75, 0xC1, 0x16, 0x67, 0x29, 0x82, 0x64, 0xB5, 0x50, 0x08, 0xF5, 0x47,
+	0x1E, 0xAD, 0x0A, 0x2B, 0x9D, 0xA8, 0xD9, 0xCA, 0xE4, 0xD8, 0xF0, 0x82, 0x3D, 0xCC, 0x89, 0xD8,
+	0x0E, 0x99, 0x45, 0x74, 0x01, 0xAB, 0xDC, 0x90, 0x40, 0xB6, 0x23, 0xA8, 0x16, 0xAA, 0x05, 0x3C,
+	0x89, 0x53, 0x84, 0x7E, 0x3A, 0x68, 0x9A, 0xA7, 0x55, 0x8A, 0xF0, 0xE4, 0xC1, 0xDA, 0x8D, 0x3A,
+	0x3B, 0xC3, 0xC6, 0x1A, 0xF6, 0x04, 0x60, 0xF1, 0x02, 0x70, 0x23, 0x1A, 0x67, 0x31, 0x07, 0x3B,
+	0xC8, 0x87, 0xA9, 0x90, 0x9A, 0x2C, 0xE8, 0x18, 0x8A, 0x24, 0x1D, 0x81, 0xB1, 0xE4, 0xE3, 0x51,
+	0xCA, 0x9E, 0x87, 0x02, 0x54, 0x70, 0x50, 0xEF, 0x39, 0x54, 0x10, 0xE4, 0xE8, 0x61, 0x04, 0x79,
+	0x5C, 0x08, 0xEC, 0x4B, 0x98, 0xC2, 0x08, 0x3A, 0x39, 0x59, 0xAA, 0x21, 0x65, 0x71, 0x54, 0xE3,
+	0xE2, 0x38, 0xD9, 0xC3, 0x99, 0xC3, 0xEA, 0x00, 0x4F, 0x08, 0x4B, 0xF3, 0x04, 0x3C, 0xB3, 0x87,
+	0x8C, 0x4A, 0x79, 0x8A, 0x0F, 0x8C, 0x81, 0xF4, 0x0D, 0xBB, 0x32, 0x35, 0x31, 0x59, 0xCF, 0x89,
+	0x5A, 0x9E, 0x80, 0x89, 0x38, 0xE1, 0x3C, 0x21, 0xA3, 0x10, 0xE7, 0x91, 0x03, 0x96, 0x07, 0x05,
+	0xB9, 0x30, 0x87, 0xED, 0x0D, 0x89, 0xC4, 0x8A, 0xA9, 0xCA, 0xF0, 0x1D, 0x94, 0x24, 0x2F, 0x60,
+	0x2D, 0xF8, 0x6C, 0x59, 0x4B, 0x2A, 0x74, 0x40, 0xB5, 0x01, 0xE3, 0x04, 0x7E, 0x44, 0x23, 0xAE,
+	0xF0, 0x4E, 0x52, 0xAD, 0x94, 0x35, 0x58, 0xBD, 0x31, 0x08, 0xC6, 0x78, 0x0D, 0x03, 0x98, 0x98,
+	0x3C, 0x5E, 0x95, 0x15, 0xAC, 0x4B, 0x5F, 0xA6, 0x35, 0x62, 0xA7, 0x4D, 0x9D, 0x53, 0x90, 0xC4,
+	0xD8, 0x06, 0x06, 0xC6, 0x11, 0x3D, 0x82, 0x3C, 0xAC, 0x41, 0x41, 0xF0, 0x21, 0xC3, 0xF8, 0x22,
+	0x2E, 0xB8, 0x30, 0x3A, 0x3C, 0x8A, 0xBA, 0x38, 0xA8, 0x8C, 0x90, 0x9B, 0xD4, 0x85, 0x13, 0xA1,
+	0x22, 0xFC, 0xC3, 0x0E, 0x01, 0xB9, 0xE9, 0x05, 0x4F, 0x91, 0x9A, 0x2D, 0x01, 0xA8, 0xF0, 0xA9,
+	0x99, 0x5F, 0x08, 0x62, 0xE2, 0x95, 0xD1, 0x6A, 0x71, 0x46, 0xC0, 0xB2, 0x9A, 0x77, 0x01, 0x83,
+	0x7A, 0xE0, 0x42, 0x4F, 0xD0, 0x84, 0x6F, 0x10, 0x85, 0xD9, 0xF2, 0x14, 0xBA, 0x3C, 0x20, 0xBB,
+	0xAA, 0x81, 0x2F, 0xC1, 0x84, 0x8F, 0x8B, 0x90, 0x6B, 0x98, 0x85, 0x6D, 0x1C, 0x84, 0x6F, 0x08,
+	0x52, 0xF5, 0x1B, 0x9E, 0x9A, 0xDC, 0xB4, 0x1E, 0xA0, 0xBC, 0x0A, 0x10, 0x67, 0xD6, 0x25, 0x3B,
+	0xE7, 0x02, 0x98, 0x29, 0x63, 0xD0, 0x0E, 0xC6, 0x0A, 0x50, 0xFD, 0x22, 0x33, 0xAB, 0xA0, 0xF1,
+	0x51, 0xEA, 0x0B, 0x70, 0x74, 0xA5, 0x74, 0xCE, 0x41, 0x15, 0xB5, 0xBC, 0x00, 0x1B, 0x84, 0x31,
+	0x56, 0x7A, 0xE1, 0x58, 0xDA, 0x67, 0x4A, 0x46, 0x3D, 0x00, 0x2F, 0x64, 0x62, 0x39, 0x8B, 0x92,
+	0x4D, 0xD2, 0x92, 0x1F, 0x35, 0x2D, 0xD8, 0x15, 0x9B, 0x97, 0x20, 0x84, 0x71, 0x38, 0x75, 0x72,
+	0x64, 0xCB, 0xAC, 0x61, 0xA6, 0x2F, 0xCC, 0x79, 0x49, 0x44, 0x89, 0xCB, 0xC1, 0x70, 0x73, 0xA0,
+	0x58, 0xD6, 0x39, 0x8E, 0xF1, 0x0E, 0x0E, 0x3B, 0x30, 0x72, 0x93, 0x3E, 0x07, 0xD6, 0x18, 0xE2,
+	0x93, 0xDC, 0x17, 0x40, 0x86, 0xAF, 0x31, 0x84, 0x04, 0xF3, 0x05, 0xF3, 0x85, 0x30, 0x70, 0xAD,
+	0x22, 0x03, 0x43, 0x54, 0x7E, 0x8A, 0xEA, 0x87, 0x33, 0xA8, 0xF5, 0x80, 0xB4, 0x2A, 0xDB, 0x28,
+	0x6D, 0xEC, 0x85, 0x14, 0x2E, 0xE6, 0x20, 0x6A, 0xB2, 0x14, 0xC5, 0xE9, 0x0E, 0x63, 0x16, 0xA7,
+	0xB1, 0x41, 0x17, 0x8E, 0x18, 0xC4, 0x0D, 0x39, 0x8C, 0x78, 0x1C, 0x17, 0x87, 0x25, 0x60, 0x6E,
+	0x21, 0x78, 0x02, 0xF0, 0xBD, 0x40, 0x71, 0x3E, 0x48, 0xB8, 0x39, 0x9C, 0x70, 0x19, 0xC0, 0x7C,
+	0xBD, 0x4A, 0x6B, 0x47, 0x0C, 0x79, 0x74, 0x59, 0x7A, 0x34, 0x65, 0x11, 0xD6, 0x17, 0xC3, 0xBA,
+	0x15, 0x42, 0x9A, 0xB1, 0x8B, 0xD2, 0x03, 0xD0, 0xB3, 0x21, 0x9C, 0x94, 0x23, 0xDD, 0xC2, 0x47,
+	0x64, 0x75, 0x89, 0x95, 0x86, 0xF7, 0x03, 0xD0, 0xDC, 0xAD, 0x2E, 0xA8, 0x4E, 0xE2, 0xE6, 0xA5,
+	0x81, 0x5B, 0x06, 0x6A, 0xC8, 0xE5, 0x98, 0x87, 0x3A, 0x7A, 0x88, 0x12, 0x9C, 0xBD, 0x20, 0x85,
+	0xDE, 0xC5, 0xB4, 0x66, 0xED, 0x63, 0x8A, 0x60, 0x64, 0xEF, 0x21, 0xC1, 0x9B, 0x12, 0xF0, 0x7A,
+	0x13, 0xAA, 0x71, 0x10, 0x06, 0xF9, 0x0F, 0x15, 0xBA, 0x2D, 0x01, 0x9E, 0x79, 0xB1, 0xE6, 0x38,
+	0x00, 0x55, 0xEA, 0x90, 0x35, 0x75, 0x43, 0x39, 0x21, 0xF5, 0x52, 0x5F, 0x53, 0x44, 0xB1, 0xB4,
+	0x03, 0x9D, 0x54, 0x61, 0x39, 0x2F, 0x82, 0x0C, 0xEA, 0xF8, 0x19, 0xB8, 0x53, 0x11, 0xE1, 0xC9,
+	0x39, 0x3D, 0xC9, 0xE3, 0x90, 0x63, 0x02, 0xA1, 0xE8, 0x6E, 0x47, 0x0C, 0x5D, 0xE8, 0x51, 0x03,
+	0xF5, 0xC9, 0x17, 0x74, 0x8B, 0xE2, 0x7A, 0xA9, 0x00, 0x0F, 0x43, 0x30, 0x0E, 0x73, 0x3A, 0x83,
+	0x17, 0x2E, 0x01, 0x02, 0xFC, 0x17, 0x07, 0xA0, 0x26, 0x3E, 0x0D, 0xA5, 0x7A, 0x42, 0x6A, 0x68,
+	0x39, 0x5B, 0x19, 0x5C, 0x05, 0x8D, 0xB2, 0x8A, 0x0D, 0x21, 0x0F, 0x03, 0x3B, 0xA2, 0xF6, 0x06,
+	0x3C, 0xE2, 0x74, 0x36, 0x25, 0x21, 0x7E, 0x87, 0x68, 0x8A, 0x84, 0xF9, 0x82, 0x50, 0xB7, 0xC9,
+	0x5A, 0x84, 0xAD, 0xDE, 0x05, 0x8A, 0x28, 0x17, 0x14, 0x98, 0x9D, 0xDA, 0x95, 0xA2, 0x8A, 0x2A,
+	0x21, 0xFE, 0x00, 0xDC, 0xE2, 0x29, 0x18, 0xE2, 0x50, 0x9E, 0x94, 0x8C, 0xDD, 0xB4, 0x93, 0x17,
+	0xA4, 0xFC, 0x43, 0x9C, 0x56, 0xE5, 0x83, 0x43, 0xC2, 0xA8, 0x72, 0x60, 0x7E, 0xC6, 0xC6, 0xB6,
+	0x27, 0x71, 0xA1, 0x88, 0x3A, 0xD0, 0x27, 0x65, 0x5A, 0x48, 0xFA, 0x32, 0x68, 0x5C, 0x98, 0xCF,
+	0x03, 0xC2, 0xA9, 0x18, 0x26, 0xFB, 0x32, 0x9C, 0xD4, 0x4F, 0x80, 0xDA, 0xDD, 0xEA, 0xC8, 0x43,
+	0xD5, 0x52, 0x20, 0xEF, 0x2B, 0x23, 0xA8, 0xC9, 0xB8, 0xA9, 0x9F, 0x22, 0xA5, 0xFB, 0x10, 0x11,
+	0xDE, 0x44, 0x18, 0xA8, 0x16, 0xB9, 0xF2, 0x1D, 0xA2, 0xBC, 0x39, 0x74, 0x57, 0x29, 0x73, 0x53,
+	0x46, 0x89, 0xD0, 0x53, 0xF8, 0xA9, 0x46, 0x82, 0x13, 0xD3, 0x97, 0x90, 0xBC, 0x08, 0x2B, 0x27,
+	0x8E, 0xE0, 0x50, 0xF4, 0x30, 0xAD, 0x31, 0x39, 0xAE, 0xAA, 0xC6, 0x01, 0x9C, 0x9C, 0x23, 0x83,
+	0x88, 0x23, 0xC3, 0x62, 0x33, 0x05, 0x2C, 0x7C, 0xB0, 0x9B, 0xC3, 0x74, 0x57, 0xE0, 0x42, 0x81,
+	0xBB, 0xB3, 0x31, 0x64, 0x70, 0x95, 0xCD, 0x1B, 0xC2, 0x68, 0x58, 0x37, 0x3D, 0x0C, 0x52, 0x7F,
+	0xAC, 0xD2, 0xC7, 0xA2, 0x23, 0xAC, 0x0D, 0xE1, 0x84, 0x7A, 0x12, 0x09, 0xF7, 0x16, 0x3C, 0x11,
+	0x2B, 0xE0, 0x86, 0x0E, 0x9C, 0x77, 0x21, 0xAA, 0x3A, 0x5A, 0xCD, 0x75, 0x4D, 0x0B, 0x3E, 0x83,
+	0x7A, 0x3A, 0x4A, 0x99, 0xBC, 0x39, 0xA2, 0x16, 0xE0, 0x68, 0x49, 0x1B, 0x84, 0xCC, 0x79, 0x63,
+	0x07, 0x70, 0xB0, 0x62, 0x3E, 0x29, 0x18, 0xDA, 0xD4, 0x5E, 0x01, 0x33, 0x95, 0x57, 0x38, 0x0B,
+	0x01, 0x55, 0x8E, 0xD2, 0x7C, 0x72, 0x22, 0xFC, 0x3A, 0x18, 0xE3, 0xD8, 0xC9, 0x0E, 0x89, 0xF2,
+	0x29, 0xE1, 0x47, 0xA0, 0xAA, 0x47, 0x4E, 0xAC, 0x4D, 0x04, 0xE1, 0xC0, 0x8A, 0xCE, 0x79, 0x49,
+	0x27, 0x0B, 0xEE, 0x4E, 0xC7, 0x35, 0x26, 0x38, 0x58, 0x7B, 0x88, 0x31, 0x72, 0x0F, 0x15, 0x72,
+	0x8D, 0x08, 0x0D, 0xDE, 0x0E, 0x3C, 0xC6, 0xEE, 0x07, 0x62, 0x74, 0x33, 0x35, 0x38, 0x36, 0x29,
+	0x80, 0x0A, 0x39, 0x81, 0xF2, 0x5C, 0x5C, 0xEC, 0xCC, 0x0D, 0xB5, 0x1D, 0xD4, 0x01, 0xFB, 0x5C,
+	0x52, 0x29, 0x12, 0x1F, 0x08, 0x4C, 0xE5, 0x69, 0x0D, 0x7A, 0x96, 0x87, 0xA3, 0x39, 0x46, 0x4E,
+	0x49, 0x34, 0x42, 0x44, 0xFC, 0x8E, 0x51, 0xC3, 0x38, 0x70, 0x21, 0x55, 0x1D, 0x6A, 0x19, 0xCC,
+	0x45, 0xA8, 0xDF, 0xDC, 0x85, 0xCF, 0x03, 0xE0, 0x40, 0x59, 0xD7, 0x0C, 0xCE, 0x80, 0xDE, 0xEC,
+	0x26, 0x73, 0x2F, 0xAC, 0x37, 0x3C, 0x12, 0x3C, 0x4C, 0xC6, 0x70, 0x6A, 0x3E, 0x57, 0xDC, 0x80,
+	0xDE, 0x65, 0x52, 0xA4, 0x2B, 0xF2, 0x72, 0xC7, 0x86, 0x86, 0x36, 0x2E, 0x54, 0x38, 0x84, 0xCF,
+	0x51, 0x99, 0xE9, 0x43, 0x14, 0x97, 0xA0, 0xD0, 0x62, 0xE7, 0x42, 0xD4, 0xE1, 0xF2, 0x88, 0x03,
+	0x8F, 0x49, 0x9D, 0x70, 0x68, 0x69, 0xF5, 0xB1, 0x2F, 0x95, 0xB9, 0x38, 0x15, 0xD8, 0x82, 0xE2,
+	0x3B, 0x20, 0x72, 0xB9, 0xE0, 0x78, 0x19, 0xE1, 0x25, 0x5C, 0x24, 0xEB, 0xB1, 0x74, 0x62, 0xAE,
+	0x55, 0x94, 0x2E, 0x66, 0x72, 0x44, 0x38, 0x81, 0xC5, 0xA8, 0xCE, 0x08, 0x8E, 0x83, 0xD0, 0xCE,
+	0x3B, 0x42, 0x8D, 0x72, 0x85, 0x7D, 0x37, 0xB6, 0x28, 0xD2, 0x62, 0x03, 0x32, 0xEA, 0xC7, 0x83,
+	0xB5, 0x2C, 0x8E, 0x61, 0x33, 0xB2, 0x86, 0x95, 0x0B, 0xCC, 0xA4, 0x06, 0x97, 0x7C, 0x58, 0xE7,
+	0x38, 0x80, 0xA5, 0x41, 0xDA, 0xA1, 0x66, 0x71, 0xCE, 0x45, 0xAB, 0x39, 0x2B, 0xB5, 0x07, 0x70,
+	0x37, 0xAA, 0x4C, 0xE5, 0xF1, 0x02, 0x98, 0x3E, 0x24, 0x40, 0x0F, 0x10, 0xB6, 0x54, 0x44, 0x6B,
+	0xF4, 0x6D, 0x14, 0x1E, 0x5A, 0x9E, 0x56, 0x78, 0x91, 0xCA, 0xAD, 0xAC, 0x1E, 0x8F, 0xC1, 0x1A,
+	0x0F, 0xD1, 0x99, 0xCE, 0x15, 0x11, 0xA8, 0x81, 0x23, 0xF3, 0x1C, 0x58, 0x86, 0x63, 0x04, 0x79,
+	0xB8, 0x13, 0x8C, 0x95, 0x6E, 0xAE, 0x08, 0xE3, 0x22, 0x43, 0x1D, 0xE1, 0x50, 0x9F, 0x88, 0x3E,
+	0x5E, 0x01, 0x6E, 0x53, 0x1F, 0x80, 0x0C, 0xEA, 0xE6, 0x8C, 0xC1, 0xF0, 0xE9, 0x1C, 0x76, 0x2F,
+	0x09, 0xA7, 0xAB, 0x2B, 0x02, 0xD2, 0xEF, 0x09, 0xD9, 0xCA, 0xB5, 0xF8, 0x6B, 0x8C, 0x5E, 0x00,
+	0x91, 0x6A, 0x73, 0x8E, 0x4E, 0x40, 0xF0, 0x8A, 0x44, 0xC9, 0x0C, 0xF5, 0x88, 0xBE, 0x25, 0x8C,
+	0x1E, 0xAD, 0x8C, 0x1E, 0x6D, 0xCC, 0x2E, 0x24, 0xCC, 0x0C, 0x06, 0xA9, 0x01, 0x39, 0xC4, 0xDC,
+	0x26, 0x6A, 0x69, 0xE1, 0x52, 0xBA, 0x10, 0xA4, 0x48, 0xFF, 0x85, 0x29, 0xA2, 0xF0, 0x46, 0x02,
+	0x98, 0x50, 0xDD, 0xF0, 0x46, 0x47, 0xC7, 0x02, 0x28, 0xD8, 0x34, 0x29, 0xF1, 0x03, 0xF0, 0x88,
+	0x4B, 0x8B, 0x0B, 0x0B, 0x2A, 0x98, 0x30, 0x34, 0x9C, 0x32, 0x7E, 0x53, 0x44, 0x60, 0xD5, 0xDC,
+	0x49, 0xC3, 0x07, 0xE2, 0x27, 0x5A, 0xFC, 0x25, 0xD5, 0xC4, 0x84, 0x48, 0x26, 0x4A, 0x73, 0xBA,
+	0x52, 0x55, 0x78, 0x42, 0x81, 0xBA, 0x33, 0x15, 0x05, 0xF1, 0xC1, 0xC0, 0xD3, 0x33, 0x25, 0x48,
+	0x4D, 0x95, 0x03, 0x1B, 0x7F, 0x60, 0xC8, 0xC4, 0xB0, 0x78, 0xF9, 0x3A, 0xE0, 0xF1, 0x55, 0x0B,
+	0x33, 0xB8, 0x91, 0x7C, 0xB9, 0x9A, 0xF1, 0x02, 0x0E, 0xF0, 0x38, 0x52, 0xAC, 0x7A, 0x73, 0x59,
+	0x19, 0xF8, 0xEC, 0x14, 0xB1, 0x55, 0xCB, 0x41, 0x53, 0x18, 0xCE, 0x67, 0x54, 0xBB, 0x0D, 0xE8,
+	0x71, 0x23, 0x80, 0x70, 0xF0, 0x81, 0xCA, 0xF9, 0x94, 0xF2, 0xB2, 0x95, 0x68, 0x6B, 0x90, 0xF2,
+	0x30, 0xC5, 0x55, 0x21, 0xBB, 0xC2, 0x90, 0xBB, 0x13, 0x26, 0x9B, 0x34, 0x25, 0x37, 0xC6, 0x85,
+	0xD6, 0xA6, 0x6C, 0xDD, 0x51, 0x02, 0x20, 0x4F, 0xC3, 0x34, 0x7E, 0x58, 0xBA, 0x43, 0x1C, 0x78,
+	0x54, 0x27, 0x73, 0xC5, 0x21, 0x32, 0x76, 0x3C, 0x73, 0x40, 0x01, 0x0B, 0x06, 0x3C, 0x57, 0x29,
+	0x15, 0x37, 0x87, 0x05, 0x13, 0xD4, 0xC4, 0xB1, 0xF8, 0xE1, 0xB6, 0x6C, 0xCD, 0x8B, 0x0E, 0x50,
+	0x91, 0xF1, 0x63, 0x57, 0x9B, 0x15, 0x13, 0x28, 0x8C, 0x5C, 0x62, 0xE1, 0xF6, 0x17, 0x1E, 0xB0,
+	0x3B, 0x06, 0x70, 0x8C, 0x6C, 0x78, 0x78, 0xC4, 0x27, 0x5C, 0xC5, 0xC3, 0x23, 0x54, 0x17, 0x93,
+	0xB5, 0x6A, 0x99, 0x54, 0xD0, 0x75, 0x8A, 0xB1, 0x5C, 0x72, 0x39, 0x4E, 0x45, 0xA5, 0xD1, 0x07,
+	0x62, 0xAD, 0x5C, 0x83, 0x66, 0x26, 0x2F, 0x45, 0x30, 0x15, 0x1B, 0x8A, 0x9D, 0xD8, 0x07, 0x42,
+	0x45, 0x39, 0x3A, 0xCA, 0xDD, 0x10, 0x47, 0xAA, 0x0F, 0xC8, 0x03, 0xAA, 0x9E, 0xE5, 0xAE, 0xCC,
+	0x48, 0x01, 0xE1, 0xD8, 0x1E, 0xA8, 0xA5, 0xB1, 0x09, 0xA3, 0x23, 0xD5, 0x8E, 0x0C, 0x4E, 0x4C,
+	0x3B, 0xC4, 0x67, 0x91, 0x5C, 0xD5, 0x17, 0xA0, 0x06, 0x10, 0x47, 0x7C, 0x5B, 0x16, 0x6C, 0xE6,
+	0x17, 0x6C, 0xC9, 0xDA, 0x24, 0xF9, 0x21, 0x2C, 0xE8, 0xCE, 0x5C, 0xF5, 0x48, 0x51, 0xD6, 0xA0,
+	0xFC, 0x43, 0x53, 0x2A, 0x2A, 0xCE, 0xEA, 0x9C, 0x99, 0xE1, 0x54, 0xE1, 0x39, 0x74, 0x4E, 0x47,
+	0x47, 0x1A, 0xB5, 0x11, 0x88, 0xF0, 0x82, 0x00, 0xF4, 0x89, 0xE9, 0x42, 0xAC, 0x61, 0x9D, 0x02,
+	0x2B, 0x20, 0x78, 0x41, 0x04, 0x7A, 0xA8, 0x1E, 0x18, 0x11, 0x24, 0x7C, 0x9C, 0x0F, 0x5C, 0x2B,
+	0x09, 0xBC, 0xE2, 0xAA, 0x9A, 0x9C, 0x10, 0x82, 0x74, 0xA7, 0x00, 0x49, 0xCB, 0xAA, 0xC1, 0x3A,
+	0xC0, 0xB9, 0xCE, 0x24, 0x69, 0x13, 0xA3, 0x61, 0x10, 0xC4, 0x21, 0xCD, 0x90, 0x4E, 0xA0, 0x72,
+	0x7A, 0xCC, 0x1E, 0x54, 0x39, 0x01, 0xE9, 0x8B, 0xAA, 0xC0, 0xB5, 0x47, 0x0D, 0x12, 0xB8, 0xAC,
+	0x74, 0x2A, 0xE2, 0x20, 0xE8, 0x8D, 0x9D, 0x13, 0x00, 0xE4, 0xEA, 0x2A, 0x75, 0x58, 0xAB, 0x04,
+	0x78, 0x2D, 0x54, 0x10, 0x4E, 0x8D, 0x53, 0x4E, 0x8D, 0x9C, 0x31, 0xC9, 0x3F, 0x19, 0x54, 0xC1,
+	0x1C, 0xA5, 0x99, 0x62, 0x16, 0x13, 0x06, 0xAE, 0x56, 0xA9, 0x3A, 0x00
 };
 
+/* 2-bit ADPCM, SNR 20.5 dB */
 const u8 sfx_drum_kick[] __attribute__((aligned(4))) = {
-	0x59, 0x88, 0x87, 0x76, 0x76, 0x66, 0x57, 0x55, 0x68, 0x95, 0x77, 0xA9, 0xBB, 0xCD, 0xCE, 0xEE,
-	0xEF, 0xEF, 0xEF, 0xDC, 0xBC, 0xA9, 0x77, 0x65, 0x43, 0x32, 0x11, 0x11, 0x10, 0x01, 0x11, 0x12,
-	0x23, 0x44, 0x45, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xAB, 0xBB, 0xCC, 0xCC, 0xDD, 0xDD, 0xEE, 0xEE,
-	0xEE, 0xDD, 0xDD, 0xDC, 0xCB, 0xBB, 0xAA, 0xA9, 0x98, 0x87, 0x77, 0x66, 0x55, 0x54, 0x44, 0x44,
-	0x44, 0x44, 0x45, 0x55, 0x55, 0x66, 0x67, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0x99, 0x99,
-	0x99, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA
+	0xD0, 0xFB, 0x68, 0xDE, 0x57, 0x24, 0x04, 0xD0, 0x98, 0xDF, 0xAF, 0xCE, 0xAB, 0xE2, 0xB1, 0x21,
+	0x44, 0x14, 0x44, 0x44, 0x10, 0x48, 0x40, 0x48, 0xAE, 0x2B, 0xBA, 0xEB, 0xF3, 0x8E, 0xEB, 0x28,
+	0x88, 0x12, 0x04, 0x10, 0x48, 0x42, 0x22, 0x22, 0x22, 0x22, 0xE8, 0x88, 0xBA, 0x22, 0x22, 0x22,
+	0x22, 0x10, 0x88, 0x42, 0x22, 0x04, 0x8A, 0xE2, 0x22, 0xB8, 0x8B, 0xA2, 0x22, 0xE8, 0x88, 0x12,
+	0x20, 0x48, 0x84, 0x22, 0x04, 0x88, 0x80
 };
 
+/* 3-bit ADPCM, SNR 15.1 dB */
 const u8 sfx_drum_snare[] __attribute__((aligned(4))) = {
-	0x59, 0x87, 0x54, 0x99, 0xDC, 0x77, 0xAF, 0x71, 0x42, 0x8B, 0xEB, 0x98, 0x42, 0x45, 0x27, 0x57,
-	0x87, 0xDC, 0xC9, 0x88, 0x56, 0x54, 0x35, 0x88, 0x79, 0xA8, 0x9A, 0xAB, 0xBA, 0xA7, 0x33, 0x55,
-	0x35, 0x8B, 0xCB, 0xCC, 0xA9, 0x89, 0x53, 0x43, 0x88, 0x87, 0x89, 0x9A, 0xCE, 0xB7, 0x66, 0x66,
-	0x65, 0x75, 0x67, 0x9C, 0xBC, 0xEA, 0x87, 0x54, 0x66, 0x77, 0x88, 0x89, 0x89, 0x9B, 0xA8, 0x79,
-	0x88, 0x66, 0x75, 0x67, 0xAA, 0x89, 0x89, 0xAE, 0xC8, 0x75, 0x56, 0x45, 0x78, 0x9A, 0xBC, 0xB9,
-	0x88, 0x68, 0x87, 0x54, 0x77, 0x8A, 0xAA, 0x97, 0x88, 0x89, 0x98, 0x67, 0x99, 0x65, 0x67, 0x89,
-	0x9A, 0xB9, 0x87, 0x87, 0x87, 0x77, 0x76, 0x67, 0x9D, 0xCA, 0x75, 0x68, 0x87, 0x79, 0xA7, 0x77,
-	0x77, 0x88, 0x99, 0x99, 0x98, 0x88, 0x88, 0x56, 0x56, 0xA9, 0xAC, 0xAA, 0x86, 0x76, 0x67, 0x87,
-	0x78, 0x8A, 0xAA, 0x96, 0x78, 0x78, 0x69, 0x99, 0xA8, 0x76, 0x57, 0x88, 0x99, 0xA9, 0x89, 0x87,
-	0x65, 0x78, 0x9A, 0x88, 0x89, 0x98, 0x98, 0x88, 0x78, 0x77, 0x88, 0x88, 0x8A, 0x98, 0x77, 0x89,
-	0x89, 0x77, 0x88, 0x87, 0x87, 0x88, 0x98, 0x89, 0x99, 0x78, 0x86, 0x77, 0x89, 0x99, 0x98, 0x99,
-	0x88, 0x86, 0x66, 0x89, 0x89, 0xA9, 0x97, 0x88, 0x87, 0x77, 0x88, 0x99, 0xA9, 0x88, 0x77, 0x77,
-	0x99, 0x98, 0x88, 0x87, 0x68, 0x89, 0x88, 0x99, 0x87, 0x98, 0x87, 0x78, 0x88, 0x98, 0x98, 0x78,
-	0x87, 0x77, 0x89, 0x98, 0x78, 0x98, 0x89, 0x88, 0x67, 0x88, 0x98, 0x99, 0x88, 0x77, 0x88, 0x89,
-	0x99, 0x78, 0xA9, 0x88, 0x77, 0x88, 0x88, 0x89, 0x99, 0x88, 0x77, 0x77, 0x78, 0x89, 0x87, 0x99,
-	0x98, 0x78, 0x77, 0x88, 0x89, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x98, 0x98, 0x77, 0x78,
-	0x88, 0x89, 0x99, 0x87, 0x78, 0x88, 0x78, 0x87, 0x89, 0x99, 0x98, 0x87, 0x88, 0x78, 0x88, 0x89,
-	0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x87, 0x77, 0x88, 0x77, 0x79, 0x9A, 0x98, 0x87, 0x77, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x98, 0x89, 0x88, 0x77, 0x88, 0x88, 0x89, 0x97, 0x78, 0x88, 0x88, 0x88,
-	0x77, 0x78, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x87, 0x78, 0xA8
+	0xEC, 0x6E, 0x18, 0x73, 0xC4, 0xF5, 0x11, 0x83, 0x6C, 0xF4, 0x8E, 0xE0, 0x55, 0x89, 0xA0, 0xE2,
+	0x58, 0x98, 0xA8, 0xE0, 0x41, 0x1B, 0xFF, 0x14, 0xA9, 0x11, 0x0C, 0xF7, 0x2F, 0x4E, 0x62, 0x42,
+	0x02, 0x4B, 0x78, 0x24, 0x15, 0xE2, 0x1A, 0x85, 0x7B, 0x6D, 0x70, 0x82, 0x03, 0xCA, 0x39, 0xEA,
+	0x93, 0x01, 0xC2, 0x63, 0x08, 0x1B, 0xBA, 0x60, 0x28, 0x64, 0x14, 0x76, 0xB3, 0xA9, 0x3C, 0x70,
+	0xA1, 0x2F, 0x02, 0x21, 0xF1, 0x73, 0xD2, 0x4A, 0x88, 0xFB, 0x4E, 0x36, 0x41, 0xE3, 0x6C, 0x6B,
+	0x82, 0x92, 0x31, 0xC4, 0x10, 0x87, 0x00, 0x9E, 0x07, 0xF8, 0xAD, 0x42, 0xB0, 0xD4, 0x48, 0x8D,
+	0x8C, 0x31, 0x3F, 0x06, 0xAE, 0x84, 0x3A, 0xDC, 0xC0, 0x21, 0x6A, 0xAE, 0xB5, 0x94, 0x7C, 0x04,
+	0x75, 0x60, 0xE7, 0x05, 0x05, 0x6E, 0xDD, 0x12, 0xAB, 0xC2, 0x26, 0x54, 0x85, 0x82, 0x97, 0x9B,
+	0xCC, 0x64, 0x09, 0xD4, 0xC2, 0xF8, 0x1B, 0xA4, 0xE9, 0xCC, 0x1E, 0x06, 0x14, 0x5A, 0x8D, 0x22,
+	0x62, 0x61, 0x07, 0xCC, 0x1C, 0x0C, 0xD9, 0xD1, 0x63, 0x81, 0xE3, 0x71, 0x1C, 0x46, 0x47, 0xA8,
+	0xE0, 0x6F, 0xE4, 0x87, 0x48, 0xF3, 0x47, 0x03, 0x93, 0x97, 0x68, 0xF1, 0x08, 0x03, 0x83, 0xCD,
+	0x04, 0x0C, 0x3D, 0x58, 0x97, 0x1C, 0x14, 0x0F, 0x08, 0x20, 0x78, 0x41, 0x04, 0x79, 0x5C, 0x22,
+	0x12, 0x31, 0x3E, 0x04, 0x4E, 0x86, 0x28, 0x49, 0xE6, 0x52, 0xA1, 0x03, 0xD0, 0x3C, 0x20, 0x80,
+	0x2D, 0xA0, 0x73, 0x02, 0xC2, 0xBA, 0x61, 0x1C, 0x13, 0xA1, 0x20, 0x78, 0x1D, 0x34, 0x62, 0x08,
+	0xE7, 0xA8, 0x41, 0x04, 0xF0, 0x31, 0x03, 0xC2, 0x08, 0x20, 0x9E, 0x39, 0x43, 0x78, 0x00
 };
 
+/* 4-bit PCM, exact */
 const u8 sfx_drum_hihat[] __attribute__((aligned(4))) = {
 	0x49, 0x7A, 0x65, 0x87, 0x87, 0x88, 0x87, 0x78, 0x88, 0x87, 0x77, 0x78, 0x77, 0x68
 };
 
+/* 3-bit ADPCM, SNR 18.0 dB */
 const u8 sfx_drum_crash[] __attribute__((aligned(4))) = {
-	0x59, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x87, 0x78, 0x87,
-	0x78, 0x9A, 0x98, 0x76, 0x67, 0x89, 0xAA, 0xA9, 0x76, 0x77, 0x89, 0x98, 0x88, 0x77, 0x77, 0x89,
-	0xAA, 0x97, 0x77, 0x68, 0x89, 0x99, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x89, 0x87, 0x78, 0x99,
-	0x88, 0x98, 0x87, 0x77, 0x89, 0xAB, 0xA8, 0x65, 0x67, 0x9A, 0x99, 0x87, 0x88, 0x78, 0x89, 0x99,
-	0x97, 0x66, 0x78, 0x9A, 0x99, 0x87, 0x67, 0x89, 0x98, 0x98, 0x87, 0x77, 0x89, 0x88, 0x88, 0x98,
-	0x67, 0x79, 0x99, 0x98, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x97, 0x77, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98, 0x88, 0x88, 0x77, 0x89, 0x99,
-	0x88, 0x87, 0x78, 0x99, 0x98, 0x87, 0x77, 0x78, 0x9A, 0x98, 0x77, 0x77, 0x78, 0x99, 0x98, 0x77,
-	0x78, 0x89, 0x89, 0x98, 0x77, 0x77, 0x89, 0x9A, 0x98, 0x77, 0x76, 0x79, 0xAA, 0x88, 0x77, 0x87,
-	0x89, 0x99, 0x87, 0x87, 0x78, 0x88, 0xA9, 0x87, 0x87, 0x78, 0x88, 0x99, 0x88, 0x87, 0x77, 0x89,
-	0x99, 0x98, 0x78, 0x77, 0x78, 0x99, 0x98, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0x98, 0x87, 0x87, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x87, 0x77, 0x78, 0x99, 0x98, 0x87, 0x77, 0x78, 0x98, 0x98,
-	0x87, 0x88, 0x89, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x98, 0x88,
-	0x88, 0x88, 0x97, 0x88, 0x89, 0x78, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x89, 0x89, 0x78, 0x88,
-	0x88, 0x98, 0x89, 0x87, 0x88, 0x88, 0x78, 0x89, 0x88, 0x87, 0x78, 0x78, 0x88, 0x98, 0x87, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x98, 0x88, 0x88, 0x77, 0x78,
-	0x98, 0x88, 0x88, 0x87, 0x89, 0x99, 0x88, 0x78, 0x87, 0x88, 0x89, 0x79, 0x88, 0x77, 0x87, 0x89,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x98, 0x87, 0x78, 0x88, 0x98, 0x98, 0x87,
-	0x78, 0x88, 0x98, 0x98, 0x88, 0x78, 0x89, 0x89, 0x98, 0x88, 0x88, 0x89, 0x88, 0x88, 0x98, 0x88,
-	0x89, 0x99, 0x88, 0x77, 0x88, 0x89, 0x98, 0x88, 0x78, 0x89, 0x88, 0x89, 0x88, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x77, 0x78, 0x88, 0x98, 0x87, 0x78, 0x88, 0x99, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x79, 0x99, 0x98, 0x77, 0x87, 0x78, 0x88, 0x98, 0x98,
-	0x78, 0x78, 0x98, 0x98, 0x87, 0x78, 0x89, 0x98, 0x98, 0x88, 0x78, 0x88, 0x99, 0x98, 0x88, 0x78,
-	0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x87, 0x87, 0x78, 0x89, 0x98, 0x88, 0x87, 0x88,
-	0x99, 0x98, 0x87, 0x87, 0x89, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
-	0x88, 0x87, 0x88, 0x88, 0x89, 0x89, 0x77, 0x87, 0x88, 0x88, 0x98, 0x87, 0x78, 0x99, 0x88, 0x88,
-	0x98, 0x79, 0x88, 0x88, 0x88, 0x88, 0x79, 0x88, 0x87, 0x88, 0x89, 0x88, 0x98, 0x87, 0x98, 0x89,
-	0x78, 0x87, 0x98, 0x88, 0x88, 0x89, 0x87, 0x88, 0x89, 0x88, 0x88, 0x78, 0x88, 0x89, 0x89, 0x98,
-	0x87, 0x79, 0x87, 0x88, 0x99, 0x98, 0x88, 0x78, 0x88, 0x98, 0x97, 0x78, 0x78, 0x88, 0x98, 0x88,
-	0x88, 0x87, 0x78, 0x88, 0x99, 0x88, 0x87, 0x88, 0x98, 0x88, 0x78, 0x88, 0x88, 0x89, 0x88, 0x87,
-	0x78, 0x88, 0x78, 0x98, 0x86, 0x88, 0x89, 0x88, 0x88, 0x77, 0x87, 0x89, 0x89, 0x88, 0x88, 0x88,
-	0x89, 0x99, 0x87, 0x88, 0x78, 0x88, 0x88, 0x87, 0x98, 0x98, 0x78, 0x99, 0x89, 0x77, 0x77, 0x88,
-	0x99, 0xA9, 0x78, 0x68, 0x87, 0x89, 0x99, 0x89, 0x77, 0x77, 0x89, 0x89, 0x88, 0x88, 0x77, 0x99,
-	0x99, 0x78, 0x87, 0x87, 0x88, 0x98, 0x88, 0x88, 0x98, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88,
-	0x88, 0x87, 0x78, 0x89, 0x89, 0x78, 0x87, 0x78, 0x78, 0x99, 0x88, 0x87, 0x88, 0x78, 0x89, 0xA8,
-	0x77, 0x78, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x88, 0x88, 0x79,
-	0x89, 0x87, 0x97, 0x98, 0x89, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x88, 0x8A, 0x88, 0x88,
-	0x87, 0x98, 0x8A, 0x87, 0x88, 0x89, 0x77, 0x89, 0x88, 0x87, 0x78, 0x79, 0x99, 0x98, 0x88, 0x78,
-	0x78, 0x98, 0x98, 0x88, 0x78, 0x88, 0x98, 0x98, 0x87, 0x78, 0x88, 0x98, 0x88, 0x87, 0x88, 0x89,
-	0x98, 0x88, 0x88, 0x87, 0x88, 0x99, 0x88, 0x88, 0x87, 0x89, 0x89, 0x88, 0x88, 0x87, 0x88, 0x89,
-	0x78, 0x78, 0x88, 0x89, 0x88, 0x87, 0x78, 0x88, 0x88, 0x98, 0x87, 0x78, 0x88, 0x88, 0x98, 0x87,
-	0x88, 0x88, 0x98, 0x98, 0x78, 0x78, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88,
-	0x89, 0x98, 0x88, 0x77, 0x88, 0x89, 0x98, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x98,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x87, 0x78, 0x88, 0x98, 0x87, 0x78, 0x88, 0x99, 0x88,
-	0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x78, 0x79, 0x99, 0x98, 0x78, 0x78, 0x68
+	0xEC, 0x48, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x1E, 0x0B, 0x50, 0xA6, 0x08, 0xAB, 0xB5, 0x8C,
+	0x94, 0x27, 0xF4, 0x84, 0x47, 0x13, 0x88, 0x1A, 0x23, 0xF8, 0x2B, 0x04, 0x4F, 0x34, 0x0C, 0x41,
+	0x04, 0x0F, 0x58, 0xC8, 0xE0, 0xE9, 0xA0, 0x69, 0x1D, 0xED, 0x29, 0x1A, 0x36, 0x23, 0x10, 0xE1,
+	0xDF, 0x02, 0x52, 0xB3, 0x5C, 0x52, 0x95, 0x61, 0x84, 0x4A, 0xC1, 0x1E, 0xE6, 0x31, 0x06, 0x80,
+	0x4F, 0x18, 0x90, 0x41, 0x00, 0x5D, 0x71, 0x08, 0x58, 0x41, 0x04, 0xEA, 0x09, 0x3A, 0x10, 0x47,
+	0x84, 0x13, 0xC6, 0xA0, 0xD0, 0x78, 0xCC, 0x1A, 0x71, 0x03, 0x47, 0x5D, 0x00, 0x8D, 0x09, 0xEC,
+	0x0C, 0x2C, 0xA5, 0xD0, 0x06, 0x81, 0xDB, 0x09, 0x92, 0x23, 0xCB, 0x15, 0x44, 0x4F, 0x8D, 0x8E,
+	0x27, 0x6E, 0x38, 0x28, 0x10, 0xE2, 0x78, 0x19, 0x02, 0x7C, 0x70, 0x8D, 0x41, 0xA0, 0x82, 0x07,
+	0x84, 0x10, 0x41, 0x04, 0x10, 0x41, 0x3C, 0x0D, 0x09, 0xA7, 0x35, 0x05, 0x84, 0x10, 0x41, 0x04,
+	0x10, 0x41, 0x04, 0x0F, 0x2B, 0x84, 0x8D, 0x41, 0xA6, 0x10, 0x35, 0x4E, 0x99, 0x40, 0xF0, 0x82,
+	0x75, 0x00, 0x82, 0x09, 0x3A, 0x12, 0x07, 0x84, 0x10, 0x47, 0xC0, 0x8F, 0x99, 0x48, 0x10, 0x49,
+	0x96, 0x47, 0x1E, 0x60, 0x81, 0xE0, 0xB5, 0x20, 0x4E, 0xA2, 0xB0, 0x78, 0xE9, 0x01, 0xE1, 0x88,
+	0x82, 0x07, 0x84, 0x82, 0x08, 0x20, 0x93, 0xA1, 0x1E, 0x10, 0x4F, 0x03, 0x56, 0x08, 0x27, 0x44,
+	0x4F, 0x32, 0x95, 0x0A, 0xFA, 0xA2, 0xC7, 0x8A, 0xB3, 0x28, 0x20, 0x12, 0x74, 0x24, 0x01, 0xE9,
+	0x82, 0x81, 0x55, 0x86, 0x88, 0x45, 0x56, 0x13, 0xA8, 0xA9, 0x1E, 0x01, 0x03, 0xC2, 0x07, 0xA0,
+	0x0E, 0x0F, 0x34, 0x70, 0x39, 0x64, 0xEA, 0x2B, 0x03, 0xC3, 0x11, 0x04, 0x10, 0x41, 0x04, 0x11,
+	0x8D, 0x3C, 0x0E, 0x07, 0x67, 0x04, 0x06, 0x3C, 0x13, 0xA1, 0x20, 0x82, 0x0F, 0x53, 0x10, 0x7B,
+	0x1E, 0x04, 0x05, 0x96, 0xAA, 0x95, 0x4E, 0x9A, 0x30, 0xA6, 0x56, 0x4C, 0xA0, 0x70, 0x71, 0x3A,
+	0x8A, 0xC1, 0x04, 0x10, 0x40, 0xB2, 0xD5, 0x58, 0x82, 0x98, 0x49, 0xD0, 0x50, 0x79, 0x95, 0x2A,
+	0xAC, 0x26, 0x50, 0x41, 0x04, 0x10, 0x46, 0x04, 0xF2, 0x74, 0x20, 0x8F, 0x1F, 0x15, 0x22, 0x07,
+	0xA6, 0x08, 0x8E, 0x20, 0x5B, 0x39, 0x20, 0x10, 0x0E, 0xE8, 0x99, 0x40, 0xF0, 0x38, 0x67, 0x42,
+	0xE0, 0x57, 0x44, 0x02, 0x3D, 0x54, 0x0F, 0x08, 0x39, 0x02, 0x3C, 0xA5, 0x9C, 0xBB, 0x54, 0x42,
+	0x71, 0x39, 0x01, 0xE3, 0xE1, 0xA8, 0x47, 0x84, 0x10, 0x78, 0xE0, 0x73, 0x09, 0x94, 0x56, 0x4E,
+	0x84, 0x10, 0x3C, 0x27, 0x04, 0x4C, 0x96, 0x1D, 0x40, 0x6C, 0x83, 0xC5, 0x52, 0xA7, 0x09, 0x04,
+	0x0C, 0x4F, 0x88, 0xE4, 0x08, 0x07, 0x75, 0x5C, 0x50, 0xC7, 0xC1, 0x10, 0x51, 0x6C, 0x79, 0x15,
+	0x18, 0x39, 0xF2, 0x06, 0x72, 0xB0, 0x4E, 0x19, 0x1B, 0x99, 0x95, 0x21, 0x61, 0x00, 0x7A, 0x09,
+	0xD0, 0x9C, 0x81, 0x04, 0x10, 0x78, 0x83, 0xC7, 0x99, 0x42, 0xC8, 0xCC, 0x27, 0x52, 0xA8, 0x97,
+	0x90, 0x18, 0x04, 0x11, 0xE1, 0x04, 0x10, 0x41, 0x3A, 0xC0, 0x88, 0x3B, 0x87, 0x57, 0x94, 0x87,
+	0x09, 0x94, 0x10, 0x09, 0xD6, 0x20, 0xBE, 0x20, 0x9D, 0xC8, 0xF4, 0x02, 0x2E, 0x02, 0xB0, 0x70,
+	0xB3, 0x82, 0x51, 0x3A, 0xC5, 0x53, 0x84, 0xEA, 0x05, 0x8D, 0x9A, 0x31, 0x1E, 0x10, 0x72, 0x03,
+	0x1E, 0x01, 0x27, 0x40, 0x8F, 0x00, 0x9D, 0x1C, 0xAC, 0x12, 0x75, 0x03, 0xE7, 0x11, 0x02, 0xC2,
+	0x70, 0xA0, 0x81, 0xE9, 0x63, 0x10, 0x47, 0x86, 0x22, 0x07, 0x95, 0xC6, 0xA8, 0xAC, 0x10, 0x41,
+	0x04, 0x10, 0x47, 0x84, 0x0C, 0x78, 0x38, 0x50, 0x21, 0xE5, 0x42, 0x08, 0x23, 0xC2, 0x08, 0x1E,
+	0x56, 0x09, 0x04, 0x11, 0x8E, 0x27, 0x0A, 0x05, 0x86, 0x88, 0x47, 0x2C, 0x93, 0xA1, 0x04, 0x10,
+	0x4E, 0xAB, 0x10, 0x7A, 0xB1, 0xE8, 0x00
 };
 
+/* 2-bit ADPCM, SNR 19.8 dB */
 const u8 sfx_drum_tom_low[] __attribute__((aligned(4))) = {
-	0x49, 0x75, 0x55, 0x46, 0x67, 0x98, 0x9A, 0xA9, 0xAA, 0xCA, 0xBC, 0xCC, 0xDC, 0xBA, 0x85, 0x43,
-	0x22, 0x22, 0x33, 0x44, 0x44, 0x44, 0x77, 0x9B, 0xCD, 0xED, 0xED, 0xDD, 0xDD, 0xB9, 0xA8, 0x67,
-	0x66, 0x55, 0x34, 0x43, 0x34, 0x66, 0x9B, 0xCE, 0xEE, 0xEE, 0xCC, 0xBB, 0xAA, 0xAA, 0x98, 0x75,
-	0x44, 0x33, 0x44, 0x55, 0x67, 0x88, 0x88, 0x99, 0xAB, 0xAB, 0xBB, 0xBB, 0xBB, 0xA9, 0x98, 0x77,
-	0x76, 0x65, 0x67, 0x77, 0x77, 0x88, 0x78, 0x99, 0x99, 0x9A, 0x99, 0x87, 0x77, 0x66, 0x77, 0x77,
-	0x77, 0x76, 0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x88, 0x87, 0x77, 0x67, 0x66, 0x66, 0x66,
-	0x66, 0x67, 0x78, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0xA9, 0x99, 0x88, 0x87, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x99, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x77,
-	0x66, 0x66, 0x67, 0x77, 0x77, 0x88, 0x89, 0x9A, 0xAA, 0xAA, 0xAB, 0xBB, 0xBB, 0xAA, 0xA9, 0x98,
-	0x88, 0x77, 0x76, 0x66, 0x56, 0x56, 0x66, 0x78, 0x99, 0xAB, 0xBB, 0xBC, 0xBB, 0xBB, 0xBB, 0xAA,
-	0x98, 0x77, 0x66, 0x56, 0x65, 0x55, 0x55, 0x56, 0x67, 0x78, 0x89, 0x9A, 0xAB, 0xBB, 0xBB, 0xBB,
-	0xBA, 0xAA, 0x99, 0x88, 0x77, 0x65, 0x54, 0x44, 0x45, 0x55, 0x56, 0x67, 0x78, 0x99, 0x9A, 0xAB,
-	0xBB, 0xBB, 0xBB, 0xAA, 0xA9, 0x98, 0x77, 0x65, 0x55, 0x54, 0x55, 0x55, 0x55, 0x56, 0x67, 0x78,
-	0x9A, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAA, 0xA9, 0x88, 0x76, 0x55, 0x44, 0x44, 0x44, 0x55, 0x56,
-	0x67, 0x78, 0x99, 0xAB, 0xBC, 0xCC, 0xCC, 0xBB, 0xAA, 0xA9, 0x87, 0x76, 0x55, 0x44, 0x43, 0x44,
-	0x44, 0x56, 0x67, 0x89, 0xAA, 0xBC, 0xCD, 0xDD, 0xDD, 0xCC, 0xBA, 0xA9, 0x87, 0x65, 0x54, 0x43,
-	0x33, 0x34, 0x45, 0x66, 0x78, 0x9A, 0xAB, 0xCC, 0xDD, 0xDD, 0xCC, 0xBB, 0xA9, 0x98, 0x76, 0x65,
-	0x55, 0x44, 0x44, 0x45, 0x56, 0x67, 0x78, 0x89, 0xAA, 0xBB, 0xBB, 0xCC, 0xBC, 0xBB, 0xBA, 0xA9,
-	0x98, 0x87, 0x76, 0x66, 0x65, 0x65, 0x66, 0x67, 0x77, 0x78, 0x89, 0x9A, 0xAA, 0xBB, 0xCB, 0xBB,
-	0xAA, 0xA9, 0x99, 0x88, 0x77, 0x76, 0x66, 0x66, 0x66, 0x66, 0x77, 0x78, 0x88, 0x99, 0x9A, 0xAA,
-	0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x88, 0x77, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x78,
-	0x89, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x88, 0x87, 0x76, 0x65, 0x55, 0x55, 0x55, 0x56,
-	0x66, 0x77, 0x88, 0x99, 0xAA, 0xAB, 0xBB, 0xBB, 0xAA, 0x99, 0x87, 0x77, 0x66, 0x65, 0x55, 0x55,
-	0x55, 0x55, 0x67, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x88, 0x77, 0x77, 0x67,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
-	0x88, 0x88, 0x87, 0x77, 0x78, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99,
-	0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x89,
-	0x99, 0x9A, 0xAA, 0x99, 0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x77, 0x66
+	0xDF, 0x8D, 0x12, 0x5A, 0x47, 0x18, 0x7B, 0xFA, 0x80, 0x44, 0x85, 0x54, 0x12, 0x32, 0x3F, 0xF8,
+	0xAF, 0xC3, 0x14, 0x51, 0x23, 0xCC, 0xE2, 0xFE, 0xE8, 0x44, 0x50, 0x94, 0x58, 0x22, 0x3F, 0x3C,
+	0xBA, 0x52, 0x84, 0xD6, 0x01, 0xEF, 0x8C, 0x62, 0x2B, 0x49, 0x58, 0x8A, 0xD2, 0xE8, 0xBA, 0x22,
+	0x22, 0x20, 0x48, 0x42, 0x2E, 0xBA, 0xDE, 0x08, 0x81, 0x10, 0x88, 0x81, 0x97, 0x8E, 0x3A, 0x22,
+	0x22, 0x20, 0x44, 0x2A, 0xE5, 0x88, 0x8A, 0xEF, 0xA2, 0x10, 0x84, 0x11, 0x02, 0x10, 0xAE, 0xBB,
+	0xCE, 0xBA, 0xDD, 0x84, 0x44, 0x25, 0xE0, 0xAF, 0xBE, 0xCC, 0x3A, 0x21, 0x59, 0x19, 0x00, 0x88,
+	0xBA, 0xFC, 0xEE, 0xB8, 0x10, 0x11, 0x44, 0x14, 0x08, 0xAE, 0xBE, 0xEF, 0x8B, 0x62, 0x21, 0x59,
+	0x40, 0x22, 0x22, 0xEF, 0xCF, 0xAA, 0x88, 0x41, 0x59, 0x64, 0x00, 0xAE, 0xEF, 0xEB, 0xEC, 0xB6,
+	0x05, 0x15, 0x04, 0x12, 0x2F, 0xEB, 0xFA, 0xBB, 0xA5, 0x16, 0x51, 0x90, 0x62, 0xEF, 0xEB, 0xF3,
+	0x2C, 0xA1, 0x59, 0x19, 0x66, 0x06, 0xDC, 0xB3, 0xB3, 0xB2, 0xB7, 0x61, 0x81, 0x14, 0x05, 0x38,
+	0xEB, 0xAF, 0xAB, 0xA2, 0x20, 0x41, 0x04, 0x12, 0x22, 0x22, 0xBA, 0xEF, 0xA2, 0x22, 0x21, 0x01,
+	0x11, 0x02, 0x22, 0xBA, 0xEB, 0xBF, 0x22, 0x21, 0x05, 0x64, 0x01, 0x0A, 0xEF, 0xEA, 0xCF, 0x28,
+	0x89, 0x50, 0x41, 0x22, 0x22, 0x2F, 0xCE, 0x2D, 0x22, 0x22, 0x21, 0x08, 0x42, 0x22, 0x22, 0xE8,
+	0x88, 0xBA, 0x10, 0xBA, 0x20, 0x41, 0x22, 0x22, 0x22, 0x2E, 0x8A, 0xE2, 0x22, 0x20, 0x48, 0x81,
+	0x21, 0x2E, 0x2B, 0x88, 0xAE, 0x2E
 };
 
+/* 2-bit ADPCM, SNR 16.5 dB */
 const u8 sfx_drum_tom_bright[] __attribute__((aligned(4))) = {
-	0x49, 0x56, 0x45, 0x68, 0x99, 0xA9, 0x9B, 0xBB, 0xCC, 0xDC, 0xA8, 0x53, 0x22, 0x23, 0x34, 0x44,
-	0x46, 0x8A, 0xCD, 0xEE, 0xED, 0xDC, 0x9A, 0x76, 0x66, 0x54, 0x43, 0x35, 0x69, 0xCD, 0xEE, 0xEC,
-	0xBB, 0xAA, 0xA9, 0x86, 0x43, 0x34, 0x45, 0x67, 0x88, 0x99, 0xAB, 0xBB, 0xBB, 0xBB, 0x99, 0x87,
-	0x66, 0x66, 0x77, 0x77, 0x87, 0x89, 0x99, 0xA9, 0x87, 0x76, 0x67, 0x77, 0x77, 0x67, 0x78, 0x89,
-	0x99, 0x99, 0x89, 0x98, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x89, 0x99, 0x99, 0x88,
-	0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x88, 0x88, 0x88, 0x89, 0x99, 0x99, 0x88, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x89, 0x99, 0x99, 0x88, 0x89, 0x99, 0x9A, 0x98, 0x77, 0x66, 0x66, 0x77, 0x78,
-	0x89, 0x9A, 0xAA, 0xAB, 0xBB, 0xBA, 0xA9, 0x98, 0x87, 0x77, 0x66, 0x65, 0x66, 0x78, 0x9A, 0xBB,
-	0xBC, 0xBB, 0xBB, 0xAA, 0x98, 0x76, 0x66, 0x55, 0x55, 0x56, 0x67, 0x89, 0x9A, 0xAB, 0xBB, 0xBB,
-	0xBA, 0xA9, 0x88, 0x76, 0x55, 0x44, 0x45, 0x56, 0x67, 0x78, 0x9A, 0xAB, 0xBB, 0xBB, 0xAA, 0x99,
-	0x87, 0x65, 0x55, 0x55, 0x55, 0x55, 0x66, 0x78, 0x9A, 0xBB, 0xBB, 0xBB, 0xBA, 0xA9, 0x87, 0x65,
-	0x44, 0x44, 0x45, 0x56, 0x77, 0x89, 0xAB, 0xBC, 0xCC, 0xBB, 0xAA, 0x98, 0x76, 0x54, 0x44, 0x44,
-	0x45, 0x67, 0x89, 0xAB, 0xCD, 0xDD, 0xDC, 0xCB, 0xA9, 0x76, 0x54, 0x43, 0x33, 0x45, 0x67, 0x89,
-	0xAB, 0xCC, 0xDD, 0xDC, 0xBA, 0x99, 0x87, 0x65, 0x54, 0x44, 0x45, 0x56, 0x78, 0x89, 0xAA, 0xBB,
-	0xCB, 0xCB, 0xBA, 0xA9, 0x88, 0x76, 0x66, 0x56, 0x56, 0x67, 0x77, 0x88, 0x9A, 0xAB, 0xBC, 0xBB,
-	0xAA, 0x99, 0x88, 0x77, 0x66, 0x66, 0x66, 0x77, 0x78, 0x89, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0x99,
-	0x88, 0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x78, 0x89, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x87, 0x76,
-	0x65, 0x55, 0x55, 0x56, 0x67, 0x88, 0x99, 0xAB, 0xBB, 0xBB, 0xA9, 0x88, 0x77, 0x65, 0x55, 0x55,
-	0x55, 0x67, 0x88, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-	0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x87, 0x77, 0x77, 0x78,
-	0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x99,
-	0x99, 0xAA, 0x99, 0x98, 0x88, 0x88, 0x87, 0x77, 0x66
+	0xDF, 0x85, 0x06, 0x16, 0x47, 0xFB, 0x80, 0x18, 0x55, 0x52, 0x33, 0xEE, 0x2E, 0xB1, 0x55, 0x0B,
+	0xAC, 0xBF, 0xE8, 0x15, 0x06, 0x58, 0x8B, 0xFB, 0xC8, 0x48, 0x75, 0x87, 0xB3, 0x02, 0x2C, 0x51,
+	0x2A, 0xDB, 0xDA, 0x88, 0x88, 0x84, 0x10, 0xAE, 0xFA, 0x22, 0x04, 0x42, 0x21, 0x0A, 0xEB, 0x88,
+	0x88, 0x85, 0x0A, 0xE1, 0x01, 0xFC, 0xC8, 0x49, 0x59, 0x21, 0x2B, 0xBF, 0x38, 0xEB, 0x45, 0x40,
+	0x1C, 0xAF, 0xEE, 0xAE, 0x81, 0x15, 0x10, 0x0A, 0xBB, 0xFB, 0xCC, 0x91, 0x91, 0x10, 0x0A, 0xEF,
+	0xEF, 0x22, 0x20, 0x51, 0x50, 0x8A, 0xBB, 0xFE, 0xC8, 0x95, 0x05, 0x49, 0x2E, 0xEF, 0xEB, 0x88,
+	0x15, 0x44, 0x48, 0xBB, 0xFF, 0xAB, 0x25, 0x44, 0x16, 0x4B, 0xEA, 0xFE, 0xB2, 0x15, 0x11, 0x04,
+	0x73, 0x3B, 0xAF, 0x8D, 0x81, 0x05, 0x41, 0x1E, 0xCE, 0xCE, 0xA2, 0x06, 0x51, 0x24, 0x22, 0x2F,
+	0xCE, 0xA8, 0x88, 0x41, 0x50, 0x88, 0xBB, 0xF3, 0xB2, 0x21, 0x44, 0x45, 0x23, 0xFA, 0xEF, 0x88,
+	0x05, 0x46, 0x48, 0x8A, 0xFB, 0xA0, 0x88, 0x88, 0x41, 0x08, 0x8A, 0xE2, 0x2B, 0x84, 0xB8, 0x81,
+	0x10, 0x88, 0x8A, 0xEA, 0xE0, 0x88, 0x12, 0x04, 0x84, 0xF3, 0x8A, 0xB3, 0xC0
 };
 
+/* 4-bit PCM, exact */
 const u8 sfx_drum_clap[] __attribute__((aligned(4))) = {
 	0x49, 0x88, 0x98, 0x9B, 0x44, 0xAE, 0x76, 0xA4, 0x8B, 0xB6, 0x5A, 0x97, 0x7A, 0x87, 0x98, 0x88,
 	0x97, 0x88, 0x88, 0x68, 0x9A, 0x96, 0x79, 0xA7, 0x68, 0x8A, 0x86, 0x58, 0xE9, 0x65, 0x89, 0x99,
@@ -3836,167 +2572,119 @@ const u8 sfx_drum_clap[] __attribute__((aligned(4))) = {
 	0x87, 0x8A, 0x87, 0x77, 0x98, 0x98, 0x88, 0x78, 0xA8
 };
 
+/* 3-bit ADPCM, SNR 10.8 dB */
 const u8 sfx_drum_snare_sidehit[] __attribute__((aligned(4))) = {
-	0x49, 0x62, 0x6D, 0x8C, 0x28, 0xB8, 0x70, 0x7B, 0x8B, 0x98, 0x79, 0x99, 0x89, 0xAC, 0x87, 0xB7,
-	0xB3, 0x69, 0x26, 0x4B, 0x66, 0x58, 0x76, 0xB6, 0x6A, 0xBC, 0x79, 0xAB, 0xA6, 0x88, 0x83, 0x5A,
-	0x96, 0x36, 0xB8, 0x79, 0xAA, 0x8A, 0xA9, 0x99, 0x67, 0x88, 0x86, 0x87, 0x79, 0x98, 0x68
+	0xEF, 0xF4, 0xE8, 0xE4, 0xDB, 0xD1, 0xAA, 0xC8, 0xA0, 0xA5, 0x3F, 0x5E, 0x58, 0x0C, 0x62, 0xB2,
+	0x29, 0x1E, 0x05, 0x4E, 0x08, 0xBC, 0x1D, 0xCB, 0x9A, 0xA5, 0x61, 0x03, 0x11, 0x46, 0xE0, 0x8B,
+	0xD5, 0x0C, 0x6C, 0x80, 0x00
 };
 
+/* 2-bit ADPCM, SNR 13.6 dB */
 const u8 sfx_drum_snare2[] __attribute__((aligned(4))) = {
-	0x49, 0x78, 0x98, 0x9A, 0xAD, 0xDC, 0xB9, 0x98, 0x74, 0x64, 0x15, 0x45, 0x77, 0x8A, 0x9A, 0xCB,
-	0x89, 0x9C, 0xCB, 0xA9, 0x87, 0x76, 0x53, 0x43, 0x34, 0x57, 0x89, 0xAC, 0xED, 0xDC, 0xB9, 0x98,
-	0x74, 0x44, 0x56, 0x86, 0x78, 0xA9, 0xA9, 0x89, 0x99, 0xCC, 0xBC, 0xB9, 0x98, 0x76, 0x44, 0x23,
-	0x45, 0x68, 0x9A, 0xCC, 0xEC, 0xBA, 0x98, 0x76, 0x65, 0x54, 0x46, 0x89, 0x98, 0x77, 0x88, 0x89,
-	0xA9, 0x9A, 0xAA, 0xBB, 0x99, 0x87, 0x65, 0x44, 0x45, 0x78, 0x89, 0x9A, 0xBB, 0xBA, 0x88, 0x87,
-	0x77, 0x77, 0x77, 0x78, 0x77, 0x97, 0x78, 0x87, 0x79, 0x99, 0xA9, 0xAA, 0xA9, 0x99, 0x88, 0x66,
-	0x55, 0x67, 0x78, 0x89, 0x99, 0xAB, 0xA9, 0x87, 0x78, 0x87, 0x87, 0x88, 0x87, 0x88, 0x87, 0x78,
-	0x89, 0x87, 0x99, 0x9A, 0x98, 0x77, 0x77, 0x77, 0x77, 0x78, 0x8A, 0xA9, 0xAA, 0x99, 0x98, 0x87,
-	0x67, 0x87, 0x66, 0x66, 0x88, 0x89, 0x99, 0x9A, 0x9A, 0xA9, 0x98, 0x88, 0x77, 0x66, 0x67, 0x77,
-	0x77, 0x89, 0x99, 0x98, 0x89, 0x98, 0x78, 0x88, 0x88, 0x77, 0x66, 0x66, 0x78, 0x99, 0xAA, 0xAA,
-	0xB9, 0x89, 0x88, 0x76, 0x66, 0x78, 0x78, 0x89, 0x99, 0x99, 0x9A, 0x98, 0x87, 0x88, 0x88, 0x88,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x89, 0xAA, 0x9A, 0xA8, 0x77, 0x78, 0x77, 0x77, 0x78, 0x99,
-	0x98, 0x98, 0x88, 0x88, 0x88, 0x98, 0x89, 0x87, 0x88, 0x87, 0x87, 0x78, 0x77, 0x88, 0x88, 0x89,
-	0x99, 0x99, 0x98, 0x87, 0x77, 0x77, 0x67, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x99, 0x99,
-	0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x88, 0x89, 0x89, 0x9A, 0x98, 0x88, 0x88, 0x88, 0x77, 0x78,
-	0x88, 0x78, 0x88, 0x88, 0x98, 0x88, 0x89, 0x99, 0x98, 0x88, 0x88, 0x77, 0x77, 0x78, 0x88, 0x98,
-	0x98, 0x99, 0x89, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x99, 0x99,
-	0x98, 0x88, 0x77, 0x77, 0x87, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x99, 0x88,
-	0x88, 0x88, 0x87, 0x78, 0x77, 0x88, 0x99, 0x99, 0x99, 0x88, 0x78, 0x87, 0x77, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x87, 0x78, 0x88, 0x78, 0x88, 0x88,
-	0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87, 0x87, 0x88, 0x88, 0x99, 0x88,
-	0x99, 0x98, 0x87, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x78, 0x88, 0x77, 0x88, 0x89, 0x99, 0x99, 0x98, 0x88, 0x88, 0x78, 0x58
+	0xDD, 0x24, 0x53, 0xBB, 0xB3, 0xD8, 0x41, 0x93, 0xC1, 0x2F, 0xB3, 0xB3, 0x05, 0x41, 0x63, 0xBB,
+	0xE8, 0x53, 0x16, 0x39, 0x96, 0x9B, 0xBB, 0xCC, 0x11, 0x14, 0x3B, 0xBB, 0x33, 0x14, 0xAC, 0x01,
+	0x71, 0x86, 0xFB, 0xEA, 0x54, 0x04, 0x4F, 0xCB, 0x28, 0x21, 0xC7, 0x0B, 0x52, 0x66, 0xB3, 0xEF,
+	0xA5, 0x19, 0x25, 0xBE, 0x93, 0x26, 0x36, 0xB1, 0x1F, 0x49, 0xBC, 0x88, 0x81, 0x53, 0x0E, 0xBB,
+	0xD3, 0xAD, 0x49, 0x81, 0xDA, 0xBA, 0xFA, 0x10, 0x85, 0x0B, 0x97, 0xC2, 0x2E, 0xE8, 0x54, 0x4B,
+	0x78, 0xCF, 0x24, 0x91, 0x22, 0x1F, 0xA4, 0x8A, 0xE2, 0x22, 0x06, 0x56, 0x9E, 0xE1, 0xCA, 0x56,
+	0x33, 0x22, 0x07, 0x1F, 0x0A, 0x70, 0xC4, 0x81, 0x22, 0xBB, 0xAA, 0xD4, 0x8A, 0x21, 0xC8, 0x42,
+	0xE8, 0xBA, 0x21, 0x01, 0xD9, 0xB8, 0x2A, 0xE5, 0xAD, 0x20, 0x72, 0x12, 0xB8, 0xAE, 0x21, 0x07,
+	0x66, 0xCB, 0x92, 0x08, 0x8A, 0xB1, 0x20, 0x48, 0xBA, 0xE8, 0x74, 0x87, 0x88, 0x8B, 0x60, 0x6C,
+	0xA2, 0xB1, 0xE4, 0x42, 0xAE, 0xDB, 0x24, 0x22, 0x22, 0x2B, 0x48, 0x81, 0xE2, 0xB1, 0x3D, 0x29,
+	0x78, 0x22, 0x22, 0x13, 0xA2, 0xB7, 0x00, 0x6C, 0x4B, 0xE8, 0x74, 0xA2, 0x06, 0xE0, 0x88, 0x88,
+	0xAD, 0x8E, 0x41, 0x08, 0xBA, 0x2F, 0xD0
 };
 
+/* 2-bit ADPCM, SNR 15.5 dB */
 const u8 sfx_drum_conga[] __attribute__((aligned(4))) = {
-	0x59, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x78, 0x77, 0xAB, 0xA9, 0x7A, 0x9C, 0xC9, 0x85,
-	0x57, 0x88, 0x63, 0x23, 0x48, 0x88, 0x54, 0x68, 0xCE, 0xDD, 0xDC, 0xAA, 0xBD, 0xB8, 0x64, 0x43,
-	0x34, 0x66, 0x65, 0x46, 0x89, 0xAA, 0xAA, 0xAB, 0xDD, 0xCA, 0x89, 0xAA, 0x97, 0x53, 0x21, 0x13,
-	0x57, 0x88, 0x88, 0x9B, 0xDE, 0xDB, 0xA9, 0xAA, 0xA9, 0x76, 0x55, 0x56, 0x76, 0x65, 0x54, 0x45,
-	0x8A, 0xBB, 0xBB, 0xBC, 0xDC, 0xBA, 0x87, 0x66, 0x55, 0x55, 0x44, 0x56, 0x78, 0x88, 0x88, 0xAB,
-	0xBB, 0xBA, 0xAA, 0xBB, 0xA9, 0x76, 0x54, 0x44, 0x55, 0x55, 0x67, 0x9A, 0xBB, 0xAA, 0xAA, 0xBB,
-	0xBA, 0x98, 0x77, 0x77, 0x77, 0x65, 0x55, 0x55, 0x67, 0x88, 0x9A, 0xBC, 0xCC, 0xBA, 0x99, 0x88,
-	0x77, 0x65, 0x55, 0x66, 0x67, 0x77, 0x88, 0x89, 0x99, 0x9A, 0xAB, 0xBB, 0xBA, 0x98, 0x77, 0x66,
-	0x55, 0x55, 0x56, 0x78, 0x99, 0x99, 0xAA, 0xAB, 0xBA, 0x99, 0x98, 0x88, 0x87, 0x76, 0x66, 0x66,
-	0x66, 0x66, 0x78, 0x9A, 0xBB, 0xBA, 0xAA, 0xA9, 0x98, 0x87, 0x76, 0x66, 0x66, 0x66, 0x77, 0x88,
-	0x88, 0x89, 0x9A, 0xAB, 0xBA, 0xAA, 0x98, 0x87, 0x66, 0x55, 0x66, 0x67, 0x77, 0x88, 0x99, 0xAA,
-	0xAA, 0x99, 0x99, 0x99, 0x98, 0x87, 0x77, 0x66, 0x66, 0x66, 0x67, 0x88, 0x99, 0xAA, 0xAA, 0xAA,
-	0x99, 0x98, 0x87, 0x77, 0x76, 0x66, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0xAA, 0xAA, 0xA9, 0x98,
-	0x87, 0x76, 0x66, 0x66, 0x67, 0x77, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x77,
-	0x76, 0x66, 0x66, 0x77, 0x88, 0x99, 0x99, 0xAA, 0xA9, 0x99, 0x98, 0x88, 0x77, 0x77, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x89, 0x99, 0x9A, 0xAA
+	0xD0, 0xA2, 0x22, 0xB8, 0x1D, 0x4B, 0xD1, 0xBB, 0x92, 0xFC, 0x42, 0xF4, 0x5A, 0x2E, 0x4F, 0xEA,
+	0x14, 0xAD, 0x52, 0x0D, 0x4F, 0x86, 0xFB, 0xA1, 0x50, 0x94, 0x5B, 0xA2, 0x7F, 0x89, 0x33, 0xB1,
+	0x56, 0x21, 0x3B, 0xF8, 0xCA, 0xC5, 0x48, 0xD4, 0x0B, 0x86, 0xFF, 0xE2, 0x48, 0x55, 0x68, 0x24,
+	0xBF, 0xCA, 0x3F, 0x29, 0x56, 0x44, 0x8F, 0xCE, 0x8F, 0x84, 0x19, 0x49, 0x01, 0x10, 0xFE, 0xEC,
+	0xE2, 0x54, 0x48, 0x41, 0xBE, 0xB2, 0xBE, 0x88, 0x88, 0x55, 0x0B, 0x8B, 0xF3, 0xA8, 0x88, 0x44,
+	0x01, 0x11, 0x3A, 0xFE, 0xE8, 0x65, 0x25, 0x64, 0xAE, 0x88, 0xBE, 0xAE, 0x22, 0x14, 0x44, 0x2A,
+	0xCF, 0xB2, 0xB8, 0x42, 0x10, 0x19, 0x4A, 0xBB, 0xF3, 0x82, 0x10, 0x50, 0x22, 0x22, 0x2B, 0xAE,
+	0xB8, 0x84, 0x56, 0x04, 0xF2, 0xBA, 0xE2, 0x22, 0x20, 0x41, 0x21, 0x00
 };
 
+/* 2-bit ADPCM, SNR 14.7 dB */
 const u8 sfx_drum_timpani[] __attribute__((aligned(4))) = {
-	0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x52, 0x10, 0x13, 0x45, 0x55, 0x89, 0x9A, 0xBB,
-	0xBB, 0xB9, 0x99, 0x63, 0x46, 0x88, 0x77, 0x99, 0xBC, 0xEF, 0xEC, 0xA9, 0x76, 0x64, 0x33, 0x33,
-	0x21, 0x13, 0x7A, 0xAA, 0xBB, 0xAB, 0xAC, 0xDC, 0xBB, 0xA8, 0x67, 0x75, 0x47, 0x88, 0x9A, 0xA8,
-	0x87, 0x78, 0x87, 0x54, 0x33, 0x57, 0x87, 0x99, 0x9A, 0x98, 0xBC, 0xCC, 0xCC, 0x97, 0x67, 0x77,
-	0x77, 0x76, 0x66, 0x78, 0x9A, 0x8A, 0x97, 0x99, 0x99, 0x68, 0x75, 0x66, 0x65, 0x78, 0x9B, 0xBA,
-	0x9A, 0xBA, 0x9A, 0x98, 0x89, 0x86, 0x66, 0x55, 0x68, 0x88, 0x76, 0x8B, 0xBC, 0xAA, 0x96, 0x44,
-	0x58, 0x75, 0x77, 0x77, 0x88, 0xAC, 0xB9, 0xA9, 0x9A, 0xBA, 0x99, 0x97, 0x76, 0x44, 0x55, 0x66,
-	0x89, 0x76, 0x77, 0x89, 0xA9, 0x89, 0x98, 0x88, 0x88, 0x9A, 0x98, 0x77, 0x89, 0xAB, 0x98, 0x77,
-	0x88, 0x77, 0x76, 0x66, 0x66, 0x56, 0x77, 0x88, 0x89, 0x88, 0xAB, 0xCC, 0xBB, 0xBA, 0x98, 0x78,
-	0x88, 0x77, 0x77, 0x66, 0x56, 0x57, 0x87, 0x66, 0x78, 0x88, 0x9A, 0x98, 0xA9, 0x9A, 0x99, 0x99,
-	0xA9, 0x98, 0x79, 0x88, 0x76, 0x67, 0x77, 0x77, 0x86, 0x57, 0x75, 0x67, 0x66, 0x88, 0x99, 0x89,
-	0x9A, 0xBA, 0xAA, 0xAA, 0xA9, 0x89, 0x89, 0x87, 0x75, 0x55, 0x65, 0x66, 0x45, 0x78, 0x89, 0x8B,
-	0xCA, 0xAB, 0xAA, 0xA9, 0x89, 0x98, 0x77, 0x78, 0x98, 0x77, 0x89, 0x99, 0x97, 0x56, 0x67, 0x77,
-	0x64, 0x46, 0x78, 0x98, 0x78, 0x9A, 0xBB, 0xCC, 0xBB, 0xA8, 0x87, 0x88, 0x76, 0x76, 0x55, 0x66,
-	0x67, 0x77, 0x78, 0x88, 0x8A, 0xA9, 0x98, 0x89, 0xAA, 0x98, 0x88, 0x99, 0xA9, 0x87, 0x78, 0x99,
-	0x88, 0x76, 0x66, 0x77, 0x56, 0x67, 0x77, 0x67, 0x88, 0x99, 0xA9, 0x99, 0xAB, 0xCC, 0xA9, 0x88,
-	0x88, 0x77, 0x78, 0x76, 0x66, 0x66, 0x66, 0x66, 0x77, 0x78, 0x98, 0x89, 0xAA, 0xAA, 0x98, 0x89,
-	0xA9, 0x98, 0x78, 0x77, 0x77, 0x78, 0x89, 0x99, 0x86, 0x67, 0x88, 0x65, 0x44, 0x68, 0x98, 0x78,
-	0x99, 0x9B, 0xBA, 0xAB, 0xBA, 0xBA, 0x76, 0x67, 0x66, 0x65, 0x56, 0x66, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x9A, 0xA9, 0x99, 0x98, 0x88, 0x77, 0x88, 0x99, 0x88, 0x99, 0x88, 0x88, 0x77, 0x66, 0x76,
-	0x75, 0x67, 0x77, 0x76, 0x77, 0x9B, 0xCB, 0xA9, 0xAB, 0xAA, 0xA9, 0x88, 0x88, 0x86, 0x55, 0x66,
-	0x66, 0x56, 0x78, 0x98, 0x88, 0x88, 0x88, 0x89, 0x99, 0x89, 0x99, 0x98, 0x99, 0x99, 0x88, 0x78,
-	0x88, 0x78, 0x89, 0x87, 0x76, 0x67, 0x77, 0x77, 0x77, 0x78, 0x98, 0x88, 0x9A, 0xBB, 0xBA, 0x99,
-	0xA9, 0x98, 0x88, 0x77, 0x66, 0x55, 0x56, 0x77, 0x87, 0x68, 0x98, 0x88, 0x88, 0x98, 0x99, 0x89,
-	0x99, 0x98, 0x88, 0x88, 0x99, 0x88, 0x87, 0x88, 0x88, 0x78, 0x87, 0x56, 0x65, 0x66, 0x78, 0x88,
-	0x88, 0x89, 0xAA, 0xBA, 0xAB, 0xAA, 0x98, 0x78, 0x88, 0x76, 0x66, 0x66, 0x67, 0x66, 0x67, 0x99,
-	0x89, 0x99, 0xAA, 0x88, 0x88, 0x88, 0x98, 0x89, 0x99, 0x99, 0x88, 0x89, 0x98, 0x77, 0x87, 0x88,
-	0x77, 0x66, 0x66, 0x55, 0x67, 0x88, 0x9A, 0x99, 0x9A, 0xAB, 0xAA, 0xA9, 0x98, 0x99, 0x87, 0x77,
-	0x76, 0x55, 0x67, 0x66, 0x77, 0x88, 0x8A, 0xAA, 0x98, 0x88, 0x99, 0x78, 0x99, 0x98, 0x88, 0x88,
-	0x99, 0x98, 0x88, 0x88, 0x88, 0x77, 0x66, 0x77, 0x66, 0x66, 0x67, 0x78, 0x99, 0x99, 0xAB, 0xAA,
-	0xAA, 0xA9, 0x99, 0x88, 0x88, 0x86, 0x55, 0x56, 0x77, 0x66, 0x78, 0x88, 0x89, 0x99, 0x89, 0xA9,
-	0x88, 0x88, 0x88, 0x77, 0x89, 0x99, 0x99, 0x88, 0x89, 0x88, 0x87, 0x76, 0x67, 0x77, 0x56, 0x77,
-	0x76, 0x78, 0x89, 0x99, 0xAA, 0xBB, 0xBB, 0xA8, 0x78, 0x88, 0x88, 0x87, 0x66, 0x66, 0x66, 0x67,
-	0x77, 0x78, 0x99, 0x98, 0x89, 0x99, 0x99, 0x98, 0x77, 0x88, 0x88, 0x89, 0x99, 0x99, 0x98, 0x88,
-	0x77, 0x77, 0x76, 0x66, 0x66, 0x66, 0x67, 0x89, 0x98, 0x89, 0xAA, 0xBA, 0xAA, 0xAA, 0x98, 0x88,
-	0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x67, 0x88, 0x98, 0x89, 0x99, 0x99, 0x99, 0x98, 0x88, 0x88,
-	0x88, 0x89, 0x99, 0x99, 0x88, 0x98, 0x87, 0x77, 0x77, 0x66, 0x77, 0x65, 0x67, 0x87, 0x89, 0x9A,
-	0x9A, 0xAA, 0xBB, 0xAA, 0x99, 0x88, 0x77, 0x77, 0x77, 0x66, 0x67, 0x77, 0x77, 0x77, 0x88, 0x99,
-	0x99, 0x99, 0x98, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x98, 0x78, 0x87, 0x76, 0x66,
-	0x66, 0x66, 0x77, 0x78, 0x89, 0xA9, 0x9A, 0xAA, 0xAA, 0xAA, 0x99, 0x88, 0x77, 0x77, 0x66, 0x56,
-	0x77, 0x77, 0x77, 0x78, 0x88, 0x99, 0x98, 0x99, 0x99, 0x88, 0x99, 0x87, 0x88, 0x88, 0x88, 0x99,
-	0x88, 0x88, 0x99, 0x87, 0x66, 0x66, 0x66, 0x67, 0x67, 0x78, 0x99, 0x89, 0x9A, 0xAA, 0xAA, 0xA9,
-	0x98, 0x88, 0x77, 0x77, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x89, 0x99, 0x99, 0x99, 0x88, 0x89,
-	0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x99, 0x88, 0x77, 0x87, 0x76, 0x66, 0x67, 0x77, 0x78,
-	0x89, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x88, 0x87, 0x77, 0x77, 0x66, 0x67, 0x77, 0x77, 0x77,
-	0x88, 0x88, 0x89, 0x99, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x99, 0x88, 0x88,
-	0x87, 0x66, 0x67, 0x76, 0x66, 0x67, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0xA9, 0x99, 0x88, 0x87, 0x77,
-	0x77, 0x66, 0x67, 0x77, 0x77, 0x88, 0x88, 0x88, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x87, 0x77, 0x77, 0x66, 0x67, 0x77, 0x78, 0x89, 0x99, 0xAA,
-	0xAA, 0xA9, 0x99, 0x98, 0x88, 0x77, 0x77, 0x76, 0x67, 0x77, 0x77, 0x78, 0x88, 0x98, 0x88, 0x99,
-	0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x87, 0x76, 0x66,
-	0x67, 0x77, 0x78, 0x99, 0x89, 0xAA, 0xAA, 0xAA, 0xA9, 0x98, 0x87, 0x77, 0x77, 0x77, 0x77, 0x76,
-	0x77, 0x88, 0x88, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x89, 0x98, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x87, 0x67, 0x76, 0x66, 0x77, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0x99, 0xA9,
-	0x88, 0x77, 0x77, 0x77, 0x76, 0x67, 0x77, 0x77, 0x77, 0x88, 0x99, 0x99, 0x98, 0x88, 0x89, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x66, 0x77, 0x77,
-	0x89, 0x9A, 0xAA, 0xAA, 0xAA, 0x99, 0x88, 0x88, 0x77, 0x76, 0x66, 0x77, 0x77, 0x78, 0x88, 0x88,
-	0x88, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x99, 0x9A, 0xAA, 0xAA, 0x99, 0x98, 0x87, 0x77, 0x77,
-	0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x89, 0x99, 0x99,
-	0x99, 0x9A, 0x99, 0x87, 0x77, 0x77, 0x66, 0x67, 0x77, 0x88, 0x88, 0x89, 0x99, 0x88, 0x88, 0x88,
-	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x77, 0x77,
-	0x77, 0x77, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x87, 0x76, 0x67, 0x77, 0x77, 0x78,
-	0x88, 0x89, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
-	0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x77, 0x77, 0x77, 0x78, 0x89, 0x99, 0x99, 0x99, 0x99, 0x88,
-	0x88, 0x87, 0x77, 0x76, 0x68
+	0xD0, 0xA2, 0x22, 0x0F, 0xFF, 0x04, 0x94, 0x04, 0xAF, 0xFF, 0x10, 0xC6, 0x44, 0xBE, 0xEB, 0xAA,
+	0xF5, 0x52, 0x69, 0x92, 0xEF, 0xCB, 0x94, 0x0B, 0xE9, 0xBF, 0xC4, 0x66, 0x0C, 0x52, 0x7E, 0xC8,
+	0x2B, 0x85, 0x5C, 0xA4, 0xBC, 0xF0, 0xB5, 0x12, 0xC6, 0xCE, 0x9F, 0x8C, 0x52, 0xF5, 0x2A, 0xFE,
+	0x13, 0x02, 0x55, 0xA3, 0x96, 0xCF, 0x3E, 0x66, 0x4B, 0x04, 0x6C, 0xB2, 0x05, 0xEE, 0x51, 0xEA,
+	0x6A, 0xB8, 0xAD, 0x40, 0x1D, 0x16, 0x8E, 0xFC, 0x2C, 0xAF, 0x9D, 0x2C, 0x40, 0x5B, 0x61, 0xE0,
+	0x7B, 0xD8, 0xF0, 0x23, 0x79, 0xB1, 0xC4, 0x0D, 0x96, 0xA2, 0xBC, 0xDB, 0xBA, 0x76, 0xC5, 0x99,
+	0x30, 0xCB, 0x9B, 0xA1, 0x78, 0x58, 0xFC, 0x93, 0xB9, 0x46, 0xC4, 0x66, 0xAF, 0xB0, 0xF3, 0xA4,
+	0x12, 0x10, 0x53, 0xB1, 0x6E, 0x25, 0x3E, 0x96, 0xAF, 0xC6, 0xC1, 0xAD, 0x46, 0x68, 0x54, 0xFC,
+	0x8E, 0x1E, 0x8A, 0x20, 0x41, 0x71, 0x03, 0xF1, 0x33, 0xC8, 0xA1, 0x43, 0xF9, 0x6F, 0x85, 0x29,
+	0x25, 0x31, 0xB7, 0xE0, 0xAB, 0x10, 0x41, 0x22, 0x05, 0x38, 0xBA, 0xE5, 0x6C, 0x6C, 0xAE, 0xE7,
+	0x70, 0x0F, 0x45, 0x6B, 0x1A, 0x3E, 0x2F, 0xE6, 0x2D, 0x53, 0x22, 0x01, 0x3D, 0x2B, 0x4A, 0xF9,
+	0x8C, 0x5E, 0xB9, 0x22, 0x25, 0x72, 0x52, 0x3E, 0x6B, 0x8F, 0xCE, 0x14, 0x79, 0x22, 0x07, 0x69,
+	0x2B, 0x88, 0x4F, 0x36, 0x2D, 0xBC, 0xB6, 0x58, 0x81, 0x47, 0x1C, 0xEC, 0x2F, 0x22, 0x1C, 0xD4,
+	0x98, 0x6F, 0x29, 0x70, 0x22, 0xE1, 0xBE, 0x66, 0xEE, 0x2C, 0x54, 0x4C, 0x91, 0xCB, 0xB6, 0xE8,
+	0xFC, 0x4C, 0x66, 0x52, 0xE8, 0x7C, 0x4B, 0x88, 0x4B, 0x88, 0xAE, 0xE4, 0xE8, 0x11, 0x40, 0x5A,
+	0x2B, 0xAE, 0x2F, 0xE1, 0x6C, 0x42, 0x58, 0xD7, 0x8A, 0x2F, 0x58, 0x2F, 0x1C, 0xBB, 0x1B, 0xC4,
+	0xB4, 0x10, 0x44, 0x3F, 0xC2, 0x8B, 0xE8, 0x81, 0x25, 0x63, 0x92, 0x2B, 0xE4, 0x81, 0x0A, 0xB3,
+	0xCA, 0xB8, 0x88, 0x15, 0x39, 0x66, 0x83, 0xF2, 0xE3, 0xCA, 0x22, 0x56, 0x69, 0x08, 0xAB, 0x82,
+	0x21, 0x0A, 0xE6, 0xF2, 0xAC, 0x6F, 0x46, 0x41, 0xD8, 0x6C, 0xEC, 0xE2, 0x2E, 0x10, 0x88, 0x44,
+	0x0A, 0xB8, 0x1C, 0xA2, 0x04, 0x8F, 0x9B, 0xB8, 0x20, 0x65, 0x17, 0x02, 0x0A, 0xEF, 0xCA, 0xED,
+	0x4A, 0x21, 0x04, 0xB4, 0xAE, 0x5F, 0x02, 0x84, 0xE8, 0x5F, 0xA0, 0xA1, 0xD1, 0x29, 0x10, 0x8B,
+	0xEA, 0xEA, 0xE2, 0x21, 0x09, 0x58, 0x2A, 0xE1, 0x2E, 0x22, 0x06, 0xC6, 0xEC, 0x7B, 0x81, 0x21,
+	0x40, 0x42, 0x22, 0xBE, 0xBA, 0x2E, 0x12, 0x20, 0x48, 0x12, 0xE1, 0xB8, 0x22, 0x21, 0xC6, 0xCA,
+	0xBE, 0x1B, 0x81, 0x44, 0x10, 0x8B, 0xAE, 0xBA, 0x2E, 0x12, 0x04, 0x88, 0x42, 0xE8, 0x88, 0x88,
+	0x88, 0x81, 0xE2, 0xB8, 0xAE, 0x10, 0x11, 0x04, 0x2B, 0x8B, 0xAE, 0x8B, 0x90, 0x81, 0x07, 0x24,
+	0xDB, 0x82, 0x20, 0x78, 0x88, 0x81, 0xEB, 0xB8, 0x12, 0x56, 0xD0, 0xA2, 0xBB, 0xE8, 0x88, 0xAB,
+	0x44, 0x88, 0x81, 0x2E, 0x87, 0x22, 0x21, 0x3A, 0x22, 0x22, 0xBC, 0xB9, 0x41, 0x49, 0x0A, 0xC7,
+	0xEA, 0x88, 0xB9, 0x08, 0x85, 0x02, 0xB8, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0xE8, 0xAC, 0x48,
+	0x51, 0x08, 0xAE, 0xEA, 0xEB, 0x84, 0x21, 0x08, 0x88, 0x1B, 0x82, 0x2A, 0xC4, 0x88, 0x88, 0x8A,
+	0xE2, 0x22, 0x20, 0x44, 0x10, 0xAE, 0xBB, 0xA2, 0x22, 0x04, 0x88, 0x88, 0x88, 0x87, 0x22, 0x22,
+	0x20, 0x78, 0x88, 0xBA, 0x22, 0x21, 0x01, 0x22, 0x21, 0xEF, 0x23, 0xC9, 0x04, 0x21, 0x2E, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x84, 0xE8, 0x88, 0x40, 0x48, 0x88, 0x8A, 0xFB, 0x92, 0x01,
+	0x21, 0x2E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x07, 0x88, 0x8B, 0x86, 0xE0, 0x81, 0x10, 0x88, 0xAE,
+	0x2B, 0xAB, 0x50
 };
 
 /* Sound lookup table */
 const SFXEntry sfx_table[] = {
-	{ sfx_punch, 1114 },  /* SFX_PUNCH */
-	{ sfx_pistol, 2548 },  /* SFX_PISTOL */
-	{ sfx_shotgun, 4264 },  /* SFX_SHOTGUN */
-	{ sfx_shotgun_cock, 2148 },  /* SFX_SHOTGUN_COCK */
-	{ sfx_item_up, 1008 },  /* SFX_ITEM_UP */
-	{ sfx_player_umf, 1754 },  /* SFX_PLAYER_UMF */
-	{ sfx_player_pain, 4586 },  /* SFX_PLAYER_PAIN */
-	{ sfx_player_death, 4976 },  /* SFX_PLAYER_DEATH */
-	{ sfx_possessed_sight1, 2400 },  /* SFX_POSSESSED_SIGHT1 */
-	{ sfx_possessed_death1, 5358 },  /* SFX_POSSESSED_DEATH1 */
-	{ sfx_possessed_pain, 3898 },  /* SFX_POSSESSED_PAIN */
-	{ sfx_possessed_activity, 4868 },  /* SFX_POSSESSED_ACTIVITY */
-	{ sfx_claw_attack, 2886 },  /* SFX_CLAW_ATTACK */
-	{ sfx_projectile, 5838 },  /* SFX_PROJECTILE */
-	{ sfx_projectile_contact, 5274 },  /* SFX_PROJECTILE_CONTACT */
-	{ sfx_imp_sight1, 5390 },  /* SFX_IMP_SIGHT1 */
-	{ sfx_imp_death1, 3210 },  /* SFX_IMP_DEATH1 */
-	{ sfx_imp_activity, 4528 },  /* SFX_IMP_ACTIVITY */
-	{ sfx_pinky_attack, 4222 },  /* SFX_PINKY_ATTACK */
-	{ sfx_pinky_death, 5538 },  /* SFX_PINKY_DEATH */
-	{ sfx_pinky_sight, 5044 },  /* SFX_PINKY_SIGHT */
-	{ sfx_door_open, 6094 },  /* SFX_DOOR_OPEN */
-	{ sfx_door_close, 6004 },  /* SFX_DOOR_CLOSE */
-	{ sfx_switch_on, 2382 },  /* SFX_SWITCH_ON */
-	{ sfx_rocket_launch, 3472 },  /* SFX_ROCKET_LAUNCH */
-	{ sfx_barrel_explode, 6516 },  /* SFX_BARREL_EXPLODE */
-	{ sfx_elevator_stp, 1740 },  /* SFX_ELEVATOR_STP */
-	{ sfx_stone_move, 1266 },  /* SFX_STONE_MOVE */
-	{ sfx_teleport, 5960 },  /* SFX_TELEPORT */
-	{ sfx_drum_kick, 282 },  /* SFX_DRUM_KICK */
-	{ sfx_drum_snare, 634 },  /* SFX_DRUM_SNARE */
-	{ sfx_drum_hihat, 28 },  /* SFX_DRUM_HIHAT */
-	{ sfx_drum_crash, 1466 },  /* SFX_DRUM_CRASH */
-	{ sfx_drum_tom_low, 920 },  /* SFX_DRUM_TOM_LOW */
-	{ sfx_drum_tom_bright, 690 },  /* SFX_DRUM_TOM_BRIGHT */
-	{ sfx_drum_clap, 178 },  /* SFX_DRUM_CLAP */
-	{ sfx_drum_snare_sidehit, 94 },  /* SFX_DRUM_SNARE_SIDEHIT */
-	{ sfx_drum_snare2, 730 },  /* SFX_DRUM_SNARE2 */
-	{ sfx_drum_conga, 494 },  /* SFX_DRUM_CONGA */
-	{ sfx_drum_timpani, 2122 },  /* SFX_DRUM_TIMPANI */
+	{ sfx_punch, 1114, 2 },  /* SFX_PUNCH */
+	{ sfx_pistol, 2548, 3 },  /* SFX_PISTOL */
+	{ sfx_shotgun, 4264, 2 },  /* SFX_SHOTGUN */
+	{ sfx_shotgun_cock, 2148, 3 },  /* SFX_SHOTGUN_COCK */
+	{ sfx_item_up, 1008, 2 },  /* SFX_ITEM_UP */
+	{ sfx_player_umf, 1754, 2 },  /* SFX_PLAYER_UMF */
+	{ sfx_player_pain, 4586, 3 },  /* SFX_PLAYER_PAIN */
+	{ sfx_player_death, 4976, 4 },  /* SFX_PLAYER_DEATH */
+	{ sfx_possessed_sight1, 2400, 2 },  /* SFX_POSSESSED_SIGHT1 */
+	{ sfx_possessed_death1, 5358, 3 },  /* SFX_POSSESSED_DEATH1 */
+	{ sfx_possessed_pain, 3898, 3 },  /* SFX_POSSESSED_PAIN */
+	{ sfx_possessed_activity, 4868, 3 },  /* SFX_POSSESSED_ACTIVITY */
+	{ sfx_claw_attack, 2886, 3 },  /* SFX_CLAW_ATTACK */
+	{ sfx_projectile, 5838, 2 },  /* SFX_PROJECTILE */
+	{ sfx_projectile_contact, 5274, 2 },  /* SFX_PROJECTILE_CONTACT */
+	{ sfx_imp_sight1, 5390, 3 },  /* SFX_IMP_SIGHT1 */
+	{ sfx_imp_death1, 3210, 3 },  /* SFX_IMP_DEATH1 */
+	{ sfx_imp_activity, 4528, 3 },  /* SFX_IMP_ACTIVITY */
+	{ sfx_pinky_attack, 4222, 2 },  /* SFX_PINKY_ATTACK */
+	{ sfx_pinky_death, 5538, 2 },  /* SFX_PINKY_DEATH */
+	{ sfx_pinky_sight, 5044, 2 },  /* SFX_PINKY_SIGHT */
+	{ sfx_door_open, 6094, 3 },  /* SFX_DOOR_OPEN */
+	{ sfx_door_close, 6004, 3 },  /* SFX_DOOR_CLOSE */
+	{ sfx_switch_on, 2382, 2 },  /* SFX_SWITCH_ON */
+	{ sfx_rocket_launch, 3472, 2 },  /* SFX_ROCKET_LAUNCH */
+	{ sfx_barrel_explode, 6516, 2 },  /* SFX_BARREL_EXPLODE */
+	{ sfx_elevator_stp, 1740, 2 },  /* SFX_ELEVATOR_STP */
+	{ sfx_stone_move, 1266, 2 },  /* SFX_STONE_MOVE */
+	{ sfx_teleport, 5960, 3 },  /* SFX_TELEPORT */
+	{ sfx_drum_kick, 282, 2 },  /* SFX_DRUM_KICK */
+	{ sfx_drum_snare, 634, 3 },  /* SFX_DRUM_SNARE */
+	{ sfx_drum_hihat, 28, 4 },  /* SFX_DRUM_HIHAT */
+	{ sfx_drum_crash, 1466, 3 },  /* SFX_DRUM_CRASH */
+	{ sfx_drum_tom_low, 920, 2 },  /* SFX_DRUM_TOM_LOW */
+	{ sfx_drum_tom_bright, 690, 2 },  /* SFX_DRUM_TOM_BRIGHT */
+	{ sfx_drum_clap, 178, 4 },  /* SFX_DRUM_CLAP */
+	{ sfx_drum_snare_sidehit, 94, 3 },  /* SFX_DRUM_SNARE_SIDEHIT */
+	{ sfx_drum_snare2, 730, 2 },  /* SFX_DRUM_SNARE2 */
+	{ sfx_drum_conga, 494, 2 },  /* SFX_DRUM_CONGA */
+	{ sfx_drum_timpani, 2122, 2 },  /* SFX_DRUM_TIMPANI */
 };
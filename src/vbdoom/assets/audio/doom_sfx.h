@@ -48,10 +48,17 @@ enum {
 	SFX_COUNT = 40
 };
 
-/* Sound entry: pointer to packed 4-bit data + sample count */
+/* ADPCM decoder step sizes, must match the encoder */
+#define SFX_ADPCM_STEPS 9
+#define SFX_ADPCM_STEP_TABLE { 6, 8, 11, 16, 22, 32, 45, 64, 90 }
+#define SFX_ADPCM3_STEPS 13
+#define SFX_ADPCM3_STEP_TABLE { 8, 10, 13, 16, 20, 25, 32, 40, 50, 64, 80, 100, 128 }
+
+/* Sound entry: pointer to sample data + sample count + code size */
 typedef struct {
-	const u8 *data;    /* packed nibble pairs */
+	const u8 *data;    /* 2-bit codes, a 3-bit stream or 4-bit nibbles */
 	u16 length;        /* total samples (not bytes) */
+	u8 bits;           /* 2 or 3 (ADPCM), 4 (PCM) */
 } SFXEntry;
 
 /* Lookup table */
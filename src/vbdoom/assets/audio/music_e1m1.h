@@ -2,377 +2,121 @@
 #ifndef __MUSIC_E1M1_H__
 #define __MUSIC_E1M1_H__
 
-#define MUSIC_E1M1_NOTE_COUNT  846
-#define MUSIC_E1M1_HAS_ARP     0
+#define MUSIC_E1M1_LENGTH_MS  112700
 
-static const int music_e1m1_melody[846] = {
-	0x0000,0xB3D0,0xB3B0,0xB3D0,0xB3D0,0x0000,0x0000,0xB380,0xB380,0xB380,0xB400,0xB400,
-	0xB3F0,0xB3D0,0xB3D0,0xB3F0,0xB3F0,0xB3D0,0xB3B0,0xB3B0,0xB3B0,0xB3D0,0xB3B0,0xB3D0,
-	0xB3D0,0x0000,0x0000,0xB490,0xB490,0xB490,0xB440,0xB440,0xB420,0xB400,0xB400,0xB420,
-	0xB420,0xB400,0xB3F0,0xB3F0,0xB3F0,0xB400,0xB3F0,0xB3D0,0xB3D0,0x0000,0x0000,0xB490,
-	0xB490,0xB490,0xB400,0x0000,0xB400,0xB3F0,0xB3F0,0xB3F0,0xB400,0xB400,0xB420,0xB420,
-	0xB420,0xB400,0xB3F0,0xB3D0,0xB3D0,0x0000,0x0000,0xB490,0xB490,0xB490,0xB400,0x0000,
-	0xB400,0xB3F0,0xB3F0,0xB3F0,0xB400,0xB400,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB420,0xB440,0xB440,0xB440,0xB440,0xB440,0x0000,0x0000,0xB450,0x0000,0x0000,0xB440,
-	0xB440,0xB440,0xB440,0xB440,0x0000,0x0000,0xB420,0xB420,0xB420,0xB420,0xB440,0xB440,
-	0xB440,0xB440,0xB440,0x0000,0x0000,0xB450,0x0000,0x0000,0xB440,0xB440,0x0000,0x0000,
-	0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,0xD400,0xD400,
-	0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,
-	0xD400,0xD400,0xD420,0x0000,0xD420,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,
-	0xD400,0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,
-	0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,0xD420,0xD420,
-	0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0xD420,0xD420,0xD420,0xD420,0xD380,0xD3B0,
-	0xD3B0,0xD3D0,0xD3D0,0xD400,0xD3D0,0xD3B0,0xD3B0,0xD3D0,0xD360,0xD360,0x0000,0x0000,
-	0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD3D0,0xD3D0,0xD3B0,0xD3B0,0xD3D0,
-	0xD3D0,0xD420,0xD420,0xD420,0xD420,0xD400,0xD400,0xD3D0,0xD3D0,0xD3D0,0xD3D0,0xD3D0,
-	0x0000,0xD3D0,0xD3D0,0xD3F0,0xD3F0,0xD400,0xD400,0xD3F0,0xD3F0,0xD3D0,0x0000,0xD3D0,
-	0xD3F0,0xD3F0,0xD3D0,0xD400,0xD400,0xD3F0,0xD3F0,0xD3D0,0x0000,0xD3D0,0xD3F0,0xD3F0,
-	0xD400,0xD400,0xD420,0xD420,0xD420,0xD420,0x0000,0xD3B0,0xD3F0,0xD3F0,0xD3B0,0xD470,
-	0xD470,0xD470,0xD470,0x0000,0xD440,0xD490,0xD490,0xD470,0xD440,0xD440,0xD490,0xD490,
-	0xD490,0xD490,0xD490,0xD490,0x0000,0x0000,0xD490,0xD4C0,0xD500,0xD4C0,0xD4C0,0xD490,
-	0x0000,0xD490,0xD470,0xD470,0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0x0000,
-	0x0000,0xD490,0xD4C0,0xD500,0xD4C0,0xD4C0,0xD490,0x0000,0xD490,0xD470,0xD470,0xD490,
-	0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0x0000,0x0000,0xD490,0xD4C0,0xD500,0xD4C0,
-	0xD4C0,0xD490,0x0000,0xD490,0xD470,0xD470,0xD4B0,0xD4B0,0xD4B0,0xD4B0,0xD4B0,0xD4B0,
-	0x0000,0xD4C0,0x0000,0x0000,0xD4E0,0xD4E0,0x0000,0xD530,0xD530,0xD530,0x0000,0xD440,
-	0xD470,0xD470,0xD470,0xD470,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,
-	0xD500,0xD4C0,0xD490,0xD490,0xD550,0xD550,0xD550,0xD550,0xD550,0x0000,0x0000,0xD530,
-	0xD550,0xD530,0xD530,0xD530,0xD530,0x0000,0xD500,0xD530,0xD530,0xD530,0xD530,0xD550,
-	0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,0xD400,
-	0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,0xD420,0xD420,0x0000,0xD400,
-	0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,
-	0xD400,0xD400,0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,
-	0xD420,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,0xD420,
-	0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0xD420,0xD420,0xD420,0xD420,0xD380,
-	0xD3B0,0xD3B0,0xD3D0,0xD3D0,0xD400,0xD3D0,0xD3B0,0xD3B0,0xD3D0,0xD360,0xD360,0x0000,
-	0x0000,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD3D0,0xD3D0,0xD3B0,0xD3B0,
-	0xD3D0,0xD3D0,0xD420,0xD420,0xD420,0xD420,0xD400,0xD400,0xD3D0,0xD3D0,0xD3D0,0xD3D0,
-	0xD3D0,0x0000,0xD3D0,0xD3D0,0xD3F0,0xD3F0,0xD400,0xD400,0xD3F0,0xD3F0,0xD3D0,0x0000,
-	0xD3D0,0xD3F0,0xD3F0,0xD3D0,0xD400,0xD400,0xD3F0,0xD3F0,0xD3D0,0x0000,0xD3D0,0xD3F0,
-	0xD3F0,0xD400,0xD400,0xD420,0xD420,0xD420,0xD420,0x0000,0xD3B0,0xD3F0,0xD3F0,0xD3B0,
-	0xD470,0xD470,0xD470,0xD470,0x0000,0xD440,0xD490,0xD490,0xD470,0xD440,0xD440,0xD490,
-	0xD490,0xD490,0xD490,0xD490,0xD490,0x0000,0x0000,0xD490,0xD4C0,0xD500,0xD4C0,0xD4C0,
-	0xD490,0x0000,0xD490,0xD470,0xD470,0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,
-	0x0000,0x0000,0xD490,0xD4C0,0xD500,0xD4C0,0xD4C0,0xD490,0x0000,0xD490,0xD470,0xD470,
-	0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0xD490,0x0000,0x0000,0xD490,0xD4C0,0xD500,
-	0xD4C0,0xD4C0,0xD490,0x0000,0xD490,0xD470,0xD470,0xD4B0,0xD4B0,0xD4B0,0xD4B0,0xD4B0,
-	0xD4B0,0x0000,0xD4C0,0x0000,0x0000,0xD4E0,0xD4E0,0x0000,0xD530,0xD530,0xD530,0x0000,
-	0xD440,0xD470,0xD470,0xD470,0xD470,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD490,
-	0xD500,0xD500,0xD4C0,0xD490,0xD490,0xD550,0xD550,0xD550,0xD550,0xD550,0x0000,0x0000,
-	0xD530,0xD550,0xD530,0xD530,0xD530,0xD530,0x0000,0xD500,0xD530,0xD530,0xD530,0xD530,
-	0xD550,0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,
-	0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,0xD420,0xD420,0x0000,
-	0xD400,0xD400,0xD400,0xD400,0xD420,0x0000,0xD420,0xD400,0xD400,0xD400,0xD400,0xD400,
-	0xD400,0xD400,0xD400,0x0000,0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,
-	0x0000,0xD420,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0xD400,0x0000,
-	0xD420,0xD420,0x0000,0xD400,0xD400,0xD400,0xD400,0xD420,0xD420,0xD420,0xD420,0xD420,
-	0xD380,0xD3B0,0xD3B0,0xD3D0,0xD3D0,0xD3D0
+static const unsigned char music_e1m1_melody[662] = {
+	0x00,0x81,0xF4,0x8B,0x3D,0x80,0xA7,0x3B,0x80,0xA7,0x3D,0x80,0xA7,0x00,0x81,0x4E,
+	0x38,0x81,0x4E,0x40,0x81,0x4E,0x3F,0x80,0xA7,0x3D,0x80,0xA7,0x3F,0x81,0x4E,0x3D,
+	0x80,0xA7,0x3B,0x81,0x4E,0x3D,0x80,0xA7,0xA0,0x07,0x00,0x03,0x49,0x81,0x4E,0x44,
+	0x81,0x4E,0x42,0x80,0xA7,0x40,0x80,0xA7,0x42,0x81,0x4E,0x40,0x80,0xA7,0x3F,0x81,
+	0x4E,0x40,0x80,0xA7,0xA0,0x16,0x00,0x02,0x00,0x81,0x4E,0x49,0x81,0x4E,0x40,0x80,
+	0xA7,0x00,0x80,0xA7,0xA0,0x3B,0x00,0x02,0x40,0x81,0x4E,0xA0,0x38,0x00,0x02,0xA0,
+	0x16,0x00,0x02,0xA0,0x48,0x00,0x04,0xA0,0x3B,0x00,0x02,0x40,0x81,0x4E,0x42,0x83,
+	0x43,0x44,0x82,0x9C,0x00,0x81,0x4E,0x45,0x80,0xA7,0x00,0x80,0xA7,0x44,0x82,0x9C,
+	0x00,0x80,0xA7,0x42,0x81,0xF5,0xA0,0x71,0x00,0x05,0x00,0x81,0xF5,0x8D,0x42,0x80,
+	0xA7,0x00,0x80,0xA7,0x40,0x81,0xF5,0x42,0x80,0xA7,0x00,0x80,0xA7,0x42,0x80,0xA7,
+	0x40,0x83,0xEA,0x00,0x81,0x4E,0xA0,0x97,0x00,0x02,0xA0,0x94,0x00,0x06,0xA0,0x97,
+	0x00,0x02,0xA0,0x94,0x00,0x04,0x40,0x83,0xEB,0x00,0x81,0x4D,0xA0,0x97,0x00,0x02,
+	0x40,0x81,0xF5,0x42,0x83,0xEA,0x38,0x80,0xA7,0x3B,0x80,0xA7,0x3D,0x80,0xA7,0x40,
+	0x80,0xA7,0x3D,0x80,0xA7,0xA0,0xC9,0x00,0x02,0x36,0x81,0x4E,0x00,0x80,0xA7,0x40,
+	0x83,0x96,0x3D,0x80,0xFA,0xA0,0xC9,0x00,0x02,0x42,0x83,0xEA,0x40,0x80,0xA7,0x3D,
+	0x83,0xEA,0x00,0x80,0xA7,0x3D,0x80,0xA7,0x3F,0x80,0xA7,0x40,0x81,0x4E,0x3F,0x80,
+	0xA7,0x3D,0x80,0xA7,0xA0,0xF2,0x00,0x03,0x3D,0x80,0xA7,0xA0,0xFB,0x00,0x03,0xA0,
+	0xF2,0x00,0x03,0x40,0x80,0xA7,0x42,0x82,0x9C,0x00,0x80,0xA7,0x3B,0x80,0xA7,0x3F,
+	0x80,0xA7,0x3B,0x80,0xA7,0x47,0x82,0x9C,0x00,0x80,0xA7,0x44,0x80,0xA6,0x49,0x54,
+	0x47,0x53,0x44,0x80,0xA7,0x49,0x83,0xEA,0x00,0x80,0xA7,0x49,0x80,0xA7,0x4C,0x80,
+	0xA7,0x50,0x80,0xA7,0x4C,0x80,0xA7,0x49,0x80,0xA7,0xA0,0x38,0x01,0x02,0x47,0x80,
+	0xA7,0x49,0x84,0x91,0xA0,0x38,0x01,0x06,0xA0,0x38,0x01,0x02,0xA0,0x4E,0x01,0x02,
+	0xA0,0x38,0x01,0x06,0xA0,0x38,0x01,0x02,0x47,0x80,0xA7,0x4B,0x83,0x43,0x00,0x80,
+	0xA7,0x4C,0x80,0xA7,0x00,0x80,0xA7,0x4E,0x81,0x4E,0x00,0x80,0xA7,0x53,0x81,0x4E,
+	0x00,0x80,0xA7,0x44,0x80,0xA7,0x47,0x81,0x4E,0x49,0x81,0x4E,0x50,0x54,0x4C,0x53,
+	0x49,0x81,0xF4,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0x50,0x54,0x4C,0x53,0x49,
+	0x81,0xF5,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x9B,
+	0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0x50,0x54,
+	0x4C,0x53,0x49,0x80,0xA7,0x55,0x83,0xEA,0x00,0x80,0xA7,0x53,0x53,0x55,0x53,0x53,
+	0x82,0x9C,0x00,0x80,0xA7,0x50,0x80,0xA7,0x53,0x81,0x4E,0x55,0x80,0xA7,0xA0,0x9A,
+	0x00,0x02,0xA0,0x91,0x00,0x07,0xA0,0x97,0x00,0x02,0xA0,0x94,0x00,0x06,0xA0,0x97,
+	0x00,0x02,0xA0,0x94,0x00,0x04,0xA0,0xB6,0x00,0x02,0xA0,0x97,0x00,0x02,0xA0,0xC0,
+	0x00,0x07,0xA0,0xC9,0x00,0x02,0xA0,0xD9,0x00,0x04,0xA0,0xC9,0x00,0x02,0xA0,0xE9,
+	0x00,0x09,0xA0,0xF2,0x00,0x03,0x3D,0x80,0xA7,0xA0,0xFB,0x00,0x03,0xA0,0xF2,0x00,
+	0x03,0xA0,0x13,0x01,0x13,0xA0,0x38,0x01,0x02,0xA0,0x4E,0x01,0x02,0xA0,0x38,0x01,
+	0x06,0xA0,0x38,0x01,0x02,0xA0,0x4E,0x01,0x02,0xA0,0x38,0x01,0x06,0xA0,0x38,0x01,
+	0x02,0xA0,0x68,0x01,0x0F,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x9B,0x01,
+	0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x9B,0x01,
+	0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0x8C,0x01,0x03,0xA0,0xBE,0x01,
+	0x0C,0xA0,0x9A,0x00,0x02,0xA0,0x91,0x00,0x07,0xA0,0x97,0x00,0x02,0xA0,0x94,0x00,
+	0x06,0xA0,0x97,0x00,0x02,0xA0,0x94,0x00,0x04,0xA0,0xB6,0x00,0x02,0xA0,0x97,0x00,
+	0x02,0xA0,0xC0,0x00,0x05,0xFF
 };
 
-static const int music_e1m1_bass[846] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE2F0,0x0000,
-	0x0000,0xE2F0,0x0000,0xE2F0,0x0000,0x0000,0xE2F0,0x0000,0xE2F0,0x0000,0x0000,0xE2F0,
-	0x0000,0xE2F0,0x0000,0x0000,0xE2F0,0xE2F0,0x0000,0xE2F0,0x0000,0x0000,0xE2F0,0x0000,
-	0xE2F0,0x0000,0x0000,0xE2F0,0x0000,0xE2F0,0x0000,0x0000,0xE2F0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+static const unsigned char music_e1m1_bass[71] = {
+	0x00,0xAC,0x5B,0x8E,0x2F,0x80,0xA7,0x00,0x80,0xA7,0x2F,0x80,0xA7,0xA0,0x07,0x00,
+	0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,
+	0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,
+	0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,0x07,0x00,0x02,0x00,0xFF,0xDA,
+	0x00,0xFF,0xD0,0x00,0xFA,0x9A,0xFF
 };
 
-static const int music_e1m1_chords[846] = {
-	0x0000,0xF3D0,0xF3B0,0xF3D0,0xF3D0,0x0000,0x0000,0xF380,0x0000,0x0000,0xF400,0xF3D0,
-	0xF440,0xF420,0xF420,0xF3D0,0xF420,0xF3D0,0xF400,0xF400,0xF3F0,0xF3D0,0xF3B0,0xF3D0,
-	0xF3D0,0x0000,0x0000,0xF380,0x0000,0x0000,0xF440,0xF420,0xF490,0xF470,0xF470,0xF440,
-	0xF470,0xF460,0xF420,0xF420,0x0000,0xF450,0xF440,0xF420,0xF420,0x0000,0x0000,0xF450,
-	0x0000,0x0000,0xF450,0x0000,0xF440,0xF420,0xF420,0x0000,0xF400,0x0000,0xF420,0xF420,
-	0x0000,0xF450,0xF440,0xF420,0xF420,0x0000,0x0000,0xF450,0x0000,0x0000,0xF450,0x0000,
-	0xF440,0xF420,0xF420,0x0000,0xF400,0x0000,0xF420,0xF420,0x0000,0xF470,0xF2F0,0x0000,
-	0x0000,0xF440,0x0000,0xF2F0,0x0000,0x0000,0xF2F0,0x0000,0xF450,0x0000,0x0000,0xF440,
-	0x0000,0xF2F0,0x0000,0x0000,0xF2F0,0xF2F0,0xF420,0xF2F0,0x0000,0x0000,0xF440,0x0000,
-	0xF2F0,0x0000,0x0000,0xF2F0,0x0000,0xF450,0x0000,0x0000,0xF440,0x0000,0x0000,0x0000,
-	0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,0xF3D0,0xF3D0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,
-	0x0000,0x0000,0xF3F0,0x0000,0xF3F0,0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,
-	0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3F0,0xF3F0,
-	0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF310,0xF340,0xF2C0,0xF2C0,0xF2F0,0xF2A0,0xF2C0,0x0000,0x0000,
-	0x0000,0xF310,0xF340,0xF2C0,0xF2C0,0xF2F0,0xF2A0,0xF2A0,0xF2C0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF2F0,0xF2F0,0xF2D0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF310,0xF330,0xF330,0xF340,0x0000,0xF330,
-	0xF310,0xF310,0x0000,0xF380,0x0000,0xF360,0xF360,0xF340,0x0000,0xF340,0xF360,0xF360,
-	0xF380,0xF380,0xF3B0,0x0000,0x0000,0x0000,0x0000,0xF380,0xF3B0,0xF3B0,0xF380,0xF440,
-	0x0000,0x0000,0x0000,0x0000,0xF380,0xF3D0,0xF3D0,0xF3B0,0xF380,0xF380,0xF400,0xF3F0,
-	0xF3F0,0xF400,0x0000,0xF400,0xF3F0,0xF3F0,0xF380,0xF490,0xF4C0,0xF490,0xF490,0xF440,
-	0x0000,0xF440,0xF420,0xF420,0xF450,0xF450,0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF450,0xF490,0xF4C0,0xF490,0xF490,0xF450,0x0000,0xF450,0xF440,0xF440,0xF450,
-	0xF450,0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF490,0xF4C0,0xF490,
-	0xF490,0xF450,0x0000,0xF450,0xF440,0xF440,0xF470,0xF470,0xF470,0x0000,0x0000,0x0000,
-	0x0000,0xF490,0x0000,0x0000,0xF4B0,0x0000,0x0000,0xF4E0,0xF4E0,0x0000,0x0000,0xF3F0,
-	0xF420,0xF420,0x0000,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0xF440,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0xF440,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,
-	0xF4C0,0xF490,0xF440,0xF440,0xF500,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF4E0,
-	0xF500,0xF4E0,0x0000,0x0000,0x0000,0x0000,0xF4B0,0xF4E0,0xF4E0,0x0000,0x0000,0xF500,
-	0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,0xF3D0,
-	0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,
-	0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,
-	0xF3F0,0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3F0,
-	0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF310,0xF340,0xF2C0,0xF2C0,0xF2F0,0xF2A0,0xF2C0,0x0000,
-	0x0000,0x0000,0xF310,0xF340,0xF2C0,0xF2C0,0xF2F0,0xF2A0,0xF2A0,0xF2C0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2F0,0xF2F0,0xF2D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF310,0xF330,0xF330,0xF340,0x0000,
-	0xF330,0xF310,0xF310,0x0000,0xF380,0x0000,0xF360,0xF360,0xF340,0x0000,0xF340,0xF360,
-	0xF360,0xF380,0xF380,0xF3B0,0x0000,0x0000,0x0000,0x0000,0xF380,0xF3B0,0xF3B0,0xF380,
-	0xF440,0x0000,0x0000,0x0000,0x0000,0xF380,0xF3D0,0xF3D0,0xF3B0,0xF380,0xF380,0xF400,
-	0xF3F0,0xF3F0,0xF400,0x0000,0xF400,0xF3F0,0xF3F0,0xF380,0xF490,0xF4C0,0xF490,0xF490,
-	0xF440,0x0000,0xF440,0xF420,0xF420,0xF450,0xF450,0xF450,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF450,0xF490,0xF4C0,0xF490,0xF490,0xF450,0x0000,0xF450,0xF440,0xF440,
-	0xF450,0xF450,0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF490,0xF4C0,
-	0xF490,0xF490,0xF450,0x0000,0xF450,0xF440,0xF440,0xF470,0xF470,0xF470,0x0000,0x0000,
-	0x0000,0x0000,0xF490,0x0000,0x0000,0xF4B0,0x0000,0x0000,0xF4E0,0xF4E0,0x0000,0x0000,
-	0xF3F0,0xF420,0xF420,0x0000,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0xF440,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0xF440,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,0xF4C0,0xF4C0,0xF490,0xF440,0x0000,0xF440,
-	0xF4C0,0xF4C0,0xF490,0xF440,0xF440,0xF500,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xF4E0,0xF500,0xF4E0,0x0000,0x0000,0x0000,0x0000,0xF4B0,0xF4E0,0xF4E0,0x0000,0x0000,
-	0xF500,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,
-	0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,
-	0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0xF3F0,0xF3D0,0xF3D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,
-	0x0000,0xF3F0,0xF3D0,0xF3D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xF3F0,0xF3F0,0x0000,0xF3D0,0x0000,0x0000,0x0000,0xF3F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-static const int music_e1m1_drums[846] = {
-	0x0000,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001D,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,
-	0x0020,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x001C,0x0024,0x001D,0x0021,
-	0x0020,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x0021,0x0020,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,
-	0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,0x001D,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,
-	0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x001C,0x0024,0x001D,
-	0x0021,0x0020,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,
-	0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x0021,0x0020,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,
-	0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,
-	0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x0021,0x0020,0x001C,0x001C,0x0024,0x001D,0x001C,0x0024,0x001D,
-	0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001C,0x001C,0x0024,0x001D,0x0021,0x0020,
-	0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,
-	0x001D,0x0021,0x0020,0x001C,0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,
-	0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x0021,0x0020,0x001C,0x001C,
-	0x0024,0x001D,0x001D,0x001C,0x001C,0x0024,0x001D,0x001D,0x001C,0x0024,0x001D,0x001C,
-	0x001C,0x0024,0x001D,0x0021,0x0020,0x0000
-};
-
-static const unsigned short music_e1m1_timing[846] = {
-	  500,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,
-	  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,
-	  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,
-	    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,
-	  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,
-	  167,  167,    1,  166,    1,  166,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  501,  167,  334,
-	    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	  167,  334,    1,  166,    1,  166,  334,    1,  166,  167,  167,  167,
-	    1,  166,  167,  167,  167,    1,  166,  167,  334,    1,  166,    1,
-	  166,  334,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,
-	    1,  166,  167,  334,    1,  166,    1,  166,    1,  333,    1,  166,
-	  167,  167,  167,    1,  166,  167,  334,    1,  333,  167,  167,    1,
-	  166,    1,  166,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	  167,  167,  167,    1,  166,  167,   83,   83,  167,    1,  166,    1,
-	  166,  334,    1,  333,  334,    1,  166,  167,  334,    1,  333,  167,
-	  167,    1,  166,    1,  166,  167,  167,    1,  166,  167,  167,  167,
-	    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	    1,  166,  167,  167,    1,  333,  167,  167,    1,  166,  167,  167,
-	  167,    1,  333,  167,  166,    1,   83,   83,    1,  166,  334,    1,
-	  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,
-	  167,  167,    1,  166,    1,  166,  167,  167,    1,  333,  334,    1,
-	  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,    1,
-	  166,  167,  167,    1,  333,  334,    1,  166,  167,  167,  167,    1,
-	  166,  167,  167,  167,    1,  166,    1,  166,  167,  167,    1,  333,
-	  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,
-	    1,  166,    1,  166,  334,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,    1,  166,  334,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,    1,  166,  334,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,    1,
-	   83,   83,    1,  166,  167,  167,    1,  333,  334,    1,  166,   83,
-	   83,  167,  167,    1,  333,  167,  167,    1,  166,    1,  166,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,
-	  166,  167,  334,    1,  166,    1,  166,  334,    1,  166,  167,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  334,    1,  166,
-	    1,  166,  334,    1,  166,  167,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,  167,  334,    1,  166,    1,  166,    1,  333,    1,
-	  166,  167,  167,  167,    1,  166,  167,  334,    1,  333,  167,  167,
-	    1,  166,    1,  166,  167,  167,    1,  166,  167,  167,  167,    1,
-	  166,  167,  167,  167,    1,  166,  167,   83,   83,  167,    1,  166,
-	    1,  166,  334,    1,  333,  334,    1,  166,  167,  334,    1,  333,
-	  167,  167,    1,  166,    1,  166,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,
-	  166,    1,  166,  167,  167,    1,  333,  167,  167,    1,  166,  167,
-	  167,  167,    1,  333,  167,  166,    1,   83,   83,    1,  166,  334,
-	    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	  167,  167,  167,    1,  166,    1,  166,  167,  167,    1,  333,  334,
-	    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,    1,  166,
-	    1,  166,  167,  167,    1,  333,  334,    1,  166,  167,  167,  167,
-	    1,  166,  167,  167,  167,    1,  166,    1,  166,  167,  167,    1,
-	  333,  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,
-	  167,    1,  166,    1,  166,  334,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,    1,  166,  334,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,    1,  166,  334,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,  166,  167,  167,    1,   83,   83,  166,  167,  167,
-	    1,   83,   83,    1,  166,  167,  167,    1,  333,  334,    1,  166,
-	   83,   83,  167,  167,    1,  333,  167,  167,    1,  166,    1,  166,
-	  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  167,  167,
-	    1,  166,  167,  334,    1,  166,    1,  166,  334,    1,  166,  167,
-	  167,  167,    1,  166,  167,  167,  167,    1,  166,  167,  334,    1,
-	  166,    1,  166,  334,    1,  166,  167,  167,  167,    1,  166,  167,
-	  167,  167,    1,  166,  167,  334,    1,  166,    1,  166,    1,  333,
-	    1,  166,  167,  167,  167,    1,  166,  167,  334,    1,  333,  167,
-	  167,    1,  166,    1,   83,   83
+static const unsigned char music_e1m1_chords[938] = {
+	0x00,0x81,0xF4,0x8F,0x3D,0x80,0xA7,0x3B,0x80,0xA7,0x3D,0x80,0xA7,0x00,0x81,0x4E,
+	0x38,0x80,0xA7,0x00,0x80,0xA7,0x40,0x80,0xA7,0x3D,0x80,0xA7,0x44,0x80,0xA7,0x42,
+	0x80,0xA7,0x3D,0x80,0xA7,0xA0,0x1F,0x00,0x02,0x40,0x80,0xA7,0x3F,0x80,0xA7,0x3D,
+	0x80,0xA7,0xA0,0x07,0x00,0x05,0xA0,0x1C,0x00,0x02,0x49,0x80,0xA7,0x47,0x80,0xA7,
+	0x44,0x80,0xA7,0x47,0x80,0xA7,0x46,0x80,0xA7,0x42,0x80,0xA7,0x00,0x80,0xA7,0x45,
+	0x80,0xA7,0xA0,0x1C,0x00,0x02,0x00,0x81,0x4E,0x45,0x80,0xA7,0xA0,0x4C,0x00,0x02,
+	0x00,0x80,0xA7,0xA0,0x1C,0x00,0x02,0xA0,0x13,0x00,0x02,0x00,0x80,0xA7,0xA0,0x49,
+	0x00,0x03,0xA0,0x1C,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,0x4C,0x00,0x02,0x00,0x80,
+	0xA7,0xA0,0x1C,0x00,0x02,0xA0,0x13,0x00,0x02,0x00,0x80,0xA7,0xA0,0x49,0x00,0x02,
+	0x47,0x80,0xA7,0x2F,0x80,0xA7,0x00,0x80,0xA7,0x44,0x80,0xA7,0x00,0x80,0xA7,0xA0,
+	0x93,0x00,0x02,0xA0,0x93,0x00,0x02,0x45,0x80,0xA7,0xA0,0x96,0x00,0x03,0xA0,0x93,
+	0x00,0x02,0x2F,0x80,0xA7,0x42,0x80,0xA7,0xA0,0x93,0x00,0x04,0xA0,0x93,0x00,0x02,
+	0xA0,0x93,0x00,0x02,0x45,0x80,0xA7,0xA0,0x96,0x00,0x02,0x00,0x83,0xEA,0x3F,0x80,
+	0xA7,0x00,0x80,0xA7,0xA0,0x0A,0x00,0x02,0xA0,0xCE,0x00,0x02,0xA0,0x2C,0x00,0x02,
+	0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0xCE,0x00,0x02,0xA0,
+	0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0xCE,
+	0x00,0x02,0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,
+	0x02,0x3F,0x80,0xA7,0x00,0x85,0x38,0x31,0x80,0xA7,0x34,0x80,0xA7,0x2C,0x80,0xA7,
+	0x2F,0x80,0xA7,0x2A,0x80,0xA7,0x2C,0x80,0xA7,0x00,0x81,0x4E,0xA0,0x17,0x01,0x04,
+	0x2A,0x80,0xA6,0x2C,0x80,0xA7,0x00,0x85,0x38,0x2F,0x80,0xA7,0x2D,0x80,0xA7,0x00,
+	0x85,0xDF,0x31,0x80,0xA7,0x33,0x80,0xA7,0x34,0x80,0xA7,0x00,0x80,0xA7,0x33,0x80,
+	0xA7,0x31,0x80,0xA7,0x00,0x80,0xA7,0xA0,0x10,0x00,0x02,0x36,0x80,0xA7,0xA0,0x48,
+	0x01,0x02,0x34,0x80,0xA7,0x36,0x80,0xA7,0x38,0x80,0xA7,0x3B,0x80,0xA7,0x00,0x82,
+	0x9C,0xA0,0x68,0x01,0x02,0x38,0x80,0xA7,0x44,0x80,0xA7,0x00,0x82,0x9C,0x38,0x80,
+	0xA6,0x3D,0x54,0x3B,0x53,0x38,0x80,0xA7,0x40,0x81,0x4E,0x3F,0x80,0xA7,0x40,0x80,
+	0xA7,0xA0,0x13,0x00,0x02,0x3F,0x80,0xA7,0x38,0x80,0xA7,0x49,0x80,0xA7,0x4C,0x80,
+	0xA7,0x49,0x80,0xA7,0xA0,0x99,0x00,0x02,0xA0,0x1C,0x00,0x02,0x45,0x81,0x4E,0x00,
+	0x83,0xEA,0x45,0x80,0xA7,0xA0,0x9B,0x01,0x03,0x45,0x80,0xA7,0xA0,0x4C,0x00,0x02,
+	0x44,0x80,0xA7,0xA0,0xAC,0x01,0x03,0xA0,0x9B,0x01,0x03,0x45,0x80,0xA7,0xA0,0x4C,
+	0x00,0x02,0x44,0x80,0xA7,0x47,0x81,0x4E,0x00,0x82,0x9C,0x49,0x80,0xA7,0x00,0x80,
+	0xA7,0x4B,0x80,0xA7,0x00,0x81,0x4E,0x4E,0x80,0xA7,0x00,0x81,0x4E,0x3F,0x80,0xA7,
+	0xA0,0x49,0x00,0x02,0x44,0x81,0x4E,0x4C,0x54,0x49,0x53,0x44,0x80,0xA6,0xA0,0x96,
+	0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,
+	0x00,0x02,0x4C,0x54,0x49,0x53,0x44,0x81,0xF5,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,
+	0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,
+	0x02,0xA0,0x12,0x02,0x03,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,
+	0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0x4C,0x54,0x49,
+	0x53,0x44,0x80,0xA7,0x50,0x80,0xA7,0x00,0x83,0xEA,0x4E,0x53,0x50,0x53,0x4E,0x80,
+	0xA7,0x00,0x82,0x9C,0x4B,0x80,0xA7,0x4E,0x80,0xA7,0x00,0x80,0xA7,0x50,0x80,0xA7,
+	0x00,0x80,0xA7,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0xCE,0x00,0x02,0xA0,
+	0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0xCE,
+	0x00,0x02,0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,
+	0x02,0xA0,0xCE,0x00,0x02,0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,
+	0xA0,0x0A,0x00,0x02,0xA0,0x11,0x01,0x09,0xA0,0x17,0x01,0x04,0xA0,0x30,0x01,0x0D,
+	0xA0,0x10,0x00,0x02,0x36,0x80,0xA7,0xA0,0x48,0x01,0x02,0xA0,0x62,0x01,0x05,0xA0,
+	0x68,0x01,0x02,0xA0,0x75,0x01,0x0A,0xA0,0x13,0x00,0x02,0xA0,0x95,0x01,0x05,0xA0,
+	0x99,0x00,0x02,0xA0,0x1C,0x00,0x02,0xA0,0xAC,0x01,0x03,0xA0,0x9B,0x01,0x03,0x45,
+	0x80,0xA7,0xA0,0x4C,0x00,0x02,0x44,0x80,0xA7,0xA0,0xAC,0x01,0x03,0xA0,0x9B,0x01,
+	0x03,0x45,0x80,0xA7,0xA0,0x4C,0x00,0x02,0xA0,0xD2,0x01,0x0A,0xA0,0x49,0x00,0x02,
+	0xA0,0xF4,0x01,0x04,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,
+	0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0x12,0x02,0x03,0xA0,0xF7,0x01,0x03,
+	0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,
+	0xA0,0x96,0x00,0x02,0xA0,0x12,0x02,0x03,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,
+	0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,0xA0,0xF7,0x01,0x03,0xA0,0x96,0x00,0x02,
+	0xA0,0x4D,0x02,0x0E,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0xCE,0x00,0x02,
+	0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,
+	0xCE,0x00,0x02,0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,0x02,0xA0,0x0A,
+	0x00,0x02,0xA0,0xCE,0x00,0x02,0xA0,0x2C,0x00,0x02,0x00,0x84,0x91,0xA0,0xCE,0x00,
+	0x02,0xA0,0x0A,0x00,0x02,0xA0,0x11,0x01,0x02,0xFF
 };
 
 #endif
@@ -2,337 +2,118 @@
 #ifndef __MUSIC_E1M2_H__
 #define __MUSIC_E1M2_H__
 
-#define MUSIC_E1M2_NOTE_COUNT  752
-#define MUSIC_E1M2_HAS_ARP     0
+#define MUSIC_E1M2_LENGTH_MS  60043
 
-static const int music_e1m2_melody[752] = {
-	0xB320,0xB320,0x9350,0x0000,0x0000,0x7350,0x7350,0x0000,0xA320,0xA320,0x0000,0xB3A0,
-	0x0000,0x0000,0x83A0,0x0000,0x0000,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,0x8390,
-	0x8390,0x0000,0xA320,0xA320,0x0000,0x9370,0x9370,0x0000,0x9370,0x9370,0x0000,0xA350,
-	0xA350,0x0000,0xA370,0xA370,0x0000,0x9350,0x9350,0x0000,0xA340,0x0000,0x0000,0xA320,
-	0xA320,0xA350,0xA350,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,0xA3A0,0x0000,
-	0x0000,0xA3A0,0x0000,0x0000,0xC320,0xC320,0x0000,0xC390,0x0000,0x8390,0x8390,0x0000,
-	0xB320,0xB320,0x0000,0xC370,0xC370,0x0000,0xA370,0xA370,0x0000,0xB350,0xB350,0x0000,
-	0x8370,0x8370,0x0000,0x9350,0x9350,0x0000,0x8340,0x8340,0x0000,0xC320,0xC320,0xC320,
-	0xC320,0x0000,0xA350,0xA350,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,0x93A0,
-	0x0000,0x63A0,0x63A0,0x0000,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,0x8390,0x8390,
-	0x0000,0xA320,0xA320,0x0000,0x9370,0x9370,0x0000,0x9370,0x9370,0x0000,0xA350,0xA350,
-	0x0000,0xA370,0xA370,0x0000,0x9350,0x9350,0x0000,0xA340,0x0000,0x0000,0xA320,0xA320,
-	0xA350,0xA350,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,0xA3A0,0x0000,0x0000,
-	0xA3A0,0x0000,0x0000,0xC320,0xC320,0x0000,0xC390,0x0000,0x8390,0x8390,0x0000,0xB320,
-	0xB320,0x0000,0xC370,0xC370,0x0000,0xA370,0xA370,0x0000,0xB350,0xB350,0xB350,0x0000,
-	0x8370,0x8370,0x8370,0x0000,0x9350,0x9350,0x9350,0x0000,0x8340,0x8340,0x0000,0xC320,
-	0xC320,0xC320,0xC320,0x0000,0xA350,0xA350,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,
-	0x0000,0x93A0,0x0000,0x63A0,0x63A0,0x0000,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,
-	0x7390,0x7390,0x0000,0xC320,0xC320,0x0000,0xB370,0xB370,0x0000,0x7370,0x7370,0x0000,
-	0xA350,0xA350,0x0000,0x9370,0x9370,0x0000,0x8350,0x8350,0x0000,0x9340,0x8320,0x8320,
-	0x0000,0x9350,0x0000,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,0xA3A0,0x0000,
-	0x0000,0x63A0,0x0000,0x8320,0x8320,0x0000,0x9390,0x0000,0x0000,0x9390,0x9390,0x0000,
-	0xA320,0xA320,0x0000,0x9370,0x0000,0x0000,0xA370,0xA370,0x0000,0xC350,0xC350,0x0000,
-	0xA370,0xA370,0x0000,0xC350,0xC350,0x0000,0xA340,0xA340,0x0000,0x0000,0xB320,0xB320,
-	0xB320,0xB320,0x9350,0x0000,0x0000,0x7350,0x7350,0x0000,0xA320,0xA320,0x0000,0xB3A0,
-	0x0000,0x0000,0x83A0,0x0000,0x0000,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,0x8390,
-	0x8390,0x0000,0xA320,0xA320,0x0000,0x9370,0x9370,0x0000,0x9370,0x9370,0x0000,0xA350,
-	0xA350,0x0000,0xA370,0xA370,0x0000,0x9350,0x9350,0x0000,0xA340,0x0000,0x0000,0xA320,
-	0xA320,0xA350,0xA350,0x0000,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,0xA3A0,0x0000,
-	0x0000,0xA3A0,0x0000,0x0000,0xC320,0xC320,0x0000,0xC390,0x0000,0x8390,0x8390,0x0000,
-	0xB320,0xB320,0x0000,0xC370,0xC370,0x0000,0xA370,0xA370,0x0000,0xB350,0xB350,0x0000,
-	0x8370,0x8370,0x0000,0x9350,0x9350,0x0000,0x8340,0x8340,0x0000,0xC320,0xC320,0xC320,
-	0xC320,0x0000,0xA350,0xA350,0x0000,0xA350,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,
-	0x93A0,0x0000,0x63A0,0x63A0,0x0000,0x0000,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,
-	0x7390,0x7390,0x7390,0x0000,0xC320,0xC320,0x0000,0xB370,0xB370,0xB370,0x0000,0x7370,
-	0x7370,0x0000,0xA350,0xA350,0x0000,0x9370,0x9370,0x0000,0x8350,0x8350,0x8350,0x0000,
-	0x9340,0x8320,0x8320,0x8320,0x0000,0x9350,0x0000,0x0000,0xA350,0xA350,0xA350,0x0000,
-	0xA320,0xA320,0x0000,0xA3A0,0x0000,0x0000,0x63A0,0x0000,0x8320,0x8320,0x8320,0x0000,
-	0x9390,0x0000,0x0000,0x9390,0x9390,0x0000,0xA320,0xA320,0x0000,0x9370,0x9370,0x0000,
-	0x0000,0xA370,0xA370,0x0000,0xC350,0xC350,0x0000,0xA370,0xA370,0x0000,0xC350,0xC350,
-	0x0000,0xA340,0xA340,0x0000,0x0000,0xB320,0xB320,0xB320,0xB320,0x9350,0x0000,0x0000,
-	0x0000,0x7350,0x7350,0x0000,0xA320,0xA320,0x0000,0xB3A0,0x0000,0x0000,0x83A0,0x0000,
-	0x0000,0x9320,0x9320,0x9320,0x0000,0x9390,0x9390,0x0000,0x0000,0x8390,0x8390,0x0000,
-	0xA320,0xA320,0x0000,0x9370,0x9370,0x9370,0x0000,0x9370,0x9370,0x0000,0xA350,0xA350,
-	0x0000,0xA370,0xA370,0x0000,0x9350,0x9350,0x9350,0x0000,0xA340,0x0000,0x0000,0xA320,
-	0xA320,0xA320,0xA350,0xA350,0x0000,0xA350,0xA350,0xA350,0x0000,0xA320,0xA320,0x0000,
-	0xA3A0,0x0000,0x0000,0xA3A0,0x0000,0x0000,0xC320,0xC320,0xC320,0x0000,0xC390,0x0000,
-	0x0000,0x8390,0x8390,0x0000,0xB320,0xB320,0x0000,0x0000,0xC370,0xC370,0x0000,0xA370,
-	0xA370,0x0000,0x0000,0xB350,0xB350,0x0000,0x8370,0x8370,0x0000,0x9350,0x9350,0x9350,
-	0x0000,0x8340,0x8340,0x0000,0xC2E0,0xC2E0,0xC2E0,0xC2E0,0x0000,0xA310,0xA310,0x0000,
-	0xA310,0xA310,0xA310,0x0000,0xA2E0,0xA2E0,0x0000,0x9360,0x0000,0x6360,0x6360,0x0000,
-	0x0000,0x92E0,0x92E0,0x0000,0x9350,0x9350,0x0000,0x7350,0x7350,0x7350,0x0000,0xC2E0,
-	0xC2E0,0x0000,0xB330,0xB330,0xB330,0x0000,0x7330,0x7330,0x0000,0xA310,0xA310,0x0000,
-	0x9330,0x9330,0x0000,0x8310,0x8310,0x8310,0x0000,0x9300,0x82E0,0x82E0,0x82E0,0x0000,
-	0x9310,0x0000,0x0000,0xA310,0xA310,0xA310,0x0000,0xA2E0,0xA2E0,0x0000,0xA360,0x0000,
-	0x0000,0x6360,0x0000,0x82E0,0x82E0,0x82E0,0x0000,0x9350,0x0000,0x0000,0x9350,0x9350,
-	0x0000,0xA2E0,0xA2E0,0x0000,0x9330,0x9330,0x0000,0x0000,0xA330,0xA330,0x0000,0xC310,
-	0xC310,0x0000,0xA330,0xA330,0x0000,0xC310,0xC310,0x0000,0xA300,0xA300,0x0000,0x0000,
-	0xB2E0,0xB2E0,0xB2E0,0xB2E0,0x9310,0x0000,0x0000,0x0000,0x7310,0x7310,0x0000,0xA2E0,
-	0xA2E0,0x0000,0xB360,0x0000,0x0000,0x8360,0x0000,0x0000,0x92E0,0x92E0,0x92E0,0x0000,
-	0x9350,0x9350,0x0000,0x0000,0x8350,0x8350,0x0000,0xA2E0,0xA2E0,0x0000,0x9330,0x9330,
-	0x9330,0x0000,0x9330,0x9330,0x0000,0xA310,0xA310,0x0000,0xA330,0xA330,0x0000,0x9310,
-	0x9310,0x9310,0x0000,0xA300,0x0000,0x0000,0xA2E0,0xA2E0
+static const unsigned char music_e1m2_melody[775] = {
+	0x8B,0x32,0x80,0xFA,0x89,0x35,0x3A,0x00,0x80,0xBF,0x87,0x35,0x75,0x00,0x80,0x85,
+	0x8A,0x32,0x68,0x00,0x80,0x92,0x8B,0x3A,0x2E,0x00,0x80,0xCC,0x88,0x3A,0x3E,0x00,
+	0x80,0xBB,0x89,0x32,0x68,0x00,0x80,0x92,0x39,0x53,0x00,0x80,0xA7,0x88,0x39,0x53,
+	0x00,0x80,0xA7,0x8A,0x32,0x71,0x00,0x80,0x8A,0x89,0x37,0x53,0x00,0x80,0xA7,0x37,
+	0x53,0x00,0x80,0xA7,0x8A,0x35,0x80,0xC8,0x00,0x32,0x37,0x80,0xDD,0x00,0x1D,0x89,
+	0x35,0x80,0xE2,0x00,0x19,0x8A,0x34,0x80,0xD9,0x00,0x21,0x32,0x80,0xFA,0x35,0x57,
+	0x00,0x80,0xA2,0xA0,0x5E,0x00,0x02,0x32,0x69,0x00,0x80,0x92,0x3A,0x3A,0x00,0x80,
+	0xC0,0x3A,0x3A,0x00,0x80,0xBF,0x8C,0x32,0x5B,0x00,0x80,0x9E,0x39,0x4B,0x00,0x80,
+	0xAF,0x88,0x39,0x4B,0x00,0x80,0xAF,0x8B,0x32,0x60,0x00,0x80,0x9A,0x8C,0x37,0x58,
+	0x00,0x80,0xA2,0x8A,0x37,0x57,0x00,0x80,0xA2,0x8B,0x35,0x80,0xC4,0x00,0x36,0x88,
+	0x37,0x80,0xC0,0x00,0x3A,0x89,0x35,0x80,0xD4,0x00,0x26,0x88,0x34,0x80,0xD7,0x00,
+	0x21,0x8C,0x32,0x7D,0x00,0x7D,0x8A,0x35,0x53,0x00,0x80,0xA7,0xA0,0x5E,0x00,0x02,
+	0x32,0x6C,0x00,0x80,0x8E,0x89,0x3A,0x4B,0x00,0x80,0xAF,0x86,0x3A,0x53,0x00,0x80,
+	0xA7,0x89,0x32,0x70,0x00,0x80,0x8A,0x39,0x64,0x00,0x80,0x96,0xA0,0x2D,0x00,0x13,
+	0xA0,0x5E,0x00,0x02,0xA0,0x67,0x00,0x12,0x8B,0x35,0x80,0xC3,0x00,0x36,0x88,0x37,
+	0x80,0xBF,0xA0,0xA3,0x00,0x03,0x88,0x34,0x80,0xD8,0xA0,0xAF,0x00,0x05,0xA0,0x5E,
+	0x00,0x02,0xA0,0xC0,0x00,0x0A,0x87,0x39,0x68,0x00,0x80,0x92,0x8C,0x32,0x6D,0x00,
+	0x80,0x8E,0x8B,0x37,0x60,0x00,0x80,0x9A,0x87,0x37,0x68,0x00,0x80,0x92,0x8A,0x35,
+	0x80,0xDD,0x00,0x1D,0x89,0x37,0x80,0xE9,0x00,0x11,0x88,0x35,0x80,0xE1,0x00,0x19,
+	0x89,0x34,0x80,0xFA,0x88,0x32,0x80,0x8E,0x00,0x6C,0x89,0x35,0x3A,0x00,0x80,0xBF,
+	0x8A,0x35,0x4F,0x00,0x80,0xAB,0x32,0x6D,0x00,0x80,0x8E,0x3A,0x4B,0x00,0x80,0xAF,
+	0x86,0x3A,0x4B,0x00,0x80,0xAF,0x88,0x32,0x68,0x00,0x80,0x92,0x89,0x39,0x19,0x00,
+	0x80,0xE1,0x39,0x60,0x00,0x80,0x9A,0x8A,0x32,0x60,0x00,0x80,0x9A,0x89,0x37,0x47,
+	0x00,0x80,0xB3,0x8A,0x37,0x4B,0x00,0x80,0xAF,0x8C,0x35,0x80,0xD9,0x00,0x21,0x8A,
+	0x37,0x80,0xF6,0x00,0x04,0x8C,0x35,0x80,0xD1,0x00,0x2A,0x8A,0x34,0x80,0xC6,0x00,
+	0x32,0x8B,0x32,0x80,0xF9,0xA0,0x04,0x00,0x21,0xA0,0x5E,0x00,0x02,0xA0,0x67,0x00,
+	0x1E,0xA0,0x5E,0x00,0x02,0xA0,0xC0,0x00,0x05,0x00,0x80,0xA6,0xA0,0xD1,0x00,0x04,
+	0xA0,0x06,0x01,0x13,0x8A,0x35,0x4E,0xA0,0x43,0x01,0x0F,0x89,0x37,0x46,0xA0,0x70,
+	0x01,0x02,0x00,0x80,0xAE,0xA0,0x79,0x01,0x09,0xA0,0x04,0x00,0x0D,0x00,0x80,0xA6,
+	0xA0,0x2D,0x00,0x0C,0x89,0x35,0x80,0xE1,0xA0,0x53,0x00,0x03,0x32,0x80,0xF9,0xA0,
+	0x5E,0x00,0x02,0xA0,0x5E,0x00,0x02,0xA0,0x67,0x00,0x09,0x00,0x80,0xAE,0xA0,0x81,
+	0x00,0x10,0x8C,0x2E,0x7D,0x00,0x7D,0x8A,0x31,0x53,0x00,0x80,0xA7,0x31,0x57,0x00,
+	0x80,0xA2,0x2E,0x6C,0x00,0x80,0x8E,0x89,0x36,0x4B,0x00,0x80,0xAF,0x86,0x36,0x53,
+	0x00,0x80,0xA6,0x89,0x2E,0x70,0x00,0x80,0x8A,0x35,0x64,0x00,0x80,0x96,0x87,0x35,
+	0x68,0x00,0x80,0x92,0x8C,0x2E,0x6D,0x00,0x80,0x8E,0x8B,0x33,0x60,0x00,0x80,0x9A,
+	0x87,0x33,0x68,0x00,0x80,0x92,0x8A,0x31,0x80,0xDD,0x00,0x1D,0x89,0x33,0x80,0xE9,
+	0x00,0x11,0x88,0x31,0x80,0xE1,0x00,0x19,0x89,0x30,0x80,0xFA,0x88,0x2E,0x80,0x8E,
+	0x00,0x6C,0x89,0x31,0x3A,0x00,0x80,0xBF,0x8A,0x31,0x4E,0x00,0x80,0xAB,0x2E,0x6D,
+	0x00,0x80,0x8E,0x36,0x4B,0x00,0x80,0xAF,0x86,0x36,0x4B,0x00,0x80,0xAF,0x88,0x2E,
+	0x68,0x00,0x80,0x92,0x89,0x35,0x19,0x00,0x80,0xE1,0x35,0x60,0x00,0x80,0x9A,0x8A,
+	0x2E,0x60,0x00,0x80,0x9A,0x89,0x33,0x46,0x00,0x80,0xB3,0x8A,0x33,0x4B,0x00,0x80,
+	0xAE,0x8C,0x31,0x80,0xD9,0x00,0x21,0x8A,0x33,0x80,0xF6,0x00,0x04,0x8C,0x31,0x80,
+	0xD1,0x00,0x2A,0x8A,0x30,0x80,0xC6,0x00,0x32,0x8B,0x2E,0x80,0xF9,0x89,0x31,0x3A,
+	0x00,0x80,0xBF,0x87,0x31,0x75,0x00,0x80,0x85,0x8A,0x2E,0x68,0x00,0x80,0x92,0x8B,
+	0x36,0x2E,0x00,0x80,0xCC,0x88,0x36,0x3E,0x00,0x80,0xBB,0x89,0x2E,0x68,0x00,0x80,
+	0x92,0x35,0x53,0x00,0x80,0xA6,0x88,0x35,0x53,0x00,0x80,0xA7,0x8A,0x2E,0x71,0x00,
+	0x80,0x8A,0x89,0x33,0x53,0x00,0x80,0xA7,0x33,0x53,0x00,0x80,0xA7,0x8A,0x31,0x80,
+	0xC8,0x00,0x32,0x33,0x80,0xDD,0x00,0x1D,0x89,0x31,0x80,0xE1,0x00,0x19,0x8A,0x30,
+	0x80,0xD9,0x00,0x21,0x2E,0x57,0xFF
 };
 
-static const int music_e1m2_bass[752] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+static const unsigned char music_e1m2_bass[7] = {
+	0x00,0xFF,0xD9,0x00,0xEA,0xB2,0xFF
 };
 
-static const int music_e1m2_chords[752] = {
-	0xF320,0x0000,0xE320,0xE320,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0xF320,0x0000,0xE320,0xE320,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,
-	0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,
-	0x0000,0xE320,0xE320,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,0xF320,0xF320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xC320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0x0000,0xE320,0x0000,0x0000,0xC320,0x0000,0x0000,0xC320,0x0000,0x0000,0xF320,0x0000,
-	0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0x0000,
-	0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,0x0000,
-	0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,
-	0xE320,0xE320,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0x0000,
-	0xF320,0xF320,0x0000,0x0000,0xE320,0xE320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,
-	0xF320,0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xC320,0x0000,0x0000,0xF320,0x0000,
-	0x0000,0xF320,0x0000,0xE320,0x0000,0x0000,0xC320,0x0000,0x0000,0xC320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xE320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF300,0xF320,0x0000,
-	0x0000,0xF320,0xF320,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,
-	0x0000,0xE320,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xC320,0x0000,0x0000,0xE320,0x0000,0x0000,0xF300,0xF300,0xF300,0x0000,0xF320,0xF320,
-	0xF320,0x0000,0xE320,0xE320,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0xF320,0x0000,0xE320,0xE320,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,
-	0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,
-	0x0000,0xE320,0xE320,0x0000,0xE320,0x0000,0x0000,0xF320,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,0xF320,0xF320,
-	0x0000,0x0000,0xE320,0x0000,0x0000,0xC320,0xC320,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0xE320,0x0000,0x0000,0x0000,0xC320,0x0000,0x0000,0xC320,0x0000,0x0000,
-	0xF320,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0xE320,0x0000,0x0000,0xE320,
-	0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0x0000,0x0000,0xF320,0xF320,0x0000,0x0000,
-	0xF300,0xF320,0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0xF320,0xF320,0x0000,0x0000,
-	0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0xE320,0x0000,0xF320,0xF320,0x0000,0x0000,
-	0xF320,0xF320,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,0xF320,
-	0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xC320,0x0000,0x0000,0xE320,0x0000,
-	0x0000,0xF300,0xF300,0xF300,0x0000,0xF320,0xF320,0xF320,0x0000,0xE320,0xE320,0x0000,
-	0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0xF320,0x0000,0xE320,0xE320,
-	0x0000,0xE320,0xE320,0x0000,0x0000,0xF320,0x0000,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xE320,0x0000,0x0000,0xF320,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0x0000,
-	0x0000,0xE320,0x0000,0x0000,0xF320,0xF320,0x0000,0x0000,0xF300,0xF300,0x0000,0xF320,
-	0xF320,0x0000,0xE320,0x0000,0x0000,0xF320,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,
-	0xF320,0xF320,0x0000,0xE320,0xE320,0x0000,0xE320,0xE320,0x0000,0x0000,0xF320,0x0000,
-	0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,
-	0x0000,0x0000,0x0000,0xF320,0x0000,0x0000,0xF320,0x0000,0x0000,0xE320,0xE320,0x0000,
-	0x0000,0xF300,0xF300,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,
-	0xC2E0,0xC2E0,0x0000,0x0000,0xF2E0,0x0000,0x0000,0xF2E0,0x0000,0xE2E0,0x0000,0x0000,
-	0x0000,0xC2E0,0x0000,0x0000,0xC2E0,0x0000,0x0000,0xF2E0,0xF2E0,0x0000,0x0000,0xF2E0,
-	0x0000,0x0000,0xE2E0,0xE2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,0xF2E0,0x0000,0x0000,
-	0xE2E0,0x0000,0x0000,0xF2E0,0xF2E0,0x0000,0x0000,0xF2C0,0xF2E0,0xF2E0,0x0000,0x0000,
-	0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0x0000,0x0000,0xF2E0,0x0000,0x0000,0xF2E0,0xF2E0,
-	0x0000,0xE2E0,0x0000,0xF2E0,0xF2E0,0x0000,0x0000,0xF2E0,0xF2E0,0x0000,0xF2E0,0x0000,
-	0x0000,0xF2E0,0x0000,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0x0000,0x0000,0xF2E0,
-	0x0000,0x0000,0xC2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,0xF2C0,0xF2C0,0xF2C0,0x0000,
-	0xF2E0,0xF2E0,0xF2E0,0x0000,0xE2E0,0xE2E0,0x0000,0x0000,0xF2E0,0x0000,0x0000,0xF2E0,
-	0x0000,0x0000,0xF2E0,0xF2E0,0x0000,0xE2E0,0xE2E0,0x0000,0xE2E0,0xE2E0,0x0000,0x0000,
-	0xF2E0,0x0000,0x0000,0x0000,0xF2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,0xF2E0,0xF2E0,
-	0x0000,0x0000,0xF2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,0xE2E0,0x0000,0x0000,0xF2E0,
-	0xF2E0,0x0000,0x0000,0xF2C0,0xF2C0,0x0000,0xF2E0,0xF2E0
-};
-
-static const int music_e1m2_drums[752] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x0020,0x001C,0x001F,0x0020,
-	0x0020,0x0020,0x0020,0x0020,0x0020,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0021,0x0021,0x0021,
-	0x001C,0x0020,0x0020,0x0020,0x001C,0x0021,0x0021,0x0021,0x001C,0x0020,0x0020,0x001C,
-	0x001F,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x0020,0x0020,0x0020,0x001C,0x001F,
-	0x0020,0x0020,0x0020,0x0020,0x0020,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001C,0x0020,0x0020,0x001C,0x001F,0x0020,
-	0x0020,0x0020,0x0020,0x0020,0x0020,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0024,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x0024,0x0024,
-	0x0024,0x001C,0x0020,0x0020,0x0020,0x001C,0x0020,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001E,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,
-	0x001E,0x001C,0x0020,0x0020,0x001C,0x001F,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
-	0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001C,0x0020,0x0020,0x0020,
-	0x001C,0x0020,0x001F,0x001F,0x001F,0x001F,0x001F,0x001E,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x0024,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E
-};
-
-static const unsigned short music_e1m2_timing[752] = {
-	   92,  158,   58,   12,  179,   75,   42,  133,   75,   29,  146,   46,
-	   29,  175,   62,   12,  175,   79,   25,  146,   75,    8,  167,   79,
-	    4,  167,   75,   38,  138,   79,    4,  167,   75,    8,  167,   83,
-	  117,   50,   79,  142,   29,   88,  138,   25,  217,   25,    8,   88,
-	  162,   75,   12,  162,   79,    8,  162,   67,   38,  146,   58,   17,
-	  175,   58,    8,  183,   79,   12,  158,   75,  175,   71,    4,  175,
-	   75,   21,  154,   67,   21,  162,   75,   12,  162,   67,  129,   54,
-	   75,  117,   58,   83,  129,   38,   62,  153,   33,    4,    8,   71,
-	   42,  125,   75,    8,  167,   83,    4,  162,   75,   33,  142,   75,
-	  175,   75,    8,  167,   83,   29,  138,   75,   25,  150,   79,    4,
-	  167,   75,   38,  138,   79,    4,  167,   75,    8,  167,   83,  117,
-	   50,   79,  142,   29,   88,  138,   25,  217,   25,    8,   88,  162,
-	   75,   12,  162,   79,    8,  162,   67,   38,  146,   58,   17,  175,
-	   58,    8,  183,   79,   12,  158,   75,  175,   71,    4,  175,   75,
-	   21,  154,   67,   21,  162,   75,   12,  162,    4,   62,  129,   54,
-	    4,   71,  116,   58,    4,   79,  129,   38,    4,  212,   33,    4,
-	    8,   71,   42,  125,   75,    8,  167,   83,    4,  162,   75,   33,
-	  142,   75,  175,   75,    8,  167,   83,   29,  138,   75,   25,  150,
-	   79,   25,  146,   71,   38,  142,   75,   21,  154,   75,   29,  146,
-	   79,  142,   29,   75,  158,   17,   79,  146,   25,  250,   75,   67,
-	  108,   58,    8,  183,   75,    4,  171,   71,   38,  142,   75,    8,
-	  167,   75,  175,   75,   29,  146,   25,   50,  175,   79,   17,  154,
-	   75,   21,  154,   71,    4,  175,   71,    4,  175,   79,  138,   33,
-	   67,  179,    4,   88,  121,   42,   62,  136,   42,    8,    4,    8,
-	   79,  158,   58,   12,  179,   75,   42,  133,   75,   29,  146,   46,
-	   29,  175,   62,   12,  175,   79,   25,  146,   75,    8,  167,   79,
-	    4,  167,   75,   38,  138,   79,    4,  167,   75,    8,  167,   83,
-	  117,   50,   79,  142,   29,   88,  138,   25,  217,   25,    8,   88,
-	  162,   75,   12,  162,   79,    8,  162,   67,   38,  146,   58,   17,
-	  175,   58,    8,  183,   79,   12,  158,   75,  175,   71,    4,  175,
-	   75,   21,  154,   67,   21,  162,   75,   12,  162,   67,  129,   54,
-	   75,  117,   58,   83,  129,   38,   62,  153,   33,    4,    8,   71,
-	   42,  125,   75,    8,  167,    4,   79,    4,  162,   75,   33,  142,
-	   75,  175,   75,    8,  162,    4,   83,   29,  138,   75,   25,  150,
-	    4,   75,   25,  146,   71,   38,  142,    4,   71,   21,  154,   75,
-	   29,  146,   79,  142,   29,   75,  158,   17,    8,   71,  146,   25,
-	  250,    4,   71,   67,  108,   58,    8,  183,   12,   62,    4,  171,
-	   71,   38,  142,   75,    8,  167,   75,  175,    8,   67,   29,  146,
-	   25,   50,  175,   79,   17,  154,   75,   21,  154,   12,   58,    4,
-	  175,   71,    4,  174,   79,  138,   33,   67,  179,    4,   88,  121,
-	   42,   62,  136,   42,    8,   12,   25,   54,  158,   58,   12,  167,
-	   12,   75,   42,  133,   75,   29,  146,   46,   29,  175,   62,   12,
-	  175,    4,   75,   25,  146,   75,    8,  162,    4,   79,    4,  167,
-	   75,   38,  138,    8,   71,    4,  167,   75,    8,  167,   83,  117,
-	   50,   79,  142,   29,    4,   83,  138,   25,  217,   25,    8,    8,
-	   79,  162,   75,   12,  162,    8,   71,    8,  162,   67,   38,  146,
-	   58,   17,  175,   58,    8,  183,   12,   67,   12,  158,   75,  162,
-	   12,   71,    4,  175,   75,   21,  146,    8,   67,   21,  162,   75,
-	   12,  154,    8,   67,  129,   54,   75,  117,   58,    4,   79,  129,
-	   38,   62,  153,   33,    4,    8,   71,   42,  125,   75,    8,  167,
-	    4,   79,    4,  162,   75,   33,  142,   75,  175,   75,    8,  162,
-	    4,   83,   29,  138,   75,   25,  150,    4,   75,   25,  146,   71,
-	   38,  142,    4,   71,   21,  154,   75,   29,  146,   79,  142,   29,
-	   75,  158,   17,    8,   71,  146,   25,  250,    4,   71,   67,  108,
-	   58,    8,  183,   12,   62,    4,  171,   71,   38,  142,   75,    8,
-	  167,   75,  175,    8,   67,   29,  146,   25,   50,  175,   79,   17,
-	  154,   75,   21,  154,   12,   58,    4,  175,   71,    4,  174,   79,
-	  138,   33,   67,  179,    4,   88,  121,   42,   62,  136,   42,    8,
-	   12,   25,   54,  158,   58,   12,  167,   12,   75,   42,  133,   75,
-	   29,  146,   46,   29,  175,   62,   12,  175,    4,   75,   25,  146,
-	   75,    8,  162,    4,   79,    4,  167,   75,   38,  138,    8,   71,
-	    4,  167,   75,    8,  167,   83,  117,   50,   79,  142,   29,    4,
-	   83,  138,   25,  217,   25,    8,    8,   79
+static const unsigned char music_e1m2_chords[840] = {
+	0x8F,0x32,0x5C,0x00,0x80,0x9E,0x8E,0x32,0x46,0x00,0x80,0xB3,0x8F,0x32,0x4B,0x00,
+	0x80,0xAF,0x32,0x4B,0xA0,0x0F,0x00,0x02,0x00,0x80,0xAF,0x8E,0x32,0x4A,0x00,0x80,
+	0xAF,0x32,0x4F,0x00,0x80,0xAB,0xA0,0x0C,0x00,0x02,0x32,0x4F,0x00,0x80,0xAB,0x8E,
+	0x32,0x4B,0x00,0x80,0xB0,0x8F,0x32,0x4F,0x00,0x80,0xAB,0x32,0x4B,0x00,0x80,0xAF,
+	0x8E,0x32,0x53,0x00,0x80,0xA7,0xA0,0x21,0x00,0x02,0x8F,0x32,0x58,0x00,0x80,0xA3,
+	0x30,0x80,0xF2,0x00,0x08,0x32,0x58,0x00,0x80,0xA2,0x8E,0x32,0x4B,0x00,0x80,0xAE,
+	0x8F,0x32,0x4F,0x00,0x80,0xAA,0x32,0x43,0x00,0x80,0xB8,0xA0,0x3B,0x00,0x02,0x8E,
+	0x32,0x42,0x00,0x80,0xB7,0x32,0x4F,0x00,0x80,0xAA,0xA0,0x0C,0x00,0x02,0x32,0x47,
+	0x00,0x80,0xB3,0xA0,0x3B,0x00,0x02,0x32,0x43,0x00,0x80,0xB7,0x32,0x4B,0x00,0x80,
+	0xAE,0xA0,0x87,0x00,0x03,0xA0,0x3D,0x00,0x03,0x8F,0x30,0x80,0xD7,0x00,0x21,0x32,
+	0x53,0x00,0x80,0xA7,0x8E,0x32,0x4B,0x00,0x80,0xAF,0x8C,0x32,0x53,0x00,0x80,0xA6,
+	0x8F,0x32,0x4B,0xA0,0x0F,0x00,0x02,0x00,0x80,0xAF,0xA0,0xA4,0x00,0x03,0x00,0x80,
+	0xA7,0x32,0x4B,0x00,0x80,0xAF,0x8F,0x32,0x4F,0xA0,0x2C,0x00,0x09,0xA0,0x21,0x00,
+	0x02,0xA0,0x4A,0x00,0x0C,0xA0,0x3B,0x00,0x02,0xA0,0x6F,0x00,0x04,0xA0,0x0C,0x00,
+	0x02,0xA0,0x7E,0x00,0x02,0xA0,0x3B,0x00,0x02,0xA0,0x87,0x00,0x04,0x32,0x42,0xA0,
+	0x89,0x00,0x03,0xA0,0x40,0x00,0x02,0x8F,0x30,0x80,0xD8,0xA0,0x9D,0x00,0x08,0xA0,
+	0x0F,0x00,0x02,0x00,0x80,0xAF,0xA0,0xA4,0x00,0x03,0xA0,0xBE,0x00,0x04,0x00,0x80,
+	0xAB,0x32,0x47,0x00,0x80,0xB4,0xA0,0xA4,0x00,0x02,0x32,0x4B,0x00,0x80,0xAF,0xA0,
+	0x35,0x00,0x02,0xA0,0xA4,0x00,0x02,0xA0,0x35,0x00,0x02,0x30,0x80,0xFA,0xA0,0x3B,
+	0x00,0x02,0x32,0x42,0xA0,0x89,0x00,0x02,0x00,0x80,0xAF,0xA0,0x11,0x01,0x02,0xA0,
+	0x9F,0x00,0x04,0xA0,0x0C,0x00,0x03,0x00,0x80,0xAF,0xA0,0x2A,0x00,0x02,0xA0,0x3B,
+	0x00,0x02,0xA0,0x3B,0x00,0x02,0xA0,0x7E,0x00,0x02,0xA0,0x2A,0x00,0x02,0x8C,0x32,
+	0x43,0x00,0x80,0xB7,0x8E,0x32,0x58,0x00,0x80,0xA3,0x8F,0x30,0x80,0xF0,0x00,0x08,
+	0x32,0x5B,0xA0,0x03,0x00,0x06,0xA0,0x0F,0x00,0x02,0xA0,0x18,0x00,0x05,0xA0,0x0C,
+	0x00,0x02,0xA0,0x2A,0x00,0x0A,0xA0,0x21,0x00,0x02,0xA0,0x4A,0x00,0x0C,0xA0,0x3B,
+	0x00,0x02,0xA0,0x6F,0x00,0x04,0xA0,0x0C,0x00,0x02,0xA0,0x7E,0x00,0x02,0xA0,0x3B,
+	0x00,0x02,0xA0,0x87,0x00,0x04,0xA0,0x87,0x00,0x03,0xA0,0x3D,0x00,0x03,0xA0,0x99,
+	0x00,0x09,0xA0,0x0F,0x00,0x02,0x00,0x80,0xAF,0xA0,0x5A,0x00,0x02,0x8C,0x32,0x53,
+	0xA0,0xBE,0x00,0x04,0xA0,0x0E,0x01,0x03,0xA0,0xA4,0x00,0x02,0xA0,0x1A,0x01,0x02,
+	0xA0,0x35,0x00,0x02,0xA0,0xA4,0x00,0x02,0xA0,0x35,0x00,0x02,0x30,0x80,0xFA,0xA0,
+	0x3B,0x00,0x02,0x32,0x42,0x00,0x80,0xB7,0x32,0x4A,0x00,0x80,0xAF,0xA0,0x11,0x01,
+	0x02,0xA0,0x9F,0x00,0x04,0xA0,0x0C,0x00,0x03,0x00,0x80,0xAF,0xA0,0x2A,0x00,0x02,
+	0xA0,0x3B,0x00,0x02,0xA0,0xE8,0x01,0x02,0x32,0x47,0x00,0x80,0xB2,0xA0,0x2A,0x00,
+	0x02,0xA0,0x5E,0x01,0x07,0xA0,0x03,0x00,0x06,0xA0,0x0F,0x00,0x02,0xA0,0x18,0x00,
+	0x05,0x8F,0x32,0x4B,0x00,0x80,0xAE,0xA0,0x2A,0x00,0x0A,0xA0,0x21,0x00,0x02,0x8F,
+	0x32,0x57,0xA0,0x4D,0x00,0x03,0x32,0x57,0xA0,0x57,0x00,0x07,0xA0,0x3B,0x00,0x02,
+	0xA0,0x6F,0x00,0x04,0xA0,0x21,0x02,0x02,0xA0,0x7E,0x00,0x02,0xA0,0x3B,0x00,0x02,
+	0xA0,0x87,0x00,0x04,0xA0,0x87,0x00,0x03,0xA0,0x3D,0x00,0x03,0xA0,0x99,0x00,0x02,
+	0x2E,0x53,0x00,0x80,0xA7,0x8E,0x2E,0x4B,0x00,0x80,0xAF,0x8C,0x2E,0x53,0x00,0x80,
+	0xA6,0x8F,0x2E,0x4B,0x00,0x80,0xAF,0x2E,0x4B,0x00,0x80,0xAF,0x8E,0x2E,0x4B,0x00,
+	0x80,0xAE,0x8C,0x2E,0x53,0x00,0x80,0xA7,0x2E,0x4B,0x00,0x80,0xAF,0x8F,0x2E,0x4F,
+	0x00,0x80,0xAB,0x2E,0x47,0x00,0x80,0xB4,0xA0,0x65,0x02,0x02,0x2E,0x4B,0x00,0x80,
+	0xAF,0x8F,0x2E,0x4F,0x00,0x80,0xAB,0xA0,0x65,0x02,0x02,0xA0,0xA1,0x02,0x02,0x2C,
+	0x80,0xFA,0xA0,0x77,0x02,0x02,0x2E,0x42,0x00,0x80,0xB7,0x2E,0x4A,0x00,0x80,0xAF,
+	0xA0,0x93,0x02,0x02,0xA0,0x60,0x02,0x04,0x8F,0x2E,0x4B,0xA0,0x74,0x02,0x03,0x2E,
+	0x4F,0x00,0x80,0xAB,0xA0,0x77,0x02,0x02,0xA0,0xBB,0x02,0x02,0x2E,0x47,0x00,0x80,
+	0xB2,0xA0,0xCF,0x02,0x02,0x8C,0x2E,0x43,0x00,0x80,0xB7,0x8E,0x2E,0x58,0x00,0x80,
+	0xA3,0x8F,0x2C,0x80,0xF0,0x00,0x08,0x2E,0x5B,0x00,0x80,0x9E,0x8E,0x2E,0x46,0x00,
+	0x80,0xB3,0x8F,0x2E,0x4B,0xA0,0x74,0x02,0x03,0xA0,0x77,0x02,0x02,0x8E,0x2E,0x4A,
+	0x00,0x80,0xAF,0x2E,0x4F,0x00,0x80,0xAB,0x8F,0x2E,0x4B,0x00,0x80,0xAE,0xA0,0xCF,
+	0x02,0x02,0x8E,0x2E,0x4B,0x00,0x80,0xB0,0xA0,0xA1,0x02,0x02,0xA0,0x77,0x02,0x02,
+	0x8E,0x2E,0x53,0x00,0x80,0xA7,0xA0,0x13,0x03,0x02,0x8F,0x2E,0x57,0x00,0x80,0xA3,
+	0x2C,0x80,0xF2,0x00,0x08,0x2E,0x57,0xFF
 };
 
 #endif
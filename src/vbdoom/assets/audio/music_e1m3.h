@@ -2,642 +2,107 @@
 #ifndef __MUSIC_E1M3_H__
 #define __MUSIC_E1M3_H__
 
-#define MUSIC_E1M3_NOTE_COUNT  1485
-#define MUSIC_E1M3_HAS_ARP     0
+#define MUSIC_E1M3_LENGTH_MS  104169
 
-static const int music_e1m3_melody[1485] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3F0,0xB3F0,0xB3F0,
-	0xB430,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB3F0,0xB3F0,
-	0xB3F0,0xB3F0,0xB460,0xB460,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB410,0xB410,0xB410,0xB420,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,
-	0xB3F0,0xB3F0,0xB430,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB3F0,0xB3F0,0xB3F0,0xB3F0,0xB460,0xB460,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB450,0xB430,0xB430,0xB430,0xB460,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0x0000,0xB430,0xB430,0xB430,0x0000,0xB3E0,0xB430,0xB430,0x0000,0x0000,0xB3E0,
-	0xB3E0,0xB3E0,0x0000,0x0000,0xB430,0xB3E0,0xB3E0,0x0000,0xB440,0xB3F0,0xB3F0,0xB3F0,
-	0x0000,0xB3F0,0xB440,0xB440,0x0000,0xB3E0,0xB3E0,0xB3E0,0x0000,0xB430,0xB430,0x0000,
-	0x0000,0xB3E0,0xB430,0xB430,0xB430,0x0000,0x0000,0x0000,0xB430,0xB430,0x0000,0x0000,
-	0xB430,0xB430,0xB430,0xB450,0xB460,0xB450,0xB460,0xB460,0xB470,0x0000,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,
-	0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0xB440,0xB440,0xB460,0xB460,0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB430,0xB430,0xB430,0xB430,0x0000,0xB450,0xB450,0xB450,0x0000,
-	0xB460,0xB460,0x0000,0xB450,0xB450,0x0000,0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,
-	0xB470,0x0000,0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,0x0000,0xB480,0x0000,0xB4A0,
-	0xB4A0,0xB4A0,0x0000,0xB4E0,0xB4E0,0xB4E0,0x0000,0xB4F0,0xB4F0,0x0000,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,
-	0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0xB440,0xB440,0xB410,0xB410,0xB410,0xB410,0xB410,0x0000,0xB3E0,0xB430,0xB430,
-	0x0000,0xB3E0,0xB3E0,0xB430,0xB430,0xB430,0xB430,0x0000,0x0000,0xB3E0,0xB3E0,0xB3E0,
-	0xB3E0,0x0000,0xB3E0,0xB430,0xB430,0xB430,0x0000,0xB440,0xB3F0,0xB3F0,0xB3F0,0x0000,
-	0xB3F0,0xB3F0,0xB440,0xB440,0xB440,0xB440,0xB440,0x0000,0xB3F0,0xB440,0xB440,0xB440,
-	0xB440,0xB440,0xB440,0x0000,0xB3F0,0xB3F0,0xB3F0,0xB3F0,0x0000,0xB410,0xB470,0xB470,
-	0xB470,0x0000,0xB410,0xB470,0xB470,0xB470,0x0000,0x0000,0x0000,0xB410,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0x0000,0xB410,0xB470,0xB470,0xB470,0xB470,0x0000,0xB4A0,0xB440,
-	0xB440,0xB440,0x0000,0x0000,0x0000,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0xB440,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB430,0xB480,0x0000,0xB480,0xB480,0xB480,0xB480,0x0000,
-	0xB4E0,0xB490,0xB490,0xB490,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC480,0xC4B0,0xC4B0,0xC4D0,0xC4E0,0xC4E0,
-	0xC4F0,0xC520,0xC520,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB430,0xB480,0x0000,0xB480,0xB480,0xB480,0xB480,0x0000,
-	0xB4E0,0xB490,0xB490,0xB490,0x0000,0x0000,0xB430,0xB430,0x0000,0xB460,0xB460,0x0000,
-	0xB430,0xB430,0xB460,0x0000,0x0000,0xB460,0xB460,0xB460,0xB470,0xB470,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB3C0,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3F0,0xB3F0,0xB3F0,0xB430,0xB420,
-	0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB3F0,0xB3F0,0xB3F0,0xB3F0,
-	0xB460,0xB460,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB410,0xB410,0xB410,0xB420,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB430,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,
-	0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3C0,0xB3F0,0xB3F0,
-	0xB430,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,
-	0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB420,0xB3F0,0xB3F0,
-	0xB3F0,0xB3F0,0xB460,0xB460,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,0xB450,
-	0xB450,0xB430,0xB430,0xB430,0xB460,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0x0000,
-	0xB430,0xB430,0xB430,0x0000,0xB3E0,0xB430,0xB430,0x0000,0x0000,0xB3E0,0xB3E0,0xB3E0,
-	0x0000,0x0000,0xB430,0xB3E0,0xB3E0,0x0000,0xB440,0xB3F0,0xB3F0,0xB3F0,0x0000,0xB3F0,
-	0xB440,0xB440,0x0000,0xB3E0,0xB3E0,0xB3E0,0x0000,0xB430,0xB430,0x0000,0x0000,0xB3E0,
-	0xB430,0xB430,0xB430,0x0000,0x0000,0x0000,0xB430,0xB430,0x0000,0x0000,0xB430,0xB430,
-	0xB430,0xB450,0xB460,0xB450,0xB460,0xB460,0xB470,0x0000,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,
-	0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0xB460,0xB460,0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0xB430,0xB430,0xB430,0xB430,0x0000,0xB450,0xB450,0xB450,0x0000,0xB460,0xB460,
-	0x0000,0xB450,0xB450,0x0000,0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,0xB470,0x0000,
-	0xB460,0xB460,0xB460,0x0000,0xB470,0xB470,0x0000,0xB480,0x0000,0xB4A0,0xB4A0,0xB4A0,
-	0x0000,0xB4E0,0xB4E0,0xB4E0,0x0000,0xB4F0,0xB4F0,0x0000,0xB480,0xB480,0xB480,0xB480,
-	0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB480,0xB470,0xB470,
-	0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB470,0xB430,0xB430,0xB430,0xB430,
-	0xB430,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,
-	0xB460,0xB460,0xB460,0xB460,0xB460,0xB460,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0xB410,0xB410,0xB410,0xB410,0xB410,0x0000,0xB3E0,0xB430,0xB430,0x0000,0xB3E0,
-	0xB3E0,0xB430,0xB430,0xB430,0xB430,0x0000,0x0000,0xB3E0,0xB3E0,0xB3E0,0xB3E0,0x0000,
-	0xB3E0,0xB430,0xB430,0xB430,0x0000,0xB440,0xB3F0,0xB3F0,0xB3F0,0x0000,0xB3F0,0xB3F0,
-	0xB440,0xB440,0xB440,0xB440,0xB440,0x0000,0xB3F0,0xB440,0xB440,0xB440,0xB440,0xB440,
-	0xB440,0x0000,0xB3F0,0xB3F0,0xB3F0,0xB3F0,0x0000,0xB410,0xB470,0xB470,0xB470,0x0000,
-	0xB410,0xB470,0xB470,0xB470,0x0000,0x0000,0x0000,0xB410,0xB470,0xB470,0xB470,0xB470,
-	0xB470,0x0000,0xB410,0xB470,0xB470,0xB470,0xB470,0x0000,0xB4A0,0xB440,0xB440,0xB440,
-	0x0000,0x0000,0x0000,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,0xB440,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xB430,0xB480,0x0000,0xB480,0xB480,0xB480,0xB480,0x0000,0xB4E0,0xB490,
-	0xB490,0xB490,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC480,0xC4B0,0xC4B0,0xC4D0,0xC4E0,0xC4E0,0xC4F0,0xC520,
-	0xC520,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xB430,0xB480,0x0000,0xB480,0xB480,0xB480,0xB480,0x0000,0xB4E0,0xB490,
-	0xB490,0xB490,0x0000,0x0000,0xB430,0xB430,0x0000,0xB460,0xB460,0x0000,0xB430,0xB430,
-	0xB460,0x0000,0x0000,0xB460,0xB460,0xB460,0xB470,0xB470,0x0000
+static const unsigned char music_e1m3_melody[446] = {
+	0x00,0x9F,0x47,0x8B,0x3C,0x86,0x86,0x3F,0x80,0x9C,0x43,0x80,0xA7,0x42,0x86,0x73,
+	0x3F,0x80,0x9A,0x46,0x80,0xAC,0x45,0x86,0xA8,0x41,0x80,0x9A,0x42,0x80,0x9A,0x43,
+	0x87,0xE1,0x3C,0x86,0x96,0x3F,0x80,0x92,0x43,0x80,0x9F,0x42,0x86,0x8A,0x3F,0x80,
+	0xB4,0x46,0x80,0xAC,0x45,0x86,0x86,0x43,0x80,0x95,0x46,0x80,0xA4,0x48,0x87,0x6E,
+	0x00,0x7A,0x43,0x54,0x00,0x3E,0x3E,0x03,0x43,0x80,0xA4,0x00,0x80,0x88,0x3E,0x81,
+	0x21,0x00,0x4F,0x43,0x08,0x3E,0x60,0x00,0x44,0x44,0x08,0x3F,0x80,0xAE,0x00,0x80,
+	0x97,0x3F,0x03,0x44,0x82,0x1A,0x00,0x54,0x3E,0x69,0x00,0x5B,0x43,0x80,0xB4,0x00,
+	0x80,0x8D,0x3E,0x08,0x43,0x81,0x24,0x00,0x4C,0x43,0x5B,0x00,0x4C,0x43,0x80,0xA7,
+	0x45,0x80,0x9F,0x46,0x80,0xA1,0x45,0x80,0x9C,0x46,0x80,0xA9,0x47,0x12,0x00,0x80,
+	0xA7,0x48,0x83,0xD6,0x47,0x82,0x8D,0x43,0x81,0x66,0x46,0x83,0xF5,0x44,0x82,0x68,
+	0x46,0x81,0x63,0x00,0x12,0x47,0x87,0xCF,0x43,0x80,0xA1,0x00,0x05,0x45,0x80,0xA2,
+	0x00,0x05,0x46,0x80,0xA1,0xA0,0xAB,0x00,0x03,0x46,0x80,0xA2,0x00,0x05,0x47,0x80,
+	0xA2,0x00,0x05,0xA0,0xB9,0x00,0x02,0x47,0x80,0xA1,0x00,0x05,0x48,0x80,0xA1,0x00,
+	0x05,0x4A,0x80,0xA2,0x00,0x05,0x4E,0x80,0xA1,0x00,0x05,0x4F,0x80,0xA2,0x00,0x05,
+	0xA0,0x91,0x00,0x05,0x41,0x81,0x63,0x00,0x12,0x3E,0x03,0x43,0x53,0x00,0x44,0x3E,
+	0x0D,0x43,0x80,0xC4,0x00,0x80,0x8A,0x3E,0x80,0xFB,0x00,0x41,0x3E,0x08,0x43,0x60,
+	0x00,0x3C,0x44,0x03,0x3F,0x6D,0x00,0x3F,0x3F,0x0D,0x44,0x80,0xB6,0x00,0x80,0x85,
+	0x3F,0x05,0x44,0x80,0xFD,0x00,0x44,0x3F,0x80,0x82,0x00,0x24,0x41,0x05,0x47,0x69,
+	0x00,0x41,0x41,0x08,0x47,0x80,0xB1,0x00,0x80,0x9D,0x41,0x05,0x47,0x80,0xEB,0x00,
+	0x46,0x41,0x08,0x47,0x54,0x00,0x4C,0x4A,0x10,0x44,0x80,0x92,0x00,0x80,0xA6,0x44,
+	0x82,0x61,0x00,0x84,0x47,0x43,0x08,0x48,0x73,0x00,0x1D,0x48,0x80,0xDF,0x00,0x75,
+	0x4E,0x05,0x49,0x81,0xE6,0x00,0x83,0xF1,0x8C,0x48,0x80,0xA6,0x4B,0x80,0xA6,0x4D,
+	0x80,0xA6,0x4E,0x80,0xA6,0x4F,0x80,0xA6,0x52,0x80,0xA6,0x00,0x83,0xE7,0x8B,0x43,
+	0x08,0xA0,0x47,0x01,0x06,0x00,0x0D,0x43,0x80,0xBC,0x00,0x81,0x39,0x46,0x80,0xBC,
+	0x00,0x7D,0x43,0x80,0xBC,0x46,0x7D,0x00,0x80,0xBC,0x46,0x81,0x39,0x47,0x80,0xBC,
+	0x00,0xA0,0x03,0x3C,0x86,0x86,0xA0,0x07,0x00,0x41,0xA0,0xAB,0x00,0x03,0xA0,0xB9,
+	0x00,0x04,0xA0,0xB9,0x00,0x02,0xA0,0xC7,0x00,0x0A,0xA0,0x91,0x00,0x05,0xA0,0xE4,
+	0x00,0x39,0xA0,0x47,0x01,0x06,0xA0,0x75,0x01,0x0A,0x00,0x81,0x4D,0xFF
 };
 
-static const int music_e1m3_bass[1485] = {
-	0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,
-	0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,
-	0x0000,0x0000,0x0000,0xC2F0,0xC2F0,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,
-	0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0xC2E0,0x0000,0x0000,0x0000,0xC2F0,
-	0xC2F0,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0xC2E0,
-	0xC2E0,0x0000,0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,
-	0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0xC2E0,0x0000,0x0000,0x0000,
-	0xC2F0,0xC2F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB2B0,0xB2B0,0xB2B0,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,0x0000,0x0000,0xB2B0,
-	0xB2B0,0xB2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2E0,0xB2E0,0xB2F0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC300,0xC300,
-	0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0xC2C0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,
-	0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2A0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2B0,0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,
-	0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0xC2B0,0x0000,0x0000,0xC2D0,
-	0xC2D0,0xC2D0,0xC2D0,0x0000,0x0000,0x0000,0x0000,0xC2F0,0xC2F0,0xC2F0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC300,0xC300,
-	0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0xC2C0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0xB2B0,
-	0xB2B0,0xB2B0,0xB2B0,0xB2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,
-	0x0000,0xB2C0,0xB2C0,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB2F0,0xB2F0,0xB2F0,0xB2F0,0xB2F0,0xB2F0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB320,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,
-	0x0000,0xB2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2D0,0x0000,0x0000,0x0000,
-	0x0000,0xB2E0,0x0000,0xB2F0,0xB2F0,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,
-	0xB2F0,0x0000,0x0000,0x0000,0xB2E0,0x0000,0x0000,0xB2D0,0x0000,0x0000,0xB2E0,0x0000,
-	0x0000,0xB2F0,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,
-	0x0000,0xB2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2D0,0x0000,0x0000,0x0000,
-	0x0000,0xB2E0,0x0000,0xB2F0,0xB2F0,0x0000,0xB2B0,0xB2B0,0x0000,0xB2E0,0xB2E0,0x0000,
-	0xB2B0,0xB2B0,0xB2E0,0x0000,0x0000,0xB2E0,0xB2E0,0xB2E0,0xB2F0,0xB2F0,0x0000,0xB300,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,
-	0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,
-	0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,
-	0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,
-	0x0000,0xC2F0,0xC2F0,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,
-	0xB290,0xB290,0x0000,0x0000,0x0000,0xC2E0,0x0000,0x0000,0x0000,0xC2F0,0xC2F0,0x0000,
-	0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,
-	0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,0xB290,0xB290,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB290,0xB290,0xB290,
-	0xB290,0xB290,0xB290,0x0000,0x0000,0x0000,0xC2E0,0x0000,0x0000,0x0000,0xC2F0,0xC2F0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,
-	0xB2B0,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,0x0000,0x0000,0xB2B0,0xB2B0,0xB2B0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB2E0,0xB2E0,0xB2F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC300,0xC300,0xC300,0xC300,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2E0,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0xC2C0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0xC2B0,0xC2B0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2A0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,
-	0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0xC2B0,0xC2B0,
-	0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0xC2B0,0x0000,0x0000,0xC2D0,0xC2D0,0xC2D0,
-	0xC2D0,0x0000,0x0000,0x0000,0x0000,0xC2F0,0xC2F0,0xC2F0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC300,0xC300,0x0000,0x0000,0x0000,0x0000,0x0000,0xC300,0xC300,0xC300,0xC300,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2E0,0xC2E0,0xC2E0,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2C0,0xC2C0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0x0000,0x0000,0xB2B0,0xB2B0,0xB2B0,
-	0xB2B0,0xB2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,0x0000,0xB2C0,
-	0xB2C0,0xB2C0,0xB2C0,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2F0,
-	0xB2F0,0xB2F0,0xB2F0,0xB2F0,0xB2F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,0x0000,0xB2E0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2D0,0x0000,0x0000,0x0000,0x0000,0xB2E0,
-	0x0000,0xB2F0,0xB2F0,0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0xB2F0,0x0000,
-	0x0000,0x0000,0xB2E0,0x0000,0x0000,0xB2D0,0x0000,0x0000,0xB2E0,0x0000,0x0000,0xB2F0,
-	0x0000,0x0000,0x0000,0xB300,0x0000,0x0000,0x0000,0xB2F0,0x0000,0x0000,0x0000,0xB2E0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2D0,0x0000,0x0000,0x0000,0x0000,0xB2E0,
-	0x0000,0xB2F0,0xB2F0,0x0000,0xB2B0,0xB2B0,0x0000,0xB2E0,0xB2E0,0x0000,0xB2B0,0xB2B0,
-	0xB2E0,0x0000,0x0000,0xB2E0,0xB2E0,0xB2E0,0xB2F0,0xB2F0,0x0000
+static const unsigned char music_e1m3_bass[599] = {
+	0x00,0x80,0xA7,0x8B,0x30,0x80,0xA7,0x00,0x82,0x9B,0x29,0x81,0x4D,0x00,0x83,0x42,
+	0x30,0x80,0xA7,0xA0,0x07,0x00,0x04,0x00,0x82,0x9C,0xA0,0x0A,0x00,0x03,0x00,0x82,
+	0x9C,0x29,0x81,0x4E,0xA0,0x0D,0x00,0x02,0xA0,0x1E,0x00,0x02,0x00,0x83,0x42,0x30,
+	0x80,0xA6,0xA0,0x07,0x00,0x02,0x00,0x80,0xA7,0x8C,0x2E,0x80,0xA7,0x00,0x80,0xA7,
+	0x2F,0x80,0xA7,0x00,0x80,0xA7,0x8B,0x30,0x80,0xA7,0xA0,0x1E,0x00,0x02,0x00,0x83,
+	0x43,0x30,0x80,0xA7,0xA0,0x1E,0x00,0x02,0xA0,0x36,0x00,0x06,0xA0,0x1E,0x00,0x02,
+	0x00,0x83,0x43,0x30,0x80,0xA6,0xA0,0x07,0x00,0x02,0x00,0x80,0xA7,0x8C,0x2E,0x80,
+	0xA6,0xA0,0x3D,0x00,0x04,0xA0,0x1E,0x00,0x02,0xA0,0x4E,0x00,0x02,0xA0,0x1E,0x00,
+	0x02,0xA0,0x36,0x00,0x03,0x2F,0x80,0xA6,0x00,0x81,0x4E,0x8B,0x2B,0x80,0xA7,0x00,
+	0x83,0x42,0x2C,0x82,0x9B,0x00,0x81,0x4E,0x2B,0x80,0xA7,0x00,0x81,0x4E,0x2B,0x54,
+	0x00,0x53,0x2B,0x80,0xA7,0x00,0x81,0xF4,0x2E,0x80,0xA6,0x2F,0x80,0xA7,0x00,0x81,
+	0x4D,0x8C,0x30,0x80,0xA6,0x00,0x81,0x4E,0x30,0x80,0xA7,0x00,0x81,0x4D,0x2F,0x80,
+	0xA6,0x00,0x81,0x4D,0x2E,0x80,0xA6,0xA0,0xC1,0x00,0x02,0x00,0x81,0x4E,0x2E,0x80,
+	0xA7,0x00,0x81,0x4D,0x2C,0x80,0xA6,0x00,0x81,0x4C,0x2C,0x80,0xA6,0x00,0x81,0x4D,
+	0x2B,0x80,0xA6,0x00,0x81,0x4E,0x2B,0x80,0xA7,0x00,0x81,0x4D,0x2A,0x80,0xA6,0x00,
+	0x81,0x4D,0x29,0x80,0xA7,0xA0,0xDD,0x00,0x04,0x00,0x80,0xA7,0x2B,0x80,0xA6,0x00,
+	0x80,0xA6,0x2D,0x80,0xA7,0x00,0x80,0xA6,0x2F,0x80,0xA7,0x00,0x81,0x4D,0x30,0x80,
+	0xA6,0xA0,0xB5,0x00,0x06,0xA0,0xC1,0x00,0x02,0xA0,0xCB,0x00,0x06,0x00,0x81,0x4E,
+	0x2B,0x80,0x9D,0x00,0x80,0xAC,0x8B,0x2B,0x80,0xAC,0x00,0x81,0xF7,0x2C,0x80,0xA4,
+	0x00,0x80,0xAA,0x2C,0x80,0x9F,0x00,0x81,0xFC,0x2F,0x80,0x92,0x00,0x80,0xB9,0x2F,
+	0x80,0xA7,0x00,0x81,0xF5,0x32,0x80,0x8D,0x00,0x82,0xB3,0x30,0x80,0xA1,0x00,0x80,
+	0xAB,0x2F,0x80,0xA1,0x00,0x80,0xAB,0x2E,0x80,0xA1,0x00,0x80,0xAD,0x2D,0x80,0xA1,
+	0xA0,0x54,0x01,0x02,0x00,0x80,0xAB,0x2F,0x80,0xA2,0x00,0x80,0xAB,0xA0,0x4B,0x01,
+	0x05,0x00,0x80,0xAB,0x2D,0x80,0xA1,0xA0,0x54,0x01,0x02,0xA0,0x4E,0x01,0x03,0xA0,
+	0x4B,0x01,0x07,0xA0,0x54,0x01,0x02,0xA0,0x64,0x01,0x02,0x00,0x05,0x2B,0x80,0xBC,
+	0x00,0x81,0x39,0x2E,0x80,0xBC,0x00,0x7D,0x2B,0x80,0xBC,0x2E,0x7D,0x00,0x80,0xBC,
+	0x2E,0x81,0x39,0x2F,0x80,0xBC,0x00,0x81,0x63,0x30,0x80,0xA7,0xA0,0x07,0x00,0x04,
+	0xA0,0x07,0x00,0x04,0x00,0x82,0x9C,0xA0,0x0A,0x00,0x03,0xA0,0x1E,0x00,0x02,0xA0,
+	0x0D,0x00,0x02,0xA0,0x1E,0x00,0x02,0xA0,0x2C,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,
+	0x36,0x00,0x06,0xA0,0x1E,0x00,0x02,0xA0,0x4E,0x00,0x02,0xA0,0x1E,0x00,0x02,0xA0,
+	0x36,0x00,0x06,0xA0,0x1E,0x00,0x02,0xA0,0x60,0x00,0x02,0xA0,0x07,0x00,0x02,0xA0,
+	0x6A,0x00,0x02,0xA0,0x3D,0x00,0x04,0xA0,0x1E,0x00,0x02,0xA0,0x4E,0x00,0x02,0xA0,
+	0x1E,0x00,0x02,0xA0,0x36,0x00,0x03,0xA0,0x85,0x00,0x16,0xA0,0xC1,0x00,0x02,0xA0,
+	0xCB,0x00,0x0E,0xA0,0xDD,0x00,0x04,0xA0,0xF9,0x00,0x08,0xA0,0xB5,0x00,0x06,0xA0,
+	0xC1,0x00,0x02,0xA0,0xCB,0x00,0x06,0xA0,0x1D,0x01,0x16,0xA0,0x54,0x01,0x02,0xA0,
+	0x64,0x01,0x03,0xA0,0x4B,0x01,0x05,0xA0,0x71,0x01,0x02,0xA0,0x54,0x01,0x02,0xA0,
+	0x4E,0x01,0x03,0xA0,0x4B,0x01,0x07,0xA0,0x54,0x01,0x02,0xA0,0x64,0x01,0x02,0xA0,
+	0x8B,0x01,0x0A,0x00,0x81,0x4D,0xFF
 };
 
-static const int music_e1m3_chords[1485] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2E0,
-	0xF2E0,0xF2C0,0x0000,0xF2F0,0xF360,0xF360,0xF360,0xF360,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2E0,0xF350,0xF350,0xF350,0x0000,
-	0xF2F0,0xF360,0xF360,0x0000,0x0000,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,
-	0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF420,0xF420,0xF430,0xF2E0,0xF350,0xF350,
-	0xF420,0xF420,0xF430,0xF430,0xF420,0xF2F0,0xF360,0xF430,0xF430,0xF420,0xF430,0xF430,
-	0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF420,0xF420,
-	0xF430,0xF350,0xF2E0,0xF2E0,0xF420,0xF420,0xF430,0xF430,0xF420,0xF360,0xF430,0xF430,
-	0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF420,0xF430,0xF430,
-	0xF420,0xF420,0xF420,0xF430,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,
-	0xF420,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF420,0xF430,
-	0xF430,0xF420,0xF420,0xF420,0xF430,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,
-	0xF420,0xF420,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF3E0,0xF3E0,
-	0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,
-	0xF410,0x0000,0x0000,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,
-	0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF320,0xF370,0xF370,
-	0x0000,0xF320,0xF320,0xF370,0xF370,0xF370,0xF370,0x0000,0x0000,0xF320,0xF320,0xF320,
-	0xF320,0x0000,0xF320,0xF370,0xF370,0xF370,0x0000,0xF380,0xF330,0xF330,0xF330,0x0000,
-	0xF330,0xF330,0xF380,0xF380,0xF380,0xF380,0xF380,0x0000,0xF330,0xF380,0xF380,0xF380,
-	0xF380,0xF380,0xF380,0x0000,0xF330,0xF330,0xF330,0xF330,0x0000,0xF350,0xF3B0,0xF3B0,
-	0xF3B0,0x0000,0xF350,0xF3B0,0xF3B0,0xF3B0,0x0000,0x0000,0x0000,0xF350,0xF3B0,0xF3B0,
-	0xF3B0,0xF3B0,0xF3B0,0x0000,0xF350,0xF3B0,0xF3B0,0xF3B0,0xF3B0,0x0000,0xF3E0,0xF380,
-	0xF380,0xF380,0x0000,0x0000,0x0000,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,
-	0xF380,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,
-	0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,
-	0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,
-	0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF370,0xF370,0x0000,0xF3A0,0xF3A0,0x0000,
-	0xF370,0xF370,0xF3A0,0x0000,0x0000,0xF3A0,0xF3A0,0xF3A0,0xF3B0,0xF3B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2E0,0xF2E0,0xF2C0,
-	0x0000,0xF2F0,0xF360,0xF360,0xF360,0xF360,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF2E0,0xF350,0xF350,0xF350,0x0000,0xF2F0,0xF360,
-	0xF360,0x0000,0x0000,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,
-	0xF430,0xF430,0xF420,0xF420,0xF420,0xF420,0xF430,0xF2E0,0xF350,0xF350,0xF420,0xF420,
-	0xF430,0xF430,0xF420,0xF2F0,0xF360,0xF430,0xF430,0xF420,0xF430,0xF430,0xF420,0xF420,
-	0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF420,0xF420,0xF430,0xF350,
-	0xF2E0,0xF2E0,0xF420,0xF420,0xF430,0xF430,0xF420,0xF360,0xF430,0xF430,0xF430,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF420,0xF430,0xF430,0xF420,0xF420,
-	0xF420,0xF430,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF420,0xF420,
-	0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF420,0xF430,0xF430,0xF420,
-	0xF420,0xF420,0xF430,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF420,
-	0xF420,0xF420,0xF430,0xF430,0xF420,0xF420,0xF430,0xF430,0xF420,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF420,
-	0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF420,0xF3E0,0xF3E0,0xF3E0,0xF3E0,
-	0xF3E0,0xF3E0,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0x0000,
-	0x0000,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,
-	0xF370,0xF370,0xF370,0xF370,0xF370,0xF370,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF320,0xF370,0xF370,0x0000,0xF320,
-	0xF320,0xF370,0xF370,0xF370,0xF370,0x0000,0x0000,0xF320,0xF320,0xF320,0xF320,0x0000,
-	0xF320,0xF370,0xF370,0xF370,0x0000,0xF380,0xF330,0xF330,0xF330,0x0000,0xF330,0xF330,
-	0xF380,0xF380,0xF380,0xF380,0xF380,0x0000,0xF330,0xF380,0xF380,0xF380,0xF380,0xF380,
-	0xF380,0x0000,0xF330,0xF330,0xF330,0xF330,0x0000,0xF350,0xF3B0,0xF3B0,0xF3B0,0x0000,
-	0xF350,0xF3B0,0xF3B0,0xF3B0,0x0000,0x0000,0x0000,0xF350,0xF3B0,0xF3B0,0xF3B0,0xF3B0,
-	0xF3B0,0x0000,0xF350,0xF3B0,0xF3B0,0xF3B0,0xF3B0,0x0000,0xF3E0,0xF380,0xF380,0xF380,
-	0x0000,0x0000,0x0000,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,0xF380,
-	0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,
-	0xF370,0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,0x0000,0xF370,0x0000,0xF380,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF370,0xF370,0x0000,0xF3A0,0xF3A0,0x0000,0xF370,0xF370,
-	0xF3A0,0x0000,0x0000,0xF3A0,0xF3A0,0xF3A0,0xF3B0,0xF3B0,0x0000
-};
-
-static const int music_e1m3_drums[1485] = {
-	0x001C,0x001C,0x001D,0x001C,0x0024,0x001D,0x001C,0x001D,0x001C,0x001D,0x001C,0x001C,
-	0x001C,0x001C,0x0024,0x0024,0x0024,0x001D,0x0024,0x001C,0x001C,0x001C,0x001D,0x001C,
-	0x0024,0x001D,0x001C,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,
-	0x0024,0x001D,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001D,0x001C,0x001C,0x0024,
-	0x0024,0x001D,0x001C,0x001D,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x0024,0x0024,0x001D,0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,
-	0x001D,0x001C,0x001C,0x0024,0x0024,0x001D,0x001C,0x001D,0x001D,0x001C,0x001D,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x001D,0x0024,0x0024,0x0024,0x001C,
-	0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,0x001E,
-	0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x0024,0x001E,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,
-	0x001E,0x001D,0x001C,0x001E,0x001D,0x001C,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,
-	0x0024,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,
-	0x0024,0x001E,0x001D,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,
-	0x0024,0x001E,0x001D,0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001D,0x001E,0x001C,0x001C,0x001E,0x0024,0x001E,0x001D,0x001E,0x001D,0x001E,0x001C,
-	0x001E,0x001D,0x001C,0x001C,0x001E,0x001E,0x0024,0x001E,0x001D,0x0024,0x0024,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,0x001E,0x001D,
-	0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,
-	0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,
-	0x001D,0x001C,0x001E,0x001D,0x001C,0x001E,0x001D,0x001C,0x001E,0x001E,0x0024,0x001E,
-	0x001E,0x001D,0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001C,
-	0x001E,0x0024,0x001E,0x001D,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,
-	0x001E,0x0024,0x001E,0x001D,0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001C,0x001C,0x001E,0x0024,0x001E,0x001D,0x001E,0x001D,0x001E,
-	0x001C,0x001E,0x001D,0x001C,0x001C,0x001E,0x001E,0x0024,0x001E,0x001D,0x0024,0x0024,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x0024,0x001E,0x001D,0x001D,0x001C,0x001E,0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,
-	0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,
-	0x001E,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,0x001D,0x001D,0x001C,0x001C,0x001E,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x0024,0x001E,0x001D,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001E,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,0x001E,0x001E,
-	0x001D,0x001E,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001D,0x001C,0x001E,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x0024,0x001E,0x001D,0x001D,0x001C,0x001E,0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,
-	0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,
-	0x001E,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,0x001D,0x001D,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x001E,0x0024,0x0024,0x001E,0x001C,
-	0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001E,0x0024,0x0024,0x0024,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001C,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,0x001E,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,0x001E,0x0024,
-	0x001E,0x001D,0x001D,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001C,0x0024,0x0024,0x001C,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x001C,0x0024,0x0024,0x001C,0x001C,0x001C,
-	0x001D,0x001C,0x0024,0x001D,0x001C,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,0x001C,
-	0x0024,0x0024,0x0024,0x001D,0x0024,0x001C,0x001C,0x001C,0x001D,0x001C,0x0024,0x001D,
-	0x001C,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x001D,
-	0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001D,0x001C,0x001C,0x0024,0x0024,0x001D,
-	0x001C,0x001D,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,
-	0x0024,0x001D,0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x001D,0x001C,
-	0x001C,0x0024,0x0024,0x001D,0x001C,0x001D,0x001D,0x001C,0x001D,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x001D,0x0024,0x0024,0x0024,0x001C,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,0x001E,0x001D,0x001E,
-	0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x0024,0x001E,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,0x001E,0x001D,
-	0x001C,0x001E,0x001D,0x001C,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,0x0024,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,0x001E,
-	0x001D,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,
-	0x001D,0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001C,0x001C,0x001E,0x0024,0x001E,0x001D,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,
-	0x001C,0x001C,0x001E,0x001E,0x0024,0x001E,0x001D,0x0024,0x0024,0x001E,0x001E,0x001C,
-	0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,0x001E,
-	0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x0024,0x001E,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001C,0x001E,0x0024,0x001E,0x001D,0x001C,
-	0x001E,0x001D,0x001C,0x001E,0x001D,0x001C,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,
-	0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x0024,
-	0x001E,0x001D,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001C,0x001E,0x0024,
-	0x001E,0x001D,0x0024,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001C,0x001C,0x001E,0x0024,0x001E,0x001D,0x001E,0x001D,0x001E,0x001C,0x001E,
-	0x001D,0x001C,0x001C,0x001E,0x001E,0x0024,0x001E,0x001D,0x0024,0x0024,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001C,0x001E,
-	0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001C,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,
-	0x001D,0x001D,0x001C,0x001E,0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,
-	0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,
-	0x001D,0x001D,0x001E,0x0024,0x001E,0x001D,0x001D,0x001C,0x001C,0x001E,0x001C,0x001E,
-	0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,
-	0x001D,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,0x001E,0x0024,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001D,0x001C,0x001E,0x001C,0x001E,
-	0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001C,
-	0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,0x001D,0x001D,0x001E,0x0024,0x001E,
-	0x001D,0x001D,0x001C,0x001E,0x001C,0x001E,0x001D,0x001E,0x0024,0x0024,0x001E,0x001C,
-	0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x0024,0x001E,0x001E,
-	0x001D,0x001D,0x001E,0x0024,0x001E,0x001D,0x001D,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001D,0x001E,0x001E,0x0024,0x0024,0x001E,0x001C,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x0024,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x0024,0x0024,0x0024,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x0024,0x001E,0x001E,0x001D,0x001E,0x0024,0x001E,0x001D,
-	0x001D,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x001C,0x0024,0x0024,0x001C,0x0024,0x0024,0x0024,0x001C,
-	0x001C,0x001C,0x0024,0x0024,0x001C,0x0024,0x0024,0x001C,0x001C
-};
-
-static const unsigned short music_e1m3_timing[1485] = {
-	  167,  167,    8,  180,  312,    3,  164,   10,  156,    3,  154,   10,
-	   16,   13,  273,   13,   18,    3,  331,    8,  159,  167,    8,  180,
-	  312,    3,  164,   10,  156,    3,  143,    8,   13,   29,  195,   91,
-	   18,    3,  326,    5,   16,  146,    5,  167,    8,  146,   34,  146,
-	  167,    3,  164,    8,    3,  156,    3,    5,  117,   10,   31,    8,
-	   21,  138,  166,    3,    5,    3,  151,  172,   16,  146,    5,  167,
-	    8,  146,   34,  146,  167,    3,  164,    8,    3,  156,    3,    5,
-	  138,   16,    5,    8,   21,  138,  166,    3,    5,  154,  172,    3,
-	   29,  135,  167,    3,    5,  159,   21,  146,  167,    3,    5,  159,
-	    8,    3,  146,   10,    3,  164,   29,  133,  172,    3,    5,  148,
-	  167,   10,    3,  164,  166,    8,  146,   34,  125,  187,    3,  154,
-	   10,   10,  146,   10,    3,  159,    5,   29,  138,  141,   26,    3,
-	   13,  112,   39,  133,   34,    3,  164,  167,    3,    5,  159,   21,
-	  146,  167,    3,    5,  159,    8,    3,  146,   10,    3,  164,   29,
-	  133,  172,    3,    5,  146,  154,   26,    3,   13,  146,    5,  167,
-	    3,    5,  146,   13,   21,  146,  167,    3,  164,    8,    3,  151,
-	    5,    3,    5,  159,    8,   21,  138,  167,    3,  159,    5,  154,
-	   13,    3,   29,  135,  167,    3,    5,  159,   21,  146,  167,    3,
-	    5,  159,    8,    3,  146,   10,    3,  164,   29,  133,  172,    3,
-	    5,  141,  159,   26,    3,  164,  166,    8,  146,   34,  125,  187,
-	    3,  154,   10,   10,  146,   10,    3,  159,    5,   29,  138,  148,
-	   18,    3,   13,  146,    5,  167,    3,  164,  167,    3,    5,  159,
-	   21,  146,  167,    3,    5,  159,    8,    3,  146,   10,    3,  164,
-	   29,  133,  172,    3,    5,  141,  164,   21,    3,   13,  146,    5,
-	  167,    3,    5,  146,   13,   21,  146,  167,    3,  164,    8,    3,
-	  151,    5,    3,    5,  159,    8,   21,  138,  167,    3,  159,    5,
-	   44,  122,    3,   29,   52,   62,    3,   39,  125,   21,  115,   52,
-	    3,  234,   76,    3,    8,   18,   78,   68,    8,    5,    8,  161,
-	  151,    3,   10,  528,   84,   55,    3,   47,   91,   47,  133,   13,
-	  128,    8,   31,    3,  258,   52,   21,    3,   81,   10,   73,    3,
-	    5,  159,    3,  159,  161,  156,   21,  148,   18,  167,    8,  148,
-	   13,  143,   21,  156,   10,    8,  154,    8,  146,   18,    3,  146,
-	    8,   10,    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,
-	  148,   10,  161,    5,    8,  148,   13,  143,   21,  156,   10,    8,
-	  154,    8,  146,   18,    3,  154,   10,    8,  154,   15,  151,    5,
-	  166,   16,  109,   31,   18,  148,   10,  148,   18,    3,    5,  148,
-	   13,  143,   21,  156,   10,    8,  154,    8,  146,   18,    3,  154,
-	    5,    5,    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,
-	  148,   10,  167,    3,    5,  148,    5,    5,    3,  143,   16,    5,
-	  156,    5,    5,    8,  154,    5,    3,  146,   13,    5,    3,  154,
-	    5,    5,    3,    5,  154,    5,   10,  151,    5,  161,    5,   16,
-	  141,    5,    5,    8,  148,    5,    5,  154,    8,    5,    8,  148,
-	   13,  143,   21,  156,   10,    8,  154,    8,  146,   18,    3,  146,
-	    8,   10,    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,
-	  148,   10,  161,    5,    8,  148,   13,  143,   21,  156,   10,    8,
-	  154,    8,  146,   18,    3,  154,   10,    8,  154,   15,  151,    5,
-	  166,   16,  109,   31,   18,  148,   10,  148,   18,    3,    5,   78,
-	   68,    3,   10,    3,  143,   21,   29,  128,   10,    8,  154,    8,
-	   81,   65,    8,   10,    3,   83,   60,    3,    8,   18,   83,   63,
-	    8,    5,   10,  151,    5,    3,   13,  133,    5,   13,   16,  141,
-	   13,    5,   65,   68,   16,    5,    5,  104,   36,    5,   21,    8,
-	   76,   65,    8,   13,  143,   21,    3,  146,    8,    5,   13,  154,
-	    5,    3,   60,   70,    8,    8,   18,    3,   55,   76,   16,    8,
-	   18,  120,   34,   15,  117,   34,    5,  141,   42,  141,   18,  148,
-	   10,   70,   96,  161,    5,  161,    5,  161,    5,  161,    5,  161,
-	    5,  161,    5,    3,    8,  115,   29,   13,  161,    5,   44,  117,
-	    5,  161,  171,  154,    8,    5,  161,    5,  161,    5,  161,    5,
-	  161,    5,  161,    5,  161,    5,  166,  161,    5,  166,  161,    5,
-	  166,  161,    5,  161,    5,  161,    5,  161,    5,  161,    5,  161,
-	    5,  161,    5,    3,    8,  115,   29,   13,  161,    5,   44,  117,
-	    5,  161,  171,  154,    8,    5,  167,   21,  313,  167,   21,  125,
-	   21,  167,  125,   42,  146,   21,  167,  125,   42,  146,  355,  167,
-	    8,  180,  312,    3,  164,   10,  156,    3,  154,   10,   16,   13,
-	  273,   13,   18,    3,  331,    8,  159,  167,    8,  180,  312,    3,
-	  164,   10,  156,    3,  143,    8,   13,   29,  195,   91,   18,    3,
-	  326,    5,   16,  146,    5,  167,    8,  146,   34,  146,  167,    3,
-	  164,    8,    3,  156,    3,    5,  117,   10,   31,    8,   21,  138,
-	  166,    3,    5,    3,  151,  172,   16,  146,    5,  167,    8,  146,
-	   34,  146,  167,    3,  164,    8,    3,  156,    3,    5,  138,   16,
-	    5,    8,   21,  138,  166,    3,    5,  154,  172,    3,   29,  135,
-	  167,    3,    5,  159,   21,  146,  167,    3,    5,  159,    8,    3,
-	  146,   10,    3,  164,   29,  133,  172,    3,    5,  148,  167,   10,
-	    3,  164,  166,    8,  146,   34,  125,  187,    3,  154,   10,   10,
-	  146,   10,    3,  159,    5,   29,  138,  141,   26,    3,   13,  112,
-	   39,  133,   34,    3,  164,  167,    3,    5,  159,   21,  146,  167,
-	    3,    5,  159,    8,    3,  146,   10,    3,  164,   29,  133,  172,
-	    3,    5,  146,  154,   26,    3,   13,  146,    5,  167,    3,    5,
-	  146,   13,   21,  146,  167,    3,  164,    8,    3,  151,    5,    3,
-	    5,  159,    8,   21,  138,  167,    3,  159,    5,  154,   13,    3,
-	   29,  135,  167,    3,    5,  159,   21,  146,  167,    3,    5,  159,
-	    8,    3,  146,   10,    3,  164,   29,  133,  172,    3,    5,  141,
-	  159,   26,    3,  164,  166,    8,  146,   34,  125,  187,    3,  154,
-	   10,   10,  146,   10,    3,  159,    5,   29,  138,  148,   18,    3,
-	   13,  146,    5,  167,    3,  164,  167,    3,    5,  159,   21,  146,
-	  167,    3,    5,  159,    8,    3,  146,   10,    3,  164,   29,  133,
-	  172,    3,    5,  141,  164,   21,    3,   13,  146,    5,  167,    3,
-	    5,  146,   13,   21,  146,  167,    3,  164,    8,    3,  151,    5,
-	    3,    5,  159,    8,   21,  138,  167,    3,  159,    5,   44,  122,
-	    3,   29,   52,   62,    3,   39,  125,   21,  115,   52,    3,  234,
-	   76,    3,    8,   18,   78,   68,    8,    5,    8,  161,  151,    3,
-	   10,  528,   84,   55,    3,   47,   91,   47,  133,   13,  128,    8,
-	   31,    3,  258,   52,   21,    3,   81,   10,   73,    3,    5,  159,
-	    3,  159,  161,  156,   21,  148,   18,  167,    8,  148,   13,  143,
-	   21,  156,   10,    8,  154,    8,  146,   18,    3,  146,    8,   10,
-	    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,  148,   10,
-	  161,    5,    8,  148,   13,  143,   21,  156,   10,    8,  154,    8,
-	  146,   18,    3,  154,   10,    8,  154,   15,  151,    5,  166,   16,
-	  109,   31,   18,  148,   10,  148,   18,    3,    5,  148,   13,  143,
-	   21,  156,   10,    8,  154,    8,  146,   18,    3,  154,    5,    5,
-	    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,  148,   10,
-	  167,    3,    5,  148,    5,    5,    3,  143,   16,    5,  156,    5,
-	    5,    8,  154,    5,    3,  146,   13,    5,    3,  154,    5,    5,
-	    3,    5,  154,    5,   10,  151,    5,  161,    5,   16,  141,    5,
-	    5,    8,  148,    5,    5,  154,    8,    5,    8,  148,   13,  143,
-	   21,  156,   10,    8,  154,    8,  146,   18,    3,  146,    8,   10,
-	    8,  154,   15,  151,    5,  166,   16,  120,   21,   18,  148,   10,
-	  161,    5,    8,  148,   13,  143,   21,  156,   10,    8,  154,    8,
-	  146,   18,    3,  154,   10,    8,  154,   15,  151,    5,  166,   16,
-	  109,   31,   18,  148,   10,  148,   18,    3,    5,   78,   68,    3,
-	   10,    3,  143,   21,   29,  128,   10,    8,  154,    8,   81,   65,
-	    8,   10,    3,   83,   60,    3,    8,   18,   83,   63,    8,    5,
-	   10,  151,    5,    3,   13,  133,    5,   13,   16,  141,   13,    5,
-	   65,   68,   16,    5,    5,  104,   36,    5,   21,    8,   76,   65,
-	    8,   13,  143,   21,    3,  146,    8,    5,   13,  154,    5,    3,
-	   60,   70,    8,    8,   18,    3,   55,   76,   16,    8,   18,  120,
-	   34,   15,  117,   34,    5,  141,   42,  141,   18,  148,   10,   70,
-	   96,  161,    5,  161,    5,  161,    5,  161,    5,  161,    5,  161,
-	    5,    3,    8,  115,   29,   13,  161,    5,   44,  117,    5,  161,
-	  171,  154,    8,    5,  161,    5,  161,    5,  161,    5,  161,    5,
-	  161,    5,  161,    5,  166,  161,    5,  166,  161,    5,  166,  161,
-	    5,  161,    5,  161,    5,  161,    5,  161,    5,  161,    5,  161,
-	    5,    3,    8,  115,   29,   13,  161,    5,   44,  117,    5,  161,
-	  171,  154,    8,    5,  167,   21,  313,  167,   21,  125,   21,  167,
-	  125,   42,  146,   21,  167,  125,   42,  146,  333
+static const unsigned char music_e1m3_chords[416] = {
+	0x00,0x85,0x2C,0x8F,0x2E,0x1A,0x2C,0x0D,0x00,0x81,0x11,0x2F,0x0D,0x36,0x81,0x68,
+	0x00,0x85,0x19,0x2E,0x08,0x35,0x80,0xED,0x00,0x5B,0x2F,0x12,0x36,0x81,0x49,0x00,
+	0x15,0x42,0x80,0x92,0x43,0x80,0xAC,0x42,0x80,0x9A,0x43,0x80,0xB4,0x42,0x80,0xAA,
+	0x43,0x80,0xAC,0x42,0x80,0xA7,0x43,0x75,0x2E,0x0A,0x35,0x27,0x42,0x80,0x9F,0x43,
+	0x80,0xA9,0x42,0x05,0x2F,0x03,0x36,0x80,0x97,0x43,0x80,0xBC,0xA0,0x21,0x00,0x07,
+	0x43,0x80,0x8A,0x35,0x10,0x2E,0x0D,0xA0,0x3C,0x00,0x03,0x36,0x80,0x9A,0x43,0x80,
+	0xCC,0x00,0x97,0x68,0xA0,0x21,0x00,0x07,0x43,0x80,0xA7,0x42,0x80,0x9F,0x43,0x80,
+	0xAA,0x42,0x80,0x9F,0xA0,0x5E,0x00,0x02,0xA0,0x21,0x00,0x07,0xA0,0x68,0x00,0x04,
+	0x43,0x80,0xCB,0x00,0x9F,0x22,0x43,0x83,0xE0,0x42,0x82,0x80,0x3E,0x81,0x6F,0x41,
+	0x83,0xE0,0x00,0x08,0x37,0x83,0xD7,0x00,0x8F,0xA8,0x32,0x03,0x37,0x53,0x00,0x44,
+	0x32,0x0D,0x37,0x80,0xC4,0x00,0x80,0x8A,0x32,0x80,0xFB,0x00,0x41,0x32,0x08,0x37,
+	0x60,0x00,0x3C,0x38,0x03,0x33,0x6D,0x00,0x3F,0x33,0x0D,0x38,0x80,0xB6,0x00,0x80,
+	0x85,0x33,0x05,0x38,0x80,0xFD,0x00,0x44,0x33,0x80,0x82,0x00,0x24,0x35,0x05,0x3B,
+	0x69,0x00,0x41,0x35,0x08,0x3B,0x80,0xB1,0x00,0x80,0x9D,0x35,0x05,0x3B,0x80,0xEB,
+	0x00,0x46,0x35,0x08,0x3B,0x54,0x00,0x4C,0x3E,0x10,0x38,0x80,0x92,0x00,0x80,0xA6,
+	0x38,0x82,0x61,0x00,0x60,0x37,0x80,0xA1,0x00,0x05,0x38,0x80,0xA1,0x00,0x05,0xA0,
+	0xF5,0x00,0x04,0xA0,0xF5,0x00,0x03,0x00,0x83,0xEC,0xA0,0xF5,0x00,0x04,0xA0,0xF5,
+	0x00,0x04,0xA0,0xF5,0x00,0x03,0x00,0x83,0xE9,0xA0,0xF5,0x00,0x04,0xA0,0xF5,0x00,
+	0x04,0xA0,0xF5,0x00,0x03,0x00,0x83,0xEC,0x37,0x80,0xBC,0x00,0x81,0x39,0x3A,0x80,
+	0xBC,0x00,0x7D,0x37,0x80,0xBC,0x3A,0x7D,0x00,0x80,0xBC,0x3A,0x81,0x39,0x3B,0x80,
+	0xBC,0x00,0x85,0xE8,0x2E,0x1A,0xA0,0x06,0x00,0x1B,0xA0,0x21,0x00,0x07,0xA0,0x50,
+	0x00,0x03,0xA0,0x3C,0x00,0x03,0xA0,0x5B,0x00,0x03,0xA0,0x21,0x00,0x07,0xA0,0x68,
+	0x00,0x04,0xA0,0x5E,0x00,0x02,0xA0,0x21,0x00,0x07,0xA0,0x68,0x00,0x04,0xA0,0x80,
+	0x00,0x34,0xA0,0xF5,0x00,0x04,0xA0,0xF5,0x00,0x03,0x00,0x83,0xEC,0xA0,0xF5,0x00,
+	0x04,0xA0,0xF5,0x00,0x04,0xA0,0xF5,0x00,0x03,0x00,0x83,0xE9,0xA0,0xF5,0x00,0x04,
+	0xA0,0xF5,0x00,0x04,0xA0,0xF5,0x00,0x03,0xA0,0x25,0x01,0x0A,0x00,0x81,0x4D,0xFF
 };
 
 #endif
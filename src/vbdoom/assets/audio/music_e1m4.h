@@ -2,627 +2,154 @@
 #ifndef __MUSIC_E1M4_H__
 #define __MUSIC_E1M4_H__
 
-#define MUSIC_E1M4_NOTE_COUNT  1441
-#define MUSIC_E1M4_HAS_ARP     0
+#define MUSIC_E1M4_LENGTH_MS  120001
 
-static const int music_e1m4_melody[1441] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x0000,0x7520,
-	0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x7510,0x0000,
-	0x7520,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,0x7520,0x7520,0x7520,0x0000,0x7510,
-	0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x74D0,0x0000,0x74B0,
-	0x0000,0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74D0,0x74D0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x0000,0x7520,
-	0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x7510,0x0000,
-	0x7520,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,0x7520,0x7520,0x7520,0x0000,0x7510,
-	0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x74D0,0x0000,0x74B0,
-	0x0000,0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74D0,0x74D0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x0000,0x7520,0x0000,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x74D0,0x0000,0x74B0,0x74B0,0x0000,
-	0x74D0,0x74D0,0x74D0,0x74D0,0x0000,0x74F0,0x74F0,0x0000,0x7510,0x0000,0x7520,0x7520,
-	0x7520,0x7520,0x0000,0x7500,0x7500,0x7500,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74D0,0x74D0,0x74D0,0x0000,0x74B0,0x0000,0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,
-	0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x0000,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,
-	0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,0x74A0,
-	0x74A0,0x0000,0x74B0,0x74B0,0x74B0,0x74B0,0x0000,0x74D0,0x74D0,0x74D0,0x0000,0x74F0,
-	0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x0000,0x74F0,0x74F0,0x74F0,0x0000,0x7510,
-	0x7510,0x0000,0x7520,0x7520,0x7520,0x7520,0x0000,0x7510,0x7510,0x7510,0x0000,0x74F0,
-	0x74F0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x7510,0x7510,0x7510,0x7510,0x0000,0x7520,0x0000,
-	0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,0x74C0,0x74C0,0x74C0,0x74C0,0x0000,0x7510,
-	0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74E0,
-	0x74E0,0x0000,0x74C0,0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x0000,0x7560,0x7560,0x7560,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x0000,0x7520,0x7520,0x0000,0x7540,0x0000,
-	0x7560,0x7560,0x7560,0x7560,0x7560,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,0x7520,
-	0x7520,0x0000,0x7540,0x7540,0x7540,0x7540,0x7540,0x0000,0x74D0,0x74D0,0x74D0,0x74D0,
-	0x74D0,0x0000,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x0000,
-	0x7570,0x7570,0x0000,0x7560,0x0000,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,
-	0x0000,0x7540,0x7540,0x0000,0x7560,0x0000,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,
-	0x7570,0x0000,0x7560,0x7560,0x0000,0x7540,0x0000,0x7560,0x7560,0x7560,0x7560,0x0000,
-	0x7510,0x7510,0x7510,0x7510,0x0000,0x7520,0x7520,0x7520,0x7520,0x7520,0x0000,0x7540,
-	0x7540,0x7540,0x7540,0x7540,0x0000,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x7560,0x0000,0x7520,0x7520,0x0000,0x7540,0x0000,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,0x7520,0x7520,0x0000,
-	0x7540,0x7540,0x7540,0x7540,0x7540,0x0000,0x74D0,0x74D0,0x74D0,0x74D0,0x74D0,0x0000,
-	0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x7590,0x0000,0x7570,0x7570,
-	0x0000,0x7560,0x0000,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,0x0000,0x7540,
-	0x7540,0x0000,0x7560,0x0000,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,0x7570,0x0000,
-	0x7560,0x7560,0x0000,0x7540,0x0000,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x0000,
-	0x7570,0x7570,0x7570,0x7570,0x7570,0x0000,0x7590,0x7590,0x7590,0x0000,0x75B0,0x75B0,
-	0x0000,0x7590,0x7590,0x7590,0x7590,0x7590,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,
-	0x7590,0x7590,0x0000,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,0x7560,
-	0x7560,0x7560,0x7560,0x7560,0x7560,0x0000,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x0000,
-	0x75D0,0x75D0,0x75D0,0x0000,0x75E0,0x75E0,0x0000,0x75D0,0x75D0,0x75D0,0x75D0,0x75D0,
-	0x0000,0x7590,0x7590,0x7590,0x0000,0x7560,0x7560,0x0000,0x75B0,0x75B0,0x75B0,0x75B0,
-	0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,
-	0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x75B0,0x0000,
-	0x75E0,0x75E0,0x75E0,0x75E0,0x75E0,0x0000,0x7600,0x7600,0x7600,0x7600,0x0000,0x7610,
-	0x7610,0x0000,0x7600,0x7600,0x7600,0x7600,0x7600,0x0000,0x75C0,0x75C0,0x75C0,0x75C0,
-	0x0000,0x7590,0x7590,0x0000,0x75E0,0x75E0,0x75E0,0x75E0,0x75E0,0x0000,0x7600,0x7600,
-	0x7600,0x0000,0x7610,0x7610,0x0000,0x7650,0x7650,0x7650,0x7650,0x7650,0x0000,0x7630,
-	0x7630,0x7630,0x7630,0x0000,0x7600,0x7600,0x0000,0x7610,0x7610,0x7610,0x7610,0x7610,
-	0x7610,0x7610,0x7610,0x7610,0x0000,0x75E0,0x75E0,0x0000,0x7600,0x0000,0x7610,0x7610,
-	0x7610,0x7610,0x7610,0x7610,0x7610,0x7610,0x7610,0x7610,0x7610,0x0000,0x7630,0x7630,
-	0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x0000,0x7600,0x7600,0x0000,0x7610,
-	0x0000,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x7630,0x0000,
-	0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,
-	0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,
-	0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x7650,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x94D0,0x94D0,0x0000,0x94E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x9520,
-	0x0000,0x0000,0x0000,0x9510,0x9510,0x0000,0x0000,0x94D0,0x94D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x0000,0x7510,0x0000,0x7520,0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x0000,0x7510,0x7510,0x0000,0x7520,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,
-	0x7520,0x7520,0x7520,0x0000,0x7510,0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74D0,0x74D0,0x74D0,0x0000,0x74B0,0x0000,0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x0000,0x7510,0x0000,0x7520,0x0000,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,
-	0x74E0,0x74E0,0x74E0,0x74E0,0x74E0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x0000,0x7510,0x7510,0x0000,0x7520,0x0000,0x7540,0x7540,0x7540,0x7540,0x0000,
-	0x7520,0x7520,0x7520,0x0000,0x7510,0x7510,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x74D0,0x74D0,0x74D0,0x0000,0x74B0,0x0000,0x7510,0x7510,0x7510,0x7510,0x7510,0x0000,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,
-	0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,
-	0x7510,0x0000,0x7520,0x0000,0x74F0,0x74F0,0x74F0,0x74F0,0x74F0,0x0000,0x74D0,0x74D0,
-	0x74D0
+static const unsigned char music_e1m4_melody[605] = {
+	0x00,0xD3,0x77,0x87,0x4F,0x82,0x8D,0x00,0x09,0x51,0x65,0x00,0x09,0x52,0x65,0x00,
+	0x09,0x4E,0x83,0x6B,0x00,0x09,0x4F,0x82,0x8C,0x00,0x09,0x51,0x66,0xA0,0x0B,0x00,
+	0x03,0x54,0x81,0x42,0x00,0x09,0x52,0x81,0x41,0x00,0x09,0x51,0x80,0xD4,0x00,0x09,
+	0x4F,0x81,0x42,0x00,0x09,0x4D,0x81,0x42,0x00,0x09,0x4B,0x80,0xD3,0x00,0x09,0x51,
+	0x81,0x43,0xA0,0x2E,0x00,0x03,0x4D,0x80,0xD4,0x00,0x09,0x4F,0x86,0xDB,0x00,0x09,
+	0x4F,0x82,0x8D,0xA0,0x07,0x00,0x0A,0xA0,0x0B,0x00,0x03,0xA0,0x21,0x00,0x0D,0xA0,
+	0x2E,0x00,0x03,0xA0,0x46,0x00,0x02,0x4F,0x86,0xDD,0xA0,0x4E,0x00,0x02,0xA0,0x07,
+	0x00,0x05,0x4F,0x81,0x43,0xA0,0x33,0x00,0x03,0x4B,0x80,0xD4,0x00,0x09,0x4D,0x82,
+	0x8C,0x00,0x09,0x4F,0x66,0xA0,0x07,0x00,0x03,0x52,0x81,0xB0,0x00,0x09,0x50,0x81,
+	0xB0,0xA0,0x2E,0x00,0x08,0xA0,0x2E,0x00,0x03,0xA0,0x46,0x00,0x02,0x4A,0x86,0xDB,
+	0x00,0x09,0x4B,0x81,0x42,0xA0,0x33,0x00,0x03,0x4F,0x80,0xD3,0x00,0x09,0x4E,0x81,
+	0x43,0xA0,0x2E,0x00,0x03,0xA0,0x2B,0x00,0x02,0x52,0x81,0x42,0x00,0x09,0x51,0x81,
+	0x41,0x00,0x09,0x4F,0x80,0xD4,0x00,0x09,0x4F,0x83,0x69,0xA0,0x2E,0x00,0x03,0x51,
+	0x81,0x42,0x00,0x09,0x52,0x80,0xD3,0xA0,0x3D,0x00,0x02,0x00,0x09,0x4C,0x81,0x42,
+	0xA0,0x29,0x00,0x03,0x4F,0x85,0xFE,0x00,0x09,0x4E,0x66,0x00,0x09,0x4C,0x65,0x00,
+	0x09,0x4E,0x86,0xDE,0x00,0x09,0x56,0x82,0x8E,0x00,0x09,0x52,0x66,0x00,0x09,0x54,
+	0x65,0x00,0x09,0x56,0x81,0x43,0x00,0x09,0xA0,0x21,0x00,0x02,0x52,0x80,0xD4,0x00,
+	0x09,0x54,0x81,0xB1,0x00,0x09,0x4D,0x81,0xB1,0x00,0x09,0x59,0x82,0x8E,0x00,0x09,
+	0x57,0x66,0x00,0x09,0x56,0x65,0x00,0x09,0x57,0x82,0x8E,0x00,0x09,0x54,0x66,0xA0,
+	0x22,0x01,0x05,0x56,0x66,0xA0,0xFD,0x00,0x03,0x56,0x81,0xB1,0x00,0x09,0x51,0x81,
+	0xB1,0x00,0x09,0x52,0x81,0xB1,0xA0,0x0F,0x01,0x03,0xA0,0xF6,0x00,0x08,0xA0,0x21,
+	0x00,0x02,0xA0,0x0C,0x01,0x0F,0xA0,0x22,0x01,0x05,0x56,0x66,0xA0,0xFD,0x00,0x03,
+	0x56,0x86,0xDF,0x00,0x09,0x57,0x81,0x43,0x00,0x09,0x59,0x81,0x42,0x00,0x09,0x5B,
+	0x80,0xD4,0x00,0x09,0x59,0x81,0x43,0x00,0x09,0xA0,0x21,0x00,0x02,0x59,0x80,0xD4,
+	0x00,0x09,0xA0,0x60,0x01,0x02,0x5B,0x81,0x43,0x00,0x09,0x5D,0x81,0x42,0x00,0x09,
+	0x5E,0x80,0xD4,0x00,0x09,0x5D,0x81,0x43,0xA0,0x68,0x01,0x03,0x56,0x80,0xD4,0x00,
+	0x09,0x5B,0x86,0xDF,0x00,0x09,0x5E,0x81,0x43,0x00,0x09,0x60,0x81,0x42,0x00,0x09,
+	0x61,0x80,0xD4,0x00,0x09,0x60,0x81,0x43,0x00,0x09,0x5C,0x81,0x42,0x00,0x09,0xA0,
+	0x7D,0x01,0x02,0xA0,0xA6,0x01,0x06,0x65,0x81,0x43,0x00,0x09,0x63,0x81,0x42,0x00,
+	0x09,0x60,0x80,0xD4,0x00,0x09,0x61,0x82,0x8E,0x00,0x09,0x5E,0x66,0x00,0x09,0x60,
+	0x65,0x00,0x09,0x61,0x83,0x6B,0x00,0x09,0x63,0x82,0x8E,0x00,0x09,0x60,0x66,0x00,
+	0x09,0x61,0x65,0x00,0x09,0x63,0x83,0x6B,0x00,0x09,0x65,0x8D,0xB7,0x00,0xC4,0x04,
+	0x89,0x4D,0x81,0xB1,0x00,0x09,0x4E,0x80,0x8A,0x00,0x82,0x0D,0x52,0x80,0x8A,0x00,
+	0x80,0xC2,0x51,0x80,0x8B,0x00,0x80,0xC1,0x4D,0x80,0x8A,0x00,0x87,0x39,0x87,0x4F,
+	0x82,0x8D,0xA0,0x07,0x00,0x0A,0xA0,0x0B,0x00,0x03,0xA0,0x21,0x00,0x0D,0xA0,0x2E,
+	0x00,0x03,0xA0,0x46,0x00,0x05,0xA0,0x07,0x00,0x0A,0xA0,0x0B,0x00,0x03,0xA0,0x21,
+	0x00,0x0D,0xA0,0x2E,0x00,0x03,0xA0,0x46,0x00,0x02,0x4F,0x86,0xDD,0xA0,0x4E,0x00,
+	0x02,0xA0,0x07,0x00,0x05,0x4F,0x81,0x43,0xA0,0x33,0x00,0x02,0xFF
 };
 
-static const int music_e1m4_bass[1441] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000
+static const unsigned char music_e1m4_bass[13] = {
+	0x00,0xFF,0x6B,0x00,0xFF,0xAD,0x00,0xFE,0x94,0x00,0xD7,0x15,0xFF
 };
 
-static const int music_e1m4_chords[1441] = {
-	0xF2F0,0x1530,0x0000,0x3470,0x0000,0x3530,0x0000,0x3470,0x0000,0x5530,0x0000,0x5470,
-	0x0000,0x5530,0x0000,0x7470,0x0000,0x7530,0x0000,0x9470,0x0000,0x9530,0x0000,0x9470,
-	0x0000,0xA530,0x0000,0xA470,0x0000,0xC530,0x0000,0xF2B0,0xC4F0,0x0000,0xC430,0x0000,
-	0xC4F0,0x0000,0xC430,0x0000,0xC4F0,0x0000,0xC430,0x0000,0xC4F0,0x0000,0xC430,0x0000,
-	0xC4F0,0x0000,0xC430,0x0000,0xC4F0,0x0000,0xC430,0x0000,0xC4F0,0x0000,0xC430,0x0000,
-	0xC4F0,0x0000,0xF280,0xC530,0x0000,0xC470,0x0000,0xC530,0x0000,0xC470,0x0000,0xC530,
-	0x0000,0xC470,0x0000,0xC530,0x0000,0xC470,0x0000,0xC530,0x0000,0xC470,0x0000,0xC530,
-	0x0000,0xC470,0x0000,0xC530,0x0000,0xC490,0x0000,0xC550,0x0000,0xF300,0xC560,0x0000,
-	0xC4A0,0x0000,0xC560,0x0000,0xC480,0x0000,0xC540,0x0000,0xC4A0,0x0000,0xC560,0x0000,
-	0xC4D0,0x0000,0xC590,0x0000,0xC4D0,0x0000,0xC590,0x0000,0xC4B0,0x0000,0xC570,0x0000,
-	0xC4B0,0x0000,0xC570,0x0000,0x0000,0xC560,0x0000,0xF320,0xF320,0x0000,0xF2C0,0xF2C0,
-	0x0000,0xC4A0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA560,0x0000,
-	0xF320,0xF320,0x0000,0xF2C0,0xF2C0,0x0000,0x94A0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x7560,0x0000,0xF320,0xF320,0x0000,0xF2C0,0xF2C0,0x0000,0x54A0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3560,0x0000,0xF320,0xF320,
-	0x0000,0xF2C0,0x0000,0x14A0,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0xF520,0x0000,0xF2B0,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF370,0x0000,0xF2B0,0xF2B0,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0xF520,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,
-	0x0000,0xF290,0xF290,0xF4F0,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xC3C0,0x0000,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0xF520,0x0000,0xF2B0,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF370,0x0000,0xF2B0,0xF2B0,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0xF520,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,
-	0x0000,0xF290,0xF290,0xF4F0,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF520,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF4D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF510,0x0000,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC390,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,
-	0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF4F0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0xF510,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF290,
-	0xF290,0x0000,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0x0000,0xF280,0xF280,0x0000,
-	0xF280,0xC3C0,0xF280,0xF280,0xF280,0xF280,0x0000,0xF280,0xF280,0x0000,0xF2D0,0x0000,
-	0xF2D0,0xF2D0,0xF4C0,0xF2D0,0xF2D0,0xF2D0,0xF2D0,0x0000,0xF2D0,0xF2D0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF4C0,0x0000,0xF320,
-	0xF320,0xF320,0xF320,0x0000,0xF320,0xF320,0x0000,0xF320,0xF320,0x0000,0xF320,0xF320,
-	0x0000,0xF320,0xF320,0xF510,0x0000,0xF320,0xF320,0xF4E0,0x0000,0xF320,0xF320,0xF450,
-	0x0000,0xF320,0xF420,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0xF460,0x0000,0xF2B0,
-	0xF2B0,0xF430,0x0000,0xF2B0,0xF2B0,0xF480,0x0000,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0xF540,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF560,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF560,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xF540,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0xF460,0x0000,0xF2B0,0xF2B0,0xF430,
-	0x0000,0xF2B0,0xF2B0,0xF480,0x0000,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0xF540,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF560,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF560,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF540,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF590,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF540,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0xF520,0x0000,0xF2B0,0xF2B0,0xF4F0,0x0000,0xF2B0,0xF2B0,0xF460,0x0000,
-	0xF2B0,0xF2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF5D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF590,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0xF560,0x0000,0xF2B0,0xF2B0,0xF520,
-	0x0000,0xF2B0,0xF2B0,0xF4A0,0x0000,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2A0,0xF2A0,0x0000,
-	0xF2A0,0xF2A0,0xF600,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0x0000,0xF2C0,
-	0xF2C0,0x0000,0xF2C0,0xF2C0,0xF5C0,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF600,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF630,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0x0000,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,
-	0x0000,0xF2A0,0xF2A0,0xF600,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,
-	0x0000,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0x0000,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,
-	0x0000,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0xF610,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,
-	0x0000,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0x0000,0xF2E0,0x0000,
-	0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,
-	0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,
-	0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0x0000,0xF2E0,0xF2E0,0xC4B0,0x0000,0xC4D0,0x0000,
-	0xC460,0x0000,0xC460,0x0000,0xC4B0,0x0000,0xC4D0,0x0000,0xC460,0x0000,0xC4D0,0x0000,
-	0xF2C0,0x0000,0xC4B0,0x0000,0xF2C0,0x0000,0xC460,0x0000,0xC520,0x0000,0xC460,0x0000,
-	0xC500,0x0000,0xC460,0x0000,0xC520,0x0000,0xF2A0,0xC4B0,0x0000,0xC4D0,0x0000,0xC460,
-	0x0000,0xC460,0x0000,0xC4B0,0x0000,0xC4D0,0x0000,0xC460,0x0000,0xC4D0,0x0000,0xC4B0,
-	0x0000,0xC4D0,0x0000,0xC460,0x0000,0xF290,0xC460,0x0000,0xC510,0x0000,0xC460,0x0000,
-	0xC4E0,0x0000,0xF2E0,0xC4B0,0x0000,0xC4D0,0xC4D0,0x0000,0xC460,0x0000,0xC460,0x0000,
-	0xC4B0,0x0000,0xC4D0,0x0000,0xC460,0x0000,0xC4D0,0x0000,0xF2C0,0xF2C0,0x0000,0xC4B0,
-	0x0000,0xF2C0,0xF2C0,0x0000,0xC460,0x0000,0xC520,0x0000,0xC460,0x0000,0xC500,0x0000,
-	0xC460,0x0000,0xC520,0x0000,0xF2A0,0xC4B0,0x0000,0xC4D0,0x0000,0xC460,0x0000,0xC460,
-	0x0000,0xC4B0,0x0000,0xC4D0,0x0000,0xC460,0x0000,0xC4D0,0x0000,0xC4B0,0x0000,0xC4D0,
-	0x0000,0xC460,0x0000,0xF290,0xF290,0xC460,0x0000,0xC510,0x0000,0xC460,0x0000,0xC4E0,
-	0x0000,0xF350,0xF350,0xF350,0xF350,0x0000,0xF360,0xF360,0x0000,0xF3A0,0xF3A0,0x0000,
-	0xF390,0xF390,0x0000,0xF350,0xF350,0xF350,0x0000,0xF360,0x0000,0xF330,0x0000,0xF300,
-	0xF300,0x0000,0xF350,0xF350,0x0000,0xF360,0xF360,0x0000,0x0000,0x0000,0x0000,0xF3A0,
-	0xF3A0,0x0000,0x0000,0xF390,0xF390,0xF390,0x0000,0xF350,0xF350,0xF350,0x0000,0x0000,
-	0x0000,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0xF520,0x0000,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,
-	0xF370,0x0000,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF520,0xF2B0,0xF2B0,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF290,0x0000,0xF290,0xF290,0xF4F0,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0xC3C0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0xF520,0x0000,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,
-	0xF370,0x0000,0xF2B0,0xF2B0,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF520,0xF2B0,0xF2B0,0xF2B0,
-	0xF2B0,0x0000,0xF2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF290,0x0000,0xF290,0xF290,0xF4F0,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,
-	0x0000,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,0xF2B0,0xF2B0,0x0000,
-	0xF2B0,0xF2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF520,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF4D0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000
-};
-
-static const int music_e1m4_drums[1441] = {
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,
-	0x001C,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001C,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,
-	0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001F,0x001E,0x001C,0x001F,0x001F,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001D,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001E,0x001D,0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001D,
-	0x001D,0x001E,0x001D,0x001D,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,0x001D,
-	0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,0x001C,0x0022,0x0022,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,
-	0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,
-	0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,
-	0x001C,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x001D,0x0022,0x001E,0x0022,0x0022,
-	0x0022,0x001C,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x001D,0x0022,0x001E,0x0022,
-	0x0022,0x0022,0x001C,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x001C,0x0022,0x0022,
-	0x001E,0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x001C,0x0022,0x001D,0x001D,0x001E,
-	0x0022,0x001D,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,0x001D,0x0022,0x0022,
-	0x0022,0x001E,0x0022,0x0022,0x0022,0x001C,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,
-	0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,0x001C,0x0022,
-	0x0022,0x0022,0x0022,0x001E,0x0022,0x001D,0x0022,0x001E,0x0022,0x0022,0x0022,0x001C,
-	0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x001D,0x0022,0x001E,0x0022,0x0022,0x0022,
-	0x001C,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x001C,0x0022,0x001E,0x0022,0x001C,
-	0x0022,0x001E,0x0022,0x001C,0x0022,0x001D,0x001E,0x0022,0x001D,0x001C,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,
-	0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,
-	0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001E,0x0022,0x0022,
-	0x001C,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,
-	0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,
-	0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,
-	0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,
-	0x0022,0x001C,0x0022,0x001D,0x001D,0x001E,0x0022,0x001D,0x001D,0x001C,0x0022,0x0022,
-	0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,0x0022,0x001C,
-	0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001E,0x0022,
-	0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x001E,
-	0x0022,0x0022,0x001C,0x0022,0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,
-	0x0022,0x001E,0x0022,0x0022,0x001D,0x0022,0x0022,0x001D,0x0022,0x0022,0x001D,0x0022,
-	0x0022,0x001D,0x0022,0x0022,0x0022,0x001D,0x0022,0x0022,0x0022,0x0022,0x001D,0x0022,
-	0x0022,0x001D,0x0022,0x0022,0x001F,0x0022,0x0022,0x0022,0x001D,0x001D,0x0022,0x001D,
-	0x001D,0x0022,0x001D,0x001D,0x0022,0x001D,0x001D,0x001D,0x0022,0x001D,0x001D,0x001D,
-	0x001D,0x0022,0x001D,0x001D,0x0022,0x001D,0x001D,0x001F,0x001D,0x001D,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001C,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001D,0x001D,0x001F,
-	0x001F,0x001F,0x001D,0x001D,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001F,0x001F,0x001C,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,
-	0x001F,0x001D,0x001F,0x001D,0x001F,0x001F,0x001D,0x001F,0x001F,0x001D,0x001F,0x001F,
-	0x001D,0x001F,0x001F,0x001F,0x001D,0x001F,0x001F,0x001F,0x001F,0x001F,0x001F,0x001D,
-	0x001F,0x001F,0x001F,0x001D,0x001D,0x001F,0x001F,0x001F,0x001D,0x001F,0x001C,0x001F,
-	0x001F,0x001F,0x001D,0x001D,0x001F,0x001F,0x001F,0x001D,0x001F,0x001F,0x001F,0x001C,
-	0x001D,0x001F,0x001E,0x001F,0x001F,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,0x001D,0x001D,
-	0x001E,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,
-	0x001E
-};
-
-static const unsigned short music_e1m4_timing[1441] = {
-	  221,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,
-	    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,
-	    9,  211,    9,  211,    9,  211,    9,  221,  211,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  221,  211,    9,  211,    9,  211,    9,  211,    9,  211,
-	    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,
-	    9,  211,    9,  211,    9,  211,    9,  211,    9,  221,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,   14,  216,  211,    9,    5,  207,    9,    5,  207,
-	    9,  211,   14,  216,    5,  216,    5,  216,    5,  216,  211,    9,
-	    5,  207,    9,    5,  207,    9,  211,   14,  216,    5,  216,    5,
-	  216,    5,  216,  211,    9,    5,  207,    9,    5,  207,    9,  211,
-	   14,  216,    5,  216,    5,  216,    5,  216,  211,    9,    5,  207,
-	    9,  211,    9,  211,   14,  216,    5,  216,  220,    5,  207,    9,
-	  211,    9,    5,  207,    9,    5,  106,  101,    9,  101,    9,  101,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,
-	    9,  211,    9,    5,  207,    9,  110,  101,    9,    5,   97,    9,
-	  101,    9,  110,  110,    5,   97,    9,  101,    9,  211,    9,    5,
-	  207,    9,  110,  110,    5,   97,    9,  110,    5,  207,    9,  211,
-	    9,    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,
-	    5,  207,    9,  211,    9,    5,  207,    9,  110,  101,    9,    5,
-	  207,    9,  211,    9,    5,  207,    9,  211,    9,    5,  207,    9,
-	  211,    9,    5,  207,    9,    5,  106,  101,    9,  101,    9,  101,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,
-	    9,  211,    9,    5,  207,    9,  110,  101,    9,    5,   97,    9,
-	  101,    9,  110,  110,    5,   97,    9,  101,    9,  211,    9,    5,
-	  207,    9,  110,  110,    5,   97,    9,  110,    5,  207,    9,  211,
-	    9,    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,
-	    5,  207,    9,  211,    9,    5,  207,    9,  211,    9,    5,  207,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,   14,  207,    9,
-	  220,    5,  216,    5,  106,  101,    9,  101,    9,  101,    9,    5,
-	  106,  110,    5,   97,    9,  110,    5,  207,    9,    5,  207,    9,
-	  225,  216,  110,  101,    9,    5,   97,    9,  101,    9,  211,    9,
-	    5,  207,    9,  211,   14,  207,    9,  110,  110,    5,   97,    9,
-	  110,    5,  207,    9,  211,    9,    5,  106,  110,    5,   97,    9,
-	  110,    5,  207,    9,    5,  207,    9,  211,    9,    5,  207,    9,
-	  211,    9,    5,  207,    9,  211,    9,    5,  207,    9,  211,   14,
-	  207,    9,  110,  110,    5,   97,    9,  110,    5,  207,    9,  211,
-	    9,    5,  106,  110,    5,   97,    9,  110,    5,  207,    9,    5,
-	  207,    9,  110,  110,    5,   97,    9,  101,    9,  211,    9,    5,
-	  207,    9,  211,    9,    5,  207,    9,  211,    9,    5,  207,    9,
-	  110,  110,    5,   97,    9,  101,    9,    5,  207,    9,  211,    9,
-	    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,    5,
-	  207,    9,  225,  216,  225,  216,  225,  216,  110,  101,    9,    5,
-	   97,    9,  101,    9,    5,  207,    9,    5,  207,    9,    5,  207,
-	    9,    5,  106,  101,    9,    5,  106,  101,    9,    5,  106,  101,
-	    9,  110,  101,    9,    5,  207,    9,    5,  106,  101,    9,    5,
-	  106,  101,    9,    5,  106,  101,    9,    5,   97,    9,  101,    9,
-	    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,    5,
-	  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,
-	  207,    9,    5,  207,    9,    5,  207,    9,    5,  106,  101,    9,
-	    5,   97,    9,  101,    9,    5,  216,    5,  216,    5,  106,  101,
-	    9,    5,   97,    9,  101,    9,    5,  216,    5,  216,    5,  106,
-	  101,    9,    5,   97,    9,  101,    9,    5,  216,    5,  207,    9,
-	    5,  216,    5,  207,    9,    5,  216,    5,  106,  101,    9,    5,
-	  106,  110,    5,  207,    9,    5,  106,  101,    9,    5,  106,  101,
-	    9,    5,  106,  101,    9,    5,   97,    9,  101,    9,    5,  106,
-	  110,    5,   97,    9,  101,    9,    5,  207,    9,    5,  207,    9,
-	    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,
-	    5,  207,    9,    5,  207,    9,    5,  106,  101,    9,    5,   97,
-	    9,  101,    9,    5,  216,    5,  216,    5,  106,  101,    9,    5,
-	   97,    9,  101,    9,    5,  216,    5,  216,    5,  106,  101,    9,
-	    5,   97,    9,  101,    9,    5,  216,    5,  216,    5,  216,    5,
-	  216,    5,  216,    5,  106,  110,    5,  106,  110,    5,  207,    9,
-	    5,  106,  110,    5,   97,    9,  110,    5,  207,    9,    5,  207,
-	    9,    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,
-	    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,
-	    5,  106,  101,    9,    5,  106,  101,    9,    5,  106,  101,    9,
-	    5,  207,    9,    5,  207,    9,    5,  106,  110,    5,   97,    9,
-	  110,    5,  207,    9,    5,  207,    9,    5,  106,  110,    5,   97,
-	    9,  110,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,
-	  207,    9,    5,  207,    9,    5,  106,  101,    9,    5,  106,  101,
-	    9,    5,  106,  101,    9,    5,  106,  101,    9,    5,  207,    9,
-	    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,    9,    5,
-	  207,    9,    5,  106,  110,    5,   97,    9,  101,    9,    5,  207,
-	    9,    5,  207,    9,    5,  106,  110,    5,   97,    9,  110,    5,
-	  207,    9,    5,  207,    9,    5,  106,  110,    5,   97,    9,  101,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,
-	    9,    5,  106,  101,    9,    5,   97,    9,  101,    9,    5,  207,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,    5,  207,
-	    9,    5,  207,    9,    5,  106,  101,    9,    5,   97,    9,  101,
-	    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,  212,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,
-	  211,    9,  211,    9,  101,    9,  211,    9,  101,    9,  211,    9,
-	  211,    9,  211,    9,  211,    9,  211,    9,  211,    9,  101,    9,
-	  211,    9,  101,    9,  211,    9,  221,  211,    9,  211,    9,  211,
-	    9,  211,    9,  101,    9,  211,    9,  101,    9,  211,  230,  211,
-	    9,  211,    9,  211,    9,  221,  101,    9,  211,    9,  101,    9,
-	  211,    9,  221,  211,    9,    5,  207,    9,  211,    9,  211,    9,
-	  101,    9,  211,    9,  101,    9,  211,    9,    5,  207,    9,  211,
-	    9,    5,  207,    9,  211,    9,  211,    9,  101,    9,  211,    9,
-	  101,    9,  211,    9,  221,  211,    9,  212,    9,  211,    9,  211,
-	    9,  101,    9,  211,    9,  101,    9,  211,  230,  211,    9,  211,
-	    9,  211,    9,    5,  216,  101,    9,  211,    9,  101,    9,  211,
-	    9,    5,  106,  110,  211,    9,    5,  207,  451,    5,  207,  119,
-	    5,  207,  119,  111,  110,  211,    9,  212,  451,  212,  119,    5,
-	  207,  119,  226,  207,    9,  138,   74,   14,  216,    5,  216,  138,
-	   74,   14,  106,    5,  134,   74,  119,    5,  133,   74,  892,  220,
-	    5,  437,    5,  207,    9,  211,    9,    5,  207,    9,    5,  106,
-	  101,    9,  101,    9,  101,    9,    5,  207,    9,    5,  207,    9,
-	    5,  207,    9,    5,  207,    9,  211,    9,    5,  207,    9,  110,
-	  101,    9,    5,   97,    9,  101,    9,  110,  110,    5,   97,    9,
-	  101,    9,  211,    9,    5,  207,    9,  110,  110,    5,   97,    9,
-	  110,    5,  207,    9,  211,    9,    5,  106,  110,    5,   97,    9,
-	  101,    9,    5,  207,    9,    5,  207,    9,  211,    9,    5,  207,
-	    9,  110,  101,    9,    5,  207,    9,  211,    9,    5,  207,    9,
-	  211,    9,    5,  207,    9,  211,    9,    5,  207,    9,    5,  106,
-	  101,    9,  101,    9,  101,    9,    5,  207,    9,    5,  207,    9,
-	    5,  207,    9,    5,  207,    9,  211,    9,    5,  207,    9,  110,
-	  101,    9,    5,   97,    9,  101,    9,  110,  110,    5,   97,    9,
-	  101,    9,  211,    9,    5,  207,    9,  110,  110,    5,   97,    9,
-	  110,    5,  207,    9,  211,    9,    5,  106,  110,    5,   97,    9,
-	  101,    9,    5,  207,    9,    5,  207,    9,  211,    9,    5,  207,
-	    9,  211,    9,    5,  207,    9,    5,  207,    9,    5,  207,    9,
-	    5,  207,   14,  207,    9,  220,    5,  216,    5,  106,  101,    9,
-	  101,    9,  101,    9,    5,  106,  110,    5,   97,    9,  110,    5,
-	  207
+static const unsigned char music_e1m4_chords[1593] = {
+	0x8F,0x2F,0x80,0xDD,0x81,0x53,0x80,0xD3,0x00,0x09,0x83,0x47,0x80,0xD3,0x00,0x09,
+	0x53,0x80,0xD3,0x00,0x09,0x47,0x80,0xD3,0x00,0x09,0x85,0x53,0x80,0xD3,0x00,0x09,
+	0x47,0x80,0xD3,0x00,0x09,0x53,0x80,0xD3,0x00,0x09,0x87,0x47,0x80,0xD3,0x00,0x09,
+	0x53,0x80,0xD3,0x00,0x09,0x89,0x47,0x80,0xD3,0x00,0x09,0x53,0x80,0xD3,0x00,0x09,
+	0x47,0x80,0xD3,0x00,0x09,0x8A,0x53,0x80,0xD3,0x00,0x09,0x47,0x80,0xD3,0x00,0x09,
+	0x8C,0x53,0x80,0xD3,0x00,0x09,0x8F,0x2B,0x80,0xDD,0x8C,0x4F,0x80,0xD3,0x00,0x09,
+	0x43,0x80,0xD3,0x00,0x09,0x4F,0x80,0xD3,0xA0,0x5E,0x00,0x04,0xA0,0x5E,0x00,0x04,
+	0xA0,0x5E,0x00,0x04,0xA0,0x5E,0x00,0x04,0xA0,0x5E,0x00,0x04,0xA0,0x5E,0x00,0x04,
+	0x00,0x09,0x8F,0x28,0x80,0xDD,0x8C,0x53,0x80,0xD3,0x00,0x09,0x47,0x80,0xD3,0x00,
+	0x09,0x53,0x80,0xD3,0xA0,0x8A,0x00,0x04,0xA0,0x8A,0x00,0x04,0xA0,0x8A,0x00,0x04,
+	0xA0,0x8A,0x00,0x04,0xA0,0x8A,0x00,0x04,0x00,0x09,0x49,0x80,0xD3,0x00,0x09,0x55,
+	0x80,0xD3,0x00,0x09,0x8F,0x30,0x80,0xDD,0x8C,0x56,0x80,0xD3,0x00,0x09,0x4A,0x80,
+	0xD3,0x00,0x09,0x56,0x80,0xD3,0x00,0x09,0x48,0x80,0xD3,0x00,0x09,0x54,0x80,0xD3,
+	0xA0,0xBC,0x00,0x05,0x4D,0x80,0xD3,0x00,0x09,0x59,0x80,0xD3,0x00,0x09,0xA0,0xD4,
+	0x00,0x04,0x4B,0x80,0xD3,0x00,0x09,0x57,0x80,0xD3,0x00,0x09,0xA0,0xE2,0x00,0x03,
+	0x00,0x80,0xE6,0xA0,0xC3,0x00,0x02,0x8F,0x32,0x80,0xD4,0x00,0x09,0x2C,0x80,0xD4,
+	0x00,0x09,0x8C,0x4A,0x80,0xD3,0x00,0x83,0x7D,0x8A,0x56,0x80,0xD3,0x00,0x09,0x8F,
+	0x32,0x80,0xD4,0xA0,0xFB,0x00,0x03,0x89,0x4A,0x80,0xD3,0x00,0x83,0x7D,0x87,0x56,
+	0x80,0xD3,0x00,0x09,0x8F,0x32,0x80,0xD4,0xA0,0xFB,0x00,0x03,0x85,0x4A,0x80,0xD3,
+	0x00,0x83,0x7D,0x83,0x56,0x80,0xD3,0x00,0x09,0x8F,0x32,0x80,0xD4,0x00,0x09,0x2C,
+	0x80,0xD3,0x00,0x09,0x81,0x4A,0x80,0xD3,0x00,0x82,0x9F,0x8F,0x2B,0x80,0xD4,0x00,
+	0x09,0x2B,0x80,0xD3,0x00,0x09,0x2B,0x80,0xD4,0x00,0x09,0x2B,0x6F,0x52,0x65,0xA0,
+	0x4F,0x01,0x05,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,
+	0x51,0x01,0x04,0x2B,0x6E,0x37,0x65,0xA0,0x54,0x01,0x03,0x2B,0x6E,0x52,0x6E,0xA0,
+	0x56,0x01,0x02,0x2B,0x80,0xD3,0x00,0x81,0x54,0x4D,0x6E,0x00,0x81,0xBA,0x29,0x80,
+	0xD3,0x00,0x09,0x29,0x6F,0x4F,0x6E,0x29,0x80,0xD4,0x00,0x09,0xA0,0x97,0x01,0x02,
+	0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,0x04,0x2B,0x6E,0x8C,0x3C,0x65,0x00,0x09,0x8F,
+	0x2B,0x80,0xD4,0xA0,0x4F,0x01,0x05,0xA0,0x51,0x01,0x04,0xA0,0x51,0x01,0x06,0xA0,
+	0x4F,0x01,0x05,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,
+	0x51,0x01,0x04,0x2B,0x6E,0x37,0x65,0xA0,0x54,0x01,0x03,0x2B,0x6E,0x52,0x6E,0xA0,
+	0x56,0x01,0x02,0xA0,0x83,0x01,0x0A,0xA0,0x97,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,
+	0x51,0x01,0x04,0xA0,0x51,0x01,0x04,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0x2B,
+	0x80,0xD4,0x00,0x83,0x0E,0x52,0x65,0xA0,0x86,0x01,0x02,0x00,0x84,0xBE,0x51,0x65,
+	0xA0,0x54,0x01,0x03,0xA0,0x51,0x01,0x04,0xA0,0x83,0x01,0x03,0x00,0x83,0x05,0x8C,
+	0x39,0x6E,0x00,0x81,0xBA,0x8F,0x2B,0x80,0xD4,0xA0,0x4F,0x01,0x05,0xA0,0x51,0x01,
+	0x04,0xA0,0x51,0x01,0x04,0xA0,0x83,0x01,0x03,0x00,0x83,0x05,0x4F,0x6E,0x00,0x81,
+	0xBA,0xA0,0x56,0x01,0x02,0x2B,0x6E,0x51,0x6E,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,
+	0x02,0xA0,0x97,0x01,0x02,0xA0,0x8E,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x8E,0x01,
+	0x02,0x28,0x80,0xD4,0x00,0x09,0x28,0x6E,0x8C,0x3C,0x6E,0x8F,0x28,0x80,0xD4,0x00,
+	0x09,0xA0,0x61,0x02,0x02,0x2D,0x80,0xD3,0x00,0x09,0x2D,0x6F,0x4C,0x6E,0x2D,0x80,
+	0xD4,0x00,0x09,0x2D,0x80,0xD4,0x00,0x86,0x7F,0x4C,0x65,0x00,0x09,0x32,0x80,0xD4,
+	0xA0,0x8B,0x02,0x02,0xA0,0x8B,0x02,0x02,0xA0,0x8B,0x02,0x02,0x00,0x09,0x32,0x6F,
+	0x51,0x65,0x00,0x09,0x32,0x6F,0x4E,0x65,0x00,0x09,0x32,0x6F,0x45,0x65,0x00,0x09,
+	0x32,0x6E,0x42,0x65,0xA0,0x54,0x01,0x04,0x46,0x65,0x00,0x09,0x2B,0x6F,0x43,0x65,
+	0x00,0x09,0x2B,0x6F,0x48,0x65,0xA0,0x54,0x01,0x04,0x54,0x6E,0xA0,0x56,0x01,0x02,
+	0xA0,0x56,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,
+	0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,
+	0x29,0x6F,0x56,0x65,0x00,0x83,0x0F,0xA0,0xF2,0x02,0x02,0x54,0x65,0x00,0x86,0xF1,
+	0xA0,0x56,0x01,0x03,0xA0,0xB8,0x02,0x07,0xA0,0x54,0x01,0x04,0x54,0x6E,0xA0,0x56,
+	0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,
+	0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0x97,
+	0x01,0x02,0xA0,0xF0,0x02,0x03,0xA0,0xF2,0x02,0x02,0x54,0x65,0x00,0x88,0x3D,0x59,
+	0x6E,0x00,0x81,0xBA,0xA0,0x97,0x01,0x02,0x29,0x6F,0x54,0x6E,0xA0,0x97,0x01,0x02,
+	0xA0,0x97,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,
+	0xA0,0x56,0x01,0x04,0x00,0x09,0x2B,0x6F,0x4F,0x65,0x00,0x09,0x2B,0x6F,0x46,0x65,
+	0xA0,0x54,0x01,0x02,0x00,0x81,0x55,0x5D,0x6E,0x00,0x83,0x06,0xA0,0x3F,0x03,0x02,
+	0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x03,
+	0x56,0x65,0xA0,0x59,0x01,0x03,0x00,0x09,0x2B,0x6F,0x4A,0x65,0xA0,0x54,0x01,0x03,
+	0x2A,0x80,0xD4,0x00,0x09,0x2A,0x6F,0x60,0x6E,0xA0,0xA0,0x03,0x02,0xA0,0xA0,0x03,
+	0x02,0xA0,0xFD,0x00,0x02,0x2C,0x6F,0x5C,0x6E,0xA0,0xFD,0x00,0x02,0x2C,0x80,0xD4,
+	0x00,0x81,0x55,0x60,0x6E,0x00,0x81,0xBA,0xA0,0x97,0x01,0x02,0x29,0x6F,0x63,0x6E,
+	0xA0,0x97,0x01,0x02,0xA0,0x97,0x01,0x02,0xA0,0xA0,0x03,0x02,0xA0,0xA0,0x03,0x02,
+	0xA0,0xA0,0x03,0x03,0x60,0x65,0x00,0x09,0xA0,0xA0,0x03,0x02,0xA0,0xA0,0x03,0x02,
+	0xA0,0xA0,0x03,0x02,0xA0,0xA0,0x03,0x02,0xA0,0xFD,0x00,0x02,0xA0,0xFD,0x00,0x02,
+	0xA0,0xFD,0x00,0x02,0x2C,0x6F,0x61,0x65,0xA0,0xFB,0x00,0x03,0xA0,0xFD,0x00,0x02,
+	0xA0,0xFD,0x00,0x02,0xA0,0xFD,0x00,0x02,0x2E,0x80,0xD4,0x00,0x09,0x2E,0x80,0xD3,
+	0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,
+	0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,
+	0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,
+	0xA0,0x1B,0x04,0x02,0xA0,0x1B,0x04,0x02,0x00,0x09,0x2E,0x80,0xDC,0x8C,0x4B,0x80,
+	0xD3,0x00,0x09,0xA0,0xD4,0x00,0x02,0x46,0x80,0xD3,0x00,0x09,0xA0,0x67,0x04,0x02,
+	0x4B,0x65,0x00,0x09,0xA0,0xD4,0x00,0x02,0x46,0x65,0x00,0x09,0xA0,0xD4,0x00,0x02,
+	0x8F,0x2C,0x80,0xD3,0x00,0x09,0xA0,0x5D,0x04,0x02,0xA0,0x80,0x04,0x02,0x8C,0x46,
+	0x80,0xD3,0x00,0x09,0x52,0x80,0xD3,0x00,0x09,0x46,0x65,0x00,0x09,0x50,0x80,0xD3,
+	0xA0,0x97,0x04,0x03,0xA0,0x94,0x04,0x02,0x8F,0x2A,0x80,0xDD,0xA0,0x5D,0x04,0x02,
+	0xA0,0xD4,0x00,0x02,0xA0,0x67,0x04,0x02,0xA0,0x67,0x04,0x02,0x4B,0x65,0x00,0x09,
+	0xA0,0xD4,0x00,0x02,0x46,0x65,0x00,0x09,0x4D,0x80,0xD3,0x00,0x80,0xE6,0xA0,0xE2,
+	0x00,0x02,0xA0,0xD4,0x00,0x02,0xA0,0x67,0x04,0x02,0x8F,0x29,0x80,0xDD,0x8C,0x46,
+	0x65,0x00,0x09,0x51,0x80,0xD3,0xA0,0x97,0x04,0x03,0x4E,0x80,0xD3,0x00,0x09,0x8F,
+	0x2E,0x80,0xDD,0xA0,0x5D,0x04,0x02,0x4D,0x80,0xD4,0x00,0x09,0xA0,0x67,0x04,0x02,
+	0xA0,0x67,0x04,0x02,0x4B,0x65,0xA0,0xC6,0x04,0x02,0xA0,0x97,0x04,0x03,0xA0,0xD4,
+	0x00,0x02,0x8F,0x2C,0x80,0xD4,0x00,0x09,0xA0,0x5D,0x04,0x02,0xA0,0x12,0x05,0x02,
+	0xA0,0x8E,0x04,0x07,0xA0,0x97,0x04,0x03,0xA0,0x94,0x04,0x02,0x8F,0x2A,0x80,0xDD,
+	0xA0,0x5D,0x04,0x02,0xA0,0xF7,0x04,0x02,0xA0,0x67,0x04,0x02,0xA0,0x67,0x04,0x02,
+	0x4B,0x65,0xA0,0xC6,0x04,0x02,0xA0,0x97,0x04,0x03,0xA0,0xC8,0x04,0x02,0xA0,0xE2,
+	0x00,0x02,0xA0,0xD4,0x00,0x02,0xA0,0x67,0x04,0x02,0xA0,0xDA,0x04,0x04,0xA0,0x97,
+	0x04,0x03,0xA0,0xEA,0x04,0x02,0x8F,0x35,0x81,0xB0,0x00,0x09,0x36,0x80,0xD4,0x00,
+	0x81,0xC3,0x3A,0x80,0xD4,0x00,0x77,0x39,0x80,0xD4,0x00,0x77,0x35,0x81,0xB0,0xA0,
+	0x6A,0x05,0x03,0x33,0x80,0xD4,0x00,0x77,0x30,0x80,0xD4,0x00,0x77,0x35,0x81,0xB1,
+	0xA0,0x6A,0x05,0x04,0x00,0x78,0x39,0x80,0xD5,0x00,0x77,0x35,0x80,0xD4,0x00,0x86,
+	0x12,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,0x06,0xA0,0x4F,0x01,0x05,0xA0,0x56,0x01,
+	0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,0x04,0x2B,0x6E,0x37,
+	0x65,0xA0,0x54,0x01,0x03,0x2B,0x6E,0x52,0x6E,0xA0,0x56,0x01,0x02,0xA0,0x83,0x01,
+	0x0A,0xA0,0x97,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,0x04,0xA0,0xA8,0x01,
+	0x04,0xA0,0x4F,0x01,0x05,0xA0,0x51,0x01,0x04,0xA0,0x51,0x01,0x06,0xA0,0x4F,0x01,
+	0x05,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,
+	0x04,0x2B,0x6E,0x37,0x65,0xA0,0x54,0x01,0x03,0x2B,0x6E,0x52,0x6E,0xA0,0x56,0x01,
+	0x02,0xA0,0x83,0x01,0x0A,0xA0,0x97,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0x51,0x01,
+	0x04,0xA0,0x51,0x01,0x04,0xA0,0x56,0x01,0x02,0xA0,0x56,0x01,0x02,0xA0,0xFF,0x01,
+	0x03,0xA0,0x86,0x01,0x02,0x00,0x81,0xB1,0xFF
 };
 
 #endif
@@ -2,722 +2,152 @@
 #ifndef __MUSIC_E1M5_H__
 #define __MUSIC_E1M5_H__
 
-#define MUSIC_E1M5_NOTE_COUNT  1673
-#define MUSIC_E1M5_HAS_ARP     0
+#define MUSIC_E1M5_LENGTH_MS  116040
 
-static const int music_e1m5_melody[1673] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC450,0xC450,0xC450,
-	0xC450,0xC450,0xC450,0x0000,0xC4C0,0xC4C0,0xC4C0,0xC4A0,0xC480,0xC470,0xC470,0xC480,
-	0xC480,0xC470,0xC470,0xC450,0xC450,0xC470,0xC470,0xC450,0xC450,0xC430,0xC430,0x0000,
-	0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0x0000,0xC470,0xC470,0x0000,
-	0xC480,0xC480,0xC480,0x0000,0xC4A0,0xC4A0,0x0000,0xC470,0xC470,0x0000,0xC400,0xC400,
-	0xC400,0xC400,0xC400,0xC400,0x0000,0xC430,0x0000,0xC470,0xC470,0xC400,0xC480,0xC4A0,
-	0xC4A0,0xC480,0xC470,0xC480,0xC480,0x0000,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,
-	0x0000,0xC4A0,0x0000,0xC470,0xC470,0xC470,0xC470,0xC470,0xC470,0x0000,0xC430,0xC430,
-	0xC430,0x0000,0xC450,0xC450,0xC450,0xC450,0xC450,0xC450,0x0000,0xC4C0,0xC4C0,0xC4C0,
-	0xC4A0,0xC480,0xC4C0,0xC4C0,0xC4D0,0xC4D0,0xC4C0,0xC4C0,0xC400,0xC400,0xC450,0xC450,
-	0xC4C0,0xC4A0,0xC4A0,0x0000,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0x0000,0xC480,
-	0x0000,0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0xC450,0xC450,0xC450,0x0000,0xC430,
-	0x0000,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0xC430,0x0000,0xC470,
-	0xC470,0xC3E0,0xC480,0xC3E0,0xC3E0,0xC480,0xC4A0,0xC480,0xC480,0x0000,0xC470,0xC470,
-	0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0x0000,0xC470,0xC470,0xC470,0x0000,0xC430,
-	0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC450,0xC450,
-	0xC450,0xC450,0xC450,0xC450,0x0000,0xC4C0,0xC4C0,0xC4C0,0xC4A0,0xC480,0xC470,0xC470,
-	0xC480,0xC480,0xC470,0xC470,0xC450,0xC450,0xC470,0xC470,0xC450,0xC450,0xC430,0xC430,
-	0x0000,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0x0000,0xC470,0xC470,
-	0x0000,0xC480,0xC480,0xC480,0x0000,0xC4A0,0xC4A0,0x0000,0xC470,0xC470,0x0000,0xC400,
-	0xC400,0xC400,0xC400,0xC400,0xC400,0x0000,0xC430,0x0000,0xC470,0xC470,0xC400,0xC480,
-	0xC4A0,0xC4A0,0xC480,0xC470,0xC480,0xC480,0x0000,0xC410,0xC410,0xC410,0xC410,0xC410,
-	0xC410,0x0000,0xC4A0,0x0000,0xC470,0xC470,0xC470,0xC470,0xC470,0xC470,0x0000,0xC430,
-	0xC430,0xC430,0x0000,0xC450,0xC450,0xC450,0xC450,0xC450,0xC450,0x0000,0xC4C0,0xC4C0,
-	0xC4C0,0xC4A0,0xC480,0xC4C0,0xC4C0,0xC4D0,0xC4D0,0xC4C0,0xC4C0,0xC400,0xC400,0xC450,
-	0xC450,0xC4C0,0xC4A0,0xC4A0,0x0000,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0x0000,
-	0xC480,0x0000,0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0xC450,0xC450,0xC450,0x0000,
-	0xC430,0x0000,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0xC430,0x0000,
-	0xC470,0xC470,0xC3E0,0xC480,0xC3E0,0xC3E0,0xC480,0xC4A0,0xC480,0xC480,0x0000,0xC470,
-	0xC470,0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0x0000,0xC470,0xC470,0xC470,0x0000,
-	0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC450,
-	0xC450,0xC450,0xC450,0xC450,0xC450,0x0000,0xC4C0,0xC4C0,0xC4C0,0xC4A0,0xC480,0xC470,
-	0xC470,0xC480,0xC480,0xC470,0xC470,0xC450,0xC450,0xC470,0xC470,0xC450,0xC450,0xC430,
-	0xC430,0x0000,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0x0000,0xC470,
-	0xC470,0x0000,0xC480,0xC480,0xC480,0x0000,0xC4A0,0xC4A0,0x0000,0xC470,0xC470,0x0000,
-	0xC400,0xC400,0xC400,0xC400,0xC400,0xC400,0x0000,0xC430,0x0000,0xC470,0xC470,0xC400,
-	0xC480,0xC4A0,0xC4A0,0xC480,0xC470,0xC480,0xC480,0x0000,0xC410,0xC410,0xC410,0xC410,
-	0xC410,0xC410,0x0000,0xC4A0,0x0000,0xC470,0xC470,0xC470,0xC470,0xC470,0xC470,0x0000,
-	0xC430,0xC430,0xC430,0x0000,0xC450,0xC450,0xC450,0xC450,0xC450,0xC450,0x0000,0xC4C0,
-	0xC4C0,0xC4C0,0xC4A0,0xC480,0xC4C0,0xC4C0,0xC4D0,0xC4D0,0xC4C0,0xC4C0,0xC400,0xC400,
-	0xC450,0xC450,0xC4C0,0xC4A0,0xC4A0,0x0000,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,
-	0x0000,0xC480,0x0000,0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0xC450,0xC450,0xC450,
-	0x0000,0xC430,0x0000,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0xC3E0,0x0000,0xC430,0xC430,
-	0x0000,0xC470,0xC470,0xC3E0,0xC480,0xC3E0,0xC3E0,0xC480,0xC4A0,0xC480,0xC480,0x0000,
-	0xC470,0xC470,0xC470,0xC470,0xC470,0xC470,0x0000,0xC450,0x0000,0xC470,0xC470,0xC470,
-	0x0000,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0xC430,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000
+static const unsigned char music_e1m5_melody[397] = {
+	0x00,0xB7,0xE8,0x8C,0x45,0x81,0x6C,0x00,0x21,0x4C,0x80,0x84,0x4A,0x80,0x85,0x48,
+	0x80,0x85,0x47,0x80,0x84,0x48,0x80,0x85,0x47,0x80,0x85,0x45,0x80,0x84,0x47,0x80,
+	0x85,0x45,0x80,0x85,0x43,0x80,0xE8,0x00,0x21,0x3E,0x80,0xE7,0x00,0x21,0xA0,0x24,
+	0x00,0x02,0x47,0x80,0xE8,0x00,0x21,0x48,0x80,0xE8,0x00,0x21,0x4A,0x80,0xE9,0x00,
+	0x21,0xA0,0x32,0x00,0x02,0x40,0x80,0xE7,0x00,0x21,0xA0,0x24,0x00,0x02,0x47,0x80,
+	0x84,0x40,0x80,0x85,0x48,0x80,0x85,0x4A,0x80,0x84,0xA0,0x15,0x00,0x02,0xA0,0x37,
+	0x00,0x02,0x41,0x80,0xE7,0xA0,0x3A,0x00,0x03,0x47,0x81,0x6C,0x00,0x21,0x43,0x81,
+	0x6D,0x00,0x21,0x45,0x81,0x6C,0xA0,0x07,0x00,0x04,0x4C,0x80,0x84,0x4D,0x80,0x85,
+	0x4C,0x80,0x85,0x40,0x80,0x84,0x45,0x80,0x85,0x4C,0x80,0x85,0x4A,0x80,0xE8,0x00,
+	0x21,0x43,0x80,0xE7,0xA0,0x35,0x00,0x03,0xA0,0x32,0x00,0x02,0x45,0x80,0xE8,0x00,
+	0x21,0x43,0x80,0xE9,0x00,0x21,0x3E,0x81,0x6C,0x00,0x21,0x43,0x81,0x6C,0x00,0x21,
+	0x47,0x80,0x85,0x3E,0x80,0x85,0x48,0x80,0x85,0x3E,0x80,0x84,0x48,0x80,0x85,0x4A,
+	0x80,0x85,0xA0,0x37,0x00,0x02,0x47,0x80,0xE7,0x00,0x21,0xA0,0x9C,0x00,0x02,0xA0,
+	0x32,0x00,0x02,0x43,0x81,0xF1,0x00,0xE3,0x74,0x45,0x81,0x6C,0xA0,0x07,0x00,0x0E,
+	0xA0,0x24,0x00,0x02,0xA0,0x32,0x00,0x06,0xA0,0x32,0x00,0x02,0xA0,0x45,0x00,0x02,
+	0xA0,0x24,0x00,0x02,0xA0,0x4E,0x00,0x04,0xA0,0x15,0x00,0x02,0xA0,0x37,0x00,0x02,
+	0x41,0x80,0xE7,0xA0,0x3A,0x00,0x03,0xA0,0x69,0x00,0x05,0xA0,0x07,0x00,0x04,0xA0,
+	0x7A,0x00,0x09,0xA0,0x35,0x00,0x03,0xA0,0x32,0x00,0x02,0xA0,0x9C,0x00,0x0E,0xA0,
+	0x37,0x00,0x02,0xA0,0xC6,0x00,0x02,0xA0,0x9C,0x00,0x02,0xA0,0x32,0x00,0x02,0xA0,
+	0xD3,0x00,0x03,0xA0,0x07,0x00,0x0E,0xA0,0x24,0x00,0x02,0xA0,0x32,0x00,0x06,0xA0,
+	0x32,0x00,0x02,0xA0,0x45,0x00,0x02,0xA0,0x24,0x00,0x02,0xA0,0x4E,0x00,0x04,0xA0,
+	0x15,0x00,0x02,0xA0,0x37,0x00,0x02,0x41,0x80,0xE7,0xA0,0x3A,0x00,0x03,0xA0,0x69,
+	0x00,0x05,0xA0,0x07,0x00,0x04,0xA0,0x7A,0x00,0x09,0xA0,0x35,0x00,0x03,0xA0,0x32,
+	0x00,0x02,0xA0,0x9C,0x00,0x0E,0xA0,0x37,0x00,0x02,0xA0,0xC6,0x00,0x02,0xA0,0x9C,
+	0x00,0x02,0xA0,0x32,0x00,0x02,0x43,0x81,0xF1,0x00,0xB1,0xC5,0xFF
 };
 
-static const int music_e1m5_bass[1673] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC290,0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,0xC2D0,0x0000,
-	0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0xC290,0x0000,0xC280,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2D0,
-	0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0xC290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC2B0,0xC2B0,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC280,0x0000,0xC280,
-	0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0xC280,0x0000,0xC280,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,
-	0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,
-	0x0000,0xC290,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0xC2B0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,
-	0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC2B0,0x0000,0xC2B0,0x0000,0x0000,
-	0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,
-	0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,0xC2D0,
-	0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0xC290,0x0000,
-	0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,
-	0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC280,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC280,0x0000,
-	0xC280,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,
-	0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,
-	0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,
-	0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC280,0x0000,0xC280,0x0000,0x0000,0x0000,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0xC280,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0xC290,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC2B0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC2B0,0x0000,
-	0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC2B0,0x0000,0xC2B0,0x0000,
-	0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,
-	0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,
-	0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,0x0000,0x0000,0xC290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,
-	0x0000,0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0xC290,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0xC290,
-	0x0000,0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC290,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,0xC280,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xC290,0xC290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC280,
-	0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2D0,0x0000,0xC2B0,0x0000,0x0000,0x0000,
-	0xC280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xC2B0,0xC2B0,0x0000,0xC290,0x0000,0xC280,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC2B0,0x0000,0x0000,0x0000,0xC280,
-	0x0000,0xC280,0x0000,0x0000,0x0000,0xB280,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB280,0x0000,0x0000,0x0000,0x0000,0xB280,0x0000,0x0000,0x0000,0x0000,0xB280,0x0000,
-	0x0000,0x0000,0xB290,0x0000,0x0000,0x0000,0xB290,0x0000,0x0000,0x0000,0xA290,0x0000,
-	0x0000,0x0000,0x0000,0xA290,0x0000,0x0000,0x0000,0x0000,0xA290,0x0000,0x0000,0x0000,
-	0x0000,0xA290,0x0000,0x0000,0x0000,0xA280,0x0000,0xA280,0x0000,0x0000,0x0000,0x9280,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9280,0x0000,0x0000,0x0000,0x0000,0x9280,
-	0x0000,0x0000,0x0000,0x0000,0x9280,0x0000,0x0000,0x0000,0x9290,0x0000,0x0000,0x0000,
-	0x9290,0x0000,0x0000,0x8290,0x0000,0x8290,0x0000,0x0000,0x0000,0x8290,0x0000,0x0000,
-	0x0000,0x8290,0x0000,0x0000,0x0000,0x82B0,0x0000,0x82B0,0x0000,0x0000,0x0000,0x72B0,
-	0x0000,0x0000,0x0000,0x0000,0x72B0,0x0000,0x0000,0x0000,0x0000,0x72B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x72B0,0x0000,0x0000,0x0000,0x0000,0x7290,0x0000,0x0000,
-	0x0000,0x7290,0x0000,0x0000,0x0000,0x6290,0x0000,0x0000,0x0000,0x6290,0x0000,0x0000,
-	0x0000,0x6290,0x0000,0x0000,0x0000,0x6290,0x0000,0x0000,0x0000,0x62B0,0x0000,0x52B0,
-	0x0000,0x0000,0x0000,0x52B0,0x0000,0x0000,0x0000,0x0000,0x52B0,0x52B0,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x42B0,0x0000,0x0000,0x0000,0x0000,0x42B0,0x0000,0x0000,
-	0x0000,0x0000,0x4290,0x0000,0x0000,0x0000,0x0000,0x3290,0x0000,0x0000,0x0000,0x3290,
-	0x0000,0x0000,0x0000,0x0000,0x3290,0x0000,0x0000,0x0000,0x0000,0x0000,0x2290,0x0000,
-	0x0000,0x0000,0x0000,0x2290,0x0000
+static const unsigned char music_e1m5_bass[841] = {
+	0x00,0x84,0x26,0x8C,0x29,0x64,0x00,0x81,0x2A,0x2B,0x64,0x00,0x81,0xAE,0x28,0x63,
+	0x00,0x81,0xAE,0x2D,0x64,0x00,0x21,0x2B,0x64,0x00,0x80,0xA5,0x29,0x64,0x00,0x21,
+	0x28,0x64,0x00,0x8E,0x1B,0x29,0x63,0x00,0x83,0x3C,0x2B,0x80,0xE9,0xA0,0x0B,0x00,
+	0x0A,0x00,0x83,0x3B,0x2B,0x63,0x00,0x21,0xA0,0x1C,0x00,0x03,0x00,0x89,0xF5,0x29,
+	0x80,0xE8,0x00,0x82,0x32,0x2B,0x80,0xE9,0xA0,0x0B,0x00,0x02,0x00,0x81,0xAF,0xA0,
+	0x13,0x00,0x07,0x00,0x8E,0x1A,0xA0,0x25,0x00,0x03,0xA0,0x0B,0x00,0x02,0x00,0x81,
+	0xAF,0xA0,0x13,0x00,0x04,0x28,0x64,0x00,0x83,0xC0,0x2B,0x63,0x00,0x21,0xA0,0x1C,
+	0x00,0x03,0x00,0x8D,0x11,0x2B,0x80,0xE9,0x00,0x80,0xC6,0x28,0x64,0x00,0x80,0x85,
+	0x28,0x64,0x00,0x80,0xA5,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,
+	0x02,0xA0,0x80,0x00,0x02,0x29,0x64,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0x00,
+	0x80,0xA5,0x29,0x63,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,0x00,0x80,0xA5,0x28,
+	0x64,0x00,0x80,0xA6,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,
+	0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0x29,0x64,0xA0,0x19,0x00,0x02,0x00,0x80,
+	0xA6,0x29,0x64,0x00,0x80,0xA6,0x29,0x63,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,
+	0x00,0x80,0xA5,0x2B,0x64,0x00,0x80,0xA6,0xA0,0x17,0x00,0x02,0xA0,0x17,0x00,0x02,
+	0x2B,0x63,0x00,0x80,0xA5,0xA0,0xF0,0x00,0x02,0xA0,0xF0,0x00,0x02,0x29,0x63,0xA0,
+	0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,
+	0x19,0x00,0x02,0xA0,0xE0,0x00,0x03,0xA0,0xF0,0x00,0x02,0xA0,0x17,0x00,0x02,0xA0,
+	0xF0,0x00,0x02,0xA0,0xF0,0x00,0x02,0xA0,0xF0,0x00,0x02,0x29,0x63,0xA0,0x19,0x00,
+	0x02,0xA0,0x19,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,
+	0x02,0xA0,0x0B,0x00,0x0E,0xA0,0x0B,0x00,0x0A,0xA0,0x31,0x00,0x03,0xA0,0x1C,0x00,
+	0x03,0xA0,0x3C,0x00,0x04,0xA0,0x0B,0x00,0x02,0x00,0x81,0xAF,0xA0,0x13,0x00,0x07,
+	0x00,0x8E,0x1A,0xA0,0x25,0x00,0x03,0xA0,0x0B,0x00,0x02,0x00,0x81,0xAF,0xA0,0x13,
+	0x00,0x04,0xA0,0x65,0x00,0x04,0xA0,0x1C,0x00,0x03,0xA0,0x72,0x00,0x07,0xA0,0x80,
+	0x00,0x02,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0x29,0x64,
+	0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,
+	0xA0,0x9F,0x00,0x02,0xA0,0xAC,0x00,0x03,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,
+	0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0xA0,0x80,0x00,0x02,0x29,0x64,0xA0,0x19,
+	0x00,0x02,0xA0,0xCE,0x00,0x04,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0xE0,
+	0x00,0x03,0xA0,0x17,0x00,0x02,0xA0,0x17,0x00,0x02,0xA0,0xF0,0x00,0x02,0xA0,0xF0,
+	0x00,0x02,0xA0,0xF0,0x00,0x02,0x29,0x63,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,
+	0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0xE0,0x00,0x03,
+	0xA0,0xF0,0x00,0x02,0xA0,0x17,0x00,0x02,0xA0,0xF0,0x00,0x02,0xA0,0xF0,0x00,0x02,
+	0xA0,0xF0,0x00,0x02,0x29,0x63,0xA0,0x19,0x00,0x02,0xA0,0x19,0x00,0x02,0xA0,0x9F,
+	0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x0B,0x00,0x0E,0xA0,0x0B,
+	0x00,0x0A,0xA0,0x31,0x00,0x03,0xA0,0x1C,0x00,0x03,0xA0,0x3C,0x00,0x04,0xA0,0x0B,
+	0x00,0x02,0x00,0x81,0xAF,0xA0,0x13,0x00,0x07,0x00,0x8E,0x1A,0xA0,0x25,0x00,0x03,
+	0xA0,0x0B,0x00,0x02,0x00,0x81,0xAF,0xA0,0x13,0x00,0x04,0xA0,0x65,0x00,0x04,0xA0,
+	0x1C,0x00,0x03,0xA0,0x72,0x00,0x07,0x8B,0x28,0x64,0x00,0x80,0xA5,0x28,0x64,0xA0,
+	0x6A,0x02,0x02,0xA0,0x6A,0x02,0x02,0x00,0x80,0xA5,0x29,0x64,0xA0,0x77,0x02,0x02,
+	0x00,0x80,0xA5,0x8A,0x29,0x64,0x00,0x80,0xA5,0x29,0x63,0xA0,0x86,0x02,0x02,0xA0,
+	0x86,0x02,0x02,0x00,0x80,0xA5,0x28,0x64,0x00,0x80,0xA6,0x28,0x64,0x00,0x80,0xA5,
+	0x89,0x28,0x64,0x00,0x80,0xA5,0x28,0x64,0xA0,0xA3,0x02,0x02,0xA0,0xA3,0x02,0x02,
+	0x00,0x80,0xA5,0x29,0x64,0xA0,0xB0,0x02,0x02,0x00,0x80,0xA6,0x88,0x29,0x64,0x00,
+	0x80,0xA6,0x29,0x63,0x00,0x80,0xA5,0xA0,0xC2,0x02,0x02,0xA0,0xC2,0x02,0x02,0x2B,
+	0x64,0x00,0x80,0xA6,0x2B,0x64,0x00,0x80,0xA5,0x87,0x2B,0x64,0x00,0x80,0xA5,0x2B,
+	0x63,0xA0,0xDC,0x02,0x02,0xA0,0xDC,0x02,0x02,0x00,0x80,0xA5,0x29,0x63,0x00,0x80,
+	0xA5,0x29,0x64,0x00,0x80,0xA5,0x86,0x29,0x64,0x00,0x80,0xA5,0x29,0x64,0xA0,0xF9,
+	0x02,0x02,0xA0,0xF9,0x02,0x02,0x00,0x80,0xA5,0x2B,0x64,0x00,0x80,0xA6,0x85,0x2B,
+	0x63,0x00,0x80,0xA5,0x2B,0x64,0x00,0x80,0xA5,0x2B,0x63,0x00,0x80,0xA5,0x84,0x2B,
+	0x63,0x00,0x80,0xA5,0x2B,0x63,0x00,0x80,0xA5,0x29,0x63,0x00,0x80,0xA5,0x83,0x29,
+	0x64,0x00,0x80,0xA5,0x29,0x64,0x00,0x80,0xA5,0x29,0x63,0x00,0x80,0xA5,0x82,0x29,
+	0x63,0x00,0x80,0xA5,0x29,0x63,0x00,0x21,0xFF
 };
 
-static const int music_e1m5_chords[1673] = {
-	0x0000,0x0000,0x0000,0xF390,0xF390,0xF390,0x0000,0xF3B0,0xF3B0,0xF3B0,0x0000,0xF3C0,
-	0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,0xF450,0xF450,
-	0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,0xF3B0,0xF3B0,
-	0x0000,0xF3B0,0x0000,0xF3B0,0x0000,0xF3E0,0xF3E0,0x0000,0xF410,0xF410,0x0000,0xF430,
-	0xF430,0xF430,0xF430,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,0xF400,
-	0xF400,0x0000,0xF410,0xF410,0x0000,0xF430,0xF430,0xF430,0x0000,0xF410,0xF410,0x0000,
-	0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,0x0000,
-	0xF430,0x0000,0xF430,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,
-	0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0x0000,0xF470,0xF470,0xF470,0xF470,0xF470,0x0000,0xF3B0,0xF3B0,0x0000,0xF3B0,
-	0x0000,0xF3B0,0x0000,0xF430,0xF430,0x0000,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,
-	0x0000,0xF470,0xF470,0xF470,0x0000,0xF430,0xF430,0x0000,0xF430,0x0000,0xF430,0x0000,
-	0xF430,0xF430,0x0000,0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0x0000,0xF410,0xF410,
-	0x0000,0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,0xF430,
-	0x0000,0xF430,0x0000,0xF430,0x0000,0xF470,0xF470,0xF470,0x0000,0xF400,0xF400,0x0000,
-	0xF400,0x0000,0xF400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3E0,0xF3E0,0x0000,
-	0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0xF430,0x0000,
-	0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,0xF450,0x0000,0xF450,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF3E0,0xF3E0,0x0000,0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,0xF450,0x0000,
-	0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF470,0xF470,0xF470,0x0000,0xF470,
-	0x0000,0xF470,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,
-	0xF450,0xF450,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,0xF450,0xF450,
-	0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0x0000,0xF400,0xF400,
-	0x0000,0xF410,0x0000,0xF400,0xF400,0x0000,0xF450,0x0000,0xF470,0xF470,0x0000,0xF480,
-	0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,0xF470,
-	0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0xF400,0xF400,0x0000,0x0000,0x0000,0xF470,
-	0xF470,0x0000,0x0000,0x0000,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0xF450,0x0000,0xF480,0x0000,0xF470,0x0000,0xF450,0x0000,0xF430,0x0000,0xF410,
-	0x0000,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,
-	0xF3E0,0x0000,0xF3B0,0x0000,0xF3C0,0xF3C0,0x0000,0xF3E0,0x0000,0xF3E0,0xF3E0,0x0000,
-	0xF3E0,0x0000,0xF400,0x0000,0xF410,0xF410,0x0000,0xF400,0x0000,0xF410,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0x0000,0xF430,0xF430,0xF430,0xF430,0xF370,0xF370,0xF370,
-	0xF370,0xF370,0x0000,0xF3B0,0xF3B0,0x0000,0xF3E0,0x0000,0xF430,0xF430,0x0000,0xF430,
-	0x0000,0xF3B0,0x0000,0xF3E0,0xF3E0,0x0000,0xF430,0x0000,0xF410,0xF410,0x0000,0xF400,
-	0x0000,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0x0000,0xF4C0,0xF4C0,0x0000,
-	0xF4A0,0x0000,0xF4C0,0xF4C0,0x0000,0xF4A0,0x0000,0xF480,0xF480,0x0000,0xF470,0x0000,
-	0xF3C0,0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,0xF450,
-	0xF450,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,0xF3B0,
-	0xF3B0,0x0000,0xF3B0,0x0000,0xF3B0,0x0000,0xF3E0,0xF3E0,0x0000,0xF410,0xF410,0x0000,
-	0xF430,0xF430,0xF430,0xF430,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,
-	0xF400,0xF400,0x0000,0xF410,0xF410,0x0000,0xF430,0xF430,0xF430,0x0000,0xF410,0xF410,
-	0x0000,0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,
-	0x0000,0xF430,0x0000,0xF430,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,0xF3C0,0xF3C0,
-	0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,0xF450,0xF450,0xF450,
-	0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0xF470,0xF470,0x0000,0xF3B0,0xF3B0,0x0000,
-	0xF3B0,0x0000,0xF3B0,0x0000,0xF430,0xF430,0x0000,0xF450,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0x0000,0xF470,0xF470,0xF470,0x0000,0xF430,0xF430,0x0000,0xF430,0x0000,0xF430,
-	0x0000,0xF430,0xF430,0x0000,0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0x0000,0xF410,
-	0xF410,0x0000,0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,
-	0xF430,0x0000,0xF430,0x0000,0xF430,0x0000,0xF470,0xF470,0xF470,0x0000,0xF400,0xF400,
-	0x0000,0xF400,0x0000,0xF400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3E0,0xF3E0,
-	0x0000,0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0xF430,
-	0x0000,0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,0xF450,0x0000,0xF450,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF3E0,0xF3E0,0x0000,0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,0xF450,
-	0x0000,0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF470,0xF470,0xF470,0x0000,
-	0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0x0000,
-	0x0000,0xF450,0xF450,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,0xF450,
-	0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0x0000,0xF400,
-	0xF400,0x0000,0xF410,0x0000,0xF400,0xF400,0x0000,0xF450,0x0000,0xF470,0xF470,0x0000,
-	0xF480,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,
-	0xF470,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0xF400,0xF400,0x0000,0x0000,0x0000,
-	0xF470,0xF470,0x0000,0x0000,0x0000,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0xF450,0xF450,0x0000,0xF480,0x0000,0xF470,0x0000,0xF450,0x0000,0xF430,0x0000,
-	0xF410,0x0000,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,0xF3E0,
-	0xF3E0,0xF3E0,0x0000,0xF3B0,0x0000,0xF3C0,0xF3C0,0x0000,0xF3E0,0x0000,0xF3E0,0xF3E0,
-	0x0000,0xF3E0,0x0000,0xF400,0x0000,0xF410,0xF410,0x0000,0xF400,0x0000,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,
-	0xF410,0xF410,0xF410,0xF410,0xF410,0x0000,0xF430,0xF430,0xF430,0xF430,0xF370,0xF370,
-	0xF370,0xF370,0xF370,0x0000,0xF3B0,0xF3B0,0x0000,0xF3E0,0x0000,0xF430,0xF430,0x0000,
-	0xF430,0x0000,0xF3B0,0x0000,0xF3E0,0xF3E0,0x0000,0xF430,0x0000,0xF410,0xF410,0x0000,
-	0xF400,0x0000,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0xF410,0x0000,0xF4C0,0xF4C0,
-	0x0000,0xF4A0,0x0000,0xF4C0,0xF4C0,0x0000,0xF4A0,0x0000,0xF480,0xF480,0x0000,0xF470,
-	0x0000,0xF3C0,0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,
-	0xF450,0xF450,0xF450,0xF450,0xF450,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,
-	0xF3B0,0xF3B0,0x0000,0xF3B0,0x0000,0xF3B0,0x0000,0xF3E0,0xF3E0,0x0000,0xF410,0xF410,
-	0x0000,0xF430,0xF430,0xF430,0xF430,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,
-	0x0000,0xF400,0xF400,0x0000,0xF410,0xF410,0x0000,0xF430,0xF430,0xF430,0x0000,0xF410,
-	0xF410,0x0000,0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0xF450,0x0000,0xF430,
-	0xF430,0x0000,0xF430,0x0000,0xF430,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,0xF3C0,
-	0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF400,0xF400,0xF400,0x0000,0xF450,0xF450,
-	0xF450,0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0xF470,0xF470,0x0000,0xF3B0,0xF3B0,
-	0x0000,0xF3B0,0x0000,0xF3B0,0x0000,0xF430,0xF430,0x0000,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0x0000,0xF430,0xF430,0x0000,0xF430,0x0000,
-	0xF430,0x0000,0xF430,0xF430,0x0000,0xF450,0xF450,0x0000,0xF470,0xF470,0xF470,0x0000,
-	0xF410,0xF410,0x0000,0xF410,0x0000,0xF410,0x0000,0xF450,0xF450,0xF450,0x0000,0xF430,
-	0xF430,0xF430,0x0000,0xF430,0x0000,0xF430,0x0000,0xF470,0xF470,0xF470,0x0000,0xF400,
-	0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3E0,
-	0xF3E0,0x0000,0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,
-	0xF430,0x0000,0xF430,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,0xF450,0x0000,0xF450,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF400,0xF400,0x0000,0xF400,0x0000,0xF400,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF3E0,0xF3E0,0x0000,0xF3E0,0x0000,0xF3E0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF450,0xF450,0x0000,
-	0xF450,0x0000,0xF450,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF470,0xF470,0xF470,
-	0x0000,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,
-	0x0000,0x0000,0xF450,0xF450,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0x0000,0x0000,
-	0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,0x0000,
-	0xF400,0xF400,0x0000,0xF410,0x0000,0xF400,0xF400,0x0000,0xF450,0x0000,0xF470,0xF470,
-	0x0000,0xF480,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,
-	0x0000,0xF470,0xF470,0x0000,0xF470,0x0000,0x0000,0x0000,0xF400,0xF400,0x0000,0x0000,
-	0x0000,0xF470,0xF470,0x0000,0x0000,0x0000,0xF450,0xF450,0xF450,0xF450,0xF450,0xF450,
-	0xF450,0xF450,0xF450,0xF450,0x0000,0xE480,0x0000,0xE470,0x0000,0xE450,0x0000,0xE430,
-	0x0000,0xE410,0x0000,0xE3E0,0xE3E0,0xE3E0,0xE3E0,0xE3E0,0xE3E0,0xE3E0,0xE3E0,0xE3E0,
-	0xE3E0,0xE3E0,0xE3E0,0x0000,0xC3B0,0x0000,0xC3C0,0xC3C0,0x0000,0xC3E0,0x0000,0xC3E0,
-	0xC3E0,0x0000,0xC3E0,0x0000,0xC400,0x0000,0xC410,0xC410,0x0000,0xC400,0x0000,0xC410,
-	0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,
-	0xC410,0xC410,0xC410,0xC410,0xC410,0xC410,0x0000,0xA430,0xA430,0xA430,0xA430,0x9370,
-	0x9370,0x9370,0x9370,0x9370,0x0000,0x93B0,0x93B0,0x0000,0x93E0,0x73E0,0x0000,0x7430,
-	0x7430,0x0000,0x7430,0x0000,0x73B0,0x0000,0x73E0,0x73E0,0x0000,0x7430,0x0000,0x7410,
-	0x7410,0x0000,0x7400,0x0000,0x7410,0x7410,0x5410,0x5410,0x5410,0x5410,0x5410,0x5410,
-	0x0000,0x54C0,0x54C0,0x0000,0x54A0,0x0000,0x54C0,0x54C0,0x34C0,0x0000,0x34A0,0x0000,
-	0x3480,0x3480,0x0000,0x3470,0x0000
-};
-
-static const int music_e1m5_drums[1673] = {
-	0x001C,0x0024,0x0020,0x001F,0x0024,0x0024,0x0024,0x001F,0x0024,0x0024,0x0024,0x001F,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,
-	0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x001C,0x001C,0x001E,0x001C,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x001F,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,
-	0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,0x001C,0x001F,0x001C,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,
-	0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001E,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x0024,
-	0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,0x0024,
-	0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,
-	0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,
-	0x0024,0x001E,0x001C,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x0024,
-	0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001E,0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x0024,0x0024,0x001F,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x001C,0x001C,0x001E,0x001C,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001F,0x0024,0x0024,0x0024,0x001F,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,
-	0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,
-	0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,
-	0x001E,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,0x001C,0x001F,0x001C,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,
-	0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x0024,0x0024,0x001E,0x001C,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,
-	0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,
-	0x0024,0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x001E,0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x0024,0x0024,0x0024,0x001F,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x0024,0x0024,0x001E,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001F,0x0024,0x001C,0x001C,0x001E,
-	0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x001F,0x0024,0x0024,0x0024,0x001F,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,
-	0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x0024,0x001C,0x001C,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x001C,0x001C,0x001F,0x001C,0x0024,
-	0x0024,0x0024,0x0024,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,
-	0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,
-	0x001C,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x0024,0x0024,0x001C,0x001C,0x001C,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x0024,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x0024,0x0024,0x001E,0x001C,0x0024,0x0024,0x001F,0x001C,0x001C,0x001C,0x0024,
-	0x0024,0x001E,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x0024,0x0024,0x0024,0x0024,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,0x001C,0x0024,0x0024,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x0024,0x0024,0x001E,0x0024,0x0024,0x0024,0x0024,0x0024,
-	0x001E,0x0024,0x0024,0x0024,0x0024
-};
-
-static const unsigned short music_e1m5_timing[1673] = {
-	  133,  398,  266,    1,  264,  100,   33,    1,  264,  100,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   98,  265,   33,    1,  131,
-	  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,  363,   33,    1,  364,   33,    1,
-	  131,  133,  100,   33,    1,  231,   33,   33,   33,   33,   33,    1,
-	   32,  365,    1,  364,   33,    1,  131,  233,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,   33,  233,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   32,   99,  233,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,  265,   33,    1,  131,  100,   33,
-	  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,   33,   33,
-	   33,   33,   33,    1,  363,   33,    1,   98,   33,  100,   33,  100,
-	   33,    1,  131,  233,   33,    1,  231,   33,   33,   33,   33,   33,
-	    1,   32,  364,    1,  364,   33,    1,  131,  232,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,  131,  232,   33,    1,  131,  100,
-	   33,   33,   33,   33,   33,    1,  131,  233,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,   33,  133,  133,    1,  131,  100,
-	   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,   33,  232,   33,    1,  231,   33,
-	  133,    1,   98,   33,  133,  100,   33,    1,  231,   33,   33,   33,
-	   33,   33,    1,   98,   33,  232,   33,    1,  131,  133,  133,    1,
-	  131,  133,  133,    1,  231,   33,   33,   33,   33,   33,    1,   98,
-	   33,  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,  131,
-	  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,   98,   33,
-	  133,  133,    1,  131,  100,   33,  100,   33,    1,  131,  100,   33,
-	  133,    1,  231,   33,   33,   33,   33,   33,    1,   98,   33,  232,
-	   33,    1,   98,   33,  100,   33,  100,   33,    1,   98,   33,  233,
-	   33,    1,  231,   33,   33,   33,   33,   33,    1,  363,   33,    1,
-	  132,  133,  133,    1,  131,  133,  133,    1,  231,   33,   33,   33,
-	   33,   33,    1,   98,   33,  232,   33,    1,  131,  100,   33,   33,
-	   33,   33,   33,    1,  131,  233,   33,    1,  164,  100,  133,  100,
-	   33,    1,  131,  100,   33,    1,   32,   33,   33,   33,  100,   33,
-	    1,   98,   33,  100,   33,    1,   98,   33,  100,   33,    1,  131,
-	  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,   98,
-	   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,   99,
-	   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,   33,    1,
-	   32,   33,   33,   33,  100,   33,    1,   98,   33,  100,   33,    1,
-	   98,   33,  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,
-	  133,  100,  166,   99,   33,   99,   33,   99,   33,   99,   33,   99,
-	   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,   33,    1,
-	   98,   33,   99,   33,    1,   98,   33,   99,   33,    1,   32,   33,
-	   33,   33,   99,   33,    1,   98,   33,   99,   33,    1,  131,  100,
-	   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,  131,  100,
-	   33,    1,  131,  100,   33,    1,  131,  100,  166,   99,   33,    1,
-	  131,  100,   33,    1,   98,   33,   99,   33,    1,   32,   33,   33,
-	   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,   99,
-	   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,   98,   33,
-	   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,   99,   33,
-	    1,  231,   33,   33,   33,   33,   33,    1,   98,  265,   33,    1,
-	  131,  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,  363,   33,    1,  364,   33,
-	    1,  131,  133,  100,   33,    1,  231,   33,   33,   33,   33,   33,
-	    1,   32,  365,    1,  364,   33,    1,  131,  233,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,   98,   33,  233,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,   32,   99,  233,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,   98,  265,   33,    1,  131,  100,
-	   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,  363,   33,    1,   98,   33,  100,   33,
-	  100,   33,    1,  131,  233,   33,    1,  231,   33,   33,   33,   33,
-	   33,    1,   32,  364,    1,  364,   33,    1,  131,  232,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,  131,  232,   33,    1,  131,
-	  100,   33,   33,   33,   33,   33,    1,  131,  233,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,   98,   33,  133,  133,    1,  131,
-	  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,   98,   33,  232,   33,    1,  231,
-	   33,  133,    1,   98,   33,  133,  100,   33,    1,  231,   33,   33,
-	   33,   33,   33,    1,   98,   33,  232,   33,    1,  131,  133,  133,
-	    1,  131,  133,  133,    1,  231,   33,   33,   33,   33,   33,    1,
-	   98,   33,  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,
-	  131,  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,   98,
-	   33,  133,  133,    1,  131,  100,   33,  100,   33,    1,  131,  100,
-	   33,  133,    1,  231,   33,   33,   33,   33,   33,    1,   98,   33,
-	  232,   33,    1,   98,   33,  100,   33,  100,   33,    1,   98,   33,
-	  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,  363,   33,
-	    1,  132,  133,  133,    1,  131,  133,  133,    1,  231,   33,   33,
-	   33,   33,   33,    1,   98,   33,  232,   33,    1,  131,  100,   33,
-	   33,   33,   33,   33,    1,  131,  233,   33,    1,  164,  100,  133,
-	  100,   33,    1,  131,  100,   33,    1,   32,   33,   33,   33,  100,
-	   33,    1,   98,   33,  100,   33,    1,   98,   33,  100,   33,    1,
-	  131,  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,
-	   98,   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,
-	   99,   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,   33,
-	    1,   32,   33,   33,   33,  100,   33,    1,   98,   33,  100,   33,
-	    1,   98,   33,  100,   33,    1,  131,  100,   33,    1,  131,  100,
-	   33,  133,  100,  166,   99,   33,   99,   33,   99,   33,   99,   33,
-	   99,   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,   33,
-	    1,   98,   33,   99,   33,    1,   98,   33,   99,   33,    1,   32,
-	   33,   33,   33,   99,   33,    1,   98,   33,   99,   33,    1,  131,
-	  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,  131,
-	  100,   33,    1,  131,  100,   33,    1,  131,  100,  166,   99,   33,
-	    1,  131,  100,   33,    1,   98,   33,   99,   33,    1,   32,   33,
-	   33,   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,
-	   99,   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,   98,
-	   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,   33,   99,
-	   33,    1,  231,   33,   33,   33,   33,   33,    1,   98,  265,   33,
-	    1,  131,  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,
-	    1,  231,   33,   33,   33,   33,   33,    1,  363,   33,    1,  364,
-	   33,    1,  131,  133,  100,   33,    1,  231,   33,   33,   33,   33,
-	   33,    1,   32,  365,    1,  364,   33,    1,  131,  233,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   98,   33,  233,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   32,   99,  233,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   98,  265,   33,    1,  131,
-	  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,  231,
-	   33,   33,   33,   33,   33,    1,  363,   33,    1,   98,   33,  100,
-	   33,  100,   33,    1,  131,  233,   33,    1,  231,   33,   33,   33,
-	   33,   33,    1,   32,  364,    1,  364,   33,    1,  131,  232,   33,
-	    1,  231,   33,   33,   33,   33,   33,    1,  131,  232,   33,    1,
-	  131,  100,   33,   33,   33,   33,   33,    1,  131,  233,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   98,   33,  133,  133,    1,
-	  131,  100,   33,  100,   33,    1,  131,  100,   33,  100,   33,    1,
-	  231,   33,   33,   33,   33,   33,    1,   98,   33,  232,   33,    1,
-	  231,   33,  133,    1,   98,   33,  133,  100,   33,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,   33,  232,   33,    1,  131,  133,
-	  133,    1,  131,  133,  133,    1,  231,   33,   33,   33,   33,   33,
-	    1,   98,   33,  233,   33,    1,  231,   33,   33,   33,   33,   33,
-	    1,  131,  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,
-	   98,   33,  133,  133,    1,  131,  100,   33,  100,   33,    1,  131,
-	  100,   33,  133,    1,  231,   33,   33,   33,   33,   33,    1,   98,
-	   33,  232,   33,    1,   98,   33,  100,   33,  100,   33,    1,   98,
-	   33,  233,   33,    1,  231,   33,   33,   33,   33,   33,    1,  363,
-	   33,    1,  132,  133,  133,    1,  131,  133,  133,    1,  231,   33,
-	   33,   33,   33,   33,    1,   98,   33,  232,   33,    1,  131,  100,
-	   33,   33,   33,   33,   33,    1,  131,  233,   33,    1,  164,  100,
-	  133,  100,   33,    1,  131,  100,   33,    1,   32,   33,   33,   33,
-	  100,   33,    1,   98,   33,  100,   33,    1,   98,   33,  100,   33,
-	    1,  131,  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,
-	    1,   98,   33,   99,   33,    1,   98,   33,   99,   33,    1,   98,
-	   33,   99,   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,
-	   33,    1,   32,   33,   33,   33,  100,   33,    1,   98,   33,  100,
-	   33,    1,   98,   33,  100,   33,    1,  131,  100,   33,    1,  131,
-	  100,   33,  133,  100,  166,   99,   33,   99,   33,   99,   33,   99,
-	   33,   99,   33,    1,  131,  100,  166,  100,   33,    1,  131,  100,
-	   33,    1,   98,   33,   99,   33,    1,   98,   33,   99,   33,    1,
-	   32,   33,   33,   33,   99,   33,    1,   98,   33,   99,   33,    1,
-	  131,  100,   33,    1,  131,  100,   33,    1,  131,  100,   33,    1,
-	  131,  100,   33,    1,  131,  100,   33,    1,  131,  100,  166,   99,
-	   33,    1,  131,  100,   33,    1,   98,   33,   66,   33,   33,    1,
-	   32,   33,   33,   33,   99,   33,    1,   98,   33,   99,   33,    1,
-	   98,   33,   99,   33,    1,   65,   66,  100,   33,    1,  131,  100,
-	   33,    1,   98,   33,   99,   33,    1,   65,   33,   33,   99,   33,
-	    1,   98,   33,   99,   33
+static const unsigned char music_e1m5_chords[944] = {
+	0x00,0x83,0x1D,0x8F,0x39,0x81,0x6D,0x00,0x21,0x3B,0x81,0x6D,0x00,0x21,0x3C,0x80,
+	0xE8,0x00,0x21,0x3C,0x21,0x00,0x21,0x3C,0x21,0x00,0x21,0x40,0x81,0x6C,0x00,0x21,
+	0x45,0x81,0x6D,0x00,0x21,0x43,0x81,0x6D,0x00,0x21,0x3B,0x80,0xE8,0x00,0x21,0x3B,
+	0x21,0x00,0x21,0x3B,0x21,0x00,0x21,0x3E,0x81,0x6C,0x00,0x21,0x41,0x81,0x6D,0xA0,
+	0x23,0x00,0x03,0x40,0x80,0xE8,0x00,0x21,0x40,0x21,0x00,0x21,0x40,0x21,0x00,0x21,
+	0x40,0x21,0x00,0x81,0x6D,0x41,0x81,0x6D,0xA0,0x23,0x00,0x03,0x41,0x80,0xE8,0x00,
+	0x21,0x41,0x21,0x00,0x21,0x41,0x21,0xA0,0x1E,0x00,0x03,0x43,0x80,0xE8,0x00,0x21,
+	0x43,0x21,0x00,0x21,0x43,0x21,0x00,0x21,0x43,0x21,0x00,0x81,0x6D,0xA0,0x0E,0x00,
+	0x0A,0x47,0x81,0x6D,0xA0,0x28,0x00,0x07,0x43,0x81,0x6C,0xA0,0x1E,0x00,0x03,0x47,
+	0x81,0x6D,0x00,0x21,0xA0,0x6B,0x00,0x07,0x00,0x81,0x6C,0xA0,0x20,0x00,0x02,0x47,
+	0x81,0x6C,0x00,0x21,0xA0,0x5C,0x00,0x05,0x00,0x21,0x45,0x81,0x6C,0x00,0x21,0xA0,
+	0x6B,0x00,0x06,0xA0,0x8F,0x00,0x02,0xA0,0x43,0x00,0x05,0x00,0x84,0xCB,0x3E,0x80,
+	0xE8,0x00,0x21,0x3E,0x21,0x00,0x21,0x3E,0x21,0x00,0x84,0xCA,0xA0,0x6B,0x00,0x05,
+	0x00,0x84,0xCA,0x45,0x80,0xE8,0x00,0x21,0x45,0x21,0x00,0x21,0x45,0x21,0x00,0x81,
+	0xAF,0x47,0x80,0xE8,0x00,0x21,0x47,0x21,0x00,0x21,0x47,0x21,0x00,0x81,0xAF,0xA0,
+	0x43,0x00,0x05,0xA0,0xBB,0x00,0x07,0xA0,0xE1,0x00,0x05,0x00,0x84,0xCB,0xA0,0xD3,
+	0x00,0x05,0x00,0x81,0xAE,0xA0,0xE1,0x00,0x06,0x43,0x82,0xFB,0xA0,0xE4,0x00,0x04,
+	0x00,0x80,0xA6,0x45,0x63,0x00,0x80,0xA6,0x43,0x63,0x00,0x80,0xA6,0x45,0x82,0xFA,
+	0x00,0x21,0x40,0x63,0x00,0x21,0x41,0x63,0xA0,0x20,0x01,0x03,0x45,0x63,0x00,0x21,
+	0x47,0x63,0x00,0x21,0x48,0x63,0x00,0x21,0x43,0x82,0xFB,0xA0,0xE4,0x00,0x04,0x00,
+	0x80,0xA6,0x40,0x63,0x00,0x80,0xA6,0x47,0x63,0x00,0x80,0xA6,0x45,0x82,0xFB,0x00,
+	0x80,0xA6,0x48,0x63,0xA0,0x2E,0x01,0x03,0x45,0x63,0x00,0x21,0x43,0x63,0x00,0x21,
+	0x41,0x63,0x00,0x21,0x3E,0x83,0x7F,0x00,0x21,0x3B,0x63,0x00,0x21,0x3C,0x63,0x00,
+	0x21,0x3E,0x63,0xA0,0xC1,0x00,0x04,0xA0,0x20,0x01,0x04,0xA0,0x20,0x01,0x03,0x41,
+	0x85,0x0C,0x00,0x21,0x43,0x81,0x8E,0x37,0x81,0x6C,0xA0,0x67,0x01,0x03,0x3E,0x63,
+	0xA0,0x6E,0x00,0x05,0x3B,0x63,0x00,0x21,0x3E,0x63,0xA0,0x5A,0x01,0x05,0x40,0x63,
+	0x00,0x21,0x41,0x81,0xF1,0x00,0x21,0x4C,0x63,0x00,0x21,0x4A,0x63,0xA0,0xA5,0x01,
+	0x04,0xA0,0x32,0x01,0x03,0x47,0x63,0xA0,0x0C,0x00,0x16,0xA0,0x23,0x00,0x03,0xA0,
+	0x43,0x00,0x09,0xA0,0x23,0x00,0x03,0xA0,0x5C,0x00,0x05,0xA0,0x1E,0x00,0x03,0xA0,
+	0x6B,0x00,0x08,0xA0,0x0E,0x00,0x0A,0xA0,0x8F,0x00,0x02,0xA0,0x2A,0x00,0x06,0x43,
+	0x81,0x6C,0xA0,0x1E,0x00,0x03,0xA0,0x8F,0x00,0x02,0xA0,0x6B,0x00,0x07,0x00,0x81,
+	0x6C,0xA0,0x20,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x5C,0x00,0x05,0xA0,0xA8,0x00,
+	0x03,0xA0,0x6B,0x00,0x06,0xA0,0x8F,0x00,0x02,0xA0,0x43,0x00,0x05,0xA0,0xBB,0x00,
+	0x07,0xA0,0x6B,0x00,0x05,0xA0,0xD0,0x00,0x0D,0xA0,0x43,0x00,0x05,0xA0,0xBB,0x00,
+	0x07,0xA0,0xE1,0x00,0x05,0x00,0x84,0xCB,0xA0,0xD3,0x00,0x05,0x00,0x81,0xAE,0xA0,
+	0xE1,0x00,0x06,0x43,0x82,0xFB,0xA0,0xE4,0x00,0x04,0xA0,0x10,0x01,0x0A,0xA0,0x20,
+	0x01,0x03,0xA0,0x2C,0x01,0x07,0xA0,0xE4,0x00,0x04,0xA0,0x3F,0x01,0x08,0xA0,0x2E,
+	0x01,0x03,0xA0,0x58,0x01,0x0D,0xA0,0xC1,0x00,0x04,0xA0,0x20,0x01,0x04,0xA0,0x20,
+	0x01,0x03,0xA0,0x7F,0x01,0x04,0xA0,0x67,0x01,0x03,0x3E,0x63,0xA0,0x6E,0x00,0x05,
+	0xA0,0x94,0x01,0x03,0xA0,0x5A,0x01,0x05,0xA0,0x9E,0x01,0x07,0xA0,0xA5,0x01,0x04,
+	0xA0,0x32,0x01,0x03,0x47,0x63,0xA0,0x0C,0x00,0x16,0xA0,0x23,0x00,0x03,0xA0,0x43,
+	0x00,0x09,0xA0,0x23,0x00,0x03,0xA0,0x5C,0x00,0x05,0xA0,0x1E,0x00,0x03,0xA0,0x6B,
+	0x00,0x08,0xA0,0x0E,0x00,0x0A,0xA0,0x8F,0x00,0x02,0xA0,0x2A,0x00,0x06,0x43,0x81,
+	0x6C,0xA0,0x1E,0x00,0x03,0xA0,0x8F,0x00,0x02,0xA0,0x6B,0x00,0x07,0x00,0x81,0x6C,
+	0xA0,0x20,0x00,0x02,0xA0,0x9F,0x00,0x02,0xA0,0x5C,0x00,0x05,0xA0,0xA8,0x00,0x03,
+	0xA0,0x6B,0x00,0x06,0xA0,0x8F,0x00,0x02,0xA0,0x43,0x00,0x05,0xA0,0xBB,0x00,0x07,
+	0xA0,0x6B,0x00,0x05,0xA0,0xD0,0x00,0x0D,0xA0,0x43,0x00,0x05,0xA0,0xBB,0x00,0x07,
+	0xA0,0xE1,0x00,0x05,0x00,0x84,0xCB,0xA0,0xD3,0x00,0x05,0x00,0x81,0xAE,0xA0,0xE1,
+	0x00,0x06,0x43,0x82,0xFB,0xA0,0xE4,0x00,0x04,0xA0,0x10,0x01,0x0A,0xA0,0x20,0x01,
+	0x03,0xA0,0x2C,0x01,0x07,0xA0,0xE4,0x00,0x04,0xA0,0x3F,0x01,0x07,0x8E,0x48,0x63,
+	0x00,0x21,0x47,0x63,0x00,0x21,0x45,0x63,0x00,0x21,0x43,0x63,0x00,0x21,0x41,0x63,
+	0x00,0x21,0x3E,0x83,0x7F,0x00,0x21,0x8C,0x3B,0x63,0x00,0x21,0x3C,0x63,0x00,0x21,
+	0x3E,0x63,0x00,0x21,0x3E,0x21,0x00,0x21,0x3E,0x21,0x00,0x21,0x40,0x63,0x00,0x21,
+	0x41,0x63,0xA0,0x4A,0x03,0x03,0x41,0x85,0x0C,0x00,0x21,0x8A,0x43,0x81,0x8E,0x89,
+	0x37,0x81,0x6C,0x00,0x21,0x3B,0x63,0x00,0x21,0x3E,0x42,0x87,0x3E,0x21,0x00,0x21,
+	0x43,0x21,0x00,0x21,0x43,0x21,0x00,0x21,0x3B,0x63,0x00,0x21,0x3E,0x63,0x00,0x21,
+	0x43,0x63,0x00,0x21,0x41,0x63,0x00,0x21,0x40,0x63,0x00,0x21,0x41,0x42,0x85,0x41,
+	0x81,0xAF,0x00,0x21,0x4C,0x63,0x00,0x21,0x4A,0x63,0x00,0x21,0x4C,0x42,0x83,0x4C,
+	0x21,0x00,0x21,0x4A,0x63,0x00,0x21,0x48,0x63,0x00,0x21,0x47,0x63,0x00,0x21,0xFF
 };
 
 #endif
@@ -2,1107 +2,299 @@
 #ifndef __MUSIC_E1M6_H__
 #define __MUSIC_E1M6_H__
 
-#define MUSIC_E1M6_NOTE_COUNT  2593
-#define MUSIC_E1M6_HAS_ARP     0
+#define MUSIC_E1M6_LENGTH_MS  120000
 
-static const int music_e1m6_melody[2593] = {
-	0x0000,0x0000,0x0000,0x0000,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,
-	0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4B0,0xF4B0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,0xF4C0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4C0,0xF4B0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF4F0,0xF4F0,
-	0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4C0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,
-	0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,
-	0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF520,
-	0xF520,0xF520,0xF520,0xF520,0xF520,0xF520,0xF520,0xF520,0xF520,0xF520,0xF510,0xF510,
-	0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,
-	0xF520,0xF520,0xF510,0xF510,0xF510,0xF510,0xF510,0xF510,0xF520,0xF510,0xF510,0xF510,
-	0xF510,0xF510,0xF510,0xF520,0xF520,0xF510,0xF510,0xF510,0xF510,0xF550,0xF550,0xF550,
-	0xF550,0xF550,0xF550,0xF550,0xF550,0xF550,0xF550,0xF550,0xF550,0xF540,0xF540,0xF540,
-	0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,
-	0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF550,0xF550,0xF540,0xF540,0xF540,
-	0xF540,0xF540,0xF540,0xF540,0xF550,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,
-	0xF540,0xF550,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,0xF550,0xF540,0xF540,
-	0xF540,0xF540,0xF540,0xF540,0xF540,0xF550,0xF540,0xF540,0xF540,0xF540,0xF540,0xF540,
-	0xF550,0xF540,0xF540,0xF540,0xF540,0xF540,0xF550,0xF540,0xF540,0xF540,0xF540,0xF540,
-	0xF550,0xF550,0xF540,0xF540,0xF540,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF4F0,0xF4F0,
-	0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,
-	0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4C0,0xF4B0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF500,0xF500,
-	0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF500,0xF4F0,0xF4F0,0xF4F0,0xF4F0,0xF4F0,
-	0xF4F0,0xF4F0,0xF4F0,0xF4B0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4E0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4B0,
-	0xF4B0,0xF4C0,0xF4B0,0xF4B0,0xF4B0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0
+static const unsigned char music_e1m6_melody[376] = {
+	0x00,0x80,0xFD,0x8F,0x4D,0xFF,0xD2,0x4D,0xC2,0x70,0x4E,0x2C,0x4D,0x80,0x87,0x4E,
+	0x1E,0x4D,0x80,0x87,0x4E,0x2C,0x4D,0x80,0x86,0x4E,0x2D,0x4D,0x76,0x4E,0x2D,0x4D,
+	0x78,0x4E,0x2C,0x4D,0x78,0x4E,0x2D,0x4D,0x80,0x86,0x50,0x81,0x38,0x4F,0x81,0x38,
+	0x4B,0x80,0x94,0x4D,0x83,0x06,0xA0,0x0F,0x00,0x04,0x4E,0x1E,0x4D,0x80,0x86,0x4B,
+	0x82,0xF8,0x4C,0x3B,0x4B,0x69,0x4C,0x4A,0x4B,0x69,0x4C,0x3B,0x4B,0x77,0x4D,0x82,
+	0x63,0xA0,0x21,0x00,0x04,0xA0,0x21,0x00,0x03,0x4D,0x76,0x4E,0x2D,0xA0,0x11,0x00,
+	0x02,0xA0,0x23,0x00,0x03,0x50,0x81,0x2A,0xA0,0x2D,0x00,0x02,0x4D,0x83,0x07,0x4E,
+	0x2D,0xA0,0x11,0x00,0x02,0x4D,0x78,0x4E,0x2D,0x4D,0x80,0x85,0xA0,0x3F,0x00,0x07,
+	0x4D,0x84,0xF2,0x4E,0x2D,0xA0,0x23,0x00,0x03,0x4E,0x2D,0x4D,0x77,0x4E,0x2D,0x4D,
+	0x77,0xA0,0x25,0x00,0x02,0xA0,0x3A,0x00,0x02,0x4E,0x2D,0x4D,0x77,0x4E,0x2C,0x4D,
+	0x76,0xA0,0x25,0x00,0x02,0xA0,0x3A,0x00,0x02,0xA0,0x89,0x00,0x04,0x4E,0x2D,0x4D,
+	0x80,0x87,0x4E,0x2D,0xA0,0x23,0x00,0x03,0x4E,0x1E,0x4D,0xFF,0xCA,0x4D,0x9F,0x87,
+	0x4E,0x81,0xBE,0x4D,0x81,0x48,0xA0,0x0F,0x00,0x04,0xA0,0x0A,0x00,0x02,0x52,0x81,
+	0xBE,0x51,0x81,0x39,0x52,0x4A,0x51,0x69,0x52,0x3B,0x51,0x69,0x52,0x4A,0x51,0x77,
+	0x55,0x81,0xCD,0x54,0x82,0x72,0x55,0x3B,0x54,0x69,0x55,0x4A,0x54,0x69,0x55,0x3B,
+	0x54,0x69,0xA0,0xE6,0x00,0x03,0x54,0x5A,0x55,0x4A,0x54,0x68,0xA0,0xE6,0x00,0x03,
+	0x54,0x77,0x4D,0x82,0x63,0xA0,0x21,0x00,0x04,0xA0,0x21,0x00,0x03,0x4D,0x77,0xA0,
+	0xAD,0x00,0x02,0xA0,0x0F,0x00,0x02,0xA0,0x25,0x00,0x02,0x50,0x81,0x2A,0xA0,0x2D,
+	0x00,0x02,0xA0,0x6C,0x00,0x02,0xA0,0x11,0x00,0x02,0xA0,0x23,0x00,0x03,0x4B,0x82,
+	0xF7,0x4C,0x3B,0x4B,0x69,0xA0,0x42,0x00,0x03,0x4B,0x67,0x4D,0x82,0x71,0xA0,0x21,
+	0x00,0x04,0xA0,0x0F,0x00,0x02,0x4E,0x2D,0x4D,0x67,0xA0,0x1D,0x00,0x03,0x4D,0x80,
+	0x86,0xA0,0x0F,0x00,0x02,0x50,0x81,0x39,0xA0,0x2D,0x00,0x02,0xA0,0x6C,0x00,0x02,
+	0xA0,0x0C,0x00,0x03,0xA0,0x25,0x00,0x02,0xA0,0x2E,0x01,0x03,0x4C,0x3C,0x4B,0x69,
+	0x4C,0x4A,0x4B,0x77,0x4D,0x81,0xA1,0xFF
 };
 
-static const int music_e1m6_bass[2593] = {
-	0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,
-	0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,
-	0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,
-	0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,
-	0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,
-	0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,
-	0xF2E0,0xF2E0,0x0000,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0xF2E0,0x0000,0x0000,0xF2E0,0xF2E0,
-	0xF2E0,0x0000,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0x0000,0x0000,0xF2A0,
-	0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,
-	0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,
-	0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,
-	0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0x0000,
-	0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,
-	0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,
-	0xF2C0,0x0000,0x0000,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0xF2C0,
-	0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,
-	0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF2C0,0xF2C0,
-	0xF2C0,0xF2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,
-	0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,
-	0x0000,0xF2A0,0xF2A0,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF2A0,
-	0xF2A0,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,0xF2A0,0xF2A0,0xF2A0,0x0000,0xF2A0,
-	0xF2A0,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0x0000,0xF290,0xF290,0x0000,
-	0xF290
+static const unsigned char music_e1m6_bass[1191] = {
+	0x00,0x80,0xA4,0x8F,0x29,0x91,0xBC,0x00,0x93,0x5B,0x29,0x81,0x2A,0x00,0x1E,0x29,
+	0x80,0x86,0xA0,0x0D,0x00,0x02,0x00,0x1E,0x29,0x77,0xA0,0x0D,0x00,0x02,0xA0,0x0D,
+	0x00,0x02,0xA0,0x0D,0x00,0x02,0x00,0x1E,0xA0,0x0A,0x00,0x02,0x29,0x80,0x87,0x00,
+	0x1E,0xA0,0x2C,0x00,0x02,0x29,0x80,0x86,0xA0,0x0D,0x00,0x02,0xA0,0x0D,0x00,0x02,
+	0x00,0x0F,0x29,0x80,0x95,0x00,0x1D,0x29,0x81,0x1A,0x00,0x1E,0x29,0x77,0x00,0x1E,
+	0x29,0x77,0xA0,0x0D,0x00,0x02,0x00,0x0F,0x29,0x80,0x86,0xA0,0x4A,0x00,0x04,0x00,
+	0x1E,0xA0,0x47,0x00,0x04,0x29,0x80,0x86,0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x04,
+	0x00,0x94,0x29,0xA0,0x47,0x00,0x05,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0x4A,
+	0x00,0x03,0x29,0x80,0x86,0x00,0x1E,0x29,0x81,0x0A,0x00,0x1E,0x29,0x80,0x85,0xA0,
+	0x4A,0x00,0x03,0x29,0x80,0x85,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0x56,0x00,
+	0x02,0x00,0x1E,0x29,0x81,0x19,0x00,0x0F,0x29,0x80,0x85,0xA0,0x4A,0x00,0x04,0xA0,
+	0x0D,0x00,0x02,0xA0,0x4A,0x00,0x03,0x29,0x80,0x85,0x00,0x1E,0x29,0x81,0x0B,0xA0,
+	0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0xA6,
+	0x00,0x02,0x00,0x93,0xFB,0xA0,0x47,0x00,0x02,0xA0,0x82,0x00,0x02,0x29,0x80,0x87,
+	0xA0,0xA6,0x00,0x02,0x00,0x1E,0xA0,0x2C,0x00,0x02,0x29,0x78,0xA0,0x0D,0x00,0x02,
+	0x00,0x1E,0x29,0x81,0x18,0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,
+	0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x03,0xA0,0x82,0x00,0x04,0xA0,0x82,0x00,0x02,
+	0xA0,0x82,0x00,0x02,0x29,0x77,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,0x4A,
+	0x00,0x03,0x29,0x81,0x19,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0x56,0x00,0x02,
+	0xA0,0x4A,0x00,0x03,0x29,0x80,0x85,0x00,0x8A,0x5A,0xA0,0x0A,0x00,0x03,0xA0,0x56,
+	0x00,0x02,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0x56,0x00,0x02,0x00,0x1E,0x29,
+	0x77,0x00,0xAA,0xA8,0x29,0x81,0x19,0xA0,0x4A,0x00,0x03,0xA0,0x82,0x00,0x02,0x29,
+	0x80,0x86,0xA0,0x40,0x00,0x02,0x00,0x1E,0xA0,0x2C,0x00,0x02,0x29,0x80,0x95,0x00,
+	0x1E,0x29,0x81,0x29,0x00,0x1E,0x29,0x80,0x95,0x00,0x0F,0x29,0x80,0x96,0x00,0x1E,
+	0x29,0x76,0xA0,0x0D,0x00,0x02,0xA0,0xA6,0x00,0x02,0x00,0x8A,0xA5,0xA0,0x71,0x01,
+	0x02,0x29,0x77,0xA0,0x0D,0x00,0x02,0xA0,0x4A,0x00,0x03,0xA0,0x6C,0x01,0x02,0xA0,
+	0x2C,0x00,0x02,0xA0,0xB7,0x00,0x02,0x29,0x81,0x39,0xA0,0x0D,0x00,0x02,0x00,0x1E,
+	0xA0,0x2C,0x00,0x02,0xA0,0xB7,0x00,0x02,0x29,0x77,0xA0,0x0D,0x00,0x02,0x00,0x8A,
+	0xB5,0xA0,0x47,0x00,0x04,0xA0,0x82,0x00,0x02,0xA0,0x4C,0x00,0x03,0xA0,0x4A,0x00,
+	0x03,0xA0,0x82,0x00,0x02,0xA0,0x0A,0x00,0x02,0xA0,0x2C,0x00,0x02,0xA0,0x6C,0x01,
+	0x02,0xA0,0x82,0x00,0x02,0xA0,0x82,0x00,0x02,0xA0,0x82,0x00,0x02,0xA0,0x6C,0x01,
+	0x02,0x29,0x81,0x28,0xA0,0x0D,0x00,0x02,0xA0,0x74,0x01,0x02,0xA0,0x0D,0x00,0x02,
+	0xA0,0x0D,0x00,0x02,0x00,0x1E,0xA0,0x7B,0x01,0x02,0xA0,0x2C,0x00,0x02,0xA0,0x71,
+	0x01,0x02,0x29,0x77,0xA0,0x0D,0x00,0x02,0xA0,0x4A,0x00,0x04,0x00,0x1E,0x29,0x77,
+	0x00,0x80,0xC2,0x29,0x91,0xBC,0x00,0x93,0x6A,0xA0,0x47,0x00,0x04,0xA0,0x82,0x00,
+	0x02,0xA0,0x4C,0x00,0x03,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0x00,0x1E,0x29,
+	0x81,0x1B,0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x04,0xA0,0x0D,0x00,0x02,0xA0,0x4A,
+	0x00,0x04,0xA0,0x3D,0x02,0x02,0xA0,0x4A,0x00,0x04,0xA0,0x0D,0x00,0x02,0xA0,0x56,
+	0x00,0x02,0xA0,0x4A,0x00,0x03,0xA0,0x82,0x00,0x02,0x29,0x81,0x0B,0xA0,0x4A,0x00,
+	0x03,0xA0,0x82,0x00,0x02,0xA0,0x4C,0x00,0x03,0x00,0x1E,0x29,0x77,0x00,0x93,0xE6,
+	0x29,0x81,0x19,0xA0,0x4A,0x00,0x04,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,
+	0x4A,0x00,0x03,0xA0,0x82,0x00,0x02,0xA0,0xA3,0x00,0x03,0xA0,0x0D,0x00,0x02,0xA0,
+	0xA6,0x00,0x02,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,0x4A,0x00,0x03,0x29,
+	0x81,0x1B,0x00,0x1E,0x29,0x76,0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0xA0,0x56,0x00,
+	0x02,0xA0,0x4A,0x00,0x03,0xA0,0xB7,0x00,0x03,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,
+	0x02,0xA0,0x4A,0x00,0x03,0xA0,0x82,0x00,0x02,0x29,0x76,0x00,0x8A,0x57,0xA0,0x87,
+	0x00,0x02,0xA0,0x82,0x00,0x02,0x29,0x77,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,
+	0xA0,0x4A,0x00,0x03,0x29,0x80,0x86,0x00,0x85,0x6A,0x2E,0x80,0x85,0x00,0x1E,0x2E,
+	0x80,0x85,0x00,0x0F,0x2E,0x80,0x86,0x00,0x1E,0xA0,0x04,0x03,0x02,0xA0,0x04,0x03,
+	0x02,0x2E,0x77,0xA0,0xFD,0x02,0x02,0x00,0x1E,0xA0,0x04,0x03,0x02,0xA0,0xFF,0x02,
+	0x02,0xA0,0xFA,0x02,0x03,0x00,0x1E,0x2E,0x80,0x86,0x00,0x0F,0xA0,0xFA,0x02,0x02,
+	0xA0,0x04,0x03,0x02,0xA0,0x04,0x03,0x02,0x2E,0x77,0x00,0x1E,0x2A,0x80,0x85,0xA0,
+	0x3A,0x03,0x02,0x00,0x1E,0x2A,0x80,0x86,0x00,0x0F,0x2A,0x80,0x85,0xA0,0x43,0x03,
+	0x02,0x00,0x1E,0x2A,0x77,0xA0,0x43,0x03,0x02,0xA0,0x43,0x03,0x02,0xA0,0x3A,0x03,
+	0x02,0x00,0x1E,0x2A,0x76,0xA0,0x3A,0x03,0x02,0xA0,0x3A,0x03,0x02,0xA0,0x48,0x03,
+	0x02,0xA0,0x3A,0x03,0x02,0xA0,0x43,0x03,0x02,0x00,0x1E,0x2A,0x77,0xA0,0x8A,0x00,
+	0x02,0xA0,0x8A,0x00,0x02,0xA0,0x0D,0x00,0x02,0xA0,0xA6,0x00,0x02,0xA0,0x0D,0x00,
+	0x02,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,0x0D,0x00,0x02,0x00,0x85,0x0E,
+	0x2C,0x80,0x86,0x00,0x1E,0x2C,0x77,0x00,0x1E,0x2C,0x80,0x85,0xA0,0xA3,0x03,0x03,
+	0xA0,0xA0,0x03,0x02,0x2C,0x80,0x86,0x00,0x0F,0x2C,0x80,0x95,0x00,0x0F,0x2C,0x80,
+	0x85,0x00,0x84,0xEE,0x2A,0x80,0x85,0xA0,0x43,0x03,0x02,0x00,0x1E,0x2A,0x77,0xA0,
+	0x4A,0x00,0x03,0x29,0x80,0x85,0xA0,0x40,0x00,0x02,0x00,0x1E,0xA0,0x2C,0x00,0x02,
+	0xA0,0x6C,0x01,0x02,0x2A,0x80,0x85,0xA0,0x43,0x03,0x02,0x00,0x1E,0x2A,0x77,0xA0,
+	0x0D,0x00,0x02,0xA0,0xA6,0x00,0x02,0xA0,0x0D,0x00,0x02,0xA0,0x0D,0x00,0x02,0xA0,
+	0x74,0x01,0x02,0xA0,0x43,0x03,0x02,0xA0,0x3A,0x03,0x02,0x00,0x1E,0x2A,0x77,0xA0,
+	0x0D,0x00,0x02,0xA0,0xA6,0x00,0x02,0xA0,0x0D,0x00,0x02,0xA0,0x56,0x00,0x02,0xA0,
+	0x74,0x01,0x03,0xA0,0x6C,0x01,0x02,0xA0,0x6C,0x01,0x02,0xA0,0x82,0x00,0x02,0xA0,
+	0x82,0x00,0x02,0x29,0x80,0x95,0x00,0x81,0x65,0xA0,0x71,0x01,0x02,0x29,0x77,0xA0,
+	0x0D,0x00,0x02,0xA0,0x4A,0x00,0x03,0xA0,0x6C,0x01,0x02,0xA0,0x2C,0x00,0x02,0xA0,
+	0xB7,0x00,0x02,0x29,0x81,0x3A,0x00,0x1E,0xA0,0x2C,0x00,0x02,0xA0,0x2C,0x00,0x02,
+	0xA0,0xB7,0x00,0x02,0xA0,0x4C,0x00,0x03,0x00,0x8A,0xB5,0x29,0x81,0x28,0xA0,0x4A,
+	0x00,0x04,0xA0,0x0D,0x00,0x02,0xA0,0x8A,0x00,0x02,0x00,0x1E,0x29,0x80,0x96,0xA0,
+	0x40,0x00,0x02,0x00,0x1E,0xA0,0x0A,0x00,0x03,0xA0,0x0D,0x00,0x02,0xA0,0x4A,0x00,
+	0x03,0xA0,0x82,0x00,0x02,0x29,0x77,0x00,0x8A,0xB7,0xA0,0x71,0x01,0x02,0xA0,0x4C,
+	0x00,0x03,0x00,0x1E,0x29,0x2D,0xFF
 };
 
-static const int music_e1m6_chords[2593] = {
-	0x0000,0xF4D0,0x0000,0xF290,0xF290,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,0x0000,
-	0xF370,0x0000,0xF290,0xF380,0x0000,0xF290,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,
-	0x0000,0xF370,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,0x0000,0xF290,0x0000,0xF380,
-	0x0000,0xF290,0x0000,0xF370,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,0x0000,0xF290,
-	0x0000,0xF380,0x0000,0xF290,0x0000,0xF370,0x0000,0xF350,0x0000,0x0000,0xF2F0,0x0000,
-	0xF350,0x0000,0xF330,0x0000,0xF350,0x0000,0xF350,0x0000,0xF330,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF370,0x0000,0xF350,0x0000,0xF370,0x0000,0x0000,0x0000,0xF370,0x0000,
-	0x0000,0xF350,0xF350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF290,0x0000,0x0000,
-	0x0000,0x0000,0xF290,0x0000,0x0000,0xF380,0xF380,0xF380,0x0000,0xE280,0x0000,0x0000,
-	0xF290,0xF290,0xF2A0,0x0000,0xF2B0,0x0000,0xF2C0,0xF370,0xF2D0,0xE290,0xF2E0,0xF2A0,
-	0xF2F0,0xF2F0,0xF290,0x0000,0xF300,0xF2C0,0xF2D0,0xF2D0,0xF320,0xF380,0xF330,0xF2F0,
-	0xF340,0xF300,0xF350,0xF350,0xF290,0xF360,0xF320,0xF370,0xF330,0xF380,0xF380,0xF340,
-	0xF390,0xF350,0xF3A0,0xF360,0xF360,0xF3B0,0xF290,0x0000,0xF3C0,0xF380,0xF3D0,0xF390,
-	0xF390,0xF3E0,0xF3E0,0xF380,0xF3F0,0xF3B0,0xF400,0xF3C0,0xF3C0,0xF410,0xF290,0xF420,
-	0xF3E0,0xF430,0xF3F0,0xF3F0,0xF440,0xF440,0xF370,0xF410,0xF460,0xF420,0xF420,0xF470,
-	0xF290,0xF480,0xF440,0xF490,0xF450,0xF450,0xF380,0xF380,0xF4B0,0xF470,0xF4C0,0xF480,
-	0xF480,0xF290,0xF290,0xF290,0xF4A0,0xF4B0,0xF4B0,0xF4B0,0xF4C0,0xF4D0,0xF4D0,0xF290,
-	0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0x0000,0x0000,0xF370,0xF370,0x0000,0xF290,
-	0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0xF290,0xF290,0x0000,0xF290,0x0000,
-	0x0000,0xF380,0xF380,0x0000,0xF290,0x0000,0x0000,0xF370,0xF370,0xF370,0x0000,0xF350,
-	0x0000,0x0000,0xF2F0,0xF2F0,0x0000,0x0000,0x0000,0xF410,0x0000,0x0000,0xF440,0xF350,
-	0x0000,0xF410,0xF410,0x0000,0xF440,0xF330,0xF330,0xF410,0x0000,0xF440,0xF440,0x0000,
-	0xF350,0xF350,0xF440,0x0000,0x0000,0xF410,0x0000,0x0000,0xF350,0xF350,0x0000,0x0000,
-	0xF330,0xF330,0x0000,0x0000,0xF3F0,0xF3F0,0x0000,0xF3F0,0x0000,0x0000,0xF370,0xF370,
-	0x0000,0xF410,0xF350,0xF430,0x0000,0xF440,0xF440,0x0000,0xF410,0x0000,0xF440,0xF370,
-	0xF440,0x0000,0xF440,0xF440,0x0000,0xF440,0x0000,0xF460,0xF460,0x0000,0xF440,0x0000,
-	0xF460,0x0000,0xF480,0x0000,0xF490,0xF490,0xF370,0xF460,0x0000,0xF490,0xF350,0xF350,
-	0xF480,0xF4B0,0xF490,0xF490,0x0000,0x0000,0xF4A0,0xF4B0,0xF4B0,0x0000,0x0000,0xF350,
-	0xF350,0xF350,0xF480,0xF480,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF460,0xF460,0xF290,
-	0x0000,0x0000,0xF350,0xF350,0xF460,0xF480,0xF440,0xF440,0xF460,0xF460,0xF290,0x0000,
-	0xF480,0xF480,0xF440,0xF440,0xF290,0x0000,0xF460,0xF460,0xF410,0xF290,0x0000,0xF440,
-	0xF440,0xF290,0xF290,0x0000,0xF410,0xF410,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,
-	0x0000,0xF350,0xF350,0xF480,0xF480,0xF290,0xF290,0x0000,0xF480,0xF480,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF4B0,0xF4B0,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0x0000,0xF4B0,0xF4B0,0xF350,0xF350,0xF350,0xF350,0xF480,0xF480,
-	0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF480,0xF480,
-	0xF350,0xF350,0xF350,0xF350,0xF480,0xF480,0xF480,0x0000,0xF440,0xF440,0xF310,0xF440,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xF430,0xF430,0x0000,0xF410,0xF410,0x0000,0xF430,
-	0xF440,0xF310,0xF410,0xF410,0xF410,0x0000,0xF440,0x0000,0xF430,0x0000,0xF410,0xF410,
-	0x0000,0xF430,0xF440,0x0000,0xF410,0xF430,0xF430,0x0000,0xF440,0xF410,0x0000,0xF430,
-	0xF440,0xF440,0x0000,0xF410,0xF330,0xF330,0xF440,0xF440,0x0000,0xF460,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF440,0x0000,0xF430,0xF430,0x0000,0xF440,0xF460,0xF370,
-	0xF430,0xF430,0xF430,0x0000,0xF460,0x0000,0xF440,0xF350,0x0000,0xF430,0xF330,0xF440,
-	0xF410,0xF410,0xF310,0xF430,0xF3F0,0xF330,0xF410,0xF460,0xF460,0xF370,0xF3F0,0xF3F0,
-	0xF3F0,0x0000,0xF460,0x0000,0xF4B0,0xF350,0xF350,0xF4C0,0xF4B0,0xF4D0,0x0000,0x0000,
-	0xF4D0,0xF290,0x0000,0xF4C0,0xF4C0,0xF4D0,0xF4D0,0xF290,0x0000,0xF4D0,0x0000,0x0000,
-	0xF290,0xF4D0,0x0000,0x0000,0xF4D0,0xF4D0,0xF290,0x0000,0xF4D0,0x0000,0x0000,0xF290,
-	0xF290,0x0000,0xF4D0,0x0000,0x0000,0xF4D0,0xF4D0,0xF290,0x0000,0xF4D0,0x0000,0x0000,
-	0xF4B0,0xF350,0xF4D0,0xF4D0,0xF4D0,0x0000,0xF4B0,0xF4B0,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF4D0,0xF4D0,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0x0000,0x0000,0xF350,0xF350,0xF350,0xF4C0,0xF4B0,0xF4A0,
-	0xF290,0xF290,0x0000,0xF480,0xF4C0,0xF4C0,0xF290,0xF290,0x0000,0xF4A0,0xF490,0xF490,
-	0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0x0000,
-	0xF4B0,0xF4B0,0xF480,0xF350,0xF350,0xF480,0xF480,0xF290,0xF290,0x0000,0x0000,0xF290,
-	0xF290,0x0000,0x0000,0xF290,0x0000,0x0000,0xF480,0xF480,0xF350,0xF350,0xF460,0xF460,
-	0xF480,0xF480,0xF440,0xF460,0xF410,0xF410,0xF310,0xF440,0x0000,0xF410,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xF3D0,0x0000,0xF3F0,0x0000,0xF3D0,0xF430,0xF430,0xF330,
-	0xF3F0,0xF3F0,0xF3F0,0x0000,0xF430,0x0000,0x0000,0x0000,0x0000,0xF410,0xF410,0x0000,
-	0xF3F0,0x0000,0x0000,0xF420,0xF410,0xF430,0xF440,0xF350,0xF350,0xF350,0xF420,0xF410,
-	0xF430,0xF430,0xF440,0xF430,0xF430,0xF290,0xF290,0x0000,0xF410,0xF410,0xF290,0xF290,
-	0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0x0000,
-	0xF290,0xF290,0xF290,0x0000,0x0000,0xF310,0xF310,0xF310,0xF310,0x0000,0x0000,0xF330,
-	0xF330,0xF330,0x0000,0xF3C0,0x0000,0xF3F0,0xF3F0,0x0000,0xF3C0,0xF430,0xF430,0xF370,
-	0xF3F0,0xF3F0,0x0000,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,0xF430,
-	0xF430,0xF430,0xF430,0x0000,0xF3D0,0xF3D0,0x0000,0xF410,0xF410,0xF3D0,0xF440,0xF440,
-	0xF380,0xF410,0xF410,0x0000,0xF440,0xF440,0xF440,0xF440,0xF440,0xF440,0xF440,0xF440,
-	0xF450,0xF460,0xF470,0xF470,0xF480,0xF490,0xF450,0xF460,0xF460,0xF470,0xF480,0xF480,
-	0xF490,0xF490,0xF490,0xF490,0xF490,0x0000,0xF3F0,0x0000,0xF430,0xF430,0xF3F0,0xF480,
-	0xF480,0xF370,0xF370,0xF430,0xF430,0x0000,0xF480,0xF480,0xF480,0xF480,0xF480,0xF480,
-	0xF480,0xF480,0xF480,0xF480,0xF480,0xF480,0x0000,0xF410,0xF410,0x0000,0xF440,0xF440,
-	0xF410,0xF490,0xF490,0xF380,0xF440,0xF440,0x0000,0xF490,0xF490,0xF490,0xF490,0x0000,
-	0x0000,0xF430,0xF430,0x0000,0xF460,0xF460,0xF430,0xF4B0,0xF4B0,0xF3A0,0xF460,0x0000,
-	0xF4B0,0x0000,0xF4F0,0x0000,0xF480,0xF480,0xF290,0xF290,0xF480,0xF480,0xF290,0x0000,
-	0x0000,0xF380,0xF380,0x0000,0xF4E0,0xF4E0,0xF4D0,0xF290,0x0000,0x0000,0xF370,0xF4E0,
-	0xF4D0,0xF370,0xF370,0xF370,0x0000,0xF4E0,0xF4E0,0xF4D0,0xF290,0x0000,0x0000,0xF460,
-	0xF460,0x0000,0xF440,0xF4E0,0xF4D0,0xF380,0xF380,0xF380,0x0000,0xF4E0,0xF4E0,0xF4D0,
-	0xF290,0xF290,0xF440,0xF440,0xF4E0,0xF4D0,0xF4D0,0xF480,0xF480,0xF480,0xF4E0,0xF4E0,
-	0xF290,0xF4D0,0xF290,0xF290,0xF290,0xF290,0xF380,0xF500,0xF380,0xF380,0xF410,0xF410,
-	0xF410,0xF290,0xF290,0xF290,0xF290,0xF290,0xF4F0,0xF4F0,0xF370,0x0000,0xF350,0x0000,
-	0x0000,0x0000,0xF4B0,0xF4B0,0xF2F0,0x0000,0xF480,0xF4D0,0x0000,0x0000,0x0000,0xF480,
-	0x0000,0x0000,0x0000,0xF480,0xF480,0xF350,0x0000,0xF480,0x0000,0xF4E0,0xF4E0,0xF4D0,
-	0xF330,0x0000,0xF4E0,0xF4D0,0x0000,0x0000,0xF460,0xF460,0x0000,0xF440,0xF4E0,0xF4D0,
-	0x0000,0x0000,0x0000,0xF4B0,0xF4B0,0x0000,0xF440,0xF440,0x0000,0xF430,0x0000,0x0000,
-	0xF440,0xF370,0x0000,0x0000,0xF440,0xF4C0,0xF4C0,0xF4B0,0xF350,0x0000,0xF4C0,0xF4C0,
-	0xF4B0,0x0000,0x0000,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,0x0000,0xF460,0x0000,0xF290,
-	0xF4D0,0xF290,0xF290,0xF290,0xF290,0xF480,0xF480,0xF290,0x0000,0x0000,0xF380,0xF380,
-	0x0000,0xF290,0xF4E0,0xF4D0,0xF290,0xF290,0xF460,0xF4E0,0xF4D0,0xF370,0xF370,0xF370,
-	0x0000,0xF290,0xF4E0,0xF4E0,0xF4D0,0xF290,0x0000,0x0000,0xF460,0xF460,0x0000,0xF4E0,
-	0xF4E0,0xF4D0,0xF380,0xF380,0xF380,0x0000,0xF480,0xF4E0,0xF4D0,0xF290,0xF290,0xF440,
-	0xF440,0xF440,0xF4E0,0xF4D0,0xF4D0,0xF480,0xF480,0xF480,0xF4E0,0xF4E0,0xF4D0,0xF290,
-	0x0000,0x0000,0x0000,0x0000,0xF380,0xF500,0xF380,0xF380,0xF410,0xF410,0xF410,0xF290,
-	0xF290,0x0000,0x0000,0x0000,0xF4F0,0xF4F0,0xF370,0x0000,0xF350,0x0000,0x0000,0x0000,
-	0xF2F0,0xF4B0,0xF2F0,0xF4D0,0xF4D0,0x0000,0x0000,0xF480,0x0000,0x0000,0xF480,0xF480,
-	0xF350,0x0000,0xF480,0x0000,0xF4E0,0xF4E0,0xF4D0,0xF330,0x0000,0xF4E0,0xF4D0,0x0000,
-	0x0000,0xF460,0xF460,0x0000,0xF4E0,0xF4E0,0xF4D0,0x0000,0x0000,0x0000,0xF430,0xF4B0,
-	0x0000,0x0000,0xF440,0xF440,0xF440,0xF440,0x0000,0xF430,0x0000,0x0000,0xF440,0xF370,
-	0x0000,0x0000,0xF440,0xF350,0xF4C0,0xF4B0,0xF350,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,
-	0x0000,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,0x0000,0xF460,0xF460,0x0000,0xF290,0xF4D0,
-	0xF4D0,0xF290,0xF290,0xF290,0xF440,0xF440,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,
-	0xF290,0xF290,0xF290,0xF370,0xF370,0x0000,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,
-	0xF3A0,0xF3A0,0xF4E0,0xF4D0,0xF420,0xF410,0xF410,0xF410,0xF4E0,0xF4D0,0xF4D0,0xF430,
-	0xF430,0xF430,0xF290,0xF4E0,0xF4D0,0xF410,0xF410,0xF410,0xF410,0xF380,0xF380,0xF4E0,
-	0xF4D0,0xF4D0,0xF4D0,0xF290,0xF290,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF370,0xF370,
-	0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF290,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF380,
-	0xF380,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF290,0xF290,0xF290,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF290,0xF290,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF380,0xF380,0xF380,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF290,0xF290,0xF4E0,0xF4D0,
-	0xF4D0,0xF4D0,0xF4D0,0xF370,0xF370,0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF290,0xF290,
-	0xF4E0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF4D0,0xF380,0xF380,0xF4E0,0xF4D0,0xF4D0,0xF4D0,
-	0xF4D0,0xF4D0,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0xF290,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0x0000,0xF380,0xF380,0xF380,0x0000,0xF290,0xF290,0xF290,0xF370,0xF370,
-	0x0000,0xF350,0xF350,0x0000,0x0000,0x0000,0x0000,0xF290,0xF290,0x0000,0xF290,0x0000,
-	0xF380,0x0000,0xF290,0x0000,0xF370,0x0000,0xF290,0xF380,0x0000,0xF290,0x0000,0xF290,
-	0x0000,0xF380,0x0000,0xF290,0x0000,0xF370,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,
-	0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,0xF370,0x0000,0xF290,0x0000,0xF380,0x0000,
-	0xF290,0x0000,0xF290,0x0000,0xF380,0x0000,0xF290,0x0000,0xF370,0x0000,0xF350,0x0000,
-	0x0000,0xF2F0,0x0000,0xF350,0x0000,0xF330,0x0000,0xF350,0x0000,0xF350,0x0000,0xF330,
-	0x0000,0x0000,0x0000,0xF370,0x0000,0xF350,0x0000,0xF370,0x0000,0x0000,0x0000,0xF370,
-	0x0000,0x0000,0xF350,0xF350,0x0000,0x0000,0x0000,0x0000,0xF590,0xF590,0xF290,0xF290,
-	0xF590,0xF590,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0xF290,0x0000,0x0000,
-	0xF370,0xF370,0x0000,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0xF290,0xF290,
-	0xF290,0x0000,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0x0000,0x0000,0xF370,
-	0xF370,0x0000,0xF290,0xF290,0xF290,0xF290,0xF380,0xF380,0x0000,0xF290,0xF290,0x0000,
-	0xF290,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0x0000,0x0000,0xF370,0xF370,
-	0x0000,0xF290,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0xF290,0x0000,0x0000,0xF380,0xF380,0x0000,0xF290,0xF290,0xF290,0xF370,0xF370,
-	0x0000,0xF350,0x0000,0x0000,0xF2F0,0xF2F0,0x0000,0x0000,0x0000,0xF350,0xF350,0xF350,
-	0x0000,0xF330,0xF330,0x0000,0xF350,0xF350,0x0000,0x0000,0x0000,0xF350,0xF350,0x0000,
-	0xF330,0xF330,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF370,0xF370,
-	0x0000,0x0000,0xF350,0xF350,0x0000,0xF370,0xF370,0x0000,0x0000,0x0000,0x0000,0xF370,
-	0xF370,0xF370,0x0000,0xF350,0xF350,0x0000,0x0000,0xF480,0xF480,0xF350,0xF480,0xF480,
-	0xF290,0xF290,0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0x0000,0x0000,0xF4D0,0xF4D0,0xF290,0x0000,0x0000,0xF4B0,0xF350,
-	0xF4D0,0xF480,0xF480,0xF4B0,0xF4B0,0xF290,0xF480,0xF480,0xF440,0xF440,0xF290,0x0000,
-	0xF460,0xF460,0xF290,0xF440,0xF440,0xF290,0xF290,0x0000,0xF410,0xF410,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0xF290,0x0000,0x0000,0xF350,0xF480,0xF480,0xF480,0xF480,0xF290,
-	0xF290,0xF480,0xF480,0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0x0000,0xF290,0xF290,
-	0x0000,0x0000,0xF4B0,0xF4B0,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,0xF4B0,0xF4B0,
-	0xF480,0xF350,0xF350,0xF350,0xF480,0xF480,0xF290,0x0000,0x0000,0xF290,0xF290,0x0000,
-	0x0000,0xF290,0xF290,0x0000,0x0000,0xF480,0xF350,0xF350,0xF350,0xF350,0xF480,0xF480,
-	0xF480,0xF480,0x0000,0xF440,0xF440,0xF310,0xF440,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xF430,0xF430,0x0000,0xF410,0x0000,0xF430,0xF460,0xF460,0xF330,0xF410,0xF410,
-	0xF410,0x0000,0xF460,0x0000,0x0000,0x0000,0x0000,0xF440,0xF440,0x0000,0xF430,0xF430,
-	0x0000,0xF440,0xF410,0xF410,0xF350,0xF430,0x0000,0xF410,0xF410,0xF290,0xF290,0xF290,
-	0xF290,0xF290,0x0000,0x0000,0xF290,0x0000,0x0000,0xF290,0xF290,0xF290,0xF290,0xF290,
-	0x0000,0x0000,0xF290,0xF290,0x0000,0x0000,0xF310,0xF310,0xF310,0xF310,0x0000,0x0000,
-	0xF330,0xF330,0xF330,0x0000,0x0000,0xF410,0xF410,0xF3A0,0xF3D0,0x0000,0xF3A0,0x0000,
-	0xF410,0x0000,0xF2E0,0xF2E0,0xF2E0,0x0000,0xF3A0,0x0000,0xF3A0,0x0000,0xF410,0x0000,
-	0xF3D0,0xF3D0,0x0000,0xF3A0,0x0000,0xF2E0,0xF2E0,0x0000,0xF410,0x0000,0xF410,0xF2E0,
-	0xF3A0,0x0000,0xF3C0,0xF2E0,0x0000,0xF3C0,0xF410,0x0000,0xF3D0,0xF3D0,0xF3A0,0x0000,
-	0x0000,0xF3C0,0x0000,0xF410,0x0000,0xF410,0xF410,0xF2E0,0x0000,0xF3A0,0x0000,0xF3C0,
-	0xF3A0,0x0000,0xF410,0x0000,0xF410,0xF3D0,0x0000,0xF3A0,0x0000,0xF3C0,0xF2E0,0x0000,
-	0xF3C0,0xF410,0x0000,0xF3D0,0xF3D0,0xF2E0,0x0000,0xF3A0,0x0000,0xF2E0,0xF2E0,0x0000,
-	0xF410,0x0000,0xF420,0xF360,0xF3A0,0x0000,0xF3C0,0x0000,0xF420,0x0000,0xF2A0,0xF2A0,
-	0xF2A0,0x0000,0xF3A0,0x0000,0xF3A0,0xF360,0xF420,0x0000,0xF3D0,0xF3D0,0x0000,0xF3D0,
-	0xF3A0,0x0000,0xF3C0,0xF2A0,0x0000,0xF420,0x0000,0xF420,0xF2A0,0x0000,0xF3A0,0x0000,
-	0xF3C0,0xF2A0,0x0000,0xF3C0,0xF420,0x0000,0xF3D0,0xF3D0,0xF360,0xF3D0,0xF3A0,0x0000,
-	0xF3C0,0x0000,0xF440,0x0000,0xF440,0xF2A0,0xF3A0,0x0000,0xF3C0,0xF360,0xF440,0x0000,
-	0x0000,0x0000,0xF3D0,0x0000,0xF3A0,0x0000,0xF3C0,0xF2A0,0x0000,0xF420,0x0000,0xF3D0,
-	0xF3D0,0xF2A0,0x0000,0xF3D0,0xF3A0,0x0000,0xF3C0,0xF2A0,0x0000,0xF420,0xF420,0x0000,
-	0xF380,0xF350,0xF3A0,0x0000,0xF3C0,0x0000,0xF440,0xF380,0x0000,0xF3C0,0xF3C0,0xF290,
-	0x0000,0xF410,0x0000,0xF350,0xF480,0x0000,0xF410,0xF410,0xF4D0,0x0000,0xF480,0xF420,
-	0xF420,0xF440,0xF290,0x0000,0xF410,0xF410,0xF290,0xF290,0x0000,0xF410,0xF290,0x0000,
-	0x0000,0xF330,0xF330,0xF330,0xF3A0,0x0000,0xF3F0,0x0000,0xF360,0x0000,0x0000,0x0000,
-	0xF3F0,0x0000,0xF4E0,0xF330,0xF460,0x0000,0xF4B0,0xF4B0,0x0000,0xF4E0,0x0000,0xF490,
-	0x0000,0x0000,0x0000,0xF460,0xF430,0xF440,0x0000,0xF2C0,0xF2C0,0xF2C0,0xF430,0xF360,
-	0xF420,0xF420,0xF2C0,0xF2C0,0x0000,0xF380,0x0000,0xF3A0,0xF3A0,0xF2C0,0x0000,0xF380,
-	0x0000,0xF3A0,0xF2C0,0x0000,0xF3A0,0x0000,0xF3C0,0xF2C0,0x0000,0xF3A0,0x0000,0xF3C0,
-	0xF2C0,0x0000,0xF3C0,0x0000,0xF2C0,0xF2C0,0xF2C0,0x0000,0xF3C0,0xF3C0,0xF3F0,0xF2C0,
-	0x0000,0xF3F0,0x0000,0xF3D0,0xF3D0,0xF310,0xF3F0,0xF3F0,0xF3A0,0x0000,0xF3C0,0x0000,
-	0xF3D0,0xF3D0,0xF3A0,0x0000,0xF3C0,0xF3C0,0x0000,0xF3D0,0x0000,0xF3F0,0xF3F0,0xF3C0,
-	0x0000,0xF3D0,0xF3D0,0x0000,0xF3F0,0x0000,0xF410,0xF410,0xF410,0xF3D0,0x0000,0xF3F0,
-	0x0000,0xF410,0x0000,0xF360,0xF360,0xF4E0,0xF360,0xF3F0,0x0000,0xF410,0xF410,0x0000,
-	0xF420,0xF420,0xF420,0xF420,0xF420,0x0000,0xF4D0,0xF4D0,0xF350,0xF350,0xF350,0xF350,
-	0xF410,0xF410,0xF290,0xF4E0,0xF4D0,0xF290,0xF420,0xF420,0xF290,0xF4E0,0xF4E0,0xF4D0,
-	0xF290,0x0000,0x0000,0xF420,0xF420,0xF4E0,0xF4E0,0xF290,0xF4D0,0xF290,0xF290,0xF290,
-	0xF410,0xF410,0xF520,0xF520,0xF360,0xF360,0xF420,0xF420,0xF420,0xF420,0x0000,0xF420,
-	0xF420,0xF420,0xF420,0x0000,0xF510,0xF510,0xF350,0xF350,0xF350,0xF350,0xF410,0xF410,
-	0xF290,0xF520,0xF520,0xF510,0xF290,0xF420,0xF420,0xF520,0xF520,0xF510,0xF290,0x0000,
-	0x0000,0xF420,0xF420,0xF290,0xF520,0xF510,0xF290,0x0000,0x0000,0xF410,0xF410,0xF420,
-	0xF420,0xF550,0xF360,0xF360,0xF420,0xF420,0xF420,0xF420,0x0000,0xF420,0xF420,0xF420,
-	0xF420,0x0000,0xF410,0xF410,0xF540,0xF350,0xF350,0xF350,0xF350,0xF410,0xF410,0xF290,
-	0xF290,0xF420,0xF420,0xF290,0xF290,0xF420,0xF420,0xF290,0xF290,0xF550,0xF540,0xF290,
-	0xF410,0xF410,0xF290,0xF550,0xF540,0xF290,0x0000,0x0000,0xF420,0xF420,0xF420,0xF550,
-	0xF550,0xF540,0xF290,0x0000,0x0000,0xF410,0xF410,0xF290,0xF550,0xF550,0xF540,0xF290,
-	0x0000,0x0000,0x0000,0x0000,0xF550,0xF550,0xF540,0xF290,0x0000,0x0000,0x0000,0x0000,
-	0xF350,0xF350,0xF550,0xF540,0xF350,0xF350,0xF350,0x0000,0xF290,0xF550,0xF540,0xF290,
-	0xF290,0xF290,0xF550,0xF550,0xF540,0xF330,0xF330,0xF330,0x0000,0xF480,0xF4D0,0xF290,
-	0xF290,0xF460,0xF460,0xF460,0x0000,0xF480,0xF480,0xF290,0x0000,0x0000,0xF380,0xF380,
-	0x0000,0xF290,0xF4E0,0xF4D0,0xF290,0xF290,0xF460,0xF4E0,0xF4D0,0xF370,0xF370,0xF370,
-	0x0000,0xF290,0xF4E0,0xF4E0,0xF4D0,0xF290,0x0000,0x0000,0xF460,0xF460,0x0000,0xF4E0,
-	0xF4E0,0xF4D0,0xF380,0xF380,0xF380,0x0000,0xF480,0xF4E0,0xF4D0,0xF290,0xF290,0xF440,
-	0xF440,0xF440,0xF4E0,0xF4D0,0xF4D0,0xF480,0xF480,0xF480,0xF4E0,0xF4E0,0xF4D0,0xF290,
-	0x0000,0x0000,0x0000,0x0000,0xF380,0xF380,0xF500,0xF380,0xF380,0xF410,0xF410,0xF410,
-	0xF290,0x0000,0x0000,0x0000,0xF4F0,0xF4F0,0xF370,0x0000,0xF350,0x0000,0x0000,0x0000,
-	0xF2F0,0xF4B0,0xF2F0,0xF4D0,0xF4D0,0x0000,0x0000,0xF480,0x0000,0x0000,0xF480,0xF480,
-	0xF350,0x0000,0xF480,0x0000,0xF4E0,0xF4E0,0xF4D0,0xF330,0x0000,0xF4E0,0xF4D0,0x0000,
-	0x0000,0xF460,0xF460,0x0000,0xF4E0,0xF4E0,0xF4D0,0x0000,0x0000,0x0000,0xF430,0xF4B0,
-	0x0000,0x0000,0xF440,0xF440,0xF440,0x0000,0xF430,0x0000,0x0000,0xF440,0xF440,0xF370,
-	0x0000,0xF440,0xF4C0,0xF4C0,0xF4B0,0xF350,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,0x0000,
-	0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,0x0000,0xF460,0xF460,0x0000,0xF480,0xF4D0,0xF290,
-	0xF290,0xF290,0xF290,0xF480,0xF480,0xF290,0xF290,0xF290,0xF380,0xF380,0x0000,0xF4E0,
-	0xF4D0,0xF290,0x0000,0x0000,0xF4E0,0xF4E0,0xF4D0,0xF370,0xF370,0xF370,0x0000,0xF4E0,
-	0xF4D0,0xF290,0x0000,0x0000,0xF460,0xF460,0x0000,0xF380,0xF4E0,0xF4D0,0xF380,0xF380,
-	0xF380,0x0000,0xF480,0xF480,0xF4E0,0xF4D0,0xF290,0xF290,0xF440,0xF440,0xF4E0,0xF4D0,
-	0xF4D0,0xF480,0xF480,0xF480,0xF290,0xF4E0,0xF4E0,0xF4D0,0xF290,0x0000,0x0000,0x0000,
-	0x0000,0xF500,0xF500,0xF380,0xF380,0xF410,0xF410,0xF410,0xF290,0x0000,0x0000,0x0000,
-	0xF370,0xF4F0,0xF370,0x0000,0xF350,0xF350,0x0000,0x0000,0x0000,0xF4B0,0xF4B0,0xF2F0,
-	0x0000,0xF4D0,0x0000,0x0000,0x0000,0xF480,0x0000,0x0000,0x0000,0xF480,0xF350,0x0000,
-	0x0000,0xF480,0x0000,0xF460,0xF4E0,0xF4D0,0xF330,0x0000,0xF4E0,0xF4E0,0xF4D0,0x0000,
-	0x0000,0xF460,0xF460,0x0000,0xF4E0,0xF4D0,0x0000,0x0000,0x0000,0xF4B0,0xF4B0,0x0000,
-	0x0000,0xF440,0xF440,0xF440,0xF440,0x0000,0xF430,0xF430,0x0000,0x0000,0xF440,0xF440,
-	0xF370,0x0000,0xF440,0xF4C0,0xF4C0,0xF4B0,0xF350,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,
-	0x0000,0x0000,0xF4C0,0xF4C0,0xF4B0,0x0000,0x0000,0xF460,0xF460,0x0000,0xF440,0xF4D0,
-	0xF290,0xF290,0xF290,0xF290,0xF440,0xF440,0xF440,0xF290,0xF290,0xF380,0xF380,0x0000,
-	0xF290
-};
-
-static const int music_e1m6_drums[2593] = {
-	0x0000,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001C,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0020,0x001C,0x0020,0x0020,
-	0x001C,0x001C,0x0020,0x0020,0x001C,0x001F,0x001D,0x001D,0x001E,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,
-	0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,
-	0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001D,0x001D,0x001E,
-	0x001C,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001D,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0021,
-	0x0021,0x0021,0x0020,0x001E,0x001E,0x0020,0x0020,0x0020,0x001E,0x001E,0x0020,0x0020,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0021,0x001E,0x001E,0x001E,0x0020,0x001E,
-	0x001E,0x001E,0x0020,0x0020,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001E,0x001D,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001F,0x001D,0x001C,0x001C,0x001D,0x001D,
-	0x001F,0x001D,0x001D,0x001D,0x001D,0x001D,0x001F,0x001F,0x001F,0x001F,0x001E,0x001D,
-	0x001D,0x001C,0x001C,0x001C,0x001D,0x001E,0x001C,0x001D,0x001E,0x001D,0x001E,0x001C,
-	0x001D,0x001E,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,
-	0x001E,0x001E,0x001C,0x001C,0x001C,0x001D,0x001E,0x001C,0x001D,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001C,0x001D,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,
-	0x001D,0x001D,0x001F,0x001F,0x001C,0x001C,0x001C,0x001D,0x001E,0x001C,0x001D,0x001E,
-	0x001D,0x001E,0x001C,0x001D,0x001E,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001F,0x001F,0x001F,0x001C,0x001C,0x001C,0x001D,0x001E,0x001C,0x001C,
-	0x001D,0x001D,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001F,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001D,0x001D,0x001D,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001D,0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0021,0x001D,
-	0x001D,0x001D,0x0021,0x0021,0x0021,0x0021,0x0020,0x001D,0x001D,0x001D,0x0020,0x0020,
-	0x0020,0x0020,0x0020,0x001F,0x0020,0x0020,0x0020,0x001D,0x0020,0x0020,0x0020,0x001D,
-	0x001D,0x0020,0x0020,0x0020,0x001D,0x001C,0x001C,0x001C,0x001D,0x001D,0x001D,0x001F,
-	0x001F,0x001F,0x001D,0x001D,0x001D,0x001C,0x001D,0x001C,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x0020,0x001C,0x0020,
-	0x0020,0x001C,0x001C,0x0020,0x0020,0x001C,0x001E,0x001D,0x001D,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001C,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,0x001C,0x001D,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001D,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001E,0x001D,0x001E,0x001D,0x001E,0x001C,0x001E,0x001E,0x001D,
-	0x001D,0x001E,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001E,0x001C,0x001E,0x001E,
-	0x001D,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001C,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,
-	0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,
-	0x001C,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001C,0x001C,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001F,0x001D,0x001C,0x001C,0x001D,
-	0x001D,0x001F,0x001D,0x001D,0x001F,0x001F,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001E,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001F,0x001D,0x001D,0x001D,0x001D,0x001C,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001C,0x001D,0x001D,0x001C,0x001F,0x001F,0x001F,0x001F,0x001D,
-	0x001D,0x001D,0x001D,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001D,0x0020,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001F,0x001F,0x001F,0x001F,0x001F,0x001C,0x001D,0x001D,0x001D,
-	0x001D,0x001C,0x001D,0x001D,0x001C,0x001F,0x001F,0x001F,0x001F,0x001D,0x001D,0x001D,
-	0x001D,0x0020,0x001D,0x001D,0x001D,0x001D,0x001D,0x0020,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
-	0x001F,0x001D,0x001D,0x001D,0x001D,0x001D,0x001D,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001D,0x001D,0x001C,0x001F,0x001F,0x001F,0x001F,0x001F,0x001D,0x001D,0x001D,0x0020,
-	0x001E,0x001E,0x001E,0x001E,0x0020,0x0020,0x0020,0x0020,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x0020,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x0020,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001F,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,
-	0x001D,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,
-	0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,
-	0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,
-	0x001E,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E,0x001D,0x001D,0x001D,0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001D,0x001D,
-	0x001E,0x001E,0x001E,0x001E,0x001C,0x001C,0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001E,0x001D,0x001D,0x001D,0x001D,0x001D,0x001C,0x001E,0x001E,
-	0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001D,0x001E,
-	0x001E,0x001E,0x001E,0x001C,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,
-	0x001E,0x001E,0x001D,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001C,
-	0x001C,0x001C,0x001C,0x001E,0x001E,0x001E,0x001E,0x001E,0x001E,0x001D,0x001E,0x001E,
-	0x001E
-};
-
-static const unsigned short music_e1m6_timing[2593] = {
-	   15,   15,  134,   89,  193,   15,   45,  104,  134,   15,   45,  104,
-	  119,   30,  134,  134,   30,  267,   30,   45,  104,  119,   15,   45,
-	  104,  119,   30,   45,  104,  119,   30,  267,   30,   45,  104,  119,
-	   15,   45,  104,  119,   30,   45,  104,  119,   30,  267,   30,   45,
-	  104,  119,   15,   45,  104,  119,   30,   45,   74,   30,   45,  550,
-	  119,  179,  119,  164,  134,  461,  119,  179,  119,  168,   11,  153,
-	  145,  298,  119,  179,  119,  164,  119,  179,  163,  148,  118,   30,
-	  149,   15,  118,   30,  153,   11,  148,    4,   11,   45,  107,  131,
-	   30,   15,   30,   89,   15,   15,    4,   41,   59,   15,   15,   15,
-	   15,   45,   15,   44,   15,   30,   15,   45,   15,   44,   15,   30,
-	    4,   11,   30,   15,   15,   44,   15,   30,   15,   45,   15,   44,
-	   15,   30,    4,   11,   45,   15,   44,   15,   30,    4,   11,   44,
-	   15,   30,   15,   15,   30,   15,   30,   15,   15,   30,   15,   15,
-	   30,    4,   11,   45,   15,   30,   15,   15,   30,   15,   30,   15,
-	   44,   15,   15,   30,    4,   11,   45,   44,   15,   15,   30,   15,
-	   30,   15,   44,   15,   15,   15,   15,   45,   15,   44,   15,   15,
-	   15,    7,    7,   60,   59,   30,    4,   11,   59,   59,   30,   45,
-	   74,   30,    4,  115,   30,   45,   89,   15,   15,  119,   30,    4,
-	   41,   74,   30,    4,  115,   30,  163,    4,  115,   30,   45,   74,
-	   30,    4,  130,   15,   45,   89,   15,   15,    4,  115,   30,   45,
-	   74,   30,    4,   41,  119,    4,  219,   74,    4,  145,   15,  119,
-	   30,    4,   11,   60,   74,   15,   74,   44,   30,    4,   11,  134,
-	    4,   70,   59,  179,   74,   74,    4,  145,   15,  119,   34,  145,
-	    4,  115,  194,  149,    4,   11,  207,   74,   15,  149,    4,  115,
-	  179,   15,   74,   44,   30,    4,   11,   60,   59,   15,   15,   74,
-	   44,   30,    4,   11,   74,   44,   30,    4,   41,   30,   59,   15,
-	   15,   74,   44,   30,    4,   11,   59,   59,  105,   74,   15,   74,
-	   15,   60,    4,   11,   74,   15,   60,    4,   11,   60,   74,   15,
-	    4,  219,   59,   15,   15,  119,   30,    4,   41,   74,   30,   45,
-	   74,   30,   15,  119,   30,    4,   41,   74,   30,    4,   11,   30,
-	   89,   15,   15,   74,   74,   74,   44,   30,    4,   11,   30,   44,
-	   44,   30,    4,   11,   30,   30,   44,   30,   15,   30,   44,   44,
-	   30,    4,   41,   30,   44,   30,   45,   89,   15,   15,   45,   74,
-	   30,    4,  144,  133,   15,    4,   41,   44,   44,   30,    4,   41,
-	   74,   30,   45,   74,   30,   15,  119,   30,    4,   11,   30,   74,
-	   30,    4,   41,   44,   44,   15,   15,  149,    7,   67,   44,   30,
-	   45,   89,   15,   15,  119,   30,    4,   41,   74,   30,    4,   11,
-	  119,   15,   15,   74,   44,   34,  115,   30,    4,   11,  208,   74,
-	   15,  149,    4,  309,  149,    4,   11,  134,    4,   11,   74,   74,
-	   15,   59,   74,    4,   41,   30,   44,   30,   15,  149,    4,   11,
-	   60,   74,   15,   74,   74,    4,   11,   60,   74,   15,   74,   74,
-	    4,   11,   60,   74,   15,   74,   70,   48,   30,   74,    4,  160,
-	  153,  145,    4,  145,   15,  149,    4,   11,   60,   74,   15,   74,
-	   74,    4,   41,   30,   44,   30,   15,  104,   30,   15,   74,   74,
-	    4,   11,   59,   74,   15,   74,   74,    4,   11,   59,   74,    4,
-	   41,   30,   44,   30,   15,  145,   33,   44,   15,   15,   15,   30,
-	   15,   30,   59,   30,   30,    4,   11,   30,   30,   30,   30,   15,
-	   89,   11,   33,   30,    4,   11,   30,   30,   30,   30,   15,   15,
-	   45,   30,   30,   15,   30,    4,   11,   30,   44,   15,   30,   30,
-	   15,   59,   74,    7,   22,   44,   59,   15,  134,   30,    4,   41,
-	   30,   44,   30,   45,   89,   15,   15,   45,   74,   30,    4,   41,
-	   74,   30,    4,   41,   89,   15,   15,  148,   30,   44,   44,   30,
-	    4,   41,   44,   30,   15,   30,    4,   41,   30,   44,   15,   30,
-	   45,   74,   30,    4,   41,   89,   15,  134,   30,    4,   41,   30,
-	   44,   30,   15,  148,   74,   44,   30,    4,   41,   74,   30,    4,
-	   41,   89,   15,   45,   89,   30,    4,   11,  104,   30,    4,   70,
-	   59,   30,   74,   74,    4,   11,   59,  133,   30,   74,    4,  145,
-	    4,  309,    4,  145,   15,  134,   15,   75,   74,    4,   11,   59,
-	   89,    4,   41,   30,   74,  149,    4,  309,  149,    4,   11,   60,
-	   74,   15,   45,   30,   15,   45,   15,    4,   11,   74,   45,   30,
-	   19,   41,   59,   15,   30,    4,   41,   15,   74,   15,   15,  119,
-	   30,    4,   41,   74,   30,    4,   41,   89,   15,   45,   89,   15,
-	   15,    4,   41,   74,   30,    4,  141,    4,  133,   19,  309,    4,
-	   26,  237,  179,   15,  149,    4,   11,   60,   74,    4,   11,   74,
-	   74,   44,   30,  223,    8,  141,  301,   15,  134,  168,  141,  297,
-	    8,  141,  267,   30,    8,  126,   15,    4,   85,   74,    8,    7,
-	   59,   74,   59,   15,  226,   15,  144,  286,   15,  145,  157,   37,
-	   44,   59,   15,   30,   59,   15,   44,    4,   56,   44,   49,   11,
-	    4,  144,  148,    4,  115,   30,  119,   30,    8,   67,   74,    4,
-	   11,    4,   70,   74,   44,   30,  223,    8,  141,  301,   15,  134,
-	  168,  141,  297,    8,  141,  267,   30,    8,  126,   15,    4,   85,
-	   74,    8,    7,   59,   74,   59,   15,  226,   15,  144,  267,   19,
-	   11,    4,  115,   30,    8,   67,   74,    4,   11,   74,  119,   30,
-	  193,   30,  562,   30,    4,   11,  152,   70,   44,   30,   45,   74,
-	   30,   15,  119,   30,    4,   11,   15,   15,   89,   15,   15,   15,
-	   15,   30,   44,   30,   30,    4,   11,   15,   15,   30,   15,   15,
-	   30,   30,   15,   15,   15,   30,   44,   30,   30,    4,   11,   15,
-	   44,   15,   30,   44,   15,   59,   15,   30,   15,   30,    4,   11,
-	   15,   15,   30,   44,   30,   15,   15,   15,   45,   15,   30,   30,
-	   15,   11,    4,   74,   44,   30,    4,   11,  119,   15,   45,   44,
-	   44,   30,    4,   11,   30,  104,   15,   15,   59,   81,   67,   44,
-	   30,    4,  145,    4,   11,  119,  104,   44,   30,    4,   11,   15,
-	  104,   30,   15,   15,   45,   15,   15,   30,   30,   15,   15,   15,
-	   30,   44,   60,    4,   11,   59,   30,  104,   30,   74,    4,  145,
-	   15,  119,   34,   71,   74,    4,   11,   15,  104,   30,    4,   11,
-	   15,   30,   59,   45,    4,   11,   15,   30,   30,   44,   30,   15,
-	   15,   45,   59,   41,   78,   44,   30,   45,   74,   30,    4,  130,
-	   15,   15,   15,   15,   89,   30,   15,   15,   15,   30,   44,   30,
-	   15,   15,    4,   11,   15,   15,   15,   15,   30,   30,   30,    4,
-	   11,   15,   44,   44,   15,   30,   15,   15,   15,   30,   15,   30,
-	   48,   11,   15,   44,   15,   30,   30,   30,    4,   11,   15,   15,
-	   30,   44,   15,   30,   15,   15,   45,   15,   30,   15,   30,    4,
-	   41,   44,   44,   30,    4,   11,  104,   30,   45,   30,   59,   15,
-	   15,   15,  134,    4,   11,   59,  148,   59,   30,  149,    4,   11,
-	  104,  105,   59,   30,    4,   11,   15,  104,   30,   15,   15,   30,
-	   15,   30,   30,   30,    4,   11,   15,   45,   44,   45,   15,   15,
-	   45,   15,   30,   48,   11,   44,   30,   74,    4,  145,   15,  119,
-	   34,   71,   74,   15,   15,   15,   89,   30,    4,   11,   15,   30,
-	   59,   45,    4,   11,   15,   30,   30,   44,   15,   15,   15,    4,
-	   11,   45,   59,  119,   44,   30,   45,   74,   30,    4,  130,   15,
-	   15,  119,   30,    4,  115,   30,   45,   74,   30,   15,  119,   30,
-	    4,   41,   15,   15,   59,   30,   11,   19,   15,   59,   15,   15,
-	   15,   15,   45,   15,   15,   30,   30,   15,   15,    4,   41,   15,
-	   59,   30,   15,   15,   30,   15,   59,   30,   15,   15,    4,   41,
-	   15,   44,   30,   15,   15,   45,   15,   59,   15,   15,   15,   15,
-	   30,   15,   59,   30,   15,   15,    4,   41,   15,   44,   44,   15,
-	   44,   15,   44,   30,   15,   15,    4,   41,   15,   59,   15,   15,
-	   15,    4,   11,   30,   15,   59,   30,   15,   15,   30,   15,   59,
-	   30,   15,   15,    4,   41,   15,   44,   30,   15,   15,    4,   41,
-	   15,   30,   30,   30,   15,   15,    4,   41,   15,   15,   30,   30,
-	   15,   15,    4,   85,   30,   30,   19,   70,   59,   30,    4,   41,
-	   30,   44,   30,    4,   11,  119,   30,    4,  115,   30,    4,  115,
-	   30,    4,   41,   74,   45,    4,  145,    4,  278,   15,   45,  104,
-	  134,   15,   45,  104,  119,   30,  134,  134,   30,  267,   30,   45,
-	  104,  119,   30,   30,  104,  119,   30,   45,  104,  119,   30,  267,
-	   30,   45,  104,  119,   30,  134,  119,   30,   45,  104,  119,   30,
-	  282,   15,   45,  104,  119,   30,   45,  104,  119,   15,   45,   74,
-	   30,   45,  565,  119,  164,  119,  179,  119,  476,  119,  179,  119,
-	  168,  160,  446,  119,  179,  119,  164,  119,  179,  163,  148,  118,
-	   30,  149,   15,  118,   30,  153,   11,  149,    4,   11,  149,   74,
-	   44,   30,   45,   74,   30,   15,  119,   30,    4,   41,   74,   30,
-	    4,  115,   30,   45,   89,   15,   15,  119,   30,    4,  145,    4,
-	  130,   15,   45,   89,   30,    4,  115,   30,   45,   74,   30,   15,
-	  119,   15,   15,    4,  115,   30,    4,  115,   30,  164,  119,   30,
-	    4,   41,   74,   30,    4,  115,   30,   45,   89,   15,   15,  119,
-	   30,    4,   41,   74,   30,    4,  130,   15,   15,  149,    7,  111,
-	   30,   45,   74,   30,   15,  119,   30,    4,  115,   30,    4,  115,
-	   30,   45,   74,   30,   15,  149,    4,  308,  134,   15,    4,  115,
-	  179,    4,  130,  179,    4,  115,  194,  153,  145,    4,  115,  179,
-	   15,  119,   34,  145,    4,  160,  141,  156,    4,  145,   15,  119,
-	   34,  145,    4,  115,  179,   15,  119,   34,  145,    7,  290,   15,
-	    4,  115,  179,    4,  115,  194,  149,    4,   11,  222,   44,   30,
-	  119,   30,    4,   41,   74,   30,   45,   89,   15,   15,   45,   74,
-	   30,    4,   41,   74,   30,    4,   11,   30,   89,   30,   15,   59,
-	   74,   11,   63,   59,   15,   89,   44,   30,    4,   11,   30,   30,
-	   59,   15,   89,   44,   30,    4,   41,   30,   59,   15,   45,   89,
-	   15,   15,    4,   41,   74,   30,  149,   15,    4,  115,   15,   15,
-	   74,   44,   30,    4,   41,   74,   30,   45,   89,   15,   15,   45,
-	   74,   30,    4,   11,   30,   74,   30,    4,   41,   44,   44,   30,
-	   15,  134,    4,   70,   44,   30,   45,   89,   15,   15,   45,   74,
-	   30,    4,   41,   74,   30,   15,  119,   30,    4,   70,   44,   30,
-	    4,  115,   30,    4,   11,  207,   74,   15,    4,  145,    4,  309,
-	  149,    4,   11,  134,   15,   74,   74,    4,   11,   59,   74,    4,
-	   56,   15,   74,  163,    4,  309,  149,    4,   11,  134,    4,   11,
-	   74,   74,    4,   11,   59,  118,   30,   44,   30,   15,  119,   30,
-	    4,   41,   74,   30,   45,   89,   15,   15,  119,   30,    4,   41,
-	   74,   30,    4,   41,   89,   15,    4,  156,    4,  119,   34,  294,
-	    4,   41,  223,  347,  145,    4,   11,   74,   44,   30,   44,   30,
-	   59,   15,    4,   11,   45,   30,   44,   30,   60,   30,   44,   30,
-	    4,   56,   15,   59,   15,   15,   45,   30,   44,   30,   15,   74,
-	   44,   30,   15,   30,   30,   15,   44,   30,    4,   11,  118,   15,
-	   15,   44,   30,   44,   30,    4,   11,   30,   44,   44,   30,   15,
-	   30,   30,   59,   15,   15,   44,   30,   44,   30,   15,   30,   30,
-	   15,   44,   30,    4,   11,   30,   30,   59,   15,   15,   45,   30,
-	   44,   30,   15,   74,   44,   30,   59,   15,   59,   15,   15,    4,
-	   41,   30,   59,   15,   15,   74,   44,   30,    4,   56,   15,   15,
-	   44,   30,   15,   30,   30,   44,   30,   15,   45,   30,   44,   30,
-	   15,   30,   30,   15,   44,   30,    4,   11,   59,   15,   44,   30,
-	   44,   30,   44,   30,   15,   74,   44,   30,   15,   59,   59,   15,
-	    4,   11,   44,   30,   44,   30,   15,   30,   44,   44,   30,    4,
-	   11,   30,   30,   15,   44,   30,   15,   30,   30,   44,   15,   15,
-	   15,   74,   44,   30,   59,   15,   15,   44,   30,    4,   11,   30,
-	   30,   59,   15,   89,   44,   30,    4,   11,   44,   30,   30,   15,
-	   30,   15,   30,   30,   59,   15,   15,   45,   74,   30,   45,   89,
-	   15,   15,    4,   70,   44,   30,   59,   15,   59,   30,    4,   71,
-	   59,   15,   15,   74,   44,   30,    4,   56,   15,   59,  105,   44,
-	   30,    4,   85,   15,   60,   15,  134,   15,    4,   41,   30,   15,
-	   44,   15,   15,   45,   30,   44,   30,    4,   11,   30,   44,   44,
-	   30,   15,   30,   30,   44,   30,   15,   45,   30,   44,   30,   15,
-	   30,   30,   59,   15,    4,   11,   45,   30,   59,   15,   15,   30,
-	   44,   44,   30,    4,   11,   74,   63,   11,   44,   30,   44,   30,
-	    4,   70,   44,   30,    4,   56,   15,   59,   30,    4,   70,   44,
-	   30,    4,   41,   30,   59,   15,    4,   11,   74,   44,   30,   45,
-	   30,   59,   15,    4,   11,   15,   59,   44,   30,    4,   56,   15,
-	   15,   44,   30,    4,  115,   30,    4,   11,  104,   30,    4,   70,
-	   59,   15,   15,   15,   15,   15,   89,   15,   15,    4,   11,   15,
-	   15,   30,   30,   30,   30,    4,   11,   15,   15,   30,   44,   15,
-	   15,   30,    4,   11,   59,   44,   15,   30,    4,   56,   30,   44,
-	   30,    4,  115,   30,    4,   11,  119,   15,    4,   70,   59,   15,
-	   15,    4,   11,   15,   15,   89,   30,    4,   11,   15,   15,   15,
-	   59,   15,   30,   15,   15,   15,   15,   15,   59,   15,   30,    4,
-	   11,   15,   30,   59,   15,   30,   15,   44,   30,   44,   30,    4,
-	  115,   30,    4,   11,   15,  104,   15,    4,   85,   44,   30,    4,
-	   41,   89,   15,   15,  104,   15,   30,    4,   11,   15,   15,   89,
-	   15,   15,   15,   15,   15,   15,   15,   44,   15,   15,   30,    4,
-	   11,   15,   15,   15,   74,   15,   15,   15,    4,   11,   15,   15,
-	   15,   59,   15,   30,    4,   11,   15,   15,   15,   59,   15,   30,
-	    4,   11,   15,   15,   15,   74,   15,   15,   15,   15,   15,   15,
-	   74,   44,    4,   11,   15,   30,   59,   15,   30,   15,   15,   30,
-	   30,   44,   19,   70,   30,   44,   30,   45,   74,   30,    4,  130,
-	   15,   15,   15,   15,   89,   30,   15,   15,   15,   30,   44,   30,
-	   15,   15,    4,   11,   15,   15,   15,   15,   30,   30,   30,    4,
-	   11,   15,   44,   44,   15,   30,   15,   15,   15,   30,   15,   30,
-	   56,    4,   15,   44,   15,   30,   30,   30,    4,   11,   15,   15,
-	   30,   30,   30,   30,    4,   11,   15,   45,   15,   30,   15,   30,
-	   45,   44,   44,   30,    4,   11,  104,   30,   45,   30,   44,   30,
-	   15,   15,  134,    4,   11,   59,  148,   59,   30,  149,    4,   11,
-	  104,  105,   59,   30,    4,   11,   15,  104,   30,   15,   15,   30,
-	   15,   30,   30,   30,    4,   11,   15,   45,   44,   45,   15,   15,
-	   45,   15,   30,   48,   56,   30,   74,    4,  145,    4,   11,  119,
-	  104,   74,    4,   11,   15,  104,   30,    4,   11,   15,   30,   59,
-	   45,    4,   11,   15,   30,   15,   44,   15,   30,   15,   15,   30,
-	   74,   33,   70,   59,   15,   15,  119,   30,    4,  115,   30,   15,
-	   15,   15,   89,   30,    4,   11,   15,   44,   44,   15,   30,   15,
-	   15,   15,   30,   15,   30,   30,   15,   15,   15,   15,   44,   30,
-	   30,   30,    4,   11,   15,   15,   30,   15,   30,   44,   15,   44,
-	   15,   30,   30,   15,   15,    4,   11,   15,   15,   15,   44,   30,
-	   30,    4,   11,   59,   15,   15,   30,   30,   45,   30,   44,   30,
-	   15,   15,  104,   30,    4,   41,   30,   44,   30,    4,   11,   30,
-	  119,   15,   59,   70,   78,   44,   30,    4,  145,   15,  119,   34,
-	   71,   44,   30,   15,   15,   15,   89,   30,    4,   11,   15,   45,
-	   15,   30,   30,   30,   15,   15,   45,   30,   60,    4,   11,   60,
-	   15,   30,   44,    4,   56,   15,   15,   74,    4,  145,    4,   11,
-	  119,  104,   74,    4,   11,   15,  104,   30,    4,   11,   15,   30,
-	   59,   45,    4,   11,   15,   30,   30,   30,   15,   30,   15,   15,
-	   30,   74,   26,   78,   15,   44,   30,  119,   30,    4,  115,   30,
-	   45
+static const unsigned char music_e1m6_chords[2948] = {
+	0x00,0x0F,0x8F,0x4D,0x0F,0x00,0x80,0x86,0x29,0x81,0x1A,0x00,0x0F,0x29,0x2D,0x00,
+	0x68,0x38,0x80,0x86,0xA0,0x0B,0x00,0x03,0x37,0x77,0x00,0x1E,0x29,0x80,0x86,0x38,
+	0x80,0x86,0x00,0x1E,0x29,0x81,0x0B,0x00,0x1E,0x29,0x2D,0x00,0x68,0x38,0x77,0xA0,
+	0x0B,0x00,0x03,0x37,0x77,0xA0,0x27,0x00,0x04,0xA0,0x22,0x00,0x06,0xA0,0x0B,0x00,
+	0x03,0x37,0x77,0xA0,0x27,0x00,0x04,0xA0,0x22,0x00,0x06,0xA0,0x0B,0x00,0x03,0x37,
+	0x77,0x00,0x1E,0x35,0x2D,0x00,0x68,0x2F,0x2D,0x00,0x82,0x26,0x35,0x77,0x00,0x80,
+	0xB3,0x33,0x77,0x00,0x80,0xA4,0x35,0x80,0x86,0x00,0x81,0xCD,0xA0,0x5C,0x00,0x03,
+	0x00,0x83,0x07,0x37,0x77,0x00,0x80,0xB3,0x35,0x77,0x00,0x80,0xA4,0x37,0x77,0x00,
+	0x81,0xEA,0x37,0x76,0x00,0x80,0xB3,0x35,0x80,0x85,0x00,0x81,0x65,0x29,0x2D,0x00,
+	0x81,0x1B,0x29,0x1E,0x00,0x68,0x38,0x3C,0x00,0x3B,0x8E,0x28,0x0F,0x00,0x1E,0x8F,
+	0x29,0x3C,0x2A,0x0F,0x00,0x2C,0x2B,0x0F,0x00,0x1E,0x2C,0x0F,0x37,0x2D,0x2D,0x0F,
+	0x8E,0x29,0x2C,0x8F,0x2E,0x0F,0x2A,0x1E,0x2F,0x0F,0x29,0x1E,0x00,0x0F,0x30,0x0F,
+	0x2C,0x2C,0x2D,0x2D,0x32,0x0F,0x38,0x2D,0x33,0x0F,0x2F,0x2C,0x34,0x0F,0x30,0x1E,
+	0x35,0x0F,0x29,0x2D,0x36,0x0F,0x32,0x2C,0x37,0x0F,0x33,0x1E,0x38,0x0F,0x34,0x2C,
+	0x39,0x0F,0x35,0x1E,0x3A,0x0F,0x36,0x2D,0x3B,0x0F,0x29,0x1E,0x00,0x0F,0x3C,0x0F,
+	0x38,0x1E,0x3D,0x0F,0x39,0x2D,0x3E,0x0F,0x38,0x2D,0x3F,0x0F,0x3B,0x1E,0x40,0x0F,
+	0x3C,0x2D,0x41,0x0F,0x29,0x1E,0x42,0x0F,0x3E,0x2C,0x43,0x0F,0x3F,0x2D,0x44,0x0F,
+	0x37,0x2D,0x41,0x2C,0x46,0x0F,0x42,0x2D,0x47,0x0F,0x29,0x1E,0x48,0x0F,0x44,0x2C,
+	0x49,0x0F,0x45,0x1E,0x38,0x3C,0x4B,0x0F,0x47,0x2C,0x4C,0x0F,0x48,0x1E,0x29,0x4A,
+	0x4A,0x3B,0x4B,0x2D,0x4C,0x3B,0x4D,0x59,0xA0,0x29,0x00,0x03,0xA0,0x27,0x00,0x03,
+	0x37,0x80,0x86,0xA0,0x27,0x00,0x04,0x00,0x1E,0x29,0x81,0x1A,0xA0,0x27,0x00,0x03,
+	0x38,0x80,0x86,0xA0,0x0B,0x00,0x03,0x37,0x80,0x86,0xA0,0x51,0x00,0x04,0x00,0x81,
+	0x56,0x41,0x4A,0x00,0x80,0x95,0x44,0x0F,0x35,0x77,0x00,0x1E,0x41,0x0F,0x00,0x3C,
+	0x44,0x4A,0x33,0x59,0x41,0x2C,0x00,0x1E,0x44,0x0F,0x00,0x80,0x86,0x35,0x4A,0x44,
+	0x3B,0x00,0x80,0xFD,0xA0,0x61,0x01,0x02,0x35,0x80,0x86,0xA0,0x5E,0x00,0x02,0x00,
+	0x81,0x57,0x3F,0x0F,0x00,0x80,0xCF,0x3F,0x4A,0xA0,0x7A,0x00,0x02,0x00,0x80,0xB3,
+	0x41,0x0F,0x35,0x4A,0x43,0x2C,0x00,0x1E,0x44,0x0F,0x00,0x3C,0x41,0x3B,0x00,0x0F,
+	0x44,0x0F,0x37,0x4A,0x44,0x2C,0x00,0x1E,0x44,0x0F,0x00,0x4A,0x44,0x2C,0x00,0x1E,
+	0x46,0x2D,0x00,0x1E,0x44,0x3B,0x00,0x0F,0x46,0x0F,0x00,0x4A,0x48,0x2C,0x00,0x1E,
+	0x49,0x0F,0x37,0x3B,0x46,0x3B,0x00,0x69,0x49,0x4A,0x35,0x59,0x48,0x0F,0x4B,0x3C,
+	0x49,0x0F,0x00,0x59,0x4A,0x3C,0x4B,0x0F,0x00,0x80,0x86,0x35,0x80,0xEE,0x48,0x4A,
+	0x29,0x80,0xD1,0x00,0x68,0x29,0x2D,0x00,0x68,0xA0,0xF0,0x01,0x02,0x46,0x0F,0x29,
+	0x1E,0x00,0x68,0x35,0x59,0x46,0x4A,0x48,0x4A,0x44,0x4A,0x46,0x0F,0x29,0x1E,0x00,
+	0x2C,0x48,0x4A,0x44,0x0F,0x29,0x1E,0x00,0x1E,0x46,0x4A,0x41,0x0F,0x29,0x1E,0x00,
+	0x2C,0x44,0x4A,0x29,0x2D,0x00,0x1E,0x41,0x4A,0x29,0x2D,0x00,0x68,0x29,0x3C,0x00,
+	0x68,0x35,0x80,0x94,0x48,0x80,0x94,0x29,0x2D,0x00,0x2C,0x48,0x4A,0x29,0x2D,0xA0,
+	0xF3,0x01,0x03,0x29,0x80,0xA4,0x4B,0x0F,0x29,0x1E,0x00,0x68,0x29,0x2D,0x00,0x2C,
+	0x4B,0x3B,0xA0,0xEB,0x01,0x02,0x29,0x2D,0x00,0x68,0xA0,0xF0,0x01,0x02,0x48,0x0F,
+	0x35,0x80,0xDF,0x48,0x80,0xC1,0x00,0x1E,0x44,0x0F,0x31,0x80,0xD0,0x44,0x4A,0x00,
+	0x82,0x72,0x43,0x0F,0x00,0x80,0x86,0x41,0x0F,0x00,0x4A,0x43,0x4A,0x44,0x0F,0x31,
+	0x3B,0x41,0x77,0x00,0x1E,0x44,0x2C,0x00,0x1E,0x43,0x0F,0x00,0x80,0x95,0x41,0x0F,
+	0x00,0x3C,0x43,0x4A,0x44,0x0F,0x00,0x4A,0x41,0x4A,0x43,0x0F,0x00,0x3C,0x44,0x4A,
+	0xA0,0x77,0x02,0x04,0x00,0x3C,0x41,0x4A,0x33,0x59,0x44,0x76,0x00,0x1E,0x46,0x4A,
+	0x00,0x82,0x63,0x44,0x0F,0x00,0x80,0x95,0xA0,0x9A,0x02,0x03,0x46,0x0F,0x37,0x4A,
+	0x43,0x77,0x00,0x1E,0x46,0x2C,0x00,0x1E,0x44,0x0F,0x35,0x68,0x00,0x1E,0x43,0x0F,
+	0x33,0x4A,0x44,0x4A,0x41,0x0F,0x31,0x3B,0x43,0x4A,0x3F,0x0F,0x33,0x4A,0x41,0x4A,
+	0x46,0x0F,0x37,0x3B,0x3F,0x77,0xA0,0xC2,0x02,0x03,0x4B,0x0F,0x35,0x80,0xB2,0x4C,
+	0x2C,0x4B,0x0F,0x4D,0x0F,0x00,0x2D,0x4D,0x0F,0x29,0x1E,0x00,0x3B,0x4C,0x3C,0x4D,
+	0x0F,0x29,0x1E,0x00,0x1E,0x4D,0x1E,0x00,0x2D,0x29,0x59,0x4D,0x0B,0x00,0x3F,0xA0,
+	0xFF,0x02,0x05,0x29,0x3C,0xA0,0x03,0x03,0x03,0x4D,0x0F,0x29,0x1E,0x00,0x2C,0x4D,
+	0x0F,0x00,0x3C,0x4B,0x0F,0x35,0x3B,0x4D,0x67,0x00,0x2C,0x4B,0x4A,0x29,0x80,0xD1,
+	0x00,0x1E,0x4D,0x4A,0xA0,0x29,0x02,0x04,0x29,0x2D,0xA0,0xF3,0x01,0x03,0x35,0x80,
+	0xC1,0x4C,0x2C,0x4B,0x2C,0x4A,0x1E,0x29,0x2D,0x00,0x2C,0x48,0x1E,0x4C,0x2D,0x29,
+	0x2D,0x00,0x1E,0x4A,0x2C,0x49,0x2D,0x29,0x2D,0xA0,0xF3,0x01,0x03,0xA0,0x2D,0x03,
+	0x02,0x4B,0x4A,0x48,0x0F,0x35,0x80,0xDE,0x48,0x4A,0x29,0x2D,0xA0,0xF3,0x01,0x03,
+	0x29,0x2D,0x00,0x77,0x48,0x0F,0x35,0x80,0x86,0x46,0x4A,0x48,0x59,0x44,0x4A,0x46,
+	0x4A,0x41,0x0F,0x31,0x3B,0x44,0x80,0x85,0x00,0x1E,0x41,0x4A,0x00,0x82,0x63,0x3D,
+	0x0F,0x00,0x80,0x86,0x3F,0x0F,0x00,0x4B,0x3D,0x4A,0x43,0x0F,0x33,0x3B,0x3F,0x80,
+	0x86,0x00,0x1E,0x43,0x4A,0x00,0x82,0x63,0x41,0x0F,0x00,0x3C,0x3F,0x4A,0x00,0x3C,
+	0x42,0x1E,0x41,0x0F,0x43,0x2D,0x44,0x0F,0x35,0x59,0x42,0x2D,0x41,0x1E,0x43,0x3C,
+	0x44,0x3B,0x43,0x2D,0x29,0x2D,0x00,0x0F,0x41,0x59,0xA0,0xF0,0x01,0x04,0xA0,0x29,
+	0x02,0x04,0x31,0x81,0x1A,0x00,0x81,0x48,0x33,0x81,0x0B,0x00,0x80,0xB3,0x3C,0x0F,
+	0x00,0x80,0x95,0x3F,0x0F,0x00,0x3C,0x3C,0x4A,0x43,0x0F,0x37,0x4A,0x3F,0x76,0x00,
+	0x1E,0x43,0x87,0x34,0x00,0x1E,0x3D,0x80,0x86,0x00,0x0F,0x41,0x59,0x3D,0x4A,0x44,
+	0x0F,0x38,0x3B,0x41,0x80,0x85,0x00,0x0F,0x44,0x84,0x01,0x45,0x2C,0x46,0x3B,0x47,
+	0x2D,0x48,0x3B,0x49,0x0F,0x45,0x2C,0x46,0x3C,0x47,0x2C,0x48,0x3C,0x49,0x81,0x9F,
+	0x00,0x1E,0x3F,0x77,0x00,0x1E,0x43,0x4B,0x3F,0x4A,0x48,0x0F,0x37,0x4A,0x43,0x76,
+	0x00,0x1E,0x48,0x87,0x34,0x00,0x1E,0x41,0x80,0x86,0x00,0x0F,0x44,0x59,0x41,0x4A,
+	0x49,0x0F,0x38,0x3B,0x44,0x80,0x85,0x00,0x0F,0x49,0x82,0x8C,0x00,0x1E,0x43,0x77,
+	0x00,0x1E,0x46,0x4B,0x43,0x4A,0x4B,0x0F,0x3A,0x4A,0x46,0x77,0x00,0x1E,0x4B,0x80,
+	0xC1,0x00,0x1E,0x4F,0x82,0x32,0x00,0x1E,0x48,0x0F,0x29,0x80,0xDE,0x48,0x4A,0xA0,
+	0x0D,0x00,0x03,0x00,0x1E,0x4E,0x0F,0x4D,0x0F,0x29,0x0F,0x00,0x68,0x37,0x0F,0x4E,
+	0x0F,0x4D,0x0F,0x37,0x68,0xA0,0x73,0x04,0x04,0x00,0x2D,0x46,0x2D,0x00,0x1E,0x44,
+	0x0F,0x4E,0x0F,0x4D,0x0F,0x38,0x68,0xA0,0x73,0x04,0x03,0x29,0x3B,0x44,0x4A,0x4E,
+	0x0F,0x4D,0x4A,0x48,0x4B,0x4E,0x0F,0x29,0x0F,0x4D,0x0F,0x29,0x77,0x38,0x0F,0x50,
+	0x0F,0x38,0x3C,0x41,0x4B,0x29,0x80,0xA3,0x4F,0x0F,0x37,0x77,0x00,0x0F,0x35,0x2D,
+	0x00,0x76,0x4B,0x0F,0x2F,0x1E,0x00,0x68,0x48,0x0F,0x4D,0x0F,0x00,0x80,0xCF,0x48,
+	0x2C,0x00,0x80,0xB3,0x48,0x0F,0x35,0x77,0x00,0x68,0x48,0x2C,0xA0,0x73,0x04,0x03,
+	0x33,0x68,0xA0,0x73,0x04,0x03,0x00,0x3C,0xA0,0x8B,0x04,0x05,0x00,0x80,0x86,0x4B,
+	0x0F,0x00,0x3B,0x44,0x80,0x86,0x00,0x1E,0x43,0x4A,0xA0,0x63,0x01,0x02,0x37,0x77,
+	0x00,0x69,0x44,0x4A,0x4C,0x0F,0x4B,0x0F,0x35,0x68,0x00,0x1E,0x4C,0x0F,0xA0,0xE6,
+	0x01,0x02,0x4C,0x0F,0x4B,0x0F,0x00,0x3C,0x46,0x2C,0x00,0x1E,0x29,0x0F,0x4D,0x0F,
+	0x29,0x80,0xDF,0x48,0x4A,0xA0,0x0D,0x00,0x03,0x00,0x0F,0x29,0x0F,0x4E,0x0F,0x4D,
+	0x0F,0x29,0x77,0x46,0x0F,0xA0,0x7F,0x04,0x03,0xA0,0x29,0x05,0x04,0x29,0x0F,0x00,
+	0x1E,0x46,0x3C,0xA0,0x73,0x04,0x03,0x38,0x67,0x00,0x1E,0x48,0x0F,0x4E,0x0F,0x4D,
+	0x0F,0x29,0x2D,0x44,0x59,0x4E,0x0F,0x4D,0x3B,0x48,0x5A,0xA0,0x75,0x04,0x03,0x00,
+	0x77,0xA0,0xAD,0x04,0x04,0x29,0x2D,0x00,0x76,0x4F,0x0F,0x37,0x68,0xA0,0x51,0x00,
+	0x03,0x2F,0x0F,0x4B,0x0F,0x2F,0x80,0x86,0xA0,0xCA,0x04,0x02,0x48,0x3B,0xA0,0xD1,
+	0x04,0x02,0x35,0x68,0x00,0x69,0x48,0x3B,0xA0,0x73,0x04,0x03,0x33,0x68,0xA0,0x73,
+	0x04,0x03,0x00,0x2D,0x46,0x3C,0xA0,0x73,0x04,0x03,0x00,0x80,0x86,0x43,0x0F,0x4B,
+	0x0F,0x00,0x3C,0xA0,0x85,0x03,0x02,0x43,0x4A,0xA0,0x63,0x01,0x02,0xA0,0xFE,0x04,
+	0x03,0x35,0x0F,0x4C,0x0F,0x4B,0x0F,0x35,0x59,0x00,0x1E,0x4C,0x0F,0xA0,0xE6,0x01,
+	0x02,0xA0,0x12,0x05,0x03,0x46,0x3B,0x00,0x0F,0xA0,0x1C,0x05,0x03,0x44,0x4A,0xA0,
+	0x0D,0x00,0x03,0x00,0x0F,0x29,0x80,0xA4,0x37,0x77,0xA0,0x27,0x00,0x03,0xA0,0x1F,
+	0x00,0x02,0x3A,0x2D,0x4E,0x0F,0x4D,0x0F,0x42,0x3B,0x41,0x3C,0x4E,0x0F,0x4D,0x4A,
+	0x43,0x2D,0x29,0x2D,0x4E,0x0F,0x4D,0x0F,0x41,0x5A,0x38,0x2D,0x4E,0x0F,0x4D,0x68,
+	0x29,0x2D,0x4E,0x0F,0x4D,0x77,0x37,0x2D,0xA0,0xFC,0x05,0x04,0x4D,0x68,0xA0,0xFA,
+	0x05,0x03,0x29,0x3C,0x4E,0x0F,0x4D,0x80,0x93,0xA0,0xFC,0x05,0x04,0x4D,0x68,0xA0,
+	0xFA,0x05,0x07,0xA0,0xFC,0x05,0x04,0x4D,0x78,0x38,0x2D,0x4E,0x0F,0x4D,0x69,0x29,
+	0x81,0x29,0xA0,0x27,0x00,0x03,0xA0,0x1F,0x00,0x02,0x29,0x80,0x95,0xA0,0x4F,0x00,
+	0x03,0x00,0x81,0x0C,0xA0,0x08,0x00,0x05,0xA0,0x0B,0x00,0x03,0xA0,0x18,0x00,0x0A,
+	0x00,0x1E,0x29,0x1E,0x00,0x68,0x37,0x77,0xA0,0x27,0x00,0x04,0xA0,0x22,0x00,0x06,
+	0xA0,0x1A,0x00,0x02,0x37,0x77,0xA0,0x27,0x00,0x04,0xA0,0x47,0x01,0x02,0xA0,0x0B,
+	0x00,0x03,0x38,0x77,0xA0,0x27,0x00,0x03,0xA0,0xBA,0x04,0x03,0x00,0x68,0x2F,0x2D,
+	0x00,0x82,0x35,0xA0,0x78,0x00,0x02,0x33,0x77,0xA0,0x75,0x00,0x02,0x00,0x81,0xDC,
+	0xA0,0x5C,0x00,0x03,0x00,0x83,0x06,0xA0,0x73,0x00,0x09,0x00,0x81,0x57,0x59,0x0F,
+	0x29,0x80,0xDF,0x59,0x4A,0xA0,0x0D,0x00,0x03,0xA0,0x27,0x00,0x03,0x37,0x77,0xA0,
+	0x27,0x00,0x03,0xA0,0x1F,0x00,0x02,0x29,0x81,0x1B,0x00,0x0F,0x29,0x2D,0x00,0x77,
+	0x38,0x77,0xA0,0x27,0x00,0x03,0x37,0x80,0x86,0xA0,0xD3,0x05,0x02,0x38,0x77,0x00,
+	0x1E,0x29,0x81,0x1B,0xA0,0x27,0x00,0x04,0xA0,0x27,0x00,0x03,0x37,0x80,0x86,0xA0,
+	0x27,0x00,0x03,0x38,0x80,0x86,0x00,0x0F,0x29,0x81,0x1A,0xA0,0x27,0x00,0x03,0xA0,
+	0x1F,0x00,0x02,0x29,0x80,0x95,0xA0,0x4F,0x00,0x04,0x2F,0x80,0xA4,0x00,0x81,0xBE,
+	0x35,0x80,0x86,0x00,0x80,0xB3,0x33,0x80,0x86,0xA0,0x75,0x00,0x02,0x00,0x81,0xEC,
+	0xA0,0x5C,0x00,0x02,0x33,0x80,0x86,0x00,0x83,0x15,0x37,0x80,0x86,0xA0,0x75,0x00,
+	0x02,0x00,0x80,0xB3,0x37,0x80,0x86,0x00,0x81,0xDC,0x37,0x80,0x86,0xA0,0x75,0x00,
+	0x02,0x00,0x81,0x57,0xA0,0x63,0x03,0x03,0x29,0x80,0xC2,0xA0,0xF3,0x01,0x03,0x29,
+	0x3C,0xA0,0xF3,0x01,0x03,0x4D,0x0F,0x29,0x1E,0x00,0x77,0x4B,0x0F,0x35,0x3B,0x4D,
+	0x4A,0x48,0x4A,0x4B,0x4A,0x29,0x59,0xA0,0x11,0x02,0x05,0x29,0x59,0xA0,0x21,0x02,
+	0x08,0x35,0x80,0x95,0x48,0x80,0x95,0x29,0x59,0x48,0x4A,0x29,0x2D,0xA0,0xF3,0x01,
+	0x03,0x29,0x3C,0x00,0x68,0xA0,0x46,0x02,0x05,0x4B,0x4A,0x48,0x0F,0x35,0x80,0xD0,
+	0x48,0x4A,0xA0,0x29,0x02,0x04,0x29,0x2D,0x00,0x68,0xA0,0x5E,0x02,0x05,0x31,0x80,
+	0xCF,0xA0,0x6D,0x02,0x07,0x46,0x0F,0x33,0x3B,0xA0,0x37,0x04,0x02,0x46,0x4A,0x00,
+	0x82,0x71,0xA0,0x78,0x01,0x02,0x43,0x0F,0x00,0x4A,0x44,0x4A,0x41,0x0F,0x35,0x3B,
+	0x43,0x76,0x00,0x1E,0x41,0x4A,0xA0,0xF0,0x01,0x04,0xA0,0xF0,0x01,0x04,0x31,0x81,
+	0x1B,0x00,0x81,0x48,0x33,0x81,0x0C,0x00,0x81,0xEC,0x41,0x0F,0x3A,0x4A,0x3D,0x2C,
+	0x00,0x1E,0x3A,0x2C,0x00,0x1E,0x41,0x3B,0x00,0x0F,0x2E,0x3C,0xA0,0xD0,0x07,0x03,
+	0x3A,0x3C,0x00,0x1E,0x41,0x2C,0x00,0x1E,0x3D,0x3C,0x00,0x0F,0x3A,0x3B,0x00,0x0F,
+	0x2E,0x3C,0xA0,0xE2,0x07,0x03,0x41,0x0F,0x2E,0x4A,0x3A,0x2C,0x00,0x1E,0x3C,0x0F,
+	0x2E,0x1E,0x00,0x1E,0x3C,0x0F,0x41,0x2C,0x00,0x1E,0x3D,0x0F,0x3A,0x76,0x00,0x1E,
+	0x3C,0x2C,0xA0,0xE2,0x07,0x03,0x41,0x0F,0x2E,0x1E,0x00,0x2C,0xA0,0xFA,0x07,0x03,
+	0x3A,0x1E,0xA0,0xD4,0x07,0x03,0x41,0x0F,0xA0,0xCE,0x07,0x04,0xA0,0xFE,0x07,0x07,
+	0x2E,0x1E,0x00,0x1E,0xA0,0xEC,0x07,0x03,0xA0,0xE2,0x07,0x03,0x42,0x0F,0x36,0x4A,
+	0x3A,0x2C,0x00,0x1E,0x3C,0x3B,0x00,0x0F,0x42,0x3B,0x00,0x0F,0x2A,0x3C,0x00,0x1E,
+	0x3A,0x3B,0x00,0x0F,0x3A,0x0F,0x36,0x4A,0x42,0x2C,0xA0,0xE6,0x07,0x03,0x3D,0x0F,
+	0xA0,0xFA,0x07,0x03,0x2A,0x1E,0x00,0x1E,0x42,0x2C,0x00,0x1E,0x42,0x0F,0x2A,0x2D,
+	0xA0,0xD0,0x07,0x03,0x3C,0x0F,0x2A,0x1E,0x00,0x1E,0x3C,0x0F,0x42,0x2C,0x00,0x1E,
+	0x3D,0x0F,0x36,0x3B,0x3D,0x0F,0x3A,0x2C,0x00,0x1E,0x3C,0x2C,0xA0,0x83,0x02,0x03,
+	0x44,0x0F,0x2A,0x4A,0xA0,0xFA,0x07,0x03,0x36,0x3B,0x44,0x3B,0x00,0x1E,0xA0,0xCE,
+	0x07,0x04,0x3C,0x0F,0x2A,0x1E,0x00,0x2C,0xA0,0x7C,0x08,0x03,0x2A,0x1E,0x00,0x1E,
+	0xA0,0x84,0x08,0x03,0xA0,0x74,0x08,0x03,0x42,0x3B,0x00,0x0F,0x38,0x0F,0x35,0x4A,
+	0xA0,0x40,0x08,0x04,0x44,0x0F,0x38,0x2C,0x00,0x1E,0x3C,0x0F,0x29,0x1E,0xA0,0xD4,
+	0x07,0x03,0x35,0x59,0x48,0x2C,0x00,0x1E,0x41,0x0F,0x4D,0x2C,0x00,0x1E,0x48,0x1E,
+	0x42,0x2D,0xA0,0x13,0x02,0x03,0x41,0x4A,0x29,0x3C,0x00,0x4A,0x41,0x1E,0x29,0x2D,
+	0x00,0x68,0x33,0x59,0x3A,0x2C,0x00,0x1E,0x3F,0x3B,0x00,0x0F,0x36,0x3B,0x00,0x69,
+	0x3F,0x3B,0x00,0x0F,0x4E,0x0F,0x33,0x4A,0x46,0x2C,0x00,0x1E,0x4B,0x3C,0x00,0x0F,
+	0x4E,0x3B,0x00,0x69,0x49,0x2C,0x00,0x77,0x46,0x0F,0x43,0x3C,0xA0,0x78,0x01,0x02,
+	0x2C,0x3C,0x43,0x1E,0x36,0x0F,0x42,0x3B,0x2C,0x3C,0x00,0x1E,0x38,0x2C,0x00,0x1E,
+	0x3A,0x0F,0x2C,0x1E,0x00,0x2C,0xA0,0x2C,0x09,0x04,0xA0,0xD0,0x07,0x03,0x3C,0x0F,
+	0x2C,0x2D,0xA0,0xD0,0x07,0x03,0x3C,0x0F,0x2C,0x1E,0xA0,0x42,0x08,0x03,0x2C,0x3C,
+	0x00,0x1E,0x3C,0x4A,0x3F,0x0F,0x2C,0x1E,0x00,0x2C,0x3F,0x2C,0x00,0x1E,0x3D,0x0F,
+	0x31,0x4A,0x3F,0x4A,0xA0,0x86,0x08,0x03,0x00,0x1E,0x3D,0x4A,0x3A,0x2C,0x00,0x1E,
+	0x3C,0x3C,0x00,0x0F,0x3D,0x3B,0x00,0x1E,0x3F,0x4A,0x3C,0x2C,0x00,0x1E,0x3D,0x2D,
+	0xA0,0xF6,0x08,0x03,0x41,0x59,0x3D,0x2C,0x00,0x1E,0x3F,0x2D,0xA0,0xD4,0x07,0x03,
+	0x36,0x0F,0x4E,0x0F,0x36,0x3B,0x3F,0x2C,0x00,0x1E,0x41,0x3C,0x00,0x0F,0x42,0x80,
+	0xD0,0x00,0x1E,0x4D,0x0F,0x35,0x80,0xD0,0x41,0x4A,0xA0,0x2B,0x05,0x03,0x29,0x0F,
+	0x42,0x68,0xA0,0x2B,0x05,0x03,0x29,0x0F,0x00,0x3C,0x42,0x3C,0xA0,0xA5,0x04,0x03,
+	0x29,0x59,0x41,0x2D,0x52,0x0F,0x36,0x67,0x42,0x69,0x00,0x1E,0x42,0x80,0xC1,0x00,
+	0x1E,0x51,0x0F,0xA0,0xA5,0x09,0x02,0x29,0x0F,0x52,0x0F,0x51,0x0F,0x29,0x0F,0x42,
+	0x77,0xA0,0xD9,0x09,0x03,0x00,0x4A,0x42,0x2D,0xA0,0xD7,0x09,0x04,0x00,0x4A,0x41,
+	0x2D,0x42,0x0F,0x55,0x0F,0x36,0x59,0x42,0x68,0xA0,0xCA,0x09,0x03,0x41,0x0F,0x54,
+	0x0F,0xA0,0xA5,0x09,0x02,0x29,0x2D,0x42,0x68,0x29,0x77,0x42,0x2D,0x29,0x0F,0x55,
+	0x0F,0x54,0x0F,0x29,0x59,0x41,0x1E,0xA0,0x0D,0x0A,0x03,0x29,0x0F,0x00,0x3B,0x42,
+	0x3C,0x55,0x0F,0x54,0x0F,0x29,0x0F,0x00,0x59,0x41,0x1E,0xA0,0x0D,0x0A,0x03,0x29,
+	0x0F,0x00,0x77,0xA0,0x21,0x0A,0x03,0x00,0x77,0x35,0x0F,0x55,0x0F,0x54,0x0F,0x35,
+	0x68,0x00,0x0F,0xA0,0x0D,0x0A,0x03,0x29,0x80,0x85,0x55,0x0F,0x54,0x0F,0x33,0x68,
+	0x00,0x1E,0x48,0x0F,0x4D,0x0F,0x29,0x3C,0x46,0x80,0x85,0x00,0x1E,0x48,0x4A,0xA0,
+	0x0D,0x00,0x03,0xA0,0x29,0x05,0x06,0xA0,0x7F,0x04,0x03,0xA0,0x29,0x05,0x04,0xA0,
+	0x3D,0x05,0x03,0xA0,0x73,0x04,0x03,0xA0,0x47,0x05,0x06,0x44,0x5A,0xA0,0x55,0x05,
+	0x03,0xA0,0x75,0x04,0x03,0x00,0x78,0xA0,0xAD,0x04,0x04,0xA0,0x65,0x05,0x04,0xA0,
+	0x51,0x00,0x03,0xA0,0x71,0x05,0x03,0xA0,0xCA,0x04,0x02,0x48,0x3B,0xA0,0xD1,0x04,
+	0x02,0xA0,0x82,0x05,0x03,0xA0,0x73,0x04,0x03,0x33,0x68,0xA0,0x73,0x04,0x03,0x00,
+	0x2D,0x46,0x3C,0xA0,0x73,0x04,0x03,0xA0,0x9A,0x05,0x04,0xA0,0xF3,0x04,0x03,0xA0,
+	0x63,0x01,0x02,0x37,0x77,0x00,0x68,0xA0,0x02,0x05,0x06,0xA0,0xE6,0x01,0x02,0x4C,
+	0x0F,0x4B,0x0F,0x00,0x2D,0x46,0x3B,0xA0,0x50,0x0A,0x03,0x29,0x80,0xCF,0x48,0x4A,
+	0x29,0x80,0xA4,0x38,0x77,0xA0,0x73,0x04,0x04,0x00,0x77,0x4E,0x0F,0x4D,0x0F,0x37,
+	0x67,0xA0,0x73,0x04,0x04,0x00,0x2D,0x46,0x3C,0x00,0x0F,0x38,0x0F,0xA0,0x91,0x04,
+	0x03,0xA0,0x49,0x05,0x05,0x44,0x4A,0x4E,0x0F,0x4D,0x3B,0x48,0x4B,0xA0,0x2B,0x05,
+	0x03,0x29,0x0F,0x00,0x77,0x50,0x0F,0x38,0x4A,0x41,0x4B,0x29,0x2D,0x00,0x68,0x37,
+	0x0F,0x4F,0x0F,0x37,0x68,0xA0,0x51,0x00,0x03,0x4B,0x0F,0x2F,0x1E,0x00,0x77,0xA0,
+	0xCA,0x04,0x06,0x00,0x69,0x48,0x2C,0x00,0x1E,0x46,0x0F,0x4E,0x0F,0x4D,0x0F,0x33,
+	0x59,0xA0,0x73,0x04,0x03,0x00,0x3C,0x46,0x3C,0xA0,0x73,0x04,0x03,0x00,0x80,0x87,
+	0x4B,0x0F,0x00,0x4B,0x44,0x80,0x86,0x00,0x0F,0x43,0x59,0xA0,0x63,0x01,0x02,0x37,
+	0x77,0x00,0x68,0xA0,0x02,0x05,0x06,0xA0,0xE6,0x01,0x02,0xA0,0x12,0x05,0x03,0xA0,
+	0x8B,0x04,0x03,0x4D,0x0F,0x29,0x80,0xD0,0x44,0x59,0x29,0x80,0x95,0x38,0x77,0x00,
+	0x1E,0x29,0x2D,0xFF
 };
 
 #endif
@@ -2,272 +2,91 @@
 #ifndef __MUSIC_TITLE_H__
 #define __MUSIC_TITLE_H__
 
-#define MUSIC_TITLE_NOTE_COUNT  511
-#define MUSIC_TITLE_HAS_ARP     1
+#define MUSIC_TITLE_LENGTH_MS  68479
 
-static const int music_title_melody[511] = {
-	0xB300,0x0000,0xB370,0x0000,0xB370,0x0000,0xB370,0x0000,0xB3E0,0xB370,0x0000,0xB3E0,
-	0xB370,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,0x0000,0xB330,0x0000,
-	0xB330,0x0000,0xB3A0,0xB330,0x0000,0xB3A0,0xB330,0x0000,0xB2C0,0x0000,0x0000,0x0000,
-	0x0000,0xB300,0x0000,0xB370,0x0000,0xB370,0x0000,0xB370,0x0000,0xB3E0,0xB370,0x0000,
-	0xB3E0,0xB370,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,0x0000,0xB330,
-	0x0000,0xB330,0x0000,0xB3A0,0xB330,0x0000,0xB3A0,0xB330,0x0000,0xB2C0,0x0000,0x0000,
-	0x0000,0x0000,0xB300,0x0000,0xB370,0xB370,0x0000,0x0000,0xB370,0xB370,0x0000,0xB370,
-	0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB300,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,0xB330,0x0000,
-	0xB330,0xB330,0x0000,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,
-	0x0000,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB300,0x0000,0xB370,0xB370,0x0000,0x0000,0xB370,0xB370,0x0000,0xB370,0x0000,0xB3E0,
-	0xB3E0,0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB300,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,0xB330,0x0000,0xB330,0xB330,
-	0x0000,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB2C0,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,0xB300,0xB300,0x0000,
-	0xB300,0xB300,0x0000,0xB300,0x0000,0xB370,0xB370,0xB300,0x0000,0xB370,0xB370,0xB300,
-	0x0000,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,
-	0xB330,0x0000,0xB330,0xB330,0x0000,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB3A0,
-	0xB3A0,0xB330,0x0000,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0xB290,0xB300,0xB300,0x0000,0xB300,0xB300,0x0000,0xB300,0x0000,0xB370,0xB370,0xB300,
-	0x0000,0xB370,0xB370,0xB300,0x0000,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB2B0,0xB320,0x0000,0x0000,0xB320,0xB320,0x0000,0xB320,0x0000,
-	0xB380,0xB380,0xB320,0x0000,0xB380,0xB380,0xB320,0x0000,0xB2B0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB300,0x0000,0xB370,0xB370,0x0000,0x0000,0xB370,
-	0xB370,0x0000,0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,
-	0xB300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,
-	0xB330,0xB330,0x0000,0xB330,0xB330,0x0000,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,
-	0xB3A0,0xB3A0,0xB330,0x0000,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB300,0x0000,0xB370,0xB370,0x0000,0x0000,0xB370,0xB370,0x0000,
-	0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB3E0,0xB3E0,0xB370,0x0000,0xB300,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB2C0,0xB330,0xB330,
-	0x0000,0xB330,0xB330,0x0000,0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB3A0,0xB3A0,
-	0xB330,0x0000,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB290,
-	0xB300,0xB300,0x0000,0xB300,0xB300,0x0000,0xB300,0x0000,0xB370,0xB370,0xB300,0x0000,
-	0xB370,0xB370,0xB300,0x0000,0xB290,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0xB2C0,0xB330,0xB330,0x0000,0xB330,0xB330,0x0000,0xB330,0x0000,0xB3A0,0xB3A0,
-	0xB330,0x0000,0xB3A0,0xB3A0,0xB330,0x0000,0xB2C0,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0xB290,0xB300,0xB300,0x0000,0xB300,0xB300,0x0000,0xB300,0x0000,
-	0xB370,0xB370,0xB300,0x0000,0xB370,0xB370,0xB300,0x0000,0xB290,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xB2B0,0xB320,0xB320,0x0000,0xB320,0x0000,0x0000,
-	0xB320,0x0000,0xB380,0xB380,0xB320,0x0000,0xB380,0xB380,0xB320,0x0000,0xB2B0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+static const unsigned char music_title_melody[428] = {
+	0x8B,0x30,0x80,0xD6,0x00,0x04,0x37,0x50,0x00,0x80,0x8F,0x37,0x50,0x00,0x80,0x81,
+	0x37,0x62,0x00,0x6B,0x3E,0x80,0xD6,0x37,0x6B,0xA0,0x12,0x00,0x03,0x00,0x6B,0x30,
+	0x80,0xDF,0x00,0x85,0xD2,0x2C,0x80,0xD6,0x33,0x53,0x00,0x80,0x84,0x33,0x50,0x00,
+	0x80,0x86,0x33,0x62,0x00,0x74,0x3A,0x80,0xD6,0x33,0x6B,0x00,0x6B,0xA0,0x36,0x00,
+	0x03,0x2C,0x80,0xDF,0x00,0x85,0xD2,0x30,0x80,0xD6,0xA0,0x04,0x00,0x09,0xA0,0x12,
+	0x00,0x03,0xA0,0x1D,0x00,0x0D,0xA0,0x36,0x00,0x03,0xA0,0x41,0x00,0x03,0x00,0x04,
+	0x37,0x50,0x00,0x80,0x8E,0xA0,0x0B,0x00,0x06,0xA0,0x12,0x00,0x03,0xA0,0x1D,0x00,
+	0x02,0x00,0x85,0xD1,0x2C,0x80,0xD6,0x33,0x52,0xA0,0x2A,0x00,0x08,0xA0,0x36,0x00,
+	0x03,0x2C,0x80,0xDF,0x00,0x85,0xD1,0x30,0x80,0xD6,0xA0,0x5E,0x00,0x03,0xA0,0x0B,
+	0x00,0x06,0xA0,0x12,0x00,0x03,0xA0,0x1D,0x00,0x02,0xA0,0x71,0x00,0x03,0xA0,0x2A,
+	0x00,0x08,0xA0,0x36,0x00,0x03,0xA0,0x81,0x00,0x02,0x29,0x80,0xD6,0x30,0x50,0x00,
+	0x80,0x86,0xA0,0xAD,0x00,0x02,0x30,0x62,0x00,0x74,0x37,0x80,0xD6,0x30,0x6B,0x00,
+	0x6B,0xA0,0xBA,0x00,0x03,0x29,0x80,0xDF,0xA0,0x71,0x00,0x02,0xA0,0x2D,0x00,0x02,
+	0xA0,0x2D,0x00,0x07,0xA0,0x36,0x00,0x03,0xA0,0x81,0x00,0x02,0xA0,0xAA,0x00,0x03,
+	0xA0,0xAD,0x00,0x02,0xA0,0xB6,0x00,0x05,0xA0,0xBA,0x00,0x03,0x29,0x80,0xDF,0x00,
+	0x85,0xD0,0x2B,0x80,0xD6,0x32,0x50,0x00,0x80,0x85,0x32,0x50,0x00,0x80,0x86,0x32,
+	0x62,0x00,0x74,0x38,0x80,0xD6,0x32,0x6B,0x00,0x6B,0xA0,0x03,0x01,0x03,0x2B,0x80,
+	0xDF,0x00,0x85,0xD4,0x30,0x80,0xD6,0xA0,0x5E,0x00,0x03,0xA0,0x0B,0x00,0x06,0xA0,
+	0x12,0x00,0x03,0xA0,0x1D,0x00,0x02,0xA0,0x71,0x00,0x03,0xA0,0x2A,0x00,0x08,0xA0,
+	0x36,0x00,0x03,0xA0,0x81,0x00,0x03,0xA0,0x5E,0x00,0x03,0xA0,0x0B,0x00,0x06,0xA0,
+	0x12,0x00,0x03,0xA0,0x1D,0x00,0x02,0xA0,0x71,0x00,0x03,0xA0,0x2A,0x00,0x08,0xA0,
+	0x36,0x00,0x03,0xA0,0x81,0x00,0x02,0xA0,0xAA,0x00,0x03,0xA0,0xAD,0x00,0x02,0xA0,
+	0xB6,0x00,0x05,0xA0,0xBA,0x00,0x03,0x29,0x80,0xDF,0xA0,0x71,0x00,0x02,0xA0,0x2D,
+	0x00,0x02,0xA0,0x2D,0x00,0x07,0xA0,0x36,0x00,0x03,0xA0,0x81,0x00,0x02,0xA0,0xAA,
+	0x00,0x03,0xA0,0xAD,0x00,0x02,0xA0,0xB6,0x00,0x05,0xA0,0xBA,0x00,0x03,0x29,0x80,
+	0xDF,0x00,0x85,0xD1,0xA0,0xF2,0x00,0x02,0x00,0x80,0x86,0xA0,0xF5,0x00,0x02,0xA0,
+	0xFF,0x00,0x05,0xA0,0x03,0x01,0x03,0xA0,0x0E,0x01,0x02,0xFF
 };
 
-static const int music_title_bass[511] = {
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA2F0,0xA2E0,0xA2D0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2D0,0xA2E0,
-	0xA2F0,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA2F0,0xA2E0,0xA2D0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2D0,
-	0xA2E0,0xA2F0,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA2F0,0xA2E0,0xA2E0,0xA2D0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2D0,0xA2E0,0xA2E0,0xA2F0,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA2F0,0xA2E0,0xA2E0,0xA2D0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,
-	0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,
-	0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA2F0,0xA2E0,0xA2E0,0xA2D0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2D0,
-	0xA2E0,0xA2E0,0xA2F0,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,0xA300,
-	0xA300,0xA300,0xA300,0xA300,0xA300,0xA2F0,0xA2E0,0xA2E0,0xA2D0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,0xA2C0,
-	0xA2C0,0xA2C0,0xA2C0,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,0xA290,
-	0xA290,0xA290,0xA290,0xA290,0xA290,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,
-	0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,
-	0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0,0xA2B0
+static const unsigned char music_title_bass[100] = {
+	0x8A,0x30,0x8A,0xDE,0x2F,0x80,0xD6,0x2E,0x80,0xD6,0x2D,0x80,0xD6,0x2C,0x8A,0xE0,
+	0x2D,0x80,0xD6,0x2E,0x80,0xD6,0x2F,0x80,0xD6,0x30,0x8A,0xDE,0xA0,0x04,0x00,0x07,
+	0x30,0x8A,0xDC,0xA0,0x04,0x00,0x03,0x2C,0x8A,0xDE,0xA0,0x10,0x00,0x03,0x30,0x8A,
+	0xDC,0xA0,0x04,0x00,0x03,0x2C,0x8D,0x60,0x29,0x8D,0x60,0x2C,0x8D,0x60,0x29,0x8D,
+	0x5F,0x2B,0x8D,0x62,0x30,0x8A,0xDC,0xA0,0x04,0x00,0x03,0x2C,0x8A,0xDE,0xA0,0x10,
+	0x00,0x03,0x30,0x8A,0xDC,0xA0,0x04,0x00,0x03,0xA0,0x35,0x00,0x03,0x29,0x8D,0x60,
+	0x2B,0x8D,0x62,0xFF
 };
 
-static const int music_title_chords[511] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0xF3C0,0xF3C0,0xF3C0,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0x0000,0x0000,
-	0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,
-	0xF3C0,0x0000,0xF3C0,0x0000,0x0000,0xF3C0,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0x0000,
-	0xF3C0,0x0000,0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,
-	0x0000,0xF3C0,0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0x0000,0xF3C0,0x0000,0x0000,
-	0xF3C0,0xF3C0,0xF3C0,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0x0000,0x0000,0x0000,0xF3C0,
-	0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0xF3C0,0x0000,
-	0xF3C0,0x0000,0x0000,0xF3C0,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0x0000,0xF3C0,0x0000,
-	0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,
-	0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF3C0,0x0000,0xF380,0xF380,0x0000,0x0000,
-	0xF380,0x0000,0x0000,0x0000,0x0000,0xF380,0x0000,0x0000,0x0000,0xF380,0x0000,0x0000,
-	0x0000,0xF380,0xF380,0x0000,0xF380,0x0000,0xF380,0x0000,0xF380,0x0000,0xF380,0xF380,
-	0x0000,0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0xF380,0x0000,0x0000,0x0000,0xF380,
-	0x0000,0x0000,0x0000,0xF380,0xF380,0x0000,0xF380,0x0000,0xF380,0x0000,0xF380,0x0000,
-	0xF380,0xF380,0x0000,0x0000,0xF380,0x0000,0x0000,0x0000,0x0000,0xF380,0x0000,0x0000,
-	0x0000,0xF380,0x0000,0x0000,0x0000,0xF380,0xF380,0xF380,0x0000,0xF380,0x0000,0xF380,
-	0x0000,0xF380,0x0000,0xF3C0,0xF3C0,0xF3C0,0x0000,0xF3C0,0x0000,0x0000,0x0000,0x0000,
-	0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0x0000,0x0000,0x0000,0xF3C0,0xF3C0,0x0000,0xF3C0,
-	0x0000,0xF3B0,0x0000,0xF3B0,0x0000,0xF430,0xF430,0xF430,0x0000,0x0000,0xF430,0xF430,
-	0x0000,0x0000,0x0000,0x0000,0xF430,0x0000,0x0000,0x0000,0xF430,0x0000,0x0000,0x0000,
-	0xF430,0xF430,0x0000,0xF430,0x0000,0xF430,0x0000,0x0000,0xF430,0x0000,0x0000,0xF440,
-	0xF440,0x0000,0x0000,0xF440,0x0000,0x0000,0x0000,0x0000,0xF440,0x0000,0x0000,0x0000,
-	0xF440,0x0000,0x0000,0x0000,0xF440,0xF440,0x0000,0xF440,0x0000,0xF440,0x0000,0x0000,
-	0xF440,0x0000,0x0000,0xF430,0xF430,0xF430,0x0000,0x0000,0xF430,0xF430,0x0000,0x0000,
-	0x0000,0x0000,0xF430,0x0000,0x0000,0x0000,0xF430,0x0000,0x0000,0x0000,0xF430,0xF430,
-	0x0000,0xF430,0x0000,0xF430,0x0000,0x0000,0xF430,0x0000,0x0000,0xF420,0xF420,0x0000,
-	0x0000,0xF420,0x0000,0x0000,0x0000,0x0000,0xF420,0x0000,0x0000,0x0000,0xF420,0x0000,
-	0x0000,0x0000,0xF420,0xF420,0x0000,0xF420,0x0000,0xF420,0x0000,0xF420,0x0000,0xF410,
-	0xF410,0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,
-	0xF410,0x0000,0x0000,0x0000,0xF410,0xF410,0x0000,0xF410,0x0000,0xF410,0x0000,0xF410,
-	0x0000,0xF420,0xF420,0x0000,0x0000,0xF420,0x0000,0x0000,0x0000,0x0000,0xF420,0x0000,
-	0x0000,0x0000,0xF420,0x0000,0x0000,0x0000,0xF420,0xF420,0x0000,0xF420,0x0000,0xF420,
-	0x0000,0xF420,0x0000,0xF410,0xF410,0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,0x0000,
-	0xF410,0x0000,0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,0xF410,0xF410,0x0000,0xF410,
-	0x0000,0xF410,0x0000,0xF410,0x0000,0xF410,0xF410,0x0000,0x0000,0xF410,0xF410,0x0000,
-	0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,0xF410,0x0000,0x0000,0x0000,0xF410,0xF410,
-	0x0000,0xC410,0x0000,0xA410,0x0000,0x6410,0x0000
-};
-
-static const int music_title_drums[511] = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-static const unsigned short music_title_timing[511] = {
-	  214,    4,   80,  143,   80,  129,   98,  107,  214,  107,  107,  214,
-	  107,  107,  223,  848,  214,  214,  214,  214,   83,  132,   80,  134,
-	   98,  116,  214,  107,  107,  214,  107,  107,  223,  848,  214,  214,
-	  214,  214,    4,   80,  143,   80,  129,   98,  107,  214,  107,  107,
-	  214,  107,  107,  223,  848,  214,  214,  214,  214,   83,  132,   80,
-	  134,   98,  116,  214,  107,  107,  214,  107,  107,  223,  848,  214,
-	  214,  214,  214,    4,   67,   13,  129,   13,   58,   22,  129,   98,
-	  107,   71,  143,  107,  107,   71,  143,  107,  107,  223,   62,  143,
-	   71,  357,   71,  143,  214,   71,  143,  214,  214,   71,   11,  132,
-	   71,    9,  134,   98,  116,   71,  143,  107,  107,   71,  143,  107,
-	  107,  223,   62,  143,   71,  357,   71,  143,  214,   71,  143,  214,
-	  214,    4,   67,   13,  129,   13,   58,   22,  129,   98,  107,   71,
-	  143,  107,  107,   71,  143,  107,  107,  223,   62,  143,   71,  357,
-	   71,  143,  214,   71,  143,  214,  214,   71,   11,  132,   71,    9,
-	  134,   98,  116,   71,  143,  107,  107,   71,  143,  107,  107,  223,
-	   62,  143,   71,  357,   71,  357,   71,  357,  214,   71,    9,  134,
-	   71,    9,  134,   98,  116,   71,  143,  107,  107,   71,  143,  107,
-	  107,  223,   62,  143,   71,  357,   71,  357,   71,  357,  214,   71,
-	    9,  134,   71,    9,  134,   98,  116,   71,  143,  107,  107,   71,
-	  143,  107,  107,  223,   62,  143,   71,  357,   71,  357,   71,  357,
-	  214,   71,    9,  134,   71,    9,  134,   98,  116,   71,  143,  107,
-	  107,   71,  143,  107,  107,  223,   62,   71,   71,   71,  357,   71,
-	  357,   71,  357,  214,   80,   62,   71,   71,    9,  134,   98,  116,
-	  143,   71,  107,  107,  143,   71,  107,  107,  223,   62,  143,  286,
-	  143,  286,  143,  286,  143,  214,    4,   67,   13,  129,   13,   58,
-	   22,  129,   98,  107,   71,  143,  107,  107,   71,  143,  107,  107,
-	  223,   62,  143,   71,  357,   71,  143,  214,   71,  143,  214,  214,
-	   71,   11,  132,   71,    9,  134,   98,  116,   71,  143,  107,  107,
-	   71,  143,  107,  107,  223,   62,  143,   71,  357,   71,  143,  214,
-	   71,  143,  214,  214,    4,   67,   13,  129,   13,   58,   22,  129,
-	   98,  107,   71,  143,  107,  107,   71,  143,  107,  107,  223,   62,
-	  143,   71,  357,   71,  143,  214,   71,  143,  214,  214,   71,   11,
-	  132,   71,    9,  134,   98,  116,   71,  143,  107,  107,   71,  143,
-	  107,  107,  223,   62,  143,   71,  357,   71,  357,   71,  357,  214,
-	   71,    9,  134,   71,    9,  134,   98,  116,   71,  143,  107,  107,
-	   71,  143,  107,  107,  223,   62,  143,   71,  357,   71,  357,   71,
-	  357,  214,   71,    9,  134,   71,    9,  134,   98,  116,   71,  143,
-	  107,  107,   71,  143,  107,  107,  223,   62,  143,   71,  357,   71,
-	  357,   71,  357,  214,   71,    9,  134,   71,    9,  134,   98,  116,
-	   71,  143,  107,  107,   71,  143,  107,  107,  223,   62,  143,   71,
-	  357,   71,  357,   71,  357,  214,   71,    9,  134,   80,   62,   71,
-	   98,  116,  143,   71,  107,  107,  143,   71,  107,  107,  223,   62,
-	  143,  143,  286,  143,  286,  143,  286
-};
-
-static const unsigned char music_title_arp[511] = {
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x37,0x37,0x00,0x00,0x37,
-	0x37,0x00,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x37,0x00,
-	0x37,0x00,0x37,0x00,0x00,0x37,0x00,0x00,0x38,0x38,0x00,0x00,0x38,0x00,0x00,0x00,
-	0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x38,0x00,0x38,0x00,0x38,0x00,
-	0x00,0x38,0x00,0x00,0x37,0x37,0x37,0x00,0x00,0x37,0x37,0x00,0x00,0x00,0x00,0x37,
-	0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x37,0x00,0x37,0x00,0x37,0x00,0x00,0x37,
-	0x00,0x00,0x36,0x36,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x36,
-	0x00,0x00,0x00,0x36,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x49,0x49,0x00,0x00,
-	0x49,0x00,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x49,0x49,0x00,
-	0x49,0x00,0x49,0x00,0x49,0x00,0x4A,0x4A,0x00,0x00,0x4A,0x00,0x00,0x00,0x00,0x4A,
-	0x00,0x00,0x00,0x4A,0x00,0x00,0x00,0x4A,0x4A,0x00,0x4A,0x00,0x4A,0x00,0x4A,0x00,
-	0x49,0x49,0x00,0x00,0x49,0x00,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x49,0x00,0x00,
-	0x00,0x49,0x49,0x90,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x57,0x57,0x57,0x00,0x57,
-	0x00,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x57,0x57,0x00,0x57,
-	0x00,0x68,0x00,0x68,0x00,0x58,0x58,0x58,0x00,0x00,0x58,0x58,0x00,0x00,0x00,0x00,
-	0x58,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x58,0x58,0x00,0x58,0x00,0x58,0x00,0x00,
-	0x58,0x00,0x00,0x47,0x47,0x00,0x00,0x47,0x00,0x00,0x00,0x00,0x47,0x00,0x00,0x00,
-	0x47,0x00,0x00,0x00,0x47,0x47,0x00,0x47,0x00,0x47,0x00,0x00,0x47,0x00,0x00,0x58,
-	0x58,0x58,0x00,0x00,0x58,0x58,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x58,0x00,
-	0x00,0x00,0x58,0x58,0x00,0x58,0x00,0x58,0x00,0x00,0x58,0x00,0x00,0x69,0x69,0x00,
-	0x00,0x69,0x00,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x69,0x69,
-	0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x37,0x37,0x00,0x00,0x37,0x00,0x00,0x00,0x00,
-	0x37,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x37,0x00,0x37,0x00,0x37,0x00,0x37,
-	0x00,0x26,0x26,0x00,0x00,0x26,0x00,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x26,0x00,
-	0x00,0x00,0x26,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x37,0x37,0x00,0x00,0x37,
-	0x00,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x37,0x37,0x00,0x37,
-	0x00,0x37,0x00,0x37,0x00,0x27,0x27,0x00,0x00,0x27,0x27,0x00,0x00,0x00,0x27,0x00,
-	0x00,0x00,0x27,0x00,0x00,0x00,0x27,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00
+static const unsigned char music_title_chords[666] = {
+	0x00,0xB5,0x84,0x90,0x37,0x8F,0x3C,0x80,0xD6,0x3C,0x04,0x3C,0x43,0x00,0x80,0x8E,
+	0x3C,0x0D,0x3C,0x3A,0x00,0x81,0x64,0x3C,0x47,0x00,0x81,0x65,0xA0,0x17,0x00,0x02,
+	0x3C,0x80,0xDF,0x3C,0x3E,0x00,0x80,0x8F,0xA0,0x17,0x00,0x02,0xA0,0x17,0x00,0x02,
+	0xA0,0x17,0x00,0x02,0x90,0x38,0x3C,0x80,0xD6,0x3C,0x47,0x00,0x80,0x8F,0x3C,0x47,
+	0x00,0x81,0x65,0xA0,0x3E,0x00,0x02,0xA0,0x3E,0x00,0x02,0x3C,0x80,0xDF,0x3C,0x3E,
+	0xA0,0x3B,0x00,0x03,0xA0,0x3E,0x00,0x02,0xA0,0x3E,0x00,0x02,0x90,0x37,0x3C,0x80,
+	0xD6,0xA0,0x09,0x00,0x08,0xA0,0x17,0x00,0x02,0xA0,0x20,0x00,0x03,0xA0,0x17,0x00,
+	0x02,0xA0,0x17,0x00,0x02,0xA0,0x17,0x00,0x02,0x90,0x36,0x3C,0x80,0xD6,0x3C,0x47,
+	0x00,0x80,0x8F,0x3C,0x47,0x00,0x81,0x65,0xA0,0x83,0x00,0x02,0xA0,0x83,0x00,0x02,
+	0x3C,0x80,0xDF,0x3C,0x3E,0xA0,0x80,0x00,0x03,0xA0,0x83,0x00,0x02,0xA0,0x83,0x00,
+	0x02,0x90,0x49,0x38,0x80,0xD6,0x38,0x47,0x00,0x80,0x8F,0x38,0x47,0x00,0x81,0x65,
+	0xA0,0xAB,0x00,0x02,0xA0,0xAB,0x00,0x02,0x38,0x80,0xDF,0x38,0x3E,0xA0,0xA8,0x00,
+	0x03,0xA0,0xAB,0x00,0x02,0xA0,0xAB,0x00,0x02,0x90,0x4A,0x38,0x80,0xD6,0x38,0x47,
+	0x00,0x80,0x8F,0x38,0x47,0x00,0x81,0x65,0xA0,0xD3,0x00,0x02,0xA0,0xD3,0x00,0x02,
+	0x38,0x80,0xDF,0x38,0x3E,0xA0,0xD0,0x00,0x03,0xA0,0xD3,0x00,0x02,0xA0,0xD3,0x00,
+	0x02,0x90,0x49,0x38,0x80,0xD6,0xA0,0xA6,0x00,0x04,0xA0,0xAB,0x00,0x02,0xA0,0xAB,
+	0x00,0x02,0xA0,0xB8,0x00,0x02,0x90,0x90,0x38,0x47,0x00,0x47,0x90,0x49,0x38,0x47,
+	0x00,0x81,0x65,0xA0,0xAB,0x00,0x02,0xA0,0xAB,0x00,0x02,0x90,0x57,0x3C,0x80,0xD6,
+	0x3C,0x50,0x3C,0x3E,0x00,0x47,0x3C,0x47,0x00,0x81,0x65,0x3C,0x80,0x8F,0x00,0x81,
+	0x1D,0xA0,0x2B,0x01,0x02,0x3C,0x80,0xDF,0x3C,0x3E,0x00,0x80,0x8F,0x3C,0x81,0x1E,
+	0x00,0x80,0x8F,0x90,0x68,0x3B,0x81,0x1E,0x00,0x80,0x8F,0x3B,0x81,0x1E,0x00,0x80,
+	0x8F,0x90,0x58,0x43,0x80,0xD6,0x43,0x04,0x43,0x43,0x00,0x80,0x8E,0x43,0x0D,0x43,
+	0x3A,0x00,0x81,0x64,0x43,0x47,0x00,0x81,0x65,0xA0,0x64,0x01,0x02,0x43,0x80,0xDF,
+	0x43,0x3E,0x00,0x80,0x8F,0xA0,0x64,0x01,0x02,0xA0,0x64,0x01,0x02,0xA0,0x64,0x01,
+	0x02,0x90,0x47,0x44,0x80,0xD6,0x44,0x47,0x00,0x80,0x8F,0x44,0x47,0x00,0x81,0x65,
+	0xA0,0x8B,0x01,0x02,0xA0,0x8B,0x01,0x02,0x44,0x80,0xDF,0x44,0x3E,0xA0,0x88,0x01,
+	0x03,0xA0,0x8B,0x01,0x02,0xA0,0x8B,0x01,0x02,0x90,0x58,0x43,0x80,0xD6,0xA0,0x56,
+	0x01,0x08,0xA0,0x64,0x01,0x02,0xA0,0x6D,0x01,0x03,0xA0,0x64,0x01,0x02,0xA0,0x64,
+	0x01,0x02,0xA0,0x64,0x01,0x02,0x90,0x69,0x42,0x80,0xD6,0x42,0x47,0x00,0x80,0x8F,
+	0x42,0x47,0x00,0x81,0x65,0xA0,0xD0,0x01,0x02,0xA0,0xD0,0x01,0x02,0x42,0x80,0xDF,
+	0x42,0x3E,0xA0,0xCD,0x01,0x03,0xA0,0xD0,0x01,0x02,0xA0,0xD0,0x01,0x02,0x90,0x37,
+	0x41,0x80,0xD6,0x41,0x47,0x00,0x80,0x8F,0x41,0x47,0x00,0x81,0x65,0xA0,0xF8,0x01,
+	0x02,0xA0,0xF8,0x01,0x02,0x41,0x80,0xDF,0x41,0x3E,0xA0,0xF5,0x01,0x03,0xA0,0xF8,
+	0x01,0x02,0xA0,0xF8,0x01,0x02,0x90,0x26,0x42,0x80,0xD6,0x42,0x47,0x00,0x80,0x8F,
+	0x42,0x47,0x00,0x81,0x65,0xA0,0x20,0x02,0x02,0xA0,0x20,0x02,0x02,0x42,0x80,0xDF,
+	0x42,0x3E,0xA0,0x1D,0x02,0x03,0xA0,0x20,0x02,0x02,0xA0,0x20,0x02,0x02,0x90,0x37,
+	0x41,0x80,0xD6,0xA0,0xF3,0x01,0x04,0xA0,0xF8,0x01,0x02,0xA0,0xF8,0x01,0x02,0xA0,
+	0x05,0x02,0x02,0xA0,0xF5,0x01,0x03,0xA0,0xF8,0x01,0x02,0xA0,0xF8,0x01,0x02,0x90,
+	0x27,0x41,0x80,0xD6,0x41,0x47,0x00,0x80,0x8F,0x41,0x50,0x41,0x3E,0x00,0x81,0x1D,
+	0x41,0x80,0x8F,0xA0,0x6D,0x02,0x02,0x00,0x81,0x1D,0x41,0x80,0xDF,0x41,0x3E,0x00,
+	0x80,0x8F,0x8C,0x41,0x80,0x8F,0x00,0x81,0x1E,0x90,0x26,0x8A,0x41,0x80,0x8F,0x00,
+	0x81,0x1E,0x86,0x41,0x80,0x8F,0x00,0x81,0x1E,0xFF
 };
 
 #endif
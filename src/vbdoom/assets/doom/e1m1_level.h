@@ -0,0 +1,122 @@
+/* e1m1_level.h -- level e1m1, see functions/level.h for the format.
+ * Generated from levels/e1m1.json; edit that and run prepare_levels.py. */
+/*
+ * E1M1 -- opening level.
+ *
+ * Layout:
+ *   South (rows 26-29): Start room - pistol start
+ *   South-center (rows 20-25): Main hall with first enemies
+ *   West side room (rows 20-24): Health/ammo room
+ *   East side room (rows 20-24): Shells box room
+ *   Center (rows 12-19): Zigzag room with IMPs and sergeants
+ *   West (rows 6-11): Armor room behind door
+ *   North-center (rows 4-11): Computer room
+ *   North-east (rows 1-5): Exit room with exit switch
+ *   East corridor (cols 28-29, rows 5-11): connects east hallway to exit room
+ *   Door at row 19 center: passage from main hall to zigzag
+ *   Door at row 11 west: entrance to armor room (opened by switch at (18,10))
+ *   Switch at (18,10): opens armor room door
+ *   Exit switch at (27,3): ends level
+ *   Secret: armor room (4,9)
+ *
+ * Player starts at tile (15, 28) facing south
+ */
+const u8 e1m1_level[850] = {
+/* Header */ 86,66,76,3,32,32,2,14,15,2,1,2,
+/* Spawns */ 15,28,0,2, 17,28,0,2,
+/* Enemies */ 0,15,21,0,0, 0,17,23,0,0, 1,8,14,0,0, 0,18,16,0,0, 2,12,15,0,0, 2,15,7,0,0, 0,27,14,0,0, 1,15,12,0,0, 2,26,3,0,0, 0,4,22,0,0, 3,14,18,0,0, 3,16,10,0,0, 3,24,8,0,0, 4,25,2,0,0,
+/* Pickups */ 1,4,22, 0,27,22, 3,15,24, 2,3,16, 0,20,14, 6,26,14, 4,16,6, 5,4,9, 1,2,21, 0,13,28, 1,14,5, 6,7,18, 4,26,13, 7,20,8, 11,29,7,
+/* Switches */ 1,0, 0,0,
+/* Secrets */ 4,9,
+/* Sight 0 */ 3,3,0,0,0,0,0,0,
+/* Sight 1 */ 3,3,2,2,0,0,0,0,
+/* Sight 2 */ 0,0,0,0,0,0,0,0,
+/* Sight 3 */ 0,0,0,0,0,0,0,0,
+/* Sight 4 */ 0,0,0,0,0,0,0,0,
+/* Sight 5 */ 0,0,0,0,0,0,0,0,
+/* Sight 6 */ 192,192,0,0,0,0,0,0,
+/* Sight 7 */ 192,192,128,192,0,0,0,0,
+/* Sight 8 */ 3,3,0,0,0,0,0,0,
+/* Sight 9 */ 3,3,3,2,2,0,0,0,
+/* Sight 10 */ 0,60,60,48,16,0,0,0,
+/* Sight 11 */ 0,60,60,56,24,8,24,24,
+/* Sight 12 */ 0,60,60,28,30,8,8,8,
+/* Sight 13 */ 0,60,60,12,6,0,0,0,
+/* Sight 14 */ 192,192,128,0,0,0,0,0,
+/* Sight 15 */ 192,192,128,192,0,0,0,0,
+/* Sight 16 */ 0,2,3,0,0,0,0,0,
+/* Sight 17 */ 2,2,3,3,3,0,0,0,
+/* Sight 18 */ 0,60,60,16,0,0,0,0,
+/* Sight 19 */ 0,60,60,126,31,8,24,24,
+/* Sight 20 */ 0,60,60,62,31,8,8,8,
+/* Sight 21 */ 0,60,60,8,0,0,0,0,
+/* Sight 22 */ 0,0,64,0,0,0,0,0,
+/* Sight 23 */ 128,192,128,224,0,0,0,0,
+/* Sight 24 */ 0,0,2,63,63,0,0,0,
+/* Sight 25 */ 2,2,26,63,63,0,0,0,
+/* Sight 26 */ 0,48,24,191,63,0,0,0,
+/* Sight 27 */ 0,56,56,255,63,8,24,24,
+/* Sight 28 */ 0,28,28,255,63,8,8,8,
+/* Sight 29 */ 0,12,152,255,63,0,0,0,
+/* Sight 30 */ 128,128,136,248,31,0,0,0,
+/* Sight 31 */ 128,128,128,252,30,0,0,0,
+/* Sight 32 */ 0,0,26,127,63,0,0,0,
+/* Sight 33 */ 0,50,26,255,63,0,0,0,
+/* Sight 34 */ 0,48,24,255,63,0,0,0,
+/* Sight 35 */ 0,24,24,255,63,60,60,56,
+/* Sight 36 */ 0,28,24,255,63,8,8,8,
+/* Sight 37 */ 0,0,0,63,63,0,0,0,
+/* Sight 38 */ 0,0,0,0,0,0,0,0,
+/* Sight 39 */ 0,0,0,0,0,0,0,0,
+/* Sight 40 */ 0,0,0,0,0,255,59,0,
+/* Sight 41 */ 0,0,0,0,0,255,59,0,
+/* Sight 42 */ 0,0,0,0,8,255,255,56,
+/* Sight 43 */ 0,24,24,24,24,255,255,60,
+/* Sight 44 */ 0,0,0,0,8,255,255,60,
+/* Sight 45 */ 0,0,0,0,8,255,255,28,
+/* Sight 46 */ 0,0,0,0,0,255,252,0,
+/* Sight 47 */ 0,0,0,0,0,255,252,0,
+/* Sight 48 */ 0,0,0,0,0,63,3,0,
+/* Sight 49 */ 0,0,0,0,0,63,3,0,
+/* Sight 50 */ 0,0,0,0,8,252,60,60,
+/* Sight 51 */ 0,24,24,24,24,255,60,60,
+/* Sight 52 */ 0,8,8,8,8,255,60,60,
+/* Sight 53 */ 0,0,0,0,8,255,252,60,
+/* Sight 54 */ 0,0,0,0,0,252,224,0,
+/* Sight 55 */ 0,0,0,0,0,252,224,0,
+/* Sight 56 */ 0,0,0,0,0,0,0,0,
+/* Sight 57 */ 0,0,0,0,0,0,0,0,
+/* Sight 58 */ 0,0,0,0,0,56,60,60,
+/* Sight 59 */ 0,24,24,24,24,60,60,60,
+/* Sight 60 */ 0,8,8,8,8,60,60,60,
+/* Sight 61 */ 0,0,0,0,8,28,60,60,
+/* Sight 62 */ 0,0,0,0,0,0,0,0,
+/* Sight 63 */ 0,0,0,0,0,0,0,0,
+/* Map row 0 */ 32,1,
+/* Map row 1 */ 7,3, 141, 7,3, 130,
+/* Map row 2 */ 5,0, 143, 5,0, 156,
+/* Map row 3 */ 192,5, 141,
+/* Map row 4 */ 3,3, 3,0, 3,3, 132, 2,0, 131,
+/* Map row 5 */ 2,3, 128, 2,3, 129, 9,0, 130, 3,3, 132,
+/* Map row 6 */ 3,1, 128, 3,1, 140, 4,1, 129, 2,1,
+/* Map row 7 */ 3,2, 128, 2,2, 152,
+/* Map row 8 */ 5,0, 191,
+/* Map row 10 */ 130, 2,3, 131, 192,5, 2,3, 139,
+/* Map row 11 */ 2,2, 192,4, 2,2, 3,1, 5,0, 3,1, 4,2, 129, 192,2, 129,
+/* Map row 12 */ 4,0, 2,1, 2,2, 7,0, 3,2, 5,0, 129,
+/* Map row 13 */ 192,2, 132, 3,2, 11,0, 128, 6,0, 135,
+/* Map row 14 */ 6,0, 193,2,2, 130, 193,2,2, 9,0, 134,
+/* Map row 15 */ 193,2,2, 14,0, 192,2, 141,
+/* Map row 16 */ 16,0, 8,2, 138,
+/* Map row 17 */ 192,2, 129, 193,2,2, 130, 193,2,2, 129, 9,1,
+/* Map row 18 */ 132, 193,2,2, 14,0, 138,
+/* Map row 19 */ 13,2, 192,4, 5,2, 10,1,
+/* Map row 20 */ 6,0, 2,1, 9,0, 192,1, 128, 7,0, 191,
+/* Map row 22 */ 136,
+/* Map row 23 */ 22,0, 136,
+/* Map row 24 */ 2,1, 137, 193,1,1, 137,
+/* Map row 25 */ 11,1, 133, 23,1,
+/* Map row 26 */ 9,0, 191,
+/* Map row 28 */ 181,
+/* Map row 30 */ 52,1,
+};
@@ -1,58 +0,0 @@
-/*
- * E1M2 -- Wolfenstein-inspired bunker level (32x32 byte array).
- *
- * Tile values: 0=empty, 1=STARTAN, 2=STONE, 3=TECH, 4=DOOR, 5=SWITCH
- *
- * Layout (inspired by Wolfenstein 3D Floor 2):
- *   South (rows 26-29): Start room -- player spawns here
- *   South-center (rows 20-25): Long east-west corridor with guards
- *   West wing (rows 14-19): Barracks with supplies, door at (5,19)
- *   East wing (rows 14-19): Armory / shells room, door at (26,19)
- *   Center (rows 8-13): Central command room, large open area
- *   North-west (rows 2-7): Officer quarters, guarded by sergeant
- *   North-east (rows 2-7): Exit room with exit switch at (28,3)
- *   North corridor (rows 7-8): connects NW and NE rooms
- *   Door at (15,13): passage from central room to south corridor
- *   Door at (15,7): passage from central room to north corridor
- *   Switch at (4,4): opens locked weapon closet door at (8,16)
- *
- * Player starts at tile (15, 28)
- */
-const u8 e1m2_map[1024] = {
-/* Row  0 */ 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-/* Row  1 */ 2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,2,
-/* Row  2 */ 2,1,0,0,0,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,0,0,0,0,3,2,
-/* Row  3 */ 2,1,0,0,0,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,0,0,5,0,3,2,
-/* Row  4 */ 2,1,0,0,5,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,0,0,0,0,3,2,
-/* Row  5 */ 2,1,0,0,0,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,0,0,0,0,3,2,
-/* Row  6 */ 2,1,0,0,0,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,0,0,0,0,3,2,
-/* Row  7 */ 2,1,1,1,1,0,1,1,1,1,1,2,2,0,0,0,0,0,2,2,2,3,3,3,3,3,0,3,3,3,3,2,
-/* Row  8 */ 2,2,2,2,2,0,2,2,2,2,2,2,0,0,0,0,0,0,0,2,2,2,2,2,2,2,0,2,2,2,2,2,
-/* Row  9 */ 2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
-/* Row 10 */ 2,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1,1,1,2,
-/* Row 11 */ 2,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,2,
-/* Row 12 */ 2,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,2,
-/* Row 13 */ 2,1,1,1,1,1,1,1,2,2,2,2,2,2,2,4,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,2,
-/* Row 14 */ 2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
-/* Row 15 */ 2,0,0,0,0,0,0,0,0,0,2,2,2,2,0,0,0,0,2,2,2,2,0,0,0,0,0,0,0,0,0,2,
-/* Row 16 */ 2,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
-/* Row 17 */ 2,0,0,0,0,0,0,0,2,2,2,2,2,2,0,0,0,0,2,2,2,2,2,2,0,0,0,0,0,0,0,2,
-/* Row 18 */ 2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
-/* Row 19 */ 2,2,2,2,2,4,2,2,2,2,2,2,2,0,0,0,0,0,0,2,2,2,2,2,2,2,4,2,2,2,2,2,
-/* Row 20 */ 2,2,2,2,2,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,2,2,2,2,2,2,0,2,2,2,2,2,
-/* Row 21 */ 2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
-/* Row 22 */ 2,2,2,2,2,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,2,2,2,2,2,2,0,2,2,2,2,2,
-/* Row 23 */ 2,2,2,2,2,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,2,2,2,2,2,2,0,2,2,2,2,2,
-/* Row 24 */ 2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
-/* Row 25 */ 2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 26 */ 2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 27 */ 2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 28 */ 2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 29 */ 2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 30 */ 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-/* Row 31 */ 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-};
-
-/* E1M2 player spawn */
-#define E1M2_SPAWN_X  (15 * 256 + 128)
-#define E1M2_SPAWN_Y  (28 * 256 + 128)
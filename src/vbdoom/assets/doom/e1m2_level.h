@@ -0,0 +1,118 @@
+/* e1m2_level.h -- level e1m2, see functions/level.h for the format.
+ * Generated from levels/e1m2.json; edit that and run prepare_levels.py. */
+/*
+ * E1M2 -- Wolfenstein-inspired bunker level.
+ *
+ * Layout (inspired by Wolfenstein 3D Floor 2):
+ *   South (rows 26-29): Start room -- player spawns here
+ *   South-center (rows 20-25): Long east-west corridor with guards
+ *   West wing (rows 14-19): Barracks with supplies, door at (5,19)
+ *   East wing (rows 14-19): Armory / shells room, door at (26,19)
+ *   Center (rows 8-13): Central command room, large open area
+ *   North-west (rows 2-7): Officer quarters, guarded by sergeant
+ *   North-east (rows 2-7): Exit room with exit switch at (28,3)
+ *   North corridor (rows 7-8): connects NW and NE rooms
+ *   Door at (15,13): passage from central room to south corridor
+ *   Switch at (4,4): opens locked weapon closet door at (8,16)
+ *   Secret: weapon closet (3,16)
+ *
+ * Player starts at tile (15, 28) facing south
+ */
+const u8 e1m2_level[786] = {
+/* Header */ 86,66,76,3,32,32,2,12,12,2,1,2,
+/* Spawns */ 15,28,0,2, 17,28,0,2,
+/* Enemies */ 0,5,21,0,0, 0,26,21,0,0, 0,12,10,0,0, 0,19,11,0,0, 1,5,3,0,0, 1,15,8,0,0, 2,26,4,0,0, 0,4,16,0,0, 0,28,16,0,0, 3,15,14,0,0, 0,15,24,0,0, 2,20,9,0,0,
+/* Pickups */ 0,5,24, 1,26,24, 2,15,11, 6,29,15, 0,3,17, 6,3,14, 1,10,9, 4,8,5, 0,7,11, 1,13,28, 5,3,16, 0,25,3,
+/* Switches */ 1,0, 0,1,
+/* Secrets */ 3,16,
+/* Sight 0 */ 7,7,0,0,0,0,0,0,
+/* Sight 1 */ 7,7,2,2,0,0,0,0,
+/* Sight 2 */ 7,7,0,0,0,0,0,0,
+/* Sight 3 */ 0,0,0,0,0,0,0,0,
+/* Sight 4 */ 0,0,0,0,0,0,0,0,
+/* Sight 5 */ 224,224,0,0,0,0,0,0,
+/* Sight 6 */ 224,224,64,0,0,0,0,0,
+/* Sight 7 */ 224,224,0,0,0,0,0,0,
+/* Sight 8 */ 7,7,0,0,0,0,0,0,
+/* Sight 9 */ 7,7,2,2,0,0,0,0,
+/* Sight 10 */ 7,7,0,0,0,0,0,0,
+/* Sight 11 */ 0,24,60,60,24,24,24,24,
+/* Sight 12 */ 0,24,60,60,8,8,8,8,
+/* Sight 13 */ 224,224,0,0,0,0,0,0,
+/* Sight 14 */ 224,224,64,0,0,0,0,0,
+/* Sight 15 */ 224,224,0,0,0,0,0,0,
+/* Sight 16 */ 0,0,3,3,0,0,0,0,
+/* Sight 17 */ 2,2,127,63,0,0,0,0,
+/* Sight 18 */ 0,24,126,60,0,0,0,0,
+/* Sight 19 */ 0,24,126,60,24,24,24,24,
+/* Sight 20 */ 0,24,126,60,8,8,8,8,
+/* Sight 21 */ 0,24,254,252,0,0,0,0,
+/* Sight 22 */ 64,64,254,224,0,0,0,0,
+/* Sight 23 */ 0,0,224,224,0,0,0,0,
+/* Sight 24 */ 0,0,3,255,31,0,0,0,
+/* Sight 25 */ 2,2,3,255,31,2,2,0,
+/* Sight 26 */ 0,24,62,255,7,0,0,0,
+/* Sight 27 */ 0,24,62,255,56,24,56,24,
+/* Sight 28 */ 0,24,62,255,28,24,28,24,
+/* Sight 29 */ 0,24,254,255,224,0,0,0,
+/* Sight 30 */ 0,0,224,255,248,64,64,0,
+/* Sight 31 */ 0,0,224,255,248,0,0,0,
+/* Sight 32 */ 0,0,0,7,255,0,0,0,
+/* Sight 33 */ 0,0,0,7,255,2,2,0,
+/* Sight 34 */ 0,0,0,23,255,16,0,0,
+/* Sight 35 */ 0,24,24,219,255,60,60,56,
+/* Sight 36 */ 0,8,8,219,255,60,60,28,
+/* Sight 37 */ 0,0,0,232,255,8,0,0,
+/* Sight 38 */ 0,0,0,224,255,64,64,0,
+/* Sight 39 */ 0,0,0,224,255,0,0,0,
+/* Sight 40 */ 0,0,0,0,0,0,0,0,
+/* Sight 41 */ 0,0,0,2,2,126,2,0,
+/* Sight 42 */ 0,0,0,0,24,126,56,56,
+/* Sight 43 */ 0,24,24,24,56,126,124,60,
+/* Sight 44 */ 0,8,8,24,28,126,62,60,
+/* Sight 45 */ 0,0,0,0,24,126,28,28,
+/* Sight 46 */ 0,0,0,64,64,126,64,0,
+/* Sight 47 */ 0,0,0,0,0,0,0,0,
+/* Sight 48 */ 0,0,0,0,0,0,0,0,
+/* Sight 49 */ 0,0,0,2,2,18,126,0,
+/* Sight 50 */ 0,0,0,16,24,56,126,60,
+/* Sight 51 */ 0,24,24,24,24,60,126,60,
+/* Sight 52 */ 0,8,8,24,24,60,126,60,
+/* Sight 53 */ 0,0,0,8,24,28,126,60,
+/* Sight 54 */ 0,0,0,64,64,72,126,0,
+/* Sight 55 */ 0,0,0,0,0,0,0,0,
+/* Sight 56 */ 0,0,0,0,0,0,0,0,
+/* Sight 57 */ 0,0,0,0,0,0,0,0,
+/* Sight 58 */ 0,0,0,0,16,56,60,60,
+/* Sight 59 */ 0,24,24,24,24,60,60,60,
+/* Sight 60 */ 0,8,8,24,24,60,60,60,
+/* Sight 61 */ 0,0,0,0,8,28,60,60,
+/* Sight 62 */ 0,0,0,0,0,0,0,0,
+/* Sight 63 */ 0,0,0,0,0,0,0,0,
+/* Map row 0 */ 32,2,
+/* Map row 1 */ 9,1, 137, 9,3, 130,
+/* Map row 2 */ 7,0, 139, 7,0, 157,
+/* Map row 3 */ 192,5, 134,
+/* Map row 4 */ 192,5, 150, 192,0, 134,
+/* Map row 5 */ 5,0, 183,
+/* Map row 7 */ 2,1, 128, 4,1, 129, 4,0, 131, 3,3, 128, 3,3, 5,2,
+/* Map row 8 */ 128, 5,2, 6,0, 6,2, 128, 9,2,
+/* Map row 9 */ 21,0, 133,
+/* Map row 10 */ 3,1, 128, 193,1,1, 141, 193,1,1, 128, 5,1, 130,
+/* Map row 11 */ 4,0, 143, 6,0, 163,
+/* Map row 13 */ 5,1, 6,2, 192,4, 5,2, 8,1, 129,
+/* Map row 14 */ 29,0, 138,
+/* Map row 15 */ 3,2, 131, 3,2, 145,
+/* Map row 16 */ 192,4, 21,0, 136,
+/* Map row 17 */ 5,2, 131, 5,2, 143,
+/* Map row 18 */ 22,0, 5,2,
+/* Map row 19 */ 192,4, 6,2, 133, 6,2, 192,4, 9,2,
+/* Map row 20 */ 192,0, 133, 7,0, 133, 192,0, 138,
+/* Map row 21 */ 20,0, 138,
+/* Map row 22 */ 5,2, 135, 5,2, 171,
+/* Map row 24 */ 20,0, 17,2,
+/* Map row 25 */ 133, 23,2,
+/* Map row 26 */ 9,0, 191,
+/* Map row 28 */ 181,
+/* Map row 30 */ 52,2,
+};
@@ -1,73 +0,0 @@
-/*
- * E1M3 -- Hell-touched research facility (32x32 byte array).
- *
- * Tile values: 0=empty, 1=STARTAN, 2=STONE, 3=TECH, 4=DOOR, 5=SWITCH
- *
- * Layout (largest level, uses ~75% of the grid):
- *   South (rows 26-29): Start room -- player spawns facing north
- *   South corridor (rows 22-25): Wide E-W hallway, first guards
- *   West wing (rows 14-20): Storage / barracks, demons, supplies
- *   East wing (rows 14-20): Tech labs with imps and sergeants
- *   Central arena (rows 8-12): Large open battle room, mixed enemies
- *   North-west (rows 2-6): Hidden armory tunnel (secret 1)
- *   North center (rows 2-6): Command center with exit switch, demon guards
- *   North-east (rows 2-5): Locked tech room (switch-opened, secret 2)
- *   Corridors connect areas through doors
- *
- * Doors (6 total):
- *   (15, 21) -- center passage from south corridor to mid area
- *   (5, 14)  -- west wing entrance
- *   (26, 14) -- east wing entrance
- *   (15, 7)  -- north gate from arena to command center
- *   (4, 7)   -- hidden armory entrance (switch-opened)
- *   (28, 5)  -- locked tech room (switch-opened)
- *
- * Switches:
- *   (10, 10) -- opens hidden armory door (4,7) [SW_DOOR, linked door 4]
- *   (20, 10) -- opens locked tech room door (28,5) [SW_DOOR, linked door 5]
- *   (15, 3)  -- exit switch [SW_EXIT]
- *
- * Secrets:
- *   (2, 4) -- hidden armory room
- *   (29, 3) -- locked tech room with rocket launcher
- *
- * Player starts at tile (15, 28) facing north (angle 0)
- */
-const u8 e1m3_map[1024] = {
-/* Row  0 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-/* Row  1 */ 1,2,2,2,2,2,2,2,1,1,3,3,3,3,3,3,3,3,3,3,3,1,1,3,3,3,3,3,3,3,3,1,
-/* Row  2 */ 1,2,0,0,0,0,0,2,1,1,3,0,0,0,0,0,0,0,0,0,3,1,1,3,0,0,0,0,0,0,3,1,
-/* Row  3 */ 1,2,0,0,0,0,0,2,1,1,3,0,0,0,0,5,0,0,0,0,3,1,1,3,0,0,0,0,0,0,3,1,
-/* Row  4 */ 1,2,0,0,0,0,0,2,1,1,3,0,0,0,0,0,0,0,0,0,3,1,1,3,0,0,0,0,0,0,3,1,
-/* Row  5 */ 1,2,2,2,0,2,2,2,1,1,3,3,0,0,0,0,0,0,0,3,3,1,1,3,3,3,3,3,4,3,3,1,
-/* Row  6 */ 1,1,1,1,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,1,
-/* Row  7 */ 1,2,2,2,4,2,2,2,1,1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,
-/* Row  8 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row  9 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 10 */ 1,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 11 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 12 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 13 */ 1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,
-/* Row 14 */ 1,2,2,2,2,4,2,2,2,1,1,1,1,2,0,0,0,0,2,1,1,1,1,2,2,2,4,2,2,2,2,1,
-/* Row 15 */ 1,2,0,0,0,0,0,0,2,1,1,1,1,0,0,0,0,0,0,1,1,1,1,2,0,0,0,0,0,0,2,1,
-/* Row 16 */ 1,2,0,0,0,0,0,0,2,1,1,1,1,0,0,0,0,0,0,1,1,1,1,2,0,0,0,0,0,0,2,1,
-/* Row 17 */ 1,2,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,2,1,
-/* Row 18 */ 1,2,0,0,0,0,0,0,2,1,1,1,1,0,0,0,0,0,0,1,1,1,1,2,0,0,0,0,0,0,2,1,
-/* Row 19 */ 1,2,0,0,0,0,0,0,2,1,1,1,1,0,0,0,0,0,0,1,1,1,1,2,0,0,0,0,0,0,2,1,
-/* Row 20 */ 1,2,2,2,2,2,2,2,2,1,1,1,1,2,0,0,0,0,2,1,1,1,1,2,2,2,2,2,2,2,2,1,
-/* Row 21 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 22 */ 1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
-/* Row 23 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 24 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-/* Row 25 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 26 */ 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 27 */ 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 28 */ 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 29 */ 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 30 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-/* Row 31 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-};
-
-/* E1M3 player spawn */
-#define E1M3_SPAWN_X  (15 * 256 + 128)
-#define E1M3_SPAWN_Y  (28 * 256 + 128)
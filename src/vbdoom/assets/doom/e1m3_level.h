@@ -0,0 +1,132 @@
+/* e1m3_level.h -- level e1m3, see functions/level.h for the format.
+ * Generated from levels/e1m3.json; edit that and run prepare_levels.py. */
+/*
+ * E1M3 -- Hell-touched research facility.
+ *
+ * Layout (largest level, uses ~75% of the grid):
+ *   South (rows 26-29): Start room -- player spawns facing north
+ *   South corridor (rows 22-25): Wide E-W hallway, first guards
+ *   West wing (rows 14-20): Storage / barracks, demons, supplies
+ *   East wing (rows 14-20): Tech labs with imps and sergeants
+ *   Central arena (rows 8-12): Large open battle room, mixed enemies
+ *   North-west (rows 2-6): Hidden armory tunnel (secret 1)
+ *   North center (rows 2-6): Command center with exit switch, demon guards
+ *   North-east (rows 2-5): Locked tech room (switch-opened, secret 2)
+ *   Corridors connect areas through doors
+ *
+ * Doors (6 total):
+ *   (28, 5)  -- locked tech room (switch-opened)
+ *   (4, 7)   -- hidden armory entrance (switch-opened)
+ *   (15, 7)  -- north gate from arena to command center
+ *   (5, 14)  -- west wing entrance
+ *   (26, 14) -- east wing entrance
+ *   (15, 21) -- center passage from south corridor to mid area
+ *
+ * Switches:
+ *   (15, 3)  -- exit switch
+ *   (10, 10) -- opens hidden armory door (4,7)
+ *   (20, 10) -- opens locked tech room door (28,5)
+ *
+ * Secrets:
+ *   (2, 4) -- hidden armory room
+ *   (29, 3) -- locked tech room with rocket launcher
+ *
+ * Player starts at tile (15, 28) facing north
+ */
+const u8 e1m3_level[830] = {
+/* Header */ 86,66,76,3,32,32,2,13,12,3,2,2,
+/* Spawns */ 15,28,0,0, 17,28,0,0,
+/* Enemies */ 0,5,23,0,0, 0,20,24,0,0, 0,8,12,0,0, 0,28,16,0,0, 1,15,9,0,0, 1,3,17,0,0, 1,28,18,0,0, 2,22,10,0,0, 2,15,17,0,0, 2,16,4,0,0, 3,15,11,0,0, 3,4,15,0,0, 3,14,6,0,0,
+/* Pickups */ 3,10,23, 0,13,28, 6,22,24, 1,3,19, 2,4,16, 6,29,17, 0,27,15, 1,2,9, 4,25,9, 5,2,4, 7,29,3, 2,14,2,
+/* Switches */ 1,0, 0,1, 0,0,
+/* Secrets */ 2,4, 29,3,
+/* Sight 0 */ 3,3,0,0,0,0,0,0,
+/* Sight 1 */ 3,3,2,2,0,0,0,0,
+/* Sight 2 */ 28,28,0,0,0,0,0,0,
+/* Sight 3 */ 28,28,24,16,16,16,0,0,
+/* Sight 4 */ 28,28,8,0,8,0,0,0,
+/* Sight 5 */ 0,0,0,0,0,0,0,0,
+/* Sight 6 */ 192,192,0,0,0,0,0,0,
+/* Sight 7 */ 192,192,128,128,0,0,0,0,
+/* Sight 8 */ 3,3,0,0,0,0,0,0,
+/* Sight 9 */ 3,3,7,15,0,0,0,0,
+/* Sight 10 */ 28,28,0,0,0,0,0,0,
+/* Sight 11 */ 28,28,28,28,24,24,8,8,
+/* Sight 12 */ 28,28,8,0,0,0,0,0,
+/* Sight 13 */ 0,0,0,0,0,0,0,0,
+/* Sight 14 */ 192,192,0,0,0,0,0,0,
+/* Sight 15 */ 192,192,224,248,0,0,0,0,
+/* Sight 16 */ 0,2,255,127,0,0,0,0,
+/* Sight 17 */ 2,2,255,127,0,0,0,0,
+/* Sight 18 */ 0,10,255,127,16,0,0,0,
+/* Sight 19 */ 24,24,255,31,24,24,8,8,
+/* Sight 20 */ 8,8,255,255,24,24,8,8,
+/* Sight 21 */ 0,128,255,255,8,0,0,0,
+/* Sight 22 */ 0,128,255,255,8,0,0,0,
+/* Sight 23 */ 128,128,255,255,0,0,0,0,
+/* Sight 24 */ 0,2,255,255,3,0,0,0,
+/* Sight 25 */ 2,2,255,255,7,0,0,0,
+/* Sight 26 */ 0,10,255,255,0,0,0,0,
+/* Sight 27 */ 0,138,255,255,24,24,24,24,
+/* Sight 28 */ 8,136,255,255,24,24,8,8,
+/* Sight 29 */ 0,128,247,255,0,0,0,0,
+/* Sight 30 */ 0,128,247,255,224,0,0,0,
+/* Sight 31 */ 128,128,240,255,192,0,0,0,
+/* Sight 32 */ 0,0,0,3,3,0,0,0,
+/* Sight 33 */ 0,0,0,3,7,0,0,0,
+/* Sight 34 */ 0,0,0,2,62,0,0,0,
+/* Sight 35 */ 16,8,120,24,60,24,24,24,
+/* Sight 36 */ 8,8,28,24,60,24,8,8,
+/* Sight 37 */ 0,0,0,64,124,0,0,0,
+/* Sight 38 */ 0,0,0,192,224,0,0,0,
+/* Sight 39 */ 0,0,0,192,192,0,0,0,
+/* Sight 40 */ 0,0,0,0,0,255,255,0,
+/* Sight 41 */ 0,0,0,0,0,255,255,0,
+/* Sight 42 */ 0,0,0,0,0,255,255,48,
+/* Sight 43 */ 0,8,24,24,24,255,255,60,
+/* Sight 44 */ 8,8,24,24,24,255,255,60,
+/* Sight 45 */ 0,0,0,0,0,255,255,12,
+/* Sight 46 */ 0,0,0,0,0,255,255,0,
+/* Sight 47 */ 0,0,0,0,0,255,255,0,
+/* Sight 48 */ 0,0,0,0,0,255,255,0,
+/* Sight 49 */ 0,0,0,0,0,255,255,0,
+/* Sight 50 */ 0,0,0,0,0,255,255,60,
+/* Sight 51 */ 0,8,24,24,24,255,255,60,
+/* Sight 52 */ 0,0,0,8,8,255,255,60,
+/* Sight 53 */ 0,0,0,0,0,255,255,60,
+/* Sight 54 */ 0,0,0,0,0,255,255,0,
+/* Sight 55 */ 0,0,0,0,0,255,255,0,
+/* Sight 56 */ 0,0,0,0,0,0,0,0,
+/* Sight 57 */ 0,0,0,0,0,0,0,0,
+/* Sight 58 */ 0,0,0,0,0,56,60,60,
+/* Sight 59 */ 0,8,24,24,24,56,60,60,
+/* Sight 60 */ 0,0,0,8,8,28,60,60,
+/* Sight 61 */ 0,0,0,0,0,28,60,60,
+/* Sight 62 */ 0,0,0,0,0,0,0,0,
+/* Sight 63 */ 0,0,0,0,0,0,0,0,
+/* Map row 0 */ 32,1,
+/* Map row 1 */ 6,2, 129, 10,3, 129, 7,3, 130,
+/* Map row 2 */ 4,0, 131, 8,0, 131, 5,0, 144,
+/* Map row 3 */ 192,5, 158,
+/* Map row 4 */ 4,0, 141,
+/* Map row 5 */ 193,2,2, 128, 2,2, 130, 192,3, 134, 192,3, 131, 3,3, 193,4,3, 130,
+/* Map row 6 */ 2,1, 128, 5,1, 8,0, 7,1, 192,0, 3,1,
+/* Map row 7 */ 2,2, 192,4, 2,2, 6,1, 192,4, 11,1, 132,
+/* Map row 8 */ 29,0, 170,
+/* Map row 10 */ 192,5, 136, 192,5, 148,
+/* Map row 11 */ 2,0, 193,2,2, 129, 193,2,2, 11,0, 141,
+/* Map row 12 */ 17,0, 7,1,
+/* Map row 13 */ 145, 7,1,
+/* Map row 14 */ 3,2, 192,4, 2,2, 3,1, 192,2, 131, 192,2, 3,1, 2,2, 192,4, 3,2, 130,
+/* Map row 15 */ 5,0, 132, 5,0, 132, 5,0, 167,
+/* Map row 17 */ 193,2,2, 15,0, 193,2,2, 139,
+/* Map row 18 */ 194,0,0,2, 3,1, 133, 3,1, 192,2, 5,0, 163,
+/* Map row 20 */ 6,2, 131, 192,2, 131, 192,2, 132, 6,2, 15,1,
+/* Map row 21 */ 192,4, 20,1,
+/* Map row 22 */ 21,0, 133,
+/* Map row 23 */ 29,0, 161,
+/* Map row 25 */ 11,1, 133, 23,1,
+/* Map row 26 */ 9,0, 191,
+/* Map row 28 */ 181,
+/* Map row 30 */ 52,1,
+};
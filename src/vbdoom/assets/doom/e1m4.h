@@ -1,42 +0,0 @@
-/* VBDOOM_LEVEL_FORMAT 1 */
-/* e1m4 map: 32x32 */
-const u8 e1m4_map[1024] = {
-/* Row 0 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,1,1,
-/* Row 1 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
-/* Row 2 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
-/* Row 3 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,
-/* Row 4 */ 1,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
-/* Row 5 */ 1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,1,
-/* Row 6 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,
-/* Row 7 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,
-/* Row 8 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,
-/* Row 9 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,3,3,3,3,3,3,1,1,1,1,1,1,1,1,1,
-/* Row 10 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,3,0,0,0,0,0,1,0,0,4,0,0,0,0,1,
-/* Row 11 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,3,3,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,
-/* Row 12 */ 2,0,0,0,0,0,0,0,0,0,0,0,0,1,3,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,
-/* Row 13 */ 2,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,
-/* Row 14 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,3,3,3,1,0,0,0,0,0,0,0,0,1,
-/* Row 15 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,3,3,0,0,1,0,0,0,0,0,0,0,0,1,
-/* Row 16 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,3,3,3,0,0,0,4,0,0,0,0,0,0,0,0,1,
-/* Row 17 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,3,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
-/* Row 18 */ 2,0,0,0,0,0,2,2,2,2,2,2,2,3,3,3,3,0,0,3,3,3,1,1,1,0,0,1,1,4,1,1,
-/* Row 19 */ 2,2,2,0,2,2,2,0,0,0,0,0,0,3,0,0,6,0,0,3,0,0,0,4,1,0,0,1,0,0,0,1,
-/* Row 20 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,3,3,3,3,0,0,3,0,0,0,0,1,1,1,1,0,0,0,1,
-/* Row 21 */ 5,0,0,0,0,0,7,0,0,0,0,0,0,2,2,2,3,4,3,3,0,0,0,1,1,0,0,0,0,0,0,1,
-/* Row 22 */ 2,0,0,0,0,0,2,0,0,0,0,0,0,2,0,0,0,0,2,0,0,0,0,1,0,0,0,0,0,0,0,1,
-/* Row 23 */ 1,1,1,4,1,1,1,1,1,1,1,1,1,2,0,0,0,0,2,0,0,1,1,1,0,0,0,0,0,0,0,1,
-/* Row 24 */ 1,0,0,0,0,0,2,0,0,0,0,0,0,2,0,0,0,0,4,0,0,1,0,0,0,0,0,0,0,0,0,1,
-/* Row 25 */ 1,0,0,0,0,0,2,0,0,0,0,0,0,4,0,4,4,0,2,0,0,1,0,0,0,0,0,0,0,0,0,1,
-/* Row 26 */ 1,0,0,0,0,0,2,0,0,0,0,0,0,3,3,3,3,2,2,2,2,2,2,4,2,2,2,1,1,1,1,1,
-/* Row 27 */ 1,0,0,0,0,0,2,0,0,0,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,1,0,0,0,1,
-/* Row 28 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,0,0,0,0,0,0,4,0,0,0,1,
-/* Row 29 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
-/* Row 30 */ 1,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
-/* Row 31 */ 1,1,1,1,1,1,1,1,1,1,1,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1
-};
-
-/* e1m4 spawn and level data */
-#define E1M4_SPAWN_X  (30 * 256 + 128)
-#define E1M4_SPAWN_Y  (30 * 256 + 128)
-#define E1M4_SPAWN2_X (30 * 256 + 128)
-#define E1M4_SPAWN2_Y (27 * 256 + 128)
@@ -0,0 +1,110 @@
+/* e1m4_level.h -- level e1m4, see functions/level.h for the format.
+ * Generated from levels/e1m4.json; edit that and run prepare_levels.py. */
+/*
+ * E1M4 -- built in the web editor.
+ *
+ * Player starts at tile (30, 30) facing west
+ */
+const u8 e1m4_level[982] = {
+/* Header */ 86,66,76,3,32,32,2,21,16,2,0,2,
+/* Spawns */ 30,30,0,3, 28,30,0,3,
+/* Enemies */ 0,23,29,0,3, 0,20,29,0,3, 0,30,19,0,0, 0,28,19,0,0, 0,30,21,0,0, 2,26,10,0,2, 2,29,10,0,2, 0,15,25,0,0, 3,23,19,0,1, 3,5,26,0,0, 1,2,30,0,0, 2,4,30,0,0, 0,3,12,0,0, 1,4,11,0,0, 0,7,7,0,0, 2,21,11,0,0, 3,22,8,0,0, 0,18,6,0,0, 1,29,2,0,0, 0,9,16,0,0, 2,1,2,0,0,
+/* Pickups */ 6,14,27, 6,15,27, 1,16,27, 7,14,19, 4,17,17, 5,20,19, 3,16,23, 2,2,21, 4,2,5, 6,3,5, 1,13,13, 4,1,5, 0,4,21, 0,23,14, 0,16,9, 7,4,5,
+/* Switches */ 0,5, 1,0,
+/* Sight 0 */ 127,15,0,0,0,0,0,0,
+/* Sight 1 */ 127,15,0,0,0,0,0,0,
+/* Sight 2 */ 127,15,0,0,0,0,0,0,
+/* Sight 3 */ 127,126,56,0,0,0,0,0,
+/* Sight 4 */ 127,120,120,0,0,0,0,0,
+/* Sight 5 */ 127,120,120,0,0,0,0,0,
+/* Sight 6 */ 127,120,120,0,0,0,0,0,
+/* Sight 7 */ 128,128,128,0,0,0,0,0,
+/* Sight 8 */ 7,15,15,15,15,1,1,3,
+/* Sight 9 */ 15,15,15,15,15,1,1,1,
+/* Sight 10 */ 15,15,15,15,15,0,0,0,
+/* Sight 11 */ 127,127,63,15,15,0,0,0,
+/* Sight 12 */ 120,120,56,0,0,0,0,0,
+/* Sight 13 */ 120,120,248,0,0,0,0,0,
+/* Sight 14 */ 120,120,224,0,0,0,0,0,
+/* Sight 15 */ 128,128,192,0,0,0,0,0,
+/* Sight 16 */ 0,15,15,15,15,3,1,3,
+/* Sight 17 */ 0,15,15,15,15,1,1,1,
+/* Sight 18 */ 0,15,15,15,15,0,0,0,
+/* Sight 19 */ 120,63,63,15,15,0,0,0,
+/* Sight 20 */ 120,56,56,56,8,0,0,0,
+/* Sight 21 */ 120,120,248,56,8,0,0,0,
+/* Sight 22 */ 112,224,224,224,224,128,128,0,
+/* Sight 23 */ 128,224,224,224,224,128,128,0,
+/* Sight 24 */ 0,15,15,15,3,3,1,3,
+/* Sight 25 */ 0,15,15,15,15,1,1,1,
+/* Sight 26 */ 0,15,15,15,14,0,0,0,
+/* Sight 27 */ 0,15,63,63,14,0,0,0,
+/* Sight 28 */ 0,0,48,56,8,0,0,0,
+/* Sight 29 */ 0,0,240,248,240,0,0,0,
+/* Sight 30 */ 0,0,192,224,240,128,0,0,
+/* Sight 31 */ 0,0,192,224,240,192,192,0,
+/* Sight 32 */ 0,15,15,3,3,3,1,3,
+/* Sight 33 */ 0,15,15,15,15,15,0,0,
+/* Sight 34 */ 0,15,15,14,14,15,0,0,
+/* Sight 35 */ 0,15,63,30,30,31,0,0,
+/* Sight 36 */ 0,0,0,224,248,16,16,0,
+/* Sight 37 */ 0,0,192,224,240,48,48,0,
+/* Sight 38 */ 0,0,192,224,240,0,0,0,
+/* Sight 39 */ 0,0,192,224,240,192,224,0,
+/* Sight 40 */ 0,3,3,3,15,15,3,3,
+/* Sight 41 */ 0,0,1,1,15,15,1,1,
+/* Sight 42 */ 0,0,0,0,14,15,0,0,
+/* Sight 43 */ 0,0,0,0,14,31,56,0,
+/* Sight 44 */ 0,0,0,0,56,56,56,0,
+/* Sight 45 */ 0,0,0,0,32,48,48,0,
+/* Sight 46 */ 0,0,0,128,128,192,224,32,
+/* Sight 47 */ 0,0,192,192,128,192,224,0,
+/* Sight 48 */ 0,3,3,3,1,3,3,15,
+/* Sight 49 */ 0,0,0,0,0,1,63,15,
+/* Sight 50 */ 0,0,0,0,0,0,62,15,
+/* Sight 51 */ 0,0,0,0,0,24,62,31,
+/* Sight 52 */ 0,0,0,0,48,56,62,120,
+/* Sight 53 */ 0,0,0,0,160,248,254,240,
+/* Sight 54 */ 0,0,0,128,128,192,224,248,
+/* Sight 55 */ 0,0,192,128,128,192,224,240,
+/* Sight 56 */ 0,3,3,3,1,3,15,15,
+/* Sight 57 */ 0,1,1,1,1,1,15,15,
+/* Sight 58 */ 0,0,0,0,0,0,15,15,
+/* Sight 59 */ 0,0,0,0,0,0,95,255,
+/* Sight 60 */ 0,0,0,0,0,0,248,248,
+/* Sight 61 */ 0,0,0,0,0,64,240,248,
+/* Sight 62 */ 0,0,0,0,0,0,240,248,
+/* Sight 63 */ 0,0,0,0,0,0,224,248,
+/* Map row 0 */ 28,1, 192,5, 2,1,
+/* Map row 1 */ 11,0, 192,7, 12,0, 128, 2,0, 141,
+/* Map row 2 */ 192,1, 173,
+/* Map row 3 */ 192,1, 133,
+/* Map row 4 */ 2,1, 149, 2,0, 131,
+/* Map row 5 */ 193,0,0, 143, 192,1, 133, 192,1, 131,
+/* Map row 6 */ 12,1, 141, 2,0, 129,
+/* Map row 7 */ 11,0, 173,
+/* Map row 8 */ 3,0, 145,
+/* Map row 9 */ 5,3, 9,1,
+/* Map row 10 */ 142, 192,3, 128, 4,0, 128, 194,0,0,4, 3,0, 141,
+/* Map row 11 */ 192,4, 128, 192,3, 128, 5,0, 130, 4,0, 128,
+/* Map row 12 */ 192,2, 139, 193,1,3, 128, 6,0, 149,
+/* Map row 13 */ 192,0, 128, 6,0, 192,1, 142,
+/* Map row 14 */ 192,2, 139, 2,3, 128, 7,0, 146,
+/* Map row 15 */ 192,3, 128, 193,0,0, 153,
+/* Map row 16 */ 2,3, 2,0, 192,4, 150,
+/* Map row 17 */ 192,4, 129, 4,0, 192,1, 143,
+/* Map row 18 */ 5,2, 3,3, 129, 2,3, 2,1, 129, 195,1,1,4,1, 129,
+/* Map row 19 */ 193,2,2, 128, 2,2, 5,0, 128, 194,0,0,6, 130, 2,0, 192,4, 131, 2,0, 129,
+/* Map row 20 */ 4,0, 135, 2,3, 133, 192,0, 3,1, 131,
+/* Map row 21 */ 192,5, 132, 192,7, 133, 2,2, 128, 193,4,3, 131, 192,1, 128, 5,0, 128,
+/* Map row 22 */ 192,2, 132, 192,2, 134, 3,0, 192,2, 3,0, 128, 6,0, 3,1,
+/* Map row 23 */ 192,4, 8,1, 135, 2,1, 136,
+/* Map row 24 */ 4,0, 192,2, 5,0, 132, 192,4, 130, 8,0, 141,
+/* Map row 25 */ 192,4, 128, 193,4,4, 128, 192,2, 153,
+/* Map row 26 */ 3,3, 5,2, 192,4, 2,2, 5,1,
+/* Map row 27 */ 140, 2,0, 128, 2,0, 128, 4,0, 128, 2,0, 134,
+/* Map row 28 */ 6,0, 135, 5,0, 192,4, 148,
+/* Map row 29 */ 192,4, 136, 192,1, 148,
+/* Map row 30 */ 192,2, 142,
+/* Map row 31 */ 9,1, 5,3, 9,2, 4,1,
+};
@@ -28,11 +28,17 @@
 #include "menu_options.h"
 #include "link.h"
 #include "teleport.h"
+#include "profiler.h"
+#include "demo.h"
+#include "lockstep.h"
+#include "snapshot.h"
+#include "enemysync.h"
+#include "idle.h"
+#include "level.h"
 extern BYTE FontTiles[];
 #include <stdint.h>
 #include <stdbool.h>
 
-int rand(void);  /* forward declaration -- avoids pulling in full stdlib */
 
 /* Volume conversion LUTs: setting (0-9) <-> hardware (0-15) */
 static const u8 g_settingToHw[10] = {0,1,3,5,6,8,10,11,13,15};
@@ -55,26 +61,8 @@ static const RumbleLevel g_rumbleLevels[9] = {
 
 /* Map data (defined in RayCasterData.h, compiled via RayCasterFixed.c) */
 extern u8 g_map[];
-extern const u8 e1m1_map[];
-extern const u8 e1m2_map[];
-extern const u8 e1m3_map[];
-extern const u8 e1m4_map[];
 extern const u8 dm1_map[];
 
-/* Player spawn positions (must match RayCasterData.h / e1m2.h) */
-#define E1M1_SPAWN_X  (15 * 256 + 128)
-#define E1M1_SPAWN_Y  (28 * 256 + 128)
-#define E1M2_SPAWN_X  (15 * 256 + 128)
-#define E1M2_SPAWN_Y  (28 * 256 + 128)
-#define E1M3_SPAWN_X  (15 * 256 + 128)
-#define E1M3_SPAWN_Y  (28 * 256 + 128)
-/* VBDOOM_LEVEL_FORMAT 1 */
-/* e1m4 spawn and level data */
-#define E1M4_SPAWN_X  (30 * 256 + 128)
-#define E1M4_SPAWN_Y  (30 * 256 + 128)
-#define E1M4_SPAWN2_X (30 * 256 + 128)
-#define E1M4_SPAWN2_Y (27 * 256 + 128)
-
 /* DM Arena spawn points (4 total, defined in dm1.h) */
 extern const u16 dm_spawnX[];
 extern const u16 dm_spawnY[];
@@ -103,15 +91,8 @@ bool pendingAutoSwitch = false;
 bool isPlayMusicBool = true;
 u16 g_levelFrames = 0;  /* frames elapsed this level (for stats screen time) */
 
-/* Secret tracking */
+/* Secret tracking (the level's secrets: g_secrets, level.h) */
 u8 g_secretsFound = 0;
-u8 g_totalSecrets = 0;
-
-/* Secret sector definitions: each is a tile position (tx, ty).
- * When the player enters a secret tile for the first time, it's counted. */
-#define MAX_SECRETS 4
-typedef struct { u8 tx; u8 ty; bool found; } SecretSector;
-SecretSector g_secrets[MAX_SECRETS];
 u8 currentWeapon = 2;
 u8 nextWeapon = 2;
 u8 updatePistolCount = 0;
@@ -139,6 +120,15 @@ Weapon weapons[] = {
 { false, W_ROCKET, true, 0,3,5},   /* rocket launcher: ammo type 3 = RCKT */
 { false, W_CHAINGUN, true, 0,1,3}, /* chaingun: ammo type 1 = BULL, attackFrames=3: idle→shoot1→shoot2→reset */
 };
+/* New-game loadout, same as the initializer above (demos start from it) */
+static const Weapon weaponsStart[] = {
+{ false, W_CHAINSAW, false, 0,0,1},
+{ true, W_FISTS, false, 0,0,4},
+{ true, W_PISTOL, true, 50,1,4},
+{ false, W_SHOTGUN, true, 0,2,5},
+{ false, W_ROCKET, true, 0,3,5},
+{ false, W_CHAINGUN, true, 0,1,3},
+};
 
 // 0 = chainsaw, 1 = fists, 2 = pistol, 3 = shotgun, 4 =
 u16 ammos[] = {
@@ -156,6 +146,134 @@ const s16 swayYTBL[] =     {0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 1, 2, 2, 2, 1, 0};
 u16 walkSwayIndex = 0;
 const s16 walkSwayYTBL[] = {0, 0, 1, 1, 1, 1, 1, 0, 0,-1,-1,-1,-1};
 
+static u8 currentHealth = 100;
+static u16 currentArmour = 0;
+static u8 armorType = 0;  /* 0=none, 1=green (1/3 absorb), 2=blue (1/2 absorb) */
+static u8 killFaceTimer = 0;      /* >0 = show evil grin */
+static bool g_firedRocketThisFrame = false;  /* set when local player fires a rocket */
+
+/* Lockstep co-op (lockstep.h): both players are simulated on both
+ * consoles. The one being simulated is in the globals above, the other
+ * one in otherSim, and playerSwap() trades them, so the player parts
+ * (playerControl, playerPickups, ...) run for either. Only while the
+ * globals hold this console's player (simLocal) do they touch the HUD
+ * and the weapon sprites. */
+typedef struct {
+	u16 x, y;
+	s16 ang;
+	Weapon weapons[6];
+	u8 currentWeapon, nextWeapon;
+	u8 updatePistolCount, weaponAnimation, weaponChangeTimer;
+	bool isShooting, isChangingWeapon, pendingAutoSwitch;
+	bool isRunning, isMoving, firedRocket;
+	u8 health, armorType;
+	u16 armour;
+	u8 damage;          /* g_lastEnemyDamage */
+	u16 pad, pressed;   /* playerPad, playerPressed */
+} PlayerSim;
+
+static PlayerSim otherSim;
+static bool simLocal = true;
+static u16 playerPad = 0;      /* input of the player being simulated */
+static u16 playerPressed = 0;  /* newly pressed this frame */
+static bool frameTraced = false; /* TraceFrame ran this pass (center ray is fresh) */
+
+static void playerSave(PlayerSim *p) {
+	p->x = fPlayerX;
+	p->y = fPlayerY;
+	p->ang = fPlayerAng;
+	copymem((u8*)p->weapons, (const u8*)weapons, sizeof(weapons));
+	p->currentWeapon = currentWeapon;
+	p->nextWeapon = nextWeapon;
+	p->updatePistolCount = updatePistolCount;
+	p->weaponAnimation = weaponAnimation;
+	p->weaponChangeTimer = weaponChangeTimer;
+	p->isShooting = isShooting;
+	p->isChangingWeapon = isChangingWeapon;
+	p->pendingAutoSwitch = pendingAutoSwitch;
+	p->isRunning = isRunning;
+	p->isMoving = isMoving;
+	p->firedRocket = g_firedRocketThisFrame;
+	p->health = currentHealth;
+	p->armorType = armorType;
+	p->armour = currentArmour;
+	p->damage = g_lastEnemyDamage;
+	p->pad = playerPad;
+	p->pressed = playerPressed;
+}
+
+static void playerLoad(const PlayerSim *p) {
+	fPlayerX = p->x;
+	fPlayerY = p->y;
+	fPlayerAng = p->ang;
+	copymem((u8*)weapons, (const u8*)p->weapons, sizeof(weapons));
+	currentWeapon = p->currentWeapon;
+	nextWeapon = p->nextWeapon;
+	updatePistolCount = p->updatePistolCount;
+	weaponAnimation = p->weaponAnimation;
+	weaponChangeTimer = p->weaponChangeTimer;
+	isShooting = p->isShooting;
+	isChangingWeapon = p->isChangingWeapon;
+	pendingAutoSwitch = p->pendingAutoSwitch;
+	isRunning = p->isRunning;
+	isMoving = p->isMoving;
+	g_firedRocketThisFrame = p->firedRocket;
+	currentHealth = p->health;
+	armorType = p->armorType;
+	currentArmour = p->armour;
+	g_lastEnemyDamage = p->damage;
+	playerPad = p->pad;
+	playerPressed = p->pressed;
+}
+
+static void playerSwap(void) {
+	PlayerSim t;
+	playerSave(&t);
+	playerLoad(&otherSim);
+	copymem((u8*)&otherSim, (const u8*)&t, sizeof(PlayerSim));
+	simLocal = !simLocal;
+}
+
+/* Run a player part for both players in lockstep, the HOST first on
+ * both consoles, and return its result for this console's player. */
+static u8 forEachPlayer(u8 (*part)(void)) {
+	u8 first, second;
+	if (!g_lockstep) return part();
+	if (!g_isHost) playerSwap();   /* HOST into the globals */
+	first = part();
+	playerSwap();
+	second = part();
+	if (g_isHost) playerSwap();    /* back to this console's player */
+	return g_isHost ? first : second;
+}
+
+/* A sound of the player being simulated: the other player's come from
+ * where it stands, like an enemy's */
+static void playerSFX(u8 soundId) {
+	s16 dx, dy;
+	u16 dist;
+	u8 sdist;
+	if (simLocal) {
+		playPlayerSFX(soundId);
+		return;
+	}
+	dx = (s16)fPlayerX - (s16)otherSim.x;
+	dy = (s16)fPlayerY - (s16)otherSim.y;
+	dist = fix_dist(dx, dy);
+	sdist = (u8)(dist > 4080 ? 255 : dist >> 4);
+	if (sdist == 0) sdist = 1;
+	playEnemySFX(soundId, sdist);
+}
+
+/* The face's own random numbers (8-bit LCG): it is cosmetic and runs
+ * differently on the two consoles of a lockstep game, so it must not
+ * draw from the game stream (rnd8) */
+static u8 faceRndState = 1;
+static u8 faceRnd(void) {
+	faceRndState = (u8)(faceRndState * 109 + 89);
+	return faceRndState ^ (faceRndState >> 4);
+}
+
 /*
  * Smart weapon switching: priority shotgun > pistol > fists.
  * findBestWeapon: find best weapon with ammo (priority order: 3,2,1)
@@ -172,13 +290,15 @@ static u8 findBestWeapon(void) {
 static void switchToWeapon(u8 newWeapon) {
 	if (newWeapon == currentWeapon) return;
 	currentWeapon = newWeapon;
-	drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
-	drawWeaponSlotNumbers(weapons[W_PISTOL].hasWeapon,
-	                     weapons[W_SHOTGUN].hasWeapon,
-	                     weapons[W_ROCKET].hasWeapon,
-	                     weapons[W_CHAINGUN].hasWeapon,
-	                     currentWeapon);
-	highlightWeaponHUD(currentWeapon);
+	if (simLocal) {
+		drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
+		drawWeaponSlotNumbers(weapons[W_PISTOL].hasWeapon,
+		                     weapons[W_SHOTGUN].hasWeapon,
+		                     weapons[W_ROCKET].hasWeapon,
+		                     weapons[W_CHAINGUN].hasWeapon,
+		                     currentWeapon);
+		highlightWeaponHUD(currentWeapon);
+	}
 	weaponAnimation = 0;
 	updatePistolCount = 0;
 	weaponChangeTimer = 0;
@@ -217,6 +337,37 @@ static void autoSwitchOnEmpty(void) {
 /* Set to 4 (or 2, 3, etc.) to start at that level for debugging. Use 1 for normal play. */
 #define START_LEVEL 1
 
+/* Catch-up limit: draw at least every SIM_MAX_SKIP+1 simulation ticks */
+#define SIM_MAX_SKIP 2
+
+/* Player-to-enemy line of sight for sprite selection (render only, the AI
+ * does its own checks). An entry is used for LOS_MAX_AGE ticks. The idle
+ * job re-checks entries in the frame wait; the sprite selection only does
+ * a (Bresenham) check itself for entries that went stale anyway. */
+#define LOS_MAX_AGE 4
+static bool losCache[MAX_ENEMIES];
+static u16 losStamp[MAX_ENEMIES];   /* g_levelFrames of the last check */
+static u8 losJobNext = 0;
+
+static void losCheck(u8 ei) {
+	losCache[ei] = hasLineOfSight(fPlayerX, fPlayerY, g_enemies[ei].x, g_enemies[ei].y);
+	losStamp[ei] = g_levelFrames;
+}
+
+#define LOS_STALE(ei, age) ((u16)(g_levelFrames - losStamp[ei]) >= (age))
+
+/* Idle job: one enemy per chunk, any entry not checked this tick */
+static bool losIdleJob(void) {
+	while (losJobNext < MAX_ENEMIES) {
+		u8 ei = losJobNext++;
+		if (g_enemies[ei].active && LOS_STALE(ei, 1)) {
+			losCheck(ei);
+			return true;
+		}
+	}
+	return false;
+}
+
 u8 g_startLevel = START_LEVEL;  /* set by multiplayer menu, or default for single player */
 u8 currentLevel = 1;
 
@@ -313,113 +464,13 @@ static void restoreGameDisplay(u8 doomface, u8 weapon) {
 		loadPistolSprites();
 }
 
-/* Load a level: copy map, place enemies/pickups, register doors/switches, set spawn.
- * Call at game start and on each level transition. */
+/* Load a level: map, enemies/pickups, doors/switches and secrets from its
+ * blob (level.h), spawn. Call at game start and on each level transition. */
 void loadLevel(u8 levelNum) {
 	currentLevel = levelNum;
 	g_levelComplete = 0;
 
-	if (levelNum == 1) {
-		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)e1m1_map + row * 32, 32); }
-		{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
-		{ u16 row; for (row = 0; row < 32; row++) { u16 c; for (c = 32; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }
-		fPlayerX = E1M1_SPAWN_X;
-		fPlayerY = E1M1_SPAWN_Y;
-		fPlayerAng = 512;  /* face south */
-		initEnemies();
-		initPickups();
-		initDoors();
-		registerDoor(15, 19);  /* center passage */
-		registerDoor(5, 11);   /* armor room entrance */
-		registerSwitch(27, 3, SW_EXIT, 0);   /* exit switch */
-		registerSwitch(18, 10, SW_DOOR, 1);  /* opens armor room door */
-	} else if (levelNum == 2) {
-		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)e1m2_map + row * 32, 32); }
-		{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
-		{ u16 row; for (row = 0; row < 32; row++) { u16 c; for (c = 32; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }
-		fPlayerX = E1M2_SPAWN_X;
-		fPlayerY = E1M2_SPAWN_Y;
-		fPlayerAng = 512;  /* face south */
-		initEnemiesE1M2();
-		initPickupsE1M2();
-		initDoors();
-		registerDoor(15, 13);  /* center passage */
-		registerDoor(8, 16);   /* weapon closet (opened by switch) */
-		registerDoor(5, 19);   /* west barracks */
-		registerDoor(26, 19);  /* east armory */
-		registerSwitch(28, 3, SW_EXIT, 0);   /* exit switch */
-		registerSwitch(4, 4, SW_DOOR, 1);    /* opens weapon closet door */
-	} else if (levelNum == 3) {
-		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)e1m3_map + row * 32, 32); }
-		{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
-		{ u16 row; for (row = 0; row < 32; row++) { u16 c; for (c = 32; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }
-		fPlayerX = E1M3_SPAWN_X;
-		fPlayerY = E1M3_SPAWN_Y;
-		fPlayerAng = 0;  /* face north */
-		initEnemiesE1M3();
-		initPickupsE1M3();
-		initDoors();
-		registerDoor(15, 21);  /* center passage south corridor to central area */
-		registerDoor(5, 14);   /* west wing entrance */
-		registerDoor(26, 14);  /* east wing entrance */
-		registerDoor(15, 7);   /* north gate arena to command center */
-		registerDoor(4, 7);    /* hidden armory entrance (switch-opened) */
-		registerDoor(28, 5);   /* locked tech room (switch-opened) */
-		registerSwitch(15, 3, SW_EXIT, 0);   /* exit switch */
-		registerSwitch(10, 10, SW_DOOR, 4);  /* opens hidden armory door */
-		registerSwitch(20, 10, SW_DOOR, 5);  /* opens locked tech room door */
-	} else if (levelNum == 4) {
-		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)e1m4_map + row * 32, 32); }
-    	{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
-    	{ u16 row; for (row = 0; row < 32; row++) { u16 c; for (c = 32; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }
-    	/* E1M4: use SPAWN 1 only (tile 30,30). E1M4_SPAWN2_X/Y (30,27) is unused. */
-    	fPlayerX = E1M4_SPAWN_X;
-    	fPlayerY = E1M4_SPAWN_Y;
-    	fPlayerAng = 768;
-    	initEnemiesE1M4();
-    	initPickupsE1M4();
-    	initDoors();
-    	registerDoor(13, 1);
-    	registerDoor(25, 10);   /* was 26,10: door tile is at (25,10) in map */
-    	registerDoor(13, 11);
-    	registerDoor(22, 16);
-    	registerDoor(14, 17);
-    	registerDoor(28, 18);   /* was 29,18: door tile is at (28,18) in map */
-    	registerDoor(16, 19);
-    	registerDoor(23, 19);
-    	registerDoor(6, 21);
-    	registerDoor(17, 21);
-    	registerDoor(3, 23);
-    	registerDoor(18, 24);
-    	registerDoor(13, 25);
-    	registerDoor(15, 25);
-    	registerDoor(16, 25);
-    	registerDoor(23, 26);
-    	registerDoor(27, 28);   /* door index 16: spawn room exit (27,28) in map */
-    	registerDoor(17, 29);
-    	registerSwitch(29, 0, SW_DOOR, 5);
-    	registerSwitch(0, 21, SW_EXIT, 0);
-	} else if (levelNum == 5 || levelNum == 6) {
-     		/* Placeholder: reuse E1M3 until e1m4/e1m5/e1m6 maps and inits are added */
-     		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)e1m3_map + row * 32, 32); }
-     		{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
-     		{ u16 row; for (row = 0; row < 32; row++) { u16 c; for (c = 32; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }
-     		fPlayerX = E1M3_SPAWN_X;
-     		fPlayerY = E1M3_SPAWN_Y;
-     		fPlayerAng = 0;
-     		initEnemiesE1M3();
-     		initPickupsE1M3();
-     		initDoors();
-     		registerDoor(15, 21);
-     		registerDoor(5, 14);
-     		registerDoor(26, 14);
-     		registerDoor(15, 7);
-     		registerDoor(4, 7);
-     		registerDoor(28, 5);
-     		registerSwitch(15, 3, SW_EXIT, 0);
-     		registerSwitch(10, 10, SW_DOOR, 4);
-     		registerSwitch(20, 10, SW_DOOR, 5);
-     	} else if (levelNum == 7) {
+	if (levelNum == 7) {
 		/* DM Arena */
 		{ u16 row; for (row = 0; row < 32; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)dm1_map + row * 32, 32); }
 		{ u16 i; for (i = 32 * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }
@@ -435,9 +486,9 @@ void loadLevel(u8 levelNum) {
 			fPlayerAng = dm_spawnA[1];
 		}
 		/* No enemies in DM */
-		{ u8 ei; for (ei = 0; ei < MAX_ENEMIES; ei++) g_enemies[ei].active = false; }
+		initEnemies();
 		/* DM pickups: weapons and ammo */
-		{ u8 pi; for (pi = 0; pi < MAX_PICKUPS; pi++) { g_pickups[pi].active = false; g_pickups[pi].respawnTimer = 0; } }
+		initPickups();
 		spawnPickup(PICKUP_WEAPON_SHOTGUN,  12 * 256 + 128, 16 * 256 + 128);
 		spawnPickup(PICKUP_WEAPON_CHAINGUN, 20 * 256 + 128, 16 * 256 + 128);
 		spawnPickup(PICKUP_WEAPON_ROCKET,   16 * 256 + 128, 12 * 256 + 128);
@@ -452,6 +503,15 @@ void loadLevel(u8 levelNum) {
 		registerDoor(24, 14);
 		registerDoor(16, 6);
 		registerDoor(16, 26);
+		g_numLevelSpawns = 0;
+		g_totalSecrets = 0;
+		g_sightTable = 0;
+	} else {
+		if (levelNum < 1 || levelNum > NUM_LEVELS || !loadLevelBlob(g_levels[levelNum - 1]))
+			loadLevelBlob(g_levels[0]);
+		fPlayerX = g_levelSpawns[0].x;
+		fPlayerY = g_levelSpawns[0].y;
+		fPlayerAng = g_levelSpawns[0].angle;
 	}
 
 	/* Set player 2 spawn points for multiplayer */
@@ -461,23 +521,11 @@ void loadLevel(u8 levelNum) {
 			g_p2SpawnX = g_isHost ? dm_spawnX[1] : dm_spawnX[0];
 			g_p2SpawnY = g_isHost ? dm_spawnY[1] : dm_spawnY[0];
 			g_p2SpawnAngle = g_isHost ? dm_spawnA[1] : dm_spawnA[0];
-		} else if (levelNum == 1) {
-			/* E1M1: P2 near P1 start */
-			g_p2SpawnX = 17 * 256 + 128;
-			g_p2SpawnY = 28 * 256 + 128;
-			g_p2SpawnAngle = 512;
-		} else if (levelNum == 2) {
-			g_p2SpawnX = 17 * 256 + 128;
-			g_p2SpawnY = 28 * 256 + 128;
-			g_p2SpawnAngle = 512;
-		} else if (levelNum == 3) {
-			g_p2SpawnX = 17 * 256 + 128;
-			g_p2SpawnY = 28 * 256 + 128;
-			g_p2SpawnAngle = 0;
-		} else if (levelNum == 4) {
-			g_p2SpawnX = 28 * 256 + 128;
-			g_p2SpawnY = 30 * 256 + 128;
-			g_p2SpawnAngle = 768;
+		} else if (g_numLevelSpawns > 1) {
+			/* The level's Spawn 2 */
+			g_p2SpawnX = g_levelSpawns[1].x;
+			g_p2SpawnY = g_levelSpawns[1].y;
+			g_p2SpawnAngle = g_levelSpawns[1].angle;
 		} else {
 			/* Default: same position offset */
 			g_p2SpawnX = fPlayerX + 256;
@@ -485,9 +533,8 @@ void loadLevel(u8 levelNum) {
 			g_p2SpawnAngle = fPlayerAng;
 		}
 		/* Initialize player 2 at spawn */
-		g_player2X = g_p2SpawnX;
-		g_player2Y = g_p2SpawnY;
-		g_player2Angle = g_p2SpawnAngle;
+		snapReset(g_p2SpawnX, g_p2SpawnY, g_p2SpawnAngle);
+		syncReset(levelNum);
 		g_player2Health = 100;
 		g_player2Alive = true;
 		g_p2AnimFrame = 0;
@@ -499,36 +546,16 @@ void loadLevel(u8 levelNum) {
 	initParticles();
 	initProjectiles();
 
+	/* Queued idle jobs (losIdleJob) belong to the old level: drop them
+	 * before the frame wait can run one against the new enemy list */
+	idleClear();
+	losJobNext = MAX_ENEMIES;
+
 	/* Reset level timer and counters for stats screen */
 	g_levelFrames = 0;
 	g_enemiesKilled = 0;
 	g_totalEnemies = 0;
-	g_secretsFound = 0;
-	g_totalSecrets = 0;
-	{
-		u8 si;
-		for (si = 0; si < MAX_SECRETS; si++) {
-			g_secrets[si].tx = 0;
-			g_secrets[si].ty = 0;
-			g_secrets[si].found = false;
-		}
-	}
-
-	/* Define secrets per level */
-	if (levelNum == 1) {
-		/* E1M1: armor room (4,9) is a secret area */
-		g_secrets[0].tx = 4;  g_secrets[0].ty = 9;
-		g_totalSecrets = 1;
-	} else if (levelNum == 2) {
-		/* E1M2: weapon closet (3,16) is a secret */
-		g_secrets[0].tx = 3;  g_secrets[0].ty = 16;
-		g_totalSecrets = 1;
-	} else if (levelNum == 3) {
-		/* E1M3: hidden armory (2,4) and locked tech room (29,3) */
-		g_secrets[0].tx = 2;  g_secrets[0].ty = 4;
-		g_secrets[1].tx = 29; g_secrets[1].ty = 3;
-		g_totalSecrets = 2;
-	}
+	g_secretsFound = 0;  /* the level's g_secrets come with its blob */
 	{
 		u8 ei;
 		for (ei = 0; ei < MAX_ENEMIES; ei++) {
@@ -549,6 +576,370 @@ void loadLevel(u8 levelNum) {
 	}
 }
 
+/* ---- Player parts ----
+ * One step of the player being simulated, on its input (playerPad,
+ * playerPressed), run through forEachPlayer. */
+
+/* Movement, turning, weapon cycling and firing */
+static u8 playerControl(void) {
+	isMoving = false;
+	g_firedRocketThisFrame = false;  /* reset per frame */
+
+	if (playerPad & K_LU) {// Left Pad, Up
+		isMoving = true;
+		fPlayerMoveForward(&fPlayerX, &fPlayerY, fPlayerAng, (isRunning?movespeed*2:movespeed));
+		//playerMoveForward(3);
+	} else if (playerPad & K_LD) {// Left Pad, Down
+		isMoving = true;
+		fPlayerMoveForward(&fPlayerX, &fPlayerY, fPlayerAng, -(isRunning?movespeed*2:movespeed));
+		//playerMoveForward(-3);
+	}
+	if (playerPad & K_LL) {// Left Pad, Left'
+		isMoving = true;
+		fPlayerStrafe(&fPlayerX, &fPlayerY, fPlayerAng, -(isRunning?movespeed*2:movespeed));
+	} else if (playerPad & K_LR) {// Left Pad, Right
+		isMoving = true;
+		fPlayerStrafe(&fPlayerX, &fPlayerY, fPlayerAng, (isRunning?movespeed*2:movespeed));
+	}
+	if (simLocal) {
+		if  (isMoving) {
+			swayWeapon();
+		} else {
+			walkSwayIndex = 0;
+			weaponSwayIndex = 0;
+			//WA[31].gy = -8;
+		}
+	}
+
+	if(playerPad & K_RL) {// Right Pad, Left
+		fPlayerAng -= turnRate;
+		if (fPlayerAng < 0)
+			fPlayerAng = 1023;
+	} else if(playerPad & K_RR) {// Right Pad, Right
+		fPlayerAng += turnRate;
+		if (fPlayerAng > 1023)
+			fPlayerAng = 0;
+
+	}
+	isRunning = playerPad & K_LT;
+
+	if (playerPad & K_A && isShooting == false) {
+		cycleWeapons();
+	}
+
+	if (playerPad & (K_B | K_RT) && updatePistolCount == 0 && weaponAnimation == 0 && isChangingWeapon == false) {
+		if (weapons[currentWeapon].requiresAmmo) {
+			if (weapons[currentWeapon].ammo > 0) {
+			weaponAnimation = 1; // shoot
+			weapons[currentWeapon].ammo--;
+			/* Sync shared bullet ammo between pistol and chaingun */
+			if (currentWeapon == W_PISTOL || currentWeapon == W_CHAINGUN) {
+				weapons[W_PISTOL].ammo = weapons[currentWeapon].ammo;
+				weapons[W_CHAINGUN].ammo = weapons[currentWeapon].ammo;
+			}
+			isShooting = true;
+			/* Trigger PCM weapon fire sound */
+			if (currentWeapon == W_ROCKET) {
+				playerSFX(SFX_ROCKET_LAUNCH);
+			} else if (currentWeapon == W_SHOTGUN)
+				playerSFX(SFX_SHOTGUN);
+			else
+				playerSFX(SFX_PISTOL); /* pistol + chaingun share SFX */
+			if (simLocal)
+				drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
+			if (currentWeapon == W_ROCKET) {
+				/* Rocket launcher: spawn projectile, no hitscan */
+				spawnRocket(fPlayerX, fPlayerY, fPlayerAng);
+				g_firedRocketThisFrame = true;
+			} else {
+				u8 hitIdx = playerShoot(fPlayerX, fPlayerY, fPlayerAng, currentWeapon);
+					if (ENEMY_JUST_KILLED(hitIdx) && simLocal) {
+						killFaceTimer = 30; /* show evil grin for ~1.5s */
+					}
+					if (hitIdx == 255) {
+						/* Bullet hit wall -- cast ray to find exact wall hit position */
+						s16 wallHitX, wallHitY;
+						CastRayHitPos(fPlayerX, fPlayerY, (u16)fPlayerAng & 1023, &wallHitX, &wallHitY);
+						if (currentWeapon == W_SHOTGUN) {
+							spawnShotgunGroup(wallHitX, wallHitY);
+						} else {
+							spawnPuff(wallHitX, wallHitY);
+						}
+					}
+				}
+			/* Defer auto-switch until shoot animation finishes */
+			if (weapons[currentWeapon].ammo == 0) pendingAutoSwitch = true;
+			} else {
+				/* No ammo left -- smart switch to best available */
+				autoSwitchOnEmpty();
+			}
+	} else {
+	 	weaponAnimation = 1; // punch!
+		isShooting = true;
+		playerSFX(SFX_PUNCH);
+		/* Try to hit an enemy first */
+		{
+			u8 hitIdx = playerShoot(fPlayerX, fPlayerY, fPlayerAng, currentWeapon);
+			if (ENEMY_JUST_KILLED(hitIdx) && simLocal) {
+				killFaceTimer = 30;
+			}
+			if (hitIdx == 255) {
+				/* No enemy hit -- check wall for puff within melee range */
+				s16 wallHitX, wallHitY;
+				s16 dx, dy;
+				s32 dist2;
+				CastRayHitPos(fPlayerX, fPlayerY, (u16)fPlayerAng & 1023, &wallHitX, &wallHitY);
+				dx = wallHitX - (s16)fPlayerX;
+				dy = wallHitY - (s16)fPlayerY;
+				dist2 = (s32)dx * dx + (s32)dy * dy;
+				if (dist2 < (s32)80 * 80) {
+					spawnPuff(wallHitX, wallHitY);
+				}
+			}
+		}
+	}
+	}
+	return 0;
+}
+
+/* Pickup collisions. The HUD and the weapon sprites are the caller's
+ * (PICKED_* tells what changed); the other player's pickups do not
+ * flash this screen. */
+#define PICKED_ITEM     1
+#define PICKED_WEAPON   2
+static u8 playerPickups(void) {
+	u8 picked = 0;
+	u8 pickupAmmo = weapons[2].ammo;  /* pistol bullets */
+	u8 shellAmmo = weapons[3].ammo;   /* shotgun shells */
+	u8 flashTimer = g_flashTimer;
+	u8 flashType = g_flashType;
+
+	if (updatePickups(fPlayerX, fPlayerY, &pickupAmmo, &currentHealth,
+	                  &currentArmour, &armorType, &shellAmmo)) {
+		weapons[2].ammo = pickupAmmo;
+		weapons[5].ammo = pickupAmmo; /* chaingun shares bullet ammo with pistol */
+		weapons[3].ammo = shellAmmo;
+		picked |= PICKED_ITEM;
+	}
+	/* Weapon pickups */
+	if (g_pickedUpWeapon > 0) {
+		weapons[g_pickedUpWeapon].hasWeapon = true;
+		if (g_pickedUpWeapon == W_ROCKET)
+			weapons[g_pickedUpWeapon].ammo = 2;  /* start with 2 rockets */
+		else if (g_pickedUpWeapon == W_CHAINGUN) {
+			/* Chaingun shares bullets with pistol; add 20 to shared pool */
+			u8 bullets = weapons[W_PISTOL].ammo + 20;
+			if (bullets > 200) bullets = 200;
+			weapons[W_PISTOL].ammo = bullets;
+			weapons[W_CHAINGUN].ammo = bullets;
+		} else
+			weapons[g_pickedUpWeapon].ammo = 8;  /* start with 8 shells */
+		currentWeapon = g_pickedUpWeapon;
+		nextWeapon = g_pickedUpWeapon;
+		weaponAnimation = 0;
+		updatePistolCount = 0;
+		isShooting = false;
+		playerSFX(SFX_SHOTGUN_COCK);
+		g_pickedUpWeapon = 0;
+		picked |= PICKED_WEAPON;
+	}
+	if (!simLocal) {
+		g_flashTimer = flashTimer;
+		g_flashType = flashType;
+	}
+	return picked;
+}
+
+/* Secret sectors: the first player to enter one finds it */
+static u8 playerSecrets(void) {
+	u8 playerTX = (u8)(fPlayerX >> 8);
+	u8 playerTY = (u8)(fPlayerY >> 8);
+	u8 si;
+	for (si = 0; si < g_totalSecrets; si++) {
+		if (!g_secrets[si].found &&
+		    playerTX == g_secrets[si].tx &&
+		    playerTY == g_secrets[si].ty) {
+			g_secrets[si].found = true;
+			g_secretsFound++;
+		}
+	}
+	return 0;
+}
+
+/* Door/switch activation (Select). Uses the center ray of this frame's
+ * TraceFrame; lockstep traces it for each player instead, since both
+ * consoles need it on every frame, and so does a pass that skipped
+ * drawing (a recorded demo's press must act the same when played back
+ * drawing every pass). L+R+Select is the profiler overlay. */
+static u8 playerUse(void) {
+	if (!(playerPressed & K_SEL) || (playerPad & (K_LT | K_RT)) == (K_LT | K_RT))
+		return 0;
+	if (g_lockstep || !frameTraced)
+		TraceCenter(fPlayerX, fPlayerY, fPlayerAng);
+	return playerActivate(fPlayerX, fPlayerY, fPlayerAng, currentLevel);
+}
+
+/* Enemy damage of this frame: armor, health, pain sound. Returns
+ * HURT (| HURT_SEVERE past 20 points) when there was any. */
+#define HURT            1
+#define HURT_SEVERE     2
+static u8 playerDamage(void) {
+	u8 dmg;
+	if (g_lastEnemyDamage == 0) return 0;
+	dmg = g_lastEnemyDamage;
+	g_lastEnemyDamage = 0;
+	/* Doom-style armor absorption */
+	if (currentArmour > 0 && armorType > 0) {
+		u8 armorAbsorb;
+		if (armorType >= 2)
+			armorAbsorb = dmg >> 1;     /* blue: absorb 1/2 */
+		else
+			armorAbsorb = (u8)(((u16)dmg * 171) >> 9); /* green: absorb 1/3 (exact for u8), Doom P_DamageMobj */
+		if (armorAbsorb > (u8)currentArmour) armorAbsorb = (u8)currentArmour;
+		currentArmour -= armorAbsorb;
+		dmg -= armorAbsorb;
+		if (currentArmour == 0) armorType = 0;
+	}
+
+	/* Apply damage to player health (HUD redrawn by per-frame dirty check) */
+	if (dmg >= currentHealth)
+		currentHealth = 0;
+	else
+		currentHealth -= dmg;
+
+	/* Player pain/death sound */
+	if (currentHealth == 0)
+		playerSFX(SFX_PLAYER_DEATH);
+	else
+		playerSFX(SFX_PLAYER_PAIN);
+
+	return dmg > 20 ? HURT | HURT_SEVERE : HURT;
+}
+
+/* Attack animation, and the deferred switch once it ends */
+static u8 playerWeaponAnim(void) {
+	if (weaponAnimation >= 1) {
+		if (weaponAnimation >= 2) { // punch animation
+			isShooting = true;
+		}
+		updatePistolCount++;
+		/* Chaingun: every frame (fast). Rocket: every 3 frames (slow). Others: every 2. */
+		if (updatePistolCount > (currentWeapon == W_CHAINGUN ? 0 : (currentWeapon == W_ROCKET ? 2 : 1))) {
+			weaponAnimation++;
+			if (weaponAnimation >= weapons[currentWeapon].attackFrames) {
+				isShooting = false;
+				weaponAnimation = 0;
+				/* Switch weapon after full shoot animation if ammo ran out */
+				if (pendingAutoSwitch) {
+					pendingAutoSwitch = false;
+					autoSwitchOnEmpty();
+				}
+			}
+			updatePistolCount = 0;
+		}
+
+	}
+	return 0;
+}
+
+/* Weapon tiles into char memory, for the weapon drawWeapon() draws */
+static void loadWeaponSprites(u8 weapon) {
+	if (weapon == W_FISTS)
+		loadFistSprites();
+	else if (weapon == W_SHOTGUN)
+		loadShotgunSprites();
+	else if (weapon == W_ROCKET)
+		loadRocketLauncherSprites();
+	else if (weapon == W_CHAINGUN)
+		loadChaingunSprites();
+	else
+		loadPistolSprites();
+}
+
+/* Weapon change: lower, swap at half time, raise */
+static u8 playerWeaponChange(void) {
+	if (isChangingWeapon) {
+		if (weaponChangeTimer > 10 && nextWeapon != currentWeapon) {
+			nextWeapon = currentWeapon; // switch weapon after half time...
+			/* Now load tiles so they match the weapon drawWeapon() will use */
+			if (simLocal)
+				loadWeaponSprites(currentWeapon);
+		}
+		if (weaponChangeTimer >= weaponChangeTime) {
+			weaponChangeTimer = 0;
+			isChangingWeapon = false;
+		}
+		weaponChangeTimer++;
+	}
+	return 0;
+}
+
+/* Lockstep: the HOST starts on the level spawn, the JOIN on the player
+ * 2 spawn, on both consoles. Call after loadLevel. */
+static void placeLockPlayers(void) {
+	otherSim.x = g_p2SpawnX;
+	otherSim.y = g_p2SpawnY;
+	otherSim.ang = (s16)g_p2SpawnAngle;
+	if (!g_isHost) {
+		u16 x = fPlayerX, y = fPlayerY;
+		s16 ang = fPlayerAng;
+		fPlayerX = otherSim.x;
+		fPlayerY = otherSim.y;
+		fPlayerAng = otherSim.ang;
+		otherSim.x = x;
+		otherSim.y = y;
+		otherSim.ang = ang;
+	}
+}
+
+/* Lockstep: CRC-8 of what the two consoles must agree on, the players
+ * in HOST, JOIN order */
+static u8 lockHash(void) {
+	PlayerSim self;
+	const PlayerSim *pl;
+	u8 b[8];
+	u8 crc = 0;
+	u8 i;
+
+	playerSave(&self);
+	for (i = 0; i < 2; i++) {
+		pl = ((i == 0) == g_isHost) ? &self : &otherSim;
+		b[0] = (u8)(pl->x >> 8);
+		b[1] = (u8)pl->x;
+		b[2] = (u8)(pl->y >> 8);
+		b[3] = (u8)pl->y;
+		b[4] = (u8)((u16)pl->ang >> 8);
+		b[5] = (u8)pl->ang;
+		b[6] = pl->health;
+		b[7] = pl->weapons[pl->currentWeapon].ammo;
+		crc = linkCrc8(crc, b, 8);
+	}
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		const EnemyState *e = &g_enemies[i];
+		if (!e->active) continue;
+		b[0] = (u8)(e->x >> 8);
+		b[1] = (u8)e->x;
+		b[2] = (u8)(e->y >> 8);
+		b[3] = (u8)e->y;
+		b[4] = e->state;
+		b[5] = e->health;
+		crc = linkCrc8(crc, b, 6);
+	}
+	for (i = 0; i < MAX_PROJECTILES; i++) {
+		const Projectile *p = &g_projectiles[i];
+		if (p->state == PROJ_DEAD) continue;
+		b[0] = (u8)(p->x >> 8);
+		b[1] = (u8)p->x;
+		b[2] = (u8)(p->y >> 8);
+		b[3] = (u8)p->y;
+		b[4] = p->state;
+		crc = linkCrc8(crc, b, 5);
+	}
+	b[0] = (u8)(g_rndState >> 8);
+	b[1] = (u8)g_rndState;
+	return linkCrc8(crc, b, 2);
+}
+
 u8 gameLoop()
 {
 	/* fixed0point05 and fixed2point13 are now static const -- no runtime init needed */
@@ -596,6 +987,24 @@ u8 gameLoop()
 
 	WA[17].head = WRLD_END;
 
+	/* Demos and lockstep games start from the new-game loadout: weapons
+	 * carry over between games otherwise. The seed starts the one game
+	 * random stream (rnd8), in lockstep the HOST's on both consoles. */
+	if (g_demoMode != DEMO_OFF || g_lockstep) {
+		copymem((u8*)weapons, (const u8*)weaponsStart, sizeof(weapons));
+		currentWeapon = nextWeapon = W_PISTOL;
+		isChangingWeapon = false;
+		pendingAutoSwitch = false;
+		weaponChangeTimer = 0;
+		weaponAnimation = 0;
+		updatePistolCount = 0;
+		isShooting = false;
+		weaponSwayIndex = 0;
+		walkSwayIndex = 0;
+	}
+	rndSeed(g_lockstep ? g_lockSeed : demoSeed());
+	g_vipSync = (g_demoMode != DEMO_PLAYBACK);  /* timedemo: no VIP wait either */
+
 	loadDoomGfxToMem();
 	loadLevel(g_startLevel);    /* g_startLevel: set by multiplayer menu or START_LEVEL default */
 	loadParticleTiles();
@@ -607,17 +1016,29 @@ u8 gameLoop()
 	u8 updateDoomfaceCount = 0;
 	u8 lookDir = 1;            /* 0=left, 1=center, 2=right */
 	u8 ouchTimer = 0;          /* >0 = show ouch face */
-	u8 killFaceTimer = 0;      /* >0 = show evil grin */
+	killFaceTimer = 0;
 
 	u16 ammo = 50;
 	u8 currentAmmoType = 1;
-	u8 currentHealth = 100;
-	u16 currentArmour = 0;
-	u8 armorType = 0;  /* 0=none, 1=green (1/3 absorb), 2=blue (1/2 absorb) */
+	currentHealth = 100;
+	currentArmour = 0;
+	armorType = 0;
+	g_firedRocketThisFrame = false;
 
 	/* DM death/respawn: controls stop working for 2s, then respawn at random point */
 	u8 deathCooldown = 0;  /* >0 = dead, counts down each frame (40 = 2s at 20fps) */
-	bool g_firedRocketThisFrame = false;  /* set when local player fires a rocket */
+
+	/* Lockstep: the other player starts out as this one, on its spawn */
+	simLocal = true;
+	playerPad = 0;
+	playerPressed = 0;
+	if (g_lockstep) {
+		g_lastEnemyDamage = 0;
+		g_pickedUpWeapon = 0;
+		playerSave(&otherSim);
+		placeLockPlayers();
+		lockStart();
+	}
 
 	/* HUD dirty tracking: only redraw when value changed (avoids redundant BGMap/copymem) */
 	u16 lastHealth = 0xFFFF;
@@ -723,11 +1144,14 @@ u8 gameLoop()
 	u8 g_damageRumbleTimer = 0;
 	u8 g_secretRumbleTimer = 0;
 	u16 frameCounter = 0;
+	u8 simSkipped = 0;     /* passes in a row that skipped drawing */
+	bool simRender = true; /* this pass draws (not catching up) */
+
+	simResync();  /* level load took time: do not start out behind */
 
 	/* mp_init() already called in main.c before title screen */
 	while(1) {
 		//drawDoomFace(LAYER_UI, 44, 0, doomface);
-		isMoving = false;
 	// clear 1 (weapon layer) and 2 (enemy layer) each frame...
 		/*for (worldCount = 1; worldCount < 7; worldCount++) {
 			setmem((void*)BGMap(worldCount), 0x0000, 8192);
@@ -748,18 +1172,20 @@ u8 gameLoop()
 		//setmem((void*)BGMap(LAYER_BULLET), 0, 8192);
 		//setmem((void*)BGMap(UI_LAYER), 0, 8192);
 
-		keyInputs = vbReadPad();
+		keyInputs = demoInput(vbReadPad());
+		if (demoFinished()) {
+			demoStop();
+			return 0;
+		}
 		keyPressed = keyInputs & ~prevKeyInputs; /* newly pressed this frame */
 
-		g_firedRocketThisFrame = false;  /* reset per frame */
-
 		/* === DM DEATH COOLDOWN === */
 		if (deathCooldown > 0) {
 			deathCooldown--;
 			if (deathCooldown == 0 && g_isMultiplayer && g_gameMode == GAMEMODE_DEATHMATCH) {
 				/* Respawn at random DM spawn point */
 				u8 spIdx;
-				spIdx = (u8)(rand() & 3);  /* 0-3 */
+				spIdx = (u8)(rnd8() & 3);  /* 0-3 */
 				fPlayerX = dm_spawnX[spIdx];
 				fPlayerY = dm_spawnY[spIdx];
 				fPlayerAng = dm_spawnA[spIdx];
@@ -779,142 +1205,28 @@ u8 gameLoop()
 			deathCooldown = 40;  /* 2 seconds at 20fps */
 		}
 
-		// handle input last...
-		if (keyInputs & K_LU) {// Left Pad, Up
-			isMoving = true;
-			fPlayerMoveForward(&fPlayerX, &fPlayerY, fPlayerAng, (isRunning?movespeed*2:movespeed));
-			//playerMoveForward(3);
-		} else if (keyInputs & K_LD) {// Left Pad, Down
-			isMoving = true;
-			fPlayerMoveForward(&fPlayerX, &fPlayerY, fPlayerAng, -(isRunning?movespeed*2:movespeed));
-			//playerMoveForward(-3);
-		}
-		if (keyInputs & K_LL) {// Left Pad, Left'
-			isMoving = true;
-			fPlayerStrafe(&fPlayerX, &fPlayerY, fPlayerAng, -(isRunning?movespeed*2:movespeed));
-		} else if (keyInputs & K_LR) {// Left Pad, Right
-			isMoving = true;
-			fPlayerStrafe(&fPlayerX, &fPlayerY, fPlayerAng, (isRunning?movespeed*2:movespeed));
-		}
-		if  (isMoving) {
-			swayWeapon();
+		/* Input of the player parts: the pad, or in lockstep the pads of
+		 * both players for this frame, read LOCK_DELAY frames ago */
+		if (g_lockstep && lockInput(keyInputs)) {
+			u16 pad = g_lockPad[g_isHost ? 0 : 1];
+			playerPressed = pad & ~playerPad;
+			playerPad = pad;
+			pad = g_lockPad[g_isHost ? 1 : 0];
+			otherSim.pressed = pad & ~otherSim.pad;
+			otherSim.pad = pad;
 		} else {
-			walkSwayIndex = 0;
-			weaponSwayIndex = 0;
-			//WA[31].gy = -8;
+			playerPad = keyInputs;
+			playerPressed = keyPressed;
 		}
+
+		/* View pitch: this console's player only, straight off the pad */
 		if(keyInputs & K_RU) {// Right Pad, Up
-			jawFixedPlayer(-fixed0point05);
+			jawPlayer(-fixed0point05);
 		} else if(keyInputs & K_RD) {// Right Pad, Down
-			jawFixedPlayer(fixed0point05);
-		}
-
-		if(keyInputs & K_RL) {// Right Pad, Left
-			fPlayerAng -= turnRate;
-			if (fPlayerAng < 0)
-				fPlayerAng = 1023;
-		} else if(keyInputs & K_RR) {// Right Pad, Right
-			fPlayerAng += turnRate;
-			if (fPlayerAng > 1023)
-				fPlayerAng = 0;
-
-		}
-		isRunning = keyInputs & K_LT;
-
-		if (keyInputs & K_A && isShooting == false) {
-			cycleWeapons();
-		}
-
-		if (keyInputs & (K_B | K_RT) && updatePistolCount == 0 && weaponAnimation == 0 && isChangingWeapon == false) {
-			if (weapons[currentWeapon].requiresAmmo) {
-				if (weapons[currentWeapon].ammo > 0) {
-				weaponAnimation = 1; // shoot
-				weapons[currentWeapon].ammo--;
-				/* Sync shared bullet ammo between pistol and chaingun */
-				if (currentWeapon == W_PISTOL || currentWeapon == W_CHAINGUN) {
-					weapons[W_PISTOL].ammo = weapons[currentWeapon].ammo;
-					weapons[W_CHAINGUN].ammo = weapons[currentWeapon].ammo;
-				}
-				isShooting = true;
-				/* Trigger PCM weapon fire sound */
-				if (currentWeapon == W_ROCKET) {
-					playPlayerSFX(SFX_ROCKET_LAUNCH);
-				} else if (currentWeapon == W_SHOTGUN)
-					playPlayerSFX(SFX_SHOTGUN);
-				else
-					playPlayerSFX(SFX_PISTOL); /* pistol + chaingun share SFX */
-				drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
-				if (currentWeapon == W_ROCKET) {
-					/* Rocket launcher: spawn projectile, no hitscan */
-					spawnRocket(fPlayerX, fPlayerY, fPlayerAng);
-					g_firedRocketThisFrame = true;
-				} else {
-					u8 hitIdx = playerShoot(fPlayerX, fPlayerY, fPlayerAng, currentWeapon);
-						if (ENEMY_JUST_KILLED(hitIdx)) {
-							killFaceTimer = 30; /* show evil grin for ~1.5s */
-						}
-						if (hitIdx == 255) {
-							/* Bullet hit wall -- cast ray to find exact wall hit position */
-							s16 wallHitX, wallHitY;
-							CastRayHitPos(fPlayerX, fPlayerY, (u16)fPlayerAng & 1023, &wallHitX, &wallHitY);
-							if (currentWeapon == W_SHOTGUN) {
-								spawnShotgunGroup(wallHitX, wallHitY);
-							} else {
-								spawnPuff(wallHitX, wallHitY);
-							}
-						}
-					}
-				/* Defer auto-switch until shoot animation finishes */
-				if (weapons[currentWeapon].ammo == 0) pendingAutoSwitch = true;
-				} else {
-					/* No ammo left -- smart switch to best available */
-					autoSwitchOnEmpty();
-				}
-		} else {
-		 	weaponAnimation = 1; // punch!
-			isShooting = true;
-			playPlayerSFX(SFX_PUNCH);
-			/* Try to hit an enemy first */
-			{
-				u8 hitIdx = playerShoot(fPlayerX, fPlayerY, fPlayerAng, currentWeapon);
-				if (ENEMY_JUST_KILLED(hitIdx)) {
-					killFaceTimer = 30;
-				}
-				if (hitIdx == 255) {
-					/* No enemy hit -- check wall for puff within melee range */
-					s16 wallHitX, wallHitY;
-					s16 dx, dy;
-					s32 dist2;
-					CastRayHitPos(fPlayerX, fPlayerY, (u16)fPlayerAng & 1023, &wallHitX, &wallHitY);
-					dx = wallHitX - (s16)fPlayerX;
-					dy = wallHitY - (s16)fPlayerY;
-					dist2 = (s32)dx * dx + (s32)dy * dy;
-					if (dist2 < (s32)80 * 80) {
-						spawnPuff(wallHitX, wallHitY);
-					}
-				}
-			}
+			jawPlayer(fixed0point05);
 		}
-			/*
-			if (currentWeapon > 1) {
-				if (ammo > 0) {
-					weaponAnimation = 1; // shoot
-					isShooting = true;
-					ammo--;
-					//drawUpdatedAmmo(ammo, currentAmmoType);
-				}
-				else {
-					cycleWeapons();
-					if (currentWeapon == 1) {
-						currentAmmoType = 0;
-					}
-				}
-			} else {
-				weaponAnimation = 1; // punch
-			}*/
 
-			//drawWeapon(currentWeapon, weaponSwayX, weaponSwayY, weaponAnimation);
-		}
+		forEachPlayer(playerControl);
  		//printString(0, 14, 10, getString(STR_TESTICUS));
  		//printString(0, 34, 10, "hello");
 		//drawDoomGuy(0, 44, 24, doomface);
@@ -922,18 +1234,33 @@ u8 gameLoop()
 
 		//drawDoomStage(0);
 
-
-
-
-		/*if (isFixed) {
-			fixedDrawDoomStage(0);
-		} else {
-			drawDoomStage(0);
-		}*/
 		/* Door/switch activation moved after TraceFrame for fresh center-ray data */
 
-		/* In-game pause: Start button opens options screen */
-		if (keyPressed & K_STA) {
+		/* Profiler overlay: L+R+Select. Hiding it redraws the HUD rows it used. */
+		if ((keyPressed & K_SEL) && (keyInputs & (K_LT | K_RT)) == (K_LT | K_RT)) {
+			keyPressed &= ~K_SEL;
+			profToggleOverlay();
+			if (!g_profOverlay) {
+				drawDoomUI(LAYER_UI, 0, 0);
+				if (g_isMultiplayer && g_gameMode == GAMEMODE_DEATHMATCH)
+					drawFragHUD(g_fragCount);
+				else
+					drawKeyCards(g_hasKeyRed, g_hasKeyYellow, g_hasKeyBlue);
+				drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
+				drawSmallAmmo(weapons[W_PISTOL].ammo, 1);
+				drawSmallAmmo(weapons[W_SHOTGUN].ammo, 2);
+				drawSmallAmmo(weapons[W_ROCKET].ammo, 3);
+				lastHealth = 0xFFFF;
+				lastArmour = 0xFFFF;
+				lastCurrentWeapon = 0xFF;
+				highlightWeaponHUD(currentWeapon);
+				drawDoomFace(&doomface);
+			}
+		}
+
+		/* In-game pause: Start button opens options screen (not in
+		 * lockstep, the other console would stall on it) */
+		if ((keyPressed & K_STA) && !g_lockstep) {
 			optionsScreen(&pauseSettings);
 
 			/* Update volumes from potentially changed settings */
@@ -990,13 +1317,27 @@ u8 gameLoop()
 
 			/* Reset input state to avoid leftover button press */
 			prevKeyInputs = 0xFFFF;
+			simResync();
+		}
+
+		/* Lockstep: the world runs with the HOST as its player and the
+		 * JOIN as g_lockJoin, the same on both consoles */
+		if (g_lockstep) {
+			if (!g_isHost) playerSwap();
+			g_lockJoin.active = true;
+			g_lockJoin.x = otherSim.x;
+			g_lockJoin.y = otherSim.y;
+			g_lockJoin.angle = otherSim.ang;
+			g_lockJoin.damage = otherSim.damage;
 		}
 
 		/* Update door animations */
 		updateDoors();
 
 		// we actually only need to call this if x,y,ang changed...
+		PROF_BEGIN(PROF_ENEMY);
 		updateEnemies(fPlayerX, fPlayerY, fPlayerAng);
+		PROF_END(PROF_ENEMY);
 
 		/* Update particle animations */
 		updateParticles();
@@ -1010,16 +1351,17 @@ u8 gameLoop()
 		/* Update projectiles (fireballs) */
 		updateProjectiles(fPlayerX, fPlayerY, fPlayerAng);
 
+		if (g_lockstep) {
+			otherSim.damage = g_lockJoin.damage;
+			g_lockJoin.active = false;
+			if (!g_isHost) playerSwap();
+		}
+
 		/* Check pickup collisions */
 		{
-			u8 pickupAmmo = weapons[2].ammo;  /* pistol bullets */
-			u8 shellAmmo = weapons[3].ammo;   /* shotgun shells */
-		if (updatePickups(fPlayerX, fPlayerY, &pickupAmmo, &currentHealth,
-		                  &currentArmour, &armorType, &shellAmmo)) {
-			/* Something was picked up - update ammo and HUD (health/armour redrawn by per-frame dirty check) */
-			weapons[2].ammo = pickupAmmo;
-			weapons[5].ammo = pickupAmmo; /* chaingun shares bullet ammo with pistol */
-			weapons[3].ammo = shellAmmo;
+			u8 picked = forEachPlayer(playerPickups);
+		if (picked & PICKED_ITEM) {
+			/* Something was picked up - update HUD (health/armour redrawn by per-frame dirty check) */
 			/* Update big numbers (left side) for current weapon */
 			drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
 			/* Update right-side digits for all ammo types (non-equipped too) */
@@ -1033,26 +1375,8 @@ u8 gameLoop()
 				drawKeyCards(g_hasKeyRed, g_hasKeyYellow, g_hasKeyBlue);
 		}
 			/* Handle weapon pickups */
-			if (g_pickedUpWeapon > 0) {
-				weapons[g_pickedUpWeapon].hasWeapon = true;
-				if (g_pickedUpWeapon == W_ROCKET)
-					weapons[g_pickedUpWeapon].ammo = 2;  /* start with 2 rockets */
-				else if (g_pickedUpWeapon == W_CHAINGUN) {
-					/* Chaingun shares bullets with pistol; add 20 to shared pool */
-					u8 bullets = weapons[W_PISTOL].ammo + 20;
-					if (bullets > 200) bullets = 200;
-					weapons[W_PISTOL].ammo = bullets;
-					weapons[W_CHAINGUN].ammo = bullets;
-				} else
-					weapons[g_pickedUpWeapon].ammo = 8;  /* start with 8 shells */
-				currentWeapon = g_pickedUpWeapon;
-				nextWeapon = g_pickedUpWeapon;
-				if (g_pickedUpWeapon == W_ROCKET)
-					loadRocketLauncherSprites();
-				else if (g_pickedUpWeapon == W_CHAINGUN)
-					loadChaingunSprites();
-				else
-					loadShotgunSprites();
+			if (picked & PICKED_WEAPON) {
+				loadWeaponSprites(currentWeapon);
 				drawUpdatedAmmo(weapons[currentWeapon].ammo, weapons[currentWeapon].ammoType);
 				lastHasPistol = 0xFF;
 				lastHasShotgun = 0xFF;
@@ -1060,27 +1384,14 @@ u8 gameLoop()
 				lastHasChaingun = 0xFF;
 				lastCurrentWeapon = 0xFF;
 				highlightWeaponHUD(currentWeapon);
-				weaponAnimation = 0;
-				updatePistolCount = 0;
-				isShooting = false;
-				playPlayerSFX(SFX_SHOTGUN_COCK);
-				g_pickedUpWeapon = 0;
 			}
 		}
 
 		/* Check secret sectors */
+		forEachPlayer(playerSecrets);
 		{
 			u8 playerTX = (u8)(fPlayerX >> 8);
 			u8 playerTY = (u8)(fPlayerY >> 8);
-			u8 si;
-			for (si = 0; si < g_totalSecrets; si++) {
-				if (!g_secrets[si].found &&
-				    playerTX == g_secrets[si].tx &&
-				    playerTY == g_secrets[si].ty) {
-					g_secrets[si].found = true;
-					g_secretsFound++;
-				}
-			}
 
 			/* Subtle rumble when near an unfound secret door (check every 32 frames only) */
 			if (!g_isMultiplayer && pauseSettings.rumble > 0 && g_damageRumbleTimer == 0 &&
@@ -1106,19 +1417,26 @@ u8 gameLoop()
 		}
 		frameCounter++;
 
+		/* Every pass of this loop is one fixed simulation tick (timer.h).
+		 * With ticks already pending the previous pass ran long: skip the
+		 * sprite upload, wall trace and weapon draw below and catch up,
+		 * at most SIM_MAX_SKIP passes in a row. The first pass of a level
+		 * (resets the sprite caches) and timedemos always draw. */
+		simRender = !simBehind() || simSkipped >= SIM_MAX_SKIP
+		            || g_levelFrames == 0 || g_demoMode == DEMO_PLAYBACK;
+		simSkipped = simRender ? 0 : simSkipped + 1;
+
 		/* Update enemy sprite frames in VRAM -- distance-sorted rendering */
+		PROF_BEGIN(PROF_SPRITE);
 		/* Compute 3 closest active enemies for rendering.
 		 * Alive enemies always have priority over dead ones. */
-		{
+		if (simRender) {
 			static u8 lastSlotEnemy[MAX_VISIBLE_ENEMIES] = {255,255,255,255,255};
-			/* Cached line-of-sight results: only recompute every 4 frames */
-			static bool losCache[MAX_ENEMIES];
 			static u8 losInited = 0;
 			u8 ei, vi;
 			u32 dists[MAX_ENEMIES];
 			u8 sorted[MAX_ENEMIES];
 			u8 activeCount = 0;
-			u8 doLosCheck;
 			u8 doVisibilityRefresh;
 
 			/* New level: invalidate visibility/LOS caches cleanly. */
@@ -1126,9 +1444,9 @@ u8 gameLoop()
 				losInited = 0;
 				for (ei = 0; ei < MAX_ENEMIES; ei++) {
 					losCache[ei] = false;
+					losStamp[ei] = (u16)(0 - LOS_MAX_AGE);  /* stale */
 				}
 			}
-			doLosCheck = ((g_levelFrames & 3) == 0) || !losInited;
 			doVisibilityRefresh = ((g_levelFrames & 1) == 0) || (g_numVisibleEnemies == 0) || !losInited;
 			if (!losInited) losInited = 1;
 
@@ -1147,7 +1465,7 @@ u8 gameLoop()
 				 *   not-visible alive   -> distance + 0x80000000
 				 *   not-visible dead    -> distance + 0xC0000000
 				 * "Not-visible" = behind player OR blocked by a wall.
-				 * hasLineOfSight is expensive (Bresenham walk); only recheck every 4 frames. */
+				 * hasLineOfSight is expensive (Bresenham walk): cached, see losCheck. */
 				for (ei = 0; ei < MAX_ENEMIES; ei++) {
 					if (!g_enemies[ei].active) continue;
 					{
@@ -1159,15 +1477,10 @@ u8 gameLoop()
 						s32 dot = (s32)dx * fwdX[fwdOct] + (s32)dy * fwdY[fwdOct];
 						if (dot <= 0) {
 							visible = false;
-						} else if (doLosCheck) {
-							/* Full LOS check: only every 4 frames */
-							if (!hasLineOfSight(fPlayerX, fPlayerY,
-										g_enemies[ei].x, g_enemies[ei].y)) {
-								visible = false;
-							}
-							losCache[ei] = visible;
 						} else {
-							/* Use cached result */
+							/* Cached result, re-checked here only once stale */
+							if (LOS_STALE(ei, LOS_MAX_AGE))
+								losCheck(ei);
 							visible = losCache[ei];
 						}
 						if (g_enemies[ei].state == ES_DEAD)
@@ -1245,14 +1558,24 @@ u8 gameLoop()
 			}
 		}
 
-		TraceFrame(&fPlayerX, &fPlayerY, &fPlayerAng);
+		PROF_END(PROF_SPRITE);
 
-		/* Door/switch activation (Select button) -- uses fresh center-ray from TraceFrame */
-		if (keyPressed & K_SEL) {
-			u8 activateResult = playerActivate(fPlayerX, fPlayerY, fPlayerAng, currentLevel);
-			if (activateResult == 2) {
-				playPlayerSFX(SFX_PLAYER_UMF);
-			}
+		/* Spare time at the end of this pass re-checks line of sight */
+		if (simRender) {
+			losJobNext = 0;
+			idleAdd(losIdleJob);
+		}
+
+		PROF_BEGIN(PROF_TRACE);
+		frameTraced = simRender;
+		if (simRender)
+			TraceFrame(&fPlayerX, &fPlayerY, &fPlayerAng);
+		PROF_END(PROF_TRACE);
+
+		/* Door/switch activation (Select button) -- center ray of this pass,
+		 * from TraceFrame or traced on demand (playerUse) */
+		if (forEachPlayer(playerUse) == 2) {
+			playPlayerSFX(SFX_PLAYER_UMF);
 		}
 
 		//drawFixedDoomStage(0);
@@ -1262,9 +1585,11 @@ u8 gameLoop()
 		//setmem((void*)BGMap(0), 0x0000, 8192);
 		//setmem((void*)BGMap(1), 0x0000, 8192);
 		/* --- Doom face selection (health/damage-based) --- */
+		PROF_BEGIN(PROF_HUD);
 		{
 			u8 healthBracket = 0;
 			u8 newFace;
+			u8 hurt;
 			if (currentHealth >= 80)      healthBracket = 0;
 			else if (currentHealth >= 60) healthBracket = 1;
 			else if (currentHealth >= 40) healthBracket = 2;
@@ -1272,41 +1597,15 @@ u8 gameLoop()
 			else                          healthBracket = 4;
 
 			/* Process enemy damage this frame */
-			if (g_lastEnemyDamage > 0) {
-				u8 dmg = g_lastEnemyDamage;
-				g_lastEnemyDamage = 0;
-			/* Doom-style armor absorption */
-				if (currentArmour > 0 && armorType > 0) {
-					u8 armorAbsorb;
-					if (armorType >= 2)
-						armorAbsorb = dmg >> 1;     /* blue: absorb 1/2 */
-					else
-						armorAbsorb = dmg / 3;      /* green: absorb 1/3, Doom P_DamageMobj */
-					if (armorAbsorb > (u8)currentArmour) armorAbsorb = (u8)currentArmour;
-					currentArmour -= armorAbsorb;
-					dmg -= armorAbsorb;
-					if (currentArmour == 0) armorType = 0;
-				}
-
-				/* Apply damage to player health (HUD redrawn by per-frame dirty check) */
-				if (dmg >= currentHealth)
-					currentHealth = 0;
-				else
-					currentHealth -= dmg;
-
-				/* Player pain/death sound */
-				if (currentHealth == 0)
-					playPlayerSFX(SFX_PLAYER_DEATH);
-				else
-					playPlayerSFX(SFX_PLAYER_PAIN);
-
+			hurt = forEachPlayer(playerDamage);
+			if (hurt) {
 				/* Screen flash for damage */
 				g_flashTimer = 3;
 				g_flashType = 1;
 
 				/* Show ouch face: severe if >20 damage at once */
 				ouchTimer = 20;
-				if (dmg > 20)
+				if (hurt & HURT_SEVERE)
 					ouchTimer |= 0x80;
 
 				/* Rumble on damage if rumble pak enabled (skip in multiplayer - same port as link) */
@@ -1356,11 +1655,11 @@ u8 gameLoop()
 				/* Idle: cycle left/center/right on a timer */
 				if (updateDoomfaceCount > updateDoomfaceTime) {
 					{ /* Fast mod-3: avoid division on V810 */
-					u8 r3 = (u8)rand();
+					u8 r3 = faceRnd();
 					lookDir = r3 - ((u16)(r3 * 171u) >> 9) * 3u;  /* 0=left, 1=center, 2=right */
 				}
 					updateDoomfaceCount = 0;
-					updateDoomfaceTime = 9 + (rand() & 7);
+					updateDoomfaceTime = 9 + (faceRnd() & 7);
 				} else {
 					updateDoomfaceCount++;
 				}
@@ -1382,30 +1681,12 @@ u8 gameLoop()
 		//vbSetObject(u16 n, u8 header, s32 x, s32 p, s32 y, u16 chr)
 		//vbSetObject(	  1024, 		 OBJ_ON, 	16,	   0,	  16,	   8);
 
-		if (weaponAnimation >= 1) {
-			if (weaponAnimation >= 2) { // punch animation
-				isShooting = true;
-			}
-			updatePistolCount++;
-			/* Chaingun: every frame (fast). Rocket: every 3 frames (slow). Others: every 2. */
-			if (updatePistolCount > (currentWeapon == W_CHAINGUN ? 0 : (currentWeapon == W_ROCKET ? 2 : 1))) {
-				weaponAnimation++;
-				if (weaponAnimation >= weapons[currentWeapon].attackFrames) {
-					isShooting = false;
-					weaponAnimation = 0;
-					/* Switch weapon after full shoot animation if ammo ran out */
-					if (pendingAutoSwitch) {
-						pendingAutoSwitch = false;
-						autoSwitchOnEmpty();
-					}
-				}
-				updatePistolCount = 0;
-			}
-
-		}
+		forEachPlayer(playerWeaponAnim);
 		//setmem((void*)BGMap(LAYER_WEAPON_BLACK), 0, 1840);
 		//setmem((void*)BGMap(LAYER_WEAPON), 0, 1840);
-		drawWeapon(nextWeapon, swayXTBL[weaponSwayIndex], swayYTBL[weaponSwayIndex], weaponAnimation, weaponChangeTimer);
+		if (simRender)
+			drawWeapon(nextWeapon, swayXTBL[weaponSwayIndex], swayYTBL[weaponSwayIndex], weaponAnimation, weaponChangeTimer);
+		PROF_END(PROF_HUD);
 		//copymem(0x1000, (void*)FontTiles, 1024);
 		//setmem((void*)CharSeg0, 0x0000, 2048);
         	//setmem((void*)BGMap(0), 0x0000, 8192);
@@ -1425,58 +1706,96 @@ u8 gameLoop()
 				walkSwayIndex = 0;
 			}
 		}
-		if (isChangingWeapon) {
-			if (weaponChangeTimer > 10 && nextWeapon != currentWeapon) {
-				nextWeapon = currentWeapon; // switch weapon after half time...
-				/* Now load tiles so they match the weapon drawWeapon() will use */
-				if (currentWeapon == W_FISTS)
-					loadFistSprites();
-				else if (currentWeapon == W_PISTOL)
-					loadPistolSprites();
-				else if (currentWeapon == W_SHOTGUN)
-					loadShotgunSprites();
-				else if (currentWeapon == W_ROCKET)
-					loadRocketLauncherSprites();
-				else if (currentWeapon == W_CHAINGUN)
-					loadChaingunSprites();
-			}
-			if (weaponChangeTimer >= weaponChangeTime) {
-				weaponChangeTimer = 0;
-				isChangingWeapon = false;
-			}
-			weaponChangeTimer++;
-		}
+		forEachPlayer(playerWeaponChange);
 		/* Update background music sequencer */
+		PROF_BEGIN(PROF_AUDIO);
 		updateMusic(isPlayMusicBool);
+		PROF_END(PROF_AUDIO);
+
+		/* === MULTIPLAYER STATE SYNC ===
+		 * Post our state and take whatever the peer sent since the last
+		 * frame. The link runs from interrupts (link.h): nothing here waits
+		 * for the cable, a late packet is picked up next frame, and player
+		 * 2 is drawn from the snapshots (snapshot.h) so it does not stall
+		 * meanwhile. In lockstep player 2 is simulated here (otherSim),
+		 * nothing to send. */
+		if (g_isMultiplayer && g_lockstep) {
+			g_player2X = otherSim.x;
+			g_player2Y = otherSim.y;
+			g_player2Angle = (u16)otherSim.ang;
+			g_player2Health = otherSim.health;
+			g_player2Flags = (otherSim.currentWeapon << P2F_WEAPON_SHIFT) & P2F_WEAPON_MASK;
+			if (otherSim.isShooting) g_player2Flags |= P2F_SHOOTING;
+			g_player2Alive = true;
 
-		/* === MULTIPLAYER STATE SYNC === */
-		if (g_isMultiplayer) {
-			u8 sendBuf[8], recvBuf[8];
-
-			/* Pack local state */
-			sendBuf[0] = (u8)(fPlayerX >> 8);
-			sendBuf[1] = (u8)(fPlayerX);
-			sendBuf[2] = (u8)(fPlayerY >> 8);
-			sendBuf[3] = (u8)(fPlayerY);
-			sendBuf[4] = (u8)((u16)fPlayerAng >> 8);
-			sendBuf[5] = (u8)((u16)fPlayerAng);
-			sendBuf[6] = 0;
-			if (isShooting) sendBuf[6] |= P2F_SHOOTING;
-			sendBuf[6] |= (currentWeapon << P2F_WEAPON_SHIFT) & P2F_WEAPON_MASK;
-			if (g_lastEnemyDamage > 0) sendBuf[6] |= P2F_TOOK_DAMAGE;
-			if (currentHealth == 0) sendBuf[6] |= P2F_DIED;
-			if (g_firedRocketThisFrame) sendBuf[6] |= P2F_FIRED_ROCKET;
-			sendBuf[7] = (u8)currentHealth;
-
-			/* Exchange state packets with remote player */
-			linkExchangeState(sendBuf, recvBuf);
-
-			/* Unpack remote state */
-			g_player2X = ((u16)recvBuf[0] << 8) | recvBuf[1];
-			g_player2Y = ((u16)recvBuf[2] << 8) | recvBuf[3];
-			g_player2Angle = ((u16)recvBuf[4] << 8) | recvBuf[5];
-			g_player2Flags = recvBuf[6];
-			g_player2Health = recvBuf[7];
+			/* Animate player 2 walk */
+			g_p2AnimTimer++;
+			if (g_p2AnimTimer > 4) {
+				g_p2AnimTimer = 0;
+				g_p2AnimFrame = (g_p2AnimFrame + 1) & 3;
+			}
+		} else if (g_isMultiplayer) {
+			static u8 stateFrames = 0;  /* frames since our last state packet */
+			static u8 heldFlags = 0;    /* one-shot flags of the frames between */
+			LinkState st;
+			u8 events[LINK_MAX_EVENTS];
+			u8 evLen = 0;
+			u8 p2Events = 0;  /* one-shot flags (shot, rocket) of every packet read */
+
+			/* Local state */
+			st.x = fPlayerX;
+			st.y = fPlayerY;
+			st.angle = (u16)fPlayerAng;
+			st.flags = 0;
+			if (isShooting) st.flags |= P2F_SHOOTING;
+			st.flags |= (currentWeapon << P2F_WEAPON_SHIFT) & P2F_WEAPON_MASK;
+			if (g_lastEnemyDamage > 0) st.flags |= P2F_TOOK_DAMAGE;
+			if (currentHealth == 0) st.flags |= P2F_DIED;
+			if (g_firedRocketThisFrame) st.flags |= P2F_FIRED_ROCKET;
+			st.health = (u8)currentHealth;
+			st.time = (u8)frameCounter;
+
+			/* Queue it for the link interrupt every LINK_STATE_FRAMES frames,
+			 * the peer interpolates between. Rockets and, in co-op, enemy
+			 * damage go out at once, a shot on a skipped frame with the next
+			 * packet. If the TX ring is full it goes next frame.
+			 * === COOP ENEMY SYNC ===
+			 * The HOST's enemies are authoritative (enemysync.h): its
+			 * packets carry enemy records, the JOIN's its hits on enemies,
+			 * in the event bytes, within SYNC_FRAME_BUDGET bytes a frame. */
+			if (stateFrames < 255) stateFrames++;
+			heldFlags |= st.flags & P2F_SHOOTING;
+			if ((st.flags & P2F_FIRED_ROCKET) || stateFrames >= LINK_STATE_FRAMES
+			    || (g_gameMode == GAMEMODE_COOP && syncUrgent())) {
+				if (g_gameMode == GAMEMODE_COOP) {
+					u16 budget = (u16)stateFrames * SYNC_FRAME_BUDGET;
+					evLen = syncWrite(events, budget > LINK_MAX_EVENTS ? LINK_MAX_EVENTS : (u8)budget,
+					                  g_player2X, g_player2Y);
+				}
+				st.flags |= heldFlags;
+				if (linkSendState(&st, events, evLen)) {
+					stateFrames = 0;
+					heldFlags = 0;
+				}
+			}
+
+			/* Unpack every packet that arrived: the newest state wins, the
+			 * one-shot flags and enemy events of all of them apply, so a
+			 * frame without a packet fires nothing twice */
+			while (linkRecvState(&st, events, &evLen)) {
+				snapPush(st.time, st.x, st.y, st.angle);
+				g_player2Flags = st.flags;
+				g_player2Health = st.health;
+				p2Events |= st.flags & (P2F_SHOOTING | P2F_FIRED_ROCKET);
+
+				/* Co-op: the HOST's enemy records, or the JOIN's hits */
+				if (g_gameMode == GAMEMODE_COOP)
+					syncRead(events, evLen, fPlayerX, fPlayerY);
+			}
+
+			snapUpdate();
+			if (g_gameMode == GAMEMODE_COOP && !g_isHost)
+				syncCorrect();
 
 			/* Animate player 2 walk */
 			g_p2AnimTimer++;
@@ -1486,7 +1805,7 @@ u8 gameLoop()
 			}
 
 			/* Check if remote player is shooting at us (hitscan from P2 to local player) */
-			if (g_player2Flags & P2F_SHOOTING) {
+			if (p2Events & P2F_SHOOTING) {
 				/* Simple distance-based damage check */
 				s16 dx = (s16)g_player2X - (s16)fPlayerX;
 				s16 dy = (s16)g_player2Y - (s16)fPlayerY;
@@ -1518,7 +1837,7 @@ u8 gameLoop()
 			}
 
 			/* Spawn P2's rocket locally so it's visible to us */
-			if (g_player2Flags & P2F_FIRED_ROCKET) {
+			if (p2Events & P2F_FIRED_ROCKET) {
 				spawnRocket(g_player2X, g_player2Y, (s16)g_player2Angle);
 				/* Mark the newly spawned rocket as P2-sourced (sourceEnemy=254)
 				 * so it can hit the local player on direct impact */
@@ -1558,64 +1877,6 @@ u8 gameLoop()
 					playEnemySFX(SFX_TELEPORT, rdist8);
 				}
 			}
-
-			/* === COOP ENEMY SYNC ===
-			 * HOST is authoritative for enemies. After player state exchange,
-			 * HOST sends compact enemy events (kills/attacks).
-			 * Format: 1 byte event count, then per event: index(1) + type(1).
-			 * Event types: 0=killed, 1=pain, 2=state change.
-			 * JOIN applies these events to local enemy state.
-			 * Enemy movement is deterministic (same update logic on both sides). */
-			if (g_gameMode == GAMEMODE_COOP) {
-				if (g_isHost) {
-					/* HOST: collect enemy events this frame and send */
-					u8 evtBuf[17];  /* max 8 events: 1 count + 8*(idx+type) */
-					u8 evtCount = 0;
-					u8 i;
-					for (i = 0; i < MAX_ENEMIES && evtCount < 8; i++) {
-						if (g_enemies[i].state == ES_DEAD && g_enemies[i].animFrame == 0 && g_enemies[i].stateTimer == 1) {
-							/* Just killed this frame */
-							evtBuf[1 + evtCount * 2] = i;
-							evtBuf[2 + evtCount * 2] = 0;  /* killed */
-							evtCount++;
-						} else if (g_enemies[i].state == ES_PAIN && g_enemies[i].stateTimer == 1) {
-							/* Just entered pain state */
-							evtBuf[1 + evtCount * 2] = i;
-							evtBuf[2 + evtCount * 2] = 1;  /* pain */
-							evtCount++;
-						}
-					}
-					evtBuf[0] = evtCount;
-					linkSendPacket(evtBuf, 1 + evtCount * 2);
-				} else {
-					/* JOIN: receive enemy events from HOST */
-					u8 evtCount;
-					evtCount = linkRecvByte();
-					if (evtCount > 8) evtCount = 8;  /* safety */
-					if (evtCount > 0) {
-						u8 evtBuf[16];
-						u8 i;
-						linkRecvPacket(evtBuf, evtCount * 2);
-						for (i = 0; i < evtCount; i++) {
-							u8 idx = evtBuf[i * 2];
-							u8 type = evtBuf[i * 2 + 1];
-							if (idx < MAX_ENEMIES) {
-								if (type == 0) {
-									/* Kill */
-									g_enemies[idx].state = ES_DEAD;
-									g_enemies[idx].animFrame = 0;
-									g_enemies[idx].animTimer = 0;
-									g_enemies[idx].health = 0;
-								} else if (type == 1) {
-									/* Pain */
-									g_enemies[idx].state = ES_PAIN;
-									g_enemies[idx].stateTimer = 0;
-								}
-							}
-						}
-					}
-				}
-			}
 		}
 
 		/* Debug removed: drawPlayerInfo / drawUseTargetDebug */
@@ -1646,8 +1907,15 @@ u8 gameLoop()
 
 		//vbWaitFrame(0); /* Sync to VBlank for tear-free display */
 
+		/* A demo covers one level: stop before the stats/intermission screens */
+		if (g_levelComplete && g_demoMode != DEMO_OFF) {
+			musicStop();
+			demoStop();
+			return 0;
+		}
+
 		/* ---- Level transition ---- */
-		if (g_levelComplete && currentLevel < 6) {
+		if (g_levelComplete && currentLevel < NUM_LEVELS) {
 			/* Stop level music before transition */
 			musicStop();
 			/* Fade out current level */
@@ -1675,6 +1943,12 @@ u8 gameLoop()
 
 			/* Load next level (map, enemies, pickups, doors, particles) */
 			loadLevel(currentLevel);
+			if (g_lockstep) {
+				placeLockPlayers();
+				otherSim.weaponAnimation = 0;
+				otherSim.updatePistolCount = 0;
+				otherSim.isShooting = false;
+			}
 
 			/* Restore all game VRAM, worlds, palettes, BGMaps
 			 * (intermission overwrote them with le_map data) */
@@ -1725,10 +1999,11 @@ u8 gameLoop()
 			VIP_REGS[JPLT1] = 0xE4;
 			VIP_REGS[JPLT2] = 0xE4;
 			VIP_REGS[JPLT3] = 0xE4;
+			simResync();
 		}
 
 		/* ---- Episode ending (completed E1M6) ---- */
-		if (g_levelComplete && currentLevel == 6) {
+		if (g_levelComplete && currentLevel == NUM_LEVELS) {
 			musicStop();
 			vbFXFadeOut(0);
 			vbWaitFrame(10);
@@ -1739,6 +2014,7 @@ u8 gameLoop()
 		}
 
 		/* HUD: redraw health/armour/weapon slots only when values changed */
+		PROF_BEGIN(PROF_HUD);
 		if (currentHealth != lastHealth) {
 			drawHealth(currentHealth);
 			lastHealth = currentHealth;
@@ -1782,11 +2058,22 @@ u8 gameLoop()
 			lastRocketAmmo = weapons[W_ROCKET].ammo;
 		}
 
-		/* Timer-based frame pacing: keeps emulator speed closer to hardware.
-		 * If a frame is already slow on hardware, waitForFrameTimer() returns immediately. */
+		profDrawOverlay();
+		PROF_END(PROF_HUD);
+
+		/* Fixed-timestep pacing: wait for the next simulation tick. If the
+		 * pass ran long a tick is already pending and this returns at once. */
 		g_levelFrames++;
 		prevKeyInputs = keyInputs;
-		waitForFrameTimer();
+		if (g_lockstep)
+			lockFrameEnd(lockHash());
+		PROF_BEGIN(PROF_WAIT);
+		if (g_demoMode != DEMO_PLAYBACK)  /* timedemo: no pacing */
+			waitForSimTick();
+		PROF_END(PROF_WAIT);
+		demoFrameEnd();
+		vramStatsFrame();
+		profFrame();
 	}
 	return 0;
 }
@@ -10,12 +10,13 @@
 #include <misc.h>
 #include "menu_multiplayer.h"
 #include "../functions/link.h"
+#include "../functions/lockstep.h"
 #include "../functions/sndplay.h"
 #include "../functions/timer.h"
 #include "../assets/audio/doom_sfx.h"
 
-/* Font tile data from libgccvb-Barebone (256 tiles, 4096 bytes) */
-#include "../assets/images/font_tiles.h"
+/* Font tile data from libgccvb-Barebone (256 tiles, 4096 bytes, Font.c) */
+extern BYTE FontTiles[];
 
 /* ---- Helpers ---- */
 
@@ -296,10 +297,11 @@ static u8 screenJoinSearch(void) {
 }
 
 /* Level and mode selection (HOST). Joiner already connected via unified screen.
- * Returns level number (1-4, 7=DM), or 0 on cancel. Sets g_gameMode. */
+ * Returns level number (1-4, 7=DM), or 0 on cancel. Sets g_gameMode and
+ * g_lockstep. */
 static u8 screenLevelMode(void) {
     u8 levelPos = 0;  /* 0=E1M1, 1=E1M2, 2=E1M3, 3=E1M4, 4=DM ARENA */
-    u8 modePos = 0;   /* 0=COOP, 1=DEATHMATCH */
+    u8 modePos = 0;   /* 0=COOP, 1=DEATHMATCH, 2=COOP LOCKSTEP */
     u8 section = 0;   /* 0=level select, 1=mode select */
     u8 allowInput = 0;
     u8 joinerConnected = 1;  /* set by unified screen before we get here */
@@ -331,11 +333,12 @@ static u8 screenLevelMode(void) {
                     menuPrint(8, 2, "SELECT MODE");
                     menuPrint(6, 6, "COOP");
                     menuPrint(6, 8, "DEATHMATCH");
-                    drawCursor(0, 2, 6);
+                    menuPrint(6, 10, "COOP LOCKSTEP");
+                    drawCursor(0, 3, 6);
                     if (joinerConnected)
-                        menuPrint(6, 12, "P2 CONNECTED!");
+                        menuPrint(6, 14, "P2 CONNECTED!");
                     else
-                        menuPrint(6, 12, "WAITING P2...");
+                        menuPrint(6, 14, "WAITING P2...");
                     allowInput = 0;
                 }
             } else if (keys & K_B) {
@@ -362,7 +365,8 @@ static u8 screenLevelMode(void) {
             if (keys & (K_A )) {
                 if (allowInput && joinerConnected) {
                     playPlayerSFX(SFX_PISTOL);
-                    g_gameMode = modePos;  /* 0=COOP, 1=DEATHMATCH */
+                    g_lockstep = (modePos == 2);
+                    g_gameMode = g_lockstep ? GAMEMODE_COOP : modePos;
                     return levelNums[levelPos];
                 }
             } else if (keys & K_B) {
@@ -386,14 +390,14 @@ static u8 screenLevelMode(void) {
             } else if (keys & (K_RU | K_LU)) {
                 if (allowInput && modePos > 0) {
                     modePos--;
-                    drawCursor(modePos, 2, 6);
+                    drawCursor(modePos, 3, 6);
                     playPlayerSFX(SFX_ELEVATOR_STP);
                     allowInput = 0;
                 }
             } else if (keys & (K_RD | K_LD)) {
-                if (allowInput && modePos < 1) {
+                if (allowInput && modePos < 2) {
                     modePos++;
-                    drawCursor(modePos, 2, 6);
+                    drawCursor(modePos, 3, 6);
                     playPlayerSFX(SFX_ELEVATOR_STP);
                     allowInput = 0;
                 }
@@ -452,6 +456,20 @@ got_game_start:
     while (HW_REGS[CCR] & 0x02) {}  /* wait for transfer */
     mode = HW_REGS[CDRR];
 
+    /* Lockstep: the seed of the game random stream follows, high byte first */
+    if (mode == GAMEMODE_LOCKSTEP) {
+        u16 seed;
+        HW_REGS[CCR] = 0x94;
+        while (HW_REGS[CCR] & 0x02) {}
+        seed = (u16)HW_REGS[CDRR] << 8;
+        HW_REGS[CCR] = 0x94;
+        while (HW_REGS[CCR] & 0x02) {}
+        seed |= HW_REGS[CDRR];
+        g_lockSeed = seed;
+        g_lockstep = true;
+        mode = GAMEMODE_COOP;
+    }
+
     g_gameMode = mode;
 
     /* Send sync ack */
@@ -471,6 +489,7 @@ u8 multiplayerMenu(void) {
     g_isMultiplayer = false;
     g_isHost = false;
     g_gameMode = GAMEMODE_COOP;
+    g_lockstep = false;
     g_fragCount = 0;
     g_deathCount = 0;
 
@@ -537,7 +556,23 @@ u8 multiplayerMenu(void) {
             {
                 u16 retries;
                 retries = 0;
-                while (linkTrySendByte(g_gameMode, 5000) != LINK_OK) {
+                while (linkTrySendByte(g_lockstep ? GAMEMODE_LOCKSTEP : g_gameMode, 5000) != LINK_OK) {
+                    updateMusic(true);
+                    vbWaitFrame(0);
+                    if (++retries > 150) break;
+                }
+            }
+            if (g_lockstep) {
+                u16 retries;
+                g_lockSeed = (u16)g_musicTick;
+                retries = 0;
+                while (linkTrySendByte((u8)(g_lockSeed >> 8), 5000) != LINK_OK) {
+                    updateMusic(true);
+                    vbWaitFrame(0);
+                    if (++retries > 150) break;
+                }
+                retries = 0;
+                while (linkTrySendByte((u8)g_lockSeed, 5000) != LINK_OK) {
                     updateMusic(true);
                     vbWaitFrame(0);
                     if (++retries > 150) break;
@@ -206,5 +206,10 @@ u8 titleScreen()
 	setmem((void*)BGMap(1), 0, 8192);
 	setmem((void*)BGMap(2), 0, 8192);
 	setmem((void*)BGMap(3), 0, 8192); /* clear previous data */
+	/* New Game with a trigger held: L records a timedemo, R plays it back */
+	if (pos == 0 && (keyInputs & K_LT))
+		return SCENE_DEMO_RECORD;
+	if (pos == 0 && (keyInputs & K_RT))
+		return SCENE_DEMO_PLAY;
 	return (pos+1);
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 #define _COMPONENTS_TITLE_SCREEN_H
 
 
+/* Scenes beyond the menu entries (pos+1): New Game with L or R held */
+#define SCENE_DEMO_RECORD	6
+#define SCENE_DEMO_PLAY		7
+
 u8 titleScreen();
 
 
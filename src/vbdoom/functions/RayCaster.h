@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <types.h>
+#include <math.h>
 
 // virtual boy has 384 x 224 resolution
 #define TABLES_384
@@ -11,16 +12,16 @@
 #define SCREEN_H_DIV_2 (u16)(SCREEN_HEIGHT>>1)
 
 #define SCREEN_SCALE 1
-#define FOV (double)(M_PI / 2)
-#define INV_FACTOR (float)(SCREEN_WIDTH * 95.0f / 320.0f)
+#define FOV ((fix7_9)804)                     /* pi/2 rad in 7.9 fixed (804/512 = 1.5703) */
+#define INV_FACTOR ITOFIX23_9(SCREEN_WIDTH * 95 / 320) /* 114.0 in 23.9 fixed */
 #define LOOKUP_TBL
 #define LOOKUP8(tbl, offset) tbl[offset]
 #define LOOKUP16(tbl, offset) tbl[offset]
 
-#define HFOV = (u16)(0.7 * SCREEN_HEIGHT) // affects horizontal field of vision
-#define VFOV = (u16)(0.8 * SCREEN_HEIGHT) // affects vertical field of vision
-//#define HFOV = (u16)(0.6 * SCREEN_HEIGHT) // affects horizontal field of vision
-//#define VFOV = (u16)(0.26 * SCREEN_HEIGHT) // affects vertical field of vision
+#define HFOV (u16)(SCREEN_HEIGHT * 7 / 10) // affects horizontal field of vision (0.7 * H)
+#define VFOV (u16)(SCREEN_HEIGHT * 8 / 10) // affects vertical field of vision (0.8 * H)
+//#define HFOV (u16)(SCREEN_HEIGHT * 6 / 10) // affects horizontal field of vision
+//#define VFOV (u16)(SCREEN_HEIGHT * 26 / 100) // affects vertical field of vision
 
 //hfov = 0.7 * H; // * aspectW; // * H;
 //vfov = 0.8 * H; // * aspectW; // * H;
@@ -30,7 +31,7 @@
 #define MAP_XS    (u8)6   /* log2(MAP_X) for shift */
 #define MAP_CELLS ((u16)(MAP_X) * (u16)(MAP_Y))
 #define INV_FACTOR_INT ((u16)(SCREEN_WIDTH * 75))
-#define MIN_DIST (int)((150 * ((float)SCREEN_WIDTH / (float)SCREEN_HEIGHT)))
+#define MIN_DIST (int)((150 * SCREEN_WIDTH) / SCREEN_HEIGHT)  /* 150 * 384/208 = 276 */
 #define HORIZON_HEIGHT (SCREEN_HEIGHT / 2)
 #define INVERT(x) (u8)((x ^ 255) + 1)
 #define ABS(x) (x < 0 ? -x : x)
@@ -2,6 +2,7 @@
 #include "RayCasterData.h"
 #include "enemy.h"
 #include "door.h"
+#include "level.h"
 #include "../assets/images/wall_textures.h"
 
 #define LOOKUP_STORAGE extern
@@ -12,13 +13,13 @@
 #define H 208 // reduce by interface height which is 32..
 #define Hby2 (H/2)
 
-u16 hfovv = (u16)(0.6 * SCREEN_HEIGHT);
+u16 hfovv = (u16)(SCREEN_HEIGHT * 6 / 10);  /* 0.6 * H */
 /* vfov = 0.6 * 224 = 134.4, integer approximation 134.
  * Used as divisor: inverse_fixed(vfov/rotatedY) = 512*rotatedY/vfov */
 #define VFOV_INT 134
 
 // (v * f) >> 8
-u16 MulU(u8 v, u16 f)
+WRAM_CODE u16 MulU(u8 v, u16 f)
 {
     const u8  f_h = f >> 8;
     const u8  f_l = f & 0xFF;
@@ -27,7 +28,7 @@ u16 MulU(u8 v, u16 f)
     return hm + (lm >> 8);
 }
 
-s16 MulS(u8 v, s16 f)
+WRAM_CODE s16 MulS(u8 v, s16 f)
 {
     const u16 uf = MulU(v, (u16)(ABS(f)));
     if(f < 0)
@@ -37,7 +38,7 @@ s16 MulS(u8 v, s16 f)
     return uf;
 }
 
-s16 MulTan(u8 value, bool inverse, u8 quarter, u8 angle, const u16* lookupTable)
+WRAM_CODE s16 MulTan(u8 value, bool inverse, u8 quarter, u8 angle, const u16* lookupTable)
 {
     u8 signedValue = value;
     if(inverse)
@@ -63,7 +64,7 @@ s16 MulTan(u8 value, bool inverse, u8 quarter, u8 angle, const u16* lookupTable)
     return MulU(signedValue, LOOKUP16(lookupTable, angle));
 }
 
-s16 AbsTan(u8 quarter, u8 angle, const u16* lookupTable)
+WRAM_CODE s16 AbsTan(u8 quarter, u8 angle, const u16* lookupTable)
 {
     if(quarter & 1)
     {
@@ -72,45 +73,6 @@ s16 AbsTan(u8 quarter, u8 angle, const u16* lookupTable)
     return LOOKUP16(lookupTable, angle);
 }
 
-/*
-u8 Arctan(s16 *dy, s16 *dx) {
-  // Handle zero division (favoring right angles)
-
-  if (*dx == 0) {
-  	return 0;
-  }
-
-  // Pre-calculated constants for table lookup (adjust based on your table size)
-  u16 RECIP_MAX_DY =  (1 << (4))  // Reciprocal of max dy (fixed-point)
-
-  // Ensure dx is always positive for lookup (flip sign if needed)
-  bool negativeX = *dx < 0;
-  *dx = ABS(*dx);
-
-  // Calculate approximate index using multiplication and bit shifting
-  int index = (*dy * RECIP_MAX_DY) >> (4);
-
-  // Clamp index to table size
-  if (index < 0) {
-    index = 0;
-  } else if (index >= 256) {
-    index = 256 - 1;
-  }
-
-  // Lookup arctangent value from the table
-  u8 arctan = g_arctan_table[index];
-
-  // Restore sign if dx was negative
-  if (negativeX) {
-    arctan = _PI - arctan;
-  }
-
-  // Linear interpolation for better accuracy (optional)
-  // ... (implement linear interpolation using additional pre-calculated values)
-
-  return arctan;
-}*/
-
 /* Wall type and tile coords of the last ray hit (set by CalculateDistance, read by TraceFrame) */
 u8 g_lastWallType = 1;
 u8 g_lastWallTileX = 0;
@@ -121,7 +83,7 @@ u8 g_centerWallType = 0;
 u8 g_centerWallTileX = 0;
 u8 g_centerWallTileY = 0;
 
-bool IsWall(u8 tileX, u8 tileY)
+WRAM_CODE bool IsWall(u8 tileX, u8 tileY)
 {
     if(tileX > MAP_X - 1 || tileY > MAP_Y - 1)
     {
@@ -130,7 +92,7 @@ bool IsWall(u8 tileX, u8 tileY)
     return g_map[(u16)tileY * MAP_X + (u16)tileX] != 0;
 }
 
-u8 GetWallType(u8 tileX, u8 tileY)
+WRAM_CODE u8 GetWallType(u8 tileX, u8 tileY)
 {
     if(tileX > MAP_X - 1 || tileY > MAP_Y - 1)
     {
@@ -139,7 +101,7 @@ u8 GetWallType(u8 tileX, u8 tileY)
     return g_map[(u16)tileY * MAP_X + (u16)tileX];
 }
 
-void LookupHeight(u16 distance, u8* height, u16* step) {
+WRAM_CODE void LookupHeight(u16 distance, u8* height, u16* step) {
     if(distance >= 256)  {
         const u16 ds = distance >> 3;
         if(ds >= 256) {
@@ -157,7 +119,7 @@ void LookupHeight(u16 distance, u8* height, u16* step) {
     }
 }
 
-void CalculateDistance(u16 rayX, u16 rayY, u16 rayA, s16* deltaX, s16* deltaY, u8* textureNo, u8* textureX)
+WRAM_CODE void CalculateDistance(u16 rayX, u16 rayY, u16 rayA, s16* deltaX, s16* deltaY, u8* textureNo, u8* textureX)
 {
     register s8  tileStepX = 0;
     register s8  tileStepY = 0;
@@ -323,6 +285,9 @@ bool hasLineOfSight(u16 fromX, u16 fromY, u16 toX, u16 toY)
     s8 sy = (dy > 0) ? 1 : -1;
     if (dx < 0) dx = -dx;
     if (dy < 0) dy = -dy;
+    /* Parts of the level that never see each other (baked sight table) */
+    if (!levelMaySee((u8)x0, (u8)y0, (u8)x1, (u8)y1))
+        return false;
     {
         s16 err = (s16)dx - (s16)dy;
         while (x0 != x1 || y0 != y1) {
@@ -363,7 +328,7 @@ bool hasLineOfSight(u16 fromX, u16 fromY, u16 toX, u16 toY)
 
 // (playerX, playerY) is 8 box coordinate bits, 8 inside coordinate bits
 // (playerA) is full circle as 1024
-void Trace(u16 screenX, u8* screenY, u8* textureNo, u8* textureX, u16* textureY, u16* textureStep)
+WRAM_CODE void Trace(u16 screenX, u8* screenY, u8* textureNo, u8* textureX, u16* textureY, u16* textureStep)
 {
     u16 rayAngle = (u16)(_playerA + LOOKUP16(g_deltaAngle, screenX));
 
@@ -4,6 +4,7 @@
 #include <math.h>
 #include <types.h>
 #include <stdbool.h>
+#include <wram.h>
 // Define the maximum distance for which we want to precalculate square roots
 /*
 #define MAX_DISTANCE (u16)MIN_DIST;
@@ -15,7 +16,7 @@
 u16 sqrtLookupTable[] MAX_DISTANCE + 1];*/
 
 void Start(u16 playerX, u16 playerY, s16 playerA);
-void Trace(u16 screenX, u8* screenY, u8* textureNo, u8* textureX, u16* textureY, u16* textureStep);
+void Trace(u16 screenX, u8* screenY, u8* textureNo, u8* textureX, u16* textureY, u16* textureStep) WRAM_CODE;
 
 void TraceEnemy(u16 *enemyX, u16 *enemyY, u8* screenY, u8* textureNo, u8* textureX, u16* textureY, u16* textureStep, u16 *enemyScreenX);
 void TopDownEnemyPosition(u16 enemyX, u16 enemyY, s16* screenX, u16* screenY, f16* scale, s8* scaleInt, bool *withinView);
@@ -27,9 +28,9 @@ u8  _viewQuarter;
 u8  _viewAngle;
 
 void CalculateObjectScreenPosition(u16 objectX, u16 objectY, u16 objectWidth, u16 objectHeight, u8* screenX, u8* screenY, u8* scale, bool* shouldDraw);
-void     LookupHeight(u16 distance, u8* height, u16* step);
-bool     IsWall(u8 tileX, u8 tileY);
-u8       GetWallType(u8 tileX, u8 tileY);
+void     LookupHeight(u16 distance, u8* height, u16* step) WRAM_CODE;
+bool     IsWall(u8 tileX, u8 tileY) WRAM_CODE;
+u8       GetWallType(u8 tileX, u8 tileY) WRAM_CODE;
 
 /* Wall type and tile coords of the last ray hit (set by CalculateDistance, read by TraceFrame) */
 extern u8 g_lastWallType;
@@ -40,11 +41,10 @@ extern u8 g_lastWallTileY;
 extern u8 g_centerWallType;
 extern u8 g_centerWallTileX;
 extern u8 g_centerWallTileY;
-s16  MulTan(u8 value, bool inverse, u8 quarter, u8 angle, const u16* lookupTable);
-s16  AbsTan(u8 quarter, u8 angle, const u16* lookupTable);
-//u8 Arctan(s16 *y, s16 *x);
-u16 MulU(u8 v, u16 f);
-s16  MulS(u8 v, s16 f);
+s16  MulTan(u8 value, bool inverse, u8 quarter, u8 angle, const u16* lookupTable) WRAM_CODE;
+s16  AbsTan(u8 quarter, u8 angle, const u16* lookupTable) WRAM_CODE;
+u16 MulU(u8 v, u16 f) WRAM_CODE;
+s16  MulS(u8 v, s16 f) WRAM_CODE;
 
 void getObjectScreenPosAndScale(u16 *objX, u16 *objY, bool *isVisible, u16 *resX, u16 *resY, s32 *scale);
 
@@ -54,6 +54,9 @@ void fPlayerJaw(s32 iValue);
 void fPlayerMoveForward(u16 *ifPlayerX, u16 *ifPlayerY, s16 ifPlayerAng, s16 iSpeed);
 void fPlayerStrafe(u16 *ifPlayerX, u16 *ifPlayerY, s16 ifPlayerAng, s16 iSpeed);
 
+/* DDA ray walk: wall delta, texture and hit tile for one ray (runs from WRAM) */
+void CalculateDistance(u16 rayX, u16 rayY, u16 rayA, s16* deltaX, s16* deltaY, u8* textureNo, u8* textureX) WRAM_CODE;
+
 /* Cast a ray from (rayX,rayY) along angle rayA and return exact wall hit position */
 void CastRayHitPos(u16 rayX, u16 rayY, u16 rayA, s16* outHitX, s16* outHitY);
 
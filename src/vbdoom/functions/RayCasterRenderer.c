@@ -11,6 +11,7 @@
 #include "doomgfx.h"
 #include "link.h"
 #include "teleport.h"
+#include "timer.h"
 #include "../assets/images/sprites/marine/marine_sprites.h"
 #include "../assets/images/sprites/teleport/teleport_sprites.h"
 #include "../assets/images/sprites/pickups/pickup_sprites.h"
@@ -36,31 +37,17 @@ extern u8 g_map[];
  * At ~576 calls/frame, this saves ~34,000 cycles/frame.
  */
 #define BGMAP1_ENTRY(py, px) (*((u16*)(BGMap(1) + ((u32)(py) << 4) + ((u32)((px) << 1) >> 3))))
-#define DRAW_TILE(px, py, tilePos)    BGMAP1_ENTRY(py, px) = *((u16*)(vb_doomMap + (tilePos)))
-#define DRAW_TILE_CHAR(px, py, ch)    BGMAP1_ENTRY(py, px) = (u16)(ch) | 0xC000u  /* BGM_PAL3 */
+#define DRAW_TILE(px, py, tilePos)    (VRAM_COUNT(BGMap(1), 2), \
+	BGMAP1_ENTRY(py, px) = *((u16*)(vb_doomMap + (tilePos))))
+#define DRAW_TILE_CHAR(px, py, ch)    (VRAM_COUNT(BGMap(1), 2), \
+	BGMAP1_ENTRY(py, px) = (u16)(ch) | 0xC000u)  /* BGM_PAL3 */
 
 s32 diffX = 0;
 s32 diffY = 0;
 
 /* Forward declarations */
 void drawTile(u16 *iX, u8 *iStartY, u16 *iStartPos);
-void affine_enemy_scale(u8 world, f16 invScale, s16 mxOffset, s16 myOffset);
-
-s32 sqrt_i32(s32 v) {
-    uint32_t b = 1<<30, q = 0, r = v;
-    while (b > r)
-        b >>= 2;
-    while( b > 0 ) {
-        uint32_t t = q + b;
-        q >>= 1;
-        if( r >= t ) {
-            r -= t;
-            q += b;
-        }
-        b >>= 2;
-    }
-    return q;
-}
+void affine_enemy_scale(u8 world, f16 invScale, s16 mxOffset, s16 myOffset) WRAM_CODE;
 
 /* Forward declarations */
 void drawTile(u16 *iX, u8 *iStartY, u16 *iStartPos);
@@ -126,20 +113,12 @@ static void worldToView(s16 dX, s16 dY, s16 *viewZ, s16 *viewX) {
     }
 }
 
-void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA)
+/* Wall column loop: one ray per RAYCAST_STEP columns, writes the ceiling,
+ * wall and floor tiles of BGMap 1 plus the per-column occlusion data
+ * (g_wallSso, g_doorGapY) used by the sprite passes in TraceFrame.
+ * Runs from WRAM together with Trace/CalculateDistance. */
+WRAM_CODE static void traceColumns(void)
 {
-	Start(*playerX, *playerY, *playerA);
-
-	/* Cache trig lookups once per frame for all sprite transforms */
-	g_cachedCos = LOOKUP8(g_cos, _viewAngle);
-	g_cachedSin = LOOKUP8(g_sin, _viewAngle);
-	g_cachedCosInv = LOOKUP8(g_cos, INVERT(_viewAngle));
-	g_cachedSinInv = LOOKUP8(g_sin, INVERT(_viewAngle));
-	/*
-    Start((u16)(playerX * 256.0),
-               (u16)(playerY * 256.0),
-               (s16)(playerA / (2.0 * M_PI) * 1024.0));*/
-
     for(x = 0; x < SCREEN_WIDTH; x+=RAYCAST_STEP)
     {
 		/* --- See-through door locals --- */
@@ -215,7 +194,7 @@ void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA)
 		if (!isDoorPartial && (g_lastWallType == WALL_TYPE_DOOR || (g_lastWallType >= 6 && g_lastWallType <= 11))) {
 			u8 doorOpen = getDoorOpenAmount(g_lastWallTileX, g_lastWallTileY);
 			if (doorOpen > 0) {
-				u16 reduction = ((u16)ssoX2 * doorOpen) / DOOR_OPEN_MAX;
+				u16 reduction = ((u16)ssoX2 * doorOpen) >> DOOR_OPEN_SHIFT;
 				if (reduction >= ssoX2) {
 					ssoX2 = 0;
 					sso = 0;
@@ -338,7 +317,7 @@ void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA)
 			door_wsP8 = door_ws_v & 7;
 
 			/* Apply door height reduction */
-			door_reduction = ((u16)door_ssoX2_v * (u16)door_openAmt) / DOOR_OPEN_MAX;
+			door_reduction = ((u16)door_ssoX2_v * (u16)door_openAmt) >> DOOR_OPEN_SHIFT;
 			if (door_reduction >= door_ssoX2_v)
 				door_ssoX2_v = 0;
 			else
@@ -400,6 +379,46 @@ void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA)
 			g_doorGapY[x / RAYCAST_STEP] = curY;
 		}
     }
+}
+
+/* Center ray only, for USE activation (playerActivate) without drawing:
+ * what traceColumns saves at the center column. The lockstep co-op sim
+ * needs it for both players and on every frame, drawn or not. A door
+ * that is partly open counts as the wall it is (no re-trace behind it). */
+void TraceCenter(u16 playerX, u16 playerY, s16 playerA)
+{
+	u8 csso, ctn, ctc;
+	u16 ctso, ctst;
+
+	Start(playerX, playerY, playerA);
+	Trace(192, &csso, &ctn, &ctc, &ctso, &ctst);
+	g_centerWallType = g_lastWallType;
+	g_centerWallTileX = g_lastWallTileX;
+	g_centerWallTileY = g_lastWallTileY;
+	g_wallSso[RAYCAST_CENTER_COL] = csso > HORIZON_HEIGHT ? HORIZON_HEIGHT : csso;
+}
+
+void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA)
+{
+	Start(*playerX, *playerY, *playerA);
+
+	/* Cache trig lookups once per frame for all sprite transforms */
+	g_cachedCos = LOOKUP8(g_cos, _viewAngle);
+	g_cachedSin = LOOKUP8(g_sin, _viewAngle);
+	g_cachedCosInv = LOOKUP8(g_cos, INVERT(_viewAngle));
+	g_cachedSinInv = LOOKUP8(g_sin, INVERT(_viewAngle));
+	/*
+    Start((u16)(playerX * 256.0),
+               (u16)(playerY * 256.0),
+               (s16)(playerA / (2.0 * M_PI) * 1024.0));*/
+
+    traceColumns();
+
+    /* Walls are in, unfenced (a draw catching them mixes old and new
+     * columns for one display frame, see timer.h); the sprite worlds
+     * and affine params below show half-done when they land mid-draw:
+     * start them once the VIP has finished drawing the current frame. */
+    vipWaitIdle();
 
     // === ENEMY RENDERING ===
     // Single layer per enemy using dedicated zombie sprite character memory.
@@ -1242,7 +1261,7 @@ void drawTileChar(u16 *iX, u8 *iStartY, u16 charIdx) {
  * Entries 1, 4-7 (always zero) are pre-cleared by initEnemyBGMaps().
  * Uses rounding (+32) when converting YSrc from 23.9 to 13.3 fixed-point.
  */
-void affine_enemy_scale(u8 world, f16 invScale, s16 mxOffset, s16 myOffset) {
+WRAM_CODE void affine_enemy_scale(u8 world, f16 invScale, s16 mxOffset, s16 myOffset) {
 	int tmp, scanline, height;
 	s16 *param;
 	f16 XScl, YScl;
@@ -1256,6 +1275,7 @@ void affine_enemy_scale(u8 world, f16 invScale, s16 mxOffset, s16 myOffset) {
 	XScl = YScl = invScale;  /* already 7.9 fixed-point reciprocal */
 	height = (int)WAM[tmp + 8];
 	YSrc = (f32)((s32)myOffset << 6);  /* convert 13.3 to accumulator format */
+	VRAM_COUNT(param, height * 6);
 
 	for (scanline = 0; scanline < height; scanline++) {
 		int base = scanline << 3;
@@ -1279,6 +1299,7 @@ void affine_fast_scale_fixed2(u8 world, f16 scale) {
 
 	XScl = YScl = scale;
 	YSrc = 0;
+	VRAM_COUNT(param, (int)WAM[tmp+8] * 6);
 
 	i=0;
 	while (i < (int)(WAM[tmp+8]<<3)) {
@@ -1290,28 +1311,3 @@ void affine_fast_scale_fixed2(u8 world, f16 scale) {
 		YSrc += YScl; //grab value of next scanline
 	}
 }
-
-/*
-void affine_fast_scale(u8 world, float scale) {
-	int i,tmp;
-	s16 *param;
-	f16 XScl,YScl;
-	f32 YSrc;
-
-	tmp = (world<<4);
-	param = (s16*)((WAM[tmp+9]<<1)+0x00020000);
-
-	XScl = YScl = inverse_fixed(scale);
-	YSrc = 0;
-
-	i=0;
-	while (i < (int)(WAM[tmp+8]<<3)) {
-		param[i++] = 0;			//XSrc
-		i++;					//Prlx
-		param[i++] = (YSrc>>6);	//YSrc -- convert from 7.9 to 13.3 fixed
-		param[i++] = XScl; 		//XScl
-		i+=4; //skip remaining entries
-
-		YSrc += YScl; //grab value of next scanline
-	}
-}*/
\ No newline at end of file
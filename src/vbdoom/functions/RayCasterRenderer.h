@@ -5,6 +5,7 @@
 typedef int64_t s64;
 u32 GetARGB(u8 brightness);
 void TraceFrame(u16 *playerX, u16 *playerY, s16 *playerA);
+void TraceCenter(u16 playerX, u16 playerY, s16 playerA);
 void clearTiles(u8 bgmap);
 
 void affine_fast_scale_fixed2(u8 world, f16 scale);
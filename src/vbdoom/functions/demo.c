@@ -0,0 +1,192 @@
+/*
+ * demo.c -- timedemo recording and playback (see demo.h)
+ */
+
+#include <libgccvb.h>
+#include <constants.h>
+#include "timer.h"
+#include "demo.h"
+
+
+extern BYTE vb_doomMap[];
+
+u8 g_demoMode = DEMO_OFF;
+
+u16 g_demoFrames = 0;
+u16 g_demoAvgTicks = 0;
+u16 g_demoWorstTicks = 0;
+
+static u8 demoLevel = 0;
+static u16 demoSeedValue = 0;
+static u16 demoRuns = 0;      /* runs in SRAM (record) / in the demo (playback) */
+static u16 demoRunIdx = 0;    /* playback: next run to read */
+static u16 runPad = 0;        /* current run */
+static u8 runLeft = 0;        /* record: frames in it, playback: frames left */
+static bool demoDone = false;
+
+static u32 tickSum = 0;
+static u16 tickLast = 0;
+
+/* SRAM is 8 bits wide: one byte per 16-bit SAVERAM word */
+#define SRAM_RD(i)      ((u8)SAVERAM[i])
+#define SRAM_WR(i, b)   (SAVERAM[i] = (u8)(b))
+
+static void demoReset(u8 mode) {
+	g_demoMode = mode;
+	demoRuns = 0;
+	demoRunIdx = 0;
+	runPad = 0;
+	runLeft = 0;
+	demoDone = false;
+	tickSum = 0;
+	g_demoFrames = 0;
+	g_demoWorstTicks = 0;
+}
+
+void demoStartRecord(u8 level) {
+	demoReset(DEMO_RECORD);
+	demoLevel = level;
+	demoSeedValue = (u16)g_musicTick;   /* time since boot: differs every run */
+	SRAM_WR(0, 0);                      /* invalidate until demoStop */
+}
+
+u8 demoStartPlayback(void) {
+	demoReset(DEMO_OFF);
+	if (SRAM_RD(0) != 'V' || SRAM_RD(1) != 'D' || SRAM_RD(2) != DEMO_VERSION)
+		return 0;
+	demoRuns = SRAM_RD(6) | ((u16)SRAM_RD(7) << 8);
+	if (demoRuns == 0 || demoRuns > DEMO_MAX_RUNS)
+		return 0;
+	demoLevel = SRAM_RD(3);
+	demoSeedValue = SRAM_RD(4) | ((u16)SRAM_RD(5) << 8);
+	g_demoMode = DEMO_PLAYBACK;
+#ifdef MUSIC_JITTER
+	setmem((void*)g_musJitter, 0, sizeof(g_musJitter));
+#endif
+	return demoLevel;
+}
+
+u16 demoSeed(void) {
+	if (g_demoMode == DEMO_OFF)
+		return (u16)g_musicTick;
+	return demoSeedValue;
+}
+
+static void demoFlushRun(void) {
+	u16 at;
+
+	if (runLeft == 0) return;
+	if (demoRuns >= DEMO_MAX_RUNS) {
+		demoDone = true;
+		return;
+	}
+	at = DEMO_HEADER + demoRuns * 3;
+	SRAM_WR(at, runPad);
+	SRAM_WR(at + 1, runPad >> 8);
+	SRAM_WR(at + 2, runLeft);
+	demoRuns++;
+	runLeft = 0;
+}
+
+u16 demoInput(u16 pad) {
+	if (g_demoMode == DEMO_RECORD) {
+		if (pad & K_STA) {
+			demoDone = true;    /* Start ends the recording, the game never sees it */
+			return 0;
+		}
+		if (runLeft == 0 || pad != runPad || runLeft == 255) {
+			demoFlushRun();
+			runPad = pad;
+		}
+		runLeft++;
+		g_demoFrames++;
+		return pad;
+	}
+
+	if (g_demoMode == DEMO_PLAYBACK) {
+		if (g_demoFrames == 0)
+			tickLast = (u16)g_musicTick;
+		if (pad & K_STA) {
+			demoDone = true;
+			return 0;
+		}
+		if (runLeft == 0) {
+			u16 at;
+			if (demoRunIdx >= demoRuns) {
+				demoDone = true;
+				return 0;
+			}
+			at = DEMO_HEADER + demoRunIdx * 3;
+			runPad = SRAM_RD(at) | ((u16)SRAM_RD(at + 1) << 8);
+			runLeft = SRAM_RD(at + 2);
+			demoRunIdx++;
+		}
+		runLeft--;
+		return runPad;
+	}
+
+	return pad;
+}
+
+bool demoFinished(void) {
+	return g_demoMode != DEMO_OFF && demoDone;
+}
+
+void demoFrameEnd(void) {
+	u16 now, dt;
+
+	if (g_demoMode != DEMO_PLAYBACK) return;
+	now = (u16)g_musicTick;
+	dt = (u16)(now - tickLast);
+	tickLast = now;
+	tickSum += dt;
+	if (dt > g_demoWorstTicks) g_demoWorstTicks = dt;
+	g_demoFrames++;
+}
+
+/* 5 digits, leading blanks, at byte offset off in the HUD BGMap.
+ * vb_doomMap row 18 holds the HUD digits, entry 10 is blank. */
+static void demoDrawNumber(u16 off, u16 val) {
+	u8 d[5];
+	s8 i;
+	bool lead = true;
+
+	for (i = 4; i >= 0; i--) {
+		d[i] = (u8)(val % 10);
+		val /= 10;
+	}
+	VRAM_COUNT(BGMap(LAYER_UI), 12);
+	for (i = 0; i < 5; i++) {
+		if (d[i] || i == 4) lead = false;
+		*((u16*)(BGMap(LAYER_UI) + off + i * 2)) =
+			*((u16*)(vb_doomMap + 96*18 + (lead ? 10 : d[i]) * 2));
+	}
+	*((u16*)(BGMap(LAYER_UI) + off + 10)) = *((u16*)(vb_doomMap + 96*18 + 10 * 2));
+}
+
+static void demoShowResult(void) {
+	demoDrawNumber(0, g_demoFrames);
+	demoDrawNumber(16, g_demoAvgTicks);
+	demoDrawNumber(32, g_demoWorstTicks);
+
+	while (vbReadPad() & K_ANY) vbWaitFrame(0);
+	while (!(vbReadPad() & K_ANY)) vbWaitFrame(0);
+}
+
+void demoStop(void) {
+	if (g_demoMode == DEMO_RECORD) {
+		demoFlushRun();
+		SRAM_WR(2, DEMO_VERSION);
+		SRAM_WR(3, demoLevel);
+		SRAM_WR(4, demoSeedValue);
+		SRAM_WR(5, demoSeedValue >> 8);
+		SRAM_WR(6, demoRuns);
+		SRAM_WR(7, demoRuns >> 8);
+		SRAM_WR(1, 'D');
+		SRAM_WR(0, 'V');
+	} else if (g_demoMode == DEMO_PLAYBACK) {
+		g_demoAvgTicks = g_demoFrames ? (u16)(tickSum / g_demoFrames) : 0;
+		demoShowResult();
+	}
+	g_demoMode = DEMO_OFF;
+}
@@ -0,0 +1,75 @@
+/*
+ * demo.h -- timedemo: record the pad, play it back as a benchmark
+ *
+ * A demo is the start level, the seed of the game random stream (rnd8,
+ * libgccvb/random.h) and the vbReadPad() value of every game frame,
+ * run-length coded. With the same seed and the same input the game runs
+ * the same frames, so a playback is a repeatable workload.
+ *
+ * Demos live in cartridge SRAM (one byte per SAVERAM word):
+ *   0..1  'V' 'D'       magic, written last so a cut recording never loads
+ *   2     DEMO_VERSION
+ *   3     start level
+ *   4..5  seed          low byte first
+ *   6..7  run count     low byte first
+ *   8..   runs, 3 bytes each: pad low, pad high, frames (1..255)
+ *
+ * Title screen: New Game with L held records, with R held plays back.
+ * Recording stops on Start or at the end of the level. Playback runs
+ * without frame pacing (as fast as the game goes), stops at the end of
+ * the input, the end of the level or on Start, then shows the result on
+ * the HUD until a key is pressed:
+ *   frames    average frame    worst frame      (timer ticks, ~8 per ms)
+ * With MUSIC_JITTER (debug builds) g_musJitter holds the music dispatch
+ * jitter of the run (timer.h), for a debugger's memory view. Playback
+ * runs on the console or an emulator only; there is no host build of the
+ * game (tools/vsu_render measures the jitter of the sequencer alone).
+ */
+#ifndef _FUNCTIONS_DEMO_H
+#define _FUNCTIONS_DEMO_H
+
+#include <types.h>
+#include <stdbool.h>
+
+#define DEMO_OFF        0
+#define DEMO_RECORD     1
+#define DEMO_PLAYBACK   2
+
+#define DEMO_VERSION    2       /* 2: the face no longer draws from rnd8 */
+#define DEMO_HEADER     8       /* bytes before the first run */
+#define DEMO_SRAM_SIZE  8192    /* bytes of SRAM we may use */
+#define DEMO_MAX_RUNS   ((DEMO_SRAM_SIZE - DEMO_HEADER) / 3)
+
+extern u8 g_demoMode;
+
+/* Result of the last playback */
+extern u16 g_demoFrames;
+extern u16 g_demoAvgTicks;
+extern u16 g_demoWorstTicks;
+
+/* Start recording a game that begins on level. */
+void demoStartRecord(u8 level);
+
+/* Load the demo header from SRAM. Returns its start level, 0 if there is
+ * no valid demo (the mode stays DEMO_OFF). */
+u8 demoStartPlayback(void);
+
+/* Seed for the game random stream: the demo's in playback, a fresh one
+ * (kept for the header) otherwise. Call once when the game starts. */
+u16 demoSeed(void);
+
+/* Per frame, on the raw pad value: records it or replaces it with the
+ * recorded one. Returns the input the game should use. */
+u16 demoInput(u16 pad);
+
+/* True once the demo has run out (input exhausted, SRAM full, Start). */
+bool demoFinished(void);
+
+/* Per frame, after the frame wait: playback frame timing. */
+void demoFrameEnd(void);
+
+/* End the demo: write the SRAM header (record) or compute and show the
+ * result (playback). Back to DEMO_OFF. */
+void demoStop(void);
+
+#endif
@@ -220,6 +220,7 @@ void drawSmallAmmo(u16 iAmmo, u8 iAmmoType) {
 		case 4: drawPos = 3280+256-3072; break;
 	}
 	startPos = 96*18;
+	VRAM_COUNT(BGMap(LAYER_UI), 6);
 	if (hundreds > 0) {
 		*((u16*)(BGMap(LAYER_UI)+drawPos)) = *((u16*)(vb_doomMap+startPos+(hundreds*2)));
 	} else {
@@ -252,6 +253,7 @@ void drawWeaponSlotNumbers(u8 hasPistol, u8 hasShotgun, u8 hasRocket, u8 hasChai
 
 #define DRAW_SLOT(bgOff, digit) do { \
 	mapByteOff = ((18 + (style)) * 48 + (digit)) * 2; \
+	VRAM_COUNT(BGMap(LAYER_UI), 2); \
 	*((u16*)(BGMap(LAYER_UI) + (bgOff))) = *((u16*)(vb_doomMap + mapByteOff)); \
 } while(0)
 
@@ -686,6 +688,7 @@ void drawDoomUI(u8 bgmap, u16 x, u16 y) {
 	{
 		u16 blkTile;
 		copymem((void*)&blkTile, (void*)(vb_doomMap+384), 2);
+		VRAM_COUNT(BGMap(LAYER_UI_BLACK), 4 * 128);
 		for (y = 0; y < 4; y++) {
 			u16 rowBase = y * 128;
 			u16 col;
@@ -732,6 +735,7 @@ void drawKeyCards(u8 hasRed, u8 hasYellow, u8 hasBlue) {
 	 * It shows up as a small bright dot. */
 	u16 keyTile;
 	copymem((void*)&keyTile, (void*)(vb_doomMap + 18*96 + 20), 2);  /* ":" tile */
+	VRAM_COUNT(BGMap(LAYER_UI), 6);
 
 	/* Row 1, col 20 = byte offset 128 + 40 = 168 */
 	if (hasRed)
@@ -770,6 +774,7 @@ void drawFragHUD(u8 fragCount) {
 		fragOnes = fragCount - (u8)(q * 10);
 		fragTens = (u8)q;
 
+		VRAM_COUNT(BGMap(LAYER_UI), 4);
 		if (fragTens > 0) {
 			*((u16*)((void*)BGMap(LAYER_UI) + 322)) = *((u16*)(vb_doomMap + digitOff + fragTens * 2));
 		} else {
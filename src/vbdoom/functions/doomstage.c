@@ -20,10 +20,9 @@ extern u16 e1m1SegsLength;
 extern u16 e1m1VerticesLength;
 extern u16 e1m1ThingsLength;
 
-struct xy { float x,y; } *vertex;
+struct xy { fix23_9 x,y; } *vertex;
 
 struct secx1x2 { int sec; int sx1,sx2; } now;
-struct fsecx1x2 { s32 sec; s32 sx1,sx2; } fnow;
 //now = { sectorno: player.sectorno, sx1: 0, sx2: W - 1 };
 
 int sectorCeil = 128;
@@ -38,27 +37,15 @@ s32 fixedAngleRatio = FTOFIX23_9(512.0f/360.0f); // 512.0f/
 s32 fixedPlayerAngleCos;
 s32 fixedPlayerAngleSin;
 s32 fixedPlayerYaw;
-s32 fixedNearZ = FTOFIX23_9(1e-4f);
+s32 fixedNearZ = 1;	/* smallest 23.9 step (float renderer used 1e-4) */
 s32 fixedFarZ = ITOFIX23_9(5);
-s32 fixedNearside = FTOFIX23_9(1e-5f);
+s32 fixedNearside = 1;	/* smallest 23.9 step (float renderer used 1e-5) */
 s32 fixedFarside = FTOFIX23_9(20.0f);
 
 s32 fixed512 = FTOFIX23_9(512.0f);
 s32 fixed90 = FTOFIX23_9(90.0f);
 
-
-float playerAngle;
-float playerX,playerY,playerZ;
-float angleRatio = 512.0f/360.0f; // 1.42222
-float playerAngleCos;
-float playerAngleSin;
-float playerYaw;
 #define FixedYaw(y,z) (y + FIX23_9_MULT(z, fixedPlayerYaw))
-#define Yaw(y,z) (y + z*playerYaw)
-float nearz = 1e-4f;
-float farz = 5;
-float nearside = 1e-5f;
-float farside = 20.0f;
 /* Define window size */
 #define EyeHeight 41
 #define FixedEyeHeight ITOFIX23_9(EyeHeight)
@@ -68,13 +55,10 @@ float farside = 20.0f;
 #define Hby2 (H/2)
 
 
-//#define hfov (0.73f*H)  // Affects the horizontal field of vision
-//#define vfov (.2f*H)    // Affects the vertical field of vision
-#define hfov (0.7f*H)  // Affects the horizontal field of vision
-#define vfov (.8f*H)    // Affects the vertical field of vision
-
-#define fhfov FTOFIX23_9(hfov)  // Affects the horizontal field of vision
-#define fvfov FTOFIX23_9(vfov)    // Affects the vertical field of vision
+//#define fhfov (ITOFIX23_9(H*73)/100)  // Affects the horizontal field of vision
+//#define fvfov (ITOFIX23_9(H*2)/10)    // Affects the vertical field of vision
+#define fhfov (ITOFIX23_9(H*7)/10)  // Affects the horizontal field of vision (0.7*H)
+#define fvfov (ITOFIX23_9(H*8)/10)  // Affects the vertical field of vision (0.8*H)
 
 int ytop[W];
 int ybottom[H];
@@ -87,8 +71,6 @@ void initializeDoomStage() {
 
 	now.sx1 = 0;
 	now.sx2 = W-1;
-	fnow.sx1 = ITOFIX23_9(0);
-	fnow.sx2 = ITOFIX23_9(W-1);
 	int x;
 	for(x=0; x<W; x++) {
 		ytop[x] = 0;
@@ -99,21 +81,11 @@ void initializeDoomStage() {
 		// 0x,1y,2angle,3type,4flags
 		if (e1m1Things[i+3] == 1) {
 			// the player
-			playerX = e1m1Things[i];
-			playerY = e1m1Things[i+1];
-			playerZ = 0;
-			playerYaw = 0;
-
 			fixedPlayerX = ITOFIX23_9(e1m1Things[i]);
 			fixedPlayerY = ITOFIX23_9(e1m1Things[i+1]);
 			fixedPlayerZ = ITOFIX23_9(0);
 			fixedPlayerYaw = ITOFIX23_9(0);
 
-			playerAngle = e1m1Things[i+2]*angleRatio;
-			playerAngleCos = COSF((int)playerAngle);
-			playerAngleSin = SINF((int)playerAngle);
-
-
 			fixedPlayerAngle = FIX23_9_MULT(ITOFIX23_9(e1m1Things[i+2]), fixedAngleRatio);
 			fixedPlayerAngleCos = COS(FIX23_9TOI(fixedPlayerAngle));
 			fixedPlayerAngleSin = SIN(FIX23_9TOI(fixedPlayerAngle));
@@ -144,203 +116,36 @@ int MM_FIX23_9TOI(n) {
   return (n << 16 >> 19);
 }*/
 
-void fixedDrawDoomStage(u8 bgmap) {
-
-	s32 fvx1=0;
-	s32 fvx2=0;
-	s32 fvy1=0;
-	s32 fvy2=0;
-
-	s32 ftx1=0;
-	s32 ftz1=0;
-	s32 ftx2=0;
-	s32 ftz2=0;
-
-	int fy1a = 0;
-	int fy1b = 0;
-	int fy2a = 0;
-	int fy2b = 0;
-
-	s32 fyceil = 0;
-	s32 fyfloor = 0;
-	int x = 0;
-	int wallsNotDrawn = 0;
-
-	u16 vertexIndex1 = 0;
-	u16 vertexIndex2 = 0;
-
-	s32 fixedWBy2 = ITOFIX23_9(Wby2);
-	s32 fixedHBy2 = ITOFIX23_9(Hby2);
-	s32 fixedZero = ITOFIX23_9(0);
-
-	s32 fixedPlayerZPlusEyeHeight = (fixedPlayerZ + FixedEyeHeight);
-
-	u16 i = 0;
-	// iterate walls
-	for (i = 0; i < e1m1SegsLength; i+= 2) {
-
-		vertexIndex1 = e1m1Segs[i]<<1;
-		vertexIndex2 = e1m1Segs[i+1]<<1;
-
-		fvx1 = fixedPlayerX - ITOFIX23_9(e1m1Vertices[ vertexIndex1 ]);
-		fvy1 = ITOFIX23_9(e1m1Vertices[ vertexIndex1+1 ]) - fixedPlayerY;
-
-		fvx2 = fixedPlayerX - ITOFIX23_9(e1m1Vertices[ vertexIndex2 ]);
-		fvy2 = ITOFIX23_9(e1m1Vertices[ vertexIndex2+1 ]) - fixedPlayerY;
-
-		ftx1 = FIX23_9_MULT(fvx1, fixedPlayerAngleSin) - FIX23_9_MULT(fvy1, fixedPlayerAngleCos);
-		ftz1 = FIX23_9_MULT(fvx1, fixedPlayerAngleCos) + FIX23_9_MULT(fvy1, fixedPlayerAngleSin);
-
-		ftx2 = FIX23_9_MULT(fvx2, fixedPlayerAngleSin) - FIX23_9_MULT(fvy2, fixedPlayerAngleCos);
-		ftz2 = FIX23_9_MULT(fvx2, fixedPlayerAngleCos) + FIX23_9_MULT(fvy2, fixedPlayerAngleSin);
-
-		if (ftz1 <= fixedZero && ftz2 <= fixedZero) {
-			//segNotDrawn1 = vertexIndex1;
-			//segNotDrawn2 = vertexIndex2;
-			wallsNotDrawn++;
-			continue;
-		}
-		if (ftz1 <= ITOFIX23_9(0) || ftz2 <= ITOFIX23_9(0)) {
-		  	struct xy fi1 = FixedIntersect(ftx1,ftz1,ftx2,ftz2, -fixedNearside, fixedNearZ, -fixedFarside, fixedNearZ);
-		  	struct xy fi2 = FixedIntersect(ftx1,ftz1,ftx2,ftz2,  fixedNearside, fixedNearZ, fixedFarside, fixedFarZ);
-			if (ftz1 < fixedNearZ) {
-				if (fi1.y > fixedZero) {
-					ftx1 = fi1.x;
-					ftz1 = fi1.y;
-				} else {
-					ftx1 = fi2.x;
-					ftz1 = fi2.y;
-				}
-			}
-			if (ftz2 < fixedNearZ) {
-				if (fi1.y > fixedZero) {
-					ftx2 = fi1.x;
-					ftz2 = fi1.y;
-				} else {
-					ftx2 = fi2.x;
-					ftz2 = fi2.y;
-				}
-			}
-		}
-
-		/* Do perspective transformation */
-		s32 fxscale1 = FIX23_9_DIV( fhfov, ftz1 );
-		s32 fyscale1 = FIX23_9_DIV( fvfov, ftz1 );
-		s32 fx1 = fixedWBy2 - FIX23_9_MULT(ftx1, fxscale1);
-		s32 fxscale2 = FIX23_9_DIV(fhfov, ftz2);
-		s32 fyscale2 = FIX23_9_DIV(fvfov, ftz2);
-		s32 fx2 = fixedWBy2 - FIX23_9_MULT(ftx2, fxscale2);
-
-		/*if(fx1 >= fx2 || fx2 < fnow.sx1 || fx1 > fnow.sx2) {
-			wallsNotDrawn++;
-			continue; // Only render if it's visible
-		}*/
-		fyceil = fSectorCeil - fixedPlayerZPlusEyeHeight;
-		fyfloor = fSectorFloor - fixedPlayerZPlusEyeHeight;
-		fy1a = fixedHBy2 - FIX23_9_MULT(FixedYaw(fyceil, ftz1), fyscale1);
-		fy1b = fixedHBy2 - FIX23_9_MULT(FixedYaw(fyfloor, ftz1), fyscale1);
-		fy2a = fixedHBy2 - FIX23_9_MULT(FixedYaw(fyceil, ftz2), fyscale2);
-		fy2b = fixedHBy2 - FIX23_9_MULT(FixedYaw(fyfloor, ftz2), fyscale2);
-
-
-		int beginx = 0;
-		int endx = 0;
-		beginx = max(FIX23_9TOI(fx1), FIX23_9TOI(fnow.sx1));
-		endx = min(FIX23_9TOI(fx2), FIX23_9TOI(fnow.sx2));
-
-		if (beginx > endx) {
-		  const s32 tmp = beginx;
-		  beginx = endx;
-		  endx = tmp;
-		}
-
-		if (beginx < 0) {
-			beginx = 0;
-		}
-		if (endx > W) {
-			endx = W;
-		}
-
-
-		for(x = beginx; x < endx; x+=8)
-		{
-		copymem((void*)BGMap(1)+24, (void*)(vb_doomMap+2464), 8);
-		}
-	}
-/*
-	for (i = 0; i < e1m1ThingsLength; i+=5) {
-		if (e1m1Things[i+3] != 1) { // monster or something else... let's assume monster for now... (1 is player)
-
-			fvx1 = fixedPlayerX - ITOFIX23_9(e1m1Things[i]);
-			fvy1 = ITOFIX23_9(e1m1Things[i+1]) - fixedPlayerY;
-			// rotate around player view
-			ftx1 = FIX23_9_MULT(fvx1, fixedPlayerAngleSin) - (fvy1, fixedPlayerAngleCos);
-			ftz1 = FIX23_9_MULT(fvx1, fixedPlayerAngleCos) + (fvy1, fixedPlayerAngleSin);
-			// only display if enemy is in Field-Of-View of player.
-			if (ftz1 <= fixedZero && ftx1 <= fixedZero) {
-				continue;
-			}
-			s32 fxscale1 = FIX23_9_DIV(fhfov, ftz1);
-			s32 fyscale1 = FIX23_9_DIV(fvfov, ftz1);
-			int x1 = FIX23_9TOI( fixedWBy2 - FIX23_9_MULT(ftx1, fxscale1) );
-			int y1b = FIX23_9TOI(fixedHBy2 - (FIX23_9_MULT(FixedYaw(fyfloor, ftz1), fyscale1)));
-			int FourtySixTimesYScale = FIX23_9TOI(FIX23_9_MULT(ITOFIX23_9(46),fyscale1));
-			WA[29].gx = x1;//%8;
-			WA[30].gx = x1;//%8;
-			WA[29].gy = y1b - FourtySixTimesYScale;//%8;
-			WA[30].gy = y1b - FourtySixTimesYScale;
-			u16 startPos = (96*4) + 38; // startpos in image where the enemy is
-			u16 blackStartPos = startPos + (96*34); // startpos in image where the enemy is with different palette
-			u16 curCol = 0;
-			u16 yPos = 0;
-			u16 tilePosition = 0;
-
-			u8 bgmap = 3;
-			for (curCol = 0; curCol < 6; curCol++) {
-				yPos = curCol<<7;
-				copymem((void*)BGMap(3)+yPos, (void*)(vb_doomMap+startPos+(curCol*96)), 10);
-				copymem((void*)BGMap(2)+yPos, (void*)(vb_doomMap+blackStartPos+(curCol*96)), 10);
-			}
-			// scale these two layers...
-			affine_fast_scale_fixed(30, fyscale1);
-			affine_fast_scale_fixed(29, fyscale1);
-		}
-	}*/
-
-	// I forgot what this code does... but I think it's because I use a different palette for LAYER 2 for the enemy... which allows me to use all 4 colors for the enemy if i'd like
-	u8 y;
-	for (y = 0; y < 14; y++) {
-		for (x = 0; x < 10; x++) {
-			BGM_PALSET(2, x, y, BGM_PAL2);
-		}
-	}
-}
-
 void drawDoomStage(u8 bgmap) {
-	float vx1=0;
-	float vx2=0;
-	float vy1=0;
-	float vy2=0;
+	fix23_9 vx1=0;
+	fix23_9 vx2=0;
+	fix23_9 vy1=0;
+	fix23_9 vy2=0;
 
-	float tx1=0;
-	float tz1=0;
-	float tx2=0;
-	float tz2=0;
+	fix23_9 tx1=0;
+	fix23_9 tz1=0;
+	fix23_9 tx2=0;
+	fix23_9 tz2=0;
 
+	fix23_9 xscale1, yscale1;
+	fix23_9 xscale2, yscale2;
+
+	int x1 = 0;
+	int x2 = 0;
 	int y1a = 0;
 	int y1b = 0;
 	int y2a = 0;
 	int y2b = 0;
 
-	int yceil = 0;
-	int yfloor = 0;
+	fix23_9 yceil = 0;
+	fix23_9 yfloor = 0;
 	int x = 0;
 	int wallsNotDrawn = 0;
 
 	u16 vertexIndex1 = 0;
 	u16 vertexIndex2 = 0;
 
-	float playerZPlusEyeHeight = playerZ + EyeHeight;
+	fix23_9 playerZPlusEyeHeight = fixedPlayerZ + FixedEyeHeight;
 
 	u16 i = 0;
 	// iterate walls
@@ -348,26 +153,26 @@ void drawDoomStage(u8 bgmap) {
 		vertexIndex1 = e1m1Segs[i]<<1;
 		vertexIndex2 = e1m1Segs[i+1]<<1;
 
-		vx1 = playerX - e1m1Vertices[ vertexIndex1 ];
-		vy1 = e1m1Vertices[ vertexIndex1+1 ] - playerY;
+		vx1 = fixedPlayerX - ITOFIX23_9(e1m1Vertices[ vertexIndex1 ]);
+		vy1 = ITOFIX23_9(e1m1Vertices[ vertexIndex1+1 ]) - fixedPlayerY;
 
-		vx2 = playerX - e1m1Vertices[ vertexIndex2 ];
-		vy2 = e1m1Vertices[ vertexIndex2+1 ] - playerY;
+		vx2 = fixedPlayerX - ITOFIX23_9(e1m1Vertices[ vertexIndex2 ]);
+		vy2 = ITOFIX23_9(e1m1Vertices[ vertexIndex2+1 ]) - fixedPlayerY;
 
-		tx1 = vx1 * playerAngleSin - vy1 * playerAngleCos;
-		tz1 = vx1 * playerAngleCos + vy1 * playerAngleSin;
+		tx1 = FIX23_9_MULT(vx1, fixedPlayerAngleSin) - FIX23_9_MULT(vy1, fixedPlayerAngleCos);
+		tz1 = FIX23_9_MULT(vx1, fixedPlayerAngleCos) + FIX23_9_MULT(vy1, fixedPlayerAngleSin);
 
-		tx2 = vx2 * playerAngleSin - vy2 * playerAngleCos;
-		tz2 = vx2 * playerAngleCos + vy2 * playerAngleSin;
+		tx2 = FIX23_9_MULT(vx2, fixedPlayerAngleSin) - FIX23_9_MULT(vy2, fixedPlayerAngleCos);
+		tz2 = FIX23_9_MULT(vx2, fixedPlayerAngleCos) + FIX23_9_MULT(vy2, fixedPlayerAngleSin);
 
 		if (tz1 <= 0 && tz2 <= 0) {
 			wallsNotDrawn++;
 			continue;
 		}
 		if (tz1 <= 0 || tz2 <= 0) {
-		  struct xy i1 = Intersect(tx1,tz1,tx2,tz2, -nearside,nearz, -farside,farz);
-		  struct xy i2 = Intersect(tx1,tz1,tx2,tz2,  nearside,nearz,  farside,farz);
-		  if (tz1 < nearz) {
+		  struct xy i1 = FixedIntersect(tx1,tz1,tx2,tz2, -fixedNearside,fixedNearZ, -fixedFarside,fixedFarZ);
+		  struct xy i2 = FixedIntersect(tx1,tz1,tx2,tz2,  fixedNearside,fixedNearZ,  fixedFarside,fixedFarZ);
+		  if (tz1 < fixedNearZ) {
 			if (i1.y > 0) {
 			  tx1 = i1.x;
 			  tz1 = i1.y;
@@ -376,7 +181,7 @@ void drawDoomStage(u8 bgmap) {
 			  tz1 = i2.y;
 			}
 		  }
-		  if (tz2 < nearz) {
+		  if (tz2 < fixedNearZ) {
 			if (i1.y > 0) {
 			  tx2 = i1.x;
 			  tz2 = i1.y;
@@ -385,27 +190,30 @@ void drawDoomStage(u8 bgmap) {
 			  tz2 = i2.y;
 			}
 		  }
+		  // clipping can still leave a vertex on the eye plane
+		  if (tz1 < fixedNearZ) tz1 = fixedNearZ;
+		  if (tz2 < fixedNearZ) tz2 = fixedNearZ;
 		}
 
 		/* Do perspective transformation */
-		float xscale1 = hfov / tz1;
-		float yscale1 = vfov / tz1;
-		int x1 = Wby2 - (int)(tx1 * xscale1);
-		float xscale2 = hfov / tz2;
-		float yscale2 = vfov / tz2;
-		int x2 = Wby2 - (int)(tx2 * xscale2);
+		xscale1 = FIX23_9_DIV(fhfov, tz1);
+		yscale1 = FIX23_9_DIV(fvfov, tz1);
+		x1 = Wby2 - FIX23_9TOI(FIX23_9_MULT(tx1, xscale1));
+		xscale2 = FIX23_9_DIV(fhfov, tz2);
+		yscale2 = FIX23_9_DIV(fvfov, tz2);
+		x2 = Wby2 - FIX23_9TOI(FIX23_9_MULT(tx2, xscale2));
 
 		if(x1 >= x2 || x2 < now.sx1 || x1 > now.sx2) {
 			wallsNotDrawn++;
 			continue; // Only render if it's visible
 		}
 
-		yceil = sectorCeil - playerZPlusEyeHeight;
-		yfloor = sectorFloor - playerZPlusEyeHeight;
-		y1a = Hby2 - (int)(Yaw(yceil, tz1) * yscale1);
-		y1b = Hby2 - (int)(Yaw(yfloor, tz1) * yscale1);
-		y2a = Hby2 - (int)(Yaw(yceil, tz2) * yscale2);
-		y2b = Hby2 - (int)(Yaw(yfloor, tz2) * yscale2);
+		yceil = fSectorCeil - playerZPlusEyeHeight;
+		yfloor = fSectorFloor - playerZPlusEyeHeight;
+		y1a = Hby2 - FIX23_9TOI(FIX23_9_MULT(FixedYaw(yceil, tz1), yscale1));
+		y1b = Hby2 - FIX23_9TOI(FIX23_9_MULT(FixedYaw(yfloor, tz1), yscale1));
+		y2a = Hby2 - FIX23_9TOI(FIX23_9_MULT(FixedYaw(yceil, tz2), yscale2));
+		y2b = Hby2 - FIX23_9TOI(FIX23_9_MULT(FixedYaw(yfloor, tz2), yscale2));
 
 		int beginx = 0;
 		int endx = 0;
@@ -472,20 +280,20 @@ void drawDoomStage(u8 bgmap) {
 	for (i = 0; i < e1m1ThingsLength; i+=5) {
 		if (e1m1Things[i+3] != 1) { // monster or something else... let's assume monster for now... (1 is player)
 
-			vx1 = playerX - e1m1Things[i];
-			vy1 = e1m1Things[i+1] - playerY;
+			vx1 = fixedPlayerX - ITOFIX23_9(e1m1Things[i]);
+			vy1 = ITOFIX23_9(e1m1Things[i+1]) - fixedPlayerY;
 			// rotate around player view
-			tx1 = vx1 * playerAngleSin - vy1 * playerAngleCos;
-			tz1 = vx1 * playerAngleCos + vy1 * playerAngleSin;
+			tx1 = FIX23_9_MULT(vx1, fixedPlayerAngleSin) - FIX23_9_MULT(vy1, fixedPlayerAngleCos);
+			tz1 = FIX23_9_MULT(vx1, fixedPlayerAngleCos) + FIX23_9_MULT(vy1, fixedPlayerAngleSin);
 			// only display if enemy is in Field-Of-View of player.
-			if (tz1 <= 0 && tx1 <= 0) {
-				continue;
+			if (tz1 <= 0) {
+				continue; // behind the player, would divide by zero
 			}
-			float xscale1 = hfov / tz1;
-			float yscale1 = vfov / tz1;
-			int x1 = Wby2 - (int)(tx1 * xscale1);
-			int y1b = Hby2 - (int)(Yaw(yfloor, tz1) * yscale1);
-			int FourtySixTimesYScale = 46*yscale1;
+			xscale1 = FIX23_9_DIV(fhfov, tz1);
+			yscale1 = FIX23_9_DIV(fvfov, tz1);
+			x1 = Wby2 - FIX23_9TOI(FIX23_9_MULT(tx1, xscale1));
+			y1b = Hby2 - FIX23_9TOI(FIX23_9_MULT(FixedYaw(yfloor, tz1), yscale1));
+			int FourtySixTimesYScale = FIX23_9TOI(46*yscale1);
 			WA[29].gx = x1;//%8;
 			WA[30].gx = x1;//%8;
 			WA[29].gy = y1b - FourtySixTimesYScale;//%8;
@@ -501,8 +309,8 @@ void drawDoomStage(u8 bgmap) {
 				copymem((void*)BGMap(2)+yPos, (void*)(vb_doomMap+blackStartPos+(curCol*96)), 10);
 			}
 
-			affine_fast_scale(30, yscale1);
-			affine_fast_scale(29, yscale1);
+			affine_fast_scale(30, FIX23_9TOFIX7_9(yscale1));
+			affine_fast_scale(29, FIX23_9TOFIX7_9(yscale1));
 		}
 	}
 
@@ -548,70 +356,34 @@ void drawDoomStageTile(int iX, int iStartY, int iEndY, u16 iStartPos) {
 }
 
 
-void jawPlayer(float iValue) {
-	playerYaw += iValue;
-}
-void incPlayerAngle(float iValue) {
-	if (playerAngle + iValue < 0) {
-		playerAngle += 512.0f;
-	} else if (playerAngle + iValue > 512.0f) {
-		playerAngle -= 512.0f;
-	}
-	playerAngle = playerAngle + iValue;
-	playerAngleCos = COSF((int)playerAngle);
-	playerAngleSin = SINF((int)playerAngle);
-}
-void playerMoveForward(float iValue) {
-	playerX -= playerAngleCos * iValue;
-	playerY += playerAngleSin * iValue;
-}
-void playerStrafe(float iValue) {
-	float tempangle = playerAngle;
-	tempangle -= 90.0f*angleRatio;
-
-	float tempAngleCos = COSF((int)tempangle);
-	float tempAngleSin = SINF((int)tempangle);
-
-	playerX += tempAngleCos * iValue*angleRatio;
-	playerY -= tempAngleSin * iValue*angleRatio;
-}
-
-void incFixedPlayerAngle(s32 iValue) {
+void incPlayerAngle(fix23_9 iValue) {
 	if (FIX23_9TOI(fixedPlayerAngle + iValue) < 0) {
 		fixedPlayerAngle += fixed512;
 	} else if (FIX23_9TOI(fixedPlayerAngle + iValue) >= 512) {
 		fixedPlayerAngle -= fixed512;
 	}
-	/*
-	playerAngle = playerAngle + iValue;
-	playerAngleCos = COSF((int)playerAngle);
-	playerAngleSin = SINF((int)playerAngle);*/
 	fixedPlayerAngle = fixedPlayerAngle + iValue;
 	fixedPlayerAngleCos = COS(FIX23_9TOI(fixedPlayerAngle));
 	fixedPlayerAngleSin = SIN(FIX23_9TOI(fixedPlayerAngle));
 }
 
-void jawFixedPlayer(s32 iValue) {
+void jawPlayer(fix23_9 iValue) {
 	fixedPlayerYaw += iValue;
 }
 
-void fixedPlayerMoveForward(s32 iValue) {
-	//playerX -= FIX23_9_MULT(fixedPlayerAngleCos, iValue);
-	//playerY += FIX23_9_MULT(fixedPlayerAngleSin, iValue);
+void playerMoveForward(fix23_9 iValue) {
 	fixedPlayerX -= FIX23_9_MULT(fixedPlayerAngleCos, iValue);
 	fixedPlayerY += FIX23_9_MULT(fixedPlayerAngleSin, iValue);
 }
 
-void fixedPlayerStrafe(s32 iValue) {
+void playerStrafe(fix23_9 iValue) {
 	f16 tempangle = fixedPlayerAngle;
 	tempangle -= FIX23_9_MULT(fixed90, fixedAngleRatio);
 
 	f16 tempAngleCos = COS(FIX23_9TOI(tempangle));
 	f16 tempAngleSin = SIN(FIX23_9TOI(tempangle));
 
-	//playerX += tempAngleCos * iValue*angleRatio;
 	fixedPlayerX += FIX23_9_MULT(tempAngleCos, FIX23_9_MULT(iValue, fixedAngleRatio));
-	//playerY -= tempAngleSin * iValue*angleRatio;
 	fixedPlayerY -= FIX23_9_MULT(tempAngleSin, FIX23_9_MULT(iValue, fixedAngleRatio));
 }
 /*
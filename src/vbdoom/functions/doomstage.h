@@ -19,10 +19,6 @@
 #define IntersectBox(x0,y0, x1,y1, x2,y2, x3,y3) (Overlap(x0,x1,x2,x3) && Overlap(y0,y1,y2,y3))
 // PointSide: Determine which side of a line the point is on. Return value: <0, =0 or >0.
 #define PointSide(px,py, x0,y0, x1,y1) vxs((x1)-(x0), (y1)-(y0), (px)-(x0), (py)-(y0))
-// Intersect: Calculate the point of intersection between two lines.
-#define Intersect(x1,y1, x2,y2, x3,y3, x4,y4) ((struct xy) { \
-				vxs(vxs(x1,y1, x2,y2), (x1)-(x2), vxs(x3,y3, x4,y4), (x3)-(x4)) / vxs((x1)-(x2), (y1)-(y2), (x3)-(x4), (y3)-(y4)), \
-				vxs(vxs(x1,y1, x2,y2), (y1)-(y2), vxs(x3,y3, x4,y4), (y3)-(y4)) / vxs((x1)-(x2), (y1)-(y2), (x3)-(x4), (y3)-(y4)) })
 
 
 // FixedPointSide: Determine which side of a line the point is on. Return value: <0, =0 or >0.
@@ -35,19 +31,14 @@
 
 void initializeDoomStage();
 
-void fixedDrawDoomStage(u8 bgmap);
 void drawDoomStage(u8 bgmap);
 
 void drawDoomStageTile(int iX, int iStartY, int iEndY, u16 iStartPos);
-void incPlayerAngle(float iValue);
-void jawPlayer(float iValue);
-void playerMoveForward(float iValue);
-void playerStrafe(float iValue);
-
-void incFixedPlayerAngle(s32 iValue);
-void jawFixedPlayer(s32 iValue);
-void fixedPlayerMoveForward(s32 iValue);
-void fixedPlayerStrafe(s32 iValue);
+// player controls, all values 23.9 fixed (angles in 512-unit SINLUT steps)
+void incPlayerAngle(fix23_9 iValue);
+void jawPlayer(fix23_9 iValue);
+void playerMoveForward(fix23_9 iValue);
+void playerStrafe(fix23_9 iValue);
 
 void affine_fast_scale_fixed(u8 world, s32 scale);
 
@@ -4,6 +4,7 @@
 #include "RayCasterFixed.h"
 #include "RayCaster.h"
 #include "sndplay.h"
+#include "lockstep.h"
 #include "../assets/audio/doom_sfx.h"
 #include "../assets/images/wall_textures.h"
 
@@ -97,10 +98,14 @@ void updateDoors(void) {
             if (d->timer > 0) {
                 d->timer--;
             } else {
-                /* Don't close if the player is standing in the doorway */
+                /* Don't close if a player is standing in the doorway */
                 u8 ptx = (u8)(fPlayerX >> 8);
                 u8 pty = (u8)(fPlayerY >> 8);
-                if (ptx == d->tileX && pty == d->tileY) {
+                bool blocked = (ptx == d->tileX && pty == d->tileY);
+                if (g_lockJoin.active && (u8)(g_lockJoin.x >> 8) == d->tileX
+                    && (u8)(g_lockJoin.y >> 8) == d->tileY)
+                    blocked = true;
+                if (blocked) {
                     d->timer = DOOR_STAY_TIME; /* keep waiting */
                 } else {
                     d->state = DOOR_CLOSING;
@@ -319,7 +324,7 @@ u8 playerActivate(u16 playerX, u16 playerY, s16 playerA, u8 levelNum) {
     return 2;
 }
 
-u8 getDoorOpenAmount(u8 tileX, u8 tileY) {
+WRAM_CODE u8 getDoorOpenAmount(u8 tileX, u8 tileY) {
     u8 idx = g_doorLookup[(u16)tileY * MAP_X + (u16)tileX];
     return (idx != 0xFF) ? g_doors[idx].openAmount : 0;
 }
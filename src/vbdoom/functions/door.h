@@ -3,6 +3,7 @@
 
 #include <types.h>
 #include <stdbool.h>
+#include <wram.h>
 
 /*
  * Door and switch system for VB Doom.
@@ -22,6 +23,7 @@
 /* Door timing (frames) */
 #define DOOR_OPEN_SPEED   4    /* openAmount increments per frame */
 #define DOOR_OPEN_MAX     64   /* fully open (64 = full texture height in texels) */
+#define DOOR_OPEN_SHIFT   6    /* log2(DOOR_OPEN_MAX), for "/ DOOR_OPEN_MAX" in the renderer */
 #define DOOR_STAY_TIME    100  /* frames to stay open before auto-close (5 sec @ 20fps) */
 
 /* Switch types */
@@ -74,7 +76,8 @@ u8 playerActivate(u16 playerX, u16 playerY, s16 playerA, u8 levelNum);
 s8 findDoorAt(u8 tileX, u8 tileY);
 
 /* Get door open amount for a tile position (0 if not a door or closed).
- * Used by raycaster to reduce wall height. */
-u8 getDoorOpenAmount(u8 tileX, u8 tileY);
+ * Used by raycaster to reduce wall height. Runs from WRAM (ray loop hot
+ * path). */
+u8 getDoorOpenAmount(u8 tileX, u8 tileY) WRAM_CODE;
 
 #endif
@@ -7,6 +7,8 @@
 #include "RayCaster.h"
 #include "doomgfx.h"
 #include "sndplay.h"
+#include "lockstep.h"
+#include "enemysync.h"
 #include "../assets/audio/doom_sfx.h"
 
 /* Global enemy array */
@@ -27,6 +29,10 @@ u8 g_numVisibleEnemies = 0;
 u8 g_lastEnemyDamage = 0;
 s8 g_lastEnemyDamageDir = 0;
 
+/* Where the attacks of the enemy being updated add their damage:
+ * g_lastEnemyDamage, or g_lockJoin.damage when it goes after the JOIN */
+static u8 *targetDamage = &g_lastEnemyDamage;
+
 /* Kill tracking (for level stats screen) */
 u8 g_enemiesKilled = 0;
 u8 g_totalEnemies = 0;
@@ -38,17 +44,10 @@ u8 g_enemySndShoot = 0;
 u8 g_enemySndShootType = 0;
 u8 g_enemySndDeath = 0;
 
-/* ---- Simple PRNG (avoids stdlib dependency) ---- */
-static u16 rngState = 12345;
-static u8 enemyRandom(void) {
-    rngState = rngState * 25173 + 13849;
-    return (u8)(rngState >> 8);
-}
-
 /* Fast modulo for small unsigned values (0-255), avoids V810 division.
  * Uses multiply-shift to compute quotient, then subtracts.
  * NOTE: GCC statement expressions ensure argument is evaluated only once
- *       (safe to pass function calls like enemyRandom()). */
+ *       (safe to pass function calls like rnd8()). */
 #define FAST_MOD3(n)  ({ u8 _v=(n); (u8)(_v - ((u16)((u16)_v * 171u) >> 9) * 3u); })
 #define FAST_MOD5(n)  ({ u8 _v=(n); (u8)(_v - ((u16)((u16)_v * 205u) >> 10) * 5u); })
 #define FAST_MOD8(n)  ((u8)((n) & 7u))
@@ -75,73 +74,6 @@ static const u8 diags[4] = {
     DI_NORTHWEST, DI_NORTHEAST, DI_SOUTHWEST, DI_SOUTHEAST
 };
 
-/* Fixed-point atan2 (0-1023 range).
- * Optimized: shift-normalize both components so the larger fits in 8 bits,
- * then the division is u16 / u8 instead of the original s32 / s32. */
-/* Reciprocal LUT for fixedAtan2: g_recip8[i] = 32768/i for i=1..255 (512 bytes ROM).
- * Replaces (minor<<7)/major with (minor * g_recip8[major]) >> 8. */
-static const u16 g_recip8[256] = {
-        0,32768,16384,10922, 8192, 6553, 5461, 4681, 4096, 3640, 3276, 2978, 2730, 2520, 2340, 2184,
-     2048, 1927, 1820, 1724, 1638, 1560, 1489, 1424, 1365, 1310, 1260, 1213, 1170, 1129, 1092, 1057,
-     1024,  992,  963,  936,  910,  885,  862,  840,  819,  799,  780,  762,  744,  728,  712,  697,
-      682,  668,  655,  642,  630,  618,  606,  595,  585,  574,  564,  555,  546,  537,  528,  520,
-      512,  504,  496,  489,  481,  474,  468,  461,  455,  448,  442,  436,  431,  425,  420,  414,
-      409,  404,  399,  394,  390,  385,  381,  376,  372,  368,  364,  360,  356,  352,  348,  344,
-      341,  337,  334,  330,  327,  324,  321,  318,  315,  312,  309,  306,  303,  300,  297,  295,
-      292,  289,  287,  284,  282,  280,  277,  275,  273,  270,  268,  266,  264,  262,  260,  258,
-      256,  254,  252,  250,  248,  246,  244,  242,  240,  239,  237,  235,  234,  232,  230,  229,
-      227,  225,  224,  222,  221,  219,  218,  217,  215,  214,  212,  211,  210,  208,  207,  206,
-      204,  203,  202,  201,  199,  198,  197,  196,  195,  193,  192,  191,  190,  189,  188,  187,
-      186,  185,  184,  183,  182,  181,  180,  179,  178,  177,  176,  175,  174,  173,  172,  171,
-      170,  169,  168,  168,  167,  166,  165,  164,  163,  163,  162,  161,  160,  159,  159,  158,
-      157,  156,  156,  155,  154,  153,  153,  152,  151,  151,  150,  149,  148,  148,  147,  146,
-      146,  145,  144,  144,  143,  143,  142,  141,  141,  140,  140,  139,  138,  138,  137,  137,
-      136,  135,  135,  134,  134,  133,  133,  132,  132,  131,  131,  130,  130,  129,  129,  128
-};
-
-static s16 fixedAtan2(s16 dy, s16 dx) {
-    s16 angle;
-    u16 adx = (u16)(dx < 0 ? -dx : dx);
-    u16 ady = (u16)(dy < 0 ? -dy : dy);
-    u16 major, minor;
-
-    if (adx == 0 && ady == 0) return 0;
-
-    if (adx >= ady) { major = adx; minor = ady; }
-    else            { major = ady; minor = adx; }
-
-    /* Normalize: shift both right until major fits in 8 bits (max 255).
-     * This preserves the ratio minor/major while making the multiply cheap. */
-    while (major > 255) { major >>= 1; minor >>= 1; }
-
-    /* Compute ratio = minor * 128 / major via reciprocal LUT (division-free) */
-    if (major == 0)
-        angle = (adx >= ady) ? 0 : 256;
-    else if (adx >= ady)
-        angle = (s16)(((u32)minor * g_recip8[major]) >> 8);
-    else
-        angle = 256 - (s16)(((u32)minor * g_recip8[major]) >> 8);
-
-    /* Quadrant adjustment */
-    if (dx >= 0 && dy < 0) {
-        angle = 1024 - angle;
-    } else if (dx < 0 && dy < 0) {
-        angle = 512 + angle;
-    } else if (dx < 0 && dy >= 0) {
-        angle = 512 - angle;
-    }
-
-    return angle & 1023;
-}
-
-/* ---- Distance helper (returns sqrt-ish approx in fixed-point units) ---- */
-u16 approxDist(s16 dx, s16 dy) {
-    u16 adx = (u16)(dx < 0 ? -dx : dx);
-    u16 ady = (u16)(dy < 0 ? -dy : dy);
-    if (adx > ady) return adx + (ady >> 1);
-    return ady + (adx >> 1);
-}
-
 /* ---- Bounding-box wall collision ---- */
 static bool enemyHitsWall(s16 x, s16 y) {
     u8 tx0, tx1, ty0, ty1;
@@ -199,12 +131,12 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
     if (dX != DI_NODIR && dY != DI_NODIR) {
         e->movedir = diags[((dy < 0) << 1) + (dx > 0)];
         if (e->movedir != turnaround && enemyTryMove(e, idx, playerX, playerY)) {
-            e->movecount = enemyRandom() & 15;
+            e->movecount = rnd8() & 15;
             return;
         }
     }
 
-    if (enemyRandom() > 200 || (dy < 0 ? -dy : dy) > (dx < 0 ? -dx : dx)) {
+    if (rnd8() > 200 || (dy < 0 ? -dy : dy) > (dx < 0 ? -dx : dx)) {
         temp = dX; dX = dY; dY = temp;
     }
 
@@ -214,7 +146,7 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
     if (dX != DI_NODIR) {
         e->movedir = dX;
         if (enemyTryMove(e, idx, playerX, playerY)) {
-            e->movecount = enemyRandom() & 15;
+            e->movecount = rnd8() & 15;
             return;
         }
     }
@@ -222,7 +154,7 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
     if (dY != DI_NODIR) {
         e->movedir = dY;
         if (enemyTryMove(e, idx, playerX, playerY)) {
-            e->movecount = enemyRandom() & 15;
+            e->movecount = rnd8() & 15;
             return;
         }
     }
@@ -230,7 +162,7 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
     if (olddir != DI_NODIR) {
         e->movedir = olddir;
         if (enemyTryMove(e, idx, playerX, playerY)) {
-            e->movecount = enemyRandom() & 15;
+            e->movecount = rnd8() & 15;
             return;
         }
     }
@@ -239,7 +171,7 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
         if (tdir != turnaround) {
             e->movedir = tdir;
             if (enemyTryMove(e, idx, playerX, playerY)) {
-                e->movecount = enemyRandom() & 15;
+                e->movecount = rnd8() & 15;
                 return;
             }
         }
@@ -248,7 +180,7 @@ static void enemyNewChaseDir(EnemyState *e, u8 idx, u16 playerX, u16 playerY) {
     if (turnaround != DI_NODIR) {
         e->movedir = turnaround;
         if (enemyTryMove(e, idx, playerX, playerY)) {
-            e->movecount = enemyRandom() & 15;
+            e->movecount = rnd8() & 15;
             return;
         }
     }
@@ -272,7 +204,7 @@ static bool checkMissileRange(EnemyState *e, u16 playerX, u16 playerY) {
     if (!hasLineOfSight(e->x, e->y, playerX, playerY)) return false;
 
     /* Approximate distance in fixed-point units */
-    dist = approxDist(dx, dy);
+    dist = fix_dist(dx, dy);
 
     /* Convert to Doom-like units: subtract 64 (no melee state) and 128 */
     if (dist > 192) dist -= 192;
@@ -288,230 +220,17 @@ static bool checkMissileRange(EnemyState *e, u16 playerX, u16 playerY) {
     if (dist > 255) dist = 255;
 
     /* Random check: if random < dist, don't fire (farther = less likely) */
-    if (enemyRandom() < (u8)dist) return false;
+    if (rnd8() < (u8)dist) return false;
 
     return true;
 }
 
-void initEnemies(void) {
-    u8 i;
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        g_enemies[i].active = false;
-        g_enemies[i].state = ES_IDLE;
-        g_enemies[i].animFrame = 0;
-        g_enemies[i].animTimer = 0;
-        g_enemies[i].stateTimer = 0;
-        g_enemies[i].lastRenderedFrame = 255;
-        g_enemies[i].health = ZOMBIE_HEALTH;
-        g_enemies[i].angle = 0;
-        g_enemies[i].movedir = DI_NODIR;
-        g_enemies[i].movecount = 0;
-        g_enemies[i].enemyType = ETYPE_ZOMBIEMAN;
-    }
-
-    /* Enemy 0: zombieman, main hall south */
-    g_enemies[0].x = 15 * 256 + 128;
-    g_enemies[0].y = 21 * 256 + 128;
-    g_enemies[0].active = true;
-    g_enemies[0].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[0].health = ZOMBIE_HEALTH;
-
-    /* Enemy 1: zombieman, main hall east */
-    g_enemies[1].x = 17 * 256 + 128;
-    g_enemies[1].y = 23 * 256 + 128;
-    g_enemies[1].active = true;
-    g_enemies[1].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[1].health = ZOMBIE_HEALTH;
-
-    /* Enemy 2: sergeant (shotgun guy), zigzag room */
-    g_enemies[2].x = 8 * 256 + 128;
-    g_enemies[2].y = 14 * 256 + 128;
-    g_enemies[2].active = true;
-    g_enemies[2].enemyType = ETYPE_SERGEANT;
-    g_enemies[2].health = SGT_HEALTH;
-
-    /* Enemy 3: zombieman, zigzag room east */
-    g_enemies[3].x = 18 * 256 + 128;
-    g_enemies[3].y = 16 * 256 + 128;
-    g_enemies[3].active = true;
-    g_enemies[3].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[3].health = ZOMBIE_HEALTH;
-
-    /* Enemy 4: IMP, zigzag room center */
-    g_enemies[4].x = 12 * 256 + 128;
-    g_enemies[4].y = 15 * 256 + 128;
-    g_enemies[4].active = true;
-    g_enemies[4].enemyType = ETYPE_IMP;
-    g_enemies[4].health = IMP_HEALTH;
-
-    /* Enemy 5: IMP, computer room */
-    g_enemies[5].x = 15 * 256 + 128;
-    g_enemies[5].y = 7 * 256 + 128;
-    g_enemies[5].active = true;
-    g_enemies[5].enemyType = ETYPE_IMP;
-    g_enemies[5].health = IMP_HEALTH;
-
-    /* Enemy 6: zombieman, east side room */
-    g_enemies[6].x = 27 * 256 + 128;
-    g_enemies[6].y = 14 * 256 + 128;
-    g_enemies[6].active = true;
-    g_enemies[6].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[6].health = ZOMBIE_HEALTH;
-
-    /* Enemy 7: sergeant, near north door */
-    g_enemies[7].x = 15 * 256 + 128;
-    g_enemies[7].y = 12 * 256 + 128;
-    g_enemies[7].active = true;
-    g_enemies[7].enemyType = ETYPE_SERGEANT;
-    g_enemies[7].health = SGT_HEALTH;
-
-    /* Enemy 8: IMP, exit room guard */
-    g_enemies[8].x = 26 * 256 + 128;
-    g_enemies[8].y = 3 * 256 + 128;
-    g_enemies[8].active = true;
-    g_enemies[8].enemyType = ETYPE_IMP;
-    g_enemies[8].health = IMP_HEALTH;
-
-    /* Enemy 9: zombieman, west side room */
-    g_enemies[9].x = 4 * 256 + 128;
-    g_enemies[9].y = 22 * 256 + 128;
-    g_enemies[9].active = true;
-    g_enemies[9].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[9].health = ZOMBIE_HEALTH;
-
-    /* Enemy 10: Demon (Pinky), main hall center */
-    g_enemies[10].x = 14 * 256 + 128;
-    g_enemies[10].y = 18 * 256 + 128;
-    g_enemies[10].active = true;
-    g_enemies[10].enemyType = ETYPE_DEMON;
-    g_enemies[10].health = DEMON_HEALTH;
-
-    /* Enemy 11: Demon (Pinky), computer room south */
-    g_enemies[11].x = 16 * 256 + 128;
-    g_enemies[11].y = 10 * 256 + 128;
-    g_enemies[11].active = true;
-    g_enemies[11].enemyType = ETYPE_DEMON;
-    g_enemies[11].health = DEMON_HEALTH;
-
-    /* Enemy 12: Demon (Pinky), east corridor */
-    g_enemies[12].x = 24 * 256 + 128;
-    g_enemies[12].y = 8 * 256 + 128;
-    g_enemies[12].active = true;
-    g_enemies[12].enemyType = ETYPE_DEMON;
-    g_enemies[12].health = DEMON_HEALTH;
-
-    /* Enemy 13: Commando (Chaingunner), exit room */
-    g_enemies[13].x = 25 * 256 + 128;
-    g_enemies[13].y = 2 * 256 + 128;
-    g_enemies[13].active = true;
-    g_enemies[13].enemyType = ETYPE_COMMANDO;
-    g_enemies[13].health = COMMANDO_HEALTH;
-}
-
-void initEnemiesE1M2(void) {
-    u8 i;
-    for (i = 0; i < MAX_ENEMIES; i++) {
-        g_enemies[i].active = false;
-        g_enemies[i].state = ES_IDLE;
-        g_enemies[i].animFrame = 0;
-        g_enemies[i].animTimer = 0;
-        g_enemies[i].stateTimer = 0;
-        g_enemies[i].lastRenderedFrame = 255;
-        g_enemies[i].health = ZOMBIE_HEALTH;
-        g_enemies[i].angle = 0;
-        g_enemies[i].movedir = DI_NODIR;
-        g_enemies[i].movecount = 0;
-        g_enemies[i].enemyType = ETYPE_ZOMBIEMAN;
-    }
-
-    /* E1M2: Wolfenstein bunker -- guards patrol corridors */
-
-    /* Guard 0: zombieman, south corridor west */
-    g_enemies[0].x = 5 * 256 + 128;
-    g_enemies[0].y = 21 * 256 + 128;
-    g_enemies[0].active = true;
-    g_enemies[0].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[0].health = ZOMBIE_HEALTH;
-
-    /* Guard 1: zombieman, south corridor east */
-    g_enemies[1].x = 26 * 256 + 128;
-    g_enemies[1].y = 21 * 256 + 128;
-    g_enemies[1].active = true;
-    g_enemies[1].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[1].health = ZOMBIE_HEALTH;
-
-    /* Guard 2: zombieman, central command room */
-    g_enemies[2].x = 12 * 256 + 128;
-    g_enemies[2].y = 10 * 256 + 128;
-    g_enemies[2].active = true;
-    g_enemies[2].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[2].health = ZOMBIE_HEALTH;
-
-    /* Guard 3: zombieman, central room east */
-    g_enemies[3].x = 19 * 256 + 128;
-    g_enemies[3].y = 11 * 256 + 128;
-    g_enemies[3].active = true;
-    g_enemies[3].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[3].health = ZOMBIE_HEALTH;
-
-    /* Guard 4: sergeant, officer quarters NW */
-    g_enemies[4].x = 5 * 256 + 128;
-    g_enemies[4].y = 3 * 256 + 128;
-    g_enemies[4].active = true;
-    g_enemies[4].enemyType = ETYPE_SERGEANT;
-    g_enemies[4].health = SGT_HEALTH;
-
-    /* Guard 5: sergeant, north corridor */
-    g_enemies[5].x = 15 * 256 + 128;
-    g_enemies[5].y = 8 * 256 + 128;
-    g_enemies[5].active = true;
-    g_enemies[5].enemyType = ETYPE_SERGEANT;
-    g_enemies[5].health = SGT_HEALTH;
-
-    /* Guard 6: IMP, exit room guard */
-    g_enemies[6].x = 26 * 256 + 128;
-    g_enemies[6].y = 4 * 256 + 128;
-    g_enemies[6].active = true;
-    g_enemies[6].enemyType = ETYPE_IMP;
-    g_enemies[6].health = IMP_HEALTH;
-
-    /* Guard 7: zombieman, west barracks */
-    g_enemies[7].x = 4 * 256 + 128;
-    g_enemies[7].y = 16 * 256 + 128;
-    g_enemies[7].active = true;
-    g_enemies[7].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[7].health = ZOMBIE_HEALTH;
-
-    /* Guard 8: zombieman, east armory */
-    g_enemies[8].x = 28 * 256 + 128;
-    g_enemies[8].y = 16 * 256 + 128;
-    g_enemies[8].active = true;
-    g_enemies[8].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[8].health = ZOMBIE_HEALTH;
-
-    /* Guard 9: Demon, central room south */
-    g_enemies[9].x = 15 * 256 + 128;
-    g_enemies[9].y = 14 * 256 + 128;
-    g_enemies[9].active = true;
-    g_enemies[9].enemyType = ETYPE_DEMON;
-    g_enemies[9].health = DEMON_HEALTH;
-
-    /* Guard 10: zombieman, long corridor center */
-    g_enemies[10].x = 15 * 256 + 128;
-    g_enemies[10].y = 24 * 256 + 128;
-    g_enemies[10].active = true;
-    g_enemies[10].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[10].health = ZOMBIE_HEALTH;
-
-    /* Guard 11: IMP, north corridor east */
-    g_enemies[11].x = 20 * 256 + 128;
-    g_enemies[11].y = 9 * 256 + 128;
-    g_enemies[11].active = true;
-    g_enemies[11].enemyType = ETYPE_IMP;
-    g_enemies[11].health = IMP_HEALTH;
-}
+/* Starting health per ETYPE_* */
+static const u8 enemyHealth[ETYPE_COMMANDO + 1] = {
+    ZOMBIE_HEALTH, SGT_HEALTH, IMP_HEALTH, DEMON_HEALTH, COMMANDO_HEALTH
+};
 
-void initEnemiesE1M3(void) {
+void initEnemies(void) {
     u8 i;
     for (i = 0; i < MAX_ENEMIES; i++) {
         g_enemies[i].active = false;
@@ -526,244 +245,23 @@ void initEnemiesE1M3(void) {
         g_enemies[i].movecount = 0;
         g_enemies[i].enemyType = ETYPE_ZOMBIEMAN;
     }
-
-    /* E1M3: Hell-touched research facility -- heavy combat */
-
-    /* 0: zombieman, south corridor west */
-    g_enemies[0].x = 5 * 256 + 128;
-    g_enemies[0].y = 23 * 256 + 128;
-    g_enemies[0].active = true;
-    g_enemies[0].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[0].health = ZOMBIE_HEALTH;
-
-    /* 1: zombieman, south corridor east */
-    g_enemies[1].x = 20 * 256 + 128;
-    g_enemies[1].y = 24 * 256 + 128;
-    g_enemies[1].active = true;
-    g_enemies[1].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[1].health = ZOMBIE_HEALTH;
-
-    /* 2: zombieman, central arena south */
-    g_enemies[2].x = 8 * 256 + 128;
-    g_enemies[2].y = 12 * 256 + 128;
-    g_enemies[2].active = true;
-    g_enemies[2].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[2].health = ZOMBIE_HEALTH;
-
-    /* 3: zombieman, east wing lab */
-    g_enemies[3].x = 28 * 256 + 128;
-    g_enemies[3].y = 16 * 256 + 128;
-    g_enemies[3].active = true;
-    g_enemies[3].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[3].health = ZOMBIE_HEALTH;
-
-    /* 4: sergeant, central arena north */
-    g_enemies[4].x = 15 * 256 + 128;
-    g_enemies[4].y = 9 * 256 + 128;
-    g_enemies[4].active = true;
-    g_enemies[4].enemyType = ETYPE_SERGEANT;
-    g_enemies[4].health = SGT_HEALTH;
-
-    /* 5: sergeant, west wing */
-    g_enemies[5].x = 3 * 256 + 128;
-    g_enemies[5].y = 17 * 256 + 128;
-    g_enemies[5].active = true;
-    g_enemies[5].enemyType = ETYPE_SERGEANT;
-    g_enemies[5].health = SGT_HEALTH;
-
-    /* 6: sergeant, east wing */
-    g_enemies[6].x = 28 * 256 + 128;
-    g_enemies[6].y = 18 * 256 + 128;
-    g_enemies[6].active = true;
-    g_enemies[6].enemyType = ETYPE_SERGEANT;
-    g_enemies[6].health = SGT_HEALTH;
-
-    /* 7: imp, central arena east */
-    g_enemies[7].x = 22 * 256 + 128;
-    g_enemies[7].y = 10 * 256 + 128;
-    g_enemies[7].active = true;
-    g_enemies[7].enemyType = ETYPE_IMP;
-    g_enemies[7].health = IMP_HEALTH;
-
-    /* 8: imp, south corridor center */
-    g_enemies[8].x = 15 * 256 + 128;
-    g_enemies[8].y = 17 * 256 + 128;
-    g_enemies[8].active = true;
-    g_enemies[8].enemyType = ETYPE_IMP;
-    g_enemies[8].health = IMP_HEALTH;
-
-    /* 9: imp, command center */
-    g_enemies[9].x = 16 * 256 + 128;
-    g_enemies[9].y = 4 * 256 + 128;
-    g_enemies[9].active = true;
-    g_enemies[9].enemyType = ETYPE_IMP;
-    g_enemies[9].health = IMP_HEALTH;
-
-    /* 10: demon, central arena center */
-    g_enemies[10].x = 15 * 256 + 128;
-    g_enemies[10].y = 11 * 256 + 128;
-    g_enemies[10].active = true;
-    g_enemies[10].enemyType = ETYPE_DEMON;
-    g_enemies[10].health = DEMON_HEALTH;
-
-    /* 11: demon, west wing storage */
-    g_enemies[11].x = 4 * 256 + 128;
-    g_enemies[11].y = 15 * 256 + 128;
-    g_enemies[11].active = true;
-    g_enemies[11].enemyType = ETYPE_DEMON;
-    g_enemies[11].health = DEMON_HEALTH;
-
-    /* 12: demon, command center guard */
-    g_enemies[12].x = 14 * 256 + 128;
-    g_enemies[12].y = 6 * 256 + 128;
-    g_enemies[12].active = true;
-    g_enemies[12].enemyType = ETYPE_DEMON;
-    g_enemies[12].health = DEMON_HEALTH;
 }
 
-void initEnemiesE1M4(void) {
+bool spawnEnemy(u8 type, u16 x, u16 y, s16 angle) {
     u8 i;
+    if (type > ETYPE_COMMANDO) return false;
     for (i = 0; i < MAX_ENEMIES; i++) {
-        g_enemies[i].active = false;
-        g_enemies[i].state = ES_IDLE;
-        g_enemies[i].animFrame = 0;
-        g_enemies[i].animTimer = 0;
-        g_enemies[i].stateTimer = 0;
-        g_enemies[i].lastRenderedFrame = 255;
-        g_enemies[i].health = ZOMBIE_HEALTH;
-        g_enemies[i].angle = 0;
-        g_enemies[i].movedir = DI_NODIR;
-        g_enemies[i].movecount = 0;
-        g_enemies[i].enemyType = ETYPE_ZOMBIEMAN;
+        if (!g_enemies[i].active) {
+            g_enemies[i].x = x;
+            g_enemies[i].y = y;
+            g_enemies[i].angle = angle;
+            g_enemies[i].enemyType = type;
+            g_enemies[i].health = enemyHealth[type];
+            g_enemies[i].active = true;
+            return true;
+        }
     }
-
-    /* E1M4: web-editor export */
-    g_enemies[0].x = 23 * 256 + 128;
-    g_enemies[0].y = 29 * 256 + 128;
-    g_enemies[0].angle = 768;
-    g_enemies[0].active = true;
-    g_enemies[0].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[0].health = ZOMBIE_HEALTH;
-    g_enemies[1].x = 20 * 256 + 128;
-    g_enemies[1].y = 29 * 256 + 128;
-    g_enemies[1].angle = 768;
-    g_enemies[1].active = true;
-    g_enemies[1].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[1].health = ZOMBIE_HEALTH;
-    g_enemies[2].x = 30 * 256 + 128;
-    g_enemies[2].y = 19 * 256 + 128;
-    g_enemies[2].angle = 0;
-    g_enemies[2].active = true;
-    g_enemies[2].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[2].health = ZOMBIE_HEALTH;
-    g_enemies[3].x = 28 * 256 + 128;
-    g_enemies[3].y = 19 * 256 + 128;
-    g_enemies[3].angle = 0;
-    g_enemies[3].active = true;
-    g_enemies[3].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[3].health = ZOMBIE_HEALTH;
-    g_enemies[4].x = 30 * 256 + 128;
-    g_enemies[4].y = 21 * 256 + 128;
-    g_enemies[4].angle = 0;
-    g_enemies[4].active = true;
-    g_enemies[4].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[4].health = ZOMBIE_HEALTH;
-    g_enemies[5].x = 26 * 256 + 128;
-    g_enemies[5].y = 10 * 256 + 128;
-    g_enemies[5].angle = 512;
-    g_enemies[5].active = true;
-    g_enemies[5].enemyType = ETYPE_IMP;
-    g_enemies[5].health = IMP_HEALTH;
-    g_enemies[6].x = 29 * 256 + 128;
-    g_enemies[6].y = 10 * 256 + 128;
-    g_enemies[6].angle = 512;
-    g_enemies[6].active = true;
-    g_enemies[6].enemyType = ETYPE_IMP;
-    g_enemies[6].health = IMP_HEALTH;
-    g_enemies[7].x = 15 * 256 + 128;
-    g_enemies[7].y = 25 * 256 + 128;
-    g_enemies[7].angle = 0;
-    g_enemies[7].active = true;
-    g_enemies[7].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[7].health = ZOMBIE_HEALTH;
-    g_enemies[8].x = 23 * 256 + 128;
-    g_enemies[8].y = 19 * 256 + 128;
-    g_enemies[8].angle = 256;
-    g_enemies[8].active = true;
-    g_enemies[8].enemyType = ETYPE_DEMON;
-    g_enemies[8].health = DEMON_HEALTH;
-    g_enemies[9].x = 5 * 256 + 128;
-    g_enemies[9].y = 26 * 256 + 128;
-    g_enemies[9].angle = 0;
-    g_enemies[9].active = true;
-    g_enemies[9].enemyType = ETYPE_DEMON;
-    g_enemies[9].health = DEMON_HEALTH;
-    g_enemies[10].x = 2 * 256 + 128;
-    g_enemies[10].y = 30 * 256 + 128;
-    g_enemies[10].angle = 0;
-    g_enemies[10].active = true;
-    g_enemies[10].enemyType = ETYPE_SERGEANT;
-    g_enemies[10].health = SGT_HEALTH;
-    g_enemies[11].x = 4 * 256 + 128;
-    g_enemies[11].y = 30 * 256 + 128;
-    g_enemies[11].angle = 0;
-    g_enemies[11].active = true;
-    g_enemies[11].enemyType = ETYPE_IMP;
-    g_enemies[11].health = IMP_HEALTH;
-    g_enemies[12].x = 3 * 256 + 128;
-    g_enemies[12].y = 12 * 256 + 128;
-    g_enemies[12].angle = 0;
-    g_enemies[12].active = true;
-    g_enemies[12].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[12].health = ZOMBIE_HEALTH;
-    g_enemies[13].x = 4 * 256 + 128;
-    g_enemies[13].y = 11 * 256 + 128;
-    g_enemies[13].angle = 0;
-    g_enemies[13].active = true;
-    g_enemies[13].enemyType = ETYPE_SERGEANT;
-    g_enemies[13].health = SGT_HEALTH;
-    g_enemies[14].x = 7 * 256 + 128;
-    g_enemies[14].y = 7 * 256 + 128;
-    g_enemies[14].angle = 0;
-    g_enemies[14].active = true;
-    g_enemies[14].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[14].health = ZOMBIE_HEALTH;
-    g_enemies[15].x = 21 * 256 + 128;
-    g_enemies[15].y = 11 * 256 + 128;
-    g_enemies[15].angle = 0;
-    g_enemies[15].active = true;
-    g_enemies[15].enemyType = ETYPE_IMP;
-    g_enemies[15].health = IMP_HEALTH;
-    g_enemies[16].x = 22 * 256 + 128;
-    g_enemies[16].y = 8 * 256 + 128;
-    g_enemies[16].angle = 0;
-    g_enemies[16].active = true;
-    g_enemies[16].enemyType = ETYPE_DEMON;
-    g_enemies[16].health = DEMON_HEALTH;
-    g_enemies[17].x = 18 * 256 + 128;
-    g_enemies[17].y = 6 * 256 + 128;
-    g_enemies[17].angle = 0;
-    g_enemies[17].active = true;
-    g_enemies[17].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[17].health = ZOMBIE_HEALTH;
-    g_enemies[18].x = 29 * 256 + 128;
-    g_enemies[18].y = 2 * 256 + 128;
-    g_enemies[18].angle = 0;
-    g_enemies[18].active = true;
-    g_enemies[18].enemyType = ETYPE_SERGEANT;
-    g_enemies[18].health = SGT_HEALTH;
-    g_enemies[19].x = 9 * 256 + 128;
-    g_enemies[19].y = 16 * 256 + 128;
-    g_enemies[19].angle = 0;
-    g_enemies[19].active = true;
-    g_enemies[19].enemyType = ETYPE_ZOMBIEMAN;
-    g_enemies[19].health = ZOMBIE_HEALTH;
-    g_enemies[20].x = 1 * 256 + 128;
-    g_enemies[20].y = 2 * 256 + 128;
-    g_enemies[20].angle = 0;
-    g_enemies[20].active = true;
-    g_enemies[20].enemyType = ETYPE_IMP;
-    g_enemies[20].health = IMP_HEALTH;
+    return false;  /* no free slot */
 }
 
 void alertAllEnemies(void) {
@@ -823,7 +321,7 @@ bool applyDamageToEnemy(EnemyState *e, u8 damage, u16 playerX, u16 playerY) {
         {
             s16 ddx = (s16)e->x - (s16)playerX;
             s16 ddy = (s16)e->y - (s16)playerY;
-            u16 d = approxDist(ddx, ddy);
+            u16 d = fix_dist(ddx, ddy);
             u8 sdist = (u8)(d > 4080 ? 255 : d >> 4);
             if (sdist == 0) sdist = 1;
             if (e->enemyType == ETYPE_IMP)
@@ -843,14 +341,14 @@ bool applyDamageToEnemy(EnemyState *e, u8 damage, u16 playerX, u16 playerY) {
         else if (e->enemyType == ETYPE_IMP) painchance = IMP_PAINCHANCE;
         else if (e->enemyType == ETYPE_DEMON) painchance = DEMON_PAINCHANCE;
         else if (e->enemyType == ETYPE_COMMANDO) painchance = COMMANDO_PAINCHANCE;
-        if (enemyRandom() < painchance) {
+        if (rnd8() < painchance) {
             e->state = ES_PAIN;
             e->stateTimer = 0;
             /* Pain sound -- PCM (IMP/Demon reuse possessed pain) */
             {
                 s16 ddx = (s16)e->x - (s16)playerX;
                 s16 ddy = (s16)e->y - (s16)playerY;
-                u16 d = approxDist(ddx, ddy);
+                u16 d = fix_dist(ddx, ddy);
                 u8 sdist = (u8)(d > 4080 ? 255 : d >> 4);
                 if (sdist == 0) sdist = 1;
                 playEnemySFX(SFX_POSSESSED_PAIN, sdist);
@@ -879,7 +377,7 @@ static u8 hitscanFindEnemy(u16 playerX, u16 playerY, s16 aimAngle, s16 halfCone)
         dx = (s16)e->x - (s16)playerX;
         dy = (s16)e->y - (s16)playerY;
 
-        angleToEnemy = (256 - fixedAtan2(dy, dx)) & 1023;
+        angleToEnemy = (256 - fix_atan2(dy, dx)) & 1023;
         angleDiff = (angleToEnemy - aimAngle) & 1023;
         if (angleDiff > 512) angleDiff -= 1024;
         if (angleDiff < 0) angleDiff = -angleDiff;
@@ -929,7 +427,7 @@ u8 playerShoot(u16 playerX, u16 playerY, s16 playerA, u8 weaponType) {
             u8 target;
 
             /* Doom-style spread: (P_Random()-P_Random()) >> 4 in our angle units */
-            spread = ((s16)enemyRandom() - (s16)enemyRandom()) >> 4;
+            spread = ((s16)rnd8() - (s16)rnd8()) >> 4;
             pelletAngle = (playerA + spread) & 1023;
 
             /* Each pellet does narrow hitscan (half-cone = 10 ≈ 3.5 degrees) */
@@ -937,7 +435,7 @@ u8 playerShoot(u16 playerX, u16 playerY, s16 playerA, u8 weaponType) {
 
             if (target != 255) {
                 /* Doom P_GunShot: 5*(P_Random()%3 + 1) = 5,10,15 */
-                pelletDmg[target] += 5 * (FAST_MOD3(enemyRandom()) + 1);
+                pelletDmg[target] += 5 * (FAST_MOD3(rnd8()) + 1);
                 if (anyHit == 255) anyHit = target;
             }
         }
@@ -945,6 +443,7 @@ u8 playerShoot(u16 playerX, u16 playerY, s16 playerA, u8 weaponType) {
         /* Apply accumulated damage to each hit enemy */
         for (i = 0; i < MAX_ENEMIES; i++) {
             if (pelletDmg[i] == 0) continue;
+            syncHit(i, pelletDmg[i]);  /* co-op JOIN: the HOST applies it too */
             if (applyDamageToEnemy(&g_enemies[i], pelletDmg[i], playerX, playerY)) {
                 anyKill = i; /* at least one enemy killed */
             }
@@ -970,11 +469,12 @@ u8 playerShoot(u16 playerX, u16 playerY, s16 playerA, u8 weaponType) {
             u8 damage;
             if (weaponType == 1) {
                 /* Fist: (P_Random()%10 + 1) * 2 = 2-20 */
-                damage = (FAST_MOD10(enemyRandom()) + 1) * 2;
+                damage = (FAST_MOD10(rnd8()) + 1) * 2;
             } else {
                 /* Doom P_GunShot: 5*(P_Random()%3 + 1) = 5,10,15 */
-                damage = 5 * (FAST_MOD3(enemyRandom()) + 1);
+                damage = 5 * (FAST_MOD3(rnd8()) + 1);
             }
+            syncHit(target, damage);
             applyDamageToEnemy(&g_enemies[target], damage, playerX, playerY);
             hitIdx = target;
         }
@@ -991,7 +491,7 @@ u8 playerShoot(u16 playerX, u16 playerY, s16 playerA, u8 weaponType) {
 static void enemyFireAtPlayer(EnemyState *e, u16 playerX, u16 playerY, s16 playerA) {
     s16 dx = (s16)playerX - (s16)e->x;
     s16 dy = (s16)playerY - (s16)e->y;
-    u16 dist = approxDist(dx, dy);
+    u16 dist = fix_dist(dx, dy);
     u8 pellets, p;
     u8 totalDamage = 0;
 
@@ -1008,7 +508,7 @@ static void enemyFireAtPlayer(EnemyState *e, u16 playerX, u16 playerY, s16 playe
          * Spread range is roughly +-45 degrees in Doom (+-128 in our 0-1023 system).
          * At close range this almost always hits; at long range the subtended
          * angle to the player is small so spread causes misses. */
-        s16 spread = (s16)enemyRandom() - (s16)enemyRandom();
+        s16 spread = (s16)rnd8() - (s16)rnd8();
         /* spread is -255..+255. Scale to +-64 (roughly +-22 degrees) */
         spread >>= 2;
 
@@ -1023,18 +523,18 @@ static void enemyFireAtPlayer(EnemyState *e, u16 playerX, u16 playerY, s16 playe
             if (spread < 0) spread = -spread;
             if (spread < hitCone) {
                 /* Doom A_PosAttack: ((P_Random()%5)+1)*3 = 3,6,9,12,15 */
-                totalDamage += (FAST_MOD5(enemyRandom()) + 1) * 3;
+                totalDamage += (FAST_MOD5(rnd8()) + 1) * 3;
             }
         }
     }
 
     if (totalDamage > 0) {
-        g_lastEnemyDamage += totalDamage;
-        if (g_lastEnemyDamage > 50) g_lastEnemyDamage = 50;  /* per-frame cap */
+        *targetDamage += totalDamage;
+        if (*targetDamage > 50) *targetDamage = 50;  /* per-frame cap */
 
         /* Compute damage direction relative to player facing */
         {
-            s16 angleToEnemy = (256 - fixedAtan2(dy, dx)) & 1023;
+            s16 angleToEnemy = (256 - fix_atan2(dy, dx)) & 1023;
             s16 relAngle = angleToEnemy - playerA;
             if (relAngle > 512)  relAngle -= 1024;
             if (relAngle < -512) relAngle += 1024;
@@ -1065,19 +565,19 @@ static void enemyFireAtPlayer(EnemyState *e, u16 playerX, u16 playerY, s16 playe
 static void impAttack(EnemyState *e, u8 idx, u16 playerX, u16 playerY, s16 playerA) {
     s16 dx = (s16)playerX - (s16)e->x;
     s16 dy = (s16)playerY - (s16)e->y;
-    u16 dist = approxDist(dx, dy);
+    u16 dist = fix_dist(dx, dy);
     u8 sdist = (u8)(dist > 4080 ? 255 : dist >> 4);
     if (sdist == 0) sdist = 1;
 
     if (dist < IMP_MELEE_DIST * 2) {
         /* Melee claw attack */
-        u8 damage = (FAST_MOD8(enemyRandom()) + 1) * 3;  /* Doom A_TroopAttack: 3-24 */
+        u8 damage = (FAST_MOD8(rnd8()) + 1) * 3;  /* Doom A_TroopAttack: 3-24 */
         if (hasLineOfSight(e->x, e->y, playerX, playerY)) {
-            g_lastEnemyDamage += damage;
-            if (g_lastEnemyDamage > 50) g_lastEnemyDamage = 50;  /* per-frame cap */
+            *targetDamage += damage;
+            if (*targetDamage > 50) *targetDamage = 50;  /* per-frame cap */
             /* Compute damage direction */
             {
-                s16 angleToEnemy = (256 - fixedAtan2(dy, dx)) & 1023;
+                s16 angleToEnemy = (256 - fix_atan2(dy, dx)) & 1023;
                 s16 relAngle = angleToEnemy - playerA;
                 if (relAngle > 512)  relAngle -= 1024;
                 if (relAngle < -512) relAngle += 1024;
@@ -1101,19 +601,19 @@ static void impAttack(EnemyState *e, u8 idx, u16 playerX, u16 playerY, s16 playe
 static void demonAttack(EnemyState *e, u8 idx, u16 playerX, u16 playerY, s16 playerA) {
     s16 dx = (s16)playerX - (s16)e->x;
     s16 dy = (s16)playerY - (s16)e->y;
-    u16 dist = approxDist(dx, dy);
+    u16 dist = fix_dist(dx, dy);
     u8 sdist = (u8)(dist > 4080 ? 255 : dist >> 4);
     if (sdist == 0) sdist = 1;
 
     /* Only melee -- check close range */
     if (dist < DEMON_MELEE_DIST * 2) {
-        u8 damage = (FAST_MOD10(enemyRandom()) + 1) * 4;  /* Doom A_SargAttack: 4-40 */
+        u8 damage = (FAST_MOD10(rnd8()) + 1) * 4;  /* Doom A_SargAttack: 4-40 */
         if (hasLineOfSight(e->x, e->y, playerX, playerY)) {
-            g_lastEnemyDamage += damage;
-            if (g_lastEnemyDamage > 50) g_lastEnemyDamage = 50;  /* per-frame cap */
+            *targetDamage += damage;
+            if (*targetDamage > 50) *targetDamage = 50;  /* per-frame cap */
             /* Compute damage direction */
             {
-                s16 angleToEnemy = (256 - fixedAtan2(dy, dx)) & 1023;
+                s16 angleToEnemy = (256 - fix_atan2(dy, dx)) & 1023;
                 s16 relAngle = angleToEnemy - playerA;
                 if (relAngle > 512)  relAngle -= 1024;
                 if (relAngle < -512) relAngle += 1024;
@@ -1128,6 +628,8 @@ static void demonAttack(EnemyState *e, u8 idx, u16 playerX, u16 playerY, s16 pla
 }
 
 void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
+    u16 hostX = playerX, hostY = playerY;
+    s16 hostA = playerA;
     u8 i;
     for (i = 0; i < MAX_ENEMIES; i++) {
         EnemyState *e = &g_enemies[i];
@@ -1135,9 +637,29 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
         s32 dist;
         if (!e->active) continue;
 
-        dx = (s16)playerX - (s16)e->x;
-        dy = (s16)playerY - (s16)e->y;
+        dx = (s16)hostX - (s16)e->x;
+        dy = (s16)hostY - (s16)e->y;
         dist = ((s32)dx * dx + (s32)dy * dy) >> 8;
+        playerX = hostX;
+        playerY = hostY;
+        playerA = hostA;
+        targetDamage = &g_lastEnemyDamage;
+
+        /* Lockstep co-op: go after the nearer player, the HOST on a tie */
+        if (g_lockJoin.active) {
+            s16 jdx = (s16)g_lockJoin.x - (s16)e->x;
+            s16 jdy = (s16)g_lockJoin.y - (s16)e->y;
+            s32 jdist = ((s32)jdx * jdx + (s32)jdy * jdy) >> 8;
+            if (jdist < dist) {
+                dx = jdx;
+                dy = jdy;
+                dist = jdist;
+                playerX = g_lockJoin.x;
+                playerY = g_lockJoin.y;
+                playerA = g_lockJoin.angle;
+                targetDamage = &g_lockJoin.damage;
+            }
+        }
 
         /* Throttle distant WALK-state enemies only.
          * Keep ATTACK/reaction states full-rate so close combat remains responsive. */
@@ -1156,10 +678,10 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
                 e->animTimer = 0;
                 e->movedir = DI_NODIR;
                 e->movecount = 0;
-                e->angle = fixedAtan2(dy, dx);
+                e->angle = fix_atan2(dy, dx);
                 /* Aggro sound -- PCM, type-specific sight variant */
                 {
-                    u16 d = approxDist(dx, dy);
+                    u16 d = fix_dist(dx, dy);
                     u8 sdist = (u8)(d > 4080 ? 255 : d >> 4);
                     if (sdist == 0) sdist = 1;
                     if (e->enemyType == ETYPE_IMP)
@@ -1217,7 +739,7 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
 
         case ES_ATTACK: {
             /* Face the player while attacking */
-            e->angle = fixedAtan2(dy, dx);
+            e->angle = fix_atan2(dy, dx);
 
             e->stateTimer++;
 
@@ -1247,7 +769,7 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
                         e->state = ES_WALK;
                         e->animTimer = 0;
                         e->animFrame = 0;
-                        e->movecount = 4 + (enemyRandom() & 7);
+                        e->movecount = 4 + (rnd8() & 7);
                     }
                 }
             } else if (e->enemyType == ETYPE_COMMANDO) {
@@ -1273,7 +795,7 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
                             e->state = ES_WALK;
                             e->animTimer = 0;
                             e->animFrame = 0;
-                            e->movecount = 4 + (enemyRandom() & 7);
+                            e->movecount = 4 + (rnd8() & 7);
                         }
                     }
                 }
@@ -1295,7 +817,7 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
                         e->state = ES_WALK;
                         e->animTimer = 0;
                         e->animFrame = 0;
-                        e->movecount = 4 + (enemyRandom() & 7);
+                        e->movecount = 4 + (rnd8() & 7);
                     }
                 }
             }
@@ -1303,7 +825,7 @@ void updateEnemies(u16 playerX, u16 playerY, s16 playerA) {
         }
 
         case ES_PAIN:
-            e->angle = fixedAtan2(dy, dx);
+            e->angle = fix_atan2(dy, dx);
             e->stateTimer++;
             if (e->stateTimer >= 5) {
                 e->state = ES_WALK;
@@ -1334,7 +856,7 @@ u8 getEnemyDirection(u8 enemyIdx, u16 playerX, u16 playerY, s16 playerA) {
     EnemyState *e = &g_enemies[enemyIdx];
     s16 dx = (s16)e->x - (s16)playerX;
     s16 dy = (s16)e->y - (s16)playerY;
-    s16 angleToEnemy = fixedAtan2(dy, dx);
+    s16 angleToEnemy = fix_atan2(dy, dx);
     s16 relAngle = (angleToEnemy - e->angle + 576) & 1023;
     u8 dir = (u8)((relAngle >> 7) & 7);
     return dir;
@@ -1475,7 +997,7 @@ u8 getCommandoSpriteFrame(u8 enemyIdx, u16 playerX, u16 playerY, s16 playerA) {
 u8 getSpriteDirection(u16 sprX, u16 sprY, s16 sprAngle, u16 playerX, u16 playerY) {
     s16 dx = (s16)sprX - (s16)playerX;
     s16 dy = (s16)sprY - (s16)playerY;
-    s16 angleToSprite = fixedAtan2(dy, dx);
+    s16 angleToSprite = fix_atan2(dy, dx);
     s16 relAngle = (angleToSprite - sprAngle + 576) & 1023;
     return (u8)((relAngle >> 7) & 7);
 }
@@ -295,11 +295,12 @@ static const u8 COMMANDO_DEATH_FRAMES[COMMANDO_DEATH_ANIM_FRAMES] = {
 
 /* ---- API ---- */
 
-/* Initialize all enemies (positions, state). Call once at level start. */
+/* Clear all enemy slots. Call once at level start, before spawnEnemy(). */
 void initEnemies(void);
-void initEnemiesE1M2(void);
-void initEnemiesE1M3(void);
-void initEnemiesE1M4(void);
+
+/* Place an enemy (ETYPE_*) in the first free slot, idle, at full health.
+ * Returns false if no slot is free. */
+bool spawnEnemy(u8 type, u16 x, u16 y, s16 angle);
 
 /* Update AI and animation for all enemies. Call once per frame. */
 void updateEnemies(u16 playerX, u16 playerY, s16 playerA);
@@ -359,7 +360,4 @@ bool applyDamageToEnemy(EnemyState *e, u8 damage, u16 playerX, u16 playerY);
  * as seen from the player at (playerX,playerY). Used for player 2 rendering. */
 u8 getSpriteDirection(u16 sprX, u16 sprY, s16 sprAngle, u16 playerX, u16 playerY);
 
-/* Approximate distance (Manhattan-ish) */
-u16 approxDist(s16 dx, s16 dy);
-
 #endif
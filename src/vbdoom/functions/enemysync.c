@@ -0,0 +1,304 @@
+/*
+ * enemysync.c -- co-op enemies, with the HOST's copy authoritative
+ * (see enemysync.h)
+ */
+
+#include <libgccvb.h>
+#include "link.h"
+#include "lockstep.h"
+#include "enemy.h"
+#include "enemysync.h"
+
+#define SYNC_ALL    (SYNC_F_STATE | SYNC_F_HEALTH | SYNC_F_POS)
+#define SYNC_NO_SEQ 0xFF            /* sentSeq: nothing waits for an ack */
+
+static u8 syncLevel;
+
+/* Both: the packet seq enemy i last went out in until the peer acks
+ * it, and the peer's ack last seen */
+static u8 sentSeq[MAX_ENEMIES];
+static u8 lastAck;
+
+/* HOST: what the JOIN was last sent, who goes next, and who was lost
+ * on the way and goes again with every field */
+static u8 sentState[MAX_ENEMIES];
+static u8 sentHealth[MAX_ENEMIES];
+static u8 sentX[MAX_ENEMIES];       /* quarter tiles */
+static u8 sentY[MAX_ENEMIES];
+static u8 prio[MAX_ENEMIES];
+static bool resend[MAX_ENEMIES];
+
+/* HOST: the JOIN's damage total per enemy applied so far */
+static u8 hitSeen[MAX_ENEMIES];
+
+/* JOIN: damage total per enemy (wraps), which totals to report, and
+ * the HOST's positions */
+static u8 hitTotal[MAX_ENEMIES];
+static bool hitPending[MAX_ENEMIES];
+static u8 hitsPending;
+static u16 targetX[MAX_ENEMIES];
+static u16 targetY[MAX_ENEMIES];
+static bool hasTarget[MAX_ENEMIES];
+
+/* 8.8 position to quarter tiles, nearest */
+static u8 quarterTile(u16 v) {
+	u16 q = (v + 32) >> 6;
+	return q > 255 ? 255 : (u8)q;
+}
+
+/* Fields of enemy i that differ from what the JOIN has */
+static u8 changedFields(u8 i) {
+	const EnemyState *e = &g_enemies[i];
+	u8 f = 0;
+
+	if (resend[i]) return SYNC_ALL;
+	if (e->state != sentState[i]) f |= SYNC_F_STATE;
+	if (e->health != sentHealth[i]) f |= SYNC_F_HEALTH;
+	if (quarterTile(e->x) != sentX[i] || quarterTile(e->y) != sentY[i]) f |= SYNC_F_POS;
+	return f;
+}
+
+void syncReset(u8 level) {
+	u8 i;
+
+	syncLevel = level;
+	hitsPending = 0;
+	lastAck = SYNC_NO_SEQ;
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		sentState[i] = g_enemies[i].state;
+		sentHealth[i] = g_enemies[i].health;
+		sentX[i] = quarterTile(g_enemies[i].x);
+		sentY[i] = quarterTile(g_enemies[i].y);
+		prio[i] = 0;
+		resend[i] = false;
+		sentSeq[i] = SYNC_NO_SEQ;
+		hitSeen[i] = 0;
+		hitTotal[i] = 0;
+		hitPending[i] = false;
+		hasTarget[i] = false;
+	}
+}
+
+/* Enemy i went out in a packet that did not get through: send it again */
+static void syncLost(u8 i) {
+	sentSeq[i] = SYNC_NO_SEQ;
+	if (g_isHost) {
+		resend[i] = true;
+	} else if (!hitPending[i]) {
+		hitPending[i] = true;
+		hitsPending++;
+	}
+}
+
+/* Before writing packet seq: settle what the peer's ack tells. The link
+ * keeps packets in order, so an ack of a later packet than the one that
+ * carried enemy i means that one was lost (or its ack was, and it goes
+ * twice, which does no harm). A seq about to be reused was never sent
+ * (TX ring full) or went 16 packets ago without an ack: lost too. */
+static void syncAck(u8 seq) {
+	u8 ack = linkTxAck(), i, back;
+
+	back = (seq - ack) & (LINK_SEQS - 1);
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		if (sentSeq[i] == SYNC_NO_SEQ) continue;
+		if (sentSeq[i] == seq) {
+			syncLost(i);
+		} else if (ack != lastAck) {
+			if (sentSeq[i] == ack)
+				sentSeq[i] = SYNC_NO_SEQ;
+			else if (((seq - sentSeq[i]) & (LINK_SEQS - 1)) > back)
+				syncLost(i);
+		}
+	}
+	lastAck = ack;
+}
+
+void syncHit(u8 idx, u8 damage) {
+	if (!g_isMultiplayer || g_isHost || g_gameMode != GAMEMODE_COOP || g_lockstep)
+		return;
+	if (!hitPending[idx]) {
+		hitPending[idx] = true;
+		hitsPending++;
+	}
+	hitTotal[idx] += damage;
+}
+
+bool syncUrgent(void) {
+	u8 i;
+
+	if (!g_isHost) return hitsPending != 0;
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		if (g_enemies[i].active && g_enemies[i].health != sentHealth[i]) return true;
+	}
+	return false;
+}
+
+u8 syncWrite(u8 *buf, u8 budget, u16 joinX, u16 joinY) {
+	u8 n = 0, i, seq = linkTxSeq();
+
+	syncAck(seq);
+	if (budget < 3) return 0;
+	buf[n++] = syncLevel;
+
+	if (!g_isHost) {
+		for (i = 0; i < MAX_ENEMIES && hitsPending && n + 2 <= budget; i++) {
+			if (!hitPending[i]) continue;
+			buf[n++] = i;
+			buf[n++] = hitTotal[i];
+			hitPending[i] = false;
+			hitsPending--;
+			sentSeq[i] = seq;
+		}
+		return n > 1 ? n : 0;
+	}
+
+	/* Raise every enemy's priority: by closeness to the JOIN (16 next to
+	 * it, 1 from 15 tiles on) if it changed, by 1 if not, and a lot
+	 * more for damage. The dead that the JOIN has as dead wait; a kill
+	 * lost on the way is a change again (syncAck). */
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		const EnemyState *e = &g_enemies[i];
+		u8 f, add;
+		u16 tiles, p;
+
+		if (!e->active) continue;
+		f = changedFields(i);
+		if (!f && e->state == ES_DEAD) continue;
+		add = 1;
+		if (f) {
+			tiles = fix_dist((s16)(e->x - joinX), (s16)(e->y - joinY)) >> 8;
+			add = tiles >= 15 ? 1 : (u8)(16 - tiles);
+		}
+		if (f & SYNC_F_HEALTH) add += SYNC_CHANGED;
+		p = prio[i] + add;
+		prio[i] = p > 255 ? 255 : (u8)p;
+	}
+
+	/* Highest priority first, while it fits */
+	while (1) {
+		const EnemyState *e;
+		u8 best = 255, bestPrio = SYNC_MIN_PRIO - 1, f, size;
+
+		for (i = 0; i < MAX_ENEMIES; i++) {
+			if (prio[i] > bestPrio) {
+				bestPrio = prio[i];
+				best = i;
+			}
+		}
+		if (best == 255) break;
+
+		e = &g_enemies[best];
+		f = changedFields(best);
+		if (!f) f = SYNC_ALL;           /* refresh: all of it */
+		size = 1;
+		if (f & SYNC_F_STATE) size++;
+		if (f & SYNC_F_HEALTH) size++;
+		if (f & SYNC_F_POS) size += 2;
+		if (n + size > budget) break;
+
+		buf[n++] = best | f;
+		if (f & SYNC_F_STATE) {
+			buf[n++] = e->state;
+			sentState[best] = e->state;
+		}
+		if (f & SYNC_F_HEALTH) {
+			buf[n++] = e->health;
+			sentHealth[best] = e->health;
+		}
+		if (f & SYNC_F_POS) {
+			sentX[best] = quarterTile(e->x);
+			sentY[best] = quarterTile(e->y);
+			buf[n++] = sentX[best];
+			buf[n++] = sentY[best];
+		}
+		prio[best] = 0;
+		resend[best] = false;
+		sentSeq[best] = seq;
+	}
+	return n > 1 ? n : 0;
+}
+
+void syncRead(const u8 *buf, u8 len, u16 playerX, u16 playerY) {
+	u8 pos = 1;
+
+	if (len < 1 || buf[0] != syncLevel) return;   /* from another level */
+
+	if (g_isHost) {
+		/* The JOIN's damage totals: what is new since the last one we
+		 * got, so a total that comes twice applies once */
+		for (; pos + 1 < len; pos += 2) {
+			u8 idx = buf[pos], damage;
+			EnemyState *e;
+
+			if (idx >= MAX_ENEMIES) continue;
+			damage = buf[pos + 1] - hitSeen[idx];
+			hitSeen[idx] = buf[pos + 1];
+			e = &g_enemies[idx];
+			if (!damage || !e->active || e->state == ES_DEAD) continue;
+			if (e->state == ES_IDLE) e->state = ES_WALK;
+			applyDamageToEnemy(e, damage, playerX, playerY);
+		}
+		return;
+	}
+
+	/* The HOST's records */
+	while (pos < len) {
+		u8 idx = buf[pos] & SYNC_INDEX_MASK;
+		u8 f = buf[pos] & SYNC_ALL;
+		u8 size = 1;
+		EnemyState *e;
+
+		if (f & SYNC_F_STATE) size++;
+		if (f & SYNC_F_HEALTH) size++;
+		if (f & SYNC_F_POS) size += 2;
+		if (pos + size > len || idx >= MAX_ENEMIES) return;
+		e = &g_enemies[idx];
+		pos++;
+
+		if (!e->active) {
+			pos += size - 1;
+			continue;
+		}
+		if (f & SYNC_F_STATE) {
+			u8 st = buf[pos++];
+			if (st == ES_DEAD && e->state != ES_DEAD) {
+				/* Killed on the HOST: drop, sound, kill count */
+				applyDamageToEnemy(e, 255, playerX, playerY);
+			} else if (st == ES_PAIN && e->state != ES_PAIN && e->state != ES_DEAD) {
+				e->state = ES_PAIN;
+				e->stateTimer = 0;
+			} else if (st != ES_IDLE && e->state == ES_IDLE) {
+				e->state = ES_WALK;
+			}
+		}
+		if (f & SYNC_F_HEALTH) {
+			u8 h = buf[pos++];
+			if (e->state != ES_DEAD && h > 0) e->health = h;
+		}
+		if (f & SYNC_F_POS) {
+			targetX[idx] = (u16)buf[pos++] << 6;
+			targetY[idx] = (u16)buf[pos++] << 6;
+			hasTarget[idx] = true;
+		}
+	}
+}
+
+void syncCorrect(void) {
+	u8 i;
+
+	for (i = 0; i < MAX_ENEMIES; i++) {
+		EnemyState *e = &g_enemies[i];
+		s16 dx, dy;
+
+		if (!hasTarget[i] || !e->active) continue;
+		dx = (s16)(targetX[i] - e->x);
+		dy = (s16)(targetY[i] - e->y);
+		if (dx > SYNC_SNAP || dx < -SYNC_SNAP || dy > SYNC_SNAP || dy < -SYNC_SNAP) {
+			e->x = targetX[i];
+			e->y = targetY[i];
+		} else {
+			e->x += dx / 2;
+			e->y += dy / 2;
+		}
+	}
+}
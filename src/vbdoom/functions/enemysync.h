@@ -0,0 +1,70 @@
+/*
+ * enemysync.h -- co-op enemies, with the HOST's copy authoritative
+ *
+ * Both consoles run g_enemies[] (animation, attacks on their own
+ * player), but the HOST's health, state and position win. They ride as
+ * the event bytes of the state packets (link.h), within a byte budget.
+ *
+ * HOST to JOIN: the level, then records of enemies whose state the JOIN
+ * was not sent yet:
+ *   0     index | fields     index 0-31, fields SYNC_F_*
+ *   ..    state, health, x, y (each if in fields), x and y in quarter
+ *         tiles (the 8.8 position >> 6)
+ * Which enemies go is a priority that grows every packet, faster for
+ * enemies close to the JOIN (that is what the JOIN sees), much faster
+ * for a change of health or state. Unchanged enemies go now and then
+ * too, with every field, which heals a lost packet. The dead do not, so
+ * a record waits for the JOIN to ack the packet it went in (link.h);
+ * one lost on the way goes again with every field. The JOIN pulls its
+ * enemies halfway to the HOST's position each frame.
+ *
+ * JOIN to HOST: the level, then (index, total) for every enemy the
+ * JOIN's player dealt hitscan damage to since the last report the HOST
+ * acked: total is all the damage to that enemy this level, mod 256, and
+ * the HOST applies what is new since the total it had, so a report
+ * lost on the way goes again and one that arrives twice applies once
+ * (a 256 damage backlog on one enemy would be lost). The JOIN applies
+ * its hits at once as well, the HOST's state corrects it a few frames
+ * later (but never raises the dead).
+ */
+#ifndef _FUNCTIONS_ENEMYSYNC_H
+#define _FUNCTIONS_ENEMYSYNC_H
+
+#include <types.h>
+#include <stdbool.h>
+
+#define SYNC_F_STATE        0x20
+#define SYNC_F_HEALTH       0x40
+#define SYNC_F_POS          0x80
+#define SYNC_INDEX_MASK     0x1F
+
+#define SYNC_FRAME_BUDGET   8       /* event bytes per frame since the last packet */
+#define SYNC_CHANGED        64      /* priority of a change of health or state */
+#define SYNC_MIN_PRIO       8       /* below this an enemy waits for the next packet */
+#define SYNC_SNAP           512     /* JOIN: farther off than this, jump (8.8 units) */
+
+/* Level start, on both sides: the enemies as loadLevel set them up are
+ * the same on both, nothing to send for them. */
+void syncReset(u8 level);
+
+/* JOIN: our player dealt a hitscan hit, tell the HOST (playerShoot) */
+void syncHit(u8 idx, u8 damage);
+
+/* Something that should not wait for the next state packet: HOST, an
+ * enemy's health changed; JOIN, a hit to report. */
+bool syncUrgent(void);
+
+/* Write the next event bytes, at most budget, into buf, for the state
+ * packet linkTxSeq() (right before linkSendState; if that fails, the
+ * next call sends them again). Returns their count, 0 for nothing to
+ * send. HOST: joinX, joinY is the JOIN's player. */
+u8 syncWrite(u8 *buf, u8 budget, u16 joinX, u16 joinY);
+
+/* Apply the event bytes of a state packet from the peer. playerX,
+ * playerY is our player (sound distances). */
+void syncRead(const u8 *buf, u8 len, u16 playerX, u16 playerY);
+
+/* JOIN, once per frame: move the enemies towards the HOST's positions */
+void syncCorrect(void);
+
+#endif
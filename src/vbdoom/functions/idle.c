@@ -0,0 +1,43 @@
+/*
+ * idle.c -- background work run in the frame wait (see idle.h)
+ */
+
+#include <libgccvb.h>
+#include "timer.h"
+#include "idle.h"
+
+static IdleJob idleJobs[IDLE_MAX_JOBS];
+static u8 idleCount = 0;
+static u8 idleNext = 0;
+
+bool idleAdd(IdleJob job) {
+	u8 i;
+
+	for (i = 0; i < idleCount; i++) {
+		if (idleJobs[i] == job) return true;
+	}
+	if (idleCount >= IDLE_MAX_JOBS) return false;
+	idleJobs[idleCount++] = job;
+	return true;
+}
+
+void idleClear(void) {
+	idleCount = 0;
+	idleNext = 0;
+}
+
+void idleRun(void) {
+	while (idleCount && !g_simPending) {
+		if (idleNext >= idleCount) idleNext = 0;
+		if (idleJobs[idleNext]()) {
+			idleNext++;
+		} else {
+			/* Finished: close the gap, the next job moves into this slot */
+			u8 i;
+			idleCount--;
+			for (i = idleNext; i < idleCount; i++) {
+				idleJobs[i] = idleJobs[i + 1];
+			}
+		}
+	}
+}
@@ -0,0 +1,35 @@
+/*
+ * idle.h -- background work run in the frame wait
+ *
+ * A frame that finishes early used to spin until the next simulation
+ * tick. Deferred work queued here runs in that time instead: each job
+ * is a function doing one short, resumable chunk and returning true
+ * while it has more to do. idleRun() (called from waitForSimTick) steps
+ * the queued jobs round-robin until a tick is due; a job that returns
+ * false leaves the queue. Whatever is left waits for the next idle
+ * window, so a job must never be required for the frame to be correct:
+ * it pays work down early, the frame does it itself when it was not.
+ *
+ * Keep chunks well under a millisecond: one chunk running past the
+ * deadline delays the next tick by that much.
+ */
+#ifndef _FUNCTIONS_IDLE_H
+#define _FUNCTIONS_IDLE_H
+
+#include <types.h>
+#include <stdbool.h>
+
+#define IDLE_MAX_JOBS   4
+
+typedef bool (*IdleJob)(void);
+
+/* Queue a job. Already queued: no-op. Returns false if the queue is full. */
+bool idleAdd(IdleJob job);
+
+/* Drop every queued job (level change). */
+void idleClear(void);
+
+/* Run queued chunks until a simulation tick is pending or nothing is left. */
+void idleRun(void);
+
+#endif
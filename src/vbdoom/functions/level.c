@@ -0,0 +1,163 @@
+/*
+ * level.c -- the one level loader: packed level blobs (level.h) into
+ * g_map and the entity, door and secret tables
+ */
+
+#include <libgccvb.h>
+#include <mem.h>
+#include "level.h"
+#include "RayCaster.h"
+#include "enemy.h"
+#include "pickup.h"
+#include "door.h"
+#include "../assets/images/wall_textures.h"
+#include "../assets/doom/e1m1_level.h"
+#include "../assets/doom/e1m2_level.h"
+#include "../assets/doom/e1m3_level.h"
+#include "../assets/doom/e1m4_level.h"
+
+/* g_map is defined in RayCasterData.h (included by RayCasterFixed.c) */
+extern u8 g_map[];
+
+/* E1M5 and E1M6 play E1M3 until their maps are made */
+const u8 * const g_levels[NUM_LEVELS] = {
+    e1m1_level, e1m2_level, e1m3_level, e1m4_level, e1m3_level, e1m3_level
+};
+
+LevelSpawn g_levelSpawns[MAX_LEVEL_SPAWNS];
+u8 g_numLevelSpawns = 0;
+
+SecretSector g_secrets[MAX_SECRETS];
+u8 g_totalSecrets = 0;
+
+const u8 *g_sightTable = 0;
+static u8 s_sightShift;
+static u8 s_sightBlocksX, s_sightBlocksY;
+static u8 s_sightStride;    /* bytes per block row */
+
+#define TILE_CENTER(t)  ((u16)(t) * 256 + 128)
+#define RD16(p)         ((u16)(p)[0] | ((u16)(p)[1] << 8))
+#define IS_DOOR_TILE(t) ((t) == WALL_TYPE_DOOR || \
+                         ((t) >= WALL_TYPE_SECRET_BRICK && (t) <= WALL_TYPE_KEY_BLUE))
+
+/* Unpack the map code (level.h) into g_map, MAP_X wide, and register the
+ * doors and switches as their tiles come out; links holds numLinks
+ * (type, door) pairs for the switches in map order. Columns past w and
+ * rows past h are cleared on the way. */
+static void unpackMap(const u8 *code, u8 w, u8 h, const u8 *links, u8 numLinks) {
+    u8 *row = g_map;
+    u8 x = 0, y = 0, sw = 0;
+
+    while (y < h) {
+        u8 c = *code++;
+        u8 n = (c < 0x80 ? c : c & 0x3F) + 1;
+        u8 t = (c < 0x80) ? *code++ : 0;
+
+        while (n-- && y < h) {
+            if (c >= 0xC0)
+                t = *code++;
+            else if (c >= 0x80)
+                t = (row - MAP_X)[x];
+            row[x] = t;
+
+            if (IS_DOOR_TILE(t)) {
+                registerDoor(x, y);
+            } else if (t == WALL_TYPE_SWITCH && sw < numLinks) {
+                registerSwitch(x, y, links[sw * 2], links[sw * 2 + 1]);
+                sw++;
+            }
+
+            if (++x == w) {
+                if (w < MAP_X)
+                    setmem(row + w, 0, MAP_X - w);
+                row += MAP_X;
+                x = 0;
+                y++;
+            }
+        }
+    }
+    if (h < MAP_Y)
+        setmem(row, 0, (u16)(MAP_Y - h) * MAP_X);
+}
+
+bool loadLevelBlob(const u8 *blob) {
+    const u8 *p = blob + LEVEL_HEADER_SIZE;
+    const u8 *links;
+    u8 w = blob[4], h = blob[5];
+    u8 i;
+
+    if (blob[0] != 'V' || blob[1] != 'B' || blob[2] != 'L' || blob[3] != LEVEL_BLOB_VERSION)
+        return false;
+    if (w == 0 || w > MAP_X || h == 0 || h > MAP_Y || blob[6] == 0)
+        return false;
+
+    g_numLevelSpawns = 0;
+    for (i = 0; i < blob[6]; i++, p += 4) {
+        if (g_numLevelSpawns < MAX_LEVEL_SPAWNS) {
+            LevelSpawn *s = &g_levelSpawns[g_numLevelSpawns++];
+            s->x = TILE_CENTER(p[0]);
+            s->y = TILE_CENTER(p[1]);
+            s->angle = (s16)RD16(p + 2);
+        }
+    }
+
+    initEnemies();
+    for (i = 0; i < blob[7]; i++, p += 5)
+        spawnEnemy(p[0], TILE_CENTER(p[1]), TILE_CENTER(p[2]), (s16)RD16(p + 3));
+
+    initPickups();
+    for (i = 0; i < blob[8]; i++, p += 3)
+        spawnPickup(p[0], TILE_CENTER(p[1]), TILE_CENTER(p[2]));
+
+    links = p;
+    p += blob[9] * 2;
+
+    g_totalSecrets = 0;
+    for (i = 0; i < MAX_SECRETS; i++) {
+        g_secrets[i].tx = 0;
+        g_secrets[i].ty = 0;
+        g_secrets[i].found = false;
+    }
+    for (i = 0; i < blob[10]; i++, p += 2) {
+        if (g_totalSecrets < MAX_SECRETS) {
+            g_secrets[g_totalSecrets].tx = p[0];
+            g_secrets[g_totalSecrets].ty = p[1];
+            g_totalSecrets++;
+        }
+    }
+
+    /* The sight table stays in ROM */
+    g_sightTable = 0;
+    s_sightShift = blob[11];
+    if (s_sightShift) {
+        u16 blocks;
+        s_sightBlocksX = (u8)((w + (1 << s_sightShift) - 1) >> s_sightShift);
+        s_sightBlocksY = (u8)((h + (1 << s_sightShift) - 1) >> s_sightShift);
+        blocks = s_sightBlocksX * s_sightBlocksY;
+        s_sightStride = (u8)((blocks + 7) >> 3);
+        g_sightTable = p;
+        p += blocks * s_sightStride;
+    }
+
+    /* The map last: doors and switches register as it unpacks */
+    initDoors();
+    unpackMap(p, w, h, links, blob[9]);
+    return true;
+}
+
+bool levelMaySee(u8 tx0, u8 ty0, u8 tx1, u8 ty1) {
+    u16 a, b;
+    if (!g_sightTable)
+        return true;
+    tx0 >>= s_sightShift;
+    ty0 >>= s_sightShift;
+    tx1 >>= s_sightShift;
+    ty1 >>= s_sightShift;
+    /* Outside the level: no entry, walk the line */
+    if (tx0 >= s_sightBlocksX || ty0 >= s_sightBlocksY ||
+        tx1 >= s_sightBlocksX || ty1 >= s_sightBlocksY)
+        return true;
+    a = (u16)ty0 * s_sightBlocksX + tx0;
+    b = (u16)ty1 * s_sightBlocksX + tx1;
+    return (g_sightTable[a * s_sightStride + (b >> 3)] >> (b & 7)) & 1;
+}
@@ -0,0 +1,80 @@
+#ifndef _FUNCTIONS_LEVEL_H
+#define _FUNCTIONS_LEVEL_H
+
+#include <types.h>
+#include <stdbool.h>
+
+/*
+ * Packed levels. Each level is one const blob (assets/doom/<id>_level.h),
+ * written from the web editor's JSON by prepare_levels.py or the editor's
+ * Export, and loaded by loadLevelBlob(). Bytes, no padding, u16 fields
+ * little-endian:
+ *
+ *   header    'V' 'B' 'L' version, width, height,
+ *             spawns, enemies, pickups, switches, secrets (counts),
+ *             sight shift
+ *   spawns    tx, ty, angle u16          0 = player 1, 1 = player 2
+ *   enemies   type, tx, ty, angle u16    ETYPE_*
+ *   pickups   type, tx, ty               PICKUP_*
+ *   switches  type, door                 SW_DOOR / SW_EXIT, one per switch tile
+ *   secrets   tx, ty
+ *   sight     blocks rows of (blocks + 7) / 8 bytes
+ *   map       width*height tiles, row by row (at most MAP_X x MAP_Y), packed
+ *
+ * The map runs to the end of the blob as tokens:
+ *
+ *   0nnnnnnn t       tile t, n+1 times
+ *   10nnnnnn         n+1 tiles copied from the row above
+ *   11nnnnnn t...    n+1 tiles as they are
+ *
+ * The sight table cuts the map into square blocks of 1 << shift tiles,
+ * row by row (blocks is how many). Bit b of block a's row (byte b >> 3,
+ * bit b & 7) is clear when no open tile or start in a can see one in b,
+ * even with every door open, so hasLineOfSight() can answer those
+ * without walking the line. prepare_levels.py bakes it; shift 0 means
+ * no table.
+ *
+ * Tokens run on across row ends. Doors are the door tiles (4, 6-11), and
+ * switches the switch tiles, numbered in map order; a switch's door is
+ * that number. Everything else stands at the centre of its tile.
+ */
+
+#define LEVEL_BLOB_VERSION  3
+#define LEVEL_HEADER_SIZE   12
+
+#define NUM_LEVELS          6   /* episode levels, 1..NUM_LEVELS */
+#define MAX_LEVEL_SPAWNS    2
+#define MAX_SECRETS         4
+
+typedef struct { u16 x; u16 y; s16 angle; } LevelSpawn;
+
+/* Secret sectors: each is a tile position (tx, ty).
+ * When the player enters a secret tile for the first time, it's counted. */
+typedef struct { u8 tx; u8 ty; bool found; } SecretSector;
+
+/* Blob of each episode level, [levelNum - 1] */
+extern const u8 * const g_levels[NUM_LEVELS];
+
+/* Player starts of the loaded level */
+extern LevelSpawn g_levelSpawns[MAX_LEVEL_SPAWNS];
+extern u8 g_numLevelSpawns;
+
+extern SecretSector g_secrets[MAX_SECRETS];
+extern u8 g_totalSecrets;
+
+/* Sight table of the loaded level (in its blob), 0 for none */
+extern const u8 *g_sightTable;
+
+/* Load a level blob: g_map (the rest of the MAP_X x MAP_Y grid empty),
+ * enemies, pickups, doors, switches, secrets and the player starts. The
+ * map is unpacked straight into g_map, registering doors and switches as
+ * their tiles come out. Entries past the game's limits are dropped.
+ * Returns false, loading nothing, for a blob of another format or
+ * without a player start. */
+bool loadLevelBlob(const u8 *blob);
+
+/* False when the sight table says no tile of (tx0, ty0)'s block can see
+ * one of (tx1, ty1)'s; true otherwise, or without a table. */
+bool levelMaySee(u8 tx0, u8 ty0, u8 tx1, u8 ty1);
+
+#endif
@@ -125,32 +125,325 @@ u8 linkTryRecvByte(u8 *out, u16 timeout) {
     return LINK_TIMEOUT;
 }
 
-/* ---- Multi-byte ---- */
+/* ---- Interrupt-driven transport ---- */
 
-void linkSendPacket(const u8 *buf, u8 len) {
+volatile u8 g_linkMasterIdle = 0;
+
+/* TX: main thread moves the head, linkHandle the tail.
+ * RX: linkHandle moves the head, main thread the tail.
+ * RX entries are a length byte followed by the payload. */
+static u8 txRing[LINK_TX_RING];
+static u8 rxRing[LINK_RX_RING];
+static volatile u8 txHead = 0, txTail = 0;
+static volatile u8 rxHead = 0, rxTail = 0;
+
+/* Frame parser, run by linkHandle */
+#define RX_HUNT  0   /* waiting for LINK_SOF */
+#define RX_LEN   1   /* next byte is the length */
+#define RX_DATA  2   /* storing payload at rxPos */
+#define RX_SKIP  3   /* dropping a payload that does not fit */
+static u8 rxState = RX_HUNT;
+static u8 rxLeft = 0;
+static u8 rxPos = 0;
+
+/* State packets: the history of both directions, by seq */
+#define LINK_F_X        0x01
+#define LINK_F_Y        0x02
+#define LINK_F_ANGLE    0x04
+#define LINK_F_FLAGS    0x08
+#define LINK_F_HEALTH   0x10
+#define LINK_F_EVENTS   0x20
+static LinkState txHist[LINK_SEQS];     /* what we sent */
+static LinkState rxHist[LINK_SEQS];     /* what we decoded */
+static const LinkState zeroState = { 0, 0, 0, 0, 0, 0 };
+static u8 txSeq = 0;    /* seq of our next packet */
+static u8 txAck = 0;    /* our last packet the peer decoded */
+static u8 rxSeq = 0;    /* last peer packet we decoded */
+
+void linkStart(void) {
+    /* Both ends start as if seq 15 was the zero state, acked */
+    setmem((u8*)txHist, 0, sizeof(txHist));
+    setmem((u8*)rxHist, 0, sizeof(rxHist));
+    txSeq = 0;
+    txAck = rxSeq = LINK_SEQS - 1;
+
+    INT_DISABLE;
+    txHead = txTail = 0;
+    rxHead = rxTail = 0;
+    rxState = RX_HUNT;
+    comVector = (u32)(linkHandle);
+    HW_REGS[CCSR] |= 0x02;          /* channel stays open while we stream */
+    HW_REGS[CDTR] = LINK_IDLE;
+    if (g_isHost) {
+        HW_REGS[CCR] = LINK_CCR_IDLE;
+        g_linkMasterIdle = 1;       /* linkTick starts the first transfer */
+    } else {
+        g_linkMasterIdle = 0;
+        HW_REGS[CCR] = LINK_CCR_REMOTE_INT;
+    }
+    INT_ENABLE;
+}
+
+void linkStop(void) {
+    INT_DISABLE;
+    g_linkMasterIdle = 0;
+    HW_REGS[CCR] = LINK_CCR_IDLE;
+    HW_REGS[CCSR] &= (u8)~0x02;
+    comVector = 0;
+    INT_ENABLE;
+}
+
+WRAM_CODE void linkHandle() {
+    u8 b = HW_REGS[CDRR];
+
+    HW_REGS[CCR] = LINK_CCR_IDLE;   /* acknowledge */
+
+    /* ---- Receive ---- */
+    switch (rxState) {
+    case RX_HUNT:
+        if (b == LINK_SOF) rxState = RX_LEN;
+        break;
+    case RX_LEN:
+        if (b == 0 || b > LINK_MAX_PACKET) {
+            rxState = (b == LINK_SOF) ? RX_LEN : RX_HUNT;
+        } else {
+            rxLeft = b;
+            if ((u8)((rxTail - rxHead - 1) & (LINK_RX_RING - 1)) <= b) {
+                rxState = RX_SKIP;  /* main thread is behind: drop it */
+            } else {
+                rxRing[rxHead] = b;
+                rxPos = (rxHead + 1) & (LINK_RX_RING - 1);
+                rxState = RX_DATA;
+            }
+        }
+        break;
+    case RX_DATA:
+        rxRing[rxPos] = b;
+        rxPos = (rxPos + 1) & (LINK_RX_RING - 1);
+        if (--rxLeft == 0) {
+            rxHead = rxPos;         /* publish the whole frame */
+            rxState = RX_HUNT;
+        }
+        break;
+    default:
+        if (--rxLeft == 0) rxState = RX_HUNT;
+        break;
+    }
+
+    /* ---- Transmit ---- */
+    if (txTail != txHead) {
+        b = txRing[txTail];
+        txTail = (txTail + 1) & (LINK_TX_RING - 1);
+    } else {
+        b = LINK_IDLE;
+    }
+    HW_REGS[CDTR] = b;
+
+    if (g_isHost)
+        g_linkMasterIdle = 1;       /* next timer tick clocks it out */
+    else
+        HW_REGS[CCR] = LINK_CCR_REMOTE_INT;
+}
+
+bool linkSend(const u8 *buf, u8 len) {
+    u8 head = txHead;
     u8 i;
+
+    if (len == 0 || len > LINK_MAX_PACKET) return false;
+    if ((u8)((txTail - head - 1) & (LINK_TX_RING - 1)) < len + 2) return false;
+
+    txRing[head] = LINK_SOF;
+    head = (head + 1) & (LINK_TX_RING - 1);
+    txRing[head] = len;
+    head = (head + 1) & (LINK_TX_RING - 1);
     for (i = 0; i < len; i++) {
-        linkSendByte(buf[i]);
+        txRing[head] = buf[i];
+        head = (head + 1) & (LINK_TX_RING - 1);
     }
+    txHead = head;                  /* publish last */
+    return true;
 }
 
-void linkRecvPacket(u8 *buf, u8 len) {
-    u8 i;
+u8 linkRecv(u8 *buf) {
+    u8 tail = rxTail;
+    u8 len, i;
+
+    if (tail == rxHead) return 0;
+    len = rxRing[tail];
+    tail = (tail + 1) & (LINK_RX_RING - 1);
     for (i = 0; i < len; i++) {
-        buf[i] = linkRecvByte();
+        buf[i] = rxRing[tail];
+        tail = (tail + 1) & (LINK_RX_RING - 1);
     }
+    rxTail = tail;
+    return len;
 }
 
-/* ---- High-level state exchange ---- */
+/* ---- State packets ---- */
 
-void linkExchangeState(u8 *sendBuf, u8 *recvBuf) {
-    if (g_isHost) {
-        /* HOST sends first, then receives */
-        linkSendPacket(sendBuf, 8);
-        linkRecvPacket(recvBuf, 8);
+/* CRC-8, polynomial 0x07, a nibble at a time */
+static const u8 crcNibble[16] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+
+u8 linkCrc8(u8 crc, const u8 *p, u8 len) {
+    while (len--) {
+        crc ^= *p++;
+        crc = (u8)(crc << 4) ^ crcNibble[crc >> 4];
+        crc = (u8)(crc << 4) ^ crcNibble[crc >> 4];
+    }
+    return crc;
+}
+
+static u8 crcState(const LinkState *s) {
+    u8 b[8];
+    b[0] = (u8)(s->x >> 8);
+    b[1] = (u8)s->x;
+    b[2] = (u8)(s->y >> 8);
+    b[3] = (u8)s->y;
+    b[4] = (u8)(s->angle >> 8);
+    b[5] = (u8)s->angle;
+    b[6] = s->flags;
+    b[7] = s->health;
+    return linkCrc8(0, b, 8);
+}
+
+/* Write v against ref at p, return the bytes used */
+static u8 putDelta(u8 *p, u16 v, u16 ref) {
+    s16 d = (s16)(v - ref);
+    if (d >= -127 && d <= 127) {
+        p[0] = (u8)d;
+        return 1;
+    }
+    p[0] = LINK_ESCAPE;
+    p[1] = (u8)(v >> 8);
+    p[2] = (u8)v;
+    return 3;
+}
+
+/* Read a delta at buf[*pos] (before end) onto *v */
+static bool getDelta(const u8 *buf, u8 *pos, u8 end, u16 *v) {
+    u8 p = *pos;
+    if (p >= end) return false;
+    if (buf[p] != LINK_ESCAPE) {
+        *v += (s8)buf[p];
+        *pos = p + 1;
+        return true;
+    }
+    if (p + 3 > end) return false;
+    *v = ((u16)buf[p + 1] << 8) | buf[p + 2];
+    *pos = p + 3;
+    return true;
+}
+
+bool linkSendState(const LinkState *s, const u8 *events, u8 evLen) {
+    u8 buf[LINK_MAX_PACKET];
+    u8 base = (txSeq - txAck) & (LINK_SEQS - 1);
+    u8 fields = 0, n = 3, i;
+    const LinkState *ref;
+
+    if (evLen > LINK_MAX_EVENTS) return false;
+    if (base == 0 || base > LINK_MAX_BASE) {
+        base = 0;                   /* ack too old: keyframe */
+        ref = &zeroState;
     } else {
-        /* JOIN receives first, then sends */
-        linkRecvPacket(recvBuf, 8);
-        linkSendPacket(sendBuf, 8);
+        ref = &txHist[(txSeq - base) & (LINK_SEQS - 1)];
+    }
+
+    if (s->x != ref->x) {
+        fields |= LINK_F_X;
+        n += putDelta(buf + n, s->x, ref->x);
+    }
+    if (s->y != ref->y) {
+        fields |= LINK_F_Y;
+        n += putDelta(buf + n, s->y, ref->y);
+    }
+    if (s->angle != ref->angle) {
+        fields |= LINK_F_ANGLE;
+        n += putDelta(buf + n, s->angle, ref->angle);
+    }
+    if (s->flags != ref->flags) {
+        fields |= LINK_F_FLAGS;
+        buf[n++] = s->flags;
+    }
+    if (s->health != ref->health) {
+        fields |= LINK_F_HEALTH;
+        buf[n++] = s->health;
+    }
+    if (evLen) {
+        fields |= LINK_F_EVENTS;
+        buf[n++] = evLen;
+        for (i = 0; i < evLen; i++) buf[n++] = events[i];
+    }
+    buf[0] = (u8)(txSeq << 4) | rxSeq;
+    buf[1] = (u8)(base << 6) | fields;
+    buf[2] = s->time;
+    buf[n] = linkCrc8(crcState(ref), buf, n);
+
+    if (!linkSend(buf, n + 1)) return false;
+    txHist[txSeq] = *s;
+    txSeq = (txSeq + 1) & (LINK_SEQS - 1);
+    return true;
+}
+
+static bool linkDecode(const u8 *buf, u8 len, LinkState *s, u8 *events, u8 *evLen) {
+    u8 seq, base, fields, end, pos = 3, n, i;
+    const LinkState *ref;
+    LinkState st;
+
+    if (len < 4) return false;
+    end = len - 1;                  /* the CRC */
+    seq = buf[0] >> 4;
+    base = buf[1] >> 6;
+    fields = buf[1];
+    ref = base ? &rxHist[(seq - base) & (LINK_SEQS - 1)] : &zeroState;
+    if (linkCrc8(crcState(ref), buf, end) != buf[end]) return false;
+
+    st = *ref;
+    st.time = buf[2];
+    if ((fields & LINK_F_X) && !getDelta(buf, &pos, end, &st.x)) return false;
+    if ((fields & LINK_F_Y) && !getDelta(buf, &pos, end, &st.y)) return false;
+    if ((fields & LINK_F_ANGLE) && !getDelta(buf, &pos, end, &st.angle)) return false;
+    if (fields & LINK_F_FLAGS) {
+        if (pos >= end) return false;
+        st.flags = buf[pos++];
+    }
+    if (fields & LINK_F_HEALTH) {
+        if (pos >= end) return false;
+        st.health = buf[pos++];
+    }
+    n = 0;
+    if (fields & LINK_F_EVENTS) {
+        if (pos >= end) return false;
+        n = buf[pos++];
+        if (n > LINK_MAX_EVENTS || n > end - pos) return false;
+        for (i = 0; i < n; i++) events[i] = buf[pos++];
+    }
+    if (pos != end) return false;
+
+    rxHist[seq] = st;
+    rxSeq = seq;
+    txAck = buf[0] & (LINK_SEQS - 1);
+    *s = st;
+    *evLen = n;
+    return true;
+}
+
+u8 linkTxSeq(void) {
+    return txSeq;
+}
+
+u8 linkTxAck(void) {
+    return txAck;
+}
+
+bool linkRecvState(LinkState *s, u8 *events, u8 *evLen) {
+    u8 buf[LINK_MAX_PACKET];
+    u8 len;
+
+    while ((len = linkRecv(buf)) != 0) {
+        if (linkDecode(buf, len, s, events, evLen)) return true;
     }
+    return false;
 }
@@ -2,6 +2,8 @@
 #define _FUNCTIONS_LINK_H
 
 #include <types.h>
+#include <hw.h>
+#include <wram.h>
 #include <stdbool.h>
 
 /*
@@ -12,11 +14,22 @@
  * until clear to know transfer is complete.
  *
  * Based on reference implementations from VB Tic-Tac-Toe and 3D BattleSnake.
+ *
+ * The menus handshake with the blocking byte calls. In game the link runs
+ * from interrupts instead (linkStart): the HOST is master and the timer
+ * ISR starts one transfer per tick (linkTick), the JOIN side is remote and
+ * re-arms from the link interrupt. Every transfer swaps one byte each
+ * way, so both directions move one byte per timer tick (1-10 kB/s) while
+ * the game renders. Packets are framed on that stream as LINK_SOF,
+ * length, payload, with LINK_IDLE between frames; linkSend() queues one
+ * on the TX ring and linkRecv() takes the next one off the RX ring, and
+ * neither waits for the cable.
  */
 
 /* Game modes */
 #define GAMEMODE_COOP       0
 #define GAMEMODE_DEATHMATCH 1
+#define GAMEMODE_LOCKSTEP   2   /* handshake only: COOP in lockstep (lockstep.h) */
 
 /* Handshake bytes */
 #define LINK_JOIN_REQ   0xAA
@@ -29,6 +42,19 @@
 #define LINK_OK         0
 #define LINK_TIMEOUT    1
 
+/* CCR: bit 7 inhibits (and acknowledges) the interrupt, bit 4 selects the
+ * remote's external clock, bit 2 starts a transfer, bit 1 is busy */
+#define LINK_CCR_IDLE       0x80
+#define LINK_CCR_MASTER_INT 0x04   /* start as master, interrupt when done */
+#define LINK_CCR_REMOTE_INT 0x14   /* start as remote, interrupt when done */
+
+/* Interrupt-driven framing */
+#define LINK_SOF        0xA5   /* starts a frame: SOF, length, payload */
+#define LINK_IDLE       0x00   /* sent when the TX ring is empty */
+#define LINK_MAX_PACKET 32     /* payload bytes */
+#define LINK_TX_RING    128    /* power of two, at most 256 */
+#define LINK_RX_RING    128
+
 /* ---- Globals ---- */
 extern bool g_isMultiplayer;   /* true when a multiplayer session is active */
 extern bool g_isHost;          /* true = HOST, false = JOIN */
@@ -92,15 +118,92 @@ u8   linkTrySendByte(u8 data, u16 timeout);
  * On timeout, returns LINK_TIMEOUT. */
 u8   linkTryRecvByte(u8 *out, u16 timeout);
 
-/* Send a multi-byte packet as master (blocking). */
-void linkSendPacket(const u8 *buf, u8 len);
+/* ---- Interrupt-driven transport (in game) ---- */
+
+/* HOST: the port is free, the next timer tick starts a transfer */
+extern volatile u8 g_linkMasterIdle;
+
+/* Start the transport, after the handshake, on both sides. Empties the
+ * rings and installs linkHandle on the link interrupt. */
+void linkStart(void);
+
+/* Stop it: port idle, interrupt off. */
+void linkStop(void);
 
-/* Receive a multi-byte packet as remote (blocking). */
-void linkRecvPacket(u8 *buf, u8 len);
+/* Link interrupt: one byte each way is done. Feeds the received byte to
+ * the frame parser, loads the next byte to send and re-arms. */
+void linkHandle() WRAM_CODE;
 
-/* High-level: exchange 8-byte state packets.
- * HOST sends first then receives; JOIN receives first then sends.
- * sendBuf and recvBuf must both be 8 bytes. */
-void linkExchangeState(u8 *sendBuf, u8 *recvBuf);
+/* Called by the timer ISR every tick: on the HOST, start the next
+ * transfer once the last one is done. Waiting a tick gives the remote
+ * time to re-arm. */
+static inline void linkTick(void) {
+    if (g_linkMasterIdle) {
+        g_linkMasterIdle = 0;
+        HW_REGS[CCR] = LINK_CCR_MASTER_INT;
+    }
+}
+
+/* Queue a packet of 1..LINK_MAX_PACKET bytes. Returns false, and sends
+ * nothing, if the TX ring has no room for it. */
+bool linkSend(const u8 *buf, u8 len);
+
+/* Take the oldest packet received and not yet read into buf (room for
+ * LINK_MAX_PACKET bytes). Returns its length, 0 if there is none.
+ * Packets arriving while the RX ring is full are dropped. */
+u8   linkRecv(u8 *buf);
+
+/* ---- Player state packets (on linkSend/linkRecv) ----
+ *
+ * Each side sends its player state every LINK_STATE_FRAMES frames as a
+ * delta against a state the peer has acknowledged:
+ *   0     seq << 4 | ack     ack: seq of the last good packet received
+ *   1     base << 6 | fields the reference state is packet seq - base,
+ *                            base 0 is the all-zero state (keyframe)
+ *   2     time               low byte of the sender's frame, for the
+ *                            receiver's snapshots (snapshot.h)
+ *   ..    the fields that differ from the reference, in bit order:
+ *           X, Y, ANGLE    signed byte delta (-127..127), or LINK_ESCAPE
+ *                          and the value, high byte first
+ *           FLAGS, HEALTH  the byte
+ *           EVENTS         length, then that many bytes, not delta coded
+ *   last  CRC-8 (poly 0x07) of the reference state and bytes 0..
+ * Standing still costs 4 bytes, walking 6 or 7, against 8 raw, and
+ * at half rate half that per frame, which leaves room for game events.
+ * Since the CRC covers the reference, a packet decoded against a state
+ * the receiver does not have (lost ack, seq wrap) is dropped like a
+ * corrupt one, and once the last ack is more than LINK_MAX_BASE packets
+ * old the sender falls back to keyframes until the peer catches up.
+ */
+typedef struct {
+    u16 x, y;           /* 8.8 fixed-point */
+    u16 angle;          /* 0-1023 */
+    u8  flags;          /* P2F_* */
+    u8  health;
+    u8  time;           /* sender's frame, low byte (not delta coded) */
+} LinkState;
+
+#define LINK_SEQS       16     /* seq is 4 bits */
+#define LINK_MAX_BASE   3      /* base is 2 bits */
+#define LINK_ESCAPE     0x80   /* delta byte: the full value follows */
+#define LINK_MAX_EVENTS (LINK_MAX_PACKET - 16)  /* event bytes per packet */
+#define LINK_STATE_FRAMES 2    /* frames per state packet, unless urgent */
+
+/* Queue a state packet with evLen (0..LINK_MAX_EVENTS) event bytes.
+ * Returns false, and sends nothing, if the TX ring is full. */
+bool linkSendState(const LinkState *s, const u8 *events, u8 evLen);
+
+/* Decode the next good state packet into s and its event bytes into
+ * events (room for LINK_MAX_EVENTS), their count into *evLen. Bad
+ * packets are skipped. Returns false once there are none left. */
+bool linkRecvState(LinkState *s, u8 *events, u8 *evLen);
+
+/* The seq our next state packet goes out as, and the last of ours the
+ * peer acknowledged (for events that must get through, enemysync.h) */
+u8   linkTxSeq(void);
+u8   linkTxAck(void);
+
+/* CRC-8 (poly 0x07) of len bytes at p, continuing from crc (0 to start) */
+u8   linkCrc8(u8 crc, const u8 *p, u8 len);
 
 #endif
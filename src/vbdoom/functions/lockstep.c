@@ -0,0 +1,161 @@
+/*
+ * lockstep.c -- input-only co-op over the link cable (see lockstep.h)
+ */
+
+#include <libgccvb.h>
+#include "timer.h"
+#include "link.h"
+#include "lockstep.h"
+
+#define LOCK_MASK       (LOCK_RING - 1)
+#define NO_FRAME        0xFFFF
+
+LockPlayer g_lockJoin;
+
+bool g_lockstep = false;
+u16 g_lockSeed = 0;
+u16 g_lockPad[2];
+
+static u16 lockFrame;                   /* frame being simulated */
+static u16 localPad[LOCK_RING];         /* by frame, read LOCK_DELAY early */
+static u16 remotePad[LOCK_RING];
+static u16 remoteFrame[LOCK_RING];      /* frame each remotePad is for */
+static u8  localHash[LOCK_RING];        /* by frame, once finished */
+static u16 localHashFrame[LOCK_RING];
+static u8  remoteHash[LOCK_RING];
+static u16 remoteHashFrame[LOCK_RING];
+static u8  badPackets;                  /* in a row */
+
+void lockStart(void) {
+	u8 i;
+
+	lockFrame = 0;
+	badPackets = 0;
+	for (i = 0; i < LOCK_RING; i++) {
+		localPad[i] = 0;
+		remotePad[i] = 0;
+		remoteFrame[i] = NO_FRAME;
+		localHashFrame[i] = NO_FRAME;
+		remoteHashFrame[i] = NO_FRAME;
+	}
+	for (i = 0; i < LOCK_DELAY; i++)
+		remoteFrame[i] = i;             /* no input before the first pad arrives */
+	g_lockJoin.active = false;
+	g_lockJoin.damage = 0;
+}
+
+void lockStop(void) {
+	u8 bye = LOCK_BYE;
+
+	if (!g_lockstep) return;
+	g_lockstep = false;
+	linkSend(&bye, 1);
+}
+
+/* Both hashes of frame f are in and differ: the consoles drifted apart */
+static void checkHash(u16 f) {
+	u8 i = f & LOCK_MASK;
+
+	if (localHashFrame[i] == f && remoteHashFrame[i] == f
+	    && localHash[i] != remoteHash[i])
+		lockStop();
+}
+
+/* The packet for frame f (lockstep.h). A full TX ring drops it, the
+ * resend in lockInput covers that like a lost one. */
+static void sendPad(u16 f) {
+	u8 buf[LOCK_PACKET];
+	u16 done = f - LOCK_DELAY - 1;
+
+	buf[0] = (u8)f;
+	buf[1] = (u8)(localPad[f & LOCK_MASK] >> 8);
+	buf[2] = (u8)localPad[f & LOCK_MASK];
+	buf[3] = localHash[done & LOCK_MASK];
+	buf[4] = linkCrc8(0, buf, LOCK_PACKET - 1);
+	linkSend(buf, LOCK_PACKET);
+}
+
+/* Take every packet that arrived. Frames are sent as their low byte:
+ * the peer is never more than 2*LOCK_DELAY frames ahead or behind. */
+static void recvPads(void) {
+	u8 buf[LINK_MAX_PACKET];
+	u8 len;
+
+	while (g_lockstep && (len = linkRecv(buf)) != 0) {
+		u16 f;
+
+		if (len == 1 && buf[0] == LOCK_BYE) {
+			g_lockstep = false;
+			return;
+		}
+		if (len != LOCK_PACKET
+		    || linkCrc8(0, buf, LOCK_PACKET - 1) != buf[LOCK_PACKET - 1]) {
+			/* Corrupt (the resend brings it again), or the peer is on
+			 * state packets already */
+			if (++badPackets >= LOCK_BAD_MAX) {
+				g_lockstep = false;
+				return;
+			}
+			continue;
+		}
+		badPackets = 0;
+		f = lockFrame + (s8)(buf[0] - (u8)lockFrame);
+		if ((s16)(f - lockFrame) >= 0) {        /* not used yet (resends) */
+			remotePad[f & LOCK_MASK] = ((u16)buf[1] << 8) | buf[2];
+			remoteFrame[f & LOCK_MASK] = f;
+		}
+		if (f > LOCK_DELAY) {                   /* carries a hash */
+			u16 done = f - LOCK_DELAY - 1;
+			remoteHash[done & LOCK_MASK] = buf[3];
+			remoteHashFrame[done & LOCK_MASK] = done;
+			checkHash(done);
+		}
+	}
+}
+
+bool lockInput(u16 pad) {
+	u16 f = lockFrame + LOCK_DELAY;
+	u8 i = lockFrame & LOCK_MASK;
+	u32 start, sent;
+
+	if (!g_lockstep) return false;
+	localPad[f & LOCK_MASK] = pad;
+	sendPad(f);
+
+	start = sent = g_musicTick;
+	recvPads();
+	while (g_lockstep && remoteFrame[i] != lockFrame) {
+		u32 now;
+		CPU_HALT;   /* the timer ISR (and its linkTick) or a link byte wakes us */
+		now = g_musicTick;
+		if (now - start >= LOCK_TIMEOUT) {
+			lockStop();
+			break;
+		}
+		if (now - sent >= LOCK_RESEND) {
+			/* A packet may be lost: again every pad the peer may lack.
+			 * It is on frame lockFrame - LOCK_DELAY - 1 at the earliest
+			 * (we have its pad of lockFrame - 1, sent from there). */
+			u16 r = lockFrame > LOCK_DELAY ? lockFrame - LOCK_DELAY - 1 : 0;
+			for (; r != (u16)(f + 1); r++)
+				sendPad(r);
+			sent = now;
+		}
+		recvPads();
+	}
+	if (!g_lockstep) return false;
+
+	g_lockPad[g_isHost ? 0 : 1] = localPad[i];
+	g_lockPad[g_isHost ? 1 : 0] = remotePad[i];
+	return true;
+}
+
+void lockFrameEnd(u8 hash) {
+	u8 i = lockFrame & LOCK_MASK;
+
+	if (!g_lockstep) return;
+	localHash[i] = hash;
+	localHashFrame[i] = lockFrame;
+	checkHash(lockFrame);
+	lockFrame++;
+}
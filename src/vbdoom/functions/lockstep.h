@@ -0,0 +1,77 @@
+/*
+ * lockstep.h -- input-only co-op over the link cable
+ *
+ * Instead of player state (link.h state packets) only the pad crosses
+ * the cable. Both consoles simulate both players, the enemies, the
+ * projectiles and the pickups from the same start: the same level, the
+ * same seed of the game random stream (rnd8) and, every frame, the same
+ * two pads. Like a demo (demo.h), the same input runs the same frames.
+ *
+ * A pad read on frame n is used on frame n + LOCK_DELAY, which hides the
+ * cable: the packet has LOCK_DELAY frames to arrive before the peer
+ * needs it. Per frame each side sends one packet (LOCK_PACKET bytes):
+ *   0     low byte of the frame the pad is for
+ *   1..2  pad, high byte first
+ *   3     hash of the sender's last finished frame (frame - LOCK_DELAY - 1)
+ *   4     CRC-8 (linkCrc8) of bytes 0..3
+ * 7 bytes on the cable with the framing, against 8 to 12 for a state
+ * packet, and nothing more for the enemies. A corrupt packet is
+ * dropped, the resend (LOCK_RESEND) brings the pad again. The hash
+ * (lockFrameEnd) is a CRC-8 of the simulation: a mismatch means the
+ * consoles drifted apart.
+ *
+ * On a mismatch, or with no input from the peer for LOCK_TIMEOUT, the
+ * game falls back to the state packets: g_lockstep goes false, a
+ * one-byte LOCK_BYE packet tells the peer, and each console keeps going
+ * from its own copy of the world. A peer whose LOCK_BYE got lost shows
+ * as LOCK_BAD_MAX bad packets in a row (its state packets).
+ */
+#ifndef _FUNCTIONS_LOCKSTEP_H
+#define _FUNCTIONS_LOCKSTEP_H
+
+#include <types.h>
+#include <stdbool.h>
+
+#define LOCK_DELAY      2       /* frames from reading a pad to using it */
+#define LOCK_RING       8       /* power of two, more than 2*LOCK_DELAY+1 */
+#define LOCK_PACKET     5
+#define LOCK_BAD_MAX    8       /* bad packets in a row: the peer left lockstep */
+#define LOCK_BYE        0xB7    /* one-byte packet: lockstep is over */
+#define LOCK_RESEND     1000    /* timer ticks (~8 per ms) before sending again */
+#define LOCK_TIMEOUT    24000   /* timer ticks without the peer's pad: ~3 s */
+
+/* The second player as the world sees it. updateEnemies() and
+ * updateProjectiles() get the HOST as their player and, while active,
+ * this is the JOIN, on both consoles, so both pick the same targets.
+ * Damage dealt to it adds up in damage, as g_lastEnemyDamage does for
+ * the HOST. */
+typedef struct {
+	bool active;
+	u16  x, y;          /* 8.8 fixed-point */
+	s16  angle;
+	u8   damage;
+} LockPlayer;
+
+extern LockPlayer g_lockJoin;
+
+extern bool g_lockstep;        /* lockstep is running (set by the menu) */
+extern u16  g_lockSeed;        /* game random stream seed, from the HOST */
+extern u16  g_lockPad[2];      /* this frame's input: [0] HOST, [1] JOIN */
+
+/* Start of a game, after linkStart: frame 0, the first LOCK_DELAY
+ * frames run without input. */
+void lockStart(void);
+
+/* Per frame, on the local pad: sends it and waits for the peer's pad
+ * of this frame, then fills g_lockPad. Returns false once lockstep is
+ * over (fallback, see above). */
+bool lockInput(u16 pad);
+
+/* Per frame, after the simulation: hash of its state, compared with
+ * the peer's. */
+void lockFrameEnd(u8 hash);
+
+/* Leave lockstep (and tell the peer) */
+void lockStop(void);
+
+#endif
@@ -36,342 +36,8 @@ void initPickups(void) {
         g_pickups[i].active = false;
         g_pickups[i].animFrame = 0;
         g_pickups[i].animTimer = 0;
+        g_pickups[i].respawnTimer = 0;
     }
-
-    /* Place static pickups on the map.
-     * Positions are in 8.8 fixed-point (tile * 256 + offset).
-     */
-
-    /* 0: Small health kit, west side room (4, 22) */
-    g_pickups[0].x = 4 * 256 + 128;
-    g_pickups[0].y = 22 * 256 + 128;
-    g_pickups[0].type = PICKUP_HEALTH_SMALL;
-    g_pickups[0].active = true;
-
-    /* 1: Ammo clip, east side room (27, 22) */
-    g_pickups[1].x = 27 * 256 + 128;
-    g_pickups[1].y = 22 * 256 + 128;
-    g_pickups[1].type = PICKUP_AMMO_CLIP;
-    g_pickups[1].active = true;
-
-    /* 2: Shotgun pickup, main hall (15, 24) */
-    g_pickups[2].x = 15 * 256 + 128;
-    g_pickups[2].y = 24 * 256 + 128;
-    g_pickups[2].type = PICKUP_WEAPON_SHOTGUN;
-    g_pickups[2].active = true;
-
-    /* 3: Large health kit, zigzag room (3, 16) */
-    g_pickups[3].x = 3 * 256 + 128;
-    g_pickups[3].y = 16 * 256 + 128;
-    g_pickups[3].type = PICKUP_HEALTH_LARGE;
-    g_pickups[3].active = true;
-
-    /* 4: Ammo clip, zigzag room east (20, 14) */
-    g_pickups[4].x = 20 * 256 + 128;
-    g_pickups[4].y = 14 * 256 + 128;
-    g_pickups[4].type = PICKUP_AMMO_CLIP;
-    g_pickups[4].active = true;
-
-    /* 5: Shells box, east side room (26, 14) */
-    g_pickups[5].x = 26 * 256 + 128;
-    g_pickups[5].y = 14 * 256 + 128;
-    g_pickups[5].type = PICKUP_SHELLS;
-    g_pickups[5].active = true;
-
-    /* 6: Helmet pickup, computer room (16, 6) */
-    g_pickups[6].x = 16 * 256 + 128;
-    g_pickups[6].y = 6 * 256 + 128;
-    g_pickups[6].type = PICKUP_HELMET;
-    g_pickups[6].active = true;
-
-    /* 7: Armor pickup (rare), armor room behind locked door (4, 9) */
-    g_pickups[7].x = 4 * 256 + 128;
-    g_pickups[7].y = 9 * 256 + 128;
-    g_pickups[7].type = PICKUP_ARMOR;
-    g_pickups[7].active = true;
-
-    /* 8: Small health kit, main hall west (2, 21) */
-    g_pickups[8].x = 2 * 256 + 128;
-    g_pickups[8].y = 21 * 256 + 128;
-    g_pickups[8].type = PICKUP_HEALTH_SMALL;
-    g_pickups[8].active = true;
-
-    /* 9: Ammo clip, start area (13, 28) */
-    g_pickups[9].x = 13 * 256 + 128;
-    g_pickups[9].y = 28 * 256 + 128;
-    g_pickups[9].type = PICKUP_AMMO_CLIP;
-    g_pickups[9].active = true;
-
-    /* 10: Small health kit, computer room north (14, 5) */
-    g_pickups[10].x = 14 * 256 + 128;
-    g_pickups[10].y = 5 * 256 + 128;
-    g_pickups[10].type = PICKUP_HEALTH_SMALL;
-    g_pickups[10].active = true;
-
-    /* 11: Shells box, zigzag room (7, 18) */
-    g_pickups[11].x = 7 * 256 + 128;
-    g_pickups[11].y = 18 * 256 + 128;
-    g_pickups[11].type = PICKUP_SHELLS;
-    g_pickups[11].active = true;
-
-    /* 12: Helmet pickup, east corridor (26, 13) */
-    g_pickups[12].x = 26 * 256 + 128;
-    g_pickups[12].y = 13 * 256 + 128;
-    g_pickups[12].type = PICKUP_HELMET;
-    g_pickups[12].active = true;
-
-    /* 13: Rocket launcher pickup, computer room south (20, 8) */
-    g_pickups[13].x = 20 * 256 + 128;
-    g_pickups[13].y = 8 * 256 + 128;
-    g_pickups[13].type = PICKUP_WEAPON_ROCKET;
-    g_pickups[13].active = true;
-
-    /* 14: Chaingun pickup, east corridor (29, 7) */
-    g_pickups[14].x = 29 * 256 + 128;
-    g_pickups[14].y = 7 * 256 + 128;
-    g_pickups[14].type = PICKUP_WEAPON_CHAINGUN;
-    g_pickups[14].active = true;
-}
-
-void initPickupsE1M2(void) {
-    u8 i;
-    for (i = 0; i < MAX_PICKUPS; i++) {
-        g_pickups[i].active = false;
-        g_pickups[i].animFrame = 0;
-        g_pickups[i].animTimer = 0;
-    }
-
-    /* E1M2: Wolfenstein bunker pickups */
-
-    /* 0: Ammo clip, south corridor west alcove (5, 24) */
-    g_pickups[0].x = 5 * 256 + 128;
-    g_pickups[0].y = 24 * 256 + 128;
-    g_pickups[0].type = PICKUP_AMMO_CLIP;
-    g_pickups[0].active = true;
-
-    /* 1: Small health, south corridor east alcove (26, 24) */
-    g_pickups[1].x = 26 * 256 + 128;
-    g_pickups[1].y = 24 * 256 + 128;
-    g_pickups[1].type = PICKUP_HEALTH_SMALL;
-    g_pickups[1].active = true;
-
-    /* 2: Large health, central command room (15, 11) */
-    g_pickups[2].x = 15 * 256 + 128;
-    g_pickups[2].y = 11 * 256 + 128;
-    g_pickups[2].type = PICKUP_HEALTH_LARGE;
-    g_pickups[2].active = true;
-
-    /* 3: Shells box, east armory (29, 15) */
-    g_pickups[3].x = 29 * 256 + 128;
-    g_pickups[3].y = 15 * 256 + 128;
-    g_pickups[3].type = PICKUP_SHELLS;
-    g_pickups[3].active = true;
-
-    /* 4: Ammo clip, west barracks (3, 17) */
-    g_pickups[4].x = 3 * 256 + 128;
-    g_pickups[4].y = 17 * 256 + 128;
-    g_pickups[4].type = PICKUP_AMMO_CLIP;
-    g_pickups[4].active = true;
-
-    /* 5: Shells box, west barracks near door (3, 14) */
-    g_pickups[5].x = 3 * 256 + 128;
-    g_pickups[5].y = 14 * 256 + 128;
-    g_pickups[5].type = PICKUP_SHELLS;
-    g_pickups[5].active = true;
-
-    /* 6: Small health, north corridor (10, 9) */
-    g_pickups[6].x = 10 * 256 + 128;
-    g_pickups[6].y = 9 * 256 + 128;
-    g_pickups[6].type = PICKUP_HEALTH_SMALL;
-    g_pickups[6].active = true;
-
-    /* 7: Helmet, officer quarters NW (8, 5) */
-    g_pickups[7].x = 8 * 256 + 128;
-    g_pickups[7].y = 5 * 256 + 128;
-    g_pickups[7].type = PICKUP_HELMET;
-    g_pickups[7].active = true;
-
-    /* 8: Ammo clip, central room west (7, 11) */
-    g_pickups[8].x = 7 * 256 + 128;
-    g_pickups[8].y = 11 * 256 + 128;
-    g_pickups[8].type = PICKUP_AMMO_CLIP;
-    g_pickups[8].active = true;
-
-    /* 9: Small health, start room (13, 28) */
-    g_pickups[9].x = 13 * 256 + 128;
-    g_pickups[9].y = 28 * 256 + 128;
-    g_pickups[9].type = PICKUP_HEALTH_SMALL;
-    g_pickups[9].active = true;
-
-    /* 10: Armor, behind locked weapon closet (3, 16) */
-    g_pickups[10].x = 3 * 256 + 128;
-    g_pickups[10].y = 16 * 256 + 128;
-    g_pickups[10].type = PICKUP_ARMOR;
-    g_pickups[10].active = true;
-
-    /* 11: Ammo clip, exit room (25, 3) */
-    g_pickups[11].x = 25 * 256 + 128;
-    g_pickups[11].y = 3 * 256 + 128;
-    g_pickups[11].type = PICKUP_AMMO_CLIP;
-    g_pickups[11].active = true;
-}
-
-void initPickupsE1M3(void) {
-    u8 i;
-    for (i = 0; i < MAX_PICKUPS; i++) {
-        g_pickups[i].active = false;
-        g_pickups[i].animFrame = 0;
-        g_pickups[i].animTimer = 0;
-    }
-
-    /* E1M3: Hell-touched research facility pickups */
-
-    /* 0: Shotgun, south corridor (accessible early) (10, 23) */
-    g_pickups[0].x = 10 * 256 + 128;
-    g_pickups[0].y = 23 * 256 + 128;
-    g_pickups[0].type = PICKUP_WEAPON_SHOTGUN;
-    g_pickups[0].active = true;
-
-    /* 1: Ammo clip, start room (13, 28) */
-    g_pickups[1].x = 13 * 256 + 128;
-    g_pickups[1].y = 28 * 256 + 128;
-    g_pickups[1].type = PICKUP_AMMO_CLIP;
-    g_pickups[1].active = true;
-
-    /* 2: Shells box, south corridor east (22, 24) */
-    g_pickups[2].x = 22 * 256 + 128;
-    g_pickups[2].y = 24 * 256 + 128;
-    g_pickups[2].type = PICKUP_SHELLS;
-    g_pickups[2].active = true;
-
-    /* 3: Small health, west wing storage (3, 19) */
-    g_pickups[3].x = 3 * 256 + 128;
-    g_pickups[3].y = 19 * 256 + 128;
-    g_pickups[3].type = PICKUP_HEALTH_SMALL;
-    g_pickups[3].active = true;
-
-    /* 4: Large health, west wing (4, 16) */
-    g_pickups[4].x = 4 * 256 + 128;
-    g_pickups[4].y = 16 * 256 + 128;
-    g_pickups[4].type = PICKUP_HEALTH_LARGE;
-    g_pickups[4].active = true;
-
-    /* 5: Shells box, east wing lab (29, 17) */
-    g_pickups[5].x = 29 * 256 + 128;
-    g_pickups[5].y = 17 * 256 + 128;
-    g_pickups[5].type = PICKUP_SHELLS;
-    g_pickups[5].active = true;
-
-    /* 6: Ammo clip, east wing entrance (27, 15) */
-    g_pickups[6].x = 27 * 256 + 128;
-    g_pickups[6].y = 15 * 256 + 128;
-    g_pickups[6].type = PICKUP_AMMO_CLIP;
-    g_pickups[6].active = true;
-
-    /* 7: Small health, central arena west (2, 9) */
-    g_pickups[7].x = 2 * 256 + 128;
-    g_pickups[7].y = 9 * 256 + 128;
-    g_pickups[7].type = PICKUP_HEALTH_SMALL;
-    g_pickups[7].active = true;
-
-    /* 8: Helmet, central arena east (25, 9) */
-    g_pickups[8].x = 25 * 256 + 128;
-    g_pickups[8].y = 9 * 256 + 128;
-    g_pickups[8].type = PICKUP_HELMET;
-    g_pickups[8].active = true;
-
-    /* 9: Armor, hidden armory (secret 1) (2, 4) */
-    g_pickups[9].x = 2 * 256 + 128;
-    g_pickups[9].y = 4 * 256 + 128;
-    g_pickups[9].type = PICKUP_ARMOR;
-    g_pickups[9].active = true;
-
-    /* 10: Rocket launcher, locked tech room (secret 2) (29, 3) */
-    g_pickups[10].x = 29 * 256 + 128;
-    g_pickups[10].y = 3 * 256 + 128;
-    g_pickups[10].type = PICKUP_WEAPON_ROCKET;
-    g_pickups[10].active = true;
-
-    /* 11: Large health, command center near exit (14, 2) */
-    g_pickups[11].x = 14 * 256 + 128;
-    g_pickups[11].y = 2 * 256 + 128;
-    g_pickups[11].type = PICKUP_HEALTH_LARGE;
-    g_pickups[11].active = true;
-}
-
-void initPickupsE1M4(void) {
-    u8 i;
-    for (i = 0; i < MAX_PICKUPS; i++) {
-        g_pickups[i].active = false;
-        g_pickups[i].animFrame = 0;
-        g_pickups[i].animTimer = 0;
-    }
-
-    /* E1M4: web-editor export */
-    g_pickups[0].x = 14 * 256 + 128;
-    g_pickups[0].y = 27 * 256 + 128;
-    g_pickups[0].type = PICKUP_SHELLS;
-    g_pickups[0].active = true;
-    g_pickups[1].x = 15 * 256 + 128;
-    g_pickups[1].y = 27 * 256 + 128;
-    g_pickups[1].type = PICKUP_SHELLS;
-    g_pickups[1].active = true;
-    g_pickups[2].x = 16 * 256 + 128;
-    g_pickups[2].y = 27 * 256 + 128;
-    g_pickups[2].type = PICKUP_HEALTH_SMALL;
-    g_pickups[2].active = true;
-    g_pickups[3].x = 14 * 256 + 128;
-    g_pickups[3].y = 19 * 256 + 128;
-    g_pickups[3].type = PICKUP_WEAPON_ROCKET;
-    g_pickups[3].active = true;
-    g_pickups[4].x = 17 * 256 + 128;
-    g_pickups[4].y = 17 * 256 + 128;
-    g_pickups[4].type = PICKUP_HELMET;
-    g_pickups[4].active = true;
-    g_pickups[5].x = 20 * 256 + 128;
-    g_pickups[5].y = 19 * 256 + 128;
-    g_pickups[5].type = PICKUP_ARMOR;
-    g_pickups[5].active = true;
-    g_pickups[6].x = 16 * 256 + 128;
-    g_pickups[6].y = 23 * 256 + 128;
-    g_pickups[6].type = PICKUP_WEAPON_SHOTGUN;
-    g_pickups[6].active = true;
-    g_pickups[7].x = 2 * 256 + 128;
-    g_pickups[7].y = 21 * 256 + 128;
-    g_pickups[7].type = PICKUP_HEALTH_LARGE;
-    g_pickups[7].active = true;
-    g_pickups[8].x = 2 * 256 + 128;
-    g_pickups[8].y = 5 * 256 + 128;
-    g_pickups[8].type = PICKUP_HELMET;
-    g_pickups[8].active = true;
-    g_pickups[9].x = 3 * 256 + 128;
-    g_pickups[9].y = 5 * 256 + 128;
-    g_pickups[9].type = PICKUP_SHELLS;
-    g_pickups[9].active = true;
-    g_pickups[10].x = 13 * 256 + 128;
-    g_pickups[10].y = 13 * 256 + 128;
-    g_pickups[10].type = PICKUP_HEALTH_SMALL;
-    g_pickups[10].active = true;
-    g_pickups[11].x = 1 * 256 + 128;
-    g_pickups[11].y = 5 * 256 + 128;
-    g_pickups[11].type = PICKUP_HELMET;
-    g_pickups[11].active = true;
-    g_pickups[12].x = 4 * 256 + 128;
-    g_pickups[12].y = 21 * 256 + 128;
-    g_pickups[12].type = PICKUP_AMMO_CLIP;
-    g_pickups[12].active = true;
-    g_pickups[13].x = 23 * 256 + 128;
-    g_pickups[13].y = 14 * 256 + 128;
-    g_pickups[13].type = PICKUP_AMMO_CLIP;
-    g_pickups[13].active = true;
-    g_pickups[14].x = 16 * 256 + 128;
-    g_pickups[14].y = 9 * 256 + 128;
-    g_pickups[14].type = PICKUP_AMMO_CLIP;
-    g_pickups[14].active = true;
-    g_pickups[15].x = 4 * 256 + 128;
-    g_pickups[15].y = 5 * 256 + 128;
-    g_pickups[15].type = PICKUP_WEAPON_ROCKET;
-    g_pickups[15].active = true;
 }
 
 bool spawnPickup(u8 type, u16 x, u16 y) {
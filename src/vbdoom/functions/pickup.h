@@ -70,11 +70,8 @@ extern u8 g_totalItems;
 
 /* ---- API ---- */
 
-/* Initialize pickups: place items on the map. Call once at level start. */
+/* Clear all pickup slots. Call once at level start, before spawnPickup(). */
 void initPickups(void);
-void initPickupsE1M2(void);
-void initPickupsE1M3(void);
-void initPickupsE1M4(void);
 
 /* Spawn a pickup at a position (e.g., ammo drop from dead enemy).
  * Returns true if spawned, false if no free slot. */
@@ -0,0 +1,187 @@
+/*
+ * profiler.c -- per-frame CPU profiler and HUD overlay (see profiler.h)
+ */
+
+#include <libgccvb.h>
+#include <constants.h>
+#include "profiler.h"
+
+#ifndef NO_PROFILER
+
+extern BYTE vb_doomMap[];
+
+u16 g_profStart[PROF_ZONES];
+u16 g_profAcc[PROF_ZONES];
+u16 g_profRing[PROF_HISTORY][PROF_ZONES];
+bool g_profOverlay = false;
+
+static u8 profHead = 0;
+static u16 profFrameStart = 0;
+
+/* Timer ISR cost in cycles (0 = not measured) and PCM voices mixed, per
+ * frame, from the VIP frame latch in timer.c */
+#define PROF_VIP_CYCLES     400000L     /* 20 ms at 20 MHz */
+#define PROF_TIMER_CYCLES   2000        /* 100us timer interval */
+static u16 profIsrRing[PROF_HISTORY];
+static u8 profVoiceRing[PROF_HISTORY];
+
+#ifdef VRAM_STATS
+/* VRAM bytes / 16 per zone and per region, frame over budget, per frame,
+ * from vramStatsFrame() (vramstats.h), and the overlay page showing them */
+static u16 profVramRing[PROF_HISTORY][PROF_ZONES];
+static u16 profVramRegionRing[PROF_HISTORY][VRAM_REGIONS];
+static u8 profVramOver[PROF_HISTORY];
+static bool profVramPage = false;
+#endif
+
+void profFrame(void) {
+	u16 now = PROF_NOW();
+	u16 total = (u16)(now - profFrameStart);
+	u16 used = 0;
+	u16 *slot = g_profRing[profHead];
+	u8 z;
+
+	for (z = 0; z < PROF_OTHER; z++) {
+		used += g_profAcc[z];
+	}
+	used += g_profAcc[PROF_WAIT];
+	g_profAcc[PROF_OTHER] = (total > used) ? (u16)(total - used) : 0;
+	g_profAcc[PROF_TOTAL] = total;
+
+	for (z = 0; z < PROF_ZONES; z++) {
+		slot[z] = g_profAcc[z];
+		g_profAcc[z] = 0;
+	}
+
+	if (g_isrPerVip) {
+		u32 per = PROF_VIP_CYCLES / g_isrPerVip;
+		profIsrRing[profHead] = (per > PROF_TIMER_CYCLES) ? (u16)(per - PROF_TIMER_CYCLES) : 1;
+	} else {
+		profIsrRing[profHead] = 0;
+	}
+	profVoiceRing[profHead] = g_pcmVoicesPeak;
+#ifdef VRAM_STATS
+	for (z = 0; z < PROF_ZONES; z++) {
+		u32 b = (z == PROF_TOTAL ? g_vramLastTotal : g_vramLastBySys[z]) >> 4;
+		profVramRing[profHead][z] = b > 0xFFFF ? 0xFFFF : (u16)b;
+	}
+	for (z = 0; z < VRAM_REGIONS; z++) {
+		u32 b = g_vramLastByRegion[z] >> 4;
+		profVramRegionRing[profHead][z] = b > 0xFFFF ? 0xFFFF : (u16)b;
+	}
+	profVramOver[profHead] = g_vramOverBudget;
+#endif
+	profHead = (profHead + 1) & (PROF_HISTORY - 1);
+	profFrameStart = now;
+}
+
+void profToggleOverlay(void) {
+#ifdef VRAM_STATS
+	if (g_profOverlay && !profVramPage) {
+		profVramPage = true;
+		return;
+	}
+	profVramPage = false;
+#endif
+	g_profOverlay = !g_profOverlay;
+}
+
+/* 3 digits (ticks, clamped to 999) at byte offset off in the HUD BGMap.
+ * vb_doomMap row 18 holds the HUD digits, entry 10 is blank. */
+static void profDrawValue(u16 off, u16 val) {
+	u16 q;
+	u8 d0, d1, d2;
+
+	if (val > 999) val = 999;
+	q = ((u32)val * 205) >> 11;      /* val / 10 */
+	d0 = (u8)(val - q * 10);
+	val = q;
+	q = ((u32)val * 205) >> 11;
+	d1 = (u8)(val - q * 10);
+	d2 = (u8)q;
+
+	VRAM_COUNT(BGMap(LAYER_UI), 8);
+	*((u16*)(BGMap(LAYER_UI) + off))     = *((u16*)(vb_doomMap + 96*18 + (d2 ? d2 : 10) * 2));
+	*((u16*)(BGMap(LAYER_UI) + off + 2)) = *((u16*)(vb_doomMap + 96*18 + ((d2 | d1) ? d1 : 10) * 2));
+	*((u16*)(BGMap(LAYER_UI) + off + 4)) = *((u16*)(vb_doomMap + 96*18 + d0 * 2));
+	*((u16*)(BGMap(LAYER_UI) + off + 6)) = *((u16*)(vb_doomMap + 96*18 + 10 * 2));
+}
+
+#ifdef VRAM_STATS
+/* 4 blank entries at byte offset off in the HUD BGMap */
+static void profDrawBlank(u16 off) {
+	u8 i;
+
+	VRAM_COUNT(BGMap(LAYER_UI), 8);
+	for (i = 0; i < 8; i += 2)
+		*((u16*)(BGMap(LAYER_UI) + off + i)) = *((u16*)(vb_doomMap + 96*18 + 10 * 2));
+}
+#endif
+
+void profDrawOverlay(void) {
+	u16 (*ring)[PROF_ZONES] = g_profRing;
+	u8 z, f;
+
+	if (!g_profOverlay) return;
+#ifdef VRAM_STATS
+	if (profVramPage) ring = profVramRing;
+#endif
+
+	for (z = 0; z < PROF_ZONES; z++) {
+		u32 sum = 0;
+		u16 worst = 0;
+		for (f = 0; f < PROF_HISTORY; f++) {
+			u16 v = ring[f][z];
+			sum += v;
+			if (v > worst) worst = v;
+		}
+		profDrawValue(z * 8, (u16)(sum / PROF_HISTORY)); /* row 0: average (a shift) */
+		profDrawValue(128 + z * 8, worst);               /* row 1: worst */
+	}
+
+#ifdef VRAM_STATS
+	/* Frames over budget: in the ring, since boot; then the budget */
+	if (profVramPage) {
+		u8 over = 0;
+		for (f = 0; f < PROF_HISTORY; f++) over += profVramOver[f];
+		profDrawValue(PROF_ZONES * 8, over);
+		profDrawValue(128 + PROF_ZONES * 8, g_vramOverFrames);
+		profDrawValue(PROF_ZONES * 8 + 8, VRAM_BUDGET >> 4);
+		profDrawBlank(128 + PROF_ZONES * 8 + 8);
+
+		/* Rows 2-3: the same per destination region */
+		for (z = 0; z < VRAM_REGIONS; z++) {
+			u32 sum = 0;
+			u16 worst = 0;
+			for (f = 0; f < PROF_HISTORY; f++) {
+				u16 v = profVramRegionRing[f][z];
+				sum += v;
+				if (v > worst) worst = v;
+			}
+			profDrawValue(256 + z * 8, (u16)(sum / PROF_HISTORY));
+			profDrawValue(384 + z * 8, worst);
+		}
+		return;
+	}
+#endif
+
+	/* Timer ISR cycles: average of the measured frames, worst; then
+	 * PCM voices: this frame, most in the ring */
+	{
+		u32 sum = 0;
+		u16 worst = 0, n = 0;
+		u8 voices = 0;
+		for (f = 0; f < PROF_HISTORY; f++) {
+			u16 v = profIsrRing[f];
+			if (v) { sum += v; n++; }
+			if (v > worst) worst = v;
+			if (profVoiceRing[f] > voices) voices = profVoiceRing[f];
+		}
+		profDrawValue(PROF_ZONES * 8, n ? (u16)(sum / n) : 0);
+		profDrawValue(128 + PROF_ZONES * 8, worst);
+		profDrawValue(PROF_ZONES * 8 + 8, profVoiceRing[(profHead - 1) & (PROF_HISTORY - 1)]);
+		profDrawValue(128 + PROF_ZONES * 8 + 8, voices);
+	}
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * profiler.h -- per-frame CPU profiler
+ *
+ * Zones are timed with the timer ISR count (g_musicTick, free-running),
+ * so a zone costs two reads and an add, no extra ISR work. The timer is
+ * set to 100us, but the ISR re-arms after its body, so a tick is about
+ * 125us: ~8 ticks per ms (timer.c). PROF_BEGIN/PROF_END may be used
+ * more than once per frame for the same zone: the time adds up.
+ * profFrame() closes the frame into a PROF_HISTORY deep ring buffer.
+ * While no PCM plays the ISR runs at 1 kHz (timer.c) and short zones
+ * read in steps of about 8 ticks.
+ *
+ * The overlay (profToggleOverlay, L+R+Select in game) prints on the HUD
+ * layer, one 3 digit value per zone in ticks (divide by 8 for ms):
+ *   row 0: average over the ring    row 1: worst frame in the ring
+ * in zone order TRACE ENEMY SPRITE HUD AUDIO OTHER WAIT TOTAL, then two
+ * more columns measured from the timer ISR rate (g_isrPerVip, timer.h):
+ *   ISR    cycles per timer ISR call (row 0 average, row 1 worst)
+ *   VOICES PCM voices mixed (row 0 this frame, row 1 most in the ring)
+ * Watching ISR while VOICES climbs gives the mixer's per-voice cost.
+ * setFrameTime() sets the frame as ms * 10 ticks, so at 20 fps the budget
+ * for TOTAL, WAIT included, is 500 ticks, which is ~62 ms of real time.
+ *
+ * The zones double as the VRAM accounting subsystems (vramstats.h): VRAM
+ * written between PROF_BEGIN(z) and PROF_END(z) is booked to z, the rest
+ * to PROF_OTHER. That part stays when the profiler is compiled out. In a
+ * VRAM_STATS build L+R+Select goes on to a second page with the same
+ * rows and zones in VRAM bytes / 16 (TOTAL is the whole frame), then:
+ *   OVER   frames over VRAM_BUDGET (row 0 in the ring, row 1 since boot)
+ *   BUDGET VRAM_BUDGET / 16 (row 0)
+ * and rows 2-3 hold the average and worst per destination region, in
+ * order CHR BGMAP PARAM WORLD FB (VRAM_REGION).
+ *
+ * Build with NO_PROFILER to compile every hook out.
+ */
+#ifndef _FUNCTIONS_PROFILER_H
+#define _FUNCTIONS_PROFILER_H
+
+#include <types.h>
+#include <stdbool.h>
+#include <vramstats.h>
+#include "timer.h"
+
+#define PROF_TRACE      0   /* TraceFrame: walls + sprite draw */
+#define PROF_ENEMY      1   /* updateEnemies */
+#define PROF_SPRITE     2   /* visible enemy selection + frame upload */
+#define PROF_HUD        3   /* face, weapon, HUD digits */
+#define PROF_AUDIO      4   /* music sequencer */
+#define PROF_OTHER      5   /* rest of the frame, derived in profFrame() */
+#define PROF_WAIT       6   /* idle in waitForSimTick */
+#define PROF_TOTAL      7   /* whole frame, derived in profFrame() */
+#define PROF_ZONES      8
+
+#define PROF_HISTORY    16  /* frames kept, power of two */
+
+/* Current time in ISR ticks (~125us). Wraps every ~8 s, deltas are fine. */
+#define PROF_NOW()      ((u16)g_musicTick)
+
+#ifndef NO_PROFILER
+
+extern u16 g_profStart[PROF_ZONES];
+extern u16 g_profAcc[PROF_ZONES];
+extern u16 g_profRing[PROF_HISTORY][PROF_ZONES];
+extern bool g_profOverlay;
+
+#define PROF_BEGIN(z)   (VRAM_SYS(z), g_profStart[z] = PROF_NOW())
+#define PROF_END(z)     (g_profAcc[z] += (u16)(PROF_NOW() - g_profStart[z]), \
+                         VRAM_SYS(PROF_OTHER))
+
+/* Close the current frame into the ring and start the next one.
+ * Call once per frame, right after waitForSimTick() and
+ * vramStatsFrame(). */
+void profFrame(void);
+
+/* Show the overlay, its VRAM page (VRAM_STATS), hide it. Hiding leaves
+ * the HUD rows dirty: redraw them. */
+void profToggleOverlay(void);
+
+/* Print the ring summary on the HUD layer if the overlay is on. */
+void profDrawOverlay(void);
+
+#else
+
+#define PROF_BEGIN(z)   VRAM_SYS(z)
+#define PROF_END(z)     VRAM_SYS(PROF_OTHER)
+#define profFrame()
+#define profToggleOverlay()
+#define profDrawOverlay()
+#define g_profOverlay   false
+
+#endif
+
+#endif
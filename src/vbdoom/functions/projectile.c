@@ -5,6 +5,7 @@
 #include "RayCasterFixed.h"
 #include "enemy.h"
 #include "sndplay.h"
+#include "lockstep.h"
 #include "../assets/audio/doom_sfx.h"
 
 /* Global projectile array */
@@ -14,38 +15,6 @@ Projectile g_projectiles[MAX_PROJECTILES];
 extern u8 g_lastEnemyDamage;
 extern s8 g_lastEnemyDamageDir;
 
-/* Simple PRNG (share with enemy.c) */
-static u16 projRng = 54321;
-static u8 projRandom(void) {
-    projRng = projRng * 25173 + 13849;
-    return (u8)(projRng >> 8);
-}
-
-/* Fixed-point atan2 (0-1023 range) - same as enemy.c */
-static s16 projAtan2(s16 dy, s16 dx) {
-    s16 angle;
-    s16 adx = dx < 0 ? -dx : dx;
-    s16 ady = dy < 0 ? -dy : dy;
-
-    if (adx == 0 && ady == 0) return 0;
-
-    if (adx >= ady) {
-        angle = (s16)(((s32)ady * 128) / (s32)adx);
-    } else {
-        angle = 256 - (s16)(((s32)adx * 128) / (s32)ady);
-    }
-
-    if (dx >= 0 && dy < 0) {
-        angle = 1024 - angle;
-    } else if (dx < 0 && dy < 0) {
-        angle = 512 + angle;
-    } else if (dx < 0 && dy >= 0) {
-        angle = 512 - angle;
-    }
-
-    return angle & 1023;
-}
-
 void initProjectiles(void) {
     u8 i;
     for (i = 0; i < MAX_PROJECTILES; i++) {
@@ -57,7 +26,8 @@ void spawnFireball(u16 sx, u16 sy, u16 tx, u16 ty, u8 sourceIdx) {
     u8 i;
     Projectile *p;
     s16 dx, dy;
-    s32 dist;
+    u16 dist;
+    u8 shift = 0;
     s16 ndx, ndy;
 
     /* Find a free slot */
@@ -74,21 +44,17 @@ void spawnFireball(u16 sx, u16 sy, u16 tx, u16 ty, u8 sourceIdx) {
     dx = (s16)tx - (s16)sx;
     dy = (s16)ty - (s16)sy;
 
-    /* Normalize to FIREBALL_SPEED magnitude */
-    dist = (s32)dx * dx + (s32)dy * dy;
+    /* Normalize to FIREBALL_SPEED magnitude: speed * d / |d|, with no
+     * divide. |d| (within 5%) and d come down together until |d| fits
+     * RECIP8LUT, then 32768/|d| from the table. */
+    dist = fix_dist_oct(dx, dy);
     if (dist == 0) {
         ndx = FIREBALL_SPEED;
         ndy = 0;
     } else {
-        /* Approximate: speed * dx / sqrt(dist) */
-        u16 adist;
-        u16 adx = (u16)(dx < 0 ? -dx : dx);
-        u16 ady = (u16)(dy < 0 ? -dy : dy);
-        if (adx > ady) adist = adx + (ady >> 1);
-        else adist = ady + (adx >> 1);
-        if (adist == 0) adist = 1;
-        ndx = (s16)(((s32)dx * FIREBALL_SPEED) / (s32)adist);
-        ndy = (s16)(((s32)dy * FIREBALL_SPEED) / (s32)adist);
+        while (dist > 255) { dist >>= 1; shift++; }
+        ndx = (s16)(((s32)(dx >> shift) * RECIP8LUT[dist] * FIREBALL_SPEED) >> 15);
+        ndy = (s16)(((s32)(dy >> shift) * RECIP8LUT[dist] * FIREBALL_SPEED) >> 15);
     }
 
     p->x = sx;
@@ -100,7 +66,7 @@ void spawnFireball(u16 sx, u16 sy, u16 tx, u16 ty, u8 sourceIdx) {
     p->state = PROJ_FLYING;
     p->sourceEnemy = sourceIdx;
     p->type = PROJ_TYPE_FIREBALL;
-    p->angle = projAtan2(dy, dx);
+    p->angle = fix_atan2(dy, dx);
 }
 
 /* 32-direction velocity tables (s16, 8.8 fixed-point).
@@ -209,7 +175,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                 if (pdy < 0) pdy = -pdy;
                 if (pdx < 64 && pdy < 64) {
                     /* Direct hit on local player from P2's rocket */
-                    u8 rDmg = (u8)(20 * ((projRandom() & 7) + 1));
+                    u8 rDmg = (u8)(20 * ((rnd8() & 7) + 1));
                     if (rDmg > 160) rDmg = 160;
                     g_lastEnemyDamage += rDmg;
                     if (g_lastEnemyDamage > 200) g_lastEnemyDamage = 200;
@@ -225,8 +191,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                 if (pdy < 0) pdy = -pdy;
                 if (pdx < 64 && pdy < 64) {
                     /* Hit player with fireball */
-                    u8 damage = FIREBALL_DAMAGE_MIN +
-                        (projRandom() % (FIREBALL_DAMAGE_MAX - FIREBALL_DAMAGE_MIN + 1));
+                    u8 damage = FIREBALL_DAMAGE(rnd8());
                     g_lastEnemyDamage += damage;
                     if (g_lastEnemyDamage > 50) g_lastEnemyDamage = 50;  /* per-frame cap */
 
@@ -234,7 +199,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                     {
                         s16 atx = (s16)p->x - (s16)playerX;
                         s16 aty = (s16)p->y - (s16)playerY;
-                        s16 angleToProj = (256 - projAtan2(aty, atx)) & 1023;
+                        s16 angleToProj = (256 - fix_atan2(aty, atx)) & 1023;
                         s16 relAngle = angleToProj - playerA;
                         if (relAngle > 512)  relAngle -= 1024;
                         if (relAngle < -512) relAngle += 1024;
@@ -246,6 +211,20 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                 }
             }
 
+            /* Lockstep co-op: fireballs hit the JOIN too */
+            if (!hitSomething && p->type == PROJ_TYPE_FIREBALL && g_lockJoin.active) {
+                pdx = (s16)p->x - (s16)g_lockJoin.x;
+                pdy = (s16)p->y - (s16)g_lockJoin.y;
+                if (pdx < 0) pdx = -pdx;
+                if (pdy < 0) pdy = -pdy;
+                if (pdx < 64 && pdy < 64) {
+                    u8 damage = FIREBALL_DAMAGE(rnd8());
+                    g_lockJoin.damage += damage;
+                    if (g_lockJoin.damage > 50) g_lockJoin.damage = 50;
+                    hitSomething = 1;
+                }
+            }
+
             if (hitSomething) {
                 /* Explode */
                 p->state = PROJ_EXPLODING;
@@ -256,7 +235,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                     /* Rocket explosion: splash damage to all enemies and player */
                     u8 ei;
                     /* Doom: 20*(P_Random()%8+1) = 20,40,60,...160 */
-                    u8 directDmg = (u8)(20 * ((projRandom() & 7) + 1));
+                    u8 directDmg = (u8)(20 * ((rnd8() & 7) + 1));
                     playPlayerSFX(SFX_BARREL_EXPLODE);
 
                     /* Damage enemies in splash radius */
@@ -267,7 +246,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                         if (!e->active || e->state == ES_DEAD) continue;
                         edx = (s16)p->x - (s16)e->x;
                         edy = (s16)p->y - (s16)e->y;
-                        dist = approxDist(edx, edy);
+                        dist = fix_dist(edx, edy);
                         if (dist < ROCKET_SPLASH_RADIUS) {
                             u8 dmg;
                             if (hitSomething == 2) {
@@ -288,7 +267,7 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                     {
                         s16 ppdx = (s16)p->x - (s16)playerX;
                         s16 ppdy = (s16)p->y - (s16)playerY;
-                        u16 pdist = approxDist(ppdx, ppdy);
+                        u16 pdist = fix_dist(ppdx, ppdy);
                         if (pdist < ROCKET_SPLASH_RADIUS) {
                             u8 selfDmg = (u8)((u16)(ROCKET_SPLASH_RADIUS - pdist) >> 2);
                             if (selfDmg > 0) {
@@ -299,6 +278,17 @@ void updateProjectiles(u16 playerX, u16 playerY, s16 playerA) {
                             }
                         }
                     }
+                    /* Lockstep co-op: and the JOIN's */
+                    if (g_lockJoin.active) {
+                        s16 ppdx = (s16)p->x - (s16)g_lockJoin.x;
+                        s16 ppdy = (s16)p->y - (s16)g_lockJoin.y;
+                        u16 pdist = fix_dist(ppdx, ppdy);
+                        if (pdist < ROCKET_SPLASH_RADIUS) {
+                            u8 selfDmg = (u8)((u16)(ROCKET_SPLASH_RADIUS - pdist) >> 2);
+                            g_lockJoin.damage += selfDmg;
+                            if (g_lockJoin.damage > 50) g_lockJoin.damage = 50;
+                        }
+                    }
                 } else {
                     playPlayerSFX(SFX_PROJECTILE_CONTACT);
                 }
@@ -25,6 +25,9 @@
 #define FIREBALL_SPEED    40
 #define FIREBALL_DAMAGE_MIN  3
 #define FIREBALL_DAMAGE_MAX  24
+/* MIN..MAX from a random byte r, a multiply and a shift (no divide) */
+#define FIREBALL_DAMAGE(r)   (FIREBALL_DAMAGE_MIN + (u8)(((u16)(r) \
+    * (FIREBALL_DAMAGE_MAX - FIREBALL_DAMAGE_MIN + 1)) >> 8))
 #define FIREBALL_EXPLODE_NFRAMES  5
 #define FIREBALL_EXPLODE_RATE    4  /* frames per explosion anim step */
 
@@ -0,0 +1,155 @@
+/*
+ * snapshot.c -- smooth player 2 between state packets (see snapshot.h)
+ */
+
+#include <libgccvb.h>
+#include "link.h"
+#include "snapshot.h"
+
+#define SNAP_MASK       (SNAP_RING - 1)
+#define SNAP(n)         (snaps[(snapHead - 1 - (n)) & SNAP_MASK])  /* n-th newest */
+
+typedef struct {
+	u16 frame;          /* peer frame, unwrapped */
+	u16 x, y;
+	u16 angle;
+} Snapshot;
+
+static Snapshot snaps[SNAP_RING];
+static u8  snapHead = 0;        /* next slot to fill */
+static u8  snapCount = 0;
+static u16 localFrame = 0;
+static u16 lastArrival;         /* localFrame of the newest snapshot */
+static u16 latency;             /* localFrame - peer frame, smallest seen */
+static u16 spacing8;            /* average frames between snapshots, x8 */
+static u8  creep;
+
+/* Shortest turn from one angle (0-1023) to another */
+static s16 turnTo(u16 from, u16 to) {
+	return (s16)((to - from + 512) & 1023) - 512;
+}
+
+/* num / den in 1/256, through RECIP8LUT (libgccvb/math.h) instead of a
+ * divide. Snapshots are at most 255 peer frames apart (u8 frame). */
+static u16 ratio8(u16 num, u16 den) {
+	if (den > 255) den = 255;
+	return (u16)(((u32)num * RECIP8LUT[den]) >> 7);
+}
+
+/* d over dt frames, scaled to ahead frames, at most cap per frame */
+static s16 extrap(s16 d, u16 dt, u16 ahead, s16 cap) {
+	s32 v = ((s32)d * ratio8(ahead, dt)) >> 8;
+	s32 lim = (s32)cap * ahead;
+
+	if (v > lim) v = lim;
+	if (v < -lim) v = -lim;
+	return (s16)v;
+}
+
+void snapReset(u16 x, u16 y, u16 angle) {
+	snapCount = 0;
+	g_player2X = x;
+	g_player2Y = y;
+	g_player2Angle = angle;
+}
+
+void snapPush(u8 frame, u16 x, u16 y, u16 angle) {
+	Snapshot *s;
+	u16 f, lat;
+
+	if (snapCount && (u16)(localFrame - lastArrival) < SNAP_GAP) {
+		const Snapshot *last = &SNAP(0);
+		u16 dt = (u8)(frame - (u8)last->frame);   /* packets come in order */
+
+		f = last->frame + dt;
+		if (dt == 0) {
+			snapHead = (snapHead - 1) & SNAP_MASK;  /* same frame: replace */
+			snapCount--;
+		} else if ((s16)(x - last->x) > SNAP_TELEPORT || (s16)(last->x - x) > SNAP_TELEPORT
+		        || (s16)(y - last->y) > SNAP_TELEPORT || (s16)(last->y - y) > SNAP_TELEPORT) {
+			snapCount = 0;                          /* respawn: no path to it */
+		} else {
+			if (dt > 8) dt = 8;                     /* lost packets: not the rate */
+			spacing8 += dt - (spacing8 >> 3);
+		}
+	} else {
+		/* First packet, or after a long gap: the low byte may have wrapped */
+		snapCount = 0;
+		f = frame;
+		latency = localFrame - f;
+		spacing8 = LINK_STATE_FRAMES << 3;
+		creep = 0;
+	}
+
+	/* The fastest packet tells the clock offset; creep up so that the
+	 * peer running slower than us does not leave us ahead of it */
+	lat = localFrame - f;
+	if ((s16)(lat - latency) < 0) {
+		latency = lat;
+		creep = 0;
+	} else if (++creep >= SNAP_CREEP) {
+		latency++;
+		creep = 0;
+	}
+
+	s = &snaps[snapHead];
+	s->frame = f;
+	s->x = x;
+	s->y = y;
+	s->angle = angle;
+	snapHead = (snapHead + 1) & SNAP_MASK;
+	if (snapCount < SNAP_RING) snapCount++;
+	lastArrival = localFrame;
+}
+
+void snapUpdate(void) {
+	if (snapCount) {
+		u16 delay = ((spacing8 + 7) >> 3) + SNAP_JITTER;
+		u16 t = localFrame - latency - delay;   /* peer frame to show */
+		const Snapshot *a = &SNAP(0);
+		const Snapshot *b;
+
+		if (snapCount == 1 || (s16)(t - a->frame) >= 0) {
+			/* Nothing newer yet: carry on from the last two */
+			u16 ahead = t - a->frame;
+
+			g_player2X = a->x;
+			g_player2Y = a->y;
+			g_player2Angle = a->angle;
+			if (snapCount > 1 && (s16)ahead > 0) {
+				u16 dt;
+
+				b = &SNAP(1);
+				dt = a->frame - b->frame;
+				if (ahead > SNAP_EXTRAP_MAX) ahead = SNAP_EXTRAP_MAX;
+				g_player2X += extrap((s16)(a->x - b->x), dt, ahead, SNAP_MAX_SPEED);
+				g_player2Y += extrap((s16)(a->y - b->y), dt, ahead, SNAP_MAX_SPEED);
+				g_player2Angle = (g_player2Angle
+				                  + extrap(turnTo(b->angle, a->angle), dt, ahead, SNAP_MAX_TURN)) & 1023;
+			}
+		} else {
+			/* Find a (at or before t) and b (after it) */
+			u8 n;
+
+			b = a;
+			for (n = 1; n < snapCount; n++) {
+				a = &SNAP(n);
+				if ((s16)(t - a->frame) >= 0) break;
+				b = a;
+			}
+			if (n == snapCount) {
+				/* Older than all we kept: the oldest */
+				g_player2X = b->x;
+				g_player2Y = b->y;
+				g_player2Angle = b->angle;
+			} else {
+				s32 r = ratio8(t - a->frame, b->frame - a->frame);
+
+				g_player2X = a->x + (s16)(((s16)(b->x - a->x) * r) >> 8);
+				g_player2Y = a->y + (s16)(((s16)(b->y - a->y) * r) >> 8);
+				g_player2Angle = (a->angle + (s16)((turnTo(a->angle, b->angle) * r) >> 8)) & 1023;
+			}
+		}
+	}
+	localFrame++;
+}
@@ -0,0 +1,48 @@
+/*
+ * snapshot.h -- smooth player 2 between state packets
+ *
+ * The state packets (link.h) arrive when the cable and the peer's frame
+ * rate allow: late, bunched up, and with state packets sent only every
+ * LINK_STATE_FRAMES frames, not every frame. Drawing player 2 exactly as
+ * last received makes it stutter. Instead every packet is kept as a
+ * snapshot stamped with the frame the peer simulated it on, and player 2
+ * is drawn a little in the past, where two snapshots are known:
+ *
+ *   - the peer's frames are mapped to ours by the smallest latency seen
+ *     (a packet that came fast), creeping up slowly to follow drift;
+ *   - the view runs the average snapshot spacing plus SNAP_JITTER frames
+ *     behind that, and interpolates between the two snapshots around it;
+ *   - when the next snapshot is late it extrapolates from the last two,
+ *     for at most SNAP_EXTRAP_MAX frames at SNAP_MAX_SPEED, then holds.
+ *
+ * A jump of more than SNAP_TELEPORT (respawn, teleporter) is shown at
+ * once. The result goes to g_player2X, g_player2Y and g_player2Angle.
+ * Frames are simulation ticks (timer.h): they do not bunch up when the
+ * loop catches up, so the timing survives a slow render on either side.
+ */
+#ifndef _FUNCTIONS_SNAPSHOT_H
+#define _FUNCTIONS_SNAPSHOT_H
+
+#include <types.h>
+
+#define SNAP_RING        8      /* power of two */
+#define SNAP_JITTER      1      /* frames of lateness hidden by the delay */
+#define SNAP_EXTRAP_MAX  4      /* frames to extrapolate before holding */
+#define SNAP_MAX_SPEED   128    /* 8.8 units per frame and axis (running: ~113) */
+#define SNAP_MAX_TURN    32     /* angle units per frame (turning: 10) */
+#define SNAP_TELEPORT    512    /* 8.8 units: two tiles */
+#define SNAP_GAP         128    /* frames without a packet: start over */
+#define SNAP_CREEP       16     /* snapshots per frame the latency creeps up */
+
+/* Start over with player 2 at x, y, angle (level start) */
+void snapReset(u16 x, u16 y, u16 angle);
+
+/* A state packet arrived: the peer's frame (low byte, LinkState.time)
+ * and player 2 on it. Call before snapUpdate in the same frame. */
+void snapPush(u8 frame, u16 x, u16 y, u16 angle);
+
+/* Once per simulation tick: advance the local frame and set
+ * g_player2X, g_player2Y and g_player2Angle for it. */
+void snapUpdate(void);
+
+#endif
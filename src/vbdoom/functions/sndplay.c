@@ -27,32 +27,47 @@
  *   - Waveform channels use g_musicVolume (0-4)
  *   - Game SFX use g_sfxVolume (0-15)
  *
- * All sequencer channels share one timing array (lock-step).
- * Timing values are in milliseconds; actual timing measured via
- * g_musicTick (10 kHz ISR counter) for rate-independent playback.
+ * Each channel is an event stream (format in convert_midi.py): a note
+ * or rest plus its duration in milliseconds, with running velocity and
+ * arpeggio, pattern references and a loop at the end. Durations are
+ * timed via g_musicTick (10 kHz ISR counter). updateMusic() decodes
+ * events into timed register writes up to MUS_LOOKAHEAD ticks ahead;
+ * the timer ISR plays each on the tick it is due (timer.h), so tempo
+ * does not follow the frame rate.
  *
- * Tonal channel encoding (melody/bass/chords):
- *   bits 15-12 = velocity (0-15; 0 = silence/rest)
- *   bits 10-4  = MIDI note number (0-127)
- *   VB freq looked up via midi_freq[] table at runtime.
+ * Tonal channels play MIDI notes; VB freq looked up via midi_freq[]
+ * table at runtime.
  *
- * Arpeggio (tracker-style 0xy effect, optional per song):
- *   One u8 per step. Upper nibble = semitone offset for 2nd note,
+ * Arpeggio (tracker-style 0xy effect, optional per note):
+ *   Upper nibble = semitone offset for 2nd note,
  *   lower nibble = offset for 3rd note. 0x00 = no arpeggio.
- *   Player cycles: base, base+hi, base+lo at ~50Hz (frame rate).
- *
- * Drum values are PCM SFX IDs (from doom_sfx.h). 0 = silence.
+ *   Player cycles: base, base+hi, base+lo every ARP_PHASE_TICKS.
  * ================================================================ */
 
-#define MUS_NUM_CH     4   /* Total music channels */
+#define MUS_NUM_CH     3   /* Tonal music channels */
 #define MUS_CH_MELODY  0   /* VB sound channel index */
 #define MUS_CH_BASS    1
 #define MUS_CH_CHORDS  3
-/* Drums are PCM samples on ch2/ch4, no dedicated hw channel */
+
+/* Event stream commands (see convert_midi.py) */
+#define MUS_CMD_VEL      0x80    /* | velocity, a note follows */
+#define MUS_CMD_ARP      0x90    /* arp byte follows */
+#define MUS_CMD_PATTERN  0xA0    /* offset lo, hi, event count follow */
+#define MUS_CMD_END      0xFF    /* loop to the start */
+
+/* Event durations are in ms, g_musicTick counts ~8 per ms (timer.h;
+ * the idle credit keeps that rate at 1 kHz too) */
+#define MUS_TICKS_PER_MS  8
+
+/* How far ahead updateMusic() queues notes, in ticks (~125 ms): frames
+ * up to that long leave no gap in the music */
+#define MUS_LOOKAHEAD     1000
+
+/* Most events one channel may decode per update (catch-up bound) */
+#define MUS_MAX_EVENTS    MUS_QUEUE_LEN
 
 /* Arpeggio phase rate: ticks between note changes.
- * ISR runs at 10kHz; g_musicTick increments 1:1 with ISR.
- * 88 ticks ≈ 8.8ms ≈ arpeggio phase at ~38Hz. */
+ * 88 ticks ≈ 11ms at the effective ~8 kHz tick rate. */
 #define ARP_PHASE_TICKS  88
 
 /* MIDI note number to VB frequency register lookup table (128 entries).
@@ -92,20 +107,28 @@ u8 g_musicSetting = 5;
 /* Raw settings.rumble value (0-9) for pause-menu reconstruction */
 u8 g_rumbleSetting = 0;
 
-/* Sequencer state */
-static const int   *mus_ch[MUS_NUM_CH] = {0, 0, 0, 0};  /* [melody, bass, chords, drums] */
-static const u16   *mus_timing   = 0;        /* shared timing (ms per step) */
-static const u8    *mus_arp      = 0;        /* arp offsets (NULL = no arp) */
-static u8           mus_arpCh    = 0;        /* which tonal ch has arp (0-2) */
-static u16          mus_noteCount = 0;
-static u16          mus_currNote  = 0;
+/* Sequencer state, one per tonal channel */
+typedef struct {
+	const u8 *start;   /* stream start: loop point, pattern base */
+	const u8 *pos;     /* next command */
+	const u8 *ret;     /* inside a pattern: where to continue, else 0 */
+	u8  left;          /* inside a pattern: events left */
+	u8  vel;           /* running velocity */
+	u8  arp;           /* running arpeggio */
+	u8  note;          /* current note (0 = rest) */
+	u8  noteVel;       /* its velocity */
+	u8  noteArp;       /* its arpeggio */
+	u8  arpPhase;      /* arpeggio phase last queued */
+	u32 arpNext;       /* g_musicTick of the next arpeggio phase */
+	u32 due;           /* g_musicTick of the next event */
+} MusChannel;
+
+static const u8    *mus_stream[MUS_NUM_CH] = {0, 0, 0};  /* [melody, bass, chords] */
+static MusChannel   mus_chan[MUS_NUM_CH];
 static u8           mus_playing   = 0;
-static u16          mus_prevFreq[MUS_NUM_CH] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
-static u32          mus_noteStart = 0;       /* g_musicTick when step started */
 
-/* VB sound channel indices for tonal music channels.
- * Index 3 (drums) is unused -- drums are PCM via playMusicDrum(). */
-static const u8 mus_hw_ch[MUS_NUM_CH] = { 0x00, 0x01, 0x03, 0x05 };
+/* VB sound channel indices for tonal music channels. */
+static const u8 mus_hw_ch[MUS_NUM_CH] = { MUS_CH_MELODY, MUS_CH_BASS, MUS_CH_CHORDS };
 
 /* Music volume lookup table: settings (0-9) → g_musicVolume.
  * VB waveform synthesis channels are ~4x louder than PCM SxLRV modulation,
@@ -130,8 +153,8 @@ u8 musicVolFromSetting(u8 setting) {
 /* ================================================================
  * PCM Sound Effects via SxLRV Volume Modulation
  *
- * Player sounds use channel 4 (SWEEP), modulated by timer ISR.
- * Enemy sounds use channel 2 (WAVE3), modulated by timer ISR.
+ * Voices are mixed by the timer ISR into channel 4 (SWEEP) and
+ * channel 2 (WAVE3), see timer.h.
  *
  * Technique (from DogP's wavonvb):
  *   - Waveform RAM filled with DC constant (0x3F = max 6-bit)
@@ -173,8 +196,8 @@ void mp_init(void) {
 	/* Fill waveform RAM banks for PCM channels with DC constant.
 	 * WAVEDATA entries are at 4-byte stride (byte writes). */
 	for (i = 0; i < 32; i++) {
-		WAVEDATA3[i << 2] = 0x3F;  /* for enemy ch2 */
-		WAVEDATA5[i << 2] = 0x3F;  /* for player ch4 */
+		WAVEDATA3[i << 2] = 0x3F;  /* for PCM DAC ch2 */
+		WAVEDATA5[i << 2] = 0x3F;  /* for PCM DAC ch4 */
 	}
 
 	/* Load waveforms for music channels.
@@ -200,7 +223,11 @@ void mp_init(void) {
 	SND_REGS[0x05].SxINT = 0x00;
 	SND_REGS[0x05].SxLRV = 0x00;
 
-	/* --- Configure PCM player channel (ch4 SWEEP) --- */
+	/* --- PCM DAC channels: ch4 and ch2, mixed into by the ISR --- */
+	for (i = 0; i < PCM_VOICES; i++)
+		g_pcmVoice[i].playing = 0;
+
+	/* --- Configure PCM DAC channel, low half (ch4 SWEEP) --- */
 	SND_REGS[0x04].SxRAM = 0x04;  /* use WAVEDATA5 */
 	SND_REGS[0x04].SxLRV = 0x00;  /* muted until playback */
 	SND_REGS[0x04].SxEV0 = 0xF0;  /* max initial envelope, no step */
@@ -210,7 +237,7 @@ void mp_init(void) {
 	SND_REGS[0x04].S5SWP = 0x00;  /* disable sweep */
 	SND_REGS[0x04].SxINT = 0x80;  /* enable channel */
 
-	/* --- Configure PCM enemy channel (ch2 WAVE3) --- */
+	/* --- Configure PCM DAC channel, high half (ch2 WAVE3) --- */
 	SND_REGS[0x02].SxRAM = 0x02;  /* use WAVEDATA3 */
 	SND_REGS[0x02].SxLRV = 0x00;  /* muted until playback */
 	SND_REGS[0x02].SxEV0 = 0xF0;  /* max initial envelope, no step */
@@ -221,49 +248,98 @@ void mp_init(void) {
 }
 
 /* ----------------------------------------------------------------
- * Start PCM on the player channel (ch4 SWEEP).
- * Just sets up the stream state; the ISR handles SxLRV writes.
- * Ch4 is a dedicated PCM channel -- no music plays there.
+ * PCM voice allocation (the ISR mixes g_pcmVoice, see timer.h).
+ *
+ * A player sound replaces the player's previous one, as the old
+ * dedicated channel did. Anything else takes a free voice, or steals
+ * the least important playing one: lowest priority class, then the
+ * quietest, then the one nearest its end. A sound finding only
+ * higher-priority voices is dropped.
  * ---------------------------------------------------------------- */
-void playPlayerSFX(u8 soundId) {
-	if (soundId >= SFX_COUNT) return;
+static u8 sfxPriority(u8 soundId) {
+	switch (soundId) {
+	case SFX_POSSESSED_SIGHT1:
+	case SFX_POSSESSED_ACTIVITY:
+	case SFX_IMP_SIGHT1:
+	case SFX_IMP_ACTIVITY:
+	case SFX_PINKY_SIGHT:
+		return PCM_PRIO_AMBIENT;
+	case SFX_POSSESSED_DEATH1:
+	case SFX_IMP_DEATH1:
+	case SFX_PINKY_DEATH:
+	case SFX_BARREL_EXPLODE:
+	case SFX_TELEPORT:
+		return PCM_PRIO_DEATH;
+	default:
+		return PCM_PRIO_ENEMY;
+	}
+}
+
+static s8 pcmPickVoice(u8 priority, u8 player) {
+	s8 best = -1;
+	u8 v;
 
-	/* Stop current playback to avoid ISR reading inconsistent state */
-	g_pcmPlayer.playing = 0;
-	SND_REGS[0x04].SxLRV = 0x00;
+	if (player) {
+		for (v = 0; v < PCM_VOICES; v++)
+			if (g_pcmVoice[v].playing && g_pcmVoice[v].player) return v;
+	}
+	for (v = 0; v < PCM_VOICES; v++)
+		if (!g_pcmVoice[v].playing) return v;
+
+	for (v = 0; v < PCM_VOICES; v++) {
+		volatile PCMStream *s = &g_pcmVoice[v];
+		volatile PCMStream *b;
+		if (s->priority > priority) continue;
+		if (best < 0) { best = v; continue; }
+		b = &g_pcmVoice[best];
+		if (s->priority < b->priority ||
+			(s->priority == b->priority &&
+			 (s->volume < b->volume ||
+			  (s->volume == b->volume &&
+			   (u16)(s->length - s->cursor) < (u16)(b->length - b->cursor)))))
+			best = v;
+	}
+	return best;
+}
 
-	/* Set up PCM stream state */
-	g_pcmPlayer.data = sfx_table[soundId].data;
-	g_pcmPlayer.length = sfx_table[soundId].length;
-	g_pcmPlayer.cursor = 0;
-	g_pcmPlayer.volume = 15;
+static void pcmStart(u8 soundId, u8 volume, u8 priority, u8 player) {
+	volatile PCMStream *s;
+	s8 v;
 
-	/* Start -- ISR will begin writing samples on next tick */
-	g_pcmPlayer.playing = 1;
+	if (soundId >= SFX_COUNT) return;
+	v = pcmPickVoice(priority, player);
+	if (v < 0) return;
+	s = &g_pcmVoice[v];
+
+	/* Stop the voice first so the ISR never mixes a half-set one */
+	s->playing = 0;
+	s->data = sfx_table[soundId].data;
+	s->length = sfx_table[soundId].length;
+	s->bits = sfx_table[soundId].bits;
+	s->cursor = 0;
+	s->volume = volume;
+	s->priority = priority;
+	s->player = player;
+	s->pred = 128;
+	s->step = 0;
+
+	/* Start -- ISR will begin mixing it on next tick */
+	s->playing = 1;
+	timerWake();
 }
 
 /* ----------------------------------------------------------------
- * Start PCM on the enemy channel (ch2 WAVE3).
- * Ch2 is a dedicated PCM channel -- no music plays there.
+ * Start a player sound (full volume, highest priority).
  * ---------------------------------------------------------------- */
-void playEnemySFX(u8 soundId, u8 distance) {
-	u8 vol;
-	if (soundId >= SFX_COUNT) return;
-
-	vol = distToVol(distance);
-
-	/* Stop current playback to avoid ISR reading inconsistent state */
-	g_pcmEnemy.playing = 0;
-	SND_REGS[0x02].SxLRV = 0x00;
-
-	/* Set up PCM stream state */
-	g_pcmEnemy.data = sfx_table[soundId].data;
-	g_pcmEnemy.length = sfx_table[soundId].length;
-	g_pcmEnemy.cursor = 0;
-	g_pcmEnemy.volume = vol;
+void playPlayerSFX(u8 soundId) {
+	pcmStart(soundId, 15, PCM_PRIO_PLAYER, 1);
+}
 
-	/* Start -- ISR will begin writing samples on next tick */
-	g_pcmEnemy.playing = 1;
+/* ----------------------------------------------------------------
+ * Start a world sound, attenuated by distance.
+ * ---------------------------------------------------------------- */
+void playEnemySFX(u8 soundId, u8 distance) {
+	pcmStart(soundId, distToVol(distance), sfxPriority(soundId), 0);
 }
 
 /* ----------------------------------------------------------------
@@ -276,96 +352,76 @@ void musicLoadSong(u8 songId) {
 	/* Stop current playback first */
 	musicStop();
 
-	mus_arp    = 0;  /* default: no arpeggio */
-	mus_arpCh  = 0;
-
 	switch (songId) {
 		case SONG_TITLE:
-			mus_ch[0]     = music_title_melody;
-			mus_ch[1]     = music_title_bass;
-			mus_ch[2]     = music_title_chords;
-			mus_ch[3]     = music_title_drums;
-			mus_timing    = music_title_timing;
-			mus_noteCount = MUSIC_TITLE_NOTE_COUNT;
-#if MUSIC_TITLE_HAS_ARP
-			mus_arp       = music_title_arp;
-			mus_arpCh     = 2;  /* chords channel has arp */
-#endif
+			mus_stream[0] = music_title_melody;
+			mus_stream[1] = music_title_bass;
+			mus_stream[2] = music_title_chords;
 			break;
 		case SONG_E1M1:
-			mus_ch[0]     = music_e1m1_melody;
-			mus_ch[1]     = music_e1m1_bass;
-			mus_ch[2]     = music_e1m1_chords;
-			mus_ch[3]     = music_e1m1_drums;
-			mus_timing    = music_e1m1_timing;
-			mus_noteCount = MUSIC_E1M1_NOTE_COUNT;
-#if MUSIC_E1M1_HAS_ARP
-			mus_arp       = music_e1m1_arp;
-			mus_arpCh     = 0;  /* melody channel has arp */
-#endif
+			mus_stream[0] = music_e1m1_melody;
+			mus_stream[1] = music_e1m1_bass;
+			mus_stream[2] = music_e1m1_chords;
 			break;
 		case SONG_E1M2:
-			mus_ch[0]     = music_e1m2_melody;
-			mus_ch[1]     = music_e1m2_bass;
-			mus_ch[2]     = music_e1m2_chords;
-			mus_ch[3]     = music_e1m2_drums;
-			mus_timing    = music_e1m2_timing;
-			mus_noteCount = MUSIC_E1M2_NOTE_COUNT;
+			mus_stream[0] = music_e1m2_melody;
+			mus_stream[1] = music_e1m2_bass;
+			mus_stream[2] = music_e1m2_chords;
 			break;
 		case SONG_E1M3:
-			mus_ch[0]     = music_e1m3_melody;
-			mus_ch[1]     = music_e1m3_bass;
-			mus_ch[2]     = music_e1m3_chords;
-			mus_ch[3]     = music_e1m3_drums;
-			mus_timing    = music_e1m3_timing;
-			mus_noteCount = MUSIC_E1M3_NOTE_COUNT;
+			mus_stream[0] = music_e1m3_melody;
+			mus_stream[1] = music_e1m3_bass;
+			mus_stream[2] = music_e1m3_chords;
 			break;
 		case SONG_E1M4:
-			mus_ch[0]     = music_e1m4_melody;
-			mus_ch[1]     = music_e1m4_bass;
-			mus_ch[2]     = music_e1m4_chords;
-			mus_ch[3]     = music_e1m4_drums;
-			mus_timing    = music_e1m4_timing;
-			mus_noteCount = MUSIC_E1M4_NOTE_COUNT;
+			mus_stream[0] = music_e1m4_melody;
+			mus_stream[1] = music_e1m4_bass;
+			mus_stream[2] = music_e1m4_chords;
 			break;
 		case SONG_E1M5:
-			mus_ch[0]     = music_e1m5_melody;
-			mus_ch[1]     = music_e1m5_bass;
-			mus_ch[2]     = music_e1m5_chords;
-			mus_ch[3]     = music_e1m5_drums;
-			mus_timing    = music_e1m5_timing;
-			mus_noteCount = MUSIC_E1M5_NOTE_COUNT;
+			mus_stream[0] = music_e1m5_melody;
+			mus_stream[1] = music_e1m5_bass;
+			mus_stream[2] = music_e1m5_chords;
 			break;
 		case SONG_E1M6:
-			mus_ch[0]     = music_e1m6_melody;
-			mus_ch[1]     = music_e1m6_bass;
-			mus_ch[2]     = music_e1m6_chords;
-			mus_ch[3]     = music_e1m6_drums;
-			mus_timing    = music_e1m6_timing;
-			mus_noteCount = MUSIC_E1M6_NOTE_COUNT;
+			mus_stream[0] = music_e1m6_melody;
+			mus_stream[1] = music_e1m6_bass;
+			mus_stream[2] = music_e1m6_chords;
 			break;
 		default:
-			mus_ch[0]     = 0;
-			mus_ch[1]     = 0;
-			mus_ch[2]     = 0;
-			mus_ch[3]     = 0;
-			mus_noteCount = 0;
+			mus_stream[0] = 0;
+			mus_stream[1] = 0;
+			mus_stream[2] = 0;
 			break;
 	}
 }
 
+/* Drop every queued note. The ISR moves the tails: interrupts off. */
+static void musClearQueues(void) {
+	u8 i;
+	INT_DISABLE;
+	for (i = 0; i < MUS_NUM_CH; i++)
+		g_musQueue[i].head = g_musQueue[i].tail;
+	INT_ENABLE;
+}
+
 /* Start (or restart) the currently loaded song. */
 void musicStart(void) {
 	u8 i;
-	if (!mus_ch[0] || mus_noteCount == 0) return;
+	if (!mus_stream[0]) return;
 
-	mus_currNote  = 0;
+	musClearQueues();
 	for (i = 0; i < MUS_NUM_CH; i++) {
-		/* Arp channel uses freqForCmp=0xFFFF to always re-trigger, so its
-		 * prevFreq must differ (0xFFFE) to ensure the first frame plays. */
-		mus_prevFreq[i] = (mus_arp && i == mus_arpCh) ? 0xFFFE : 0xFFFF;
+		MusChannel *c = &mus_chan[i];
+		c->start = c->pos = mus_stream[i];
+		c->ret   = 0;
+		c->left  = 0;
+		c->vel   = 0;
+		c->arp   = 0;
+		c->note  = 0;
+		c->due   = g_musicTick;   /* first event now */
+		g_musQueue[i].hw = mus_hw_ch[i];
 	}
-	mus_noteStart = g_musicTick;
 	mus_playing   = 1;
 }
 
@@ -380,7 +436,7 @@ static void musSilenceAll(void) {
 /* Stop playback, reset position, and silence all music channels. */
 void musicStop(void) {
 	mus_playing  = 0;
-	mus_currNote = 0;
+	musClearQueues();
 	musSilenceAll();
 }
 
@@ -388,123 +444,127 @@ u8 isMusicPlaying(void) {
 	return mus_playing;
 }
 
-/* Helper: play or silence one VB waveform sound channel (melody/bass/chords).
- * freq:  VB frequency register value (0 = silence)
- * vol:   combined volume (velocity * master / 15), 0-15 */
-static void musPlayChannel(u8 hw_ch, u16 freq, u8 vol) {
-	if (freq == 0 || vol == 0) {
-		SND_REGS[hw_ch].SxINT = 0x00;
-	} else {
-		SND_REGS[hw_ch].SxINT = 0x00;  /* reset first */
-		SND_REGS[hw_ch].SxFQL = freq & 0xFF;
-		SND_REGS[hw_ch].SxFQH = freq >> 8;
-		SND_REGS[hw_ch].SxLRV = (vol << 4) | vol;
-		SND_REGS[hw_ch].SxEV0 = 0xF0;  /* max envelope, no decay */
-		SND_REGS[hw_ch].SxEV1 = 0x00;
-		SND_REGS[hw_ch].SxINT = 0x9F;  /* enable, no interval */
+/* Read the next event of a channel into note/noteVel/noteArp and
+ * return its duration in ms. Follows pattern commands and the loop. */
+static u16 musNextEvent(MusChannel *c) {
+	u8 b;
+	u16 dur;
+
+	for (;;) {
+		if (c->ret && c->left == 0) {
+			c->pos = c->ret;
+			c->ret = 0;
+		}
+		b = *c->pos++;
+		if (b == MUS_CMD_END) {
+			c->pos = c->start;
+			c->vel = 0;
+			c->arp = 0;
+		} else if (b == MUS_CMD_PATTERN) {
+			c->ret  = c->pos + 3;
+			c->left = c->pos[2];
+			c->pos  = c->start + (c->pos[0] | ((u16)c->pos[1] << 8));
+		} else if (b == MUS_CMD_ARP) {
+			c->arp = *c->pos++;
+		} else if (b & 0x80) {
+			c->vel = b & 0x0F;
+		} else {
+			break;
+		}
 	}
+
+	dur = *c->pos++;
+	if (dur & 0x80)
+		dur = ((dur & 0x7F) << 8) | *c->pos++;
+	if (c->ret)
+		c->left--;
+
+	c->note    = b;
+	c->noteVel = b ? c->vel : 0;
+	c->noteArp = b ? c->arp : 0;
+	return dur;
 }
 
-/* Update background music sequencer.  Call from any loop at any rate.
- * Drives 4 VB sound channels in lock-step.  Loops automatically.
- * Timing is rate-independent via g_musicTick (10 kHz ISR counter).
- *
- * Tonal channels decode MIDI note -> VB freq via midi_freq[] lookup.
- * Arpeggio channels cycle through 3 notes at ~50Hz (ARP_PHASE_TICKS). */
+/* Queue a channel's current note at tick at, arpeggio phase applied.
+ * The caller checks the queue has room. */
+static void musQueueNote(u8 i, u32 at, u8 phase, u8 vol) {
+	MusChannel *c = &mus_chan[i];
+	volatile MusQueue *q = &g_musQueue[i];
+	volatile MusEvent *e = &q->ev[q->head];
+	u8 midiNote = c->note;
+	u16 freq = 0;
+	u8 chVol = 0;
+
+	if (midiNote && c->noteVel) {
+		if (phase == 1)
+			midiNote += (c->noteArp >> 4) & 0x0F;
+		else if (phase == 2)
+			midiNote += c->noteArp & 0x0F;
+		if (midiNote > 127) midiNote = 127;
+		freq = midi_freq[midiNote];
+		chVol = g_volLut[c->noteVel][vol];
+		if (chVol == 0) chVol = 1;
+	}
+	e->at = at;
+	e->freq = freq;
+	e->vol = chVol;
+	q->head = (q->head + 1) & (MUS_QUEUE_LEN - 1);  /* publish last */
+}
+
+/* Refill the music queues.  Call from any loop at any rate, often
+ * enough that MUS_LOOKAHEAD ticks never pass between two calls.
+ * Each channel decodes events (and arpeggio phase steps every
+ * ARP_PHASE_TICKS) in time order until it reaches the lookahead or its
+ * queue is full; the timer ISR plays them. Events already over when
+ * decoded (after a stall) are skipped, not played late. A volume change
+ * applies from the next queued note. Loops automatically. */
 void updateMusic(bool isPlayMusic) {
 	u8 vol;
 	u8 i;
-	u32 elapsed;
-	u32 dur_ticks;
+	u32 now;
 
-	if (!isPlayMusic || !mus_playing || !mus_ch[0])
+	if (!isPlayMusic || !mus_playing || !mus_stream[0])
 		return;
 
 	vol = g_musicVolume;
-	elapsed = g_musicTick - mus_noteStart;
 
 	/* Volume 0: stop the sequencer entirely to save CPU */
 	if (vol == 0) {
 		musicStop();
 		return;
 	}
-	{
-		/* Update melody, bass, chords (channels 0-2) */
-		for (i = 0; i < 3; i++) {
-			if (mus_ch[i]) {
-				u16 raw = (u16)mus_ch[i][mus_currNote];
-				u8  vel4 = (raw >> 12) & 0x0F;
-				u8  midiNote = (raw >> 4) & 0x7F;
-				u16 freq;
-				u16 freqForCmp;  /* value to compare for change detection */
-
-				/* Arpeggio: if this channel has arp data, cycle through
-				 * 3 notes at frame rate using elapsed ISR ticks. */
-				if (mus_arp && i == mus_arpCh) {
-					u8 arpByte = mus_arp[mus_currNote];
-					if (arpByte != 0 && midiNote > 0 && vel4 > 0) {
-						/* elapsed/88 via multiply-shift, then %3 via multiply-shift */
-						u16 divRes = (u16)((elapsed * 745u) >> 16);
-						u8 q3 = (u8)(((u32)divRes * 171u) >> 9);
-						u8 phase = (u8)(divRes - (u16)q3 * 3u);
-						if (phase == 1)
-							midiNote += (arpByte >> 4) & 0x0F;
-						else if (phase == 2)
-							midiNote += arpByte & 0x0F;
-						if (midiNote > 127) midiNote = 127;
-					}
-					/* For arp channels, always re-trigger (phase changes
-					 * within a step without raw changing) */
-					freqForCmp = 0xFFFF;
-				} else {
-					freqForCmp = raw;
-				}
-
-				if (freqForCmp != mus_prevFreq[i]) {
-					if (vel4 == 0 || midiNote == 0) {
-						musPlayChannel(mus_hw_ch[i], 0, 0);
-					} else {
-						u8 chVol;
-						freq = midi_freq[midiNote];
-						if (freq == 0) {
-							musPlayChannel(mus_hw_ch[i], 0, 0);
-						} else {
-							chVol = g_volLut[vel4][vol];
-							if (chVol == 0) chVol = 1;
-							musPlayChannel(mus_hw_ch[i], freq, chVol);
-						}
-					}
-					mus_prevFreq[i] = raw;
-				}
-			}
-		}
-
-		/* Drums removed for performance -- drum channel data is ignored */
-	}
 
-	/* Advance through steps whose duration has fully elapsed.
-	 * Using a while-loop so multiple short steps (e.g. 11-42ms) can be
-	 * consumed in a single frame (~50ms at 20fps), keeping the sequencer
-	 * in sync with real time.  Overshoot is preserved by adding dur_ticks
-	 * to mus_noteStart instead of resetting it to g_musicTick. */
-	{
-		u8 skipCount = 0;
-		dur_ticks = (u32)mus_timing[mus_currNote] * 5;
-
-		while (elapsed >= dur_ticks) {
-			mus_noteStart += dur_ticks;  /* preserve overshoot */
-			mus_currNote++;
-			if (mus_currNote >= mus_noteCount)
-				mus_currNote = 0;
-
-			/* Force re-trigger on next channel update */
-			for (i = 0; i < MUS_NUM_CH; i++)
-				mus_prevFreq[i] = (mus_arp && i == mus_arpCh) ? 0xFFFE : 0xFFFF;
-
-			elapsed = g_musicTick - mus_noteStart;
-			dur_ticks = (u32)mus_timing[mus_currNote] * 5;
-
-			if (++skipCount > 8) break;  /* safety: max 8 steps per frame */
+	now = g_musicTick;
+	for (i = 0; i < MUS_NUM_CH; i++) {
+		MusChannel *c = &mus_chan[i];
+		volatile MusQueue *q = &g_musQueue[i];
+		u8 n;
+
+		for (n = 0; n < MUS_MAX_EVENTS; n++) {
+			bool arpStep;
+			u32 at;
+
+			if (((q->head + 1) & (MUS_QUEUE_LEN - 1)) == q->tail)
+				break;  /* full */
+
+			arpStep = c->noteArp && c->note && (s32)(c->arpNext - c->due) < 0;
+			at = arpStep ? c->arpNext : c->due;
+			if ((s32)(at - now) >= MUS_LOOKAHEAD)
+				break;
+
+			if (arpStep) {
+				c->arpPhase = (c->arpPhase == 2) ? 0 : c->arpPhase + 1;
+				c->arpNext += ARP_PHASE_TICKS;
+				if ((s32)(c->arpNext - now) > 0)
+					musQueueNote(i, at, c->arpPhase, vol);
+			} else {
+				u16 dur = musNextEvent(c);
+				c->due += (u32)dur * MUS_TICKS_PER_MS;
+				c->arpPhase = 0;
+				c->arpNext = at + ARP_PHASE_TICKS;
+				if ((s32)(c->due - now) > 0)
+					musQueueNote(i, at, 0, vol);
+			}
 		}
 	}
 }
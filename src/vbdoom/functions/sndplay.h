@@ -53,16 +53,21 @@ void updateMusic(bool isPlayMusic);
 
 /* ---- PCM Sound Effects ---- */
 
-/* Play a PCM sound effect on the player channel (ch4 SWEEP).
+/* PCM sound effects are mixed from PCM_VOICES voices (timer.h) and played
+ * through ch4 and ch2, which are dedicated to PCM -- no music is affected. */
+
+/* Play a player sound effect at full volume.
  * soundId: one of SFX_PUNCH, SFX_PISTOL, SFX_SHOTGUN, SFX_SHOTGUN_COCK, SFX_ITEM_UP
- * New sounds interrupt the current one.
- * Ch4 is dedicated to PCM -- no music is affected. */
+ * A new player sound interrupts the previous player sound; it may steal
+ * any other voice. */
 void playPlayerSFX(u8 soundId);
 
-/* Play a PCM sound effect on the enemy channel (ch2 WAVE3).
+/* Play a world (enemy) sound effect.
  * soundId: one of SFX_POSSESSED_SIGHT1..3, SFX_POSSESSED_DEATH1..3, etc.
  * distance: raw distance byte (0-255, 0=closest). Volume is attenuated.
- * Ch2 is dedicated to PCM -- no music is affected. */
+ * Sounds overlap up to PCM_VOICES; beyond that the sound steals the least
+ * important voice of its priority class or lower (sight < attack/pain <
+ * death), or is dropped. */
 void playEnemySFX(u8 soundId, u8 distance);
 
 #endif
@@ -1,23 +1,52 @@
 #include <libgccvb.h>
 #include <audio.h>
 #include "timer.h"
+#include "idle.h"
+#include "link.h"
+#include "../assets/audio/doom_sfx.h"
 
 /* ================================================================
  * PCM playback via SxLRV modulation + frame timing.
  *
  * Timer fires every 100us (reload=1, 100us base) = 10,000 Hz.
- * Each ISR tick writes ONE 4-bit sample to the SxLRV register
- * of each active PCM channel, acting as a 4-bit DAC.
+ * Each ISR tick mixes one sample of every playing voice and writes
+ * the result to the SxLRV registers of ch4 and ch2, which act as a
+ * DAC (see timer.h).
  *
  * Waveform RAM holds a DC constant (0x3F); the actual audio
  * comes from modulating the volume register.
  *
- * CPU cost: ~150 cycles per ISR @ 10kHz = 1.5M/sec = 7.5% of 20MHz
+ * CPU cost (estimated, not counted): ~150 cycles per ISR @ 10kHz =
+ * 1.5M/sec = 7.5% of 20MHz, plus ~60 per playing voice (ADPCM decode +
+ * mix); PCM_VOICES bounds it. tools/vsu_render reuses these figures, so
+ * its cycle column is no check on them; g_isrPerVip measures the real
+ * figure (profiler overlay).
+ *
+ * While no PCM voice plays the ISR only keeps the clocks, so it
+ * drops to TIMER_IDLE_TICKS (1 kHz) and advances them by
+ * the idle credit per call; timerWake() switches back to 10 kHz as
+ * soon as a sample starts.
  * ================================================================ */
 
 /* Timer interval: 1 => 1 tick * 100us = 100us = 10,000 Hz */
 #define PCM_TIMER_TICKS     1
 
+/* Idle interval: 10 => 1 ms = 1,000 Hz */
+#define TIMER_IDLE_TICKS    10
+
+/* Clock ticks per idle ISR, in 1/16 ticks. The 10 kHz ISR re-arms after
+ * its body, so a tick is 100us plus that body: ~8 per ms (see
+ * g_musicTick), fewer for every voice mixed. vipHandle() sets the credit
+ * from the last frame run at 10 kHz with one voice, g_isrPerVip * 16 / 20
+ * ticks per 1 ms call; until then it is TIMER_IDLE_CREDIT. Error against
+ * that one-voice rate: the idle ISR's own body stretches its 1 ms by ~1%,
+ * and each further voice mixed slows the 10 kHz clock by ~2-3% (60
+ * cycles on ~2500), so tempo and game speed shift by about that between
+ * the modes. */
+#define TIMER_IDLE_CREDIT   (8 << 4)
+#define TIMER_CREDIT_MIN    (4 << 4)
+#define TIMER_CREDIT_MAX    (12 << 4)
+
 /* Ticks per frame: 10000 Hz / 20 fps = 500 */
 #define DEFAULT_TICKS_PER_FRAME  500
 
@@ -28,9 +57,46 @@ volatile u8 g_timerExpired = 0;
 static volatile u16 g_frameTick = 0;
 static u16 g_ticksPerFrame = DEFAULT_TICKS_PER_FRAME;
 
-/* Two independent PCM streams */
-volatile PCMStream g_pcmPlayer = { 0, 0, 0, 0, 0 };
-volatile PCMStream g_pcmEnemy  = { 0, 0, 0, 0, 0 };
+/* 1 while the timer runs at the idle rate (set on every re-arm) */
+static volatile u8 g_timerIdle = 0;
+
+/* Idle credit and its carried fraction, 1/16 ticks */
+static volatile u8 g_idleCredit = TIMER_IDLE_CREDIT;
+static volatile u8 g_idleFrac = 0;
+
+/* Simulation ticks due and not yet run (see waitForSimTick) */
+volatile u8 g_simPending = 0;
+
+/* VIP drawing state, kept by vipHandle() */
+volatile u8 g_vipDrawing = 0;
+volatile u16 g_vipFrames = 0;
+bool g_vipSync = true;
+
+/* ADPCM step sizes, generated with the sample data */
+static const u8 pcmAdpcmStep[SFX_ADPCM_STEPS] = SFX_ADPCM_STEP_TABLE;
+static const u8 pcmAdpcm3Step[SFX_ADPCM3_STEPS] = SFX_ADPCM3_STEP_TABLE;
+
+/* Software-mixed PCM voices (see timer.h) */
+volatile PCMStream g_pcmVoice[PCM_VOICES];
+static u8 g_pcmLastActive = 0;
+
+/* Music note queues (see timer.h) */
+volatile MusQueue g_musQueue[MUS_QUEUES];
+
+#ifdef MUSIC_JITTER
+volatile u16 g_musJitter[MUS_JITTER_BINS];
+#define MUS_JITTER_COUNT(d) \
+	(g_musJitter[(d) < MUS_JITTER_BINS - 1 ? (d) : MUS_JITTER_BINS - 1]++)
+#else
+#define MUS_JITTER_COUNT(d) ((void)0)
+#endif
+
+/* ISR cost measurement, latched per VIP frame by vipHandle() */
+volatile u16 g_isrPerVip = 0;
+volatile u8 g_pcmVoicesPeak = 0;
+static volatile u16 g_isrCalls = 0;
+static volatile u8 g_isrSawIdle = 1;
+static volatile u8 g_pcmVoicesMax = 0;
 
 /* Master SFX volume (0-15, default max). Updated by game from settings. */
 volatile u8 g_sfxVolume = 15;
@@ -40,68 +106,187 @@ volatile u8 g_sfxVolume = 15;
  * Used by updateMusic() for rate-independent timing. */
 volatile u32 g_musicTick = 0;
 
-void timerHandle()
+/* Advance the music and frame clocks by n ticks. The frame counter keeps
+ * its remainder so a frame boundary inside an idle step is not lost. */
+static inline void timerAdvance(u8 n)
+{
+	g_musicTick += n;
+	g_frameTick += n;
+	if (g_frameTick >= g_ticksPerFrame) {
+		g_frameTick -= g_ticksPerFrame;
+		if (g_frameTick >= g_ticksPerFrame) g_frameTick = 0;
+		g_timerExpired = 1;
+		if (g_simPending < SIM_MAX_PENDING) g_simPending++;
+	}
+}
+
+/* Runs from WRAM (see WRAM_CODE): 10,000 calls/sec, the hottest code we have. */
+WRAM_CODE void timerHandle()
 {
+	s16 mix;
+	u8 v, active;
+
 	/* Disable timer interrupt and stop timer first (VB timer is one-shot;
 	 * must do a clean disable -> re-enable cycle to restart). */
 	timer_int(0);
-	VIP_REGS[INTCLR] = VIP_REGS[INTPND];
 	timer_enable(0);
 	timer_clearstat();
 
-	/* ---- Player PCM (ch4): write one 4-bit sample to SxLRV ---- */
-	if (g_pcmPlayer.playing) {
-		u16 idx = g_pcmPlayer.cursor;
-		u8 packed = g_pcmPlayer.data[idx >> 1];
-		u8 nib = (idx & 1) ? (packed & 0x0F) : (packed >> 4);
-		nib = (nib * g_sfxVolume) >> 4;
-		SND_REGS[0x04].SxLRV = (nib << 4) | nib;
-		g_pcmPlayer.cursor++;
-		if (g_pcmPlayer.cursor >= g_pcmPlayer.length) {
-			g_pcmPlayer.playing = 0;
-			SND_REGS[0x04].SxLRV = 0x00;
+	/* ---- PCM mixer: decode one sample of every playing voice
+	 * (formats in prepare_doom_sfx.py), sum them centred on 0 ---- */
+	active = 0;
+	mix = 0;
+	for (v = 0; v < PCM_VOICES; v++) {
+		volatile PCMStream *s = &g_pcmVoice[v];
+		if (s->playing) {
+			u16 idx = s->cursor;
+			s16 pred;
+			if (s->bits == 3) {
+				/* 3-bit codes in a bit stream: two bytes hold any code */
+				u16 bit = idx + (idx << 1);
+				const u8 *p = s->data + (bit >> 3);
+				u8 code = (u8)((((u16)p[0] << 8) | p[1]) >> (13 - (bit & 7)));
+				u8 step = pcmAdpcm3Step[s->step];
+				s16 diff = (step >> 2) + ((code & 1) ? step >> 1 : 0) + ((code & 2) ? step : 0);
+				pred = s->pred + ((code & 4) ? -diff : diff);
+				code &= 3;
+				if (code < 2) {
+					if (s->step) s->step--;
+				} else {
+					u8 x = s->step + code - 1;
+					s->step = x < SFX_ADPCM3_STEPS ? x : SFX_ADPCM3_STEPS - 1;
+				}
+			} else if (s->bits == 4) {
+				/* plain 4-bit PCM, two samples per byte */
+				u8 packed = s->data[idx >> 1];
+				pred = (((idx & 1) ? packed : packed >> 4) & 0x0F) << 4;
+			} else {
+				u8 code = s->data[idx >> 2] >> ((~idx & 3) << 1);
+				u8 step = pcmAdpcmStep[s->step];
+				s16 diff = (step >> 1) + ((code & 1) ? step : 0);
+				pred = s->pred + ((code & 2) ? -diff : diff);
+				if (code & 1) {
+					if (s->step < SFX_ADPCM_STEPS - 1) s->step++;
+				} else {
+					if (s->step) s->step--;
+				}
+			}
+			if (pred < 0) pred = 0;
+			if (pred > 255) pred = 255;
+			s->pred = (u8)pred;
+			mix += ((s16)(pred >> 4) - 8) * s->volume;
+			s->cursor = ++idx;
+			if (idx >= s->length)
+				s->playing = 0;
+			active++;
 		}
 	}
 
-	/* ---- Enemy PCM (ch2): distance attenuation + master SFX volume ---- */
-	if (g_pcmEnemy.playing) {
-		u16 idx = g_pcmEnemy.cursor;
-		u8 packed = g_pcmEnemy.data[idx >> 1];
-		u8 nib = (idx & 1) ? (packed & 0x0F) : (packed >> 4);
-		u8 scaled = (nib * g_pcmEnemy.volume) >> 4;
-		scaled = (scaled * g_sfxVolume) >> 4;
-		SND_REGS[0x02].SxLRV = (scaled << 4) | scaled;
-		g_pcmEnemy.cursor++;
-		if (g_pcmEnemy.cursor >= g_pcmEnemy.length) {
-			g_pcmEnemy.playing = 0;
-			SND_REGS[0x02].SxLRV = 0x00;
-		}
+	/* ---- DAC: 0..30 over ch4 (first 15) and ch2 (the rest) ---- */
+	if (active) {
+		s16 out = 15 + ((mix * g_sfxVolume) >> 8);
+		u8 hi;
+		if (out < 0) out = 0;
+		if (out > 30) out = 30;
+		hi = (out > 15) ? 15 : (u8)out;
+		SND_REGS[0x04].SxLRV = (hi << 4) | hi;
+		hi = (u8)out - hi;
+		SND_REGS[0x02].SxLRV = (hi << 4) | hi;
+		if (active > g_pcmVoicesMax) g_pcmVoicesMax = active;
+	} else if (g_pcmLastActive) {
+		SND_REGS[0x04].SxLRV = 0x00;
+		SND_REGS[0x02].SxLRV = 0x00;
 	}
+	g_pcmLastActive = active;
+	g_isrCalls++;
 
-	/* ---- Music tick: simple 1:1 increment (10,000 Hz).
+	/* ---- Music and frame clocks: 1 tick at 10 kHz, the idle credit
+	 * when the interval that just ended was an idle one.
 	 * Tempo scaling moved to updateMusic() multiplier. */
-	g_musicTick++;
+	if (g_timerIdle) {
+		u8 c = g_idleFrac + g_idleCredit;
+		g_idleFrac = c & 15;
+		timerAdvance(c >> 4);
+	} else {
+		timerAdvance(1);
+	}
 
-	/* ---- Frame timing ---- */
-	g_frameTick++;
-	if (g_frameTick >= g_ticksPerFrame) {
-		g_frameTick = 0;
-		g_timerExpired = 1;
+	/* ---- Music: play the head note of each queue once it is due ---- */
+	for (v = 0; v < MUS_QUEUES; v++) {
+		volatile MusQueue *q = &g_musQueue[v];
+		if (q->tail != q->head) {
+			volatile MusEvent *e = &q->ev[q->tail];
+			u32 late = g_musicTick - e->at;
+			if ((s32)late >= 0) {
+				u8 hw = q->hw;
+				SND_REGS[hw].SxINT = 0x00;  /* reset first */
+				if (e->freq && e->vol) {
+					SND_REGS[hw].SxFQL = e->freq & 0xFF;
+					SND_REGS[hw].SxFQH = e->freq >> 8;
+					SND_REGS[hw].SxLRV = (e->vol << 4) | e->vol;
+					SND_REGS[hw].SxEV0 = 0xF0;  /* max envelope, no decay */
+					SND_REGS[hw].SxEV1 = 0x00;
+					SND_REGS[hw].SxINT = 0x9F;  /* enable, no interval */
+				}
+				MUS_JITTER_COUNT(late);
+				q->tail = (q->tail + 1) & (MUS_QUEUE_LEN - 1);
+			}
+		}
 	}
 
-	/* Re-arm timer: set count, then restart with enable+interrupt */
-	timer_set(PCM_TIMER_TICKS);
+	/* ---- Link: the HOST clocks out the next byte (link.h) ---- */
+	linkTick();
+
+	/* Re-arm timer: set count, then restart with enable+interrupt.
+	 * 10 kHz while a PCM voice plays, the idle rate otherwise. */
+	if (active) {
+		g_timerIdle = 0;
+		timer_set(PCM_TIMER_TICKS);
+	} else {
+		g_timerIdle = 1;
+		g_isrSawIdle = 1;
+		timer_set(TIMER_IDLE_TICKS);
+	}
 	timer_enable(1);
 	timer_int(1);
 	set_intlevel(0);
 }
 
+/* VIP interrupt: FRAMESTART opens a 20 ms display frame and, with FRMCYC 0,
+ * starts drawing it; XPEND says drawing is done. The VIP pending bits are
+ * acknowledged here only (the timer ISR leaves them alone). */
+void vipHandle()
+{
+	u16 pending = VIP_REGS[INTPND];
+	VIP_REGS[INTCLR] = pending;
+
+	if (pending & FRAMESTART) {
+		g_vipFrames++;
+		g_vipDrawing = 1;
+		g_isrPerVip = g_isrSawIdle ? 0 : g_isrCalls;
+		if (!g_isrSawIdle && g_pcmVoicesMax == 1) {
+			/* ticks per ms * 16 = calls per 20 ms * 0.8 */
+			u16 c = (u16)(((u32)g_isrCalls * 205) >> 8);
+			if (c < TIMER_CREDIT_MIN) c = TIMER_CREDIT_MIN;
+			if (c > TIMER_CREDIT_MAX) c = TIMER_CREDIT_MAX;
+			g_idleCredit = (u8)c;
+		}
+		g_pcmVoicesPeak = g_pcmVoicesMax;
+		g_isrCalls = 0;
+		g_isrSawIdle = g_timerIdle;
+		g_pcmVoicesMax = 0;
+	}
+	if (pending & XPEND)
+		g_vipDrawing = 0;
+}
+
 void setupTimer()
 {
-	/* Setup timer interrupt vector */
+	/* Setup timer and VIP interrupt vectors */
 	timVector = (u32)(timerHandle);
+	vipVector = (u32)(vipHandle);
 	VIP_REGS[INTCLR] = VIP_REGS[INTPND];
-	VIP_REGS[INTENB] = 0x0000;
+	VIP_REGS[INTENB] = FRAMESTART | XPEND;
 	set_intlevel(0);
 	INT_ENABLE;
 
@@ -113,15 +298,64 @@ void setupTimer()
 	timer_enable(1);
 }
 
+void timerWake(void)
+{
+	u16 left;
+
+	INT_DISABLE;
+	if (g_timerIdle) {
+		/* Credit the part of the idle interval already gone, then
+		 * restart at 10 kHz so the first sample is not late */
+		left = timer_get();
+		if (left > TIMER_IDLE_TICKS) left = TIMER_IDLE_TICKS;
+		timer_int(0);
+		timer_enable(0);
+		timer_clearstat();
+		timerAdvance((u8)(((TIMER_IDLE_TICKS - left) * g_idleCredit / TIMER_IDLE_TICKS) >> 4));
+		g_timerIdle = 0;
+		timer_set(PCM_TIMER_TICKS);
+		timer_enable(1);
+		timer_int(1);
+	}
+	INT_ENABLE;
+}
+
 void waitForFrameTimer(void)
 {
-	/* Spin until enough ISR ticks have elapsed for one frame */
+	/* Sleep until enough ISR ticks have elapsed for one frame */
 	while (!g_timerExpired) {
-		/* busy-wait */
+		CPU_HALT;
 	}
 	g_timerExpired = 0;
 }
 
+void waitForSimTick(void)
+{
+	idleRun();  /* background jobs first (idle.h) */
+	while (!g_simPending) {
+		CPU_HALT;  /* the timer wakes us every 100us (1 ms when idle) */
+	}
+	/* The ISR increments it too: decrement with interrupts off */
+	INT_DISABLE;
+	g_simPending--;
+	INT_ENABLE;
+}
+
+void vipWaitIdle(void)
+{
+	/* No XPEND comes while drawing is disabled (fades, display off) */
+	if (!g_vipSync) return;
+	while (g_vipDrawing && (VIP_REGS[XPSTTS] & XPEN)) {
+		CPU_HALT;
+	}
+}
+
+void simResync(void)
+{
+	g_simPending = 0;
+	g_timerExpired = 0;
+}
+
 void setFrameTime(u16 ms)
 {
 	/* Convert milliseconds to ISR tick count.
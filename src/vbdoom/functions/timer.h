@@ -2,25 +2,86 @@
 #define _FUNCTIONS_TIMER_H
 
 #include <types.h>
+#include <wram.h>
+#include <stdbool.h>
 
 /* ================================================================
  * PCM playback state -- accessed by both ISR and main thread.
  *
  * PCM is achieved by modulating the SxLRV (volume) register
- * with 4-bit packed sample data while a DC waveform plays.
+ * with 4-bit samples while a DC waveform plays. Samples are stored
+ * as 2- or 3-bit ADPCM, or 4-bit PCM where ADPCM falls below the
+ * converter's SNR floor (prepare_doom_sfx.py), and decoded one per tick.
  * The ISR fires at ~10,000 Hz and writes one sample per tick.
+ *
+ * PCM_VOICES voices are mixed in software: every playing voice adds
+ * (sample - 8) * volume, the sum is scaled by g_sfxVolume and centred
+ * in 0..30, which is spread over the two PCM channels (ch4 takes up to
+ * 15, ch2 the rest; the hardware adds them). Voices are started and
+ * stolen by sndplay.c, the ISR only reads them.
  * ================================================================ */
+#define PCM_VOICES      4
+
+/* Priority classes: a new sound may steal a voice of its own class or
+ * lower, never a higher one */
+#define PCM_PRIO_AMBIENT    0   /* enemy sight / activity, idle chatter */
+#define PCM_PRIO_ENEMY      1   /* enemy attacks and pain */
+#define PCM_PRIO_DEATH      2   /* enemy deaths, explosions */
+#define PCM_PRIO_PLAYER     3   /* the player's own sounds */
+
 typedef struct {
-	const u8 *data;    /* packed 4-bit sample pairs (high nibble first) */
+	const u8 *data;    /* sample data (doom_sfx.h) */
 	u16 cursor;        /* current sample index (not byte index) */
 	u16 length;        /* total samples */
 	u8 volume;         /* 0-15, for distance attenuation (game SFX) */
 	u8 playing;        /* 0 = idle, 1 = playing */
+	u8 priority;       /* PCM_PRIO_* */
+	u8 player;         /* 1 = started by playPlayerSFX */
+	u8 pred;           /* ADPCM decoder: predicted sample, 0-255 */
+	u8 step;           /* ADPCM decoder: step table index */
+	u8 bits;           /* 2 or 3 (ADPCM), 4 (PCM) */
 } PCMStream;
 
-/* Two independent PCM streams */
-extern volatile PCMStream g_pcmPlayer;  /* channel 4 (SWEEP) */
-extern volatile PCMStream g_pcmEnemy;   /* channel 2 (WAVE3) */
+extern volatile PCMStream g_pcmVoice[PCM_VOICES];
+
+/* Most voices mixed in one tick since the last VIP frame (see
+ * g_isrPerVip) */
+extern volatile u8 g_pcmVoicesPeak;
+
+/* ================================================================
+ * Music event queues -- filled by updateMusic() (sndplay.c) at frame
+ * rate up to MUS_LOOKAHEAD ticks ahead, drained by the ISR, which
+ * writes each note to its VB channel on the tick it is due. Note
+ * timing no longer depends on when the frame loop gets around to the
+ * sequencer. One queue per tonal channel, single producer (main
+ * thread moves head) and single consumer (ISR moves tail).
+ * ================================================================ */
+#define MUS_QUEUES      3
+#define MUS_QUEUE_LEN   16      /* power of two */
+
+typedef struct {
+	u32 at;            /* g_musicTick to play it at */
+	u16 freq;          /* VB frequency register, 0 = silence */
+	u8 vol;            /* channel volume 0-15, 0 = silence */
+} MusEvent;
+
+typedef struct {
+	MusEvent ev[MUS_QUEUE_LEN];
+	u8 head;           /* next free slot (main thread) */
+	u8 tail;           /* next event to play (ISR) */
+	u8 hw;             /* VB sound channel */
+} MusQueue;
+
+extern volatile MusQueue g_musQueue[MUS_QUEUES];
+
+/* Dispatch jitter (debug builds, MUSIC_JITTER): how many events were
+ * played n ticks after their due tick, the last bin collects the rest.
+ * Cleared when a timedemo playback starts (demo.h); vsu_render prints it
+ * for each song. */
+#define MUS_JITTER_BINS 16
+#ifdef MUSIC_JITTER
+extern volatile u16 g_musJitter[MUS_JITTER_BINS];
+#endif
 
 /* Master SFX volume (0-15). Derived from settings.sfx (0-9).
  * Applied in the timer ISR to scale PCM game SFX output. */
@@ -28,17 +89,74 @@ extern volatile u8 g_sfxVolume;
 
 /* Music sequencer tick counter.  Incremented at 10,000 Hz by ISR.
  * Effective rate ~8 kHz due to ISR overhead.  ~8 ticks = 1 ms.
- * Read by updateMusic() for rate-independent timing. */
+ * Read by updateMusic() for rate-independent timing.
+ * While no PCM plays the ISR runs at 1 kHz and adds the measured ticks
+ * per ms (timer.c, TIMER_IDLE_CREDIT): the rate holds to within a few
+ * percent, the resolution drops to 1 ms. */
 extern volatile u32 g_musicTick;
 
-void timerHandle();
+void timerHandle() WRAM_CODE;
 void setupTimer();
 
+/* Timer ISR calls in the last 20 ms VIP frame, 0 if the timer spent part
+ * of it at the idle rate. The timer reloads after the ISR body, so every
+ * call takes 2000 cycles (100us at 20 MHz) plus the ISR's own cost and
+ * entry latency: that cost is 400000 / g_isrPerVip - 2000 cycles. The
+ * profiler overlay shows it next to g_pcmVoicesPeak. */
+extern volatile u16 g_isrPerVip;
+
+/* Back to the 10 kHz PCM rate now. Call after setting a voice playing;
+ * the ISR drops to the idle rate by itself once no voice is playing. */
+void timerWake(void);
+
 /* Frame-rate capping: blocks until the target frame time has elapsed.
  * The hardware timer fires at ~10,000 Hz for PCM sample output;
  * frame timing is derived by counting ISR ticks (500 per 20fps frame). */
 void waitForFrameTimer(void);
 
+/* Fixed-timestep simulation. The ISR counts one simulation tick per frame
+ * time (setFrameTime) into g_simPending; the game loop runs one tick per
+ * pass and consumes it with waitForSimTick(), which only blocks when the
+ * loop is ahead. Ticks still pending after that mean the loop is behind:
+ * it skips drawing until it has caught up, so gameplay speed stays the
+ * same while the render rate floats. At most SIM_MAX_PENDING ticks are
+ * banked; time lost beyond that (loading, a stall) slows the game instead
+ * of being replayed blind. */
+#define SIM_MAX_PENDING  4
+
+extern volatile u8 g_simPending;
+
+#define simBehind()      (g_simPending != 0)
+
+/* Block (halted, not spinning) until a simulation tick is due, then
+ * consume it. */
+void waitForSimTick(void);
+
+/* VIP frame sync. vipHandle() runs on the VIP FRAMESTART and XPEND
+ * interrupts: g_vipDrawing is set while the VIP draws the current frame
+ * into the frame buffers, g_vipFrames counts display frames (50 Hz).
+ * vipWaitIdle() sleeps until drawing is done, so world attributes and
+ * affine params written right after it land between two VIP draws
+ * instead of tearing a half-updated sprite into the frame. g_vipSync
+ * turns the wait off (timedemo playback).
+ *
+ * Only the sprite worlds are fenced: TraceFrame writes the wall BGMap
+ * columns before the wait, while the VIP may still be drawing. A draw
+ * that catches them shows old and new columns side by side for one
+ * 20 ms display frame, next to the last frame's walls either way;
+ * fencing them too would stall the trace, not just the sprite setup.
+ * The wait itself costs up to one VIP draw, halted. */
+extern volatile u8 g_vipDrawing;
+extern volatile u16 g_vipFrames;
+extern bool g_vipSync;
+
+void vipHandle();
+void vipWaitIdle(void);
+
+/* Drop banked ticks, after anything that stops the game loop
+ * (pause menu, level load) so it does not fast-forward afterwards. */
+void simResync(void);
+
 /* Set the target frame time in milliseconds (default: 50ms = 20fps).
  * Common values: 50 = 20fps, 33 = ~30fps, 20 = 50fps */
 void setFrameTime(u16 ms);
@@ -4,6 +4,8 @@
 #include "functions/sndplay.h"
 #include "functions/timer.h"
 #include "functions/link.h"
+#include "functions/lockstep.h"
+#include "functions/demo.h"
 #include "components/intermission.h"
 #include "components/menu_multiplayer.h"
 
@@ -57,15 +59,36 @@ int main()
     			musicStart();
     			if (g_gameMode != GAMEMODE_DEATHMATCH)
     				showIntermission();
+    			linkStart();  /* in game the link runs from interrupts */
     			scene = gameLoop();
+    			linkStop();
     			/* Reset multiplayer state when returning */
     			g_isMultiplayer = false;
+    			g_lockstep = false;
     			musicLoadSong(SONG_TITLE);
     			musicStart();
     		} else {
     			scene = 0;  /* cancelled, return to title */
     		}
     	}
+    	if (scene == SCENE_DEMO_RECORD || scene == SCENE_DEMO_PLAY) {
+    		/* Timedemo: no intermission, straight into the level */
+    		u8 demoStartLevel = 1;
+    		if (scene == SCENE_DEMO_RECORD)
+    			demoStartRecord(demoStartLevel);
+    		else
+    			demoStartLevel = demoStartPlayback();
+    		if (demoStartLevel > 0) {
+    			g_startLevel = demoStartLevel;
+    			musicLoadSong(SONG_E1M1);
+    			musicStart();
+    			scene = gameLoop();
+    			musicLoadSong(SONG_TITLE);
+    			musicStart();
+    		} else {
+    			scene = 0;  /* no demo in SRAM */
+    		}
+    	}
     	if (scene == 4) {
 			scene = optionsScreen(&settings);
 			/* Update volumes from potentially changed settings */
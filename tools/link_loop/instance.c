@@ -0,0 +1,213 @@
+/*
+ * instance.c -- one console of link_loop (see link_loop.c)
+ *
+ * Linked with that console's copy of the game's link sources: the
+ * libgccvb functions and the hardware they use, each routed to the
+ * harness, and the entry points the harness drives it with
+ * (loop_host.h). The game code it calls is the game's own; only the
+ * state exchange of gameLoop() is restated here, in loopStateFrame,
+ * because gameLoop() itself needs the whole game.
+ */
+
+#include <string.h>
+
+#include "loop_host.h"
+#include "../../src/vbdoom/functions/lockstep.h"
+#include "../../src/vbdoom/functions/snapshot.h"
+#include "../../src/vbdoom/functions/enemysync.h"
+#include "../../src/vbdoom/components/menu_multiplayer.h"
+
+static const LoopHost *host;
+static u8 self;
+
+/* ---- Hardware ---- */
+
+static WORLD worlds[32];
+static u16 vipRegs[0x40];
+
+u8 g_loopVram[0x40000];
+WORLD* const WA = worlds;
+volatile u16* VIP_REGS = vipRegs;
+u32 comVector;
+
+/* The font the menu copies to CharSeg3 */
+BYTE FontTiles[4096];
+
+volatile u8 *loopPort(void)
+{
+	return host->port(self);
+}
+
+volatile u32 *loopTick(void)
+{
+	return host->tick(self);
+}
+
+void loopInterrupts(bool on)
+{
+	host->interrupts(self, on);
+}
+
+/* ---- libgccvb ---- */
+
+void copymem(u8* dest, const u8* src, u16 num)
+{
+	memcpy(dest, src, num);
+}
+
+void setmem(u8* dest, u8 src, u16 num)
+{
+	memset(dest, src, num);
+}
+
+void set_intlevel(u8 level)
+{
+	(void)level;
+}
+
+int get_intlevel()
+{
+	return 0;
+}
+
+u16 vbReadPad()
+{
+	return host->pad(self);
+}
+
+void vbWaitFrame(u16 count)
+{
+	u16 i;
+
+	for (i = 0; i <= count; i++)
+		host->waitFrame(self);
+}
+
+void vbPrint(u8 bgmap, u16 x, u16 y, char *t_string, u16 bplt)
+{
+	(void)bgmap;
+	(void)bplt;
+	host->print(self, x, y, t_string);
+}
+
+void vbSetWorld(s16 nw, u16 header, u16 gx, s16 gp, u16 gy, u16 mx, s16 mp, u16 my, u16 width, u16 height)
+{
+	(void)gx; (void)gp; (void)gy; (void)mx; (void)mp; (void)my; (void)width; (void)height;
+	worlds[nw & 31].head = header;
+}
+
+void vbDisplayOn()
+{
+}
+
+void vbDisplayOff()
+{
+}
+
+void vbDisplayShow()
+{
+}
+
+void vbDisplayHide()
+{
+}
+
+/* ---- Sound (silent) ---- */
+
+void updateMusic(bool isPlayMusic)
+{
+	(void)isPlayMusic;
+}
+
+void playPlayerSFX(u8 soundId)
+{
+	(void)soundId;
+}
+
+/* ---- Entry points ---- */
+
+void loopInit(const LoopHost *h, u8 id)
+{
+	host = h;
+	self = id;
+}
+
+void loopMenu(LoopMenu *out)
+{
+	out->level = multiplayerMenu();
+	out->host = g_isHost;
+	out->mode = g_gameMode;
+	out->lockstep = g_lockstep;
+	out->seed = g_lockSeed;
+}
+
+void loopGameStart(const LoopMenu *m)
+{
+	g_isMultiplayer = true;
+	g_isHost = m->host;
+	g_gameMode = m->mode;
+	g_lockstep = m->lockstep;
+	g_lockSeed = m->seed;
+	linkStart();
+	snapReset(0, 0, 0);
+	if (g_lockstep)
+		lockStart();
+}
+
+/* gameLoop()'s multiplayer block, without the game: every
+ * LINK_STATE_FRAMES frames, or at once for a rocket, with the frames'
+ * budget of event bytes */
+bool loopStateFrame(const LinkState *s, u16 frame, void (*fill)(u8 *events, u8 len, u8 time),
+                    LinkState *sent, u8 *evLen, LinkState *shown)
+{
+	static u8 stateFrames = 0;
+	static u8 heldFlags = 0;
+	LinkState st = *s;
+	u8 events[LINK_MAX_EVENTS];
+	u8 len = 0;
+	bool queued = false;
+
+	st.time = (u8)frame;
+	if (stateFrames < 255) stateFrames++;
+	heldFlags |= st.flags & P2F_SHOOTING;
+	if ((st.flags & P2F_FIRED_ROCKET) || stateFrames >= LINK_STATE_FRAMES) {
+		if (fill) {
+			u16 budget = (u16)stateFrames * SYNC_FRAME_BUDGET;
+			len = budget > LINK_MAX_EVENTS ? LINK_MAX_EVENTS : (u8)budget;
+			fill(events, len, st.time);
+		}
+		st.flags |= heldFlags;
+		if (linkSendState(&st, events, len)) {
+			stateFrames = 0;
+			heldFlags = 0;
+			*sent = st;
+			*evLen = len;
+			queued = true;
+		}
+	}
+
+	while (linkRecvState(&st, events, &len)) {
+		snapPush(st.time, st.x, st.y, st.angle);
+		host->received(self, &st, events, len);
+	}
+	snapUpdate();
+
+	shown->x = g_player2X;
+	shown->y = g_player2Y;
+	shown->angle = g_player2Angle;
+	return queued;
+}
+
+bool loopLockInput(u16 pad, u16 pads[2])
+{
+	if (!lockInput(pad))
+		return false;
+	pads[0] = g_lockPad[0];
+	pads[1] = g_lockPad[1];
+	return true;
+}
+
+void loopLockEnd(u8 hash)
+{
+	lockFrameEnd(hash);
+}
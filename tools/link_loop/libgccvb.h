@@ -0,0 +1,77 @@
+#ifndef _LINK_LOOP_LIBGCCVB_H_
+#define _LINK_LOOP_LIBGCCVB_H_
+
+
+/*
+ * Host stand-in for libgccvb.h, force-included into the game sources each
+ * link_loop instance links (see link_loop.c). It keeps the libgccvb
+ * declarations link.c, lockstep.c, snapshot.c and menu_multiplayer.c use
+ * and routes what touches the hardware to the harness: every HW_REGS
+ * access and every g_musicTick read goes through a call (instance.c),
+ * which is where the harness advances that console's clock, runs the
+ * cable and the interrupts, and switches to the other console. VRAM is
+ * an array per instance.
+ */
+
+#define _LIBGCCVB_TYPES_H
+#define _LIBGCCVB_WRAM_H_
+#define _LIBGCCVB_ASM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef unsigned char 	u8;
+typedef unsigned short 	u16;
+typedef unsigned int 	u32;
+
+typedef signed char 	s8;
+typedef signed short 	s16;
+typedef signed int 		s32;
+
+typedef unsigned char 	BYTE;
+typedef unsigned short 	HWORD;
+typedef unsigned int 	WORD;
+
+#define f8 			s8
+#define f16 		s16
+#define f32 		s32
+
+// no WRAM section and no long calls on the host
+#define WRAM_CODE
+
+// the harness delivers the link interrupt only while these allow it
+void loopInterrupts(bool on);
+#define INT_ENABLE		loopInterrupts(true)
+#define INT_DISABLE		loopInterrupts(false)
+#define CPU_HALT		((void)0)
+
+void set_intlevel(u8 level);
+int get_intlevel();
+
+#include "bgmap.h"
+#include "controller.h"
+#include "hw.h"
+#include "interrupts.h"
+#include "mem.h"
+#include "misc.h"
+#include "video.h"
+#include "vip.h"
+#include "world.h"
+#include "../../src/vbdoom/functions/timer.h"
+#include "../../libs/libgccvb/math.h"
+
+// the registers and the music tick are the harness's, per instance
+volatile u8 *loopPort(void);
+volatile u32 *loopTick(void);
+#define HW_REGS			(loopPort())
+#define g_musicTick		(*loopTick())
+
+// VRAM is an array in each instance
+extern u8 g_loopVram[];
+#undef CharSeg3
+#undef BGMap
+#define CharSeg3		((uintptr_t)g_loopVram + 0x1E000)
+#define BGMap(b)		((uintptr_t)g_loopVram + 0x20000 + (b) * 0x2000)
+
+
+#endif
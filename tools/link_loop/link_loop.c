@@ -0,0 +1,849 @@
+/*
+ * link_loop.c -- two consoles and a link cable in one host process
+ *
+ * Runs two copies of the game's link code (link.c, lockstep.c,
+ * snapshot.c, menu_multiplayer.c, each with instance.c, see
+ * loop_host.h) against a model of the EXT port, so the handshake and
+ * the in-game exchange run without two consoles and a cable.
+ * run_link_loop.py builds it and runs every scenario; with a fixed
+ * model, scripted input and no floating point the output is the same on
+ * every host, so the report makes a regression check for the link
+ * protocol, and the figures show what a protocol change gains.
+ *
+ *   link_loop [-w] handshake <coop|dm|lockstep>
+ *   link_loop [-w] coop <frames> [noise]
+ *   link_loop [-w] lockstep <frames> [noise [desync-frame]]
+ *
+ * handshake: both consoles run multiplayerMenu() with scripted pads
+ * (CONNECT, then the first level and the mode on whichever side becomes
+ * HOST), console b switched on HANDSHAKE_STEP later each run, over
+ * HANDSHAKE_PHASES runs: the connect screen listens and sends once per
+ * VIP frame, so what matters is how far apart the two consoles' frames
+ * are. Reports the runs where both menus finished, how many of those
+ * agree on level, mode and seed, the splits (one side got past the
+ * connect screen, the other never did), and for the finished runs the
+ * average time from CONNECTING... to the end of that screen and to the
+ * game start (and the longest), and the bytes that crossed the cable.
+ *
+ * coop: after linkStart(), <frames> simulation ticks of gameLoop()'s
+ * state exchange (instance.c) on both sides, each player walking a
+ * scripted path, shooting and firing rockets now and then, the HOST's
+ * packets carrying a full budget of event bytes. Reports the packets
+ * sent and decoded each way, desyncs (a packet decoded into anything
+ * but what the peer sent), the latency from linkSendState() to
+ * linkRecvState() (average and worst) and how far player 2 is drawn
+ * from where the peer is (8.8 units, average and worst).
+ *
+ * lockstep: <frames> ticks of lockInput() and lockFrameEnd() with
+ * scripted pads and a toy simulation hashed like the game's. Reports
+ * the frames each side ran before lockstep ended, pads that differ
+ * between the two sides, the time spent in lockInput() (average and
+ * worst per side) and the ticks that waited longer than a tick;
+ * desync-frame makes console b drift apart there.
+ *
+ * noise: one byte in <noise> crosses the cable with a bit flipped.
+ * Every scenario also counts the bytes a master clocked out while the
+ * other side was not listening (lost).
+ *
+ * Time model (CPU cycles at 20 MHz, a clock per console):
+ *   - every HW_REGS access or g_musicTick read costs ACCESS_CYCLES, a
+ *     frame of game work (coop, lockstep) a scripted 25-45 ms with
+ *     spikes, a simulation tick is SIM_TICK_CYCLES and vbWaitFrame()
+ *     waits for the console's next 20 ms VIP frame, counted from when
+ *     it was switched on.
+ *   - the timer interrupt fires every 100us: g_musicTick, and linkTick()
+ *     on the HOST (link.h).
+ *   - a write to CCR with bit 2 starts a transfer, as master or, with
+ *     bit 4, as remote; without bit 2 it cancels one. A master clocks
+ *     its byte out and is done BYTE_CYCLES later; the remote takes it,
+ *     and sends its CDTR back, only if it was started before the master
+ *     was, otherwise the byte is lost and the master reads 0xFF. With
+ *     -w a master instead waits for a remote, as some emulators link
+ *     two instances. Either way CDRR gets the byte, busy clears and,
+ *     with bit 7 clear, the link interrupt runs linkHandle(). CCSR bit 0
+ *     shows the peer's bit 1 (channel open).
+ *   - the two consoles run as coroutines, switching whenever one is
+ *     QUANTUM cycles ahead of the other, and a transfer only ends once
+ *     both clocks have passed it, so neither sees the cable from the
+ *     future. A console that is through with a scenario keeps its link
+ *     running until the other is.
+ * The cable is this model, not a socket or pipe between two processes:
+ * those would make every run time differently, and the timings are
+ * the point.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "loop_host.h"
+#include "../../src/vbdoom/functions/lockstep.h"
+
+typedef unsigned long long Cycles;
+
+#define CPU_HZ              20000000
+#define MS                  (CPU_HZ / 1000)
+#define TICK_CYCLES         2000                   /* 100us */
+#define VIP_FRAME_CYCLES    400000                 /* 20 ms */
+#define SIM_TICK_CYCLES     1000000                /* 50 ms (timer.h) */
+#define ACCESS_CYCLES       20                     /* a register access and its poll loop */
+#define BYTE_CYCLES         400                    /* one byte over the cable */
+#define QUANTUM             100                    /* most one console runs ahead */
+#define START_OFFSET        (MS * 73 / 10)         /* console b is switched on later */
+#define NEVER               (~(Cycles)0)
+
+#define HANDSHAKE_LIMIT     ((Cycles)CPU_HZ * 40)   /* past the 30 s connect timeout */
+#define HANDSHAKE_PHASES    40                     /* switch-on offsets tried, */
+#define HANDSHAKE_STEP      1000                   /* 50us apart */
+#define FRAME_LIMIT         ((Cycles)SIM_TICK_CYCLES * 20) /* per frame run */
+#define MAX_FRAMES          20000
+#define STACK_SIZE          (256 * 1024)
+
+#define ARM_MASTER          1
+#define ARM_REMOTE          2
+
+/* ---- The consoles ---- */
+
+#define INSTANCE_API(p) \
+	void p##loopInit(const LoopHost *host, u8 id); \
+	void p##loopMenu(LoopMenu *out); \
+	void p##loopGameStart(const LoopMenu *m); \
+	bool p##loopStateFrame(const LinkState *s, u16 frame, \
+	                       void (*fill)(u8 *events, u8 len, u8 time), \
+	                       LinkState *sent, u8 *evLen, LinkState *shown); \
+	bool p##loopLockInput(u16 pad, u16 pads[2]); \
+	void p##loopLockEnd(u8 hash); \
+	void p##linkHandle(void); \
+	extern volatile u8 p##g_linkMasterIdle;
+
+INSTANCE_API(a_)
+INSTANCE_API(b_)
+
+typedef struct {
+	void (*init)(const LoopHost *host, u8 id);
+	void (*menu)(LoopMenu *out);
+	void (*gameStart)(const LoopMenu *m);
+	bool (*stateFrame)(const LinkState *s, u16 frame, void (*fill)(u8 *events, u8 len, u8 time),
+	                   LinkState *sent, u8 *evLen, LinkState *shown);
+	bool (*lockInput)(u16 pad, u16 pads[2]);
+	void (*lockEnd)(u8 hash);
+	void (*linkHandle)(void);
+	volatile u8 *masterIdle;
+} Instance;
+
+#define INSTANCE(p) { p##loopInit, p##loopMenu, p##loopGameStart, p##loopStateFrame, \
+                      p##loopLockInput, p##loopLockEnd, p##linkHandle, &p##g_linkMasterIdle }
+
+static const Instance instances[2] = { INSTANCE(a_), INSTANCE(b_) };
+
+typedef struct {
+	ucontext_t ctx;
+	char *stack;
+	bool done;
+	Cycles t;                   /* this console's clock */
+	Cycles on;                  /* when it was switched on: its VIP frames start */
+	Cycles limit;               /* past this it is stuck */
+	Cycles nextTick;
+	u32 musicTick;
+
+	u8 regs[0x40];              /* HW_REGS as the code sees them */
+	u8 ccr;                     /* CCR after the model last looked */
+	u8 armed;                   /* ARM_MASTER, ARM_REMOTE, or 0 */
+	bool armedInt;              /* ... with the interrupt */
+	Cycles armedAt;
+	bool intOn;
+	bool inIsr;
+	bool irq;                   /* link interrupt pending */
+	bool through;               /* done with the scenario */
+
+	/* handshake: the screen on show, its frames, the pad script */
+	const char *screen;
+	u16 screenFrames;
+	Cycles connectAt, connectedAt;
+	Cycles endAt;               /* when the scenario ended on it */
+	LoopMenu menu;
+} Side;
+
+static Side side[2];
+static ucontext_t mainCtx;
+static void (*sideRun)(u8 id);
+static const char *scenario;
+static Cycles startOffset = START_OFFSET;
+static bool giveUp;             /* stuck ends the run, not the program */
+static u8 stuckSide;            /* 1 + the console that got stuck */
+
+static bool masterWaits;        /* -w: a master start waits for the remote */
+static u32 cableBytes;          /* bytes across */
+static u32 cableLost;           /* clocked out with no remote started */
+static u32 noiseRate;           /* one byte in noiseRate hit, 0: none */
+static u32 noiseHits;
+static u32 rng = 0x2545F491;
+
+static u32 random32(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+	        "usage: link_loop [-w] handshake <coop|dm|lockstep>\n"
+	        "       link_loop [-w] coop <frames> [noise]\n"
+	        "       link_loop [-w] lockstep <frames> [noise [desync-frame]]\n");
+	exit(2);
+}
+
+/* ---- Scheduling ---- */
+
+static void yield(u8 id)
+{
+	if (!side[id ^ 1].done)
+		swapcontext(&side[id].ctx, &side[id ^ 1].ctx);
+}
+
+/* A handshake that does not finish is a result, anything else stuck
+ * is the end of the run */
+static void stuck(u8 id)
+{
+	if (giveUp) {
+		stuckSide = id + 1;
+		setcontext(&mainCtx);
+	}
+	fprintf(stderr, "link_loop: %s: console %c stuck at %llu ms on %s\n",
+	        scenario, 'a' + id, side[id].t / MS,
+	        side[id].screen ? side[id].screen : "the game");
+	exit(1);
+}
+
+/* ---- The cable ---- */
+
+/* Take in what the code wrote to CCR since the model last looked */
+static void portWrites(u8 id)
+{
+	Side *s = &side[id];
+	u8 v = s->regs[CCR];
+
+	if (v != s->ccr) {
+		if (v & 0x04) {
+			s->armed = (v & 0x10) ? ARM_REMOTE : ARM_MASTER;
+			s->armedInt = !(v & 0x80);
+			s->armedAt = s->t;
+			v = (v & ~0x04) | 0x02;
+		} else {
+			s->armed = 0;
+			v &= ~0x02;
+		}
+		s->regs[CCR] = s->ccr = v;
+	}
+	s->regs[CCSR] = (s->regs[CCSR] & ~0x01) | ((side[id ^ 1].regs[CCSR] >> 1) & 0x01);
+}
+
+/* Whether the remote takes side m's transfer, and when it ends */
+static bool caught(const Side *m, const Side *r)
+{
+	return r->armed == ARM_REMOTE && (masterWaits || r->armedAt <= m->armedAt);
+}
+
+static Cycles transferDue(const Side *m, const Side *r)
+{
+	if (m->armed != ARM_MASTER)
+		return NEVER;
+	if (!masterWaits)
+		return m->armedAt + BYTE_CYCLES;
+	if (!caught(m, r))
+		return NEVER;
+	return (m->armedAt > r->armedAt ? m->armedAt : r->armedAt) + BYTE_CYCLES;
+}
+
+/* When the next transfer ends, NEVER for none */
+static Cycles cableDue(void)
+{
+	Cycles a = transferDue(&side[0], &side[1]), b = transferDue(&side[1], &side[0]);
+
+	return a < b ? a : b;
+}
+
+static u8 cableByte(u8 b)
+{
+	if (noiseRate && random32() % noiseRate == 0) {
+		b ^= (u8)(1 << (random32() & 7));
+		noiseHits++;
+	}
+	return b;
+}
+
+static void transferDone(Side *s, u8 received)
+{
+	s->regs[CDRR] = received;
+	s->regs[CCR] = s->ccr = s->ccr & ~0x02;
+	s->armed = 0;
+	if (s->armedInt) s->irq = true;
+}
+
+/* Finish the transfers that are due on both clocks. A master the
+ * remote did not catch clocks its byte out to nobody and reads the
+ * idle line. */
+static void cable(void)
+{
+	u8 i;
+
+	portWrites(0);
+	portWrites(1);
+	for (i = 0; i < 2; i++) {
+		Side *m = &side[i], *r = &side[i ^ 1];
+		Cycles due = transferDue(m, r);
+
+		if (due == NEVER || m->t < due || r->t < due)
+			continue;
+		if (caught(m, r)) {
+			u8 toRemote = cableByte(m->regs[CDTR]);
+
+			transferDone(m, cableByte(r->regs[CDTR]));
+			transferDone(r, toRemote);
+			cableBytes++;
+		} else {
+			transferDone(m, 0xFF);
+			if (!r->done) cableLost++;
+		}
+	}
+}
+
+/* Timer, cable and link interrupt up to the console's clock */
+static void service(u8 id)
+{
+	Side *s = &side[id];
+
+	if (s->t > s->limit)
+		stuck(id);
+	while (s->t >= s->nextTick) {
+		s->nextTick += TICK_CYCLES;
+		s->musicTick++;
+		if (s->intOn && !s->inIsr && *instances[id].masterIdle) {
+			/* linkTick */
+			*instances[id].masterIdle = 0;
+			s->regs[CCR] = LINK_CCR_MASTER_INT;
+			portWrites(id);
+		}
+	}
+	cable();
+	if (s->irq && s->intOn && !s->inIsr) {
+		s->irq = false;
+		s->inIsr = true;
+		instances[id].linkHandle();
+		portWrites(id);
+		s->inIsr = false;
+	}
+}
+
+/* Let the other console catch up once this one is more than slack
+ * ahead, then take in what it did meanwhile */
+static void sync(u8 id, Cycles slack)
+{
+	if (side[id].t > side[id ^ 1].t + slack) {
+		yield(id);
+		service(id);
+	}
+}
+
+/* The code did something that takes ACCESS_CYCLES. A write since the
+ * last access happened before this one. */
+static void access(u8 id)
+{
+	portWrites(id);
+	side[id].t += ACCESS_CYCLES;
+	service(id);
+	sync(id, QUANTUM);
+}
+
+/* Nothing to do until the clock reads until: run to each event */
+static void idle(u8 id, Cycles until)
+{
+	Side *s = &side[id];
+
+	portWrites(id);
+	while (s->t < until) {
+		Cycles next = until, due = cableDue();
+
+		if (s->nextTick < next) next = s->nextTick;
+		if (due > s->t && due < next) next = due;
+		s->t = next;
+		service(id);
+		sync(id, 0);
+	}
+}
+
+/* ---- LoopHost ---- */
+
+static volatile u8 *hostPort(u8 id)
+{
+	access(id);
+	return side[id].regs;
+}
+
+static volatile u32 *hostTick(u8 id)
+{
+	access(id);
+	return &side[id].musicTick;
+}
+
+static void hostInterrupts(u8 id, bool on)
+{
+	side[id].intOn = on;
+}
+
+/* The menus: CONNECT, and on the HOST the first level and a mode */
+static u8 menuMode;             /* 0 coop, 1 deathmatch, 2 coop lockstep */
+
+static u16 hostPad(u8 id)
+{
+	Side *s = &side[id];
+	u16 f = s->screenFrames;
+
+	if (!s->screen)
+		return 0;
+	if (!strcmp(s->screen, "MULTIPLAYER") || !strcmp(s->screen, "SELECT LEVEL"))
+		return f == 5 ? K_A : 0;
+	if (!strcmp(s->screen, "SELECT MODE")) {
+		if (f < 5 || (f & 1)) return 0;
+		return (f - 5) / 2 < menuMode ? K_LD : (f - 5) / 2 == menuMode ? K_A : 0;
+	}
+	return 0;
+}
+
+static void hostWaitFrame(u8 id)
+{
+	Side *s = &side[id];
+
+	idle(id, s->on + ((s->t - s->on) / VIP_FRAME_CYCLES + 1) * VIP_FRAME_CYCLES);
+	s->screenFrames++;
+}
+
+static const char *const screens[] = {
+	"MULTIPLAYER", "CONNECTING...", "NO LINK CABLE?", "SELECT LEVEL", "SELECT MODE",
+	"WAITING FOR HOST", "JOINER NOT RESPONDING", NULL
+};
+
+static void hostPrint(u8 id, u16 col, u16 row, const char *str)
+{
+	Side *s = &side[id];
+	u8 i;
+
+	(void)col;
+	(void)row;
+	for (i = 0; screens[i]; i++) {
+		if (strcmp(str, screens[i])) continue;
+		if ((i == 3 || i == 5) && !s->connectedAt)
+			s->connectedAt = s->t;      /* SELECT LEVEL, WAITING FOR HOST */
+		if (i == 1 && !s->connectAt)
+			s->connectAt = s->t;
+		s->screen = screens[i];
+		s->screenFrames = 0;
+	}
+}
+
+/* ---- Co-op ---- */
+
+typedef struct {
+	u16 x, y, angle;
+	u8  flags, health;
+} Truth;
+
+typedef struct {
+	u32 sent, decoded, desyncs;
+	Cycles latencySum, latencyMax;
+	u32 errorSum, errorMax, errorFrames;
+} Stats;
+
+static Truth *truth[2];         /* by frame */
+static Cycles sentAt[2][256];   /* by LinkState.time */
+static LinkState sentState[2][256];
+static u8 sentEvents[2][256];   /* event bytes, 0 for none */
+static u16 frameOf[2];          /* frame each console is on */
+static Stats stats[2];          /* by receiver */
+
+/* The HOST's enemy records, made up: only their bytes matter */
+static void fillEvents(u8 *events, u8 len, u8 time)
+{
+	u8 i;
+
+	for (i = 0; i < len; i++)
+		events[i] = (u8)(time * 31 + i * 7 + len);
+}
+
+static void hostReceived(u8 id, const LinkState *st, const u8 *events, u8 evLen)
+{
+	u8 peer = id ^ 1, want[LINK_MAX_EVENTS];
+	const LinkState *was = &sentState[peer][st->time];
+	Stats *a = &stats[id];
+	Cycles lat;
+
+	a->decoded++;
+	fillEvents(want, sentEvents[peer][st->time], st->time);
+	if (st->x != was->x || st->y != was->y || st->angle != was->angle
+	    || st->flags != was->flags || st->health != was->health
+	    || evLen != sentEvents[peer][st->time] || memcmp(events, want, evLen)) {
+		a->desyncs++;
+		return;
+	}
+	lat = side[id].t - sentAt[peer][st->time];
+	a->latencySum += lat;
+	if (lat > a->latencyMax) a->latencyMax = lat;
+}
+
+/* Scripted players: a square walk at 40 units a frame, turning as it
+ * goes, a shot every 7 frames, a rocket every 97 */
+static void script(u8 id, u16 f, Truth *p)
+{
+	static const s8 dx[4] = { 1, 0, -1, 0 }, dy[4] = { 0, 1, 0, -1 };
+	u8 leg = ((f + id * 32) >> 6) & 3;
+
+	if (f == 0) {
+		p->x = 0x0800 + id * 0x0400;
+		p->y = 0x0800;
+		p->angle = 0;
+		p->health = 100;
+	} else {
+		*p = truth[id][f - 1];
+		p->x += dx[leg] * 40;
+		p->y += dy[leg] * 40;
+		p->angle = (p->angle + 4) & 1023;
+	}
+	p->flags = 0;
+	if (f % 7 == 0) p->flags |= P2F_SHOOTING;
+	if (f % 97 == 96) p->flags |= P2F_FIRED_ROCKET;
+	if (f % 50 == 49) p->health = p->health > 10 ? p->health - 10 : 100;
+}
+
+/* A frame of game work: 25-45 ms, one in 16 another 40, one in 256 a
+ * hitch of 200 */
+static Cycles work(void)
+{
+	Cycles c = MS * 25 + random32() % (MS * 20);
+	u32 r = random32();
+
+	if ((r & 15) == 0) c += MS * 40;
+	if ((r >> 4 & 255) == 0) c += MS * 200;
+	return c;
+}
+
+static u16 frames;
+
+static void coopRun(u8 id)
+{
+	const Instance *in = &instances[id];
+	Side *s = &side[id];
+	Cycles epoch = s->t;
+	u16 f;
+
+	for (f = 0; f < frames; f++) {
+		Truth *p = &truth[id][f];
+		const Truth *peer;
+		LinkState st, sent, shown;
+		u8 evLen;
+		s32 dx, dy;
+		u32 err;
+
+		s->limit = s->t + FRAME_LIMIT;
+		idle(id, epoch + (Cycles)f * SIM_TICK_CYCLES);
+		idle(id, s->t + work());
+
+		script(id, f, p);
+		frameOf[id] = f;
+		st.x = p->x;
+		st.y = p->y;
+		st.angle = p->angle;
+		st.flags = p->flags;
+		st.health = p->health;
+		if (in->stateFrame(&st, f, id == 0 ? fillEvents : NULL, &sent, &evLen, &shown)) {
+			sentState[id][sent.time] = sent;
+			sentEvents[id][sent.time] = evLen;
+			sentAt[id][sent.time] = s->t;
+			stats[id ^ 1].sent++;
+		}
+
+		/* player 2 against where the peer is now */
+		peer = &truth[id ^ 1][frameOf[id ^ 1]];
+		dx = (s32)shown.x - peer->x;
+		dy = (s32)shown.y - peer->y;
+		err = (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+		if (f >= 8) {
+			stats[id].errorSum += err;
+			if (err > stats[id].errorMax) stats[id].errorMax = err;
+			stats[id].errorFrames++;
+		}
+	}
+}
+
+/* ---- Lockstep ---- */
+
+static u16 desyncFrame;
+static u16 lockFrames[2];       /* frames run in lockstep */
+static u32 *lockPads[2];        /* by frame: HOST pad << 16 | JOIN pad */
+static Cycles waitSum[2], waitMax[2];
+static u16 waitStalls[2];       /* waits of more than a tick */
+
+/* A pad that holds each button combination for 8 frames */
+static u16 scriptPad(u8 id, u16 f)
+{
+	u32 h = (u32)(f >> 3) * 2654435761u + id * 40503u;
+
+	return (u16)((h >> 16) & (K_A | K_B | K_LD | K_LU | K_LL | K_LR));
+}
+
+static void lockRun(u8 id)
+{
+	const Instance *in = &instances[id];
+	Side *s = &side[id];
+	Cycles epoch = s->t;
+	u32 state = 0x1234;
+	u16 f;
+
+	for (f = 0; f < frames; f++) {
+		u16 pads[2];
+		Cycles t0, wait;
+
+		s->limit = s->t + FRAME_LIMIT + (Cycles)LOCK_TIMEOUT * TICK_CYCLES;
+		idle(id, epoch + (Cycles)f * SIM_TICK_CYCLES);
+
+		t0 = s->t;
+		if (!in->lockInput(scriptPad(id, f), pads))
+			break;
+		wait = s->t - t0;
+		waitSum[id] += wait;
+		if (wait > waitMax[id]) waitMax[id] = wait;
+		if (wait > SIM_TICK_CYCLES) waitStalls[id]++;
+		lockPads[id][f] = (u32)pads[0] << 16 | pads[1];
+		lockFrames[id] = f + 1;
+
+		/* the frame: both players from the pads */
+		idle(id, s->t + work());
+		state = state * 31 + pads[0] * 7 + pads[1];
+		if (id == 1 && desyncFrame && f == desyncFrame) state++;
+		in->lockEnd((u8)(state ^ state >> 8 ^ state >> 16 ^ state >> 24));
+	}
+}
+
+/* ---- Handshake ---- */
+
+static void handshakeRun(u8 id)
+{
+	Side *s = &side[id];
+
+	s->limit = HANDSHAKE_LIMIT;
+	instances[id].menu(&s->menu);
+}
+
+/* ---- Running the two ---- */
+
+/* A console that is through keeps its link running, as the game would,
+ * until the other is through too */
+static void linger(u8 id)
+{
+	Side *s = &side[id];
+
+	s->through = true;
+	while (!side[id ^ 1].through) {
+		s->limit = s->t + (Cycles)LOCK_TIMEOUT * TICK_CYCLES * 2;
+		idle(id, s->t + SIM_TICK_CYCLES);
+	}
+}
+
+static void sideMain(int id)
+{
+	Side *s = &side[id];
+
+	idle(id, s->on);
+	sideRun(id);
+	s->endAt = s->t;
+	linger(id);
+	s->done = true;
+	s->t = NEVER;
+	if (!side[id ^ 1].done)
+		setcontext(&side[id ^ 1].ctx);
+	setcontext(&mainCtx);
+}
+
+static const LoopHost loopHost = {
+	hostPort, hostTick, hostInterrupts, hostPad, hostWaitFrame, hostPrint, hostReceived
+};
+
+static void run(void (*fn)(u8 id), const LoopMenu *start)
+{
+	u8 id;
+
+	sideRun = fn;
+	for (id = 0; id < 2; id++) {
+		Side *s = &side[id];
+
+		memset(s, 0, sizeof(*s));
+		s->nextTick = TICK_CYCLES;
+		s->on = id ? startOffset : 0;
+		s->intOn = true;
+		s->limit = HANDSHAKE_LIMIT;
+		s->regs[CCR] = s->ccr = LINK_CCR_IDLE;
+		s->stack = malloc(STACK_SIZE);
+		getcontext(&s->ctx);
+		s->ctx.uc_stack.ss_sp = s->stack;
+		s->ctx.uc_stack.ss_size = STACK_SIZE;
+		s->ctx.uc_link = NULL;
+		makecontext(&s->ctx, (void (*)(void))sideMain, 1, (int)id);
+		instances[id].init(&loopHost, id);
+	}
+	if (start) {
+		LoopMenu m = *start;
+
+		for (id = 0; id < 2; id++) {
+			m.host = (id == 0);
+			instances[id].gameStart(&m);
+		}
+	}
+	swapcontext(&mainCtx, &side[0].ctx);
+	for (id = 0; id < 2; id++)
+		free(side[id].stack);
+}
+
+/* n / d as a decimal with one digit */
+static void printTenths(Cycles n, Cycles d)
+{
+	Cycles v = d ? (n * 10 + d / 2) / d : 0;
+
+	printf("%llu.%llu", v / 10, v % 10);
+}
+
+static int handshake(const char *mode)
+{
+	static const char *const modes[] = { "coop", "dm", "lockstep" };
+	u16 phase, ok = 0, split = 0, agree = 0;
+	Cycles connectSum = 0, startSum = 0, startMax = 0;
+	u32 bytes = 0;
+	u8 id;
+
+	for (menuMode = 0; menuMode < 3 && strcmp(mode, modes[menuMode]); menuMode++);
+	if (menuMode == 3)
+		usage();
+
+	/* console b switched on at every phase of a's VIP frame */
+	giveUp = true;
+	for (phase = 0; phase < HANDSHAKE_PHASES; phase++) {
+		const LoopMenu *h, *j;
+
+		startOffset = (Cycles)phase * HANDSHAKE_STEP;
+		stuckSide = 0;
+		cableBytes = 0;
+		run(handshakeRun, NULL);
+		if (stuckSide) {
+			if (side[0].connectedAt || side[1].connectedAt) split++;
+			continue;
+		}
+
+		ok++;
+		bytes += cableBytes;
+		for (id = 0; id < 2; id++) {
+			Cycles start = side[id].endAt - side[id].connectAt;
+
+			connectSum += side[id].connectedAt - side[id].connectAt;
+			startSum += start;
+			if (start > startMax) startMax = start;
+		}
+		h = side[0].menu.host ? &side[0].menu : &side[1].menu;
+		j = side[0].menu.host ? &side[1].menu : &side[0].menu;
+		if (h->host && !j->host && h->level == j->level && h->mode == j->mode
+		    && h->lockstep == j->lockstep && (!h->lockstep || h->seed == j->seed))
+			agree++;
+	}
+
+	printf("connected %u/%u, agree %u, split %u, connect ", ok, HANDSHAKE_PHASES, agree, split);
+	printTenths(connectSum, (Cycles)MS * 2 * (ok ? ok : 1));
+	printf(" ms, start ");
+	printTenths(startSum, (Cycles)MS * 2 * (ok ? ok : 1));
+	printf("/");
+	printTenths(startMax, MS);
+	printf(" ms, cable %u bytes\n", ok ? bytes / ok : 0);
+	return agree != ok;
+}
+
+static int coop(void)
+{
+	static const LoopMenu start = { 1, true, GAMEMODE_COOP, false, 0 };
+	u32 desyncs = 0;
+	u8 id;
+
+	for (id = 0; id < 2; id++)
+		truth[id] = calloc(frames, sizeof(Truth));
+	run(coopRun, &start);
+
+	/* a to b, then b to a */
+	for (id = 0; id < 2; id++) {
+		const Stats *r = &stats[id ^ 1];
+
+		printf("%s%c>%c sent %u decoded %u desyncs %u latency ", id ? ", " : "",
+		       'a' + id, 'a' + (id ^ 1), r->sent, r->decoded, r->desyncs);
+		printTenths(r->latencySum, (Cycles)MS * (r->decoded - r->desyncs));
+		printf("/");
+		printTenths(r->latencyMax, MS);
+		printf(" ms p2 error %u/%u", r->errorFrames ? r->errorSum / r->errorFrames : 0, r->errorMax);
+		desyncs += r->desyncs;
+	}
+	printf(", noise %u, cable %u bytes, %u lost\n", noiseHits, cableBytes, cableLost);
+	for (id = 0; id < 2; id++)
+		free(truth[id]);
+	return !noiseRate && desyncs != 0;
+}
+
+static int lockstep(void)
+{
+	static const LoopMenu start = { 1, true, GAMEMODE_COOP, true, 0x1234 };
+	u16 f, both, mismatch = 0;
+	u8 id;
+
+	for (id = 0; id < 2; id++)
+		lockPads[id] = calloc(frames, sizeof(u32));
+	run(lockRun, &start);
+
+	both = lockFrames[0] < lockFrames[1] ? lockFrames[0] : lockFrames[1];
+	for (f = 0; f < both; f++)
+		if (lockPads[0][f] != lockPads[1][f]) mismatch++;
+	printf("frames %u/%u, pad mismatches %u, wait", lockFrames[0], lockFrames[1], mismatch);
+	for (id = 0; id < 2; id++) {
+		printf(id ? " | " : " ");
+		printTenths(waitSum[id], (Cycles)MS * (lockFrames[id] ? lockFrames[id] : 1));
+		printf("/");
+		printTenths(waitMax[id], MS);
+	}
+	printf(" ms, stalls %u/%u, noise %u, cable %u bytes, %u lost\n",
+	       waitStalls[0], waitStalls[1], noiseHits, cableBytes, cableLost);
+	for (id = 0; id < 2; id++)
+		free(lockPads[id]);
+	return !noiseRate && mismatch != 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1 && !strcmp(argv[1], "-w")) {
+		masterWaits = true;
+		argc--;
+		argv++;
+	}
+	if (argc < 3)
+		usage();
+	scenario = argv[1];
+	if (!strcmp(argv[1], "handshake") && argc == 3)
+		return handshake(argv[2]);
+
+	frames = (u16)atoi(argv[2]);
+	if (frames == 0 || frames > MAX_FRAMES)
+		usage();
+	if (argc > 3) noiseRate = (u32)atoi(argv[3]);
+	if (!strcmp(argv[1], "coop") && argc <= 4)
+		return coop();
+	if (!strcmp(argv[1], "lockstep") && argc <= 5) {
+		if (argc > 4) desyncFrame = (u16)atoi(argv[4]);
+		return lockstep();
+	}
+	usage();
+	return 2;
+}
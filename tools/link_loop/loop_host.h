@@ -0,0 +1,69 @@
+#ifndef _LINK_LOOP_LOOP_HOST_H_
+#define _LINK_LOOP_LOOP_HOST_H_
+
+
+/*
+ * Between link_loop.c (the harness) and instance.c (one console).
+ *
+ * Every console is its own copy of link.c, lockstep.c, snapshot.c,
+ * menu_multiplayer.c and instance.c, linked into one object whose
+ * symbols are then prefixed (a_, b_), so the two copies keep their own
+ * globals in one process. They see the harness only through LoopHost,
+ * and the harness calls them through the entry points below.
+ */
+
+#include "libgccvb.h"
+#include "../../src/vbdoom/functions/link.h"
+
+typedef struct {
+	volatile u8 *(*port)(u8 id);        /* before every HW_REGS access */
+	volatile u32 *(*tick)(u8 id);       /* before every g_musicTick read */
+	void (*interrupts)(u8 id, bool on);
+	u16 (*pad)(u8 id);                  /* vbReadPad */
+	void (*waitFrame)(u8 id);           /* to the next VIP frame */
+	void (*print)(u8 id, u16 col, u16 row, const char *s);
+	void (*received)(u8 id, const LinkState *s,     /* a state packet decoded */
+	                 const u8 *events, u8 evLen);
+} LoopHost;
+
+/* What the menu agreed on */
+typedef struct {
+	u8   level;             /* 0: cancelled */
+	bool host;
+	u8   mode;              /* g_gameMode */
+	bool lockstep;
+	u16  seed;
+} LoopMenu;
+
+/* ---- Entry points, per console (prefixed) ---- */
+
+/* Before anything else: the harness and which console this is */
+void loopInit(const LoopHost *host, u8 id);
+
+/* Run multiplayerMenu() */
+void loopMenu(LoopMenu *out);
+
+/* What the menu leaves for the game: the agreed settings, linkStart(),
+ * snapReset(), and lockStart() in lockstep */
+void loopGameStart(const LoopMenu *m);
+
+/* One co-op frame of gameLoop's state exchange: send s (time is set
+ * from frame) when gameLoop would, with a full budget of event bytes
+ * from fill (the enemy records, NULL for none), take in every packet,
+ * snapUpdate(). Every packet decoded goes to LoopHost.received. Returns
+ * whether a packet was queued, and then its state and event count in
+ * *sent and *evLen; *shown is where player 2 is drawn. */
+bool loopStateFrame(const LinkState *s, u16 frame, void (*fill)(u8 *events, u8 len, u8 time),
+                    LinkState *sent, u8 *evLen, LinkState *shown);
+
+/* Lockstep: lockInput(pad) and, if still in lockstep, g_lockPad */
+bool loopLockInput(u16 pad, u16 pads[2]);
+void loopLockEnd(u8 hash);
+
+/* The link interrupt */
+void linkHandle(void);
+
+extern volatile u8 g_linkMasterIdle;
+
+
+#endif
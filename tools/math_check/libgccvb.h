@@ -0,0 +1,23 @@
+#ifndef _MATH_CHECK_LIBGCCVB_H_
+#define _MATH_CHECK_LIBGCCVB_H_
+
+
+/*
+ * Host stand-in for libgccvb.h, force-included into libgccvb/math.c for
+ * math_check (see math_check.c): the libgccvb types at the V810's widths
+ * (int is 32 bits on the hosts this runs on, long may not be).
+ */
+
+#define _LIBGCCVB_TYPES_H
+
+#include <stdbool.h>
+
+typedef unsigned char 	u8;
+typedef unsigned short 	u16;
+typedef unsigned int 	u32;
+
+typedef signed char 	s8;
+typedef signed short 	s16;
+typedef signed int 		s32;
+
+#endif
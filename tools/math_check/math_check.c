@@ -0,0 +1,121 @@
+/*
+ * math_check.c -- the integer helpers of libgccvb/math against doubles
+ *
+ * Links libgccvb/math.c (built FIXED_ONLY, as the game builds it) and
+ * measures each helper against the double-precision value it stands
+ * for, over every input pair up to 255 and a fixed pseudo-random sample
+ * of the full s16 range. Prints one line per helper and input range:
+ * the points tried and the worst error found, in the units math.h
+ * states its bounds in. run_math_check.py builds it and compares the
+ * report with reference.txt.
+ *
+ *   math_check
+ *
+ * The sample comes from a fixed LCG and the figures are rounded to a
+ * tenth of a percent, so the report is the same on every host.
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "libgccvb.h"
+#include "../../libs/libgccvb/math.h"
+
+#define SAMPLES     200000
+#define PI          3.14159265358979323846
+
+static u32 lcg;
+
+/* Next pseudo-random s16 */
+static s16 rnd16(void)
+{
+	lcg = lcg * 1103515245u + 12345u;
+	return (s16)(lcg >> 16);
+}
+
+/* An input pair: exhaustive over [-255, 255] first, then the sample */
+static bool nextPair(u32 i, s16 *dx, s16 *dy)
+{
+	if (i == 0) lcg = 12345;            /* the same sample for every check */
+	if (i < 511u * 511u) {
+		*dx = (s16)(i % 511) - 255;
+		*dy = (s16)(i / 511) - 255;
+		return true;
+	}
+	if (i >= 511u * 511u + SAMPLES) return false;
+	*dx = rnd16();
+	*dy = rnd16();
+	if (*dx == -32768) *dx = -32767;    /* |v| fits s16, as the callers' */
+	if (*dy == -32768) *dy = -32767;
+	return true;
+}
+
+static int major(s16 dx, s16 dy)
+{
+	int ax = dx < 0 ? -dx : dx, ay = dy < 0 ? -dy : dy;
+	return ax > ay ? ax : ay;
+}
+
+/* Angle error in 1024-per-turn units, worst over every pair */
+static void checkAtan2(void)
+{
+	u32 i, n = 0;
+	double worst = 0;
+	s16 dx, dy;
+
+	for (i = 0; nextPair(i, &dx, &dy); i++) {
+		double want, err;
+
+		if (dx == 0 && dy == 0) continue;
+		want = atan2(dy, dx) * 512.0 / PI;
+		err = fabs(fix_atan2(dy, dx) - want);
+		err = fmod(err, 1024.0);
+		if (err > 512.0) err = 1024.0 - err;
+		if (err > worst) worst = err;
+		n++;
+	}
+	printf("fix_atan2: %u points, worst %.2f units\n", n, worst);
+}
+
+/* Relative distance error in percent, low and high, for pairs whose
+ * larger axis is lo..hi */
+static void checkDist(const char *name, u16 (*dist)(s16, s16), int lo, int hi)
+{
+	u32 i, n = 0;
+	double under = 0, over = 0;
+	s16 dx, dy;
+
+	for (i = 0; nextPair(i, &dx, &dy); i++) {
+		double want, err;
+		int m = major(dx, dy);
+
+		if (m < lo || m > hi) continue;
+		want = sqrt((double)dx * dx + (double)dy * dy);
+		err = (dist(dx, dy) - want) * 100.0 / want;
+		if (err < under) under = err;
+		if (err > over) over = err;
+		n++;
+	}
+	printf("%s, max %d..%d: %u points, %+.1f%% .. %+.1f%%\n", name, lo, hi, n, under, over);
+}
+
+/* RECIP8LUT[d] is 32768/d rounded down */
+static void checkRecip(void)
+{
+	int d, bad = 0;
+
+	for (d = 1; d < 256; d++)
+		if (RECIP8LUT[d] != 32768 / d) bad++;
+	printf("RECIP8LUT: 255 entries, %d wrong\n", bad);
+}
+
+int main(void)
+{
+	checkRecip();
+	checkAtan2();
+	checkDist("fix_dist", fix_dist, 1, 63);
+	checkDist("fix_dist", fix_dist, 64, 32767);
+	checkDist("fix_dist_oct", fix_dist_oct, 1, 63);
+	checkDist("fix_dist_oct", fix_dist_oct, 64, 32767);
+	return 0;
+}
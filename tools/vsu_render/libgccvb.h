@@ -0,0 +1,62 @@
+#ifndef _VSU_RENDER_LIBGCCVB_H_
+#define _VSU_RENDER_LIBGCCVB_H_
+
+
+/*
+ * Host stand-in for libgccvb.h, force-included into the game sources the
+ * renderer links (see vsu_render.c). It keeps the libgccvb declarations
+ * that sndplay.c and timer.c use and swaps out what only works on the
+ * V810: the hardware addresses become arrays in vsu_render.c, the
+ * interrupt and section attributes go away.
+ *
+ * The V810 is ILP32; the sources are built with -Dlong=int so the
+ * waveform tables in voices.h keep their 4-byte entries, and the types
+ * below are spelled without long so they have the same widths either way.
+ */
+
+#define _LIBGCCVB_TYPES_H
+#define _LIBGCCVB_WRAM_H_
+#define _LIBGCCVB_ASM_H
+
+typedef unsigned char 	u8;
+typedef unsigned short 	u16;
+typedef unsigned int 	u32;
+
+typedef signed char 	s8;
+typedef signed short 	s16;
+typedef signed int 		s32;
+
+typedef unsigned char 	BYTE;
+typedef unsigned short 	HWORD;
+typedef unsigned int 	WORD;
+
+typedef enum {false, true} bool;
+
+#define f8 			s8
+#define f16 		s16
+#define f32 		s32
+
+// no WRAM section and no long calls on the host
+#define WRAM_CODE
+
+// the ISR only runs between two calls into the game code
+#define INT_ENABLE		((void)0)
+#define INT_DISABLE		((void)0)
+#define CPU_HALT		((void)0)
+
+void set_intlevel(u8 level);
+int get_intlevel();
+
+#include "audio.h"
+#include "interrupts.h"
+#include "mem.h"
+#include "timer.h"
+#include "vip.h"
+
+// SSTOP is a fixed address on the VB, a variable here
+#undef SSTOP
+extern u8 g_vsuSstop;
+#define SSTOP			g_vsuSstop
+
+
+#endif
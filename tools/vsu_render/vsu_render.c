@@ -0,0 +1,558 @@
+/*
+ * vsu_render.c -- host renderer for the music sequencer and the SFX mixer
+ *
+ * Links the game's own sndplay.c, timer.c and doom_sfx.c against an
+ * emulated VSU (SND_REGS, waveform RAM, SSTOP) and hardware timer, runs
+ * one song or one sound effect and writes what the VSU would play to a
+ * WAV file. render_vsu_audio.py builds it and runs it over every song and
+ * SFX; with a fixed model and no floating point the output is the same on
+ * every host, so the WAV digests and ISR figures make a regression check
+ * for changes to the sequencer, the mixer or the audio data.
+ *
+ *   vsu_render [-t ticks.csv] song <id> <ticks> <out.wav>
+ *   vsu_render [-t ticks.csv] sfx <id> <out.wav>
+ *
+ * A song runs for <ticks> g_musicTick ticks (one loop), a sound effect is
+ * started with playPlayerSFX() and runs until its voice is done, plus a
+ * short tail. Every run starts from a fresh process, so nothing carries
+ * over from a previous render.
+ *
+ * Time model (CPU cycles at 20 MHz):
+ *   - the timer fires reload * 100us after it was last enabled; the ISR
+ *     enables it at the end of its body, so the body's cost is added
+ *     first. That cost is modelled from the work the call did: the
+ *     figures in timer.c's header (150 cycles, plus 60 per PCM voice
+ *     mixed) and ISR_EVENT_CYCLES per music note written. Counts are
+ *     exact; cycles are an estimate derived from those counts, not a
+ *     measurement, and only move when the counts or the constants do.
+ *     Real costs come from the profiler overlay on hardware.
+ *   - when the ISR sets g_timerExpired the main loop runs updateMusic(),
+ *     as the game loop does once per frame.
+ *   - vipHandle() gets a FRAMESTART every 20 ms, so g_isrPerVip is
+ *     latched the way the profiler overlay reads it.
+ *
+ * VSU model: channels 0-4 play their 32-sample waveform at
+ * 5 MHz / (2048 - frequency) samples per second, scaled by the envelope
+ * and the SxLRV levels (product / 8, plus one when neither is zero),
+ * with the interval auto-off and the envelope step; a write of SxINT with
+ * the enable bit restarts the waveform and reloads the envelope. Sweep,
+ * modulation and the noise channel are not modelled (the game does not
+ * use them). The channels are summed and a one-pole high-pass stands in
+ * for the output capacitor. Output is 16-bit stereo at VSU_RATE.
+ *
+ * The report is one line on stdout: ISR calls (and how many at the
+ * 100us reload), most voices and music notes in one call, the estimated
+ * ISR cycles (average, worst, share of the CPU; labelled "est"), the
+ * overlay's figures, the music jitter histogram (timer.h) and the FNV-1a
+ * digest of the samples.
+ * -t also writes one CSV row per ISR call.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libgccvb.h"
+#include "../../src/vbdoom/functions/timer.h"
+#include "../../src/vbdoom/functions/sndplay.h"
+#include "../../src/vbdoom/assets/audio/doom_sfx.h"
+
+typedef unsigned long long Cycles;
+
+#define CPU_HZ              20000000
+#define VSU_RATE            40000
+#define CYCLES_PER_SAMPLE   (CPU_HZ / VSU_RATE)
+#define VSU_CLOCKS          (CYCLES_PER_SAMPLE / 4)    /* 5 MHz per output sample */
+#define VSU_INTERVAL_CLOCKS 19200                      /* 3.84 ms */
+#define VSU_ENVELOPE_CLOCKS 76800                      /* 15.36 ms */
+
+#define TIMER_UNIT_CYCLES   2000                       /* 100us */
+#define VIP_FRAME_CYCLES    400000                     /* 20 ms */
+
+/* ISR cost model (see the header) */
+#define ISR_BASE_CYCLES     150
+#define ISR_VOICE_CYCLES    60
+#define ISR_EVENT_CYCLES    40
+
+#define SFX_TAIL_CYCLES     (CPU_HZ / 20)              /* 50 ms after the voice ends */
+#define SFX_MAX_CYCLES      ((Cycles)CPU_HZ * 10)
+
+/* SxINT and SSTOP values the game never writes: set before each call into
+ * it, a different value afterwards means it wrote the register */
+#define VSU_INT_UNWRITTEN   0x40
+#define VSU_SSTOP_UNWRITTEN 0xFF
+
+#define VSU_CHANNELS        6
+#define VSU_WAVE_CHANNELS   5
+
+/* ---- Hardware the game code sees ---- */
+
+static SOUNDREG vsuRegs[VSU_CHANNELS];
+static u8 vsuWaveRam[VSU_WAVE_CHANNELS][128];
+static u8 vsuModRam[128];
+static u16 vipRegs[0x40];
+static u8 hwRegs[0x40];
+
+SOUNDREG* const SND_REGS = vsuRegs;
+u8* const WAVEDATA1 = vsuWaveRam[0];
+u8* const WAVEDATA2 = vsuWaveRam[1];
+u8* const WAVEDATA3 = vsuWaveRam[2];
+u8* const WAVEDATA4 = vsuWaveRam[3];
+u8* const WAVEDATA5 = vsuWaveRam[4];
+u8* const MODDATA = vsuModRam;
+u8 g_vsuSstop = 0;
+
+volatile u16* VIP_REGS = vipRegs;
+u8* const HW_REGS = hwRegs;
+u32 timVector;
+u32 vipVector;
+
+/* No link: the timer ISR's linkTick (link.h) finds the port busy */
+volatile u8 g_linkMasterIdle = 0;
+
+void copymem(u8* dest, const u8* src, u16 num)
+{
+	memcpy(dest, src, num);
+}
+
+void setmem(u8* dest, u8 src, u16 num)
+{
+	memset(dest, src, num);
+}
+
+void set_intlevel(u8 level)
+{
+	(void)level;
+}
+
+int get_intlevel()
+{
+	return 0;
+}
+
+void idleRun(void)
+{
+}
+
+/* ---- Timer (100us base only) ---- */
+
+static Cycles now = 0;
+static u16 tmrReload = 0;
+static u8 tmrOn = 0;
+static u8 tmrIntOn = 0;
+static u8 tmrRestart = 0;
+static Cycles tmrDue = 0;
+
+void timer_enable(int enb)
+{
+	tmrOn = (enb != 0);
+	if (enb) tmrRestart = 1;
+}
+
+u16 timer_get()
+{
+	if (!tmrOn || tmrDue <= now) return 0;
+	return (u16)((tmrDue - now + TIMER_UNIT_CYCLES - 1) / TIMER_UNIT_CYCLES);
+}
+
+void timer_set(u16 time)
+{
+	tmrReload = time;
+}
+
+void timer_freq(int freq)
+{
+	(void)freq;
+}
+
+void timer_int(int enb)
+{
+	tmrIntOn = (enb != 0);
+}
+
+int timer_getstat()
+{
+	return 0;
+}
+
+void timer_clearstat()
+{
+}
+
+/* ---- VSU ---- */
+
+typedef struct {
+	u8 on;
+	u8 intReg;         /* SxINT as last written */
+	u8 pos;            /* waveform sample, 0-31 */
+	u8 env;            /* envelope level, 0-15 */
+	u32 phase;         /* VSU clocks into the current waveform sample */
+	u32 envClock;      /* VSU clocks into the current envelope step */
+	u32 intClock;      /* VSU clocks since the channel was started */
+} VsuChannel;
+
+static VsuChannel vsu[VSU_CHANNELS];
+static s32 hpIn[2], hpOut[2];
+
+static void vsuStart(u8 ch, u8 value)
+{
+	VsuChannel *c = &vsu[ch];
+
+	c->intReg = value;
+	c->on = (value & 0x80) != 0;
+	c->pos = 0;
+	c->phase = 0;
+	c->env = SND_REGS[ch].SxEV0 >> 4;
+	c->envClock = 0;
+	c->intClock = 0;
+}
+
+/* Around every call into the game code: find the SxINT and SSTOP writes */
+static void callBegin(void)
+{
+	u8 ch;
+
+	for (ch = 0; ch < VSU_CHANNELS; ch++)
+		SND_REGS[ch].SxINT = VSU_INT_UNWRITTEN;
+	g_vsuSstop = VSU_SSTOP_UNWRITTEN;
+}
+
+/* cost: cycles the call took, before a timer it enabled starts counting */
+static void callEnd(u32 cost)
+{
+	u8 ch;
+
+	if (g_vsuSstop != VSU_SSTOP_UNWRITTEN && (g_vsuSstop & 1)) {
+		for (ch = 0; ch < VSU_CHANNELS; ch++)
+			vsu[ch].on = 0;
+	}
+	for (ch = 0; ch < VSU_CHANNELS; ch++) {
+		u8 value = SND_REGS[ch].SxINT;
+		if (value == VSU_INT_UNWRITTEN)
+			SND_REGS[ch].SxINT = vsu[ch].intReg;
+		else
+			vsuStart(ch, value);
+	}
+	if (tmrRestart) {
+		tmrDue = now + cost + (Cycles)tmrReload * TIMER_UNIT_CYCLES;
+		tmrRestart = 0;
+	}
+}
+
+static u8 vsuLevel(u8 env, u8 lrv)
+{
+	u8 a = env * lrv;
+	return a ? (a >> 3) + 1 : 0;
+}
+
+/* One output sample: mix the channels, step them VSU_CLOCKS */
+static void vsuSample(s16 out[2])
+{
+	s32 mix[2] = {0, 0};
+	u8 ch, i;
+
+	for (ch = 0; ch < VSU_WAVE_CHANNELS; ch++) {
+		VsuChannel *c = &vsu[ch];
+		SOUNDREG *r = &SND_REGS[ch];
+		u32 period;
+		u8 ram, wave;
+
+		if (!c->on) continue;
+
+		if (c->intReg & 0x20) {
+			c->intClock += VSU_CLOCKS;
+			if (c->intClock >= ((u32)(c->intReg & 0x1F) + 1) * VSU_INTERVAL_CLOCKS) {
+				c->on = 0;
+				continue;
+			}
+		}
+
+		if (r->SxEV1 & 0x01) {
+			u32 step = ((u32)(r->SxEV0 & 0x07) + 1) * VSU_ENVELOPE_CLOCKS;
+			c->envClock += VSU_CLOCKS;
+			if (c->envClock >= step) {
+				c->envClock -= step;
+				if (r->SxEV0 & 0x08) {
+					if (c->env < 15) c->env++;
+					else if (r->SxEV1 & 0x02) c->env = r->SxEV0 >> 4;
+				} else {
+					if (c->env) c->env--;
+					else if (r->SxEV1 & 0x02) c->env = r->SxEV0 >> 4;
+				}
+			}
+		}
+
+		ram = r->SxRAM & 0x07;
+		if (ram < VSU_WAVE_CHANNELS) {
+			wave = vsuWaveRam[ram][c->pos << 2] & 0x3F;
+			mix[0] += wave * vsuLevel(c->env, r->SxLRV >> 4);
+			mix[1] += wave * vsuLevel(c->env, r->SxLRV & 0x0F);
+		}
+
+		period = 2048 - (r->SxFQL | ((u32)(r->SxFQH & 0x07) << 8));
+		c->phase += VSU_CLOCKS;
+		while (c->phase >= period) {
+			c->phase -= period;
+			c->pos = (c->pos + 1) & 31;
+		}
+	}
+
+	/* Full PCM plus full music stays under 6000: x4 leaves headroom */
+	for (i = 0; i < 2; i++) {
+		s32 x = mix[i] << 2;
+		s32 y = x - hpIn[i] + hpOut[i] - (hpOut[i] >> 8);
+		hpIn[i] = x;
+		hpOut[i] = y;
+		if (y > 32767) y = 32767;
+		if (y < -32768) y = -32768;
+		out[i] = (s16)y;
+	}
+}
+
+/* ---- WAV output ---- */
+
+static FILE *wav;
+static u32 wavFrames = 0;
+static u32 wavDigest = 2166136261u;   /* FNV-1a */
+
+static void putLe(u32 v, u8 bytes)
+{
+	while (bytes--) {
+		fputc(v & 0xFF, wav);
+		v >>= 8;
+	}
+}
+
+static void wavHeader(void)
+{
+	fseek(wav, 0, SEEK_SET);
+	fwrite("RIFF", 1, 4, wav);
+	putLe(36 + wavFrames * 4, 4);
+	fwrite("WAVEfmt ", 1, 8, wav);
+	putLe(16, 4);
+	putLe(1, 2);                    /* PCM */
+	putLe(2, 2);                    /* stereo */
+	putLe(VSU_RATE, 4);
+	putLe(VSU_RATE * 4, 4);
+	putLe(4, 2);
+	putLe(16, 2);
+	fwrite("data", 1, 4, wav);
+	putLe(wavFrames * 4, 4);
+}
+
+static void wavFrame(const s16 s[2])
+{
+	u8 b[4];
+	u8 i;
+
+	b[0] = (u8)s[0]; b[1] = (u8)((u16)s[0] >> 8);
+	b[2] = (u8)s[1]; b[3] = (u8)((u16)s[1] >> 8);
+	for (i = 0; i < 4; i++)
+		wavDigest = (wavDigest ^ b[i]) * 16777619u;
+	fwrite(b, 1, 4, wav);
+	wavFrames++;
+}
+
+/* ---- ISR work ---- */
+
+static FILE *ticksCsv;
+static u32 isrCalls = 0;
+static u32 isrFast = 0;
+static u32 isrEvents = 0;
+static u8 isrVoicesMax = 0;
+static u8 isrEventsMax = 0;
+static u32 isrCostWorst = 0;
+static Cycles isrCostSum = 0;
+static u32 overlayFrames = 0;
+static u32 overlaySum = 0;
+static u32 overlayWorst = 0;
+
+static void runIsr(void)
+{
+	u8 tail[MUS_QUEUES];
+	u8 voices = 0, events = 0, v;
+	u16 reload = tmrReload;
+	u32 cost;
+
+	for (v = 0; v < PCM_VOICES; v++)
+		if (g_pcmVoice[v].playing) voices++;
+	for (v = 0; v < MUS_QUEUES; v++)
+		tail[v] = g_musQueue[v].tail;
+
+	callBegin();
+	timerHandle();
+	for (v = 0; v < MUS_QUEUES; v++)
+		events += (g_musQueue[v].tail - tail[v]) & (MUS_QUEUE_LEN - 1);
+	cost = ISR_BASE_CYCLES + voices * ISR_VOICE_CYCLES + events * ISR_EVENT_CYCLES;
+	callEnd(cost);
+
+	isrCalls++;
+	if (reload == 1) isrFast++;
+	isrEvents += events;
+	if (voices > isrVoicesMax) isrVoicesMax = voices;
+	if (events > isrEventsMax) isrEventsMax = events;
+	if (cost > isrCostWorst) isrCostWorst = cost;
+	isrCostSum += cost;
+	if (ticksCsv)
+		fprintf(ticksCsv, "%llu,%u,%u,%u,%u\n", now, reload, voices, events, cost);
+
+	/* The game loop wakes up and runs its frame */
+	if (g_timerExpired) {
+		g_timerExpired = 0;
+		callBegin();
+		updateMusic(true);
+		callEnd(0);
+	}
+}
+
+static void runVip(void)
+{
+	vipRegs[INTPND] = FRAMESTART;
+	vipHandle();
+	vipRegs[INTPND] = 0;
+
+	/* profiler.c's reading of it */
+	if (g_isrPerVip) {
+		u32 per = VIP_FRAME_CYCLES / g_isrPerVip;
+		u32 isr = per > TIMER_UNIT_CYCLES ? per - TIMER_UNIT_CYCLES : 1;
+		overlayFrames++;
+		overlaySum += isr;
+		if (isr > overlayWorst) overlayWorst = isr;
+	}
+}
+
+/* ---- Emulation loop ---- */
+
+static Cycles sampleDue = 0;
+static Cycles vipDue = VIP_FRAME_CYCLES;
+
+/* Run up to the next output sample, and write it */
+static void runSample(void)
+{
+	s16 s[2];
+
+	for (;;) {
+		Cycles next = sampleDue;
+		if (tmrOn && tmrIntOn && tmrDue < next) next = tmrDue;
+		if (vipDue < next) next = vipDue;
+		if (next > now) now = next;
+		if (tmrOn && tmrIntOn && tmrDue <= now) {
+			runIsr();
+			continue;
+		}
+		if (vipDue <= now) {
+			runVip();
+			vipDue += VIP_FRAME_CYCLES;
+			continue;
+		}
+		break;
+	}
+	vsuSample(s);
+	wavFrame(s);
+	sampleDue += CYCLES_PER_SAMPLE;
+}
+
+static bool anyVoicePlaying(void)
+{
+	u8 v;
+	for (v = 0; v < PCM_VOICES; v++)
+		if (g_pcmVoice[v].playing) return true;
+	return false;
+}
+
+static int usage(void)
+{
+	fprintf(stderr,
+		"usage: vsu_render [-t ticks.csv] song <id> <ticks> <out.wav>\n"
+		"       vsu_render [-t ticks.csv] sfx <id> <out.wav>\n");
+	return 2;
+}
+
+int main(int argc, char **argv)
+{
+	int a = 1;
+	bool song;
+	u32 id, ticks = 0;
+	const char *out;
+	u8 i;
+
+	if (a + 1 < argc && !strcmp(argv[a], "-t")) {
+		ticksCsv = fopen(argv[a + 1], "w");
+		if (!ticksCsv) {
+			perror(argv[a + 1]);
+			return 1;
+		}
+		fprintf(ticksCsv, "cycle,reload,voices,events,est_cycles\n");
+		a += 2;
+	}
+	if (a + 3 == argc && !strcmp(argv[a], "sfx")) {
+		song = false;
+		out = argv[a + 2];
+	} else if (a + 4 == argc && !strcmp(argv[a], "song")) {
+		song = true;
+		ticks = (u32)strtoul(argv[a + 2], 0, 0);
+		out = argv[a + 3];
+	} else {
+		return usage();
+	}
+	id = (u32)strtoul(argv[a + 1], 0, 0);
+	if (!song && id >= SFX_COUNT) return usage();
+
+	wav = fopen(out, "wb");
+	if (!wav) {
+		perror(out);
+		return 1;
+	}
+	wavHeader();
+
+	callBegin();
+	mp_init();
+	setupTimer();
+	callEnd(0);
+
+	if (song) {
+		u32 start;
+
+		callBegin();
+		musicLoadSong((u8)id);
+		musicStart();
+		updateMusic(true);
+		callEnd(0);
+		if (!isMusicPlaying()) return usage();
+
+		start = g_musicTick;
+		while ((u32)(g_musicTick - start) < ticks)
+			runSample();
+	} else {
+		Cycles end;
+
+		callBegin();
+		playPlayerSFX((u8)id);
+		callEnd(0);
+
+		while (anyVoicePlaying() && now < SFX_MAX_CYCLES)
+			runSample();
+		end = now + SFX_TAIL_CYCLES;
+		while (now < end)
+			runSample();
+	}
+
+	wavHeader();
+	fclose(wav);
+	if (ticksCsv) fclose(ticksCsv);
+
+	printf("%s %u: %u.%03u s, isr %u calls (%u at 100us), voices max %u, "
+		"notes %u (max %u per call), isr est cycles avg %u worst %u (%u.%u%% cpu), "
+		"overlay avg %u worst %u, jitter",
+		song ? "song" : "sfx", id,
+		wavFrames / VSU_RATE, (wavFrames % VSU_RATE) / (VSU_RATE / 1000),
+		isrCalls, isrFast, isrVoicesMax, isrEvents, isrEventsMax,
+		isrCalls ? (u32)(isrCostSum / isrCalls) : 0, isrCostWorst,
+		now ? (u32)(isrCostSum * 100 / now) : 0,
+		now ? (u32)(isrCostSum * 1000 / now % 10) : 0,
+		overlayFrames ? overlaySum / overlayFrames : 0, overlayWorst);
+	for (i = 0; i < MUS_JITTER_BINS; i++)
+		printf("%c%u", i ? ',' : ' ', g_musJitter[i]);
+	printf(", wav %08x\n", wavDigest);
+	return 0;
+}
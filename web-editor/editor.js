@@ -2,6 +2,8 @@
   'use strict';
 
   const LEVEL_FORMAT_VERSION = 1;
+  /** Packed level blob version (LEVEL_BLOB_VERSION in functions/level.h). */
+  const LEVEL_BLOB_VERSION = 3;
 
   const TILE_NAMES = [
     'Empty',
@@ -36,12 +38,13 @@
     'Chaingun',
   ];
 
-  /** Game limits (must match enemy.h, pickup.h, door.h). Editor enforces these and shows caps in UI. */
+  /** Game limits (must match enemy.h, pickup.h, door.h, level.h). Editor enforces these and shows caps in UI. */
   const GAME_LIMITS = {
     MAX_ENEMIES: 21,
     MAX_PICKUPS: 16,
     MAX_DOORS: 24,
     MAX_SWITCHES: 4,
+    MAX_SECRETS: 4,
   };
 
   let state = {
@@ -52,13 +55,15 @@
     spawn2: null,
     enemies: [],
     pickups: [],
+    secrets: [],
     switchLinks: [],
+    notes: [], // free text lines, kept in the JSON and written as the level header's comment
     brush: 1,
     placing: null,
     enemyType: 0,
     pickupType: 0,
     hoverCell: null, // { x, y, type, index? } or null
-    hoverEntity: null, // { type: 'spawn1'|'spawn2'|'enemy'|'pickup', index } or null
+    hoverEntity: null, // { type: 'spawn1'|'spawn2'|'enemy'|'pickup'|'secret', index } or null
     linkMode: false,
     pendingSwitchIndex: null,
     previewPos: null, // { x, y } in tile space (float) or null to use spawn1
@@ -103,6 +108,7 @@
     state.spawn2 = state.spawn2 && state.spawn2.x < w && state.spawn2.y < h ? state.spawn2 : null;
     state.enemies = state.enemies.filter((e) => e.tileX < w && e.tileY < h);
     state.pickups = state.pickups.filter((p) => p.tileX < w && p.tileY < h);
+    state.secrets = state.secrets.filter((s) => s.tileX < w && s.tileY < h);
     state.switchLinks = [];
     fillBorderWalls();
     refreshDoorSwitchLists();
@@ -145,6 +151,8 @@
         index: pi,
         label: PICKUP_NAMES[state.pickups[pi].type] + ' (' + x + ',' + y + ')',
       };
+    const si0 = state.secrets.findIndex((s) => s.tileX === x && s.tileY === y);
+    if (si0 >= 0) return { type: 'secret', index: si0, label: 'Secret (' + x + ',' + y + ')' };
     const doors = getDoors();
     const di = doors.findIndex((d) => d.tileX === x && d.tileY === y);
     if (di >= 0) return { type: 'door', index: di, label: 'Door ' + di };
@@ -376,6 +384,13 @@
       ctx.closePath();
       ctx.fill();
     });
+    state.secrets.forEach((s) => {
+      ctx.strokeStyle = '#d0f';
+      ctx.lineWidth = 2;
+      ctx.setLineDash([3, 2]);
+      ctx.strokeRect(s.tileX * cellPx + 1, s.tileY * cellPx + 1, cellPx - 2, cellPx - 2);
+      ctx.setLineDash([]);
+    });
 
     if (state.hoverEntity) {
       let hx, hy;
@@ -393,6 +408,10 @@
         const p = state.pickups[state.hoverEntity.index];
         hx = p.tileX;
         hy = p.tileY;
+      } else if (state.hoverEntity.type === 'secret' && state.secrets[state.hoverEntity.index]) {
+        const s = state.secrets[state.hoverEntity.index];
+        hx = s.tileX;
+        hy = s.tileY;
       } else {
         hx = null;
         hy = null;
@@ -827,7 +846,11 @@
         '  ·  Pickups: ' +
         state.pickups.length +
         ' / ' +
-        pickupCap;
+        pickupCap +
+        '  ·  Secrets: ' +
+        state.secrets.length +
+        ' / ' +
+        GAME_LIMITS.MAX_SECRETS;
       entityCapEl.classList.toggle(
         'over-limit',
         state.enemies.length > enemyCap || state.pickups.length > pickupCap,
@@ -857,6 +880,9 @@
     state.pickups.forEach((p, i) =>
       add('pickup', i, PICKUP_NAMES[p.type] + ' (' + p.tileX + ',' + p.tileY + ')', null, null),
     );
+    state.secrets.forEach((s, i) =>
+      add('secret', i, 'Secret (' + s.tileX + ',' + s.tileY + ')', null, null),
+    );
     if (!ul.children.length) {
       const li = document.createElement('li');
       li.textContent = 'None';
@@ -977,6 +1003,18 @@
       state.pickups.push({ type: state.pickupType, tileX: x, tileY: y });
       state.placing = null;
       document.getElementById('brushPickup').value = '';
+    } else if (state.placing === 'secret') {
+      if (state.secrets.length >= GAME_LIMITS.MAX_SECRETS) {
+        showToast(
+          'Max secrets reached (' +
+            GAME_LIMITS.MAX_SECRETS +
+            '). Remove one or increase MAX_SECRETS in level.h.',
+        );
+        return;
+      }
+      state.secrets.push({ tileX: x, tileY: y });
+      state.placing = null;
+      document.getElementById('brushSecret').classList.remove('selected');
     } else {
       setCell(x, y, state.brush);
       refreshDoorSwitchLists();
@@ -1019,6 +1057,8 @@
       })),
       pickups: state.pickups.map((p) => ({ type: p.type, tileX: p.tileX, tileY: p.tileY })),
       switchLinks: state.switchLinks.slice(),
+      secrets: state.secrets.map((s) => ({ tileX: s.tileX, tileY: s.tileY })),
+      notes: state.notes.slice(),
     };
   }
 
@@ -1089,6 +1129,20 @@
           ' (game limit).',
       );
     state.switchLinks = Array.isArray(obj.switchLinks) ? obj.switchLinks.slice() : [];
+    const rawSecrets = (obj.secrets || []).map((s) => ({
+      tileX: Number(s.tileX) || 0,
+      tileY: Number(s.tileY) || 0,
+    }));
+    state.secrets = rawSecrets.slice(0, GAME_LIMITS.MAX_SECRETS);
+    if (rawSecrets.length > GAME_LIMITS.MAX_SECRETS)
+      showToast(
+        'Loaded level had ' +
+          rawSecrets.length +
+          ' secrets; trimmed to ' +
+          GAME_LIMITS.MAX_SECRETS +
+          ' (game limit).',
+      );
+    state.notes = Array.isArray(obj.notes) ? obj.notes.map(String) : [];
     state.previewPos = state.spawn1
       ? { x: state.spawn1.x + 0.5, y: state.spawn1.y + 0.5 }
       : { x: state.mapW / 2, y: state.mapH / 2 };
@@ -1101,169 +1155,250 @@
     return true;
   }
 
-  /** Content for the .h file only (map + spawn defines). Do NOT put init functions here - they go in enemy.c/pickup.c. */
-  function buildExportHeaderFileContent() {
-    const id = (document.getElementById('levelId').value || 'e1m4')
-      .toLowerCase()
-      .replace(/\s/g, '');
-    const prefix = id.toUpperCase();
-    const W = state.mapW,
-      H = state.mapH;
-    const cells = W * H;
-    let out = '';
-    out += `/* VBDOOM_LEVEL_FORMAT ${LEVEL_FORMAT_VERSION} */\n`;
-    out += `/* ${id} map: ${W}x${H} */\n`;
-    out += `const u8 ${id}_map[${cells}] = {\n`;
-    for (let y = 0; y < H; y++) {
-      out += '/* Row ' + y + ' */ ';
-      for (let x = 0; x < W; x++) out += getCell(x, y) + (x < W - 1 ? ',' : '');
-      out += y < H - 1 ? ',\n' : '\n';
-    }
-    out += '};\n\n';
-    const s1 = state.spawn1 || { x: 0, y: 0, angle: 512 };
-    const s2 = state.spawn2 || { x: 0, y: 0, angle: 512 };
-    out += `/* ${id} spawn and level data */\n`;
-    out += `#define ${prefix}_SPAWN_X  (${s1.x} * 256 + 128)\n`;
-    out += `#define ${prefix}_SPAWN_Y  (${s1.y} * 256 + 128)\n`;
-    out += `#define ${prefix}_SPAWN2_X (${s2.x} * 256 + 128)\n`;
-    out += `#define ${prefix}_SPAWN2_Y (${s2.y} * 256 + 128)\n`;
-    return out;
+  /** Level id as a C identifier: <id>_level in <id>_level.h. */
+  function exportLevelId() {
+    const raw = (document.getElementById('levelId').value || 'e1m4').trim();
+    return (
+      raw
+        .toLowerCase()
+        .replace(/\s+/g, '')
+        .replace(/[^a-z0-9_]/g, '') || 'map'
+    );
   }
 
   /**
-   * Build export sections. Returns an array of {title, code} objects.
-   * Each section represents a distinct file or function that the user must
-   * copy into the right place.
+   * Map code tokens as [first tile index, bytes] (functions/level.h). Same as
+   * pack_map() in prepare_levels.py: a copy from the row above when it covers
+   * at least as much as a run, a run of three or more, else literals.
    */
-  function buildExportSections(headerOnly) {
-    const id = (document.getElementById('levelId').value || 'e1m4')
-      .toLowerCase()
-      .replace(/\s/g, '');
-    const prefix = id.toUpperCase();
-    const W = state.mapW,
-      H = state.mapH;
-    const cells = W * H;
-    const doors = getDoors();
-    const switches = getSwitches();
-    const s1 = state.spawn1 || { x: 0, y: 0, angle: 512 };
-    const s2 = state.spawn2 || { x: 0, y: 0, angle: 512 };
-    const sections = [];
-
-    /* ---- Section: header file (map array + defines) ---- */
-    {
-      let code = `/* VBDOOM_LEVEL_FORMAT ${LEVEL_FORMAT_VERSION} */\n`;
-      code += `/* ${id} map: ${W}x${H} */\n`;
-      code += `const u8 ${id}_map[${cells}] = {\n`;
-      for (let y = 0; y < H; y++) {
-        code += '/* Row ' + y + ' */ ';
-        for (let x = 0; x < W; x++) code += getCell(x, y) + (x < W - 1 ? ',' : '');
-        code += y < H - 1 ? ',\n' : '\n';
+  function packMap(tiles, w) {
+    const n = tiles.length;
+    const tokens = [];
+    let lit = [],
+      litStart = 0;
+    const flush = () => {
+      for (let k = 0; k < lit.length; k += 64) {
+        const chunk = lit.slice(k, k + 64);
+        tokens.push([litStart + k, [0xc0 | (chunk.length - 1)].concat(chunk)]);
+      }
+      lit = [];
+    };
+    let i = 0;
+    while (i < n) {
+      let up = 0;
+      if (i >= w) while (i + up < n && up < 64 && tiles[i + up] === tiles[i + up - w]) up++;
+      let run = 1;
+      while (i + run < n && run < 128 && tiles[i + run] === tiles[i]) run++;
+      if (up && up >= run) {
+        flush();
+        tokens.push([i, [0x80 | (up - 1)]]);
+        i += up;
+      } else if (run >= 3) {
+        flush();
+        tokens.push([i, [run - 1, tiles[i]]]);
+        i += run;
+      } else {
+        if (!lit.length) litStart = i;
+        lit.push(tiles[i]);
+        i++;
       }
-      code += '};\n\n';
-      code += `#define ${prefix}_SPAWN_X  (${s1.x} * 256 + 128)\n`;
-      code += `#define ${prefix}_SPAWN_Y  (${s1.y} * 256 + 128)\n`;
-      code += `#define ${prefix}_SPAWN2_X (${s2.x} * 256 + 128)\n`;
-      code += `#define ${prefix}_SPAWN2_Y (${s2.y} * 256 + 128)\n`;
-      sections.push({
-        title: `src/vbdoom/assets/doom/${id}.h  (save as file)`,
-        code,
-      });
     }
+    flush();
+    return tokens;
+  }
 
-    if (headerOnly) return sections;
+  const isOpenTile = (t) => t === 0 || DOOR_TILES.includes(t);
+
+  /** hasLineOfSight() (RayCasterFixed.c) from tile to tile, every door open. */
+  function sightLos(tiles, w, x0, y0, x1, y1) {
+    const dx = Math.abs(x1 - x0),
+      dy = Math.abs(y1 - y0);
+    const sx = x1 > x0 ? 1 : -1,
+      sy = y1 > y0 ? 1 : -1;
+    let err = dx - dy;
+    while (x0 !== x1 || y0 !== y1) {
+      const e2 = err * 2;
+      const stepX = e2 > -dy,
+        stepY = e2 < dx;
+      if (stepX) {
+        err -= dy;
+        x0 += sx;
+      }
+      if (stepY) {
+        err += dx;
+        y0 += sy;
+      }
+      if (x0 === x1 && y0 === y1) break;
+      if (stepX && stepY) {
+        if (!isOpenTile(tiles[(y0 - sy) * w + x0]) || !isOpenTile(tiles[y0 * w + x0 - sx]))
+          return false;
+      }
+      if (!isOpenTile(tiles[y0 * w + x0])) return false;
+    }
+    return true;
+  }
 
-    /* ---- Section: RayCasterData.h include ---- */
-    sections.push({
-      title: 'RayCasterData.h  (add this include)',
-      code: `#include "../assets/doom/${id}.h"`,
+  /**
+   * Block visibility of a level: [shift, rows of bytes]. Same as sight_table() in
+   * prepare_levels.py, which documents it; starts are the [x, y] of the player and
+   * enemy starts.
+   */
+  function buildSightTable(tiles, w, h, starts) {
+    let shift = 2;
+    const blocks = (s) => ((w + (1 << s) - 1) >> s) * ((h + (1 << s) - 1) >> s);
+    while (blocks(shift) > 64) shift++;
+    const bw = (w + (1 << shift) - 1) >> shift;
+    const n = blocks(shift);
+    const cells = [];
+    for (let i = 0; i < n; i++) cells.push([]);
+    const ends = new Set();
+    tiles.forEach((t, i) => {
+      if (isOpenTile(t)) ends.add(i);
     });
+    starts.forEach(([x, y]) => {
+      if (x >= 0 && x < w && y >= 0 && y < h) ends.add(y * w + x);
+    });
+    ends.forEach((i) => {
+      const x = i % w,
+        y = Math.floor(i / w);
+      cells[(y >> shift) * bw + (x >> shift)].push([x, y]);
+    });
+    const rows = [];
+    for (let i = 0; i < n; i++) rows.push(new Array((n + 7) >> 3).fill(0));
+    for (let a = 0; a < n; a++)
+      for (let b = a; b < n; b++) {
+        const sees = cells[a].some(([x0, y0]) =>
+          cells[b].some(
+            ([x1, y1]) => sightLos(tiles, w, x0, y0, x1, y1) || sightLos(tiles, w, x1, y1, x0, y0),
+          ),
+        );
+        if (sees) {
+          rows[a][b >> 3] |= 1 << (b & 7);
+          rows[b][a >> 3] |= 1 << (a & 7);
+        }
+      }
+    return [shift, rows];
+  }
 
-    /* ---- Section: enemy.c function ---- */
-    {
-      let code = `void initEnemies${prefix}(void) {\n`;
-      code +=
-        '\tint i; for (i = 0; i < MAX_ENEMIES; i++) { g_enemies[i].active = false; g_enemies[i].enemyType = ETYPE_ZOMBIEMAN; }\n';
-      state.enemies.forEach((e, i) => {
-        const health =
-          e.type === 0
-            ? 'ZOMBIE_HEALTH'
-            : e.type === 1
-              ? 'SGT_HEALTH'
-              : e.type === 2
-                ? 'IMP_HEALTH'
-                : e.type === 3
-                  ? 'DEMON_HEALTH'
-                  : 'COMMANDO_HEALTH';
-        const angle = e.angle != null ? e.angle : 0;
-        code += `\tg_enemies[${i}].x = ${e.tileX} * 256 + 128;\n`;
-        code += `\tg_enemies[${i}].y = ${e.tileY} * 256 + 128;\n`;
-        code += `\tg_enemies[${i}].angle = ${angle};\n`;
-        code += `\tg_enemies[${i}].active = true;\n`;
-        code += `\tg_enemies[${i}].enemyType = ETYPE_${['ZOMBIEMAN', 'SERGEANT', 'IMP', 'DEMON', 'COMMANDO'][e.type]};\n`;
-        code += `\tg_enemies[${i}].health = ${health};\n`;
-      });
-      code += '}';
-      sections.push({
-        title: `enemy.c  (paste this function)`,
-        code,
-      });
+  /**
+   * Packed level blob as [label, rows of bytes] sections, in file order (see
+   * functions/level.h). Same as level_sections() in prepare_levels.py. Throws
+   * if the level can't be packed.
+   */
+  function buildLevelSections(level) {
+    const w = level.mapW,
+      h = level.mapH,
+      tiles = level.map;
+    if (!(w > 0 && w <= 64 && h > 0 && h <= 64) || tiles.length !== w * h)
+      throw new Error('bad map size ' + w + 'x' + h + ' (' + tiles.length + ' tiles)');
+    if (!level.spawn1) throw new Error('no Spawn 1 (player start)');
+    const spawns = [level.spawn1, level.spawn2].filter((s) => s);
+    if (tiles.some((t) => !(t >= 0 && t <= 255))) throw new Error('map: tile out of range');
+    const numSwitches = tiles.filter((t) => t === 5).length;
+    const links = level.switchLinks || [];
+    const enemies = level.enemies || [];
+    const pickups = level.pickups || [];
+    const secrets = level.secrets || [];
+    const u16 = (v) => [v & 0xff, (v >> 8) & 0xff];
+
+    const sections = [
+      [
+        'Header',
+        [
+          [86, 66, 76, LEVEL_BLOB_VERSION, w, h, spawns.length, enemies.length, pickups.length]
+            .concat([numSwitches, secrets.length, 0]),
+        ],
+      ],
+    ];
+    sections.push([
+      'Spawns',
+      spawns.map((s) => [s.x, s.y].concat(u16(s.angle != null ? s.angle : 512))),
+    ]);
+    sections.push([
+      'Enemies',
+      enemies.map((e) => [e.type, e.tileX, e.tileY].concat(u16(e.angle != null ? e.angle : 0))),
+    ]);
+    sections.push(['Pickups', pickups.map((p) => [p.type, p.tileX, p.tileY])]);
+    const switchRows = [];
+    for (let i = 0; i < numSwitches; i++) {
+      const link = i < links.length ? links[i] : 0;
+      switchRows.push(link === -1 ? [1, 0] : [0, link]); /* SW_EXIT / SW_DOOR */
     }
+    sections.push(['Switches', switchRows]);
+    sections.push(['Secrets', secrets.map((s) => [s.tileX, s.tileY])]);
+    const starts = spawns
+      .map((s) => [s.x, s.y])
+      .concat(enemies.map((e) => [e.tileX, e.tileY]));
+    const [shift, sightRows] = buildSightTable(tiles, w, h, starts);
+    sections[0][1][0][11] = shift;
+    sightRows.forEach((row, a) => sections.push(['Sight ' + a, [row]]));
+    const tokens = packMap(tiles, w);
+    for (let y = 0; y < h; y++)
+      sections.push([
+        'Map row ' + y,
+        tokens.filter(([i]) => Math.floor(i / w) === y).map(([, bytes]) => bytes),
+      ]);
+
+    sections.forEach(([label, rows]) =>
+      rows.forEach((row) => {
+        if (row.some((b) => !(b >= 0 && b <= 255)))
+          throw new Error(label + ': value out of range in ' + row.join(','));
+      }),
+    );
+    return sections;
+  }
 
-    /* ---- Section: enemy.h declaration ---- */
-    sections.push({
-      title: 'enemy.h  (add this declaration)',
-      code: `void initEnemies${prefix}(void);`,
+  /** C header for one level blob; prepare_levels.py level_header() writes the same text. */
+  function buildLevelHeader(id, level) {
+    const sections = buildLevelSections(level);
+    let size = 0;
+    sections.forEach(([, rows]) => rows.forEach((row) => (size += row.length)));
+    let out = `/* ${id}_level.h -- level ${id}, see functions/level.h for the format.\n`;
+    out += ` * Generated from levels/${id}.json; edit that and run prepare_levels.py. */\n`;
+    const notes = level.notes || [];
+    if (notes.length) {
+      out += '/*\n';
+      notes.forEach((line) => (out += (' * ' + line.split('*/').join('* /')).trimEnd() + '\n'));
+      out += ' */\n';
+    }
+    out += `const u8 ${id}_level[${size}] = {\n`;
+    sections.forEach(([label, rows]) => {
+      if (rows.length) out += `/* ${label} */ ${rows.map((row) => row.join(',')).join(', ')},\n`;
     });
+    out += '};\n';
+    return out;
+  }
 
-    /* ---- Section: pickup.c function ---- */
-    {
-      let code = `void initPickups${prefix}(void) {\n`;
-      code += '\tint i; for (i = 0; i < MAX_PICKUPS; i++) g_pickups[i].active = false;\n';
-      state.pickups.forEach((p, i) => {
-        code += `\tg_pickups[${i}].x = ${p.tileX} * 256 + 128;\n`;
-        code += `\tg_pickups[${i}].y = ${p.tileY} * 256 + 128;\n`;
-        code += `\tg_pickups[${i}].type = PICKUP_${['AMMO_CLIP', 'HEALTH_SMALL', 'HEALTH_LARGE', 'WEAPON_SHOTGUN', 'HELMET', 'ARMOR', 'SHELLS', 'WEAPON_ROCKET', 'KEY_RED', 'KEY_YELLOW', 'KEY_BLUE', 'WEAPON_CHAINGUN'][p.type]};\n`;
-        code += `\tg_pickups[${i}].active = true;\n`;
-      });
-      code += '}';
-      sections.push({
-        title: `pickup.c  (paste this function)`,
-        code,
-      });
+  /**
+   * Build export sections. Returns an array of {title, code} objects.
+   * Each section represents a distinct file or snippet that the user must
+   * copy into the right place. Returns null (after a toast) if the level
+   * can't be packed.
+   */
+  function buildExportSections(headerOnly) {
+    const id = exportLevelId();
+    let code;
+    try {
+      code = buildLevelHeader(id, buildJson());
+    } catch (err) {
+      showToast('Cannot export: ' + err.message + '.');
+      return null;
     }
+    const sections = [];
 
-    /* ---- Section: pickup.h declaration ---- */
+    /* ---- Section: the level blob header ---- */
     sections.push({
-      title: 'pickup.h  (add this declaration)',
-      code: `void initPickups${prefix}(void);`,
+      title: `src/vbdoom/assets/doom/${id}_level.h  (save as file)`,
+      code,
     });
 
-    /* ---- Section: gameLoop.c loadLevel() block ---- */
-    {
-      let code = '';
-      code += `{ u16 row; for (row = 0; row < ${H}; row++) copymem((u8*)g_map + row * MAP_X, (const u8*)${id}_map + row * ${W}, ${W}); }\n`;
-      code += `{ u16 i; for (i = ${H} * MAP_X; i < MAP_CELLS; i++) ((u8*)g_map)[i] = 0; }\n`;
-      code += `{ u16 row; for (row = 0; row < ${H}; row++) { u16 c; for (c = ${W}; c < MAP_X; c++) ((u8*)g_map)[row * MAP_X + c] = 0; } }\n`;
-      code += `fPlayerX = ${prefix}_SPAWN_X;\n`;
-      code += `fPlayerY = ${prefix}_SPAWN_Y;\n`;
-      code += `fPlayerAng = ${s1.angle};\n`;
-      code += `initEnemies${prefix}();\n`;
-      code += `initPickups${prefix}();\n`;
-      code += `initDoors();\n`;
-      doors.forEach((d, i) => {
-        code += `registerDoor(${d.tileX}, ${d.tileY});  /* door ${i} */\n`;
-      });
-      switches.forEach((s, i) => {
-        const link = state.switchLinks[i];
-        const type = link === -1 ? 'SW_EXIT' : 'SW_DOOR';
-        const linkArg = link === -1 ? '0' : String(link);
-        code += `registerSwitch(${s.tileX}, ${s.tileY}, ${type}, ${linkArg});\n`;
-      });
-      sections.push({
-        title: `gameLoop.c  →  loadLevel()  →  else if (levelNum == N) { ... }`,
-        code,
-      });
-    }
+    if (headerOnly) return sections;
+
+    /* ---- Section: level.c table entry ---- */
+    sections.push({
+      title: 'level.c  (add the include and the g_levels[] entry; raise NUM_LEVELS in level.h)',
+      code: `#include "../assets/doom/${id}_level.h"\n\n    ${id}_level,`,
+    });
 
     return sections;
   }
@@ -1343,6 +1478,7 @@
         document.querySelectorAll('.brush-cell').forEach((c) => c.classList.remove('selected'));
         document.getElementById('brushSpawn1').classList.remove('selected');
         document.getElementById('brushSpawn2').classList.remove('selected');
+        document.getElementById('brushSecret').classList.remove('selected');
         document.getElementById('brushEnemy').value = '';
         document.getElementById('brushPickup').value = '';
         cell.classList.add('selected');
@@ -1357,6 +1493,7 @@
   document.getElementById('brushSpawn1').addEventListener('click', () => {
     state.placing = 'spawn1';
     document.getElementById('brushSpawn2').classList.remove('selected');
+    document.getElementById('brushSecret').classList.remove('selected');
     document.getElementById('brushEnemy').value = '';
     document.getElementById('brushPickup').value = '';
     document.getElementById('brushSpawn1').classList.add('selected');
@@ -1364,10 +1501,25 @@
   document.getElementById('brushSpawn2').addEventListener('click', () => {
     state.placing = 'spawn2';
     document.getElementById('brushSpawn1').classList.remove('selected');
+    document.getElementById('brushSecret').classList.remove('selected');
     document.getElementById('brushEnemy').value = '';
     document.getElementById('brushPickup').value = '';
     document.getElementById('brushSpawn2').classList.add('selected');
   });
+  document.getElementById('brushSecret').addEventListener('click', () => {
+    if (state.secrets.length >= GAME_LIMITS.MAX_SECRETS) {
+      showToast(
+        'Max secrets (' + GAME_LIMITS.MAX_SECRETS + ') reached. Remove one before adding more.',
+      );
+      return;
+    }
+    state.placing = 'secret';
+    document.getElementById('brushSpawn1').classList.remove('selected');
+    document.getElementById('brushSpawn2').classList.remove('selected');
+    document.getElementById('brushEnemy').value = '';
+    document.getElementById('brushPickup').value = '';
+    document.getElementById('brushSecret').classList.add('selected');
+  });
   document.getElementById('brushEnemy').addEventListener('change', function () {
     const v = this.value;
     if (v === '') {
@@ -1385,6 +1537,7 @@
     state.enemyType = parseInt(v, 10);
     document.getElementById('brushSpawn1').classList.remove('selected');
     document.getElementById('brushSpawn2').classList.remove('selected');
+    document.getElementById('brushSecret').classList.remove('selected');
     document.getElementById('brushPickup').value = '';
   });
   document.getElementById('brushPickup').addEventListener('change', function () {
@@ -1404,6 +1557,7 @@
     state.pickupType = parseInt(v, 10);
     document.getElementById('brushSpawn1').classList.remove('selected');
     document.getElementById('brushSpawn2').classList.remove('selected');
+    document.getElementById('brushSecret').classList.remove('selected');
     document.getElementById('brushEnemy').value = '';
   });
 
@@ -1453,6 +1607,13 @@
         drawGrid();
         return;
       }
+      const si = state.secrets.findIndex((s) => s.tileX === x && s.tileY === y);
+      if (si >= 0) {
+        state.secrets.splice(si, 1);
+        refreshEntityList();
+        drawGrid();
+        return;
+      }
       return;
     }
     if (e.button !== 0) return;
@@ -1630,6 +1791,84 @@
     };
   }
 
+  /**
+   * Parse a packed level header (<id>_level.h, see buildLevelHeader) back into
+   * level JSON. Returns { levelId, level } or null if there's no level blob.
+   */
+  function parseLevelBlobFile(text) {
+    const arrMatch = text.match(/const\s+u8\s+(\w+)_level\s*\[\s*\d*\s*\]\s*=\s*\{/);
+    if (!arrMatch) return null;
+    const openIdx = text.indexOf('{', arrMatch.index);
+    const closeIdx = text.indexOf('};', openIdx);
+    if (closeIdx < 0) return null;
+    const body = text.substring(openIdx + 1, closeIdx).replace(/\/\*[\s\S]*?\*\//g, '');
+    const b = (body.match(/\d+/g) || []).map((v) => parseInt(v, 10));
+    if (b.length < 12 || b[0] !== 86 || b[1] !== 66 || b[2] !== 76 || b[3] !== LEVEL_BLOB_VERSION)
+      return null;
+    const w = b[4],
+      h = b[5];
+    let p = 12;
+    const take = (n) => b.slice(p, (p += n));
+    const spawns = [];
+    for (let i = 0; i < b[6]; i++) {
+      const s = take(4);
+      spawns.push({ x: s[0], y: s[1], angle: s[2] | (s[3] << 8) });
+    }
+    const enemies = [];
+    for (let i = 0; i < b[7]; i++) {
+      const e = take(5);
+      enemies.push({ type: e[0], tileX: e[1], tileY: e[2], angle: e[3] | (e[4] << 8) });
+    }
+    const pickups = [];
+    for (let i = 0; i < b[8]; i++) {
+      const q = take(3);
+      pickups.push({ type: q[0], tileX: q[1], tileY: q[2] });
+    }
+    const switchLinks = [];
+    for (let i = 0; i < b[9]; i++) {
+      const s = take(2);
+      switchLinks.push(s[0] === 1 ? -1 : s[1]);
+    }
+    const secrets = [];
+    for (let i = 0; i < b[10]; i++) {
+      const s = take(2);
+      secrets.push({ tileX: s[0], tileY: s[1] });
+    }
+    if (b[11]) {
+      /* Sight table: rebuilt from the map on export */
+      const blocks = ((w + (1 << b[11]) - 1) >> b[11]) * ((h + (1 << b[11]) - 1) >> b[11]);
+      take(blocks * ((blocks + 7) >> 3));
+    }
+    /* Map code: run / copy from the row above / literals */
+    const map = [];
+    while (map.length < w * h && p < b.length) {
+      const c = b[p++];
+      const n = (c < 0x80 ? c : c & 0x3f) + 1;
+      for (let k = 0; k < n && map.length < w * h; k++) {
+        if (c < 0x80) map.push(b[p]);
+        else if (c < 0xc0) map.push(map.length >= w ? map[map.length - w] : 0);
+        else map.push(b[p++]);
+      }
+      if (c < 0x80) p++;
+    }
+    if (p > b.length || map.length !== w * h) return null;
+    return {
+      levelId: arrMatch[1],
+      level: {
+        version: LEVEL_FORMAT_VERSION,
+        mapW: w,
+        mapH: h,
+        map,
+        spawn1: spawns[0] || null,
+        spawn2: spawns[1] || null,
+        enemies,
+        pickups,
+        switchLinks,
+        secrets,
+      },
+    };
+  }
+
   document.getElementById('btnLoadH').addEventListener('click', () => {
     document.getElementById('loadHInput').click();
   });
@@ -1638,10 +1877,22 @@
     if (!f) return;
     const r = new FileReader();
     r.onload = function () {
+      const blob = parseLevelBlobFile(r.result);
+      if (blob) {
+        if (loadFromJson(blob.level)) {
+          document.getElementById('levelId').value = blob.levelId;
+          const sizeSelect = document.getElementById('mapSize');
+          const sizeKey = blob.level.mapW + ',' + blob.level.mapH;
+          if (Array.from(sizeSelect.options).some((o) => o.value === sizeKey))
+            sizeSelect.value = sizeKey;
+          showToast('Loaded ' + blob.levelId + ' from its level blob.');
+        }
+        return;
+      }
       const parsed = parseHFile(r.result);
       if (!parsed) {
         alert(
-          'Could not find a valid map array in the .h file.\nExpected: const u8 <name>_map[N] = { ... };',
+          'Could not find a level blob or map array in the .h file.\nExpected: const u8 <name>_level[N] = { ... }; or const u8 <name>_map[N] = { ... };',
         );
         return;
       }
@@ -1692,13 +1943,7 @@
   });
 
   function getExportFileName() {
-    const raw = (document.getElementById('levelId').value || 'e1m4').trim();
-    const safe =
-      raw
-        .toLowerCase()
-        .replace(/\s+/g, '')
-        .replace(/[^a-z0-9_]/g, '') || 'map';
-    return safe + '.h';
+    return exportLevelId() + '_level.h';
   }
 
   function openExportModal() {
@@ -1708,12 +1953,16 @@
     if (checklistEl) checklistEl.textContent = fn;
   }
   document.getElementById('btnExport').addEventListener('click', () => {
-    renderExportSections(buildExportSections(false));
+    const sections = buildExportSections(false);
+    if (!sections) return;
+    renderExportSections(sections);
     openExportModal();
     document.getElementById('exportModal').classList.remove('hidden');
   });
   document.getElementById('btnExportHeader').addEventListener('click', () => {
-    renderExportSections(buildExportSections(true));
+    const sections = buildExportSections(true);
+    if (!sections) return;
+    renderExportSections(sections);
     openExportModal();
     document.getElementById('exportModal').classList.remove('hidden');
   });
@@ -1723,8 +1972,9 @@
 
   document.getElementById('btnSaveAsHeader').addEventListener('click', () => {
     const fileName = getExportFileName();
-    /* Save only map + spawn defines so the .h can be #included from RayCasterData.h without pulling in enemy/pickup types */
-    const text = buildExportHeaderFileContent();
+    const sections = buildExportSections(true);
+    if (!sections) return;
+    const text = sections[0].code;
     const blob = new Blob([text], { type: 'text/plain;charset=utf-8' });
     const url = URL.createObjectURL(blob);
     const a = document.createElement('a');